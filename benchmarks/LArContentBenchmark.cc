@@ -0,0 +1,774 @@
+/**
+ *  @file   benchmarks/LArContentBenchmark.cc
+ *
+ *  @brief  Micro-benchmarks for the core lar content objects and helpers, run on a synthetic event of track-like and shower-like hits.
+ *
+ *  $Log: $
+ */
+
+#include "Api/PandoraApi.h"
+#include "Pandora/AlgorithmHeaders.h"
+
+#include "larpandoracontent/LArHelpers/LArClusterHelper.h"
+#include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
+#include "larpandoracontent/LArHelpers/LArPcaHelper.h"
+#include "larpandoracontent/LArObjects/LArAdaBoostDecisionTree.h"
+#include "larpandoracontent/LArObjects/LArOverlapTensor.h"
+#include "larpandoracontent/LArObjects/LArThreeDSlidingFitResult.h"
+#include "larpandoracontent/LArObjects/LArTwoDSlidingFitResult.h"
+#include "larpandoracontent/LArPlugins/LArPseudoLayerPlugin.h"
+#include "larpandoracontent/LArPlugins/LArRotationalTransformationPlugin.h"
+#include "larpandoracontent/LArUtility/KDTreeLinkerAlgoT.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace pandora;
+using namespace lar_content;
+
+namespace lar_content_benchmark
+{
+
+/**
+ *  @brief  SyntheticHit class, the parent of each synthetic calo hit
+ */
+class SyntheticHit
+{
+public:
+    /**
+     *  @brief  Constructor
+     *
+     *  @param  position3D the three dimensional position
+     *  @param  hitType the view in which the calo hit is created
+     *  @param  particleId the id of the synthetic particle
+     */
+    SyntheticHit(const CartesianVector &position3D, const HitType hitType, const unsigned int particleId);
+
+    CartesianVector m_position3D; ///< The three dimensional position
+    HitType m_hitType;            ///< The view in which the calo hit is created
+    unsigned int m_particleId;    ///< The id of the synthetic particle
+};
+
+typedef std::vector<SyntheticHit> SyntheticHitVector;
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  SyntheticEventGenerator class, generating the three dimensional positions of track-like and shower-like particles
+ */
+class SyntheticEventGenerator
+{
+public:
+    /**
+     *  @brief  Constructor
+     *
+     *  @param  seed the random number seed
+     */
+    SyntheticEventGenerator(const unsigned int seed);
+
+    /**
+     *  @brief  Generate a track-like particle, a mildly scattering line of positions spaced by roughly a wire pitch
+     *
+     *  @param  nPositions the number of positions
+     *  @param  positions to receive the positions
+     */
+    void GenerateTrack(const unsigned int nPositions, CartesianPointVector &positions);
+
+    /**
+     *  @brief  Generate a shower-like particle, with a longitudinal profile peaking after the vertex and a widening transverse profile
+     *
+     *  @param  nPositions the number of positions
+     *  @param  positions to receive the positions
+     */
+    void GenerateShower(const unsigned int nPositions, CartesianPointVector &positions);
+
+private:
+    /**
+     *  @brief  Get a random particle vertex, within the central region of the detector
+     *
+     *  @return the vertex
+     */
+    CartesianVector GetRandomVertex();
+
+    /**
+     *  @brief  Get a random unit direction
+     *
+     *  @return the direction
+     */
+    CartesianVector GetRandomDirection();
+
+    std::mt19937 m_randomEngine; ///< The random engine
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  BenchmarkAlgorithm class, timing the core lar content objects and helpers on the synthetic event
+ */
+class BenchmarkAlgorithm : public Algorithm
+{
+public:
+    /**
+     *  @brief  Factory class for instantiating algorithm
+     */
+    class Factory : public AlgorithmFactory
+    {
+    public:
+        Algorithm *CreateAlgorithm() const;
+    };
+
+    /**
+     *  @brief  Default constructor
+     */
+    BenchmarkAlgorithm();
+
+private:
+    typedef std::map<unsigned int, CartesianPointVector> ParticleToPositionsMap;
+    typedef KDTreeLinkerAlgo<const CaloHit *, 2> HitKDTree2D;
+    typedef KDTreeNodeInfoT<const CaloHit *, 2> HitKDNode2D;
+    typedef std::vector<HitKDNode2D> HitKDNode2DList;
+
+    StatusCode Run();
+    StatusCode ReadSettings(const TiXmlHandle xmlHandle);
+
+    /**
+     *  @brief  Create a cluster for each synthetic particle in each view, in a temporary list
+     *
+     *  @param  clusterVectorU to receive the u view clusters, ordered by particle id
+     *  @param  clusterVectorV to receive the v view clusters, ordered by particle id
+     *  @param  clusterVectorW to receive the w view clusters, ordered by particle id
+     *  @param  caloHitListW to receive the w view calo hits
+     *  @param  particleToPositionsMap to receive the three dimensional positions of each particle
+     */
+    void CreateClusters(ClusterVector &clusterVectorU, ClusterVector &clusterVectorV, ClusterVector &clusterVectorW,
+        CaloHitList &caloHitListW, ParticleToPositionsMap &particleToPositionsMap) const;
+
+    /**
+     *  @brief  Time a benchmark, reporting the minimum, median and mean wall time per repeat and the checksum of the last repeat
+     *
+     *  @param  name the benchmark name
+     *  @param  function the benchmark, returning a checksum of its results so that changes in output can be spotted
+     */
+    template <typename FUNCTION>
+    void Time(const std::string &name, const FUNCTION &function) const;
+
+    unsigned int m_nRepeats;         ///< The number of times to repeat each benchmark
+    unsigned int m_slidingFitWindow; ///< The sliding fit half window
+    float m_kdSearchRegion;          ///< The half width of the kd tree search region, units cm
+    std::string m_bdtFileName;       ///< The name of the synthetic bdt xml file
+    std::string m_bdtName;           ///< The name of the synthetic bdt
+    unsigned int m_nBdtFeatures;     ///< The number of features used by the synthetic bdt
+    unsigned int m_nBdtExamples;     ///< The number of feature vectors to score
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+SyntheticHit::SyntheticHit(const CartesianVector &position3D, const HitType hitType, const unsigned int particleId) :
+    m_position3D(position3D),
+    m_hitType(hitType),
+    m_particleId(particleId)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+SyntheticEventGenerator::SyntheticEventGenerator(const unsigned int seed) : m_randomEngine(seed)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void SyntheticEventGenerator::GenerateTrack(const unsigned int nPositions, CartesianPointVector &positions)
+{
+    std::normal_distribution<float> scatterDistribution(0.f, 0.003f), jitterDistribution(0.f, 0.05f);
+    CartesianVector position(this->GetRandomVertex()), direction(this->GetRandomDirection());
+
+    for (unsigned int i = 0; i < nPositions; ++i)
+    {
+        const float jitterX(jitterDistribution(m_randomEngine)), jitterY(jitterDistribution(m_randomEngine));
+        const float jitterZ(jitterDistribution(m_randomEngine));
+        positions.push_back(position + CartesianVector(jitterX, jitterY, jitterZ));
+
+        const float scatterX(scatterDistribution(m_randomEngine)), scatterY(scatterDistribution(m_randomEngine));
+        const float scatterZ(scatterDistribution(m_randomEngine));
+        const CartesianVector scatter(scatterX, scatterY, scatterZ);
+        direction = (direction + scatter).GetUnitVector();
+        position += direction * 0.3f;
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void SyntheticEventGenerator::GenerateShower(const unsigned int nPositions, CartesianPointVector &positions)
+{
+    std::gamma_distribution<float> longitudinalDistribution(2.f, 15.f);
+    std::normal_distribution<float> transverseDistribution(0.f, 1.f);
+    const CartesianVector vertex(this->GetRandomVertex()), direction(this->GetRandomDirection());
+
+    const CartesianVector helperAxis(
+        (std::fabs(direction.GetX()) < 0.9f) ? CartesianVector(1.f, 0.f, 0.f) : CartesianVector(0.f, 1.f, 0.f));
+    const CartesianVector transverseAxis1(direction.GetCrossProduct(helperAxis).GetUnitVector());
+    const CartesianVector transverseAxis2(direction.GetCrossProduct(transverseAxis1).GetUnitVector());
+
+    for (unsigned int i = 0; i < nPositions; ++i)
+    {
+        const float depth(longitudinalDistribution(m_randomEngine)), width(0.3f + 0.05f * depth);
+        const float transverse1(width * transverseDistribution(m_randomEngine));
+        const float transverse2(width * transverseDistribution(m_randomEngine));
+        positions.push_back(vertex + direction * depth + transverseAxis1 * transverse1 + transverseAxis2 * transverse2);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+CartesianVector SyntheticEventGenerator::GetRandomVertex()
+{
+    std::uniform_real_distribution<float> xDistribution(-90.f, 90.f), yDistribution(-300.f, 300.f), zDistribution(-350.f, 350.f);
+    const float x(xDistribution(m_randomEngine)), y(yDistribution(m_randomEngine)), z(zDistribution(m_randomEngine));
+
+    return CartesianVector(x, y, z);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+CartesianVector SyntheticEventGenerator::GetRandomDirection()
+{
+    std::uniform_real_distribution<float> cosThetaDistribution(-1.f, 1.f), phiDistribution(0.f, 2.f * static_cast<float>(M_PI));
+    const float cosTheta(cosThetaDistribution(m_randomEngine)), phi(phiDistribution(m_randomEngine));
+    const float sinTheta(std::sqrt(std::max(0.f, 1.f - cosTheta * cosTheta)));
+
+    return CartesianVector(sinTheta * std::cos(phi), sinTheta * std::sin(phi), cosTheta);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+Algorithm *BenchmarkAlgorithm::Factory::CreateAlgorithm() const
+{
+    return new BenchmarkAlgorithm();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+BenchmarkAlgorithm::BenchmarkAlgorithm() :
+    m_nRepeats(20),
+    m_slidingFitWindow(20),
+    m_kdSearchRegion(2.f),
+    m_bdtName("Benchmark"),
+    m_nBdtFeatures(10),
+    m_nBdtExamples(10000)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode BenchmarkAlgorithm::Run()
+{
+    ClusterVector clusterVectorU, clusterVectorV, clusterVectorW;
+    CaloHitList caloHitListW;
+    ParticleToPositionsMap particleToPositionsMap;
+    this->CreateClusters(clusterVectorU, clusterVectorV, clusterVectorW, caloHitListW, particleToPositionsMap);
+
+    const float layerPitch(LArGeometryHelper::GetWirePitch(this->GetPandora(), TPC_VIEW_W));
+
+    std::cout << std::left << std::setw(48) << "Benchmark" << std::right << std::setw(14) << "Min (us)" << std::setw(14) << "Median (us)"
+              << std::setw(14) << "Mean (us)" << std::setw(20) << "Checksum" << std::endl;
+
+    this->Time("TwoDSlidingFitResult::Construct", [&]() -> double {
+        double checksum(0.);
+
+        for (const Cluster *const pCluster : clusterVectorW)
+        {
+            const TwoDSlidingFitResult slidingFitResult(pCluster, m_slidingFitWindow, layerPitch);
+            checksum += slidingFitResult.GetMaxLayer() - slidingFitResult.GetMinLayer();
+        }
+
+        return checksum;
+    });
+
+    TwoDSlidingFitResultList slidingFitResultList;
+
+    for (const Cluster *const pCluster : clusterVectorW)
+        slidingFitResultList.emplace_back(pCluster, m_slidingFitWindow, layerPitch);
+
+    this->Time("TwoDSlidingFitResult::GetGlobalFitPosition/Direction", [&]() -> double {
+        double checksum(0.);
+
+        for (const TwoDSlidingFitResult &slidingFitResult : slidingFitResultList)
+        {
+            for (int layer = slidingFitResult.GetMinLayer(); layer <= slidingFitResult.GetMaxLayer(); ++layer)
+            {
+                const float rL(slidingFitResult.GetL(layer));
+                CartesianVector position(0.f, 0.f, 0.f), direction(0.f, 0.f, 0.f);
+
+                if ((STATUS_CODE_SUCCESS == slidingFitResult.GetGlobalFitPosition(rL, position)) &&
+                    (STATUS_CODE_SUCCESS == slidingFitResult.GetGlobalFitDirection(rL, direction)))
+                    checksum += position.GetX() + direction.GetZ();
+            }
+        }
+
+        return checksum;
+    });
+
+    this->Time("ThreeDSlidingFitResult::Construct", [&]() -> double {
+        double checksum(0.);
+
+        for (const ParticleToPositionsMap::value_type &mapEntry : particleToPositionsMap)
+        {
+            const ThreeDSlidingFitResult slidingFitResult(&mapEntry.second, m_slidingFitWindow, layerPitch);
+            checksum += slidingFitResult.GetMaxLayer() - slidingFitResult.GetMinLayer();
+        }
+
+        return checksum;
+    });
+
+    this->Time("KDTreeLinkerAlgo::build", [&]() -> double {
+        HitKDTree2D kdTree;
+        HitKDNode2DList hitKDNode2DList;
+        const KDTreeBox hitsBoundingRegion2D(fill_and_bound_2d_kd_tree(caloHitListW, hitKDNode2DList));
+        kdTree.build(hitKDNode2DList, hitsBoundingRegion2D);
+
+        return static_cast<double>(hitKDNode2DList.size());
+    });
+
+    HitKDTree2D kdTree;
+    HitKDNode2DList hitKDNode2DList;
+    const KDTreeBox hitsBoundingRegion2D(fill_and_bound_2d_kd_tree(caloHitListW, hitKDNode2DList));
+    kdTree.build(hitKDNode2DList, hitsBoundingRegion2D);
+
+    this->Time("KDTreeLinkerAlgo::search", [&]() -> double {
+        double checksum(0.);
+        HitKDNode2DList found;
+
+        for (const CaloHit *const pCaloHit : caloHitListW)
+        {
+            found.clear();
+            kdTree.search(build_2d_kd_search_region(pCaloHit, m_kdSearchRegion, m_kdSearchRegion), found);
+            checksum += found.size();
+        }
+
+        return checksum;
+    });
+
+    this->Time("LArClusterHelper::GetClosestDistance", [&]() -> double {
+        double checksum(0.);
+
+        for (ClusterVector::const_iterator iter1 = clusterVectorW.begin(); iter1 != clusterVectorW.end(); ++iter1)
+        {
+            for (ClusterVector::const_iterator iter2 = std::next(iter1); iter2 != clusterVectorW.end(); ++iter2)
+                checksum += LArClusterHelper::GetClosestDistance(*iter1, *iter2);
+        }
+
+        return checksum;
+    });
+
+    // ATTN Connect each u cluster to the v and w clusters of its own and the neighbouring particles, giving a sparse but chained tensor
+    auto fillOverlapTensor = [&](OverlapTensor<float> &overlapTensor) {
+        const int nClusters(static_cast<int>(clusterVectorU.size()));
+
+        for (int iU = 0; iU < nClusters; ++iU)
+        {
+            for (int iV = std::max(0, iU - 1); iV <= std::min(nClusters - 1, iU + 1); ++iV)
+            {
+                for (int iW = std::max(0, iU - 1); iW <= std::min(nClusters - 1, iU + 1); ++iW)
+                {
+                    const float overlapResult(1.f / static_cast<float>(1 + iU + iV + iW));
+                    overlapTensor.SetOverlapResult(clusterVectorU.at(iU), clusterVectorV.at(iV), clusterVectorW.at(iW), overlapResult);
+                }
+            }
+        }
+    };
+
+    this->Time("OverlapTensor::SetOverlapResult", [&]() -> double {
+        OverlapTensor<float> overlapTensor;
+        fillOverlapTensor(overlapTensor);
+
+        ClusterVector sortedKeyClusters;
+        overlapTensor.GetSortedKeyClusters(sortedKeyClusters);
+
+        return static_cast<double>(sortedKeyClusters.size());
+    });
+
+    OverlapTensor<float> overlapTensor;
+    fillOverlapTensor(overlapTensor);
+
+    this->Time("OverlapTensor::GetConnectedElements", [&]() -> double {
+        double checksum(0.);
+
+        for (const Cluster *const pClusterU : clusterVectorU)
+        {
+            OverlapTensor<float>::ElementList elementList;
+            overlapTensor.GetConnectedElements(pClusterU, true, elementList);
+            checksum += elementList.size();
+        }
+
+        return checksum;
+    });
+
+    AdaBoostDecisionTree adaBoostDecisionTree;
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, adaBoostDecisionTree.Initialize(m_bdtFileName, m_bdtName));
+
+    std::mt19937 randomEngine(1234);
+    std::uniform_real_distribution<double> featureDistribution(0., 1.);
+    LArMvaHelper::MvaFeatureMatrix featureMatrix(m_nBdtExamples, LArMvaHelper::MvaFeatureVector(m_nBdtFeatures));
+
+    for (LArMvaHelper::MvaFeatureVector &featureVector : featureMatrix)
+    {
+        for (LArMvaHelper::MvaFeature &feature : featureVector)
+            feature = featureDistribution(randomEngine);
+    }
+
+    this->Time("AdaBoostDecisionTree::CalculateClassificationScore", [&]() -> double {
+        double checksum(0.);
+
+        for (const LArMvaHelper::MvaFeatureVector &featureVector : featureMatrix)
+            checksum += adaBoostDecisionTree.CalculateClassificationScore(featureVector);
+
+        return checksum;
+    });
+
+    this->Time("AdaBoostDecisionTree::CalculateClassificationScores", [&]() -> double {
+        LArMvaHelper::DoubleVector scores;
+        adaBoostDecisionTree.CalculateClassificationScores(featureMatrix, scores);
+
+        return std::accumulate(scores.begin(), scores.end(), 0.);
+    });
+
+    this->Time("LArPcaHelper::RunPca", [&]() -> double {
+        double checksum(0.);
+
+        for (const ParticleToPositionsMap::value_type &mapEntry : particleToPositionsMap)
+        {
+            CartesianVector centroid(0.f, 0.f, 0.f);
+            LArPcaHelper::EigenValues eigenValues(0.f, 0.f, 0.f);
+            LArPcaHelper::EigenVectors eigenVectors;
+            LArPcaHelper::RunPca(mapEntry.second, centroid, eigenValues, eigenVectors);
+            checksum += eigenValues.GetX();
+        }
+
+        return checksum;
+    });
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void BenchmarkAlgorithm::CreateClusters(ClusterVector &clusterVectorU, ClusterVector &clusterVectorV, ClusterVector &clusterVectorW,
+    CaloHitList &caloHitListW, ParticleToPositionsMap &particleToPositionsMap) const
+{
+    const CaloHitList *pCaloHitList(nullptr);
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::GetCurrentList(*this, pCaloHitList));
+
+    std::map<HitType, std::map<unsigned int, CaloHitList>> particleHitsMap;
+
+    for (const CaloHit *const pCaloHit : *pCaloHitList)
+    {
+        const SyntheticHit *const pSyntheticHit(static_cast<const SyntheticHit *>(pCaloHit->GetParentAddress()));
+        particleHitsMap[pCaloHit->GetHitType()][pSyntheticHit->m_particleId].push_back(pCaloHit);
+
+        if (TPC_VIEW_W == pCaloHit->GetHitType())
+        {
+            caloHitListW.push_back(pCaloHit);
+            particleToPositionsMap[pSyntheticHit->m_particleId].push_back(pSyntheticHit->m_position3D);
+        }
+    }
+
+    const ClusterList *pClusterList(nullptr);
+    std::string clusterListName;
+    PANDORA_THROW_RESULT_IF(
+        STATUS_CODE_SUCCESS, !=, PandoraContentApi::CreateTemporaryListAndSetCurrent(*this, pClusterList, clusterListName));
+
+    for (const HitType hitType : {TPC_VIEW_U, TPC_VIEW_V, TPC_VIEW_W})
+    {
+        ClusterVector &clusterVector((TPC_VIEW_U == hitType) ? clusterVectorU : (TPC_VIEW_V == hitType) ? clusterVectorV : clusterVectorW);
+
+        for (const auto &mapEntry : particleHitsMap[hitType])
+        {
+            PandoraContentApi::Cluster::Parameters parameters;
+            parameters.m_caloHitList = mapEntry.second;
+
+            const Cluster *pCluster(nullptr);
+            PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::Cluster::Create(*this, parameters, pCluster));
+            clusterVector.push_back(pCluster);
+        }
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename FUNCTION>
+void BenchmarkAlgorithm::Time(const std::string &name, const FUNCTION &function) const
+{
+    FloatVector times;
+    double checksum(0.);
+
+    for (unsigned int iRepeat = 0; iRepeat < m_nRepeats; ++iRepeat)
+    {
+        const std::chrono::steady_clock::time_point startTime(std::chrono::steady_clock::now());
+        checksum = function();
+        times.push_back(std::chrono::duration<float, std::micro>(std::chrono::steady_clock::now() - startTime).count());
+    }
+
+    std::sort(times.begin(), times.end());
+    const float meanTime(std::accumulate(times.begin(), times.end(), 0.f) / static_cast<float>(times.size()));
+
+    std::cout << std::left << std::setw(48) << name << std::right << std::fixed << std::setprecision(1) << std::setw(14) << times.front()
+              << std::setw(14) << times.at(times.size() / 2) << std::setw(14) << meanTime << std::setprecision(6) << std::setw(20)
+              << checksum << std::defaultfloat << std::endl;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode BenchmarkAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
+{
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "NRepeats", m_nRepeats));
+
+    if (0 == m_nRepeats)
+    {
+        std::cout << "BenchmarkAlgorithm: NRepeats must be positive" << std::endl;
+        return STATUS_CODE_INVALID_PARAMETER;
+    }
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "SlidingFitWindow", m_slidingFitWindow));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "KDSearchRegion", m_kdSearchRegion));
+
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "BdtFileName", m_bdtFileName));
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "BdtName", m_bdtName));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "NBdtFeatures", m_nBdtFeatures));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "NBdtExamples", m_nBdtExamples));
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  Write a synthetic bdt, made of complete trees with random variables and thresholds, in the adaptive boost xml format
+ *
+ *  @param  fileName the name of the xml file
+ *  @param  bdtName the name of the bdt
+ *  @param  nTrees the number of trees
+ *  @param  treeDepth the depth of each tree
+ *  @param  nFeatures the number of features
+ *  @param  seed the random number seed
+ */
+void WriteSyntheticBdt(const std::string &fileName, const std::string &bdtName, const unsigned int nTrees, const unsigned int treeDepth,
+    const unsigned int nFeatures, const unsigned int seed)
+{
+    std::mt19937 randomEngine(seed);
+    std::uniform_real_distribution<double> thresholdDistribution(0., 1.), weightDistribution(0.1, 1.);
+    std::uniform_int_distribution<unsigned int> variableDistribution(0, nFeatures - 1);
+
+    std::ofstream fileStream(fileName, std::ios::out | std::ios::trunc);
+    fileStream << "<AdaBoostDecisionTree>\n    <Name>" << bdtName << "</Name>\n";
+
+    // ATTN Nodes are numbered in breadth first order from the root node, id 0, so the children of node n are nodes 2n + 1 and 2n + 2
+    const unsigned int nInternalNodes((1u << treeDepth) - 1), nNodes((1u << (treeDepth + 1)) - 1);
+
+    for (unsigned int iTree = 0; iTree < nTrees; ++iTree)
+    {
+        fileStream << "    <DecisionTree>\n        <TreeIndex>" << iTree << "</TreeIndex>\n        <TreeWeight>"
+                   << weightDistribution(randomEngine) << "</TreeWeight>\n";
+
+        for (unsigned int iNode = 0; iNode < nNodes; ++iNode)
+        {
+            const int parentNodeId((0 == iNode) ? -1 : static_cast<int>((iNode - 1) / 2));
+            fileStream << "        <Node>\n            <NodeId>" << iNode << "</NodeId>\n            <ParentNodeId>" << parentNodeId
+                       << "</ParentNodeId>\n";
+
+            if (iNode < nInternalNodes)
+            {
+                fileStream << "            <LeftChildNodeId>" << 2 * iNode + 1 << "</LeftChildNodeId>\n            <RightChildNodeId>"
+                           << 2 * iNode + 2 << "</RightChildNodeId>\n            <Threshold>" << thresholdDistribution(randomEngine)
+                           << "</Threshold>\n            <VariableId>" << variableDistribution(randomEngine) << "</VariableId>\n";
+            }
+            else
+            {
+                fileStream << "            <Outcome>" << ((iNode % 2) ? "true" : "false") << "</Outcome>\n";
+            }
+
+            fileStream << "        </Node>\n";
+        }
+
+        fileStream << "    </DecisionTree>\n";
+    }
+
+    fileStream << "</AdaBoostDecisionTree>\n";
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  Create a single lar tpc, with wire pitches and angles typical of a far detector readout
+ *
+ *  @param  pandora the pandora instance
+ */
+void CreateLArTPC(const Pandora &pandora)
+{
+    PandoraApi::Geometry::LArTPC::Parameters larTPCParameters;
+    larTPCParameters.m_larTPCVolumeId = 0;
+    larTPCParameters.m_centerX = 0.f;
+    larTPCParameters.m_centerY = 0.f;
+    larTPCParameters.m_centerZ = 0.f;
+    larTPCParameters.m_widthX = 360.f;
+    larTPCParameters.m_widthY = 1200.f;
+    larTPCParameters.m_widthZ = 1400.f;
+    larTPCParameters.m_wirePitchU = 0.4669f;
+    larTPCParameters.m_wirePitchV = 0.4669f;
+    larTPCParameters.m_wirePitchW = 0.4790f;
+    larTPCParameters.m_wireAngleU = 0.6283f;
+    larTPCParameters.m_wireAngleV = -0.6283f;
+    larTPCParameters.m_wireAngleW = 0.f;
+    larTPCParameters.m_sigmaUVW = 1.f;
+    larTPCParameters.m_isDriftInPositiveX = true;
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Geometry::LArTPC::Create(pandora, larTPCParameters));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  Create a two dimensional calo hit in each view for each synthetic hit
+ *
+ *  @param  pandora the pandora instance
+ *  @param  syntheticHitVector the synthetic hits, which must outlive the event as they are the calo hit parents
+ */
+void CreateCaloHits(const Pandora &pandora, const SyntheticHitVector &syntheticHitVector)
+{
+    for (const SyntheticHit &syntheticHit : syntheticHitVector)
+    {
+        const float wirePitch(LArGeometryHelper::GetWirePitch(pandora, syntheticHit.m_hitType));
+
+        PandoraApi::CaloHit::Parameters parameters;
+        parameters.m_positionVector = LArGeometryHelper::ProjectPosition(pandora, syntheticHit.m_position3D, syntheticHit.m_hitType);
+        parameters.m_expectedDirection = CartesianVector(0.f, 0.f, 1.f);
+        parameters.m_cellNormalVector = CartesianVector(0.f, 0.f, 1.f);
+        parameters.m_cellGeometry = RECTANGULAR;
+        parameters.m_cellSize0 = 0.5f;
+        parameters.m_cellSize1 = wirePitch;
+        parameters.m_cellThickness = wirePitch;
+        parameters.m_nCellRadiationLengths = 1.f;
+        parameters.m_nCellInteractionLengths = 1.f;
+        parameters.m_time = 0.f;
+        parameters.m_inputEnergy = 0.001f;
+        parameters.m_mipEquivalentEnergy = 1.f;
+        parameters.m_electromagneticEnergy = 0.001f;
+        parameters.m_hadronicEnergy = 0.001f;
+        parameters.m_isDigital = false;
+        parameters.m_hitType = syntheticHit.m_hitType;
+        parameters.m_hitRegion = SINGLE_REGION;
+        parameters.m_layer = 0;
+        parameters.m_isInOuterSamplingLayer = false;
+        parameters.m_pParentAddress = static_cast<const void *>(&syntheticHit);
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::CaloHit::Create(pandora, parameters));
+    }
+}
+
+} // namespace lar_content_benchmark
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    using namespace lar_content_benchmark;
+
+    if ((argc > 3) || ((argc > 1) && (std::string(argv[1]) == "-h")))
+    {
+        std::cout << "Usage: " << argv[0] << " [nRepeats = 20] [nParticlesPerType = 10]" << std::endl;
+        return 1;
+    }
+
+    const std::string settingsFileName("LArContentBenchmarkSettings.xml"), bdtFileName("LArContentBenchmarkBdt.xml");
+    Pandora *pPandora(nullptr);
+
+    try
+    {
+        const unsigned int nRepeats((argc > 1) ? std::stoul(argv[1]) : 20);
+        const unsigned int nParticlesPerType((argc > 2) ? std::stoul(argv[2]) : 10);
+
+        // ATTN Sizes typical of a busy neutrino interaction: each track and shower has several hundred hits per view
+        SyntheticEventGenerator syntheticEventGenerator(42);
+        SyntheticHitVector syntheticHitVector;
+        unsigned int particleId(0);
+
+        for (unsigned int iParticle = 0; iParticle < 2 * nParticlesPerType; ++iParticle, ++particleId)
+        {
+            CartesianPointVector positions;
+
+            if (iParticle < nParticlesPerType)
+                syntheticEventGenerator.GenerateTrack(400, positions);
+            else
+                syntheticEventGenerator.GenerateShower(800, positions);
+
+            for (const HitType hitType : {TPC_VIEW_U, TPC_VIEW_V, TPC_VIEW_W})
+            {
+                for (const CartesianVector &position : positions)
+                    syntheticHitVector.emplace_back(position, hitType, particleId);
+            }
+        }
+
+        WriteSyntheticBdt(bdtFileName, "Benchmark", 200, 4, 10, 7);
+
+        std::ofstream settingsFileStream(settingsFileName, std::ios::out | std::ios::trunc);
+        settingsFileStream << "<pandora>\n    <algorithm type = \"LArBenchmark\">\n        <NRepeats>" << nRepeats
+                           << "</NRepeats>\n        <BdtFileName>" << bdtFileName << "</BdtFileName>\n    </algorithm>\n</pandora>\n";
+        settingsFileStream.close();
+
+        pPandora = new Pandora();
+        PANDORA_THROW_RESULT_IF(
+            STATUS_CODE_SUCCESS, !=, PandoraApi::RegisterAlgorithmFactory(*pPandora, "LArBenchmark", new BenchmarkAlgorithm::Factory));
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::SetPseudoLayerPlugin(*pPandora, new LArPseudoLayerPlugin));
+        PANDORA_THROW_RESULT_IF(
+            STATUS_CODE_SUCCESS, !=, PandoraApi::SetLArTransformationPlugin(*pPandora, new LArRotationalTransformationPlugin));
+        CreateLArTPC(*pPandora);
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ReadSettings(*pPandora, settingsFileName));
+
+        std::cout << "LArContentBenchmark: " << 2 * nParticlesPerType << " particles, " << syntheticHitVector.size() << " calo hits, "
+                  << nRepeats << " repeats" << std::endl;
+
+        CreateCaloHits(*pPandora, syntheticHitVector);
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ProcessEvent(*pPandora));
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Reset(*pPandora));
+    }
+    catch (const StatusCodeException &statusCodeException)
+    {
+        std::cout << "LArContentBenchmark: Exception caught " << statusCodeException.ToString() << std::endl;
+        delete pPandora;
+        return 1;
+    }
+    catch (const std::logic_error &logicError)
+    {
+        std::cout << "LArContentBenchmark: Invalid argument " << logicError.what() << std::endl;
+        return 1;
+    }
+
+    delete pPandora;
+    std::remove(settingsFileName.c_str());
+    std::remove(bdtFileName.c_str());
+
+    return 0;
+}
@@ -0,0 +1,404 @@
+/**
+ *  @file   benchmarks/LArReplayBenchmark.cc
+ *
+ *  @brief  End-to-end throughput benchmark, replaying persisted events through a reference reconstruction configuration.
+ *
+ *  $Log: $
+ */
+
+#include "Api/PandoraApi.h"
+#include "Pandora/AlgorithmHeaders.h"
+
+#include "larpandoracontent/LArContent.h"
+#include "larpandoracontent/LArHelpers/LArPfoHelper.h"
+#include "larpandoracontent/LArPlugins/LArPseudoLayerPlugin.h"
+#include "larpandoracontent/LArPlugins/LArRotationalTransformationPlugin.h"
+
+#include <sys/resource.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace pandora;
+using namespace lar_content;
+
+namespace lar_content_benchmark
+{
+
+/**
+ *  @brief  ReplayParameters class, holding the command line options
+ */
+class ReplayParameters
+{
+public:
+    /**
+     *  @brief  Default constructor
+     */
+    ReplayParameters();
+
+    std::string m_settingsFileName; ///< The reference reconstruction settings, whose first algorithm reads the persisted events
+    std::string m_checksumFileName; ///< The optional output file for the per-event checksums
+    std::string m_profileFileName;  ///< The optional json lines file written by a profiling algorithm in the settings
+    int m_nEvents;                  ///< The maximum number of events to replay, or all events if negative
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  EventChecksum class, summarising the output particle flow hierarchy of an event
+ */
+class EventChecksum
+{
+public:
+    /**
+     *  @brief  Default constructor
+     */
+    EventChecksum();
+
+    unsigned int m_nPfos;     ///< The number of output pfos, including all daughters
+    unsigned int m_nCaloHits; ///< The number of calo hits in the output pfos
+    uint64_t m_hash;          ///< The order-independent hash of the output pfo hierarchy
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+ReplayParameters::ReplayParameters() : m_nEvents(-1)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+EventChecksum::EventChecksum() : m_nPfos(0), m_nCaloHits(0), m_hash(0)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  Combine a value into a hash, using the 64-bit FNV-1a scheme
+ *
+ *  @param  value the value
+ *  @param  hash the hash to update
+ */
+void CombineHash(const uint64_t value, uint64_t &hash)
+{
+    for (unsigned int iByte = 0; iByte < sizeof(uint64_t); ++iByte)
+    {
+        hash ^= (value >> (8 * iByte)) & 0xff;
+        hash *= 1099511628211ull;
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  Get the hash of a pfo and its downstream hierarchy, independent of the order of the daughter lists
+ *
+ *  @param  pPfo the address of the pfo
+ *
+ *  @return the hash
+ */
+uint64_t GetPfoHash(const ParticleFlowObject *const pPfo)
+{
+    uint64_t hash(14695981039346656037ull);
+    CombineHash(static_cast<uint64_t>(static_cast<int64_t>(pPfo->GetParticleId())), hash);
+
+    for (const HitType hitType : {TPC_VIEW_U, TPC_VIEW_V, TPC_VIEW_W, TPC_3D})
+    {
+        CaloHitList caloHitList;
+        LArPfoHelper::GetCaloHits(pPfo, hitType, caloHitList);
+        LArPfoHelper::GetIsolatedCaloHits(pPfo, hitType, caloHitList);
+        CombineHash(caloHitList.size(), hash);
+    }
+
+    // ATTN Vertex positions are rounded to 10 microns, so that the hash describes the physics output rather than floating point noise
+    for (const Vertex *const pVertex : pPfo->GetVertexList())
+    {
+        const CartesianVector &position(pVertex->GetPosition());
+
+        for (const float coordinate : {position.GetX(), position.GetY(), position.GetZ()})
+            CombineHash(static_cast<uint64_t>(static_cast<int64_t>(std::round(coordinate * 1000.f))), hash);
+    }
+
+    std::vector<uint64_t> daughterHashes;
+
+    for (const ParticleFlowObject *const pDaughterPfo : pPfo->GetDaughterPfoList())
+        daughterHashes.push_back(GetPfoHash(pDaughterPfo));
+
+    std::sort(daughterHashes.begin(), daughterHashes.end());
+
+    for (const uint64_t daughterHash : daughterHashes)
+        CombineHash(daughterHash, hash);
+
+    return hash;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  Get the checksum of the output pfo hierarchy of the current event
+ *
+ *  @param  pandora the pandora instance
+ *  @param  eventChecksum to receive the checksum
+ */
+void GetEventChecksum(const Pandora &pandora, EventChecksum &eventChecksum)
+{
+    const PfoList *pPfoList(nullptr);
+
+    if ((STATUS_CODE_SUCCESS != PandoraApi::GetCurrentPfoList(pandora, pPfoList)) || !pPfoList)
+        return;
+
+    PfoList allPfos;
+    LArPfoHelper::GetAllConnectedPfos(*pPfoList, allPfos);
+
+    std::vector<uint64_t> primaryHashes;
+
+    for (const ParticleFlowObject *const pPfo : allPfos)
+    {
+        ++eventChecksum.m_nPfos;
+
+        for (const Cluster *const pCluster : pPfo->GetClusterList())
+            eventChecksum.m_nCaloHits += pCluster->GetNCaloHits() + pCluster->GetNIsolatedCaloHits();
+
+        if (pPfo->GetParentPfoList().empty())
+            primaryHashes.push_back(GetPfoHash(pPfo));
+    }
+
+    std::sort(primaryHashes.begin(), primaryHashes.end());
+    eventChecksum.m_hash = 14695981039346656037ull;
+
+    for (const uint64_t primaryHash : primaryHashes)
+        CombineHash(primaryHash, eventChecksum.m_hash);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  Read the value of a field from a line of a flat json object
+ *
+ *  @param  line the json line
+ *  @param  key the field name
+ *  @param  value to receive the value
+ *
+ *  @return whether the field was found
+ */
+bool ReadJsonField(const std::string &line, const std::string &key, std::string &value)
+{
+    const std::string pattern("\"" + key + "\":");
+    const size_t start(line.find(pattern));
+
+    if (std::string::npos == start)
+        return false;
+
+    const size_t valueStart(start + pattern.size());
+    const size_t valueEnd(line.find_first_of(",}", valueStart));
+    value = line.substr(valueStart, valueEnd - valueStart);
+    value.erase(std::remove(value.begin(), value.end(), '"'), value.end());
+
+    return true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  Print the per-stage job summary written by a profiling algorithm
+ *
+ *  @param  profileFileName the name of the json lines file
+ */
+void PrintStageTimes(const std::string &profileFileName)
+{
+    std::ifstream profileFileStream(profileFileName);
+
+    if (!profileFileStream.is_open())
+    {
+        std::cout << "LArReplayBenchmark: Unable to open profile file " << profileFileName << std::endl;
+        return;
+    }
+
+    std::cout << std::left << std::setw(48) << "Stage" << std::right << std::setw(10) << "Calls" << std::setw(16) << "Wall time (s)"
+              << std::setw(16) << "Cpu time (s)" << std::endl;
+
+    std::string line;
+
+    while (std::getline(profileFileStream, line))
+    {
+        std::string scope, algorithm, nCalls, wallTime, cpuTime;
+
+        if (!ReadJsonField(line, "scope", scope) || (scope != "job") || !ReadJsonField(line, "algorithm", algorithm) ||
+            !ReadJsonField(line, "calls", nCalls) || !ReadJsonField(line, "wallTime", wallTime) || !ReadJsonField(line, "cpuTime", cpuTime))
+            continue;
+
+        std::cout << std::left << std::setw(48) << algorithm << std::right << std::setw(10) << nCalls << std::setw(16) << wallTime
+                  << std::setw(16) << cpuTime << std::endl;
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  Parse the command line
+ *
+ *  @param  argc the number of arguments
+ *  @param  argv the arguments
+ *  @param  parameters to receive the parameters
+ *
+ *  @return whether the command line is valid
+ */
+bool ParseCommandLine(int argc, char *argv[], ReplayParameters &parameters)
+{
+    int option(0);
+
+    while ((option = getopt(argc, argv, "i:n:c:p:h")) != -1)
+    {
+        switch (option)
+        {
+            case 'i':
+                parameters.m_settingsFileName = optarg;
+                break;
+            case 'n':
+                parameters.m_nEvents = std::stoi(optarg);
+                break;
+            case 'c':
+                parameters.m_checksumFileName = optarg;
+                break;
+            case 'p':
+                parameters.m_profileFileName = optarg;
+                break;
+            case 'h':
+            default:
+                return false;
+        }
+    }
+
+    return !parameters.m_settingsFileName.empty();
+}
+
+} // namespace lar_content_benchmark
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    using namespace lar_content_benchmark;
+
+    ReplayParameters parameters;
+
+    try
+    {
+        if (!ParseCommandLine(argc, argv, parameters))
+        {
+            std::cout << "Usage: " << argv[0] << " -i settings.xml [-n nEvents] [-c checksumFile] [-p profileFile]" << std::endl
+                      << "    -i the reference reconstruction settings, starting with an event reading algorithm" << std::endl
+                      << "    -n the maximum number of events to replay, default all events" << std::endl
+                      << "    -c the output file for the per-event pfo and hit counts and hierarchy hashes" << std::endl
+                      << "    -p the json lines file written by a profiling algorithm in the settings, to print stage times" << std::endl;
+            return 1;
+        }
+    }
+    catch (const std::logic_error &logicError)
+    {
+        std::cout << "LArReplayBenchmark: Invalid argument " << logicError.what() << std::endl;
+        return 1;
+    }
+
+    std::ofstream checksumFileStream;
+
+    if (!parameters.m_checksumFileName.empty())
+    {
+        checksumFileStream.open(parameters.m_checksumFileName, std::ios::out | std::ios::trunc);
+
+        if (!checksumFileStream.is_open())
+        {
+            std::cout << "LArReplayBenchmark: Unable to open checksum file " << parameters.m_checksumFileName << std::endl;
+            return 1;
+        }
+    }
+
+    const Pandora *pPandora(nullptr);
+    std::vector<double> eventTimes;
+    uint64_t jobHash(14695981039346656037ull);
+
+    try
+    {
+        pPandora = new Pandora();
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, LArContent::RegisterAlgorithms(*pPandora));
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, LArContent::RegisterBasicPlugins(*pPandora));
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::SetPseudoLayerPlugin(*pPandora, new LArPseudoLayerPlugin));
+        PANDORA_THROW_RESULT_IF(
+            STATUS_CODE_SUCCESS, !=, PandoraApi::SetLArTransformationPlugin(*pPandora, new LArRotationalTransformationPlugin));
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ReadSettings(*pPandora, parameters.m_settingsFileName));
+
+        while ((parameters.m_nEvents < 0) || (static_cast<int>(eventTimes.size()) < parameters.m_nEvents))
+        {
+            const std::chrono::steady_clock::time_point startTime(std::chrono::steady_clock::now());
+
+            try
+            {
+                PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ProcessEvent(*pPandora));
+            }
+            catch (const StopProcessingException &)
+            {
+                PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Reset(*pPandora));
+                break;
+            }
+
+            eventTimes.push_back(std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count());
+
+            EventChecksum eventChecksum;
+            GetEventChecksum(*pPandora, eventChecksum);
+            CombineHash(eventChecksum.m_hash, jobHash);
+
+            if (checksumFileStream.is_open())
+            {
+                checksumFileStream << (eventTimes.size() - 1) << " " << eventChecksum.m_nPfos << " " << eventChecksum.m_nCaloHits << " "
+                                   << std::hex << eventChecksum.m_hash << std::dec << "\n";
+            }
+
+            PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Reset(*pPandora));
+        }
+    }
+    catch (const StatusCodeException &statusCodeException)
+    {
+        std::cout << "LArReplayBenchmark: Exception caught " << statusCodeException.ToString() << std::endl;
+        delete pPandora;
+        return 1;
+    }
+
+    // ATTN Deleting the instance lets any profiling algorithm write its job summary, before it is printed
+    delete pPandora;
+
+    struct rusage resourceUsage;
+    const long peakRssKB((0 == getrusage(RUSAGE_SELF, &resourceUsage)) ? resourceUsage.ru_maxrss : 0);
+
+    double totalTime(0.);
+
+    for (const double eventTime : eventTimes)
+        totalTime += eventTime;
+
+    // ATTN The first event also pays for lazy initialisation, e.g. of mva models and geometry caches, so is reported separately
+    const double firstEventTime(eventTimes.empty() ? 0. : eventTimes.front());
+    const unsigned int nEvents(eventTimes.size());
+
+    std::cout << "LArReplayBenchmark: " << nEvents << " events in " << totalTime << " s" << std::endl
+              << "    events/s                 " << ((totalTime > 0.) ? nEvents / totalTime : 0.) << std::endl
+              << "    events/s, after first    "
+              << (((nEvents > 1) && (totalTime > firstEventTime)) ? (nEvents - 1) / (totalTime - firstEventTime) : 0.) << std::endl
+              << "    first event time (s)     " << firstEventTime << std::endl
+              << "    peak rss (MB)            " << peakRssKB / 1024.f << std::endl
+              << "    output checksum          " << std::hex << jobHash << std::dec << std::endl;
+
+    if (!parameters.m_profileFileName.empty())
+        PrintStageTimes(parameters.m_profileFileName);
+
+    return 0;
+}
@@ -10,6 +10,7 @@
 
 #include "larpandoracontent/LArCheating/CheatingBeamParticleIdTool.h"
 
+#include "larpandoracontent/LArHelpers/LArCheatingIndexHelper.h"
 #include "larpandoracontent/LArHelpers/LArMCParticleHelper.h"
 #include "larpandoracontent/LArHelpers/LArPfoHelper.h"
 
@@ -30,6 +31,8 @@ void CheatingBeamParticleIdTool::SelectOutputPfos(const pandora::Algorithm *cons
     if (testBeamSliceHypotheses.size() != crSliceHypotheses.size())
         throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
 
+    CheatingIndex &cheatingIndex(LArCheatingIndexHelper::GetCheatingIndex(this->GetPandora()));
+
     for (unsigned int sliceIndex = 0, nSlices = testBeamSliceHypotheses.size(); sliceIndex < nSlices; ++sliceIndex)
     {
         float beamParticleWeight(0.f), totalWeight(0.f);
@@ -44,7 +47,8 @@ void CheatingBeamParticleIdTool::SelectOutputPfos(const pandora::Algorithm *cons
             LArPfoHelper::GetAllDownstreamPfos(pTestBeamPfo, downstreamPfos);
 
             float thisBeamParticleWeight(0.f), thisTotalWeight(0.f);
-            CheatingSliceIdBaseTool::GetTargetParticleWeight(&downstreamPfos, thisBeamParticleWeight, thisTotalWeight, LArMCParticleHelper::IsBeamParticle);
+            CheatingSliceIdBaseTool::GetTargetParticleWeight(
+                &downstreamPfos, thisBeamParticleWeight, thisTotalWeight, LArMCParticleHelper::IsBeamParticle, cheatingIndex);
 
             beamParticleWeight += thisBeamParticleWeight;
             totalWeight += thisTotalWeight;
@@ -10,6 +10,8 @@
 
 #include "larpandoracontent/LArCheating/CheatingClusterCreationAlgorithm.h"
 
+#include "larpandoracontent/LArHelpers/LArCheatingIndexHelper.h"
+
 using namespace pandora;
 
 namespace lar_content
@@ -47,6 +49,8 @@ void CheatingClusterCreationAlgorithm::GetMCParticleToHitListMap(MCParticleToHit
     const CaloHitList *pCaloHitList(nullptr);
     PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::GetCurrentList(*this, pCaloHitList));
 
+    CheatingIndex &cheatingIndex(LArCheatingIndexHelper::GetCheatingIndex(this->GetPandora()));
+
     for (const CaloHit *const pCaloHit : *pCaloHitList)
     {
         try
@@ -54,7 +58,7 @@ void CheatingClusterCreationAlgorithm::GetMCParticleToHitListMap(MCParticleToHit
             if (!PandoraContentApi::IsAvailable(*this, pCaloHit))
                 continue;
 
-            this->SimpleMCParticleCollection(pCaloHit, mcPrimaryMap, mcParticleToHitListMap);
+            this->SimpleMCParticleCollection(pCaloHit, mcPrimaryMap, cheatingIndex, mcParticleToHitListMap);
         }
         catch (const StatusCodeException &)
         {
@@ -65,9 +69,10 @@ void CheatingClusterCreationAlgorithm::GetMCParticleToHitListMap(MCParticleToHit
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void CheatingClusterCreationAlgorithm::SimpleMCParticleCollection(const CaloHit *const pCaloHit,
-    const LArMCParticleHelper::MCRelationMap &mcPrimaryMap, MCParticleToHitListMap &mcParticleToHitListMap) const
+    const LArMCParticleHelper::MCRelationMap &mcPrimaryMap, CheatingIndex &cheatingIndex,
+    MCParticleToHitListMap &mcParticleToHitListMap) const
 {
-    const MCParticle *pMCParticle(MCParticleHelper::GetMainMCParticle(pCaloHit));
+    const MCParticle *pMCParticle(cheatingIndex.GetMainMCParticle(pCaloHit));
 
     if (!this->SelectMCParticlesForClustering(pMCParticle))
         return;
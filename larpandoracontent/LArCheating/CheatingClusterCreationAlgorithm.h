@@ -12,6 +12,8 @@
 
 #include "larpandoracontent/LArHelpers/LArMCParticleHelper.h"
 
+#include "larpandoracontent/LArObjects/LArCheatingIndex.h"
+
 #include <unordered_map>
 
 namespace lar_content
@@ -46,10 +48,11 @@ private:
      *
      *  @param  pCaloHit address of the calo hit
      *  @param  mcPrimaryMap the mapping between mc particles and their parents
+     *  @param  cheatingIndex the cheating index for the event
      *  @param  mcParticleToHitListMap the mc particle to hit list map
      */
     void SimpleMCParticleCollection(const pandora::CaloHit *const pCaloHit, const LArMCParticleHelper::MCRelationMap &mcPrimaryMap,
-        MCParticleToHitListMap &mcParticleToHitListMap) const;
+        CheatingIndex &cheatingIndex, MCParticleToHitListMap &mcParticleToHitListMap) const;
 
     /**
      *  @brief  Check whether mc particle is of a type specified for inclusion in cheated clustering
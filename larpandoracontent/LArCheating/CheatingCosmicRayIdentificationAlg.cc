@@ -8,6 +8,7 @@
 
 #include "Pandora/AlgorithmHeaders.h"
 
+#include "larpandoracontent/LArHelpers/LArCheatingIndexHelper.h"
 #include "larpandoracontent/LArHelpers/LArMCParticleHelper.h"
 #include "larpandoracontent/LArHelpers/LArPfoHelper.h"
 
@@ -40,6 +41,7 @@ StatusCode CheatingCosmicRayIdentificationAlg::Run()
     }
 
     PfoList outputPfoList, outputDaughterPfoList;
+    CheatingIndex &cheatingIndex(LArCheatingIndexHelper::GetCheatingIndex(this->GetPandora()));
 
     for (const ParticleFlowObject *const pPfo : *pPfoList)
     {
@@ -50,7 +52,8 @@ StatusCode CheatingCosmicRayIdentificationAlg::Run()
         LArPfoHelper::GetAllDownstreamPfos(pPfo, downstreamPfos);
 
         float thisNeutrinoWeight(0.f), thisTotalWeight(0.f);
-        CheatingSliceIdBaseTool::GetTargetParticleWeight(&downstreamPfos, thisNeutrinoWeight, thisTotalWeight, LArMCParticleHelper::IsNeutrino);
+        CheatingSliceIdBaseTool::GetTargetParticleWeight(
+            &downstreamPfos, thisNeutrinoWeight, thisTotalWeight, LArMCParticleHelper::IsNeutrino, cheatingIndex);
 
         if ((thisTotalWeight < std::numeric_limits<float>::epsilon()) || ((thisNeutrinoWeight / thisTotalWeight) < m_maxNeutrinoFraction))
             outputPfoList.push_back(pPfo);
@@ -6,9 +6,9 @@
  *  $Log: $
  */
 
-#include "Helpers/MCParticleHelper.h"
 #include "Pandora/AlgorithmHeaders.h"
 
+#include "larpandoracontent/LArHelpers/LArCheatingIndexHelper.h"
 #include "larpandoracontent/LArHelpers/LArMCParticleHelper.h"
 
 #include "larpandoracontent/LArCheating/CheatingCosmicRayRemovalAlgorithm.h"
@@ -27,13 +27,14 @@ StatusCode CheatingCosmicRayRemovalAlgorithm::Run()
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::GetList(*this, m_inputCaloHitListName, pCaloHitList));
 
     CaloHitList outputCaloHitList;
+    CheatingIndex &cheatingIndex(LArCheatingIndexHelper::GetCheatingIndex(this->GetPandora()));
 
     for (const CaloHit *pCaloHit : *pCaloHitList)
     {
         try
         {
-            const MCParticle *const pMCParticle(MCParticleHelper::GetMainMCParticle(pCaloHit));
-            if (!LArMCParticleHelper::IsCosmicRay(LArMCParticleHelper::GetParentMCParticle(pMCParticle)))
+            const MCParticle *const pMCParticle(cheatingIndex.GetMainMCParticle(pCaloHit));
+            if (!LArMCParticleHelper::IsCosmicRay(cheatingIndex.GetParentMCParticle(pMCParticle)))
                 outputCaloHitList.push_back(pCaloHit);
         }
         catch (const StatusCodeException &)
@@ -8,6 +8,7 @@
 
 #include "Pandora/AlgorithmHeaders.h"
 
+#include "larpandoracontent/LArHelpers/LArCheatingIndexHelper.h"
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 #include "larpandoracontent/LArHelpers/LArMCParticleHelper.h"
 #include "larpandoracontent/LArHelpers/LArPfoHelper.h"
@@ -62,11 +63,13 @@ void CheatingCosmicRayShowerMatchingAlg::GetCandidateClusters(ClusterList &candi
 void CheatingCosmicRayShowerMatchingAlg::CosmicRayShowerMatching(
     const ParticleFlowObject *const pPfo, const Cluster *const pPfoCluster, const ClusterList &candidateClusterList) const
 {
+    CheatingIndex &cheatingIndex(LArCheatingIndexHelper::GetCheatingIndex(this->GetPandora()));
+
     try
     {
         const HitType pfoClusterHitType(LArClusterHelper::GetClusterHitType(pPfoCluster));
         const MCParticle *const pPfoMCParticle(MCParticleHelper::GetMainMCParticle(pPfoCluster));
-        const MCParticle *const pPfoParentMCParticle(LArMCParticleHelper::GetParentMCParticle(pPfoMCParticle));
+        const MCParticle *const pPfoParentMCParticle(cheatingIndex.GetParentMCParticle(pPfoMCParticle));
 
         for (const Cluster *const pCandidateCluster : candidateClusterList)
         {
@@ -82,7 +85,7 @@ void CheatingCosmicRayShowerMatchingAlg::CosmicRayShowerMatching(
             try
             {
                 const MCParticle *const pMCParticle(MCParticleHelper::GetMainMCParticle(pCandidateCluster));
-                const MCParticle *const pParentMCParticle(LArMCParticleHelper::GetParentMCParticle(pMCParticle));
+                const MCParticle *const pParentMCParticle(cheatingIndex.GetParentMCParticle(pMCParticle));
 
                 if (!LArMCParticleHelper::IsNeutrino(pParentMCParticle) && (pPfoParentMCParticle == pParentMCParticle))
                     PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::AddToPfo(*this, pPfo, pCandidateCluster));
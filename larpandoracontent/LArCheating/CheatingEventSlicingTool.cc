@@ -10,6 +10,7 @@
 
 #include "larpandoracontent/LArCheating/CheatingEventSlicingTool.h"
 
+#include "larpandoracontent/LArHelpers/LArCheatingIndexHelper.h"
 #include "larpandoracontent/LArHelpers/LArMCParticleHelper.h"
 
 using namespace pandora;
@@ -55,6 +56,8 @@ void CheatingEventSlicingTool::RunSlicing(const Algorithm *const pAlgorithm, con
 void CheatingEventSlicingTool::InitializeMCParticleToSliceMap(
     const Algorithm *const pAlgorithm, const HitTypeToNameMap &caloHitListNames, MCParticleToSliceMap &mcParticleToSliceMap) const
 {
+    CheatingIndex &cheatingIndex(LArCheatingIndexHelper::GetCheatingIndex(this->GetPandora()));
+
     for (const auto &mapEntry : caloHitListNames)
     {
         const CaloHitList *pCaloHitList(nullptr);
@@ -62,14 +65,9 @@ void CheatingEventSlicingTool::InitializeMCParticleToSliceMap(
 
         for (const CaloHit *const pCaloHit : *pCaloHitList)
         {
-            MCParticleVector mcParticleVector;
-            for (const auto &weightMapEntry : pCaloHit->GetMCParticleWeightMap())
-                mcParticleVector.push_back(weightMapEntry.first);
-            std::sort(mcParticleVector.begin(), mcParticleVector.end(), LArMCParticleHelper::SortByMomentum);
-
-            for (const MCParticle *const pMCParticle : mcParticleVector)
+            for (const MCParticle *const pMCParticle : cheatingIndex.GetMCParticlesByMomentum(pCaloHit))
             {
-                const MCParticle *const pParentMCParticle(LArMCParticleHelper::GetParentMCParticle(pMCParticle));
+                const MCParticle *const pParentMCParticle(cheatingIndex.GetParentMCParticle(pMCParticle));
 
                 if (mcParticleToSliceMap.count(pParentMCParticle))
                     continue;
@@ -92,12 +90,14 @@ void CheatingEventSlicingTool::FillSlices(const Algorithm *const pAlgorithm, con
     const CaloHitList *pCaloHitList(nullptr);
     PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::GetList(*pAlgorithm, caloHitListNames.at(hitType), pCaloHitList));
 
+    CheatingIndex &cheatingIndex(LArCheatingIndexHelper::GetCheatingIndex(this->GetPandora()));
+
     for (const CaloHit *const pCaloHit : *pCaloHitList)
     {
         try
         {
-            const MCParticle *const pMainMCParticle(MCParticleHelper::GetMainMCParticle(pCaloHit));
-            const MCParticle *const pParentMCParticle(LArMCParticleHelper::GetParentMCParticle(pMainMCParticle));
+            const MCParticle *const pMainMCParticle(cheatingIndex.GetMainMCParticle(pCaloHit));
+            const MCParticle *const pParentMCParticle(cheatingIndex.GetParentMCParticle(pMainMCParticle));
 
             MCParticleToSliceMap::iterator mapIter = mcParticleToSliceMap.find(pParentMCParticle);
 
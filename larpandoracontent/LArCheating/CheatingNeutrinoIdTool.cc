@@ -10,6 +10,7 @@
 
 #include "larpandoracontent/LArCheating/CheatingNeutrinoIdTool.h"
 
+#include "larpandoracontent/LArHelpers/LArCheatingIndexHelper.h"
 #include "larpandoracontent/LArHelpers/LArMCParticleHelper.h"
 #include "larpandoracontent/LArHelpers/LArPfoHelper.h"
 
@@ -26,6 +27,7 @@ void CheatingNeutrinoIdTool::SelectOutputPfos(const pandora::Algorithm *const /*
 
     float bestNeutrinoWeight(0.f);
     unsigned int bestSliceIndex(std::numeric_limits<unsigned int>::max());
+    CheatingIndex &cheatingIndex(LArCheatingIndexHelper::GetCheatingIndex(this->GetPandora()));
 
     for (unsigned int sliceIndex = 0, nSlices = nuSliceHypotheses.size(); sliceIndex < nSlices; ++sliceIndex)
     {
@@ -41,7 +43,8 @@ void CheatingNeutrinoIdTool::SelectOutputPfos(const pandora::Algorithm *const /*
             LArPfoHelper::GetAllDownstreamPfos(pNeutrinoPfo, downstreamPfos);
 
             float thisNeutrinoWeight(0.f), thisTotalWeight(0.f);
-            CheatingSliceIdBaseTool::GetTargetParticleWeight(&downstreamPfos, thisNeutrinoWeight, thisTotalWeight, LArMCParticleHelper::IsNeutrino);
+            CheatingSliceIdBaseTool::GetTargetParticleWeight(
+                &downstreamPfos, thisNeutrinoWeight, thisTotalWeight, LArMCParticleHelper::IsNeutrino, cheatingIndex);
             neutrinoWeight += thisNeutrinoWeight;
         }
 
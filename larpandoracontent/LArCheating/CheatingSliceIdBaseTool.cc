@@ -11,7 +11,6 @@
 #include "larpandoracontent/LArCheating/CheatingSliceIdBaseTool.h"
 
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
-#include "larpandoracontent/LArHelpers/LArMCParticleHelper.h"
 #include "larpandoracontent/LArHelpers/LArPfoHelper.h"
 
 using namespace pandora;
@@ -19,8 +18,8 @@ using namespace pandora;
 namespace lar_content
 {
 
-void CheatingSliceIdBaseTool::GetTargetParticleWeight(
-    const PfoList *const pPfoList, float &targetParticleWeight, float &totalWeight, std::function<bool(const MCParticle *const)> fCriteria)
+void CheatingSliceIdBaseTool::GetTargetParticleWeight(const PfoList *const pPfoList, float &targetParticleWeight, float &totalWeight,
+    std::function<bool(const MCParticle *const)> fCriteria, CheatingIndex &cheatingIndex)
 {
     targetParticleWeight = 0.f;
     totalWeight = 0.f;
@@ -45,7 +44,7 @@ void CheatingSliceIdBaseTool::GetTargetParticleWeight(
         for (const CaloHit *const pCaloHit : caloHitList)
         {
             float thisTargetParticleWeight = 0.f, thisTotalWeight = 0.f;
-            CheatingSliceIdBaseTool::GetTargetParticleWeight(pCaloHit, thisTargetParticleWeight, thisTotalWeight, fCriteria);
+            CheatingSliceIdBaseTool::GetTargetParticleWeight(pCaloHit, thisTargetParticleWeight, thisTotalWeight, fCriteria, cheatingIndex);
 
             targetParticleWeight += thisTargetParticleWeight;
             totalWeight += thisTotalWeight;
@@ -55,8 +54,8 @@ void CheatingSliceIdBaseTool::GetTargetParticleWeight(
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void CheatingSliceIdBaseTool::GetTargetParticleWeight(
-    const CaloHit *const pCaloHit, float &targetParticleWeight, float &totalWeight, std::function<bool(const MCParticle *const)> fCriteria)
+void CheatingSliceIdBaseTool::GetTargetParticleWeight(const CaloHit *const pCaloHit, float &targetParticleWeight, float &totalWeight,
+    std::function<bool(const MCParticle *const)> fCriteria, CheatingIndex &cheatingIndex)
 {
     targetParticleWeight = 0.f;
     totalWeight = 0.f;
@@ -65,15 +64,10 @@ void CheatingSliceIdBaseTool::GetTargetParticleWeight(
     if (hitMCParticleWeightMap.empty())
         return;
 
-    MCParticleList mcParticleList;
-    for (const auto &mapEntry : hitMCParticleWeightMap)
-        mcParticleList.push_back(mapEntry.first);
-    mcParticleList.sort(LArMCParticleHelper::SortByMomentum);
-
-    for (const MCParticle *const pMCParticle : mcParticleList)
+    for (const MCParticle *const pMCParticle : cheatingIndex.GetMCParticlesByMomentum(pCaloHit))
     {
         const float weight(hitMCParticleWeightMap.at(pMCParticle));
-        const MCParticle *const pParentMCParticle(LArMCParticleHelper::GetParentMCParticle(pMCParticle));
+        const MCParticle *const pParentMCParticle(cheatingIndex.GetParentMCParticle(pMCParticle));
 
         if (fCriteria(pParentMCParticle))
             targetParticleWeight += weight;
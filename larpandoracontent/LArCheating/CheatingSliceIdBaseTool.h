@@ -10,6 +10,8 @@
 
 #include "larpandoracontent/LArControlFlow/MasterAlgorithm.h"
 
+#include "larpandoracontent/LArObjects/LArCheatingIndex.h"
+
 #include <functional>
 
 namespace lar_content
@@ -31,9 +33,10 @@ public:
      *  @param  targetParticleWeight the target particle weight
      *  @param  totalWeight the total weight
      *  @param  fCriteria a function which returns a bool (= shouldSelect) for a given input MCParticle
+     *  @param  cheatingIndex the cheating index for the event
      */
     static void GetTargetParticleWeight(const pandora::PfoList *const pPfoList, float &targetParticleWeight, float &totalWeight,
-        std::function<bool(const pandora::MCParticle *const)> fCriteria);
+        std::function<bool(const pandora::MCParticle *const)> fCriteria, CheatingIndex &cheatingIndex);
 
     /**
      *  @brief  Get the target particle weight for a calo hit
@@ -42,9 +45,10 @@ public:
      *  @param  targetParticleWeight the target particle weight
      *  @param  totalWeight the total weight
      *  @param  fCriteria a function which returns a bool (= shouldSelect) for a given input MCParticle
+     *  @param  cheatingIndex the cheating index for the event
      */
     static void GetTargetParticleWeight(const pandora::CaloHit *const pCaloHit, float &targetParticleWeight, float &totalWeight,
-        std::function<bool(const pandora::MCParticle *const)> fCriteria);
+        std::function<bool(const pandora::MCParticle *const)> fCriteria, CheatingIndex &cheatingIndex);
 
 private:
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
@@ -10,7 +10,7 @@
 
 #include "larpandoracontent/LArCheating/CheatingSliceSelectionTool.h"
 
-#include "larpandoracontent/LArHelpers/LArMCParticleHelper.h"
+#include "larpandoracontent/LArHelpers/LArCheatingIndexHelper.h"
 
 using namespace pandora;
 
@@ -31,6 +31,7 @@ void CheatingSliceSelectionTool::SelectSlices(const pandora::Algorithm *const /*
 
     FloatVector targetWeights(inputSliceVector.size());
     FloatVector otherWeights(inputSliceVector.size());
+    CheatingIndex &cheatingIndex(LArCheatingIndexHelper::GetCheatingIndex(this->GetPandora()));
 
     // Calculate target and total weight for each slice
     for (const CaloHitList &sliceHits : inputSliceVector)
@@ -48,15 +49,10 @@ void CheatingSliceSelectionTool::SelectSlices(const pandora::Algorithm *const /*
             if (hitMCParticleWeightMap.empty())
                 continue;
 
-            MCParticleList mcParticleList;
-            for (const auto &mapEntry : hitMCParticleWeightMap)
-                mcParticleList.push_back(mapEntry.first);
-            mcParticleList.sort(LArMCParticleHelper::SortByMomentum);
-
-            for (const MCParticle *const pMCParticle : mcParticleList)
+            for (const MCParticle *const pMCParticle : cheatingIndex.GetMCParticlesByMomentum(pCaloHit))
             {
                 const float weight{hitMCParticleWeightMap.at(pMCParticle)};
-                const MCParticle *const pParentMCParticle{LArMCParticleHelper::GetParentMCParticle(pMCParticle)};
+                const MCParticle *const pParentMCParticle{cheatingIndex.GetParentMCParticle(pMCParticle)};
 
                 if (this->IsTarget(pParentMCParticle))
                     thisTargetParticleWeight += weight;
@@ -32,11 +32,14 @@
 
 #include "larpandoracontent/LArControlFlow/BdtBeamParticleIdTool.h"
 #include "larpandoracontent/LArControlFlow/BeamParticleIdTool.h"
+#include "larpandoracontent/LArControlFlow/ContinuousReadoutSliceSelectionTool.h"
+#include "larpandoracontent/LArControlFlow/CosmicRaySlicePreClassificationTool.h"
 #include "larpandoracontent/LArControlFlow/CosmicRayTaggingTool.h"
 #include "larpandoracontent/LArControlFlow/MasterAlgorithm.h"
 #include "larpandoracontent/LArControlFlow/NeutrinoIdTool.h"
 #include "larpandoracontent/LArControlFlow/PostProcessingAlgorithm.h"
 #include "larpandoracontent/LArControlFlow/PreProcessingAlgorithm.h"
+#include "larpandoracontent/LArControlFlow/ProfilingAlgorithm.h"
 #include "larpandoracontent/LArControlFlow/SimpleNeutrinoIdTool.h"
 #include "larpandoracontent/LArControlFlow/SlicingAlgorithm.h"
 #include "larpandoracontent/LArControlFlow/StitchingCosmicRayMergingTool.h"
@@ -198,6 +201,8 @@
 
 #include "larpandoracontent/LArTwoDReco/TwoDParticleCreationAlgorithm.h"
 
+#include "larpandoracontent/LArUtility/CoarseHitRedistributionAlgorithm.h"
+#include "larpandoracontent/LArUtility/HitCoarseningAlgorithm.h"
 #include "larpandoracontent/LArUtility/ListChangingAlgorithm.h"
 #include "larpandoracontent/LArUtility/ListDeletionAlgorithm.h"
 #include "larpandoracontent/LArUtility/ListMergingAlgorithm.h"
@@ -212,6 +217,10 @@
 
 #include "larpandoracontent/LArContent.h"
 
+#include <string>
+#include <utility>
+#include <vector>
+
 // clang-format off
 #define LAR_ALGORITHM_LIST(d)                                                                                                   \
     d("LArMuonLeadingEventValidation",          MuonLeadingEventValidationAlgorithm)                                            \
@@ -242,6 +251,7 @@
     d("LArMaster",                              MasterAlgorithm)                                                                \
     d("LArPostProcessing",                      PostProcessingAlgorithm)                                                        \
     d("LArPreProcessing",                       PreProcessingAlgorithm)                                                         \
+    d("LArProfiling",                           ProfilingAlgorithm)                                                             \
     d("LArSlicing",                             SlicingAlgorithm)                                                               \
     d("LArStreaming",                           StreamingAlgorithm)                                                             \
     d("LArTrackParticleBuilding",               TrackParticleBuildingAlgorithm)                                                 \
@@ -316,6 +326,8 @@
     d("LArListMerging",                         ListMergingAlgorithm)                                                           \
     d("LArPfoHitCleaning",                      PfoHitCleaningAlgorithm)                                                        \
     d("LArListPruning",                         ListPruningAlgorithm)                                                           \
+    d("LArHitCoarsening",                       HitCoarseningAlgorithm)                                                         \
+    d("LArCoarseHitRedistribution",             CoarseHitRedistributionAlgorithm)                                               \
     d("LArCandidateVertexCreation",             CandidateVertexCreationAlgorithm)                                               \
     d("LArEnergyKickVertexSelection",           EnergyKickVertexSelectionAlgorithm)                                             \
     d("LArHitAngleVertexSelection",             HitAngleVertexSelectionAlgorithm)                                               \
@@ -326,7 +338,9 @@
 #define LAR_ALGORITHM_TOOL_LIST(d)                                                                                              \
     d("LArBdtBeamParticleId",                   BdtBeamParticleIdTool)                                                          \
     d("LArBeamParticleId",                      BeamParticleIdTool)                                                             \
+    d("LArContinuousReadoutSliceSelection",     ContinuousReadoutSliceSelectionTool)                                            \
     d("LArCosmicRayTagging",                    CosmicRayTaggingTool)                                                           \
+    d("LArCosmicRaySlicePreClassification",     CosmicRaySlicePreClassificationTool)                                            \
     d("LArBdtNeutrinoId",                       BdtNeutrinoIdTool)                                                              \
     d("LArSvmNeutrinoId",                       SvmNeutrinoIdTool)                                                              \
     d("LArSimpleNeutrinoId",                    SimpleNeutrinoIdTool)                                                           \
@@ -400,57 +414,104 @@
 #define LAR_PARTICLE_ID_LIST(d)                                                                                                 \
     d("LArMuonId",                              LArParticleIdPlugins::LArMuonId)
 
-#define FACTORY Factory
-
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 namespace lar_content
 {
 
-#define LAR_CONTENT_CREATE_ALGORITHM_FACTORY(a, b)                                                                              \
-class b##FACTORY : public pandora::AlgorithmFactory                                                                             \
-{                                                                                                                               \
-public:                                                                                                                         \
-    pandora::Algorithm *CreateAlgorithm() const {return new b;};                                                                \
-};
+/**
+ *  @brief  LArAlgorithmFactory class, a generic algorithm factory calling the creation function of a lar content algorithm type
+ */
+class LArAlgorithmFactory : public pandora::AlgorithmFactory
+{
+public:
+    typedef pandora::Algorithm *(*CreationFunction)();
+    typedef std::vector<std::pair<std::string, CreationFunction>> FactoryTable;
 
-LAR_ALGORITHM_LIST(LAR_CONTENT_CREATE_ALGORITHM_FACTORY)
+    LArAlgorithmFactory(const CreationFunction creationFunction) : m_creationFunction(creationFunction) {}
+    pandora::Algorithm *CreateAlgorithm() const {return m_creationFunction();}
 
-//------------------------------------------------------------------------------------------------------------------------------------------
+    template <typename T>
+    static pandora::Algorithm *Create() {return new T;}
 
-#define LAR_CONTENT_CREATE_ALGORITHM_TOOL_FACTORY(a, b)                                                                         \
-class b##FACTORY : public pandora::AlgorithmToolFactory                                                                         \
-{                                                                                                                               \
-public:                                                                                                                         \
-    pandora::AlgorithmTool *CreateAlgorithmTool() const {return new b;};                                                        \
+    static const FactoryTable &GetFactoryTable();
+
+private:
+    const CreationFunction m_creationFunction; ///< The creation function for the algorithm type
 };
 
-LAR_ALGORITHM_TOOL_LIST(LAR_CONTENT_CREATE_ALGORITHM_TOOL_FACTORY)
+//------------------------------------------------------------------------------------------------------------------------------------------
 
-} // namespace lar_content
+/**
+ *  @brief  LArAlgorithmToolFactory class, a generic algorithm tool factory calling the creation function of a lar content tool type
+ */
+class LArAlgorithmToolFactory : public pandora::AlgorithmToolFactory
+{
+public:
+    typedef pandora::AlgorithmTool *(*CreationFunction)();
+    typedef std::vector<std::pair<std::string, CreationFunction>> FactoryTable;
+
+    LArAlgorithmToolFactory(const CreationFunction creationFunction) : m_creationFunction(creationFunction) {}
+    pandora::AlgorithmTool *CreateAlgorithmTool() const {return m_creationFunction();}
+
+    template <typename T>
+    static pandora::AlgorithmTool *Create() {return new T;}
+
+    static const FactoryTable &GetFactoryTable();
+
+private:
+    const CreationFunction m_creationFunction; ///< The creation function for the algorithm tool type
+};
 
-//------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-#define LAR_CONTENT_REGISTER_ALGORITHM(a, b)                                                                                    \
-{                                                                                                                               \
-    const pandora::StatusCode statusCode(PandoraApi::RegisterAlgorithmFactory(pandora, a, new lar_content::b##FACTORY));        \
-    if (pandora::STATUS_CODE_SUCCESS != statusCode)                                                                             \
-        return statusCode;                                                                                                      \
+#define LAR_CONTENT_ALGORITHM_TABLE_ENTRY(a, b) {a, &LArAlgorithmFactory::Create<b>},
+#define LAR_CONTENT_ALGORITHM_TOOL_TABLE_ENTRY(a, b) {a, &LArAlgorithmToolFactory::Create<b>},
+
+// ATTN The tables are built once per process and shared, read-only, by all pandora instances (static local initialisation is thread safe)
+const LArAlgorithmFactory::FactoryTable &LArAlgorithmFactory::GetFactoryTable()
+{
+    static const FactoryTable factoryTable{LAR_ALGORITHM_LIST(LAR_CONTENT_ALGORITHM_TABLE_ENTRY)};
+    return factoryTable;
 }
 
-#define LAR_CONTENT_REGISTER_ALGORITHM_TOOL(a, b)                                                                               \
-{                                                                                                                               \
-    const pandora::StatusCode statusCode(PandoraApi::RegisterAlgorithmToolFactory(pandora, a, new lar_content::b##FACTORY));    \
-    if (pandora::STATUS_CODE_SUCCESS != statusCode)                                                                             \
-        return statusCode;                                                                                                      \
+const LArAlgorithmToolFactory::FactoryTable &LArAlgorithmToolFactory::GetFactoryTable()
+{
+    static const FactoryTable factoryTable{LAR_ALGORITHM_TOOL_LIST(LAR_CONTENT_ALGORITHM_TOOL_TABLE_ENTRY)};
+    return factoryTable;
 }
 
+} // namespace lar_content
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 pandora::StatusCode LArContent::RegisterAlgorithms(const pandora::Pandora &pandora)
 {
-    LAR_ALGORITHM_LIST(LAR_CONTENT_REGISTER_ALGORITHM);
-    LAR_ALGORITHM_TOOL_LIST(LAR_CONTENT_REGISTER_ALGORITHM_TOOL);
+    // ATTN Each pandora instance owns, and will delete, its factories. These are just handles on the shared creation functions, with
+    // algorithms and tools themselves only created for the types requested by the instance settings
+    typedef lar_content::LArAlgorithmFactory AlgorithmFactory;
+    typedef lar_content::LArAlgorithmToolFactory AlgorithmToolFactory;
+
+    for (const AlgorithmFactory::FactoryTable::value_type &tableEntry : AlgorithmFactory::GetFactoryTable())
+    {
+        const pandora::StatusCode statusCode(
+            PandoraApi::RegisterAlgorithmFactory(pandora, tableEntry.first, new AlgorithmFactory(tableEntry.second)));
+
+        if (pandora::STATUS_CODE_SUCCESS != statusCode)
+            return statusCode;
+    }
+
+    for (const AlgorithmToolFactory::FactoryTable::value_type &tableEntry : AlgorithmToolFactory::GetFactoryTable())
+    {
+        const pandora::StatusCode statusCode(
+            PandoraApi::RegisterAlgorithmToolFactory(pandora, tableEntry.first, new AlgorithmToolFactory(tableEntry.second)));
+
+        if (pandora::STATUS_CODE_SUCCESS != statusCode)
+            return statusCode;
+    }
+
     return pandora::STATUS_CODE_SUCCESS;
 }
 
@@ -35,6 +35,14 @@ BdtBeamParticleIdTool::BdtBeamParticleIdTool() :
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+BdtBeamParticleIdTool::~BdtBeamParticleIdTool()
+{
+    if (m_useTrainingMode && (STATUS_CODE_SUCCESS != LArMvaHelper::FlushTrainingExamples()))
+        std::cout << "BdtBeamParticleIdTool: Unable to flush training examples" << std::endl;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode BdtBeamParticleIdTool::Initialize()
 {
     // Get global LArTPC geometry information
@@ -153,6 +161,59 @@ void BdtBeamParticleIdTool::SelectAllPfos(const pandora::Algorithm *const pAlgor
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void BdtBeamParticleIdTool::GetAdaBoostDecisionTreeScores(
+    const unsigned int nSlices, const SliceFeaturesVector &sliceFeaturesVector, FloatVector &adaBDTScores) const
+{
+    LArMvaHelper::MvaFeatureMatrix featureMatrix;
+    std::vector<bool> hasFeatureVector(nSlices, false);
+
+    for (unsigned int sliceIndex = 0; sliceIndex < nSlices; ++sliceIndex)
+    {
+        const SliceFeatures &sliceFeatures(sliceFeaturesVector.at(sliceIndex));
+
+        if (!sliceFeatures.IsFeatureVectorAvailable())
+            continue;
+
+        LArMvaHelper::MvaFeatureVector featureVector;
+
+        try
+        {
+            sliceFeatures.FillFeatureVector(featureVector);
+        }
+        catch (const StatusCodeException &)
+        {
+            std::cout << "BdtBeamParticleIdTool::GetAdaBoostDecisionTreeScores - unable to fill feature vector" << std::endl;
+            continue;
+        }
+
+        featureMatrix.push_back(featureVector);
+        hasFeatureVector.at(sliceIndex) = true;
+    }
+
+    LArMvaHelper::DoubleVector scores;
+    LArMvaHelper::CalculateClassificationScores(m_adaBoostDecisionTree, featureMatrix, scores);
+
+    if (scores.size() != featureMatrix.size())
+        throw StatusCodeException(STATUS_CODE_FAILURE);
+
+    unsigned int exampleIndex(0);
+
+    for (unsigned int sliceIndex = 0; sliceIndex < nSlices; ++sliceIndex)
+    {
+        // ATTN if one or more of the features can not be calculated, then default to calling the slice a cosmic ray.  -1.f is the minimum
+        // score possible for a weighted bdt.
+        if (!hasFeatureVector.at(sliceIndex))
+        {
+            adaBDTScores.push_back(-1.f);
+            continue;
+        }
+
+        adaBDTScores.push_back(static_cast<float>(scores.at(exampleIndex++)));
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void BdtBeamParticleIdTool::SelectPfos(const PfoList &pfos, PfoList &selectedPfos) const
 {
     selectedPfos.insert(selectedPfos.end(), pfos.begin(), pfos.end());
@@ -299,11 +360,14 @@ bool BdtBeamParticleIdTool::PassesQualityCuts(const float purity, const float co
 void BdtBeamParticleIdTool::SelectPfosByAdaBDTScore(const pandora::Algorithm *const pAlgorithm, const SliceHypotheses &nuSliceHypotheses,
     const SliceHypotheses &crSliceHypotheses, const SliceFeaturesVector &sliceFeaturesVector, PfoList &selectedPfos) const
 {
+    FloatVector adaBDTScores;
+    this->GetAdaBoostDecisionTreeScores(nuSliceHypotheses.size(), sliceFeaturesVector, adaBDTScores);
+
     // Calculate the probability of each slice that passes the minimum probability cut
     std::vector<UintFloatPair> sliceIndexAdaBDTScorePairs;
     for (unsigned int sliceIndex = 0, nSlices = nuSliceHypotheses.size(); sliceIndex < nSlices; ++sliceIndex)
     {
-        const float nuAdaBDTScore(sliceFeaturesVector.at(sliceIndex).GetAdaBoostDecisionTreeScore(m_adaBoostDecisionTree));
+        const float nuAdaBDTScore(adaBDTScores.at(sliceIndex));
 
         for (const ParticleFlowObject *const pPfo : crSliceHypotheses.at(sliceIndex))
         {
@@ -662,30 +726,6 @@ void BdtBeamParticleIdTool::SliceFeatures::FillFeatureVector(LArMvaHelper::MvaFe
     featureVector.insert(featureVector.end(), m_featureVector.begin(), m_featureVector.end());
 }
 
-//------------------------------------------------------------------------------------------------------------------------------------------
-
-float BdtBeamParticleIdTool::SliceFeatures::GetAdaBoostDecisionTreeScore(const AdaBoostDecisionTree &adaBoostDecisionTree) const
-{
-    // ATTN if one or more of the features can not be calculated, then default to calling the slice a cosmic ray.  -1.f is the minimum score
-    // possible for a weighted bdt.
-    if (!this->IsFeatureVectorAvailable())
-        return -1.f;
-
-    LArMvaHelper::MvaFeatureVector featureVector;
-
-    try
-    {
-        this->FillFeatureVector(featureVector);
-    }
-    catch (const StatusCodeException &statusCodeException)
-    {
-        std::cout << "BdtBeamParticleIdTool::SliceFeatures::GetAdaBoostDecisionTreeScore - unable to fill feature vector" << std::endl;
-        return -1.f;
-    }
-
-    return LArMvaHelper::CalculateClassificationScore(adaBoostDecisionTree, featureVector);
-}
-
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -43,9 +43,9 @@ public:
     BdtBeamParticleIdTool &operator=(const BdtBeamParticleIdTool &) = default;
 
     /**
-     *  @brief  Destructor
+     *  @brief  Destructor, flushing any buffered training examples
      */
-    ~BdtBeamParticleIdTool() = default;
+    ~BdtBeamParticleIdTool();
 
     void SelectOutputPfos(const pandora::Algorithm *const pAlgorithm, const SliceHypotheses &beamSliceHypotheses,
         const SliceHypotheses &crSliceHypotheses, pandora::PfoList &selectedPfos);
@@ -256,15 +256,6 @@ private:
          */
         void FillFeatureVector(LArMvaHelper::MvaFeatureVector &featureVector) const;
 
-        /**
-         *  @brief  Get the probability that this slice contains a beam particle
-         *
-         *  @param  adaBoostDecisionTree the adaptive boost decision tree used to calculate the probability
-         *
-         *  @return the probability that the slice contains a beam particle
-         */
-        float GetAdaBoostDecisionTreeScore(const AdaBoostDecisionTree &adaBoostDecisionTree) const;
-
     private:
         /**
          *  @brief  Select a given fraction of a slice's calo hits that are closest to the beam spot
@@ -382,6 +373,16 @@ private:
     void SelectPfosByAdaBDTScore(const pandora::Algorithm *const pAlgorithm, const SliceHypotheses &nuSliceHypotheses,
         const SliceHypotheses &crSliceHypotheses, const SliceFeaturesVector &sliceFeaturesVector, pandora::PfoList &selectedPfos) const;
 
+    /**
+     *  @brief  Get the AdaBDT score that each slice contains a beam particle, scoring all slices in a single call to the bdt
+     *
+     *  @param  nSlices the number of slices
+     *  @param  sliceFeaturesVector vector holding the slice features
+     *  @param  adaBDTScores to receive the AdaBDT score for each slice, in slice order
+     */
+    void GetAdaBoostDecisionTreeScores(
+        const unsigned int nSlices, const SliceFeaturesVector &sliceFeaturesVector, pandora::FloatVector &adaBDTScores) const;
+
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
     // Training
@@ -186,25 +186,27 @@ void BeamParticleIdTool::GetSelectedCaloHits(const CaloHitList &inputCaloHitList
     typedef std::vector<HitDistancePair> HitDistanceVector;
     HitDistanceVector hitDistanceVector;
 
+    hitDistanceVector.reserve(inputCaloHitList.size());
+
     for (const CaloHit *const pCaloHit : inputCaloHitList)
         hitDistanceVector.emplace_back(pCaloHit, (pCaloHit->GetPositionVector() - m_beamTPCIntersection).GetMagnitudeSquared());
 
-    std::sort(hitDistanceVector.begin(), hitDistanceVector.end(),
-        [](const HitDistancePair &lhs, const HitDistancePair &rhs) -> bool { return (lhs.second < rhs.second); });
-    closestHitToFaceDistance = std::sqrt(hitDistanceVector.front().second);
+    auto sortByDistance = [](const HitDistancePair &lhs, const HitDistancePair &rhs) -> bool { return (lhs.second < rhs.second); };
+    closestHitToFaceDistance = std::sqrt(std::min_element(hitDistanceVector.begin(), hitDistanceVector.end(), sortByDistance)->second);
+
+    // ATTN Slices with no hits within the beam window cannot pass the closest distance cut, so need no hit selection
+    if (!(closestHitToFaceDistance < m_closestDistanceCut))
+        return;
 
     const unsigned int nInputHits(inputCaloHitList.size());
-    const unsigned int nSelectedCaloHits(
-        nInputHits < m_nSelectedHits ? nInputHits
-                                     : static_cast<unsigned int>(std::round(static_cast<float>(nInputHits) * m_selectedFraction / 100.f + 0.5f)));
+    const unsigned int nFractionHits(
+        static_cast<unsigned int>(std::round(static_cast<float>(nInputHits) * m_selectedFraction / 100.f + 0.5f)));
+    const unsigned int nSelectedCaloHits(nInputHits < m_nSelectedHits ? nInputHits : std::min(nInputHits, nFractionHits));
 
-    for (const HitDistancePair &hitDistancePair : hitDistanceVector)
-    {
-        outputCaloHitList.push_back(hitDistancePair.first);
+    std::partial_sort(hitDistanceVector.begin(), hitDistanceVector.begin() + nSelectedCaloHits, hitDistanceVector.end(), sortByDistance);
 
-        if (outputCaloHitList.size() >= nSelectedCaloHits)
-            break;
-    }
+    for (unsigned int iHit = 0; iHit < nSelectedCaloHits; ++iHit)
+        outputCaloHitList.push_back(hitDistanceVector.at(iHit).first);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
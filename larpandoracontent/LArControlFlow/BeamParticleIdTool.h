@@ -59,7 +59,8 @@ private:
     pandora::StatusCode Initialize();
 
     /**
-     *  @brief  Select a given fraction of a slice's calo hits that are closest to the beam spot
+     *  @brief  Select a given fraction of a slice's calo hits that are closest to the beam spot. No hits are selected if the closest hit
+     *          lies outside the beam window, defined by the closest distance cut.
      *
      *  @param  inputCaloHitList all calo hits in slice
      *  @param  outputCaloHitList to receive the list of selected calo hits
@@ -0,0 +1,81 @@
+/**
+ *  @file   larpandoracontent/LArControlFlow/ContinuousReadoutSliceSelectionTool.cc
+ *
+ *  @brief  Implementation of the continuous readout slice selection tool class.
+ *
+ *  $Log: $
+ */
+
+#include "Pandora/AlgorithmHeaders.h"
+
+#include "larpandoracontent/LArControlFlow/ContinuousReadoutSliceSelectionTool.h"
+
+using namespace pandora;
+
+namespace lar_content
+{
+
+ContinuousReadoutSliceSelectionTool::ContinuousReadoutSliceSelectionTool() : m_minPreviousWindowHitFraction(1.f)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ContinuousReadoutSliceSelectionTool::SelectSlices(
+    const Algorithm *const, const SliceVector &inputSliceVector, SliceVector &outputSliceVector)
+{
+    if (this->GetPandora().GetSettings()->ShouldDisplayAlgorithmInfo())
+        std::cout << "----> Running Algorithm Tool: " << this->GetInstanceName() << ", " << this->GetType() << std::endl;
+
+    HitKeySet currentWindowHitKeys;
+
+    for (const CaloHitList &sliceHits : inputSliceVector)
+    {
+        unsigned int nPreviousWindowHits(0);
+
+        for (const CaloHit *const pCaloHit : sliceHits)
+        {
+            const HitKey hitKey(this->GetHitKey(pCaloHit));
+            currentWindowHitKeys.insert(hitKey);
+
+            if (m_previousWindowHitKeys.count(hitKey))
+                ++nPreviousWindowHits;
+        }
+
+        if (!sliceHits.empty() &&
+            (static_cast<float>(nPreviousWindowHits) >= m_minPreviousWindowHitFraction * static_cast<float>(sliceHits.size())))
+            continue;
+
+        outputSliceVector.push_back(sliceHits);
+    }
+
+    m_previousWindowHitKeys = std::move(currentWindowHitKeys);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+ContinuousReadoutSliceSelectionTool::HitKey ContinuousReadoutSliceSelectionTool::GetHitKey(const CaloHit *const pCaloHit) const
+{
+    const CartesianVector &position(pCaloHit->GetPositionVector());
+    return HitKey(
+        static_cast<int>(pCaloHit->GetHitType()), pCaloHit->GetTime(), position.GetX(), position.GetZ(), pCaloHit->GetInputEnergy());
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ContinuousReadoutSliceSelectionTool::ReadSettings(const TiXmlHandle xmlHandle)
+{
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
+        XmlHelper::ReadValue(xmlHandle, "MinPreviousWindowHitFraction", m_minPreviousWindowHitFraction));
+
+    if ((m_minPreviousWindowHitFraction <= 0.f) || (m_minPreviousWindowHitFraction > 1.f))
+    {
+        std::cout << "ContinuousReadoutSliceSelectionTool::ReadSettings - MinPreviousWindowHitFraction must lie in the range (0, 1]"
+                  << std::endl;
+        return STATUS_CODE_INVALID_PARAMETER;
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+} // namespace lar_content
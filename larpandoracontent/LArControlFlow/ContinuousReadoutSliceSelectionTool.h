@@ -0,0 +1,55 @@
+/**
+ *  @file   larpandoracontent/LArControlFlow/ContinuousReadoutSliceSelectionTool.h
+ *
+ *  @brief  Header file for the continuous readout slice selection tool class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_CONTINUOUS_READOUT_SLICE_SELECTION_TOOL_H
+#define LAR_CONTINUOUS_READOUT_SLICE_SELECTION_TOOL_H 1
+
+#include "larpandoracontent/LArControlFlow/MasterAlgorithm.h"
+
+#include <set>
+#include <tuple>
+
+namespace lar_content
+{
+
+/**
+ *  @brief  ContinuousReadoutSliceSelectionTool class, for continuous readout in which each event is one of a series of overlapping
+ *          readout windows. Hits in the previous window are remembered, and slices lying (almost) entirely within the overlap with
+ *          the previous window, which will already have been reconstructed, are not selected for reconstruction a second time.
+ */
+class ContinuousReadoutSliceSelectionTool : public SliceSelectionBaseTool
+{
+public:
+    /**
+     *  @brief  Default constructor
+     */
+    ContinuousReadoutSliceSelectionTool();
+
+    void SelectSlices(const pandora::Algorithm *const pAlgorithm, const SliceVector &inputSliceVector, SliceVector &outputSliceVector);
+
+private:
+    pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
+
+    typedef std::tuple<int, float, float, float, float> HitKey;
+    typedef std::set<HitKey> HitKeySet;
+
+    /**
+     *  @brief  Get the key identifying a hit across readout windows, built from its hit type, time, position and input energy
+     *
+     *  @param  pCaloHit the address of the calo hit
+     *
+     *  @return the hit key
+     */
+    HitKey GetHitKey(const pandora::CaloHit *const pCaloHit) const;
+
+    float m_minPreviousWindowHitFraction; ///< The minimum fraction of slice hits seen in the previous window for a slice to be rejected
+    HitKeySet m_previousWindowHitKeys;    ///< The keys of the hits in slices in the previous readout window
+};
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_CONTINUOUS_READOUT_SLICE_SELECTION_TOOL_H
@@ -0,0 +1,135 @@
+/**
+ *  @file   larpandoracontent/LArControlFlow/CosmicRaySlicePreClassificationTool.cc
+ *
+ *  @brief  Implementation of the cosmic-ray slice pre-classification tool class.
+ *
+ *  $Log: $
+ */
+
+#include "Pandora/AlgorithmHeaders.h"
+
+#include "larpandoracontent/LArControlFlow/CosmicRaySlicePreClassificationTool.h"
+
+#include "larpandoracontent/LArHelpers/LArPfoHelper.h"
+
+using namespace pandora;
+
+namespace lar_content
+{
+
+CosmicRaySlicePreClassificationTool::CosmicRaySlicePreClassificationTool() :
+    m_minSliceHits(0),
+    m_minThreeDHits(15),
+    m_marginY(20.f),
+    m_minClearCosmicRayHitFraction(0.95f),
+    m_face_Yb(0.f),
+    m_face_Yt(0.f)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode CosmicRaySlicePreClassificationTool::Initialize()
+{
+    const LArTPCMap &larTPCMap(this->GetPandora().GetGeometry()->GetLArTPCMap());
+
+    if (larTPCMap.empty())
+    {
+        std::cout << "CosmicRaySlicePreClassificationTool::Initialize - LArTPC description not registered with Pandora as required "
+                  << std::endl;
+        return STATUS_CODE_NOT_INITIALIZED;
+    }
+
+    const LArTPC *const pFirstLArTPC(larTPCMap.begin()->second);
+    m_face_Yb = pFirstLArTPC->GetCenterY() - 0.5f * pFirstLArTPC->GetWidthY();
+    m_face_Yt = pFirstLArTPC->GetCenterY() + 0.5f * pFirstLArTPC->GetWidthY();
+
+    for (const LArTPCMap::value_type &mapEntry : larTPCMap)
+    {
+        const LArTPC *const pLArTPC(mapEntry.second);
+        m_face_Yb = std::min(m_face_Yb, pLArTPC->GetCenterY() - 0.5f * pLArTPC->GetWidthY());
+        m_face_Yt = std::max(m_face_Yt, pLArTPC->GetCenterY() + 0.5f * pLArTPC->GetWidthY());
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool CosmicRaySlicePreClassificationTool::IsClearCosmicRaySlice(
+    const Algorithm *const, const CaloHitList &sliceHits, const PfoList &crSlicePfos)
+{
+    if (this->GetPandora().GetSettings()->ShouldDisplayAlgorithmInfo())
+        std::cout << "----> Running Algorithm Tool: " << this->GetInstanceName() << ", " << this->GetType() << std::endl;
+
+    if (sliceHits.empty() || (sliceHits.size() < m_minSliceHits))
+        return false;
+
+    unsigned int nClearCosmicRayHits(0);
+
+    for (const ParticleFlowObject *const pPfo : crSlicePfos)
+    {
+        if (!pPfo->GetParentPfoList().empty() || !this->IsTopToBottom(pPfo))
+            continue;
+
+        PfoList downstreamPfos;
+        LArPfoHelper::GetAllDownstreamPfos(pPfo, downstreamPfos);
+
+        for (const ParticleFlowObject *const pDownstreamPfo : downstreamPfos)
+            nClearCosmicRayHits += LArPfoHelper::GetNumberOfTwoDHits(pDownstreamPfo);
+    }
+
+    return (static_cast<float>(nClearCosmicRayHits) >= m_minClearCosmicRayHitFraction * static_cast<float>(sliceHits.size()));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool CosmicRaySlicePreClassificationTool::IsTopToBottom(const ParticleFlowObject *const pPfo) const
+{
+    ClusterList clusters3D;
+    LArPfoHelper::GetThreeDClusterList(pPfo, clusters3D);
+
+    // ATTN Only uses first cluster with hits of type TPC_3D
+    if (clusters3D.empty() || (clusters3D.front()->GetNCaloHits() < m_minThreeDHits))
+        return false;
+
+    float lowerY(std::numeric_limits<float>::max()), upperY(-std::numeric_limits<float>::max());
+
+    for (const OrderedCaloHitList::value_type &layerEntry : clusters3D.front()->GetOrderedCaloHitList())
+    {
+        for (const CaloHit *const pCaloHit : *layerEntry.second)
+        {
+            lowerY = std::min(lowerY, pCaloHit->GetPositionVector().GetY());
+            upperY = std::max(upperY, pCaloHit->GetPositionVector().GetY());
+        }
+    }
+
+    return ((upperY > m_face_Yt - m_marginY) && (lowerY < m_face_Yb + m_marginY));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode CosmicRaySlicePreClassificationTool::ReadSettings(const TiXmlHandle xmlHandle)
+{
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "MinSliceHits", m_minSliceHits));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "MinThreeDHits", m_minThreeDHits));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "MarginY", m_marginY));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
+        XmlHelper::ReadValue(xmlHandle, "MinClearCosmicRayHitFraction", m_minClearCosmicRayHitFraction));
+
+    if ((m_minClearCosmicRayHitFraction <= 0.f) || (m_minClearCosmicRayHitFraction > 1.f))
+    {
+        std::cout << "CosmicRaySlicePreClassificationTool::ReadSettings - MinClearCosmicRayHitFraction must lie in the range (0, 1]"
+                  << std::endl;
+        return STATUS_CODE_INVALID_PARAMETER;
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+} // namespace lar_content
@@ -0,0 +1,53 @@
+/**
+ *  @file   larpandoracontent/LArControlFlow/CosmicRaySlicePreClassificationTool.h
+ *
+ *  @brief  Header file for the cosmic-ray slice pre-classification tool class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_COSMIC_RAY_SLICE_PRE_CLASSIFICATION_TOOL_H
+#define LAR_COSMIC_RAY_SLICE_PRE_CLASSIFICATION_TOOL_H 1
+
+#include "larpandoracontent/LArControlFlow/MasterAlgorithm.h"
+
+namespace lar_content
+{
+
+/**
+ *  @brief  CosmicRaySlicePreClassificationTool class, identifying slices dominated by through-going (top-to-bottom) cosmic-ray muons
+ */
+class CosmicRaySlicePreClassificationTool : public SlicePreClassificationBaseTool
+{
+public:
+    /**
+     *  @brief  Default constructor
+     */
+    CosmicRaySlicePreClassificationTool();
+
+    bool IsClearCosmicRaySlice(
+        const pandora::Algorithm *const pAlgorithm, const pandora::CaloHitList &sliceHits, const pandora::PfoList &crSlicePfos);
+
+private:
+    pandora::StatusCode Initialize();
+    pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
+
+    /**
+     *  @brief  Whether a parent cosmic-ray pfo crosses the detector from top to bottom
+     *
+     *  @param  pPfo the address of the parent pfo
+     *
+     *  @return boolean
+     */
+    bool IsTopToBottom(const pandora::ParticleFlowObject *const pPfo) const;
+
+    unsigned int m_minSliceHits;          ///< The minimum number of hits in a slice for it to be considered for pre-classification
+    unsigned int m_minThreeDHits;         ///< The minimum number of hits in a pfo 3D cluster to assess its topology
+    float m_marginY;                      ///< The maximum distance of a pfo 3D extremal position from a detector y face
+    float m_minClearCosmicRayHitFraction; ///< The minimum fraction of slice hits in top-to-bottom pfo hierarchies
+    float m_face_Yb;                      ///< The y coordinate of the detector bottom face
+    float m_face_Yt;                      ///< The y coordinate of the detector top face
+};
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_COSMIC_RAY_SLICE_PRE_CLASSIFICATION_TOOL_H
@@ -105,14 +105,17 @@ void CosmicRayTaggingTool::FindAmbiguousPfos(const PfoList &parentCosmicRayPfos,
     m_face_Zu = parentMinZ;
     m_face_Zd = parentMaxZ;
 
+    PfoToSlidingFitsMap pfoToSlidingFitsMap;
+    this->GetSlidingFits(parentCosmicRayPfos, pfoToSlidingFitsMap);
+
     PfoToPfoListMap pfoAssociationMap;
-    this->GetPfoAssociations(parentCosmicRayPfos, pfoAssociationMap);
+    this->GetPfoAssociations(parentCosmicRayPfos, pfoToSlidingFitsMap, pfoAssociationMap);
 
     PfoToSliceIdMap pfoToSliceIdMap;
     this->SliceEvent(parentCosmicRayPfos, pfoAssociationMap, pfoToSliceIdMap);
 
     CRCandidateList candidates;
-    this->GetCRCandidates(parentCosmicRayPfos, pfoToSliceIdMap, candidates);
+    this->GetCRCandidates(parentCosmicRayPfos, pfoToSliceIdMap, pfoToSlidingFitsMap, candidates);
 
     PfoToBoolMap pfoToInTimeMap;
     this->CheckIfInTime(candidates, pfoToInTimeMap);
@@ -154,24 +157,30 @@ bool CosmicRayTaggingTool::GetValid3DCluster(const ParticleFlowObject *const pPf
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void CosmicRayTaggingTool::GetPfoAssociations(const PfoList &parentCosmicRayPfos, PfoToPfoListMap &pfoAssociationMap) const
+void CosmicRayTaggingTool::GetSlidingFits(const PfoList &parentCosmicRayPfos, PfoToSlidingFitsMap &pfoToSlidingFitsMap) const
 {
     // ATTN If wire w pitches vary between TPCs, exception will be raised in initialisation of lar pseudolayer plugin
     const LArTPC *const pFirstLArTPC(this->GetPandora().GetGeometry()->GetLArTPCMap().begin()->second);
     const float layerPitch(pFirstLArTPC->GetWirePitchW());
 
-    PfoToSlidingFitsMap pfoToSlidingFitsMap;
-
     for (const ParticleFlowObject *const pPfo : parentCosmicRayPfos)
     {
         const pandora::Cluster *pCluster(nullptr);
         if (!this->GetValid3DCluster(pPfo, pCluster) || !pCluster)
             continue;
 
+        // ATTN Only the end directions of the wider fit are used
         (void)pfoToSlidingFitsMap.insert(PfoToSlidingFitsMap::value_type(pPfo,
-            std::make_pair(ThreeDSlidingFitResult(pCluster, 5, layerPitch), ThreeDSlidingFitResult(pCluster, 100, layerPitch)))); // TODO Configurable
+            std::make_pair(ThreeDSlidingFitResult(pCluster, 5, layerPitch),
+                ThreeDSlidingFitResult(pCluster, 100, layerPitch, ThreeDSlidingFitResult::ENDPOINTS_ONLY)))); // TODO Configurable
     }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
 
+void CosmicRayTaggingTool::GetPfoAssociations(
+    const PfoList &parentCosmicRayPfos, const PfoToSlidingFitsMap &pfoToSlidingFitsMap, PfoToPfoListMap &pfoAssociationMap) const
+{
     for (const ParticleFlowObject *const pPfo1 : parentCosmicRayPfos)
     {
         PfoToSlidingFitsMap::const_iterator iter1(pfoToSlidingFitsMap.find(pPfo1));
@@ -323,14 +332,19 @@ void CosmicRayTaggingTool::FillSlice(const ParticleFlowObject *const pPfo, const
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void CosmicRayTaggingTool::GetCRCandidates(const PfoList &parentCosmicRayPfos, const PfoToSliceIdMap &pfoToSliceIdMap, CRCandidateList &candidates) const
+void CosmicRayTaggingTool::GetCRCandidates(const PfoList &parentCosmicRayPfos, const PfoToSliceIdMap &pfoToSliceIdMap,
+    const PfoToSlidingFitsMap &pfoToSlidingFitsMap, CRCandidateList &candidates) const
 {
     for (const ParticleFlowObject *const pPfo : parentCosmicRayPfos)
     {
         if (!LArPfoHelper::IsFinalState(pPfo))
             throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
 
-        candidates.push_back(CRCandidate(this->GetPandora(), pPfo, pfoToSliceIdMap.at(pPfo)));
+        // ATTN The short window fit used for pfo associations is identical to that required by the candidate, so avoid repeating it
+        PfoToSlidingFitsMap::const_iterator fitIter(pfoToSlidingFitsMap.find(pPfo));
+        const ThreeDSlidingFitResult *const pSlidingFitResult((pfoToSlidingFitsMap.end() != fitIter) ? &(fitIter->second.first) : nullptr);
+
+        candidates.push_back(CRCandidate(this->GetPandora(), pPfo, pfoToSliceIdMap.at(pPfo), pSlidingFitResult));
     }
 }
 
@@ -518,7 +532,8 @@ void CosmicRayTaggingTool::TagCRMuons(const CRCandidateList &candidates, const P
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-CosmicRayTaggingTool::CRCandidate::CRCandidate(const Pandora &pandora, const ParticleFlowObject *const pPfo, const unsigned int sliceId) :
+CosmicRayTaggingTool::CRCandidate::CRCandidate(const Pandora &pandora, const ParticleFlowObject *const pPfo, const unsigned int sliceId,
+    const ThreeDSlidingFitResult *const pSlidingFitResult) :
     m_pPfo(pPfo),
     m_sliceId(sliceId),
     m_canFit(false),
@@ -534,6 +549,13 @@ CosmicRayTaggingTool::CRCandidate::CRCandidate(const Pandora &pandora, const Par
     if (!clusters3D.empty() && (clusters3D.front()->GetNCaloHits() > 15)) // TODO Configurable
     {
         m_canFit = true;
+
+        if (pSlidingFitResult)
+        {
+            this->CalculateFitVariables(*pSlidingFitResult);
+            return;
+        }
+
         const LArTPC *const pFirstLArTPC(pandora.GetGeometry()->GetLArTPCMap().begin()->second);
         const ThreeDSlidingFitResult slidingFitResult(clusters3D.front(), 5, pFirstLArTPC->GetWirePitchW()); // TODO Configurable
         this->CalculateFitVariables(slidingFitResult);
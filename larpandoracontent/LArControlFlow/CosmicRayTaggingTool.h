@@ -44,8 +44,10 @@ private:
          *  @param  pandora the relevant pandora instance
          *  @param  pPfo the address of the candidate pfo
          *  @param  slice the slice id
+         *  @param  pSlidingFitResult address of an existing sliding fit (window 5) to the first 3D cluster, or nullptr to perform a new fit
          */
-        CRCandidate(const pandora::Pandora &pandora, const pandora::ParticleFlowObject *const pPfo, const unsigned int sliceId);
+        CRCandidate(const pandora::Pandora &pandora, const pandora::ParticleFlowObject *const pPfo, const unsigned int sliceId,
+            const ThreeDSlidingFitResult *const pSlidingFitResult);
 
         const pandora::ParticleFlowObject *const m_pPfo; ///< Address of the candidate Pfo
         unsigned int m_sliceId;                          ///< Slice ID
@@ -77,15 +79,28 @@ private:
      */
     bool GetValid3DCluster(const pandora::ParticleFlowObject *const pPfo, const pandora::Cluster *&pCluster3D) const;
 
+    typedef std::pair<const ThreeDSlidingFitResult, const ThreeDSlidingFitResult> SlidingFitPair;
+    typedef std::unordered_map<const pandora::ParticleFlowObject *, SlidingFitPair> PfoToSlidingFitsMap;
+
+    /**
+     *  @brief  Perform the short and long window sliding fits for each Pfo with a valid 3D cluster
+     *
+     *  @param  parentCosmicRayPfos input list of Pfos
+     *  @param  pfoToSlidingFitsMap to receive the mapping between Pfos and their sliding fits
+     */
+    void GetSlidingFits(const pandora::PfoList &parentCosmicRayPfos, PfoToSlidingFitsMap &pfoToSlidingFitsMap) const;
+
     typedef std::unordered_map<const pandora::ParticleFlowObject *, pandora::PfoList> PfoToPfoListMap;
 
     /**
      *  @brief  Get mapping between Pfos that are associated with it other by pointing
      *
      *  @param  parentCosmicRayPfos input list of Pfos
+     *  @param  pfoToSlidingFitsMap input mapping between Pfos and their sliding fits
      *  @param  pfoAssociationsMap to receive the output mapping between associated Pfos
      */
-    void GetPfoAssociations(const pandora::PfoList &parentCosmicRayPfos, PfoToPfoListMap &pfoAssociationMap) const;
+    void GetPfoAssociations(const pandora::PfoList &parentCosmicRayPfos, const PfoToSlidingFitsMap &pfoToSlidingFitsMap,
+        PfoToPfoListMap &pfoAssociationMap) const;
 
     /**
      *  @brief  Check whethe two Pfo endpoints are associated by distance of closest approach
@@ -125,9 +140,11 @@ private:
      *
      *  @param  parentCosmicRayPfos input list of Pfos
      *  @param  pfoToSliceIdMap input mapping between Pfos and their slice id
+     *  @param  pfoToSlidingFitsMap input mapping between Pfos and their sliding fits, reused where possible
      *  @param  candidates to receive the output list of CRCandidates
      */
-    void GetCRCandidates(const pandora::PfoList &parentCosmicRayPfos, const PfoToSliceIdMap &pfoToSliceIdMap, CRCandidateList &candidates) const;
+    void GetCRCandidates(const pandora::PfoList &parentCosmicRayPfos, const PfoToSliceIdMap &pfoToSliceIdMap,
+        const PfoToSlidingFitsMap &pfoToSlidingFitsMap, CRCandidateList &candidates) const;
 
     typedef std::unordered_map<const pandora::ParticleFlowObject *, bool> PfoToBoolMap;
 
@@ -183,8 +200,6 @@ private:
 
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
-    typedef std::pair<const ThreeDSlidingFitResult, const ThreeDSlidingFitResult> SlidingFitPair;
-    typedef std::unordered_map<const pandora::ParticleFlowObject *, SlidingFitPair> PfoToSlidingFitsMap;
     typedef std::vector<pandora::PfoList> SliceList;
 
     /**
@@ -13,13 +13,19 @@
 #include "larpandoracontent/LArContent.h"
 #include "larpandoracontent/LArControlFlow/MasterAlgorithm.h"
 
+#include "larpandoracontent/LArHelpers/LArCheatingIndexHelper.h"
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
+#include "larpandoracontent/LArHelpers/LArEventDeadlineHelper.h"
 #include "larpandoracontent/LArHelpers/LArFileHelper.h"
+#include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
 #include "larpandoracontent/LArHelpers/LArMCParticleHelper.h"
+#include "larpandoracontent/LArHelpers/LArParallelHelper.h"
 #include "larpandoracontent/LArHelpers/LArPfoHelper.h"
+#include "larpandoracontent/LArHelpers/LArSlidingFitCacheHelper.h"
 #include "larpandoracontent/LArHelpers/LArStitchingHelper.h"
 
 #include "larpandoracontent/LArObjects/LArCaloHit.h"
+#include "larpandoracontent/LArObjects/LArCompactMCWeights.h"
 #include "larpandoracontent/LArObjects/LArMCParticle.h"
 
 #include "larpandoracontent/LArPlugins/LArPseudoLayerPlugin.h"
@@ -27,6 +33,9 @@
 
 #include "larpandoracontent/LArUtility/PfoMopUpBaseAlgorithm.h"
 
+#include <atomic>
+#include <chrono>
+
 using namespace pandora;
 
 namespace lar_content
@@ -48,56 +57,119 @@ MasterAlgorithm::MasterAlgorithm() :
     m_pSlicingWorkerInstance(nullptr),
     m_pSliceNuWorkerInstance(nullptr),
     m_pSliceCRWorkerInstance(nullptr),
+    m_pSliceNuDegradedWorkerInstance(nullptr),
     m_fullWidthCRWorkerWireGaps(true),
     m_passMCParticlesToWorkerInstances(false),
+    m_nCRWorkerThreads(1),
+    m_nSliceWorkerInstances(1),
+    m_validateParallelExecution(false),
+    m_shouldShareWorkerXmlDocuments(false),
+    m_passMCParticlesToCRWorkers(true),
+    m_passMCParticlesToSlicingWorker(true),
+    m_passMCParticlesToSliceNuWorkers(true),
+    m_passMCParticlesToSliceCRWorkers(true),
+    m_maxEventHitsForFullReco(std::numeric_limits<unsigned int>::max()),
+    m_maxSliceHitsForFullReco(std::numeric_limits<unsigned int>::max()),
+    m_maxEventTimeForFullReco(std::numeric_limits<float>::max()),
+    m_maxEventTime(std::numeric_limits<float>::max()),
+    m_shouldRecordWorkerTimings(false),
+    m_writeWorkerTimingsTree(false),
+    m_eventNumber(0),
     m_filePathEnvironmentVariable("FW_SEARCH_PATH"),
-    m_inTimeMaxX0(1.f)
+    m_inTimeMaxX0(1.f),
+    m_workerCaloHitMemoryRecord(LArMemoryAccountingHelper::WORKER_CALO_HIT_MEMORY),
+    m_workerMCParticleMemoryRecord(LArMemoryAccountingHelper::WORKER_MC_PARTICLE_MEMORY)
 {
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void MasterAlgorithm::ShiftPfoHierarchy(const ParticleFlowObject *const pParentPfo, const PfoToLArTPCMap &pfoToLArTPCMap, const float x0) const
+MasterAlgorithm::~MasterAlgorithm()
 {
-    if (!pParentPfo->GetParentPfoList().empty())
-        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+    if (m_writeWorkerTimingsTree)
+    {
+        PANDORA_MONITORING_API(SaveTree(this->GetPandora(), m_workerTimingsTreeName.c_str(), m_workerTimingsFileName.c_str(), "UPDATE"));
+    }
+}
 
-    PfoToLArTPCMap::const_iterator larTPCIter(pfoToLArTPCMap.find(pParentPfo));
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void MasterAlgorithm::ShiftPfoHierarchy(const ParticleFlowObject *const pParentPfo, const PfoToLArTPCMap &pfoToLArTPCMap, const float x0) const
+{
+    PfoToFloatMap parentPfoToX0Map;
+    parentPfoToX0Map[pParentPfo] = x0;
+    this->ShiftPfoHierarchies(parentPfoToX0Map, pfoToLArTPCMap);
+}
 
-    if (pfoToLArTPCMap.end() == larTPCIter)
-        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
+//------------------------------------------------------------------------------------------------------------------------------------------
 
+void MasterAlgorithm::ShiftPfoHierarchies(const PfoToFloatMap &parentPfoToX0Map, const PfoToLArTPCMap &pfoToLArTPCMap) const
+{
+    PfoVector parentPfos;
+    for (const PfoToFloatMap::value_type &mapEntry : parentPfoToX0Map)
+        parentPfos.push_back(mapEntry.first);
+    std::sort(parentPfos.begin(), parentPfos.end(), LArPfoHelper::SortByNHits);
+
+    typedef std::pair<const CaloHit *, float> CaloHitShift;
+    typedef std::pair<const Vertex *, float> VertexShift;
+    std::vector<CaloHitShift> caloHitShifts;
+    std::vector<VertexShift> vertexShifts;
     PfoList pfoList;
-    LArPfoHelper::GetAllDownstreamPfos(pParentPfo, pfoList);
+
+    for (const ParticleFlowObject *const pParentPfo : parentPfos)
+    {
+        if (!pParentPfo->GetParentPfoList().empty())
+            throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+        if (pfoToLArTPCMap.end() == pfoToLArTPCMap.find(pParentPfo))
+            throw StatusCodeException(STATUS_CODE_NOT_FOUND);
+
+        const float x0(parentPfoToX0Map.at(pParentPfo));
+        PfoList hierarchyPfoList;
+        LArPfoHelper::GetAllDownstreamPfos(pParentPfo, hierarchyPfoList);
+
+        for (const ParticleFlowObject *const pDaughterPfo : hierarchyPfoList)
+        {
+            for (const Cluster *const pCluster : pDaughterPfo->GetClusterList())
+            {
+                for (const OrderedCaloHitList::value_type &layerEntry : pCluster->GetOrderedCaloHitList())
+                {
+                    for (const CaloHit *const pCaloHit : *layerEntry.second)
+                        caloHitShifts.emplace_back(pCaloHit, x0);
+                }
+
+                for (const CaloHit *const pCaloHit : pCluster->GetIsolatedCaloHitList())
+                    caloHitShifts.emplace_back(pCaloHit, x0);
+            }
+
+            for (const Vertex *const pVertex : pDaughterPfo->GetVertexList())
+                vertexShifts.emplace_back(pVertex, x0);
+        }
+
+        if (m_visualizeOverallRecoStatus)
+            std::cout << "ShiftPfoHierarchy: x0 " << x0 << std::endl;
+
+        pfoList.insert(pfoList.end(), hierarchyPfoList.begin(), hierarchyPfoList.end());
+    }
 
     if (m_visualizeOverallRecoStatus)
     {
-        std::cout << "ShiftPfoHierarchy: x0 " << x0 << std::endl;
         PANDORA_MONITORING_API(VisualizeParticleFlowObjects(this->GetPandora(), &pfoList, "BeforeShiftCRPfos", GREEN));
     }
 
-    for (const ParticleFlowObject *const pDaughterPfo : pfoList)
+    // ATTN The x0 shift is held as object metadata, so no derived cluster properties need recalculating
+    for (const CaloHitShift &caloHitShift : caloHitShifts)
     {
-        CaloHitList caloHitList;
-        for (const Cluster *const pCluster : pDaughterPfo->GetClusterList())
-        {
-            pCluster->GetOrderedCaloHitList().FillCaloHitList(caloHitList);
-            caloHitList.insert(caloHitList.end(), pCluster->GetIsolatedCaloHitList().begin(), pCluster->GetIsolatedCaloHitList().end());
-        }
-
-        for (const CaloHit *const pCaloHit : caloHitList)
-        {
-            PandoraContentApi::CaloHit::Metadata metadata;
-            metadata.m_x0 = x0;
-            PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::CaloHit::AlterMetadata(*this, pCaloHit, metadata));
-        }
+        PandoraContentApi::CaloHit::Metadata metadata;
+        metadata.m_x0 = caloHitShift.second;
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::CaloHit::AlterMetadata(*this, caloHitShift.first, metadata));
+    }
 
-        for (const Vertex *const pVertex : pDaughterPfo->GetVertexList())
-        {
-            PandoraContentApi::Vertex::Metadata metadata;
-            metadata.m_x0 = x0;
-            PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::Vertex::AlterMetadata(*this, pVertex, metadata));
-        }
+    for (const VertexShift &vertexShift : vertexShifts)
+    {
+        PandoraContentApi::Vertex::Metadata metadata;
+        metadata.m_x0 = vertexShift.second;
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::Vertex::AlterMetadata(*this, vertexShift.first, metadata));
     }
 
     if (m_visualizeOverallRecoStatus)
@@ -152,13 +224,24 @@ void MasterAlgorithm::StitchPfos(
 
 StatusCode MasterAlgorithm::Run()
 {
+    m_eventStartTime = std::chrono::steady_clock::now();
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->Reset());
 
+    if (m_maxEventTime < std::numeric_limits<float>::max())
+    {
+        m_eventDeadline = m_eventStartTime + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                                                 std::chrono::duration<float>(m_maxEventTime));
+        LArEventDeadlineHelper::SetDeadline(this->GetPandora(), m_eventDeadline);
+    }
+
     if (!m_workerInstancesInitialized)
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->InitializeWorkerInstances());
 
-    if (m_passMCParticlesToWorkerInstances)
+    if (m_passMCParticlesToWorkerInstances && !m_mcWorkerInstances.empty())
+    {
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->CopyMCParticles());
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->FillMCWeightTable());
+    }
 
     PfoToFloatMap stitchedPfosToX0Map;
     VolumeIdToHitListMap volumeIdToHitListMap;
@@ -192,6 +275,9 @@ StatusCode MasterAlgorithm::Run()
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->SelectBestSliceHypotheses(nuSliceHypotheses, crSliceHypotheses));
     }
 
+    if (m_shouldRecordWorkerTimings)
+        this->ReportWorkerTimings();
+
     return STATUS_CODE_SUCCESS;
 }
 
@@ -203,6 +289,10 @@ StatusCode MasterAlgorithm::InitializeWorkerInstances()
     if (m_workerInstancesInitialized)
         return STATUS_CODE_ALREADY_INITIALIZED;
 
+    // ATTN Xml documents read by algorithms in the worker instances (e.g. mva files) are parsed once and shared during worker creation
+    if (m_shouldShareWorkerXmlDocuments)
+        LArFileHelper::SetXmlDocumentCaching(true);
+
     try
     {
         const LArTPCMap &larTPCMap(this->GetPandora().GetGeometry()->GetLArTPCMap());
@@ -215,21 +305,63 @@ StatusCode MasterAlgorithm::InitializeWorkerInstances()
                 this->CreateWorkerInstance(*(mapEntry.second), gapList, m_crSettingsFile, "CRWorkerInstance" + std::to_string(volumeId)));
         }
 
+        if (m_passMCParticlesToCRWorkers)
+            m_mcWorkerInstances.insert(m_mcWorkerInstances.end(), m_crWorkerInstances.begin(), m_crWorkerInstances.end());
+
         if (m_shouldRunSlicing)
+        {
             m_pSlicingWorkerInstance = this->CreateWorkerInstance(larTPCMap, gapList, m_slicingSettingsFile, "SlicingWorker");
 
-        if (m_shouldRunNeutrinoRecoOption)
-            m_pSliceNuWorkerInstance = this->CreateWorkerInstance(larTPCMap, gapList, m_nuSettingsFile, "SliceNuWorker");
+            if (m_passMCParticlesToSlicingWorker)
+                m_mcWorkerInstances.push_back(m_pSlicingWorkerInstance);
+        }
 
-        if (m_shouldRunCosmicRecoOption)
-            m_pSliceCRWorkerInstance = this->CreateWorkerInstance(larTPCMap, gapList, m_crSettingsFile, "SliceCRWorker");
+        for (unsigned int workerIndex = 0; workerIndex < m_nSliceWorkerInstances; ++workerIndex)
+        {
+            const std::string suffix(workerIndex > 0 ? std::to_string(workerIndex) : "");
+
+            if (m_shouldRunNeutrinoRecoOption)
+                m_sliceNuWorkerInstances.push_back(
+                    this->CreateWorkerInstance(larTPCMap, gapList, m_nuSettingsFile, "SliceNuWorker" + suffix));
+
+            if (m_shouldRunCosmicRecoOption)
+                m_sliceCRWorkerInstances.push_back(
+                    this->CreateWorkerInstance(larTPCMap, gapList, m_crSettingsFile, "SliceCRWorker" + suffix));
+        }
+
+        m_pSliceNuWorkerInstance = m_sliceNuWorkerInstances.empty() ? nullptr : m_sliceNuWorkerInstances.front();
+        m_pSliceCRWorkerInstance = m_sliceCRWorkerInstances.empty() ? nullptr : m_sliceCRWorkerInstances.front();
+
+        if (m_shouldRunNeutrinoRecoOption && !m_degradedNuSettingsFile.empty())
+            m_pSliceNuDegradedWorkerInstance =
+                this->CreateWorkerInstance(larTPCMap, gapList, m_degradedNuSettingsFile, "SliceNuDegradedWorker");
+
+        if (m_passMCParticlesToSliceNuWorkers)
+            m_mcWorkerInstances.insert(m_mcWorkerInstances.end(), m_sliceNuWorkerInstances.begin(), m_sliceNuWorkerInstances.end());
+
+        if (m_passMCParticlesToSliceNuWorkers && m_pSliceNuDegradedWorkerInstance)
+            m_mcWorkerInstances.push_back(m_pSliceNuDegradedWorkerInstance);
+
+        if (m_passMCParticlesToSliceCRWorkers)
+            m_mcWorkerInstances.insert(m_mcWorkerInstances.end(), m_sliceCRWorkerInstances.begin(), m_sliceCRWorkerInstances.end());
+
+        if (!m_passMCParticlesToWorkerInstances)
+            m_mcWorkerInstances.clear();
+
+        m_mcWorkerInstanceSet.insert(m_mcWorkerInstances.begin(), m_mcWorkerInstances.end());
     }
     catch (const StatusCodeException &statusCodeException)
     {
+        if (m_shouldShareWorkerXmlDocuments)
+            LArFileHelper::SetXmlDocumentCaching(false);
+
         std::cout << "MasterAlgorithm: Exception during initialization of worker instances " << statusCodeException.ToString() << std::endl;
         return statusCodeException.GetStatusCode();
     }
 
+    if (m_shouldShareWorkerXmlDocuments)
+        LArFileHelper::SetXmlDocumentCaching(false);
+
     m_workerInstancesInitialized = true;
     return STATUS_CODE_SUCCESS;
 }
@@ -238,20 +370,15 @@ StatusCode MasterAlgorithm::InitializeWorkerInstances()
 
 StatusCode MasterAlgorithm::CopyMCParticles() const
 {
+    if (m_mcWorkerInstances.empty())
+        return STATUS_CODE_SUCCESS;
+
     const MCParticleList *pMCParticleList(nullptr);
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::GetList(*this, m_inputMCParticleListName, pMCParticleList));
 
-    PandoraInstanceList pandoraWorkerInstances(m_crWorkerInstances);
-    if (m_pSlicingWorkerInstance)
-        pandoraWorkerInstances.push_back(m_pSlicingWorkerInstance);
-    if (m_pSliceNuWorkerInstance)
-        pandoraWorkerInstances.push_back(m_pSliceNuWorkerInstance);
-    if (m_pSliceCRWorkerInstance)
-        pandoraWorkerInstances.push_back(m_pSliceCRWorkerInstance);
-
     LArMCParticleFactory mcParticleFactory;
 
-    for (const Pandora *const pPandoraWorker : pandoraWorkerInstances)
+    for (const Pandora *const pPandoraWorker : m_mcWorkerInstances)
     {
         for (const MCParticle *const pMCParticle : *pMCParticleList)
             PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->Copy(pPandoraWorker, pMCParticle, &mcParticleFactory));
@@ -262,6 +389,44 @@ StatusCode MasterAlgorithm::CopyMCParticles() const
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode MasterAlgorithm::FillMCWeightTable()
+{
+    const CaloHitList *pCaloHitList(nullptr);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::GetList(*this, m_inputHitListName, pCaloHitList));
+
+    CompactMCWeightTable mcWeightTable;
+    mcWeightTable.Fill(*pCaloHitList);
+
+    m_mcWeightsMap.clear();
+    m_mcWeightsMap.reserve(pCaloHitList->size());
+
+    for (const CaloHit *const pCaloHit : *pCaloHitList)
+    {
+        const CompactMCWeights &compactMCWeights(mcWeightTable.GetWeights(pCaloHit));
+
+        MCWeightVector mcWeightVector;
+        mcWeightVector.reserve(compactMCWeights.GetNContributions());
+
+        for (unsigned int rank = 0; rank < compactMCWeights.GetNContributions(); ++rank)
+        {
+            const CompactMCWeights::IndexWeight &indexWeight(compactMCWeights.GetContribution(rank));
+            mcWeightVector.emplace_back(mcWeightTable.GetMCParticle(indexWeight.first), indexWeight.second);
+        }
+
+        // ATTN Sorted once per event, rather than each time the hit is copied to a worker instance
+        std::sort(mcWeightVector.begin(), mcWeightVector.end(),
+            [](const MCWeightVector::value_type &lhs, const MCWeightVector::value_type &rhs) {
+                return LArMCParticleHelper::SortByMomentum(lhs.first, rhs.first);
+            });
+
+        m_mcWeightsMap.emplace(pCaloHit, std::move(mcWeightVector));
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode MasterAlgorithm::GetVolumeIdToHitListMap(VolumeIdToHitListMap &volumeIdToHitListMap) const
 {
     const LArTPCMap &larTPCMap(this->GetPandora().GetGeometry()->GetLArTPCMap());
@@ -297,7 +462,8 @@ StatusCode MasterAlgorithm::GetVolumeIdToHitListMap(VolumeIdToHitListMap &volume
 
 StatusCode MasterAlgorithm::RunCosmicRayReconstruction(const VolumeIdToHitListMap &volumeIdToHitListMap) const
 {
-    unsigned int workerCounter(0);
+    typedef std::pair<const Pandora *, const CaloHitList *> WorkerHitListPair;
+    std::vector<WorkerHitListPair> workerHitListPairs;
 
     for (const Pandora *const pCRWorker : m_crWorkerInstances)
     {
@@ -307,14 +473,43 @@ StatusCode MasterAlgorithm::RunCosmicRayReconstruction(const VolumeIdToHitListMa
         if (volumeIdToHitListMap.end() == iter)
             continue;
 
-        for (const CaloHit *const pCaloHit : iter->second.m_allHitList)
-            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->Copy(pCRWorker, pCaloHit));
+        workerHitListPairs.emplace_back(pCRWorker, &(iter->second.m_allHitList));
+    }
 
-        if (m_printOverallRecoStatus)
-            std::cout << "Running cosmic-ray reconstruction worker instance " << ++workerCounter << " of " << m_crWorkerInstances.size() << std::endl;
+    const unsigned int nWorkers(workerHitListPairs.size());
+    const unsigned int nThreads(LArParallelHelper::GetNThreads(m_nCRWorkerThreads, nWorkers));
 
-        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ProcessEvent(*pCRWorker));
-    }
+    if (m_printOverallRecoStatus && (nThreads > 1))
+        std::cout << "Running " << nWorkers << " cosmic-ray reconstruction worker instances using " << nThreads << " threads" << std::endl;
+
+    // ATTN Each worker instance owns a single LArTPC and only reads from the master instance, so workers can be processed concurrently.
+    // Status codes are collected per worker and examined in worker order, so the outcome matches that of the serial approach.
+    std::vector<StatusCode> statusCodes(nWorkers, STATUS_CODE_SUCCESS);
+    WorkerTimingVector workerTimings(nWorkers);
+
+    LArParallelHelper::ForEach(nWorkers, nThreads, [&](const unsigned int index) {
+        const Pandora *const pCRWorker(workerHitListPairs.at(index).first);
+
+        for (const CaloHit *const pCaloHit : *(workerHitListPairs.at(index).second))
+        {
+            statusCodes.at(index) = this->Copy(pCRWorker, pCaloHit);
+
+            if (STATUS_CODE_SUCCESS != statusCodes.at(index))
+                return;
+        }
+
+        if (m_printOverallRecoStatus && (1 == nThreads))
+            std::cout << "Running cosmic-ray reconstruction worker instance " << (index + 1) << " of " << m_crWorkerInstances.size() << std::endl;
+
+        const WorkerTiming workerTiming(COSMIC_RAY_WORKER, pCRWorker->GetGeometry()->GetLArTPC().GetLArTPCVolumeId(), -1,
+            workerHitListPairs.at(index).second->size());
+        statusCodes.at(index) = this->ProcessWorkerEvent(pCRWorker, workerTiming, workerTimings.at(index));
+    });
+
+    for (const StatusCode statusCode : statusCodes)
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, statusCode);
+
+    this->AddWorkerTimings(workerTimings);
 
     return STATUS_CODE_SUCCESS;
 }
@@ -331,6 +526,18 @@ StatusCode MasterAlgorithm::RecreateCosmicRayPfos(PfoToLArTPCMap &pfoToLArTPCMap
         PfoList newPfoList;
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->Recreate(*pCRPfos, newPfoList));
 
+        // ATTN Allow analyses to identify pfos from workers that stopped early at the event deadline
+        if (LArEventDeadlineHelper::WasDeadlineExceeded(*pCRWorker))
+        {
+            for (const Pfo *const pNewPfo : newPfoList)
+            {
+                PandoraContentApi::ParticleFlowObject::Metadata metadata;
+                metadata.m_propertiesToAdd["IsDeadlineExceeded"] = 1.f;
+                PANDORA_RETURN_RESULT_IF(
+                    STATUS_CODE_SUCCESS, !=, PandoraContentApi::ParticleFlowObject::AlterMetadata(*this, pNewPfo, metadata));
+            }
+        }
+
         const LArTPC &larTPC(pCRWorker->GetGeometry()->GetLArTPC());
 
         for (const Pfo *const pNewPfo : newPfoList)
@@ -387,9 +594,12 @@ StatusCode MasterAlgorithm::TagCosmicRayPfos(const PfoToFloatMap &stitchedPfosTo
     for (CosmicRayTaggingBaseTool *const pCosmicRayTaggingTool : m_cosmicRayTaggingToolVector)
         pCosmicRayTaggingTool->FindAmbiguousPfos(nonStitchedParentCosmicRayPfos, ambiguousPfos, this);
 
+    // ATTN Membership is tested for every recreated pfo, so use a set rather than searching the ambiguous pfo list each time
+    const PfoSet ambiguousPfoSet(ambiguousPfos.begin(), ambiguousPfos.end());
+
     for (const Pfo *const pPfo : nonStitchedParentCosmicRayPfos)
     {
-        const bool isClearCosmic(ambiguousPfos.end() == std::find(ambiguousPfos.begin(), ambiguousPfos.end(), pPfo));
+        const bool isClearCosmic(!ambiguousPfoSet.count(pPfo));
 
         if (isClearCosmic)
             clearCosmicRayPfos.push_back(pPfo);
@@ -397,7 +607,7 @@ StatusCode MasterAlgorithm::TagCosmicRayPfos(const PfoToFloatMap &stitchedPfosTo
 
     for (const Pfo *const pPfo : *pRecreatedCRPfos)
     {
-        const bool isClearCosmic(ambiguousPfos.end() == std::find(ambiguousPfos.begin(), ambiguousPfos.end(), pPfo));
+        const bool isClearCosmic(!ambiguousPfoSet.count(pPfo));
         PandoraContentApi::ParticleFlowObject::Metadata metadata;
         metadata.m_propertiesToAdd["IsClearCosmic"] = (isClearCosmic ? 1.f : 0.f);
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::ParticleFlowObject::AlterMetadata(*this, pPfo, metadata));
@@ -428,20 +638,26 @@ StatusCode MasterAlgorithm::RunCosmicRayHitRemoval(const PfoList &ambiguousPfos)
         // ATTN: If an ambiguous pfo has been stitched, reset the calo hit positions in preparation for subsequent algorithm chains
         if (LArStitchingHelper::HasPfoBeenStitched(pPfoToDelete))
         {
+            // ATTN A single pass over the pfo clusters, rather than one pass per view for each of the clustered and isolated hits
             CaloHitList caloHitList2D;
-            LArPfoHelper::GetCaloHits(pPfoToDelete, TPC_VIEW_U, caloHitList2D);
-            LArPfoHelper::GetCaloHits(pPfoToDelete, TPC_VIEW_V, caloHitList2D);
-            LArPfoHelper::GetCaloHits(pPfoToDelete, TPC_VIEW_W, caloHitList2D);
-            LArPfoHelper::GetIsolatedCaloHits(pPfoToDelete, TPC_VIEW_U, caloHitList2D);
-            LArPfoHelper::GetIsolatedCaloHits(pPfoToDelete, TPC_VIEW_V, caloHitList2D);
-            LArPfoHelper::GetIsolatedCaloHits(pPfoToDelete, TPC_VIEW_W, caloHitList2D);
 
-            for (const CaloHit *const pCaloHit : caloHitList2D)
+            for (const Cluster *const pCluster : clusterList)
             {
-                PandoraContentApi::CaloHit::Metadata metadata;
-                metadata.m_x0 = 0.f;
-                PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::CaloHit::AlterMetadata(*this, pCaloHit, metadata));
+                const HitType hitType(LArClusterHelper::GetClusterHitType(pCluster));
+
+                if ((TPC_VIEW_U != hitType) && (TPC_VIEW_V != hitType) && (TPC_VIEW_W != hitType))
+                    continue;
+
+                pCluster->GetOrderedCaloHitList().FillCaloHitList(caloHitList2D);
+                const CaloHitList &isolatedCaloHitList(pCluster->GetIsolatedCaloHitList());
+                caloHitList2D.insert(caloHitList2D.end(), isolatedCaloHitList.begin(), isolatedCaloHitList.end());
             }
+
+            PandoraContentApi::CaloHit::Metadata metadata;
+            metadata.m_x0 = 0.f;
+
+            for (const CaloHit *const pCaloHit : caloHitList2D)
+                PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::CaloHit::AlterMetadata(*this, pCaloHit, metadata));
         }
 
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::Delete(*this, pPfoToDelete));
@@ -456,20 +672,24 @@ StatusCode MasterAlgorithm::RunCosmicRayHitRemoval(const PfoList &ambiguousPfos)
 
 StatusCode MasterAlgorithm::RunSlicing(const VolumeIdToHitListMap &volumeIdToHitListMap, SliceVector &sliceVector) const
 {
+    unsigned int nSlicingHits(0);
+
     for (const VolumeIdToHitListMap::value_type &mapEntry : volumeIdToHitListMap)
     {
         for (const CaloHit *const pCaloHit : (m_shouldRemoveOutOfTimeHits ? mapEntry.second.m_truncatedHitList : mapEntry.second.m_allHitList))
         {
-            if (!PandoraContentApi::IsAvailable(*this, pCaloHit))
-                continue;
-
+            // ATTN The hit type test is a plain member access, so is made before the availability lookup in the master instance
             const HitType hitType(pCaloHit->GetHitType());
             if ((TPC_VIEW_U != hitType) && (TPC_VIEW_V != hitType) && (TPC_VIEW_W != hitType))
                 continue;
 
+            if (!PandoraContentApi::IsAvailable(*this, pCaloHit))
+                continue;
+
             if (m_shouldRunSlicing)
             {
                 PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->Copy(m_pSlicingWorkerInstance, pCaloHit));
+                ++nSlicingHits;
             }
             else
             {
@@ -485,8 +705,12 @@ StatusCode MasterAlgorithm::RunSlicing(const VolumeIdToHitListMap &volumeIdToHit
         if (m_printOverallRecoStatus)
             std::cout << "Running slicing worker instance" << std::endl;
 
+        WorkerTimingVector workerTimings(1);
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=,
+            this->ProcessWorkerEvent(m_pSlicingWorkerInstance, WorkerTiming(SLICING_WORKER, 0, -1, nSlicingHits), workerTimings.front()));
+        this->AddWorkerTimings(workerTimings);
+
         const PfoList *pSlicePfos(nullptr);
-        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ProcessEvent(*m_pSlicingWorkerInstance));
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::GetCurrentPfoList(*m_pSlicingWorkerInstance, pSlicePfos));
 
         if (m_visualizeOverallRecoStatus)
@@ -529,59 +753,92 @@ StatusCode MasterAlgorithm::RunSliceReconstruction(SliceVector &sliceVector, Sli
         selectedSliceVector = std::move(sliceVector);
     }
 
-    unsigned int sliceCounter(0);
+    const unsigned int nSlices(selectedSliceVector.size());
+    const unsigned int nSliceWorkers(std::max(1u, std::min(m_nSliceWorkerInstances, nSlices)));
+    const bool shouldPreClassify(
+        m_shouldRunNeutrinoRecoOption && m_shouldRunCosmicRecoOption && !m_slicePreClassificationToolVector.empty());
+    SliceHypotheses nuSlicePfos(nSlices), crSlicePfos(nSlices);
+    WorkerTimingVector nuWorkerTimings(nSlices), crWorkerTimings(nSlices);
+    std::vector<bool> shouldRunNuSlice(nSlices, m_shouldRunNeutrinoRecoOption), shouldRunDegradedNuSlice(nSlices, false);
 
-    for (const CaloHitList &sliceHits : selectedSliceVector)
+    std::vector<bool> isOverBudget(nSlices, false);
+    this->GetOverBudgetSlices(selectedSliceVector, isOverBudget);
+
+    if (m_printOverallRecoStatus && (nSliceWorkers > 1))
     {
-        for (const CaloHit *const pSliceCaloHit : sliceHits)
-        {
-            // ATTN Must ensure we copy the hit actually owned by master instance; access differs with/without slicing enabled
-            const CaloHit *const pCaloHitInMaster(m_shouldRunSlicing ? static_cast<const CaloHit *>(pSliceCaloHit->GetParentAddress()) : pSliceCaloHit);
+        std::cout << "Running slice reconstruction for " << nSlices << " slice(s) using " << nSliceWorkers << " worker instance pairs"
+                  << std::endl;
+    }
 
-            if (m_shouldRunNeutrinoRecoOption)
-                PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->Copy(m_pSliceNuWorkerInstance, pCaloHitInMaster));
+    if (m_shouldRunNeutrinoRecoOption && !shouldPreClassify)
+    {
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=,
+            this->RunSliceNuReconstruction(
+                selectedSliceVector, isOverBudget, shouldRunNuSlice, shouldRunDegradedNuSlice, nuSlicePfos, nuWorkerTimings));
+    }
 
-            if (m_shouldRunCosmicRecoOption)
-                PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->Copy(m_pSliceCRWorkerInstance, pCaloHitInMaster));
-        }
+    if (m_shouldRunCosmicRecoOption)
+    {
+        const std::vector<bool> shouldRunCRSlice(nSlices, true);
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=,
+            this->RunSliceWorkerPool(
+                m_sliceCRWorkerInstances, SLICE_CR_WORKER, selectedSliceVector, shouldRunCRSlice, crSlicePfos, crWorkerTimings));
+    }
+
+    // ATTN Slices identified as clear cosmic-rays by the cosmic-ray reconstruction take the cosmic-ray hypothesis as neutrino hypothesis
+    if (shouldPreClassify)
+    {
+        this->PreClassifySlices(selectedSliceVector, crSlicePfos, shouldRunNuSlice);
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=,
+            this->RunSliceNuReconstruction(
+                selectedSliceVector, isOverBudget, shouldRunNuSlice, shouldRunDegradedNuSlice, nuSlicePfos, nuWorkerTimings));
+    }
+
+    const bool isSlicingDeadlineExceeded(
+        m_shouldRunSlicing && m_pSlicingWorkerInstance && LArEventDeadlineHelper::WasDeadlineExceeded(*m_pSlicingWorkerInstance));
 
+    for (unsigned int sliceIndex = 0; sliceIndex < nSlices; ++sliceIndex)
+    {
         if (m_shouldRunNeutrinoRecoOption)
         {
-            if (m_printOverallRecoStatus)
-                std::cout << "Running nu worker instance for slice " << (sliceCounter + 1) << " of " << selectedSliceVector.size() << std::endl;
+            // ATTN Pre-classified or over-budget slices without neutrino reconstruction take the cosmic-ray hypothesis, so hits are kept
+            if (m_shouldRunCosmicRecoOption && !shouldRunNuSlice.at(sliceIndex) && !shouldRunDegradedNuSlice.at(sliceIndex))
+                nuSlicePfos.at(sliceIndex) = crSlicePfos.at(sliceIndex);
 
-            const PfoList *pSliceNuPfos(nullptr);
-            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ProcessEvent(*m_pSliceNuWorkerInstance));
-            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::GetCurrentPfoList(*m_pSliceNuWorkerInstance, pSliceNuPfos));
-            nuSliceHypotheses.push_back(*pSliceNuPfos);
+            nuSliceHypotheses.push_back(nuSlicePfos.at(sliceIndex));
 
-            for (const ParticleFlowObject *const pPfo : *pSliceNuPfos)
-            {
-                PandoraContentApi::ParticleFlowObject::Metadata metadata;
-                metadata.m_propertiesToAdd["SliceIndex"] = sliceCounter;
-                PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::ParticleFlowObject::AlterMetadata(*this, pPfo, metadata));
-            }
+            if (shouldRunNuSlice.at(sliceIndex) || shouldRunDegradedNuSlice.at(sliceIndex))
+                this->AddWorkerTimings(WorkerTimingVector(1, nuWorkerTimings.at(sliceIndex)));
         }
 
         if (m_shouldRunCosmicRecoOption)
         {
-            if (m_printOverallRecoStatus)
-                std::cout << "Running cr worker instance for slice " << (sliceCounter + 1) << " of " << selectedSliceVector.size() << std::endl;
+            crSliceHypotheses.push_back(crSlicePfos.at(sliceIndex));
+            this->AddWorkerTimings(WorkerTimingVector(1, crWorkerTimings.at(sliceIndex)));
+        }
 
-            const PfoList *pSliceCRPfos(nullptr);
-            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ProcessEvent(*m_pSliceCRWorkerInstance));
-            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::GetCurrentPfoList(*m_pSliceCRWorkerInstance, pSliceCRPfos));
-            crSliceHypotheses.push_back(*pSliceCRPfos);
+        for (const PfoList *const pSlicePfos : {&nuSlicePfos.at(sliceIndex), &crSlicePfos.at(sliceIndex)})
+        {
+            const bool isNuSlicePfos(pSlicePfos == &nuSlicePfos.at(sliceIndex));
+            const WorkerTiming &workerTiming(isNuSlicePfos ? nuWorkerTimings.at(sliceIndex) : crWorkerTimings.at(sliceIndex));
+            const bool isDeadlineExceeded(isSlicingDeadlineExceeded || workerTiming.m_isDeadlineExceeded);
 
-            for (const ParticleFlowObject *const pPfo : *pSliceCRPfos)
+            for (const ParticleFlowObject *const pPfo : *pSlicePfos)
             {
                 PandoraContentApi::ParticleFlowObject::Metadata metadata;
-                metadata.m_propertiesToAdd["SliceIndex"] = sliceCounter;
+                metadata.m_propertiesToAdd["SliceIndex"] = sliceIndex;
+
+                // ATTN Allow analyses to identify neutrino pfos from slices that received a degraded reconstruction within the budget
+                if (isNuSlicePfos && shouldRunDegradedNuSlice.at(sliceIndex))
+                    metadata.m_propertiesToAdd["IsDegradedReco"] = 1.f;
+
+                // ATTN Allow analyses to identify pfos from slices for which worker algorithms stopped early at the event deadline
+                if (isDeadlineExceeded)
+                    metadata.m_propertiesToAdd["IsDeadlineExceeded"] = 1.f;
+
                 PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::ParticleFlowObject::AlterMetadata(*this, pPfo, metadata));
             }
         }
-
-        ++sliceCounter;
     }
 
     // ATTN: If we swapped these objects at the start, be sure to swap them back in case we ever want to use sliceVector
@@ -597,6 +854,162 @@ StatusCode MasterAlgorithm::RunSliceReconstruction(SliceVector &sliceVector, Sli
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode MasterAlgorithm::RunSliceWorkerPool(const PandoraInstanceList &workerInstances, const WorkerStage workerStage,
+    const SliceVector &sliceVector, const std::vector<bool> &shouldProcessSlice, SliceHypotheses &slicePfos,
+    WorkerTimingVector &workerTimings) const
+{
+    const unsigned int nSlices(sliceVector.size());
+    const unsigned int nSliceWorkers(std::max(1u, std::min(static_cast<unsigned int>(workerInstances.size()), nSlices)));
+    const std::string workerName(SLICE_NU_WORKER == workerStage ? "nu" : "cr");
+    std::vector<StatusCode> statusCodes(nSlices, STATUS_CODE_SUCCESS);
+    std::atomic<unsigned int> nextSliceIndex(0);
+    std::atomic<bool> hasFailed(false);
+
+    // ATTN Each thread owns one slice worker from the pool, claiming the next slice whenever its worker is free, until any fails
+    LArParallelHelper::ForEach(nSliceWorkers, nSliceWorkers, [&](const unsigned int workerIndex) {
+        for (unsigned int sliceIndex = nextSliceIndex++; (sliceIndex < nSlices) && !hasFailed; sliceIndex = nextSliceIndex++)
+        {
+            if (!shouldProcessSlice.at(sliceIndex))
+            {
+                if (m_printOverallRecoStatus && (1 == nSliceWorkers))
+                {
+                    std::cout << "Skipping " << workerName << " worker instance for slice " << (sliceIndex + 1) << " of " << nSlices
+                              << std::endl;
+                }
+
+                continue;
+            }
+
+            if (m_printOverallRecoStatus && (1 == nSliceWorkers))
+            {
+                std::cout << "Running " << workerName << " worker instance for slice " << (sliceIndex + 1) << " of " << nSlices
+                          << std::endl;
+            }
+
+            const CaloHitList &sliceHits(sliceVector.at(sliceIndex));
+            const WorkerTiming workerTiming(workerStage, 0, sliceIndex, sliceHits.size());
+            statusCodes.at(sliceIndex) = this->RunSliceWorkerInstance(
+                workerInstances.at(workerIndex), sliceHits, workerTiming, slicePfos.at(sliceIndex), workerTimings.at(sliceIndex));
+
+            if (STATUS_CODE_SUCCESS != statusCodes.at(sliceIndex))
+                hasFailed = true;
+        }
+    });
+
+    for (const StatusCode statusCode : statusCodes)
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, statusCode);
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void MasterAlgorithm::GetOverBudgetSlices(const SliceVector &sliceVector, std::vector<bool> &isOverBudget) const
+{
+    unsigned int nEventHits(0);
+
+    for (const CaloHitList &sliceHits : sliceVector)
+        nEventHits += sliceHits.size();
+
+    const float eventTime(std::chrono::duration<float>(std::chrono::steady_clock::now() - m_eventStartTime).count());
+    const bool isEventOverBudget(
+        (nEventHits > m_maxEventHitsForFullReco) || (eventTime > m_maxEventTimeForFullReco) || (eventTime > m_maxEventTime));
+    unsigned int nOverBudgetSlices(0);
+
+    for (unsigned int sliceIndex = 0, nSlices = sliceVector.size(); sliceIndex < nSlices; ++sliceIndex)
+    {
+        isOverBudget.at(sliceIndex) = isEventOverBudget || (sliceVector.at(sliceIndex).size() > m_maxSliceHitsForFullReco);
+
+        if (isOverBudget.at(sliceIndex))
+            ++nOverBudgetSlices;
+    }
+
+    if (m_printOverallRecoStatus && (nOverBudgetSlices > 0))
+    {
+        std::cout << "Event has " << nEventHits << " slice hits after " << eventTime << " s, " << nOverBudgetSlices << " of "
+                  << sliceVector.size() << " slice(s) over budget for full reconstruction" << std::endl;
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode MasterAlgorithm::RunSliceNuReconstruction(const SliceVector &sliceVector, const std::vector<bool> &isOverBudget,
+    std::vector<bool> &shouldRunNuSlice, std::vector<bool> &shouldRunDegradedNuSlice, SliceHypotheses &nuSlicePfos,
+    WorkerTimingVector &nuWorkerTimings) const
+{
+    // ATTN Without a degraded neutrino worker instance, over-budget slices take the cosmic-ray hypothesis, else receive full reconstruction
+    const bool canSkipOverBudgetSlices(m_pSliceNuDegradedWorkerInstance || m_shouldRunCosmicRecoOption);
+    bool shouldRunDegradedPool(false);
+
+    for (unsigned int sliceIndex = 0, nSlices = sliceVector.size(); sliceIndex < nSlices; ++sliceIndex)
+    {
+        if (!canSkipOverBudgetSlices || !shouldRunNuSlice.at(sliceIndex) || !isOverBudget.at(sliceIndex))
+            continue;
+
+        shouldRunNuSlice.at(sliceIndex) = false;
+        shouldRunDegradedNuSlice.at(sliceIndex) = (nullptr != m_pSliceNuDegradedWorkerInstance);
+        shouldRunDegradedPool = shouldRunDegradedPool || shouldRunDegradedNuSlice.at(sliceIndex);
+    }
+
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=,
+        this->RunSliceWorkerPool(m_sliceNuWorkerInstances, SLICE_NU_WORKER, sliceVector, shouldRunNuSlice, nuSlicePfos, nuWorkerTimings));
+
+    if (shouldRunDegradedPool)
+    {
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=,
+            this->RunSliceWorkerPool(PandoraInstanceList(1, m_pSliceNuDegradedWorkerInstance), SLICE_NU_WORKER, sliceVector,
+                shouldRunDegradedNuSlice, nuSlicePfos, nuWorkerTimings));
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void MasterAlgorithm::PreClassifySlices(
+    const SliceVector &sliceVector, const SliceHypotheses &crSlicePfos, std::vector<bool> &shouldRunNuSlice) const
+{
+    unsigned int nSkippedSlices(0);
+
+    for (unsigned int sliceIndex = 0, nSlices = sliceVector.size(); sliceIndex < nSlices; ++sliceIndex)
+    {
+        for (SlicePreClassificationBaseTool *const pSlicePreClassificationTool : m_slicePreClassificationToolVector)
+        {
+            if (pSlicePreClassificationTool->IsClearCosmicRaySlice(this, sliceVector.at(sliceIndex), crSlicePfos.at(sliceIndex)))
+            {
+                shouldRunNuSlice.at(sliceIndex) = false;
+                ++nSkippedSlices;
+                break;
+            }
+        }
+    }
+
+    if (m_printOverallRecoStatus)
+        std::cout << "Pre-classified " << nSkippedSlices << " of " << sliceVector.size() << " slice(s) as clear cosmic-rays" << std::endl;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode MasterAlgorithm::RunSliceWorkerInstance(const Pandora *const pSliceWorker, const CaloHitList &sliceHits,
+    const WorkerTiming &inputWorkerTiming, PfoList &slicePfos, WorkerTiming &workerTiming) const
+{
+    for (const CaloHit *const pSliceCaloHit : sliceHits)
+    {
+        // ATTN Must ensure we copy the hit actually owned by master instance; access differs with/without slicing enabled
+        const CaloHit *const pCaloHitInMaster(m_shouldRunSlicing ? static_cast<const CaloHit *>(pSliceCaloHit->GetParentAddress()) : pSliceCaloHit);
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->Copy(pSliceWorker, pCaloHitInMaster));
+    }
+
+    const PfoList *pWorkerPfos(nullptr);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ProcessWorkerEvent(pSliceWorker, inputWorkerTiming, workerTiming));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::GetCurrentPfoList(*pSliceWorker, pWorkerPfos));
+    slicePfos = *pWorkerPfos;
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode MasterAlgorithm::SelectBestSliceHypotheses(const SliceHypotheses &nuSliceHypotheses, const SliceHypotheses &crSliceHypotheses) const
 {
     if (m_printOverallRecoStatus)
@@ -625,25 +1038,149 @@ StatusCode MasterAlgorithm::SelectBestSliceHypotheses(const SliceHypotheses &nuS
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode MasterAlgorithm::ProcessWorkerEvent(
+    const Pandora *const pWorker, const WorkerTiming &inputWorkerTiming, WorkerTiming &workerTiming) const
+{
+    // ATTN Setting the deadline afresh for each call clears any record of an earlier call from a pooled worker exceeding the deadline
+    if (m_maxEventTime < std::numeric_limits<float>::max())
+        LArEventDeadlineHelper::SetDeadline(*pWorker, m_eventDeadline);
+
+    if (!m_shouldRecordWorkerTimings)
+    {
+        const StatusCode statusCode(PandoraApi::ProcessEvent(*pWorker));
+        workerTiming.m_isDeadlineExceeded = LArEventDeadlineHelper::WasDeadlineExceeded(*pWorker);
+
+        return statusCode;
+    }
+
+    const std::chrono::steady_clock::time_point startTime(std::chrono::steady_clock::now());
+    const StatusCode statusCode(PandoraApi::ProcessEvent(*pWorker));
+    const std::chrono::steady_clock::time_point endTime(std::chrono::steady_clock::now());
+
+    workerTiming = inputWorkerTiming;
+    workerTiming.m_wallTime = std::chrono::duration<float>(endTime - startTime).count();
+    workerTiming.m_isDeadlineExceeded = LArEventDeadlineHelper::WasDeadlineExceeded(*pWorker);
+
+    const PfoList *pPfoList(nullptr);
+    if ((STATUS_CODE_SUCCESS == statusCode) && (STATUS_CODE_SUCCESS == PandoraApi::GetCurrentPfoList(*pWorker, pPfoList)) && pPfoList)
+        workerTiming.m_nOutputPfos = pPfoList->size();
+
+    return statusCode;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void MasterAlgorithm::AddWorkerTimings(const WorkerTimingVector &workerTimings) const
+{
+    if (m_shouldRecordWorkerTimings)
+        m_workerTimings.insert(m_workerTimings.end(), workerTimings.begin(), workerTimings.end());
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void MasterAlgorithm::ReportWorkerTimings()
+{
+    float totalWallTime(0.f);
+
+    for (const WorkerTiming &workerTiming : m_workerTimings)
+    {
+        totalWallTime += workerTiming.m_wallTime;
+
+        if (m_printOverallRecoStatus)
+        {
+            std::cout << "MasterAlgorithm: event " << m_eventNumber << ", worker stage " << workerTiming.m_workerStage << ", volume "
+                      << workerTiming.m_volumeId << ", slice " << workerTiming.m_sliceIndex << ", hits " << workerTiming.m_nInputHits
+                      << ", pfos " << workerTiming.m_nOutputPfos << ", wall time " << workerTiming.m_wallTime << " s"
+                      << (workerTiming.m_isDeadlineExceeded ? ", stopped at deadline" : "") << std::endl;
+        }
+
+#ifdef MONITORING
+        if (m_writeWorkerTimingsTree)
+        {
+            const int workerStage(workerTiming.m_workerStage), volumeId(workerTiming.m_volumeId), sliceIndex(workerTiming.m_sliceIndex);
+            const int nInputHits(workerTiming.m_nInputHits), nOutputPfos(workerTiming.m_nOutputPfos), eventNumber(m_eventNumber);
+            const int isDeadlineExceeded(workerTiming.m_isDeadlineExceeded ? 1 : 0);
+            const float wallTime(workerTiming.m_wallTime);
+
+            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_workerTimingsTreeName.c_str(), "eventNumber", eventNumber));
+            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_workerTimingsTreeName.c_str(), "workerStage", workerStage));
+            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_workerTimingsTreeName.c_str(), "volumeId", volumeId));
+            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_workerTimingsTreeName.c_str(), "sliceIndex", sliceIndex));
+            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_workerTimingsTreeName.c_str(), "nInputHits", nInputHits));
+            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_workerTimingsTreeName.c_str(), "nOutputPfos", nOutputPfos));
+            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_workerTimingsTreeName.c_str(), "wallTime", wallTime));
+            PANDORA_MONITORING_API(
+                SetTreeVariable(this->GetPandora(), m_workerTimingsTreeName.c_str(), "isDeadlineExceeded", isDeadlineExceeded));
+            PANDORA_MONITORING_API(FillTree(this->GetPandora(), m_workerTimingsTreeName.c_str()));
+        }
+#endif
+    }
+
+    if (m_printOverallRecoStatus)
+    {
+        std::cout << "MasterAlgorithm: event " << m_eventNumber << ", " << m_workerTimings.size()
+                  << " worker calls, total worker wall time " << totalWallTime << " s" << std::endl;
+    }
+
+    m_workerTimings.clear();
+    ++m_eventNumber;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode MasterAlgorithm::Reset()
 {
+    m_mcWeightsMap.clear();
+    m_workerTimings.clear();
+    m_workerCaloHitMemoryRecord.Clear();
+    m_workerMCParticleMemoryRecord.Clear();
+    MasterAlgorithm::ResetHelpers(this->GetPandora());
+
     for (const Pandora *const pCRWorker : m_crWorkerInstances)
+    {
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Reset(*pCRWorker));
+        MasterAlgorithm::ResetHelpers(*pCRWorker);
+    }
 
     if (m_pSlicingWorkerInstance)
+    {
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Reset(*m_pSlicingWorkerInstance));
+        MasterAlgorithm::ResetHelpers(*m_pSlicingWorkerInstance);
+    }
 
-    if (m_pSliceNuWorkerInstance)
-        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Reset(*m_pSliceNuWorkerInstance));
+    for (const Pandora *const pSliceNuWorker : m_sliceNuWorkerInstances)
+    {
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Reset(*pSliceNuWorker));
+        MasterAlgorithm::ResetHelpers(*pSliceNuWorker);
+    }
 
-    if (m_pSliceCRWorkerInstance)
-        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Reset(*m_pSliceCRWorkerInstance));
+    for (const Pandora *const pSliceCRWorker : m_sliceCRWorkerInstances)
+    {
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Reset(*pSliceCRWorker));
+        MasterAlgorithm::ResetHelpers(*pSliceCRWorker);
+    }
+
+    if (m_pSliceNuDegradedWorkerInstance)
+    {
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Reset(*m_pSliceNuDegradedWorkerInstance));
+        MasterAlgorithm::ResetHelpers(*m_pSliceNuDegradedWorkerInstance);
+    }
 
     return STATUS_CODE_SUCCESS;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void MasterAlgorithm::ResetHelpers(const Pandora &pandora)
+{
+    LArCheatingIndexHelper::Reset(pandora);
+    LArEventDeadlineHelper::Reset(pandora);
+    LArGeometryHelper::Reset(pandora);
+    LArSlidingFitCacheHelper::Reset(pandora);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode MasterAlgorithm::Copy(const Pandora *const pPandora, const CaloHit *const pCaloHit) const
 {
     const LArCaloHit *const pLArCaloHit{dynamic_cast<const LArCaloHit *>(pCaloHit)};
@@ -655,18 +1192,40 @@ StatusCode MasterAlgorithm::Copy(const Pandora *const pPandora, const CaloHit *c
     LArCaloHitParameters parameters;
     pLArCaloHit->FillParameters(parameters);
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::CaloHit::Create(*pPandora, parameters, m_larCaloHitFactory));
+    m_workerCaloHitMemoryRecord.Allocate(sizeof(LArCaloHit));
 
-    if (m_passMCParticlesToWorkerInstances)
+    if (m_passMCParticlesToWorkerInstances && m_mcWorkerInstanceSet.count(pPandora))
     {
-        MCParticleVector mcParticleVector;
-        for (const auto &weightMapEntry : pLArCaloHit->GetMCParticleWeightMap())
-            mcParticleVector.push_back(weightMapEntry.first);
-        std::sort(mcParticleVector.begin(), mcParticleVector.end(), LArMCParticleHelper::SortByMomentum);
+        const std::size_t mcWeightBytes(LArMemoryAccountingHelper::GetNodeBytes<MCParticleWeightMap::value_type>());
+
+        // ATTN Use the ordered mc weights prepared once per event, rather than sorting the weight map for every worker instance
+        const CaloHitToMCWeightsMap::const_iterator mcWeightsIter(m_mcWeightsMap.find(pCaloHit));
 
-        for (const MCParticle *const pMCParticle : mcParticleVector)
+        if (m_mcWeightsMap.end() != mcWeightsIter)
         {
-            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=,
-                PandoraApi::SetCaloHitToMCParticleRelationship(*pPandora, pLArCaloHit, pMCParticle, pLArCaloHit->GetMCParticleWeightMap().at(pMCParticle)));
+            const MCWeightVector &mcWeightVector(mcWeightsIter->second);
+            m_workerCaloHitMemoryRecord.Allocate(mcWeightVector.size() * mcWeightBytes);
+
+            for (const MCWeightVector::value_type &mcWeight : mcWeightVector)
+            {
+                PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=,
+                    PandoraApi::SetCaloHitToMCParticleRelationship(*pPandora, pLArCaloHit, mcWeight.first, mcWeight.second));
+            }
+        }
+        else
+        {
+            MCParticleVector mcParticleVector;
+            for (const auto &weightMapEntry : pLArCaloHit->GetMCParticleWeightMap())
+                mcParticleVector.push_back(weightMapEntry.first);
+            std::sort(mcParticleVector.begin(), mcParticleVector.end(), LArMCParticleHelper::SortByMomentum);
+            m_workerCaloHitMemoryRecord.Allocate(mcParticleVector.size() * mcWeightBytes);
+
+            for (const MCParticle *const pMCParticle : mcParticleVector)
+            {
+                PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=,
+                    PandoraApi::SetCaloHitToMCParticleRelationship(
+                        *pPandora, pLArCaloHit, pMCParticle, pLArCaloHit->GetMCParticleWeightMap().at(pMCParticle)));
+            }
         }
     }
 
@@ -688,6 +1247,7 @@ StatusCode MasterAlgorithm::Copy(const Pandora *const pPandora, const MCParticle
     LArMCParticleParameters parameters;
     pLArMCParticle->FillParameters(parameters);
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::MCParticle::Create(*pPandora, parameters, *pMCParticleFactory));
+    m_workerMCParticleMemoryRecord.Allocate(sizeof(LArMCParticle));
 
     for (const MCParticle *const pDaughterMCParticle : pMCParticle->GetDaughterList())
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::SetMCParentDaughterRelationship(*pPandora, pMCParticle, pDaughterMCParticle));
@@ -1175,6 +1735,28 @@ StatusCode MasterAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
         }
     }
 
+    {
+        AlgorithmToolVector algorithmToolVector;
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=,
+            XmlHelper::ProcessAlgorithmToolList(*this, xmlHandle, "SlicePreClassificationTools", algorithmToolVector));
+
+        for (AlgorithmTool *const pAlgorithmTool : algorithmToolVector)
+        {
+            SlicePreClassificationBaseTool *const pSlicePreClassificationTool(
+                dynamic_cast<SlicePreClassificationBaseTool *>(pAlgorithmTool));
+            if (!pSlicePreClassificationTool)
+                return STATUS_CODE_INVALID_PARAMETER;
+            m_slicePreClassificationToolVector.push_back(pSlicePreClassificationTool);
+        }
+    }
+
+    if (!m_slicePreClassificationToolVector.empty() && (!m_shouldRunNeutrinoRecoOption || !m_shouldRunCosmicRecoOption))
+    {
+        std::cout << "MasterAlgorithm::ReadSettings - SlicePreClassificationTools require both neutrino and cosmic reconstruction options"
+                  << std::endl;
+        return STATUS_CODE_INVALID_PARAMETER;
+    }
+
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=,
         this->ReadExternalSettings(pExternalParameters, !pExternalParameters ? InputBool() : pExternalParameters->m_printOverallRecoStatus,
             xmlHandle, "PrintOverallRecoStatus", m_printOverallRecoStatus));
@@ -1194,6 +1776,44 @@ StatusCode MasterAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
         XmlHelper::ReadValue(xmlHandle, "PassMCParticlesToWorkerInstances", m_passMCParticlesToWorkerInstances));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "NCRWorkerThreads", m_nCRWorkerThreads));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "NSliceWorkerInstances", m_nSliceWorkerInstances));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
+        XmlHelper::ReadValue(xmlHandle, "ValidateParallelExecution", m_validateParallelExecution));
+
+    if (m_validateParallelExecution)
+        LArParallelHelper::SetValidationMode(true);
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
+        XmlHelper::ReadValue(xmlHandle, "ShouldShareWorkerXmlDocuments", m_shouldShareWorkerXmlDocuments));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
+        XmlHelper::ReadValue(xmlHandle, "ShouldRecordWorkerTimings", m_shouldRecordWorkerTimings));
+
+    if (m_shouldRecordWorkerTimings)
+    {
+        PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
+            XmlHelper::ReadValue(xmlHandle, "WriteWorkerTimingsTree", m_writeWorkerTimingsTree));
+
+        if (m_writeWorkerTimingsTree)
+        {
+            PANDORA_RETURN_RESULT_IF(
+                STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "WorkerTimingsFileName", m_workerTimingsFileName));
+            PANDORA_RETURN_RESULT_IF(
+                STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "WorkerTimingsTreeName", m_workerTimingsTreeName));
+        }
+    }
+
+    if (0 == m_nSliceWorkerInstances)
+    {
+        std::cout << "MasterAlgorithm::ReadSettings - NSliceWorkerInstances must be at least one" << std::endl;
+        return STATUS_CODE_INVALID_PARAMETER;
+    }
+
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
         XmlHelper::ReadValue(xmlHandle, "FilePathEnvironmentVariable", m_filePathEnvironmentVariable));
 
@@ -1204,9 +1824,39 @@ StatusCode MasterAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
     m_nuSettingsFile = LArFileHelper::FindFileInPath(m_nuSettingsFile, m_filePathEnvironmentVariable);
     m_slicingSettingsFile = LArFileHelper::FindFileInPath(m_slicingSettingsFile, m_filePathEnvironmentVariable);
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
+        XmlHelper::ReadValue(xmlHandle, "DegradedNuSettingsFile", m_degradedNuSettingsFile));
+
+    if (!m_degradedNuSettingsFile.empty())
+        m_degradedNuSettingsFile = LArFileHelper::FindFileInPath(m_degradedNuSettingsFile, m_filePathEnvironmentVariable);
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
+        XmlHelper::ReadValue(xmlHandle, "MaxEventHitsForFullReco", m_maxEventHitsForFullReco));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
+        XmlHelper::ReadValue(xmlHandle, "MaxSliceHitsForFullReco", m_maxSliceHitsForFullReco));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
+        XmlHelper::ReadValue(xmlHandle, "MaxEventTimeForFullReco", m_maxEventTimeForFullReco));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "MaxEventTime", m_maxEventTime));
+
     if (m_passMCParticlesToWorkerInstances)
     {
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "InputMCParticleListName", m_inputMCParticleListName));
+
+        PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
+            XmlHelper::ReadValue(xmlHandle, "PassMCParticlesToCRWorkers", m_passMCParticlesToCRWorkers));
+
+        PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
+            XmlHelper::ReadValue(xmlHandle, "PassMCParticlesToSlicingWorker", m_passMCParticlesToSlicingWorker));
+
+        PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
+            XmlHelper::ReadValue(xmlHandle, "PassMCParticlesToSliceNuWorkers", m_passMCParticlesToSliceNuWorkers));
+
+        PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
+            XmlHelper::ReadValue(xmlHandle, "PassMCParticlesToSliceCRWorkers", m_passMCParticlesToSliceCRWorkers));
     }
 
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "InputHitListName", m_inputHitListName));
@@ -12,9 +12,14 @@
 #include "Pandora/ExternallyConfiguredAlgorithm.h"
 
 #include "larpandoracontent/LArControlFlow/MultiPandoraApi.h"
+
+#include "larpandoracontent/LArHelpers/LArMemoryAccountingHelper.h"
+
 #include "larpandoracontent/LArObjects/LArCaloHit.h"
 
+#include <chrono>
 #include <unordered_map>
+#include <unordered_set>
 
 namespace lar_content
 {
@@ -23,6 +28,7 @@ class StitchingBaseTool;
 class CosmicRayTaggingBaseTool;
 class SliceIdBaseTool;
 class SliceSelectionBaseTool;
+class SlicePreClassificationBaseTool;
 class LArMCParticleFactory;
 
 typedef std::vector<pandora::CaloHitList> SliceVector;
@@ -43,6 +49,11 @@ public:
      */
     MasterAlgorithm();
 
+    /**
+     *  @brief  Destructor
+     */
+    ~MasterAlgorithm();
+
     /**
      *  @brief  External steering parameters class
      */
@@ -70,6 +81,15 @@ public:
      */
     void ShiftPfoHierarchy(const pandora::ParticleFlowObject *const pParentPfo, const PfoToLArTPCMap &pfoToLArTPCMap, const float x0) const;
 
+    /**
+     *  @brief  Shift a number of pfo hierarchies, each by its own x0 value. All parent pfos are checked and the objects of all hierarchies
+     *          collected before any shift is applied.
+     *
+     *  @param  parentPfoToX0Map the mapping from each parent pfo to the x0 correction for its hierarchy
+     *  @param  pfoToLArTPCMap the pfo to lar tpc map
+     */
+    void ShiftPfoHierarchies(const PfoToFloatMap &parentPfoToX0Map, const PfoToLArTPCMap &pfoToLArTPCMap) const;
+
     /**
      *  @brief  Stitch together a pair of pfos
      *
@@ -93,6 +113,52 @@ protected:
 
     typedef std::map<unsigned int, LArTPCHitList> VolumeIdToHitListMap;
 
+    /**
+     *  @brief  The worker instance stages
+     */
+    enum WorkerStage
+    {
+        COSMIC_RAY_WORKER,
+        SLICING_WORKER,
+        SLICE_NU_WORKER,
+        SLICE_CR_WORKER,
+        UNKNOWN_WORKER
+    };
+
+    /**
+     *  @brief  WorkerTiming class, recording the cost and outcome of a single worker instance event processing call
+     */
+    class WorkerTiming
+    {
+    public:
+        /**
+         *  @brief  Default constructor
+         */
+        WorkerTiming();
+
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  workerStage the worker stage
+         *  @param  volumeId the lar tpc volume id handled by the worker
+         *  @param  sliceIndex the slice index (-1 if not applicable)
+         *  @param  nInputHits the number of hits provided to the worker
+         */
+        WorkerTiming(const WorkerStage workerStage, const unsigned int volumeId, const int sliceIndex, const unsigned int nInputHits);
+
+        WorkerStage m_workerStage;  ///< The worker stage
+        unsigned int m_volumeId;    ///< The lar tpc volume id handled by the worker
+        int m_sliceIndex;           ///< The slice index (-1 if not applicable)
+        unsigned int m_nInputHits;  ///< The number of hits provided to the worker
+        unsigned int m_nOutputPfos; ///< The number of pfos in the worker output list
+        float m_wallTime;           ///< The wall time for the worker to process the event, in seconds
+        bool m_isDeadlineExceeded;  ///< Whether worker algorithms stopped early at the event deadline
+    };
+
+    typedef std::vector<WorkerTiming> WorkerTimingVector;
+    typedef std::vector<std::pair<const pandora::MCParticle *, float>> MCWeightVector;
+    typedef std::unordered_map<const pandora::CaloHit *, MCWeightVector> CaloHitToMCWeightsMap;
+
     pandora::StatusCode Run();
 
     /**
@@ -101,10 +167,16 @@ protected:
     pandora::StatusCode InitializeWorkerInstances();
 
     /**
-     *  @brief  Copy mc particles in the named input list to all pandora worker instances
+     *  @brief  Copy mc particles in the named input list to all pandora worker instances configured to receive mc information
      */
     pandora::StatusCode CopyMCParticles() const;
 
+    /**
+     *  @brief  Prepare, once per event, the mc particle weights for each input hit, ordered by mc particle momentum, for reuse whenever
+     *          that hit is copied to a worker instance
+     */
+    pandora::StatusCode FillMCWeightTable();
+
     /**
      *  @brief  Get the mapping from lar tpc volume id to lists of all hits, and truncated hits
      *
@@ -168,6 +240,87 @@ protected:
      */
     pandora::StatusCode RunSliceReconstruction(SliceVector &sliceVector, SliceHypotheses &nuSliceHypotheses, SliceHypotheses &crSliceHypotheses) const;
 
+    /**
+     *  @brief  Run a pool of slice worker instances over the selected slices, each worker instance on its own thread
+     *
+     *  @param  workerInstances the pool of slice worker instances
+     *  @param  workerStage the reconstruction stage performed by the pool
+     *  @param  sliceVector the slice vector
+     *  @param  shouldProcessSlice whether each slice should be processed by the pool
+     *  @param  slicePfos to receive the list of pfos produced for each slice
+     *  @param  workerTimings to receive the worker timing record for each slice
+     */
+    pandora::StatusCode RunSliceWorkerPool(const PandoraInstanceList &workerInstances, const WorkerStage workerStage,
+        const SliceVector &sliceVector, const std::vector<bool> &shouldProcessSlice, SliceHypotheses &slicePfos,
+        WorkerTimingVector &workerTimings) const;
+
+    /**
+     *  @brief  Identify the slices that exceed the hit or time budget for full reconstruction, all slices being over budget if the event
+     *          as a whole exceeds the budget
+     *
+     *  @param  sliceVector the slice vector
+     *  @param  isOverBudget to receive whether each slice is over budget
+     */
+    void GetOverBudgetSlices(const SliceVector &sliceVector, std::vector<bool> &isOverBudget) const;
+
+    /**
+     *  @brief  Run the neutrino slice reconstruction, routing over-budget slices to the degraded neutrino worker instance (if present)
+     *
+     *  @param  sliceVector the slice vector
+     *  @param  isOverBudget whether each slice is over the budget for full reconstruction
+     *  @param  shouldRunNuSlice whether the full neutrino slice reconstruction should be run for each slice, updated for over-budget slices
+     *  @param  shouldRunDegradedNuSlice to receive whether the degraded neutrino slice reconstruction has been run for each slice
+     *  @param  nuSlicePfos to receive the list of pfos produced for each slice
+     *  @param  nuWorkerTimings to receive the worker timing record for each slice
+     */
+    pandora::StatusCode RunSliceNuReconstruction(const SliceVector &sliceVector, const std::vector<bool> &isOverBudget,
+        std::vector<bool> &shouldRunNuSlice, std::vector<bool> &shouldRunDegradedNuSlice, SliceHypotheses &nuSlicePfos,
+        WorkerTimingVector &nuWorkerTimings) const;
+
+    /**
+     *  @brief  Identify the slices that are clearly cosmic-ray muons, using the outcome of the cosmic-ray slice reconstruction
+     *
+     *  @param  sliceVector the slice vector
+     *  @param  crSlicePfos the list of pfos produced by the cosmic-ray slice reconstruction for each slice
+     *  @param  shouldRunNuSlice to receive whether the neutrino slice reconstruction should be run for each slice
+     */
+    void PreClassifySlices(const SliceVector &sliceVector, const SliceHypotheses &crSlicePfos, std::vector<bool> &shouldRunNuSlice) const;
+
+    /**
+     *  @brief  Copy the hits for a single slice to a slice worker instance and run the worker reconstruction
+     *
+     *  @param  pSliceWorker the address of the slice worker instance
+     *  @param  sliceHits the list of hits in the slice
+     *  @param  inputWorkerTiming the description of the worker call
+     *  @param  slicePfos to receive the list of pfos produced by the worker instance for this slice
+     *  @param  workerTiming to receive the worker timing record
+     */
+    pandora::StatusCode RunSliceWorkerInstance(const pandora::Pandora *const pSliceWorker, const pandora::CaloHitList &sliceHits,
+        const WorkerTiming &inputWorkerTiming, pandora::PfoList &slicePfos, WorkerTiming &workerTiming) const;
+
+    /**
+     *  @brief  Process the event in a worker instance, subject to any event deadline, recording its wall time and output pfo count if
+     *          configured to do so
+     *
+     *  @param  pWorker the address of the worker instance
+     *  @param  inputWorkerTiming the description of the worker call
+     *  @param  workerTiming to receive the worker timing record
+     */
+    pandora::StatusCode ProcessWorkerEvent(
+        const pandora::Pandora *const pWorker, const WorkerTiming &inputWorkerTiming, WorkerTiming &workerTiming) const;
+
+    /**
+     *  @brief  Append worker timing records to the list for the current event, if configured to record them
+     *
+     *  @param  workerTimings the worker timing records
+     */
+    void AddWorkerTimings(const WorkerTimingVector &workerTimings) const;
+
+    /**
+     *  @brief  Print and/or write the per-event summary of worker timing records, then clear the records
+     */
+    void ReportWorkerTimings();
+
     /**
      *  @brief  Examine slice hypotheses to identify the most appropriate to provide in final event output
      *
@@ -181,6 +334,13 @@ protected:
      */
     pandora::StatusCode Reset();
 
+    /**
+     *  @brief  Reset the per-event helper caches held for a pandora instance
+     *
+     *  @param  pandora the pandora instance
+     */
+    static void ResetHelpers(const pandora::Pandora &pandora);
+
     /**
      *  @brief  Copy a specified calo hit to the provided pandora instance
      *
@@ -324,26 +484,60 @@ protected:
 
     PandoraInstanceList m_crWorkerInstances;          ///< The list of cosmic-ray reconstruction worker instances
     const pandora::Pandora *m_pSlicingWorkerInstance; ///< The slicing worker instance
-    const pandora::Pandora *m_pSliceNuWorkerInstance; ///< The per-slice neutrino reconstruction worker instance
-    const pandora::Pandora *m_pSliceCRWorkerInstance; ///< The per-slice cosmic-ray reconstruction worker instance
+    const pandora::Pandora *m_pSliceNuWorkerInstance; ///< The first per-slice neutrino reconstruction worker instance
+    const pandora::Pandora *m_pSliceCRWorkerInstance; ///< The first per-slice cosmic-ray reconstruction worker instance
+    PandoraInstanceList m_sliceNuWorkerInstances;     ///< The pool of per-slice neutrino reconstruction worker instances
+    PandoraInstanceList m_sliceCRWorkerInstances;     ///< The pool of per-slice cosmic-ray reconstruction worker instances
+
+    const pandora::Pandora *m_pSliceNuDegradedWorkerInstance; ///< The per-slice neutrino worker instance for slices over budget (optional)
 
     bool m_fullWidthCRWorkerWireGaps;        ///< Whether wire-type line gaps in cosmic-ray worker instances should cover all drift time
     bool m_passMCParticlesToWorkerInstances; ///< Whether to pass mc particle details (and links to calo hits) to worker instances
+    unsigned int m_nCRWorkerThreads;         ///< The number of threads for the per-LArTPC cosmic-ray workers (1 for serial, 0 for all cores)
+    unsigned int m_nSliceWorkerInstances;    ///< The number of slice worker instances per hypothesis, each run on its own thread
+    bool m_validateParallelExecution;        ///< Whether to check multi-threaded transforms against serial evaluation
+    bool m_shouldShareWorkerXmlDocuments;    ///< Whether to parse each xml file read during worker creation once, sharing the result
+    bool m_passMCParticlesToCRWorkers;       ///< Whether to pass mc particles to the per-LArTPC cosmic-ray worker instances
+    bool m_passMCParticlesToSlicingWorker;   ///< Whether to pass mc particles to the slicing worker instance
+    bool m_passMCParticlesToSliceNuWorkers;  ///< Whether to pass mc particles to the per-slice neutrino worker instances
+    bool m_passMCParticlesToSliceCRWorkers;  ///< Whether to pass mc particles to the per-slice cosmic-ray worker instances
+
+    typedef std::unordered_set<const pandora::Pandora *> PandoraInstanceSet;
+
+    PandoraInstanceList m_mcWorkerInstances;  ///< The worker instances requiring mc particles, in order of creation
+    PandoraInstanceSet m_mcWorkerInstanceSet; ///< The worker instances requiring mc particles, for fast lookup during hit copying
+
+    unsigned int m_maxEventHitsForFullReco;                 ///< The maximum number of slice hits in an event for full reconstruction
+    unsigned int m_maxSliceHitsForFullReco;                 ///< The maximum number of hits in a slice for full reconstruction
+    float m_maxEventTimeForFullReco;                        ///< The maximum event time, in s, at the start of slice reconstruction
+    float m_maxEventTime;                                   ///< The event time, in s, after which worker algorithms stop iterating early
+    std::chrono::steady_clock::time_point m_eventStartTime; ///< The time at which processing of the current event started
+    std::chrono::steady_clock::time_point m_eventDeadline;  ///< The time after which worker algorithms stop iterating early
+
+    bool m_shouldRecordWorkerTimings;           ///< Whether to record wall time, hit and pfo counts for each worker call
+    bool m_writeWorkerTimingsTree;              ///< Whether to write the worker timing records to a monitoring tree
+    std::string m_workerTimingsFileName;        ///< The worker timings output file name
+    std::string m_workerTimingsTreeName;        ///< The worker timings output tree name
+    unsigned int m_eventNumber;                 ///< The event number, for worker timing records
+    mutable WorkerTimingVector m_workerTimings; ///< The worker timing records for the current event
 
     typedef std::vector<StitchingBaseTool *> StitchingToolVector;
     typedef std::vector<CosmicRayTaggingBaseTool *> CosmicRayTaggingToolVector;
     typedef std::vector<SliceIdBaseTool *> SliceIdToolVector;
     typedef std::vector<SliceSelectionBaseTool *> SliceSelectionToolVector;
+    typedef std::vector<SlicePreClassificationBaseTool *> SlicePreClassificationToolVector;
 
-    StitchingToolVector m_stitchingToolVector;               ///< The stitching tool vector
-    CosmicRayTaggingToolVector m_cosmicRayTaggingToolVector; ///< The cosmic-ray tagging tool vector
-    SliceIdToolVector m_sliceIdToolVector;                   ///< The slice id tool vector
-    SliceSelectionToolVector m_sliceSelectionToolVector;     ///< The slice selection tool vector
+    StitchingToolVector m_stitchingToolVector;                           ///< The stitching tool vector
+    CosmicRayTaggingToolVector m_cosmicRayTaggingToolVector;             ///< The cosmic-ray tagging tool vector
+    SliceIdToolVector m_sliceIdToolVector;                               ///< The slice id tool vector
+    SliceSelectionToolVector m_sliceSelectionToolVector;                 ///< The slice selection tool vector
+    SlicePreClassificationToolVector m_slicePreClassificationToolVector; ///< The slice pre-classification tool vector
 
     std::string m_filePathEnvironmentVariable; ///< The environment variable providing a list of paths to xml files
     std::string m_crSettingsFile;              ///< The cosmic-ray reconstruction settings file
     std::string m_nuSettingsFile;              ///< The neutrino reconstruction settings file
     std::string m_slicingSettingsFile;         ///< The slicing settings file
+    std::string m_degradedNuSettingsFile;      ///< The neutrino reconstruction settings file for over-budget slices (optional)
 
     std::string m_inputMCParticleListName;  ///< The input mc particle list name
     std::string m_inputHitListName;         ///< The input hit list name
@@ -353,8 +547,39 @@ protected:
 
     float m_inTimeMaxX0;                   ///< Cut on X0 to determine whether particle is clear cosmic ray
     LArCaloHitFactory m_larCaloHitFactory; ///< Factory for creating LArCaloHits during hit copying
+    CaloHitToMCWeightsMap m_mcWeightsMap;  ///< The per-event mc particle weights for the input hits, by momentum, used in hit copying
+
+    mutable LArMemoryAccountingHelper::MemoryRecord m_workerCaloHitMemoryRecord;    ///< The memory accounting record for worker hit copies
+    mutable LArMemoryAccountingHelper::MemoryRecord m_workerMCParticleMemoryRecord; ///< The memory accounting record for worker mc copies
 };
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline MasterAlgorithm::WorkerTiming::WorkerTiming() :
+    m_workerStage(UNKNOWN_WORKER),
+    m_volumeId(0),
+    m_sliceIndex(-1),
+    m_nInputHits(0),
+    m_nOutputPfos(0),
+    m_wallTime(0.f),
+    m_isDeadlineExceeded(false)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline MasterAlgorithm::WorkerTiming::WorkerTiming(
+    const WorkerStage workerStage, const unsigned int volumeId, const int sliceIndex, const unsigned int nInputHits) :
+    m_workerStage(workerStage),
+    m_volumeId(volumeId),
+    m_sliceIndex(sliceIndex),
+    m_nInputHits(nInputHits),
+    m_nOutputPfos(0),
+    m_wallTime(0.f),
+    m_isDeadlineExceeded(false)
+{
+}
+
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -436,6 +661,28 @@ public:
     virtual void SelectSlices(const pandora::Algorithm *const pAlgorithm, const SliceVector &inputSliceVector, SliceVector &outputSliceVector) = 0;
 };
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  SlicePreClassificationBaseTool class
+ */
+class SlicePreClassificationBaseTool : public pandora::AlgorithmTool
+{
+public:
+    /**
+     *  @brief  Whether a slice is so clearly a cosmic-ray muon that its neutrino reconstruction need not be run
+     *
+     *  @param  pAlgorithm the address of the master instance
+     *  @param  sliceHits the list of hits in the slice
+     *  @param  crSlicePfos the parent pfos representing the cosmic-ray muon outcome for the slice
+     *
+     *  @return boolean
+     */
+    virtual bool IsClearCosmicRaySlice(
+        const pandora::Algorithm *const pAlgorithm, const pandora::CaloHitList &sliceHits, const pandora::PfoList &crSlicePfos) = 0;
+};
+
 } // namespace lar_content
 
 #endif // #ifndef LAR_MASTER_ALGORITHM_H
@@ -33,9 +33,18 @@ public:
     /**
      *  @brief  Get the pandora instance map
      *
-     *  @return the pandora instance map
+     *  @return a copy of the pandora instance map, safe against concurrent declaration or deletion of instances
      */
-    static const PandoraInstanceMap &GetPandoraInstanceMap();
+    static PandoraInstanceMap GetPandoraInstanceMap();
+
+    /**
+     *  @brief  Whether a given pandora instance has been declared as a primary pandora instance
+     *
+     *  @param  pPandora the address of the pandora instance
+     *
+     *  @return boolean
+     */
+    static bool IsPrimaryPandoraInstance(const pandora::Pandora *const pPandora);
 
     /**
      *  @brief  Get the address of the pandora instance associated with a given primary pandora instance and volume id number
@@ -52,9 +61,9 @@ public:
      *
      *  @param  pPrimaryPandora the address of the primary pandora instance
      *
-     *  @return the daughter pandora instance list
+     *  @return a copy of the daughter pandora instance list, safe against concurrent declaration or deletion of instances
      */
-    static const PandoraInstanceList &GetDaughterPandoraInstanceList(const pandora::Pandora *const pPrimaryPandora);
+    static PandoraInstanceList GetDaughterPandoraInstanceList(const pandora::Pandora *const pPrimaryPandora);
 
     /**
      *  @brief  Get the address of the primary pandora instance associated with a given daughter pandora instance
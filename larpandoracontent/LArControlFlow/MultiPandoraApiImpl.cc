@@ -11,49 +11,55 @@
 
 #include "larpandoracontent/LArControlFlow/MultiPandoraApiImpl.h"
 
-const PandoraInstanceMap &MultiPandoraApiImpl::GetPandoraInstanceMap() const
+#include <mutex>
+
+PandoraInstanceMap MultiPandoraApiImpl::GetPandoraInstanceMap() const
 {
+    const std::shared_lock<std::shared_mutex> lock(m_mutex);
     return m_primaryToDaughtersMap;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+bool MultiPandoraApiImpl::IsPrimaryPandoraInstance(const pandora::Pandora *const pPandora) const
+{
+    const std::shared_lock<std::shared_mutex> lock(m_mutex);
+    return (m_primaryToDaughtersMap.count(pPandora) > 0);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 const pandora::Pandora *MultiPandoraApiImpl::GetPandoraInstance(const pandora::Pandora *const pPrimaryPandora, const unsigned int volumeId) const
 {
-    PandoraInstanceList instanceList(this->GetDaughterPandoraInstanceList(pPrimaryPandora));
-    instanceList.push_back(pPrimaryPandora);
+    const std::shared_lock<std::shared_mutex> lock(m_mutex);
 
-    for (const pandora::Pandora *const pPandora : instanceList)
+    unsigned int instanceVolumeId(0);
+
+    for (const pandora::Pandora *const pPandora : this->GetDaughterPandoraInstanceListUnlocked(pPrimaryPandora))
     {
-        try
-        {
-            if (volumeId == this->GetVolumeId(pPandora))
-                return pPandora;
-        }
-        catch (const pandora::StatusCodeException &)
-        {
-        }
+        if (this->GetVolumeIdUnlocked(pPandora, instanceVolumeId) && (volumeId == instanceVolumeId))
+            return pPandora;
     }
 
+    if (this->GetVolumeIdUnlocked(pPrimaryPandora, instanceVolumeId) && (volumeId == instanceVolumeId))
+        return pPrimaryPandora;
+
     throw pandora::StatusCodeException(pandora::STATUS_CODE_NOT_FOUND);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-const PandoraInstanceList &MultiPandoraApiImpl::GetDaughterPandoraInstanceList(const pandora::Pandora *const pPrimaryPandora) const
+PandoraInstanceList MultiPandoraApiImpl::GetDaughterPandoraInstanceList(const pandora::Pandora *const pPrimaryPandora) const
 {
-    PandoraInstanceMap::const_iterator iter = m_primaryToDaughtersMap.find(pPrimaryPandora);
-
-    if (m_primaryToDaughtersMap.end() == iter)
-        throw pandora::StatusCodeException(pandora::STATUS_CODE_NOT_FOUND);
-
-    return iter->second;
+    const std::shared_lock<std::shared_mutex> lock(m_mutex);
+    return this->GetDaughterPandoraInstanceListUnlocked(pPrimaryPandora);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 const pandora::Pandora *MultiPandoraApiImpl::GetPrimaryPandoraInstance(const pandora::Pandora *const pDaughterPandora) const
 {
+    const std::shared_lock<std::shared_mutex> lock(m_mutex);
     PandoraRelationMap::const_iterator iter = m_daughterToPrimaryMap.find(pDaughterPandora);
 
     if (m_daughterToPrimaryMap.end() == iter)
@@ -66,18 +72,21 @@ const pandora::Pandora *MultiPandoraApiImpl::GetPrimaryPandoraInstance(const pan
 
 unsigned int MultiPandoraApiImpl::GetVolumeId(const pandora::Pandora *const pPandora) const
 {
-    PandoraToVolumeIdMap::const_iterator iter = m_pandoraToVolumeIdMap.find(pPandora);
+    const std::shared_lock<std::shared_mutex> lock(m_mutex);
+    unsigned int volumeId(0);
 
-    if (m_pandoraToVolumeIdMap.end() == iter)
+    if (!this->GetVolumeIdUnlocked(pPandora, volumeId))
         throw pandora::StatusCodeException(pandora::STATUS_CODE_NOT_FOUND);
 
-    return iter->second;
+    return volumeId;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void MultiPandoraApiImpl::SetVolumeId(const pandora::Pandora *const pPandora, const unsigned int volumeId)
 {
+    const std::unique_lock<std::shared_mutex> lock(m_mutex);
+
     if (m_pandoraToVolumeIdMap.count(pPandora))
         throw pandora::StatusCodeException(pandora::STATUS_CODE_ALREADY_PRESENT);
 
@@ -87,6 +96,31 @@ void MultiPandoraApiImpl::SetVolumeId(const pandora::Pandora *const pPandora, co
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+const PandoraInstanceList &MultiPandoraApiImpl::GetDaughterPandoraInstanceListUnlocked(const pandora::Pandora *const pPrimaryPandora) const
+{
+    PandoraInstanceMap::const_iterator iter = m_primaryToDaughtersMap.find(pPrimaryPandora);
+
+    if (m_primaryToDaughtersMap.end() == iter)
+        throw pandora::StatusCodeException(pandora::STATUS_CODE_NOT_FOUND);
+
+    return iter->second;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool MultiPandoraApiImpl::GetVolumeIdUnlocked(const pandora::Pandora *const pPandora, unsigned int &volumeId) const
+{
+    PandoraToVolumeIdMap::const_iterator iter = m_pandoraToVolumeIdMap.find(pPandora);
+
+    if (m_pandoraToVolumeIdMap.end() == iter)
+        return false;
+
+    volumeId = iter->second;
+    return true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 MultiPandoraApiImpl::MultiPandoraApiImpl()
 {
 }
@@ -96,7 +130,7 @@ MultiPandoraApiImpl::MultiPandoraApiImpl()
 MultiPandoraApiImpl::~MultiPandoraApiImpl()
 {
     // ATTN This is a copy of the input map, which will be modified by calls to delete pandora instances
-    PandoraInstanceMap pandoraInstanceMap(m_primaryToDaughtersMap);
+    const PandoraInstanceMap pandoraInstanceMap(this->GetPandoraInstanceMap());
 
     for (const auto &mapElement : pandoraInstanceMap)
         this->DeletePandoraInstances(mapElement.first);
@@ -106,6 +140,8 @@ MultiPandoraApiImpl::~MultiPandoraApiImpl()
 
 void MultiPandoraApiImpl::AddPrimaryPandoraInstance(const pandora::Pandora *const pPrimaryPandora)
 {
+    const std::unique_lock<std::shared_mutex> lock(m_mutex);
+
     if (!m_primaryToDaughtersMap.insert(PandoraInstanceMap::value_type(pPrimaryPandora, PandoraInstanceList())).second)
         throw pandora::StatusCodeException(pandora::STATUS_CODE_ALREADY_PRESENT);
 }
@@ -114,6 +150,7 @@ void MultiPandoraApiImpl::AddPrimaryPandoraInstance(const pandora::Pandora *cons
 
 void MultiPandoraApiImpl::AddDaughterPandoraInstance(const pandora::Pandora *const pPrimaryPandora, const pandora::Pandora *const pDaughterPandora)
 {
+    const std::unique_lock<std::shared_mutex> lock(m_mutex);
     PandoraInstanceMap::iterator iter = m_primaryToDaughtersMap.find(pPrimaryPandora);
 
     if (m_primaryToDaughtersMap.end() == iter)
@@ -131,23 +168,30 @@ void MultiPandoraApiImpl::DeletePandoraInstances(const pandora::Pandora *const p
 {
     PandoraInstanceList pandoraInstanceList;
 
-    try
-    {
-        pandoraInstanceList = this->GetDaughterPandoraInstanceList(pPrimaryPandora);
-    }
-    catch (const pandora::StatusCodeException &)
     {
-        std::cout << "MultiPandoraApiImpl::DeletePandoraInstances - unable to find daughter instances associated with primary "
-                  << pPrimaryPandora << std::endl;
-    }
+        const std::unique_lock<std::shared_mutex> lock(m_mutex);
 
-    pandoraInstanceList.push_back(pPrimaryPandora);
-    m_primaryToDaughtersMap.erase(pPrimaryPandora);
+        try
+        {
+            pandoraInstanceList = this->GetDaughterPandoraInstanceListUnlocked(pPrimaryPandora);
+        }
+        catch (const pandora::StatusCodeException &)
+        {
+            std::cout << "MultiPandoraApiImpl::DeletePandoraInstances - unable to find daughter instances associated with primary "
+                      << pPrimaryPandora << std::endl;
+        }
 
+        pandoraInstanceList.push_back(pPrimaryPandora);
+        m_primaryToDaughtersMap.erase(pPrimaryPandora);
+
+        for (const pandora::Pandora *const pPandora : pandoraInstanceList)
+        {
+            m_pandoraToVolumeIdMap.erase(pPandora);
+            m_daughterToPrimaryMap.erase(pPandora);
+        }
+    }
+
+    // ATTN Instances are deleted outside the lock, in case their destruction makes further use of the book-keeping
     for (const pandora::Pandora *const pPandora : pandoraInstanceList)
-    {
-        m_pandoraToVolumeIdMap.erase(pPandora);
-        m_daughterToPrimaryMap.erase(pPandora);
         delete pPandora;
-    }
 }
@@ -13,10 +13,13 @@
 #include "larpandoracontent/LArControlFlow/MultiPandoraApi.h"
 
 #include <map>
+#include <shared_mutex>
 #include <unordered_map>
 
 /**
- *  @brief  MultiPandoraApiImpl class
+ *  @brief  MultiPandoraApiImpl class. All book-keeping is guarded by a reader-writer lock, so that instances may be declared and
+ *          deleted from concurrent threads (e.g. one primary instance per event, per thread), whilst concurrent lookups only share
+ *          the lock and never block one another.
  */
 class MultiPandoraApiImpl
 {
@@ -34,9 +37,18 @@ private:
     /**
      *  @brief  Get the pandora instance map
      *
-     *  @return the pandora instance map
+     *  @return a copy of the pandora instance map
      */
-    const PandoraInstanceMap &GetPandoraInstanceMap() const;
+    PandoraInstanceMap GetPandoraInstanceMap() const;
+
+    /**
+     *  @brief  Whether a given pandora instance has been declared as a primary pandora instance
+     *
+     *  @param  pPandora the address of the pandora instance
+     *
+     *  @return boolean
+     */
+    bool IsPrimaryPandoraInstance(const pandora::Pandora *const pPandora) const;
 
     /**
      *  @brief  Get the address of the pandora instance associated with a given primary pandora instance and volume id number
@@ -53,9 +65,9 @@ private:
      *
      *  @param  pPrimaryPandora the address of the primary pandora instance
      *
-     *  @return the daughter pandora instance list
+     *  @return a copy of the daughter pandora instance list
      */
-    const PandoraInstanceList &GetDaughterPandoraInstanceList(const pandora::Pandora *const pPrimaryPandora) const;
+    PandoraInstanceList GetDaughterPandoraInstanceList(const pandora::Pandora *const pPrimaryPandora) const;
 
     /**
      *  @brief  Get the address of the primary pandora instance associated with a given daughter pandora instance
@@ -105,12 +117,32 @@ private:
      */
     void SetVolumeId(const pandora::Pandora *const pPandora, const unsigned int volumeId);
 
+    /**
+     *  @brief  Get the list of daughter pandora instances associated with a given primary pandora instance, without locking
+     *
+     *  @param  pPrimaryPandora the address of the primary pandora instance
+     *
+     *  @return the daughter pandora instance list
+     */
+    const PandoraInstanceList &GetDaughterPandoraInstanceListUnlocked(const pandora::Pandora *const pPrimaryPandora) const;
+
+    /**
+     *  @brief  Get the volume id associated with a given pandora instance, without locking
+     *
+     *  @param  pPandora the address of the pandora instance
+     *  @param  volumeId to receive the volume id
+     *
+     *  @return whether a volume id has been set for the pandora instance
+     */
+    bool GetVolumeIdUnlocked(const pandora::Pandora *const pPandora, unsigned int &volumeId) const;
+
     typedef std::unordered_map<const pandora::Pandora *, const pandora::Pandora *> PandoraRelationMap;
     typedef std::unordered_map<const pandora::Pandora *, unsigned int> PandoraToVolumeIdMap;
 
     PandoraInstanceMap m_primaryToDaughtersMap;  ///< The map from primary pandora instance to list of daughter pandora instances
     PandoraRelationMap m_daughterToPrimaryMap;   ///< The map from daughter pandora instance to primary pandora instance
     PandoraToVolumeIdMap m_pandoraToVolumeIdMap; ///< The map from pandora instance to volume id
+    mutable std::shared_mutex m_mutex;           ///< The reader-writer lock guarding the book-keeping maps
 
     friend class MultiPandoraApi;
 };
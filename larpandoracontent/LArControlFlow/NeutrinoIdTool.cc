@@ -41,6 +41,15 @@ NeutrinoIdTool<T>::NeutrinoIdTool() :
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+template <typename T>
+NeutrinoIdTool<T>::~NeutrinoIdTool()
+{
+    if (m_useTrainingMode && (STATUS_CODE_SUCCESS != LArMvaHelper::FlushTrainingExamples()))
+        std::cout << "NeutrinoIdTool: Unable to flush training examples" << std::endl;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template <typename T>
 void NeutrinoIdTool<T>::SelectOutputPfos(const Algorithm *const pAlgorithm, const SliceHypotheses &nuSliceHypotheses,
     const SliceHypotheses &crSliceHypotheses, PfoList &selectedPfos)
@@ -246,11 +255,14 @@ template <typename T>
 void NeutrinoIdTool<T>::SelectPfosByProbability(const pandora::Algorithm *const pAlgorithm, const SliceHypotheses &nuSliceHypotheses,
     const SliceHypotheses &crSliceHypotheses, const SliceFeaturesVector &sliceFeaturesVector, PfoList &selectedPfos) const
 {
+    FloatVector nuProbabilities;
+    this->GetNeutrinoProbabilities(nuSliceHypotheses.size(), sliceFeaturesVector, nuProbabilities);
+
     // Calculate the probability of each slice that passes the minimum probability cut
     std::vector<UintFloatPair> sliceIndexProbabilityPairs;
     for (unsigned int sliceIndex = 0, nSlices = nuSliceHypotheses.size(); sliceIndex < nSlices; ++sliceIndex)
     {
-        const float nuProbability(sliceFeaturesVector.at(sliceIndex).GetNeutrinoProbability(m_mva));
+        const float nuProbability(nuProbabilities.at(sliceIndex));
 
         for (const ParticleFlowObject *const pPfo : crSliceHypotheses.at(sliceIndex))
         {
@@ -316,6 +328,46 @@ void NeutrinoIdTool<T>::SelectPfosByProbability(const pandora::Algorithm *const
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+template <typename T>
+void NeutrinoIdTool<T>::GetNeutrinoProbabilities(
+    const unsigned int nSlices, const SliceFeaturesVector &sliceFeaturesVector, FloatVector &nuProbabilities) const
+{
+    LArMvaHelper::MvaFeatureMatrix featureMatrix;
+
+    for (unsigned int sliceIndex = 0; sliceIndex < nSlices; ++sliceIndex)
+    {
+        const SliceFeatures &sliceFeatures(sliceFeaturesVector.at(sliceIndex));
+
+        if (!sliceFeatures.IsFeatureVectorAvailable())
+            continue;
+
+        featureMatrix.push_back(LArMvaHelper::MvaFeatureVector());
+        sliceFeatures.GetFeatureVector(featureMatrix.back());
+    }
+
+    LArMvaHelper::DoubleVector probabilities;
+    LArMvaHelper::CalculateProbabilities(m_mva, featureMatrix, probabilities);
+
+    if (probabilities.size() != featureMatrix.size())
+        throw StatusCodeException(STATUS_CODE_FAILURE);
+
+    unsigned int exampleIndex(0);
+
+    for (unsigned int sliceIndex = 0; sliceIndex < nSlices; ++sliceIndex)
+    {
+        // ATTN if one or more of the features can not be calculated, then default to calling the slice a cosmic ray
+        if (!sliceFeaturesVector.at(sliceIndex).IsFeatureVectorAvailable())
+        {
+            nuProbabilities.push_back(0.f);
+            continue;
+        }
+
+        nuProbabilities.push_back(static_cast<float>(probabilities.at(exampleIndex++)));
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template <typename T>
 void NeutrinoIdTool<T>::SelectPfos(const PfoList &pfos, PfoList &selectedPfos) const
 {
@@ -476,20 +528,6 @@ void NeutrinoIdTool<T>::SliceFeatures::GetFeatureMap(LArMvaHelper::DoubleMap &fe
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-template <typename T>
-float NeutrinoIdTool<T>::SliceFeatures::GetNeutrinoProbability(const T &t) const
-{
-    // ATTN if one or more of the features can not be calculated, then default to calling the slice a cosmic ray
-    if (!this->IsFeatureVectorAvailable())
-        return 0.f;
-
-    LArMvaHelper::MvaFeatureVector featureVector;
-    this->GetFeatureVector(featureVector);
-    return LArMvaHelper::CalculateProbability(t, featureVector);
-}
-
-//------------------------------------------------------------------------------------------------------------------------------------------
-
 template <typename T>
 const ParticleFlowObject *NeutrinoIdTool<T>::SliceFeatures::GetNeutrino(const PfoList &nuPfos) const
 {
@@ -559,7 +597,7 @@ CartesianVector NeutrinoIdTool<T>::SliceFeatures::GetDirection(const CartesianPo
     const LArTPC *const pFirstLArTPC(m_pTool->GetPandora().GetGeometry()->GetLArTPCMap().begin()->second);
     const float layerPitch(pFirstLArTPC->GetWirePitchW());
 
-    const ThreeDSlidingFitResult fit(&spacePoints, 5, layerPitch);
+    const ThreeDSlidingFitResult fit(&spacePoints, 5, layerPitch, ThreeDSlidingFitResult::ENDPOINTS_ONLY);
     const CartesianVector endMin(fit.GetGlobalMinLayerPosition());
     const CartesianVector endMax(fit.GetGlobalMaxLayerPosition());
     const CartesianVector dirMin(fit.GetGlobalMinLayerDirection());
@@ -37,6 +37,11 @@ public:
      */
     NeutrinoIdTool();
 
+    /**
+     *  @brief  Destructor, flushing any buffered training examples
+     */
+    ~NeutrinoIdTool();
+
     void SelectOutputPfos(const pandora::Algorithm *const pAlgorithm, const SliceHypotheses &nuSliceHypotheses,
         const SliceHypotheses &crSliceHypotheses, pandora::PfoList &selectedPfos);
 
@@ -77,15 +82,6 @@ private:
          */
         void GetFeatureMap(LArMvaHelper::DoubleMap &featureMap) const;
 
-        /**
-         *  @brief  Get the probability that this slice contains a neutrino interaction
-         *
-         *  @param  t the MVA used to calculate the probability
-         *
-         *  @return the probability that the slice contains a neutrino interaction
-         */
-        float GetNeutrinoProbability(const T &t) const;
-
     private:
         /**
          *  @brief  Get the recontructed neutrino the input list of neutrino Pfos
@@ -245,6 +241,16 @@ private:
     void SelectPfosByProbability(const pandora::Algorithm *const pAlgorithm, const SliceHypotheses &nuSliceHypotheses,
         const SliceHypotheses &crSliceHypotheses, const SliceFeaturesVector &sliceFeaturesVector, pandora::PfoList &selectedPfos) const;
 
+    /**
+     *  @brief  Get the probability that each slice contains a neutrino interaction, scoring all slices in a single call to the mva
+     *
+     *  @param  nSlices the number of slices
+     *  @param  sliceFeaturesVector vector holding the slice features
+     *  @param  nuProbabilities to receive the neutrino probability for each slice, in slice order
+     */
+    void GetNeutrinoProbabilities(
+        const unsigned int nSlices, const SliceFeaturesVector &sliceFeaturesVector, pandora::FloatVector &nuProbabilities) const;
+
     /**
      *  @brief  Add the given pfos to the selected Pfo list
      *
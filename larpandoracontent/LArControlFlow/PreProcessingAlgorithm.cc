@@ -10,9 +10,13 @@
 
 #include "larpandoracontent/LArControlFlow/PreProcessingAlgorithm.h"
 
+#include "larpandoracontent/LArHelpers/LArCheatingIndexHelper.h"
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
+#include "larpandoracontent/LArHelpers/LArParallelHelper.h"
+#include "larpandoracontent/LArHelpers/LArSlidingFitCacheHelper.h"
+#include "larpandoracontent/LArHelpers/LArSpatialIndexHelper.h"
 
-#include "larpandoracontent/LArUtility/KDTreeLinkerAlgoT.h"
+#include "larpandoracontent/LArUtility/KDTreeImplicitAlgoT.h"
 
 using namespace pandora;
 
@@ -25,6 +29,7 @@ PreProcessingAlgorithm::PreProcessingAlgorithm() :
     m_maxCellLengthScale(3.f),
     m_searchRegion1D(0.1f),
     m_maxEventHits(std::numeric_limits<unsigned int>::max()),
+    m_nFilteringThreads(1),
     m_onlyAvailableCaloHits(true),
     m_inputCaloHitListName("Input")
 {
@@ -35,6 +40,9 @@ PreProcessingAlgorithm::PreProcessingAlgorithm() :
 StatusCode PreProcessingAlgorithm::Reset()
 {
     m_processedHits.clear();
+    LArSlidingFitCacheHelper::Reset(this->GetPandora());
+    LArSpatialIndexHelper::Reset(this->GetPandora());
+    LArCheatingIndexHelper::Reset(this->GetPandora());
     return STATUS_CODE_SUCCESS;
 }
 
@@ -135,10 +143,27 @@ void PreProcessingAlgorithm::ProcessCaloHits()
         }
     }
 
-    CaloHitList filteredCaloHitListU, filteredCaloHitListV, filteredCaloHitListW;
-    this->GetFilteredCaloHitList(selectedCaloHitListU, filteredCaloHitListU);
-    this->GetFilteredCaloHitList(selectedCaloHitListV, filteredCaloHitListV);
-    this->GetFilteredCaloHitList(selectedCaloHitListW, filteredCaloHitListW);
+    const std::vector<const CaloHitList *> selectedCaloHitLists{&selectedCaloHitListU, &selectedCaloHitListV, &selectedCaloHitListW};
+    std::vector<CaloHitList> filteredCaloHitLists(selectedCaloHitLists.size());
+    UIntVector nDuplicateHits(selectedCaloHitLists.size(), 0);
+
+    // ATTN Each view is filtered independently and without use of the pandora api, so the views may be processed in parallel
+    LArParallelHelper::ForEach(selectedCaloHitLists.size(), m_nFilteringThreads, [&](const unsigned int index) {
+        this->GetFilteredCaloHitList(*selectedCaloHitLists.at(index), filteredCaloHitLists.at(index), nDuplicateHits.at(index));
+    });
+
+    if (PandoraContentApi::GetSettings(*this)->ShouldDisplayAlgorithmInfo())
+    {
+        for (const unsigned int nDuplicates : nDuplicateHits)
+        {
+            for (unsigned int iDuplicate = 0; iDuplicate < nDuplicates; ++iDuplicate)
+                std::cout << "PreProcessingAlgorithm: found two hits in same location, will remove lowest pulse height" << std::endl;
+        }
+    }
+
+    const CaloHitList &filteredCaloHitListU(filteredCaloHitLists.at(0));
+    const CaloHitList &filteredCaloHitListV(filteredCaloHitLists.at(1));
+    const CaloHitList &filteredCaloHitListW(filteredCaloHitLists.at(2));
 
     CaloHitList filteredInputList;
     filteredInputList.insert(filteredInputList.end(), filteredCaloHitListU.begin(), filteredCaloHitListU.end());
@@ -186,21 +211,32 @@ void PreProcessingAlgorithm::PopulateVoidCaloHitLists() noexcept
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void PreProcessingAlgorithm::GetFilteredCaloHitList(const CaloHitList &inputList, CaloHitList &outputList)
+void PreProcessingAlgorithm::GetFilteredCaloHitList(
+    const CaloHitList &inputList, CaloHitList &outputList, unsigned int &nDuplicateHits) const
 {
+    nDuplicateHits = 0;
+
+    if (inputList.empty())
+        return;
+
     HitKDTree2D kdTree;
     HitKDNode2DList hitKDNode2DList;
 
-    KDTreeBox hitsBoundingRegion2D = fill_and_bound_2d_kd_tree(inputList, hitKDNode2DList);
-    kdTree.build(hitKDNode2DList, hitsBoundingRegion2D);
+    (void)fill_and_bound_2d_kd_tree(inputList, hitKDNode2DList);
+    kdTree.build(hitKDNode2DList);
+
+    // Set of output hits used for fast look-up, the output list itself retaining the input ordering
+    CaloHitSet outputHits;
 
     // Remove hits that are in the same physical location!
+    HitKDNode2DList found;
+
     for (const CaloHit *const pCaloHit1 : inputList)
     {
         bool isUnique(true);
         KDTreeBox searchRegionHits(build_2d_kd_search_region(pCaloHit1, m_searchRegion1D, m_searchRegion1D));
 
-        HitKDNode2DList found;
+        found.clear();
         kdTree.search(searchRegionHits, found);
 
         for (const auto &hit : found)
@@ -217,8 +253,7 @@ void PreProcessingAlgorithm::GetFilteredCaloHitList(const CaloHitList &inputList
                 const float deltaMip(pCaloHit2->GetMipEquivalentEnergy() > pCaloHit1->GetMipEquivalentEnergy());
 
                 if ((deltaMip > std::numeric_limits<float>::epsilon()) ||
-                    ((std::fabs(deltaMip) < std::numeric_limits<float>::epsilon()) &&
-                        (outputList.end() != std::find(outputList.begin(), outputList.end(), pCaloHit2))))
+                    ((std::fabs(deltaMip) < std::numeric_limits<float>::epsilon()) && outputHits.count(pCaloHit2)))
                 {
                     isUnique = false;
                     break;
@@ -229,11 +264,11 @@ void PreProcessingAlgorithm::GetFilteredCaloHitList(const CaloHitList &inputList
         if (isUnique)
         {
             outputList.push_back(pCaloHit1);
+            (void)outputHits.insert(pCaloHit1);
         }
         else
         {
-            if (PandoraContentApi::GetSettings(*this)->ShouldDisplayAlgorithmInfo())
-                std::cout << "PreProcessingAlgorithm: found two hits in same location, will remove lowest pulse height" << std::endl;
+            ++nDuplicateHits;
         }
     }
 }
@@ -255,6 +290,9 @@ StatusCode PreProcessingAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
 
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "MaxEventHits", m_maxEventHits));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "NFilteringThreads", m_nFilteringThreads));
+
     PANDORA_RETURN_RESULT_IF_AND_IF(
         STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "OnlyAvailableCaloHits", m_onlyAvailableCaloHits));
 
@@ -14,7 +14,7 @@ namespace lar_content
 {
 
 template <typename, unsigned int>
-class KDTreeLinkerAlgo;
+class KDTreeImplicitAlgo;
 template <typename, unsigned int>
 class KDTreeNodeInfoT;
 
@@ -32,7 +32,7 @@ public:
     PreProcessingAlgorithm();
 
 private:
-    typedef KDTreeLinkerAlgo<const pandora::CaloHit *, 2> HitKDTree2D;
+    typedef KDTreeImplicitAlgo<const pandora::CaloHit *, 2> HitKDTree2D;
     typedef KDTreeNodeInfoT<const pandora::CaloHit *, 2> HitKDNode2D;
     typedef std::vector<HitKDNode2D> HitKDNode2DList;
 
@@ -51,12 +51,14 @@ private:
     void PopulateVoidCaloHitLists() noexcept;
 
     /**
-     *  @brief Clean up the input CaloHitList
+     *  @brief Clean up the input CaloHitList, without use of the pandora api, so that lists may be cleaned concurrently
      *
      *  @param inputList the input CaloHitList
      *  @param outputList the output CaloHitList
+     *  @param nDuplicateHits to receive the number of hits removed for sharing a location with another hit
      */
-    void GetFilteredCaloHitList(const pandora::CaloHitList &inputList, pandora::CaloHitList &outputList);
+    void GetFilteredCaloHitList(
+        const pandora::CaloHitList &inputList, pandora::CaloHitList &outputList, unsigned int &nDuplicateHits) const;
 
     /**
      *  @brief Build separate MCParticleLists for each view
@@ -65,11 +67,12 @@ private:
 
     pandora::CaloHitSet m_processedHits; ///< The set of all previously processed calo hits
 
-    float m_mipEquivalentCut;    ///< Minimum mip equivalent energy for calo hit
-    float m_minCellLengthScale;  ///< The minimum length scale for calo hit
-    float m_maxCellLengthScale;  ///< The maximum length scale for calo hit
-    float m_searchRegion1D;      ///< Search region, applied to each dimension, for look-up from kd-trees
-    unsigned int m_maxEventHits; ///< The maximum number of hits in an event to proceed with the reconstruction
+    float m_mipEquivalentCut;         ///< Minimum mip equivalent energy for calo hit
+    float m_minCellLengthScale;       ///< The minimum length scale for calo hit
+    float m_maxCellLengthScale;       ///< The maximum length scale for calo hit
+    float m_searchRegion1D;           ///< Search region, applied to each dimension, for look-up from kd-trees
+    unsigned int m_maxEventHits;      ///< The maximum number of hits in an event to proceed with the reconstruction
+    unsigned int m_nFilteringThreads; ///< The number of threads with which to filter the views (zero to use all hardware threads)
 
     bool m_onlyAvailableCaloHits;                ///< Whether to only include available calo hits
     std::string m_inputCaloHitListName;          ///< The input calo hit list name
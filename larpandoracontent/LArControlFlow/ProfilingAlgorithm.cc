@@ -0,0 +1,346 @@
+/**
+ *  @file   larpandoracontent/LArControlFlow/ProfilingAlgorithm.cc
+ *
+ *  @brief  Implementation of the profiling algorithm class.
+ *
+ *  $Log: $
+ */
+
+#include "Pandora/AlgorithmHeaders.h"
+
+#include "larpandoracontent/LArControlFlow/ProfilingAlgorithm.h"
+
+#include <algorithm>
+#include <chrono>
+#include <ctime>
+
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+using namespace pandora;
+
+namespace lar_content
+{
+
+std::mutex ProfilingAlgorithm::m_profileFileNameMutex;
+std::set<std::string> ProfilingAlgorithm::m_profileFileNames;
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+ProfilingAlgorithm::ProfilingAlgorithm() :
+    m_profileFileName("algorithm_profile.jsonl"),
+    m_shouldWriteRunSummaries(false),
+    m_shouldRecordHeapUsage(false),
+    m_shouldRecordMemoryUsage(false),
+    m_nRuns(0),
+    m_areJobPeakBytesValid(true)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+ProfilingAlgorithm::~ProfilingAlgorithm()
+{
+    if (m_profileFileStream.is_open())
+    {
+        this->WriteProfiles("job", m_jobProfiles);
+
+        if (m_shouldRecordMemoryUsage)
+            this->WriteMemoryPeaks("job", m_jobPeakBytes, m_areJobPeakBytesValid);
+    }
+
+    if (m_shouldRecordMemoryUsage)
+        LArMemoryAccountingHelper::ReleaseAccounting();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ProfilingAlgorithm::Run()
+{
+    if (!m_profileFileStream.is_open())
+    {
+        // ATTN Each instance, e.g. one per worker pandora instance, truncates and writes its own file, rather than that of another instance
+        m_profileFileName = ProfilingAlgorithm::ClaimProfileFileName(m_profileFileName);
+        m_profileFileStream.open(m_profileFileName, std::ios::out | std::ios::trunc);
+
+        if (!m_profileFileStream.is_open())
+        {
+            std::cout << "ProfilingAlgorithm: Unable to open profile file " << m_profileFileName << std::endl;
+            return STATUS_CODE_FAILURE;
+        }
+    }
+
+    ++m_nRuns;
+    ProfileVector runProfiles(m_algorithmNames.size());
+
+    // ATTN Nested high-water mark measurements, the run enclosing each daughter algorithm, restore the enclosing peaks when they end
+    LArMemoryAccountingHelper::ByteCountVector runEnclosingPeakBytes;
+    unsigned int nRunOverlappingMeasurements(0);
+
+    if (m_shouldRecordMemoryUsage)
+        LArMemoryAccountingHelper::BeginHighWaterMark(runEnclosingPeakBytes, nRunOverlappingMeasurements);
+
+    for (unsigned int i = 0; i < m_algorithmNames.size(); ++i)
+    {
+        Profile &profile(runProfiles.at(i));
+        this->GetObjectCounts(profile.m_inputCounts);
+
+        LArMemoryAccountingHelper::ByteCountVector enclosingPeakBytes;
+        unsigned int nOverlappingMeasurements(0);
+
+        if (m_shouldRecordMemoryUsage)
+            LArMemoryAccountingHelper::BeginHighWaterMark(enclosingPeakBytes, nOverlappingMeasurements);
+
+        const long long startHeapBytes(m_shouldRecordHeapUsage ? GetHeapBytes() : 0);
+        const double startCpuTime(GetThreadCpuTime());
+        const std::chrono::steady_clock::time_point startTime(std::chrono::steady_clock::now());
+
+        const StatusCode statusCode(PandoraContentApi::RunDaughterAlgorithm(*this, m_algorithmNames.at(i)));
+
+        // ATTN End the open measurements on failure, as measurements left active would mark those on other threads as overlapping
+        if ((STATUS_CODE_SUCCESS != statusCode) && m_shouldRecordMemoryUsage)
+        {
+            LArMemoryAccountingHelper::ByteCountVector discardedPeakBytes;
+            (void)LArMemoryAccountingHelper::EndHighWaterMark(enclosingPeakBytes, nOverlappingMeasurements, discardedPeakBytes);
+            (void)LArMemoryAccountingHelper::EndHighWaterMark(runEnclosingPeakBytes, nRunOverlappingMeasurements, discardedPeakBytes);
+        }
+
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, statusCode);
+
+        profile.m_wallTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+        profile.m_cpuTime = GetThreadCpuTime() - startCpuTime;
+        profile.m_heapBytes = (m_shouldRecordHeapUsage ? GetHeapBytes() - startHeapBytes : 0);
+        profile.m_nCalls = 1;
+        this->GetObjectCounts(profile.m_outputCounts);
+
+        if (m_shouldRecordMemoryUsage)
+        {
+            profile.m_arePeakBytesValid =
+                LArMemoryAccountingHelper::EndHighWaterMark(enclosingPeakBytes, nOverlappingMeasurements, profile.m_peakBytes);
+        }
+    }
+
+    LArMemoryAccountingHelper::ByteCountVector runPeakBytes;
+
+    if (m_shouldRecordMemoryUsage)
+    {
+        const bool areRunPeakBytesValid(
+            LArMemoryAccountingHelper::EndHighWaterMark(runEnclosingPeakBytes, nRunOverlappingMeasurements, runPeakBytes));
+        RaisePeakBytes(runPeakBytes, m_jobPeakBytes);
+        m_areJobPeakBytesValid = m_areJobPeakBytesValid && areRunPeakBytesValid;
+        this->WriteMemoryPeaks("run", runPeakBytes, areRunPeakBytesValid);
+    }
+
+    if (m_jobProfiles.empty())
+        m_jobProfiles.resize(m_algorithmNames.size());
+
+    for (unsigned int i = 0; i < m_algorithmNames.size(); ++i)
+        m_jobProfiles.at(i).Add(runProfiles.at(i));
+
+    if (m_shouldWriteRunSummaries)
+        this->WriteProfiles("run", runProfiles);
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ProfilingAlgorithm::GetObjectCounts(ObjectCounts &objectCounts) const
+{
+    const CaloHitList *pCaloHitList(nullptr);
+    if ((STATUS_CODE_SUCCESS == PandoraContentApi::GetCurrentList(*this, pCaloHitList)) && pCaloHitList)
+        objectCounts.m_nCaloHits = pCaloHitList->size();
+
+    const ClusterList *pClusterList(nullptr);
+    if ((STATUS_CODE_SUCCESS == PandoraContentApi::GetCurrentList(*this, pClusterList)) && pClusterList)
+        objectCounts.m_nClusters = pClusterList->size();
+
+    const VertexList *pVertexList(nullptr);
+    if ((STATUS_CODE_SUCCESS == PandoraContentApi::GetCurrentList(*this, pVertexList)) && pVertexList)
+        objectCounts.m_nVertices = pVertexList->size();
+
+    const PfoList *pPfoList(nullptr);
+    if ((STATUS_CODE_SUCCESS == PandoraContentApi::GetCurrentList(*this, pPfoList)) && pPfoList)
+        objectCounts.m_nPfos = pPfoList->size();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+double ProfilingAlgorithm::GetThreadCpuTime()
+{
+    struct timespec cpuTime;
+
+    if (0 != clock_gettime(CLOCK_THREAD_CPUTIME_ID, &cpuTime))
+        return 0.;
+
+    return static_cast<double>(cpuTime.tv_sec) + 1.e-9 * static_cast<double>(cpuTime.tv_nsec);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+long long ProfilingAlgorithm::GetHeapBytes()
+{
+#if defined(__GLIBC__) && ((__GLIBC__ > 2) || ((__GLIBC__ == 2) && (__GLIBC_MINOR__ >= 33)))
+    const struct mallinfo2 heapInfo(mallinfo2());
+    return static_cast<long long>(heapInfo.uordblks + heapInfo.hblkhd);
+#else
+    return 0;
+#endif
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+std::string ProfilingAlgorithm::ClaimProfileFileName(const std::string &profileFileName)
+{
+    const std::lock_guard<std::mutex> lock(m_profileFileNameMutex);
+
+    if (m_profileFileNames.insert(profileFileName).second)
+        return profileFileName;
+
+    const std::string::size_type dotPosition(profileFileName.find_last_of('.'));
+    const std::string::size_type slashPosition(profileFileName.find_last_of('/'));
+    const bool hasExtension((std::string::npos != dotPosition) && ((std::string::npos == slashPosition) || (dotPosition > slashPosition)));
+    const std::string stem(hasExtension ? profileFileName.substr(0, dotPosition) : profileFileName);
+    const std::string extension(hasExtension ? profileFileName.substr(dotPosition) : std::string());
+
+    for (unsigned int suffix = 1;; ++suffix)
+    {
+        const std::string claimedFileName(stem + "_" + std::to_string(suffix) + extension);
+
+        if (m_profileFileNames.insert(claimedFileName).second)
+            return claimedFileName;
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ProfilingAlgorithm::WriteProfiles(const std::string &scope, const ProfileVector &profiles)
+{
+    for (unsigned int i = 0; i < profiles.size(); ++i)
+    {
+        const Profile &profile(profiles.at(i));
+
+        m_profileFileStream << "{\"scope\":\"" << scope << "\",\"run\":" << m_nRuns << ",\"algorithm\":\"" << m_algorithmNames.at(i)
+                            << "\",\"calls\":" << profile.m_nCalls << ",\"wallTime\":" << profile.m_wallTime
+                            << ",\"cpuTime\":" << profile.m_cpuTime << ",\"heapBytes\":" << profile.m_heapBytes
+                            << ",\"inputCaloHits\":" << profile.m_inputCounts.m_nCaloHits
+                            << ",\"inputClusters\":" << profile.m_inputCounts.m_nClusters
+                            << ",\"inputVertices\":" << profile.m_inputCounts.m_nVertices
+                            << ",\"inputPfos\":" << profile.m_inputCounts.m_nPfos
+                            << ",\"outputCaloHits\":" << profile.m_outputCounts.m_nCaloHits
+                            << ",\"outputClusters\":" << profile.m_outputCounts.m_nClusters
+                            << ",\"outputVertices\":" << profile.m_outputCounts.m_nVertices
+                            << ",\"outputPfos\":" << profile.m_outputCounts.m_nPfos;
+
+        if (!profile.m_peakBytes.empty())
+        {
+            m_profileFileStream << ",\"peakBytes\":";
+            this->WritePeakBytes(profile.m_peakBytes);
+            m_profileFileStream << ",\"peakBytesValid\":" << (profile.m_arePeakBytesValid ? "true" : "false");
+        }
+
+        m_profileFileStream << "}\n";
+    }
+
+    m_profileFileStream.flush();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ProfilingAlgorithm::WriteMemoryPeaks(
+    const std::string &scope, const LArMemoryAccountingHelper::ByteCountVector &peakBytes, const bool arePeakBytesValid)
+{
+    m_profileFileStream << "{\"scope\":\"" << scope << "\",\"run\":" << m_nRuns << ",\"algorithm\":\"all\",\"peakBytes\":";
+    this->WritePeakBytes(peakBytes);
+    m_profileFileStream << ",\"peakBytesValid\":" << (arePeakBytesValid ? "true" : "false") << "}\n";
+    m_profileFileStream.flush();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ProfilingAlgorithm::WritePeakBytes(const LArMemoryAccountingHelper::ByteCountVector &peakBytes)
+{
+    m_profileFileStream << "{";
+
+    for (unsigned int i = 0; i < peakBytes.size(); ++i)
+    {
+        m_profileFileStream << (i > 0 ? "," : "") << "\""
+                            << LArMemoryAccountingHelper::GetMemoryFamilyName(static_cast<LArMemoryAccountingHelper::MemoryFamily>(i))
+                            << "\":" << peakBytes.at(i);
+    }
+
+    m_profileFileStream << "}";
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ProfilingAlgorithm::RaisePeakBytes(
+    const LArMemoryAccountingHelper::ByteCountVector &otherPeakBytes, LArMemoryAccountingHelper::ByteCountVector &peakBytes)
+{
+    if (peakBytes.size() < otherPeakBytes.size())
+        peakBytes.resize(otherPeakBytes.size(), 0);
+
+    for (unsigned int i = 0; i < otherPeakBytes.size(); ++i)
+        peakBytes.at(i) = std::max(peakBytes.at(i), otherPeakBytes.at(i));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ProfilingAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
+{
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ProcessAlgorithmList(*this, xmlHandle, "Algorithms", m_algorithmNames));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "ProfileFileName", m_profileFileName));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
+        XmlHelper::ReadValue(xmlHandle, "ShouldWriteRunSummaries", m_shouldWriteRunSummaries));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
+        XmlHelper::ReadValue(xmlHandle, "ShouldRecordHeapUsage", m_shouldRecordHeapUsage));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
+        XmlHelper::ReadValue(xmlHandle, "ShouldRecordMemoryUsage", m_shouldRecordMemoryUsage));
+
+    if (m_shouldRecordMemoryUsage)
+        LArMemoryAccountingHelper::RequestAccounting();
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+ProfilingAlgorithm::ObjectCounts::ObjectCounts() : m_nCaloHits(0), m_nClusters(0), m_nVertices(0), m_nPfos(0)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+ProfilingAlgorithm::Profile::Profile() : m_nCalls(0), m_wallTime(0.), m_cpuTime(0.), m_heapBytes(0), m_arePeakBytesValid(true)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ProfilingAlgorithm::Profile::Add(const Profile &other)
+{
+    m_nCalls += other.m_nCalls;
+    m_wallTime += other.m_wallTime;
+    m_cpuTime += other.m_cpuTime;
+    m_heapBytes += other.m_heapBytes;
+    ProfilingAlgorithm::RaisePeakBytes(other.m_peakBytes, m_peakBytes);
+    m_arePeakBytesValid = m_arePeakBytesValid && other.m_arePeakBytesValid;
+    m_inputCounts.m_nCaloHits += other.m_inputCounts.m_nCaloHits;
+    m_inputCounts.m_nClusters += other.m_inputCounts.m_nClusters;
+    m_inputCounts.m_nVertices += other.m_inputCounts.m_nVertices;
+    m_inputCounts.m_nPfos += other.m_inputCounts.m_nPfos;
+    m_outputCounts.m_nCaloHits += other.m_outputCounts.m_nCaloHits;
+    m_outputCounts.m_nClusters += other.m_outputCounts.m_nClusters;
+    m_outputCounts.m_nVertices += other.m_outputCounts.m_nVertices;
+    m_outputCounts.m_nPfos += other.m_outputCounts.m_nPfos;
+}
+
+} // namespace lar_content
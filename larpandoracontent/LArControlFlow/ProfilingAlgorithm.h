@@ -0,0 +1,176 @@
+/**
+ *  @file   larpandoracontent/LArControlFlow/ProfilingAlgorithm.h
+ *
+ *  @brief  Header file for the profiling algorithm class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_PROFILING_ALGORITHM_H
+#define LAR_PROFILING_ALGORITHM_H 1
+
+#include "Pandora/Algorithm.h"
+
+#include "larpandoracontent/LArHelpers/LArMemoryAccountingHelper.h"
+
+#include <fstream>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace lar_content
+{
+
+/**
+ *  @brief  ProfilingAlgorithm class, running a sequence of daughter algorithms and recording the wall time, thread cpu time, optionally
+ *          the heap usage and accounted memory high-water marks, and the current list sizes around each. Summaries are written as json
+ *          lines, per run and per job. Memory high-water marks are process-wide, and those overlapping a measurement by another profiling
+ *          algorithm instance, on another thread, are reported with peakBytesValid false.
+ */
+class ProfilingAlgorithm : public pandora::Algorithm
+{
+public:
+    /**
+     *  @brief  Default constructor
+     */
+    ProfilingAlgorithm();
+
+    /**
+     *  @brief  Destructor, writing the job summary
+     */
+    ~ProfilingAlgorithm();
+
+private:
+    /**
+     *  @brief  ObjectCounts class, holding the sizes of the current calo hit, cluster, vertex and pfo lists
+     */
+    class ObjectCounts
+    {
+    public:
+        /**
+         *  @brief  Default constructor
+         */
+        ObjectCounts();
+
+        unsigned long m_nCaloHits; ///< The number of calo hits
+        unsigned long m_nClusters; ///< The number of clusters
+        unsigned long m_nVertices; ///< The number of vertices
+        unsigned long m_nPfos;     ///< The number of pfos
+    };
+
+    /**
+     *  @brief  Profile class, accumulating the measurements for a daughter algorithm
+     */
+    class Profile
+    {
+    public:
+        /**
+         *  @brief  Default constructor
+         */
+        Profile();
+
+        /**
+         *  @brief  Add the measurements of another profile
+         *
+         *  @param  other the other profile
+         */
+        void Add(const Profile &other);
+
+        unsigned int m_nCalls;                                  ///< The number of calls
+        double m_wallTime;                                      ///< The total wall time, in seconds
+        double m_cpuTime;                                       ///< The total cpu time of the calling thread, in seconds
+        long long m_heapBytes;                                  ///< The total change in allocated heap bytes, if recorded
+        ObjectCounts m_inputCounts;                             ///< The total current list sizes before each call
+        ObjectCounts m_outputCounts;                            ///< The total current list sizes after each call
+        LArMemoryAccountingHelper::ByteCountVector m_peakBytes; ///< The accounted memory high-water marks, by family, if recorded
+        bool m_arePeakBytesValid;                               ///< Whether no measurement on another thread overlapped the peaks
+    };
+
+    typedef std::vector<Profile> ProfileVector;
+
+    pandora::StatusCode Run();
+    pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
+
+    /**
+     *  @brief  Get the sizes of the current calo hit, cluster, vertex and pfo lists
+     *
+     *  @param  objectCounts to receive the list sizes
+     */
+    void GetObjectCounts(ObjectCounts &objectCounts) const;
+
+    /**
+     *  @brief  Get the cpu time consumed by the calling thread
+     *
+     *  @return the cpu time, in seconds
+     */
+    static double GetThreadCpuTime();
+
+    /**
+     *  @brief  Get the number of heap bytes currently allocated by the process, where the allocator supports the query
+     *
+     *  @return the number of allocated heap bytes, or zero if unsupported
+     */
+    static long long GetHeapBytes();
+
+    /**
+     *  @brief  Claim a profile file name for this instance, one not yet claimed by another profiling algorithm instance in the process
+     *
+     *  @param  profileFileName the configured profile file name
+     *
+     *  @return the configured name if unclaimed, otherwise the name with a numeric suffix inserted before its extension
+     */
+    static std::string ClaimProfileFileName(const std::string &profileFileName);
+
+    /**
+     *  @brief  Write the profiles as json lines
+     *
+     *  @param  scope the scope of the profiles, run or job
+     *  @param  profiles the profiles, one per daughter algorithm
+     */
+    void WriteProfiles(const std::string &scope, const ProfileVector &profiles);
+
+    /**
+     *  @brief  Write the accounted memory high-water marks for the full daughter algorithm sequence as a json line
+     *
+     *  @param  scope the scope of the high-water marks, run or job
+     *  @param  peakBytes the high-water marks, by memory family
+     *  @param  arePeakBytesValid whether no measurement on another thread overlapped the high-water marks
+     */
+    void WriteMemoryPeaks(
+        const std::string &scope, const LArMemoryAccountingHelper::ByteCountVector &peakBytes, const bool arePeakBytesValid);
+
+    /**
+     *  @brief  Write accounted memory high-water marks as a json object
+     *
+     *  @param  peakBytes the high-water marks, by memory family
+     */
+    void WritePeakBytes(const LArMemoryAccountingHelper::ByteCountVector &peakBytes);
+
+    /**
+     *  @brief  Raise accounted memory high-water marks to those of another measurement
+     *
+     *  @param  otherPeakBytes the other high-water marks
+     *  @param  peakBytes the high-water marks to raise
+     */
+    static void RaisePeakBytes(
+        const LArMemoryAccountingHelper::ByteCountVector &otherPeakBytes, LArMemoryAccountingHelper::ByteCountVector &peakBytes);
+
+    pandora::StringVector m_algorithmNames; ///< The names of the daughter algorithms
+    std::string m_profileFileName;          ///< The name of the json lines output file
+    bool m_shouldWriteRunSummaries;         ///< Whether to write a summary for each run, as well as for the job
+    bool m_shouldRecordHeapUsage;           ///< Whether to record the change in allocated heap bytes, which costs an allocator query
+    bool m_shouldRecordMemoryUsage;         ///< Whether to record the accounted memory high-water marks of the lar object families
+    unsigned int m_nRuns;                   ///< The number of runs
+    ProfileVector m_jobProfiles;            ///< The profiles accumulated over the job
+    std::ofstream m_profileFileStream;      ///< The json lines output file stream
+
+    LArMemoryAccountingHelper::ByteCountVector m_jobPeakBytes; ///< The accounted memory high-water marks over the job, if recorded
+    bool m_areJobPeakBytesValid;                               ///< Whether no measurement on another thread overlapped the job peaks
+
+    static std::mutex m_profileFileNameMutex;        ///< The mutex protecting the claimed profile file names
+    static std::set<std::string> m_profileFileNames; ///< The profile file names claimed by the instances in the process
+};
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_PROFILING_ALGORITHM_H
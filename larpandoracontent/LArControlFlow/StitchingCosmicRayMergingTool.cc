@@ -115,7 +115,8 @@ void StitchingCosmicRayMergingTool::BuildPointingClusterMaps(
             if (1 != clusterList.size())
                 throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
 
-            const ThreeDSlidingFitResult slidingFitResult(clusterList.front(), m_halfWindowLayers, slidingFitPitch);
+            const ThreeDSlidingFitResult slidingFitResult(
+                clusterList.front(), m_halfWindowLayers, slidingFitPitch, ThreeDSlidingFitResult::ENDPOINTS_ONLY);
             (void)pointingClusterMap.insert(ThreeDPointingClusterMap::value_type(pPfo, LArPointingCluster(slidingFitResult)));
         }
         catch (const StatusCodeException &)
@@ -160,10 +161,41 @@ void StitchingCosmicRayMergingTool::CreatePfoMatches(const LArTPCToPfoMap &larTP
             if (!LArStitchingHelper::CanTPCsBeStitched(*pLArTPC1, *pLArTPC2))
                 continue;
 
-            for (const ParticleFlowObject *const pPfo1 : pfoList1)
+            const float boundaryCenterX(LArStitchingHelper::GetTPCBoundaryCenterX(*pLArTPC1, *pLArTPC2));
+            const float boundaryWidthX(LArStitchingHelper::GetTPCBoundaryWidthX(*pLArTPC1, *pLArTPC2));
+            const float maxLongitudinalDisplacementX(m_maxLongitudinalDisplacementX + boundaryWidthX);
+            const bool isTPC2InPositiveX(pLArTPC2->GetCenterX() > pLArTPC1->GetCenterX());
+
+            const PfoVector pfoVector1(pfoList1.begin(), pfoList1.end()), pfoVector2(pfoList2.begin(), pfoList2.end());
+            BoundaryVertexVector boundaryVertices1, boundaryVertices2;
+            this->GetBoundaryVertices(pfoVector1, pointingClusterMap, isTPC2InPositiveX, boundaryVertices1);
+            this->GetBoundaryVertices(pfoVector2, pointingClusterMap, !isTPC2InPositiveX, boundaryVertices2);
+            std::sort(boundaryVertices2.begin(), boundaryVertices2.end());
+
+            // ATTN Matched pfos must have a mean boundary vertex x coordinate close to the boundary, so only pfos in the second tpc with
+            // boundary vertices in the corresponding x range need be compared, in their original order. Tolerance absorbs rounding only.
+            const float toleranceX(1.f);
+
+            for (const BoundaryVertex &boundaryVertex1 : boundaryVertices1)
             {
-                for (const ParticleFlowObject *const pPfo2 : pfoList2)
-                    this->CreatePfoMatches(*pLArTPC1, *pLArTPC2, pPfo1, pPfo2, pointingClusterMap, pfoAssociationMatrix);
+                const float minX2(2.f * (boundaryCenterX - maxLongitudinalDisplacementX) - boundaryVertex1.first - toleranceX);
+                const float maxX2(2.f * (boundaryCenterX + maxLongitudinalDisplacementX) - boundaryVertex1.first + toleranceX);
+
+                BoundaryVertexVector::const_iterator lowerIter(
+                    std::lower_bound(boundaryVertices2.begin(), boundaryVertices2.end(), BoundaryVertex(minX2, 0)));
+                BoundaryVertexVector::const_iterator upperIter(std::upper_bound(
+                    boundaryVertices2.begin(), boundaryVertices2.end(), BoundaryVertex(maxX2, std::numeric_limits<unsigned int>::max())));
+
+                std::vector<unsigned int> candidateIndices2;
+                for (BoundaryVertexVector::const_iterator iter = lowerIter; iter != upperIter; ++iter)
+                    candidateIndices2.push_back(iter->second);
+                std::sort(candidateIndices2.begin(), candidateIndices2.end());
+
+                for (const unsigned int index2 : candidateIndices2)
+                {
+                    this->CreatePfoMatches(*pLArTPC1, *pLArTPC2, pfoVector1.at(boundaryVertex1.second), pfoVector2.at(index2),
+                        pointingClusterMap, pfoAssociationMatrix);
+                }
             }
         }
     }
@@ -171,6 +203,31 @@ void StitchingCosmicRayMergingTool::CreatePfoMatches(const LArTPCToPfoMap &larTP
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void StitchingCosmicRayMergingTool::GetBoundaryVertices(const PfoVector &pfoVector, const ThreeDPointingClusterMap &pointingClusterMap,
+    const bool isNeighbourInPositiveX, BoundaryVertexVector &boundaryVertices) const
+{
+    for (unsigned int index = 0; index < pfoVector.size(); ++index)
+    {
+        ThreeDPointingClusterMap::const_iterator iter(pointingClusterMap.find(pfoVector.at(index)));
+
+        if (pointingClusterMap.end() == iter)
+            continue;
+
+        // ATTN Vertex choice must match that in LArStitchingHelper::GetClosestVertices, which will reject pfos without x extent
+        const LArPointingCluster &pointingCluster(iter->second);
+        const float innerX(pointingCluster.GetInnerVertex().GetPosition().GetX());
+        const float outerX(pointingCluster.GetOuterVertex().GetPosition().GetX());
+
+        if (std::fabs(outerX - innerX) < std::numeric_limits<float>::epsilon())
+            continue;
+
+        const bool useInner(isNeighbourInPositiveX == (outerX - innerX < 0.f));
+        boundaryVertices.push_back(BoundaryVertex(useInner ? innerX : outerX, index));
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void StitchingCosmicRayMergingTool::CreatePfoMatches(const LArTPC &larTPC1, const LArTPC &larTPC2, const ParticleFlowObject *const pPfo1,
     const ParticleFlowObject *const pPfo2, const ThreeDPointingClusterMap &pointingClusterMap, PfoAssociationMatrix &pfoAssociationMatrix) const
 {
@@ -567,8 +624,9 @@ void StitchingCosmicRayMergingTool::StitchPfos(const MasterAlgorithm *const pAlg
             }
         }
 
-        // ATTN: shift the pfos one at a time
+        // ATTN: find the shift of each pfo one at a time, then apply the shifts for the whole group together
         PfoSet shiftedPfos;
+        PfoToFloatMap pfoToSignedX0Map;
         for (PfoVector::const_iterator iterI = pfoVector.begin(); iterI != pfoVector.end(); ++iterI)
         {
             const ParticleFlowObject *const pPfoI(*iterI);
@@ -585,7 +643,7 @@ void StitchingCosmicRayMergingTool::StitchPfos(const MasterAlgorithm *const pAlg
                 if (std::find(shiftedPfos.begin(), shiftedPfos.end(), pPfoI) == shiftedPfos.end())
                 {
                     if (!m_useXcoordinate || m_alwaysApplyT0Calculation)
-                        this->ShiftPfo(pAlgorithm, pPfoI, pPfoJ, x0, pfoToLArTPCMap, pfoToPointingVertexMatrix);
+                        this->ShiftPfo(pAlgorithm, pPfoI, pPfoJ, x0, pfoToLArTPCMap, pfoToPointingVertexMatrix, pfoToSignedX0Map);
 
                     shiftedPfos.insert(pPfoI);
                 }
@@ -593,13 +651,16 @@ void StitchingCosmicRayMergingTool::StitchPfos(const MasterAlgorithm *const pAlg
                 if (std::find(shiftedPfos.begin(), shiftedPfos.end(), pPfoJ) == shiftedPfos.end())
                 {
                     if (!m_useXcoordinate || m_alwaysApplyT0Calculation)
-                        this->ShiftPfo(pAlgorithm, pPfoJ, pPfoI, x0, pfoToLArTPCMap, pfoToPointingVertexMatrix);
+                        this->ShiftPfo(pAlgorithm, pPfoJ, pPfoI, x0, pfoToLArTPCMap, pfoToPointingVertexMatrix, pfoToSignedX0Map);
 
                     shiftedPfos.insert(pPfoJ);
                 }
             }
         }
 
+        if (!pfoToSignedX0Map.empty())
+            pAlgorithm->ShiftPfoHierarchies(pfoToSignedX0Map, pfoToLArTPCMap);
+
         // now merge all pfos
         for (const ParticleFlowObject *const pPfoToDelete : shiftedPfos)
         {
@@ -617,7 +678,7 @@ void StitchingCosmicRayMergingTool::StitchPfos(const MasterAlgorithm *const pAlg
 
 void StitchingCosmicRayMergingTool::ShiftPfo(const MasterAlgorithm *const pAlgorithm, const ParticleFlowObject *const pPfoToShift,
     const ParticleFlowObject *const pMatchedPfo, const float x0, const PfoToLArTPCMap &pfoToLArTPCMap,
-    const PfoToPointingVertexMatrix &pfoToPointingVertexMatrix) const
+    const PfoToPointingVertexMatrix &pfoToPointingVertexMatrix, PfoToFloatMap &pfoToSignedX0Map) const
 {
     // get stitching vertex for the pfo to be shifted
     const PfoToPointingVertexMatrix::const_iterator pfoToPointingVertexMatrixIter(pfoToPointingVertexMatrix.find(pPfoToShift));
@@ -654,7 +715,7 @@ void StitchingCosmicRayMergingTool::ShiftPfo(const MasterAlgorithm *const pAlgor
 
     const float signedX0(std::fabs(x0) * positionShiftSign);
 
-    pAlgorithm->ShiftPfoHierarchy(pPfoToShift, pfoToLArTPCMap, signedX0);
+    pfoToSignedX0Map[pPfoToShift] = signedX0;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -131,6 +131,20 @@ private:
     void CreatePfoMatches(const LArTPCToPfoMap &larTPCToPfoMap, const ThreeDPointingClusterMap &pointingClusterMap,
         PfoAssociationMatrix &pfoAssociationMatrix) const;
 
+    typedef std::pair<float, unsigned int> BoundaryVertex;
+    typedef std::vector<BoundaryVertex> BoundaryVertexVector;
+
+    /**
+     *  @brief  Get the x coordinate of the pointing cluster vertex that faces a neighbouring tpc, for each Pfo in a list
+     *
+     *  @param  pfoVector the input vector of Pfos
+     *  @param  pointingClusterMap the input mapping between Pfos and their corresponding 3D pointing clusters
+     *  @param  isNeighbourInPositiveX whether the neighbouring tpc lies in the positive x direction
+     *  @param  boundaryVertices to receive the boundary vertex x coordinate and the index in the input vector for each suitable Pfo
+     */
+    void GetBoundaryVertices(const pandora::PfoVector &pfoVector, const ThreeDPointingClusterMap &pointingClusterMap,
+        const bool isNeighbourInPositiveX, BoundaryVertexVector &boundaryVertices) const;
+
     /**
      *  @brief  Create associations between Pfos using 3D pointing clusters
      *
@@ -202,17 +216,19 @@ private:
     typedef std::unordered_map<const pandora::ParticleFlowObject *, PfoToPointingVertexMap> PfoToPointingVertexMatrix;
 
     /**
-     *  @brief  Shift a pfo given its pfo stitching pair
+     *  @brief  Shift a pfo given its pfo stitching pair. The x0 metadata of the pfo hierarchy is set here, whilst the signed shift of
+     *          its hits and vertices is recorded, so that the shifts of all pfos in a stitching group can be applied together
      *
      *  @param  pPfoToShift the pfo of the stitching pair to shift
      *  @param  pMatchedPfo the pfo of the stitching pair to remain stationary
      *  @param  x0 the distance by which pPfoToShift is to be shifted (direction of shift is determined in method)
      *  @param  pfoToLArTPCMap the pfo to lar tpc map
      *  @param  pfoToPointingVertexMatrix the map [pfo -> map [matched pfo -> pfo stitching vertex]]
+     *  @param  pfoToSignedX0Map to receive the signed x0 shift of the pfo hierarchy
      */
     void ShiftPfo(const MasterAlgorithm *const pAlgorithm, const pandora::ParticleFlowObject *const pPfoToShift,
         const pandora::ParticleFlowObject *const pMatchedPfo, const float x0, const PfoToLArTPCMap &pfoToLArTPCMap,
-        const PfoToPointingVertexMatrix &pfoToPointingVertexMatrix) const;
+        const PfoToPointingVertexMatrix &pfoToPointingVertexMatrix, PfoToFloatMap &pfoToSignedX0Map) const;
 
     /**
      *  @brief  Calculate x0 shift for a group of associated Pfos
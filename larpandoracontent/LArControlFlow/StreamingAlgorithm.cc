@@ -37,17 +37,18 @@ StreamingAlgorithm::~StreamingAlgorithm()
 
 StatusCode StreamingAlgorithm::Run()
 {
+    // ATTN Streams share this instance's list and object managers, which are not thread-safe, so the streams must run serially here
     unsigned int i{0};
-    for (std::string listName : m_inputListNames)
+    for (const std::string &listName : m_inputListNames)
     {
-        std::string algStreamName{"Algorithms" + listName};
         const ClusterList *pClusterList{nullptr};
         // Set the input list as current
         PandoraContentApi::ReplaceCurrentList<Cluster>(*this, listName);
         StatusCode code{PandoraContentApi::GetCurrentList(*this, pClusterList)};
         if (code == STATUS_CODE_SUCCESS)
         {
-            for (const auto &alg : m_streamAlgorithmMap.at(algStreamName))
+            const StringVector &streamAlgorithms{m_streamAlgorithmMap.at("Algorithms" + listName)};
+            for (const auto &alg : streamAlgorithms)
             { // ATTN - The algorithms replace the current list as they go
                 PandoraContentApi::GetCurrentList(*this, pClusterList);
                 if (!pClusterList->empty())
@@ -110,6 +111,11 @@ StatusCode StreamingAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
         return STATUS_CODE_INVALID_PARAMETER;
     }
 
+    // An identical algorithm sequence, e.g. the 2D reconstruction for each view, can be provided once and is then used for any stream
+    // without its own algorithm list
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
+        XmlHelper::ProcessAlgorithmList(*this, xmlHandle, "Algorithms", m_commonAlgorithms));
+
     for (std::string listName : m_inputListNames)
     {
         std::string algStreamName{"Algorithms" + listName};
@@ -120,6 +126,8 @@ StatusCode StreamingAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
         }
         PANDORA_RETURN_RESULT_IF(
             STATUS_CODE_SUCCESS, !=, XmlHelper::ProcessAlgorithmList(*this, xmlHandle, algStreamName, m_streamAlgorithmMap[algStreamName]));
+        if (m_streamAlgorithmMap.at(algStreamName).empty())
+            m_streamAlgorithmMap.at(algStreamName) = m_commonAlgorithms;
         if (m_streamAlgorithmMap.at(algStreamName).empty())
         {
             std::cout << "StreamingAlgorithm::ReadSettings - Error: Found no algorithms for \'" << algStreamName << "\'" << std::endl;
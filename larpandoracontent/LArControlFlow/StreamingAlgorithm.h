@@ -31,11 +31,12 @@ private:
     pandora::StatusCode Run();
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
-    std::string m_outputListName;            ///< The name of the output list
-    std::string m_listType;                  ///< The type of the input lists (currently only Cluster is supported)
-    pandora::StringVector m_inputListNames;  ///< The names of the input lists
-    pandora::StringVector m_outputListNames; ///< Names of the output lists if not combining into a single list at the end
-    StreamAlgorithmMap m_streamAlgorithmMap; ///< A map from individual streams to the algorithms that stream should run
+    std::string m_outputListName;             ///< The name of the output list
+    std::string m_listType;                   ///< The type of the input lists (currently only Cluster is supported)
+    pandora::StringVector m_inputListNames;   ///< The names of the input lists
+    pandora::StringVector m_outputListNames;  ///< Names of the output lists if not combining into a single list at the end
+    pandora::StringVector m_commonAlgorithms; ///< The algorithms to run for any stream without its own algorithm list
+    StreamAlgorithmMap m_streamAlgorithmMap;  ///< A map from individual streams to the algorithms that stream should run
 };
 
 } // namespace lar_content
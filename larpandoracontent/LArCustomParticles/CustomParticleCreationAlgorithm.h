@@ -30,6 +30,19 @@ protected:
      */
     virtual void CreatePfo(const pandora::ParticleFlowObject *const pInputPfo, const pandora::ParticleFlowObject *&pOutputPfo) const = 0;
 
+    /**
+     *  @brief  Prepare to create specialised Pfos, ahead of any changes to the input lists. Intended for algorithms able to perform the
+     *          read-only part of the Pfo creation for a whole list of input Pfos at once
+     *
+     *  @param  inputPfoList the list of input Pfos
+     */
+    virtual void PrepareToCreatePfos(const pandora::PfoList &inputPfoList);
+
+    /**
+     *  @brief  Finish creating specialised Pfos, releasing anything held since the preparation
+     */
+    virtual void FinishCreatingPfos();
+
 private:
     std::string m_pfoListName;    ///< The name of the input pfo list
     std::string m_vertexListName; ///< The name of the input vertex list
@@ -10,6 +10,7 @@
 
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
+#include "larpandoracontent/LArHelpers/LArParallelHelper.h"
 #include "larpandoracontent/LArHelpers/LArPcaHelper.h"
 #include "larpandoracontent/LArHelpers/LArPfoHelper.h"
 
@@ -23,7 +24,10 @@ using namespace pandora;
 namespace lar_content
 {
 
-PcaShowerParticleBuildingAlgorithm::PcaShowerParticleBuildingAlgorithm() : m_layerFitHalfWindow(20)
+PcaShowerParticleBuildingAlgorithm::PcaShowerParticleBuildingAlgorithm() :
+    m_layerFitHalfWindow(20),
+    m_singlePassPca(false),
+    m_nPcaThreads(1)
 {
 }
 
@@ -33,26 +37,14 @@ void PcaShowerParticleBuildingAlgorithm::CreatePfo(const ParticleFlowObject *con
 {
     try
     {
-        // In cosmic mode, build showers from all daughter pfos, otherwise require that pfo is shower-like
-        if (LArPfoHelper::IsNeutrinoFinalState(pInputPfo))
-        {
-            if (!LArPfoHelper::IsShower(pInputPfo))
-                return;
-        }
-        else
-        {
-            if (LArPfoHelper::IsFinalState(pInputPfo))
-                return;
-
-            if (LArPfoHelper::IsNeutrino(pInputPfo))
-                return;
-        }
+        if (!this->IsShowerCandidate(pInputPfo))
+            return;
 
         // Need an input vertex to provide a shower propagation direction
         const Vertex *const pInputVertex = LArPfoHelper::GetVertex(pInputPfo);
 
         // Run the PCA analysis
-        const LArShowerPCA showerPCA(LArPfoHelper::GetPrincipalComponents(pInputPfo, pInputVertex));
+        const LArShowerPCA showerPCA(this->GetShowerPCA(pInputPfo, pInputVertex));
 
         // Build a new pfo
         LArShowerPfoFactory pfoFactory;
@@ -100,11 +92,112 @@ void PcaShowerParticleBuildingAlgorithm::CreatePfo(const ParticleFlowObject *con
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void PcaShowerParticleBuildingAlgorithm::PrepareToCreatePfos(const PfoList &inputPfoList)
+{
+    m_pfoToShowerPcaMap.clear();
+
+    if (1 == m_nPcaThreads)
+        return;
+
+    // ATTN The shower pca only reads the event, so pfos can be processed in parallel ahead of any pfo creation or deletion
+    const PfoVector pfoVector(inputPfoList.begin(), inputPfoList.end());
+    PfoVector candidatePfoVector(pfoVector.size(), nullptr);
+    std::vector<ShowerPca> showerPcaVector(pfoVector.size());
+
+    LArParallelHelper::ForEach(pfoVector.size(), m_nPcaThreads, [&](const unsigned int iPfo) {
+        const ParticleFlowObject *const pInputPfo(pfoVector.at(iPfo));
+        const Vertex *pInputVertex(nullptr);
+
+        try
+        {
+            if (pInputPfo->GetVertexList().empty() || !this->IsShowerCandidate(pInputPfo))
+                return;
+
+            pInputVertex = LArPfoHelper::GetVertex(pInputPfo);
+        }
+        catch (const StatusCodeException &)
+        {
+            return;
+        }
+
+        ShowerPca &showerPca(showerPcaVector.at(iPfo));
+        showerPca.m_statusCode = STATUS_CODE_SUCCESS;
+
+        try
+        {
+            showerPca.m_pShowerPCA = std::make_unique<const LArShowerPCA>(this->CalculateShowerPCA(pInputPfo, pInputVertex));
+        }
+        catch (const StatusCodeException &statusCodeException)
+        {
+            showerPca.m_statusCode = statusCodeException.GetStatusCode();
+        }
+
+        candidatePfoVector.at(iPfo) = pInputPfo;
+    });
+
+    for (unsigned int iPfo = 0; iPfo < pfoVector.size(); ++iPfo)
+    {
+        if (candidatePfoVector.at(iPfo))
+            m_pfoToShowerPcaMap.emplace(candidatePfoVector.at(iPfo), std::move(showerPcaVector.at(iPfo)));
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void PcaShowerParticleBuildingAlgorithm::FinishCreatingPfos()
+{
+    m_pfoToShowerPcaMap.clear();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool PcaShowerParticleBuildingAlgorithm::IsShowerCandidate(const ParticleFlowObject *const pInputPfo) const
+{
+    // In cosmic mode, build showers from all daughter pfos, otherwise require that pfo is shower-like
+    if (LArPfoHelper::IsNeutrinoFinalState(pInputPfo))
+        return LArPfoHelper::IsShower(pInputPfo);
+
+    return (!LArPfoHelper::IsFinalState(pInputPfo) && !LArPfoHelper::IsNeutrino(pInputPfo));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArShowerPCA PcaShowerParticleBuildingAlgorithm::GetShowerPCA(
+    const ParticleFlowObject *const pInputPfo, const Vertex *const pInputVertex) const
+{
+    const PfoToShowerPcaMap::const_iterator iter(m_pfoToShowerPcaMap.find(pInputPfo));
+
+    if (m_pfoToShowerPcaMap.end() == iter)
+        return this->CalculateShowerPCA(pInputPfo, pInputVertex);
+
+    if (STATUS_CODE_SUCCESS != iter->second.m_statusCode)
+        throw StatusCodeException(iter->second.m_statusCode);
+
+    return *(iter->second.m_pShowerPCA);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArShowerPCA PcaShowerParticleBuildingAlgorithm::CalculateShowerPCA(
+    const ParticleFlowObject *const pInputPfo, const Vertex *const pInputVertex) const
+{
+    return (m_singlePassPca ? LArPfoHelper::GetSinglePassPrincipalComponents(pInputPfo, pInputVertex)
+                            : LArPfoHelper::GetPrincipalComponents(pInputPfo, pInputVertex));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode PcaShowerParticleBuildingAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
 {
     PANDORA_RETURN_RESULT_IF_AND_IF(
         STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "LayerFitHalfWindow", m_layerFitHalfWindow));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "SinglePassPca", m_singlePassPca));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "NPcaThreads", m_nPcaThreads));
+
     return CustomParticleCreationAlgorithm::ReadSettings(xmlHandle);
 }
 
@@ -8,10 +8,14 @@
 #ifndef LAR_PCA_SHOWER_PARTICLE_BUILDING_ALGORITHM_H
 #define LAR_PCA_SHOWER_PARTICLE_BUILDING_ALGORITHM_H 1
 
+#include "larpandoracontent/LArObjects/LArPfoObjects.h"
 #include "larpandoracontent/LArObjects/LArShowerPfo.h"
 
 #include "larpandoracontent/LArCustomParticles/CustomParticleCreationAlgorithm.h"
 
+#include <memory>
+#include <unordered_map>
+
 namespace lar_content
 {
 
@@ -36,11 +40,57 @@ public:
     };
 
 private:
+    /**
+     *  @brief  ShowerPca class, holding the outcome of a shower principal component analysis calculated ahead of pfo creation
+     */
+    class ShowerPca
+    {
+    public:
+        pandora::StatusCode m_statusCode;                 ///< The status code from the principal component analysis
+        std::unique_ptr<const LArShowerPCA> m_pShowerPCA; ///< The shower pca, if the analysis succeeded
+    };
+
+    typedef std::unordered_map<const pandora::ParticleFlowObject *, ShowerPca> PfoToShowerPcaMap;
+
     void CreatePfo(const pandora::ParticleFlowObject *const pInputPfo, const pandora::ParticleFlowObject *&pOutputPfo) const;
+    void PrepareToCreatePfos(const pandora::PfoList &inputPfoList);
+    void FinishCreatingPfos();
+
+    /**
+     *  @brief  Whether a shower pfo should be built from an input pfo
+     *
+     *  @param  pInputPfo the address of the input pfo
+     *
+     *  @return boolean
+     */
+    bool IsShowerCandidate(const pandora::ParticleFlowObject *const pInputPfo) const;
+
+    /**
+     *  @brief  Get the shower pca for an input pfo, using the result calculated ahead of pfo creation if available
+     *
+     *  @param  pInputPfo the address of the input pfo
+     *  @param  pInputVertex the address of the input vertex
+     *
+     *  @return the shower pca
+     */
+    LArShowerPCA GetShowerPCA(const pandora::ParticleFlowObject *const pInputPfo, const pandora::Vertex *const pInputVertex) const;
+
+    /**
+     *  @brief  Calculate the shower pca for an input pfo
+     *
+     *  @param  pInputPfo the address of the input pfo
+     *  @param  pInputVertex the address of the input vertex
+     *
+     *  @return the shower pca
+     */
+    LArShowerPCA CalculateShowerPCA(const pandora::ParticleFlowObject *const pInputPfo, const pandora::Vertex *const pInputVertex) const;
 
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
-    unsigned int m_layerFitHalfWindow; ///<
+    unsigned int m_layerFitHalfWindow;     ///<
+    bool m_singlePassPca;                  ///< Whether to accumulate the shower pca in a single pass over the 3D hits, without a copy
+    unsigned int m_nPcaThreads;            ///< The number of threads for calculating shower pcas ahead of pfo creation, one to disable
+    PfoToShowerPcaMap m_pfoToShowerPcaMap; ///< The shower pcas calculated ahead of pfo creation
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -11,6 +11,7 @@
 #include "Managers/GeometryManager.h"
 
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
+#include "larpandoracontent/LArHelpers/LArParallelHelper.h"
 #include "larpandoracontent/LArHelpers/LArPfoHelper.h"
 
 #include "larpandoracontent/LArObjects/LArTrackPfo.h"
@@ -22,7 +23,7 @@ using namespace pandora;
 namespace lar_content
 {
 
-TrackParticleBuildingAlgorithm::TrackParticleBuildingAlgorithm() : m_slidingFitHalfWindow(20)
+TrackParticleBuildingAlgorithm::TrackParticleBuildingAlgorithm() : m_slidingFitHalfWindow(20), m_nTrajectoryThreads(1)
 {
 }
 
@@ -35,28 +36,12 @@ void TrackParticleBuildingAlgorithm::CreatePfo(const ParticleFlowObject *const p
         // Need an input vertex to provide a track propagation direction
         const Vertex *const pInputVertex = LArPfoHelper::GetVertex(pInputPfo);
 
-        // In cosmic mode, build tracks from all parent pfos, otherwise require that pfo is track-like
-        if (LArPfoHelper::IsNeutrinoFinalState(pInputPfo))
-        {
-            if (!LArPfoHelper::IsTrack(pInputPfo))
-                return;
-        }
-        else
-        {
-            if (!LArPfoHelper::IsFinalState(pInputPfo))
-                return;
-
-            if (LArPfoHelper::IsNeutrino(pInputPfo))
-                return;
-        }
-
-        // ATTN If wire w pitches vary between TPCs, exception will be raised in initialisation of lar pseudolayer plugin
-        const LArTPC *const pFirstLArTPC(this->GetPandora().GetGeometry()->GetLArTPCMap().begin()->second);
-        const float layerPitch(pFirstLArTPC->GetWirePitchW());
+        if (!this->IsTrackCandidate(pInputPfo))
+            return;
 
         // Calculate sliding fit trajectory
         LArTrackStateVector trackStateVector;
-        LArPfoHelper::GetSlidingFitTrajectory(pInputPfo, pInputVertex, m_slidingFitHalfWindow, layerPitch, trackStateVector);
+        this->GetSlidingFitTrajectory(pInputPfo, pInputVertex, trackStateVector);
 
         if (trackStateVector.empty())
             return;
@@ -102,11 +87,116 @@ void TrackParticleBuildingAlgorithm::CreatePfo(const ParticleFlowObject *const p
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void TrackParticleBuildingAlgorithm::PrepareToCreatePfos(const PfoList &inputPfoList)
+{
+    m_pfoToTrajectoryMap.clear();
+
+    if (1 == m_nTrajectoryThreads)
+        return;
+
+    // ATTN Trajectory calculation only reads the event, so pfos can be processed in parallel ahead of any pfo creation or deletion
+    const PfoVector pfoVector(inputPfoList.begin(), inputPfoList.end());
+    PfoVector candidatePfoVector(pfoVector.size(), nullptr);
+    std::vector<Trajectory> trajectoryVector(pfoVector.size());
+
+    LArParallelHelper::ForEach(pfoVector.size(), m_nTrajectoryThreads, [&](const unsigned int iPfo) {
+        const ParticleFlowObject *const pInputPfo(pfoVector.at(iPfo));
+        const Vertex *pInputVertex(nullptr);
+
+        try
+        {
+            if (pInputPfo->GetVertexList().empty() || !this->IsTrackCandidate(pInputPfo))
+                return;
+
+            pInputVertex = LArPfoHelper::GetVertex(pInputPfo);
+        }
+        catch (const StatusCodeException &)
+        {
+            return;
+        }
+
+        Trajectory &trajectory(trajectoryVector.at(iPfo));
+        trajectory.m_statusCode = STATUS_CODE_SUCCESS;
+
+        try
+        {
+            this->CalculateSlidingFitTrajectory(pInputPfo, pInputVertex, trajectory.m_trackStateVector);
+        }
+        catch (const StatusCodeException &statusCodeException)
+        {
+            trajectory.m_statusCode = statusCodeException.GetStatusCode();
+            trajectory.m_trackStateVector.clear();
+        }
+
+        candidatePfoVector.at(iPfo) = pInputPfo;
+    });
+
+    for (unsigned int iPfo = 0; iPfo < pfoVector.size(); ++iPfo)
+    {
+        if (candidatePfoVector.at(iPfo))
+            m_pfoToTrajectoryMap.emplace(candidatePfoVector.at(iPfo), std::move(trajectoryVector.at(iPfo)));
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void TrackParticleBuildingAlgorithm::FinishCreatingPfos()
+{
+    m_pfoToTrajectoryMap.clear();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool TrackParticleBuildingAlgorithm::IsTrackCandidate(const ParticleFlowObject *const pInputPfo) const
+{
+    // In cosmic mode, build tracks from all parent pfos, otherwise require that pfo is track-like
+    if (LArPfoHelper::IsNeutrinoFinalState(pInputPfo))
+        return LArPfoHelper::IsTrack(pInputPfo);
+
+    return (LArPfoHelper::IsFinalState(pInputPfo) && !LArPfoHelper::IsNeutrino(pInputPfo));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void TrackParticleBuildingAlgorithm::GetSlidingFitTrajectory(
+    const ParticleFlowObject *const pInputPfo, const Vertex *const pInputVertex, LArTrackStateVector &trackStateVector) const
+{
+    const PfoToTrajectoryMap::const_iterator iter(m_pfoToTrajectoryMap.find(pInputPfo));
+
+    if (m_pfoToTrajectoryMap.end() == iter)
+    {
+        this->CalculateSlidingFitTrajectory(pInputPfo, pInputVertex, trackStateVector);
+        return;
+    }
+
+    if (STATUS_CODE_SUCCESS != iter->second.m_statusCode)
+        throw StatusCodeException(iter->second.m_statusCode);
+
+    trackStateVector = iter->second.m_trackStateVector;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void TrackParticleBuildingAlgorithm::CalculateSlidingFitTrajectory(
+    const ParticleFlowObject *const pInputPfo, const Vertex *const pInputVertex, LArTrackStateVector &trackStateVector) const
+{
+    // ATTN If wire w pitches vary between TPCs, exception will be raised in initialisation of lar pseudolayer plugin
+    const LArTPC *const pFirstLArTPC(this->GetPandora().GetGeometry()->GetLArTPCMap().begin()->second);
+    const float layerPitch(pFirstLArTPC->GetWirePitchW());
+
+    LArPfoHelper::GetSlidingFitTrajectory(pInputPfo, pInputVertex, m_slidingFitHalfWindow, layerPitch, trackStateVector);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode TrackParticleBuildingAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
 {
     PANDORA_RETURN_RESULT_IF_AND_IF(
         STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "SlidingFitHalfWindow", m_slidingFitHalfWindow));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "NTrajectoryThreads", m_nTrajectoryThreads));
+
     return CustomParticleCreationAlgorithm::ReadSettings(xmlHandle);
 }
 
@@ -12,6 +12,8 @@
 
 #include "larpandoracontent/LArCustomParticles/CustomParticleCreationAlgorithm.h"
 
+#include <unordered_map>
+
 namespace lar_content
 {
 
@@ -27,11 +29,56 @@ public:
     TrackParticleBuildingAlgorithm();
 
 private:
+    /**
+     *  @brief  Trajectory class, holding the outcome of a sliding fit trajectory calculated ahead of pfo creation
+     */
+    class Trajectory
+    {
+    public:
+        pandora::StatusCode m_statusCode;       ///< The status code from the trajectory calculation
+        LArTrackStateVector m_trackStateVector; ///< The track state vector
+    };
+
+    typedef std::unordered_map<const pandora::ParticleFlowObject *, Trajectory> PfoToTrajectoryMap;
+
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
     void CreatePfo(const pandora::ParticleFlowObject *const pInputPfo, const pandora::ParticleFlowObject *&pOutputPfo) const;
+    void PrepareToCreatePfos(const pandora::PfoList &inputPfoList);
+    void FinishCreatingPfos();
+
+    /**
+     *  @brief  Whether a track pfo should be built from an input pfo
+     *
+     *  @param  pInputPfo the address of the input pfo
+     *
+     *  @return boolean
+     */
+    bool IsTrackCandidate(const pandora::ParticleFlowObject *const pInputPfo) const;
+
+    /**
+     *  @brief  Get the sliding fit trajectory for an input pfo, using the result calculated ahead of pfo creation if available
+     *
+     *  @param  pInputPfo the address of the input pfo
+     *  @param  pInputVertex the address of the input vertex
+     *  @param  trackStateVector to receive the track state vector
+     */
+    void GetSlidingFitTrajectory(const pandora::ParticleFlowObject *const pInputPfo, const pandora::Vertex *const pInputVertex,
+        LArTrackStateVector &trackStateVector) const;
+
+    /**
+     *  @brief  Calculate the sliding fit trajectory for an input pfo
+     *
+     *  @param  pInputPfo the address of the input pfo
+     *  @param  pInputVertex the address of the input vertex
+     *  @param  trackStateVector to receive the track state vector
+     */
+    void CalculateSlidingFitTrajectory(const pandora::ParticleFlowObject *const pInputPfo, const pandora::Vertex *const pInputVertex,
+        LArTrackStateVector &trackStateVector) const;
 
-    unsigned int m_slidingFitHalfWindow; ///<
+    unsigned int m_slidingFitHalfWindow;     ///<
+    unsigned int m_nTrajectoryThreads;       ///< The number of threads for calculating trajectories ahead of pfo creation, one to disable
+    PfoToTrajectoryMap m_pfoToTrajectoryMap; ///< The trajectories calculated ahead of pfo creation
 };
 
 } // namespace lar_content
@@ -0,0 +1,38 @@
+/**
+ *  @file   larpandoracontent/LArHelpers/LArCheatingIndexHelper.cc
+ *
+ *  @brief  Implementation of the cheating index helper class.
+ *
+ *  $Log: $
+ */
+
+#include "Pandora/AlgorithmHeaders.h"
+
+#include "larpandoracontent/LArHelpers/LArCheatingIndexHelper.h"
+
+using namespace pandora;
+
+namespace lar_content
+{
+
+LArCheatingIndexHelper::PandoraToCheatingIndexMap LArCheatingIndexHelper::m_pandoraToCheatingIndexMap;
+std::mutex LArCheatingIndexHelper::m_mutex;
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+CheatingIndex &LArCheatingIndexHelper::GetCheatingIndex(const Pandora &pandora)
+{
+    // ATTN The map is node-based, so the returned index remains valid as indices for other pandora instances are added
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_pandoraToCheatingIndexMap[&pandora];
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArCheatingIndexHelper::Reset(const Pandora &pandora)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_pandoraToCheatingIndexMap.erase(&pandora);
+}
+
+} // namespace lar_content
@@ -0,0 +1,50 @@
+/**
+ *  @file   larpandoracontent/LArHelpers/LArCheatingIndexHelper.h
+ *
+ *  @brief  Header file for the cheating index helper class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_CHEATING_INDEX_HELPER_H
+#define LAR_CHEATING_INDEX_HELPER_H 1
+
+#include "larpandoracontent/LArObjects/LArCheatingIndex.h"
+
+#include <mutex>
+#include <unordered_map>
+
+namespace lar_content
+{
+
+/**
+ *  @brief  LArCheatingIndexHelper class, sharing a cheating index between the cheating algorithms and tools within an event
+ */
+class LArCheatingIndexHelper
+{
+public:
+    /**
+     *  @brief  Get the cheating index for a pandora instance, creating an empty index if none yet exists for the current event
+     *
+     *  @param  pandora the pandora instance
+     *
+     *  @return the cheating index, valid until the cache is reset
+     */
+    static CheatingIndex &GetCheatingIndex(const pandora::Pandora &pandora);
+
+    /**
+     *  @brief  Remove the cheating index for a pandora instance, to be called at the end of each event
+     *
+     *  @param  pandora the pandora instance
+     */
+    static void Reset(const pandora::Pandora &pandora);
+
+private:
+    typedef std::unordered_map<const pandora::Pandora *, CheatingIndex> PandoraToCheatingIndexMap;
+
+    static PandoraToCheatingIndexMap m_pandoraToCheatingIndexMap; ///< The cheating index for each pandora instance
+    static std::mutex m_mutex;                                    ///< The mutex protecting the cheating indices
+};
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_CHEATING_INDEX_HELPER_H
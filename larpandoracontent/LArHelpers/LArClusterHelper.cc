@@ -18,6 +18,11 @@ using namespace pandora;
 namespace lar_content
 {
 
+thread_local unsigned int LArClusterHelper::m_nGeometryCacheScopes(0);
+thread_local LArClusterHelper::ClusterGeometryMap LArClusterHelper::m_clusterGeometryMap;
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 HitType LArClusterHelper::GetClusterHitType(const Cluster *const pCluster)
 {
     if (0 == pCluster->GetNCaloHits())
@@ -64,31 +69,16 @@ void LArClusterHelper::GetClustersByHitType(const ClusterList &inputClusters, co
 
 float LArClusterHelper::GetLengthSquared(const Cluster *const pCluster)
 {
-    const OrderedCaloHitList &orderedCaloHitList(pCluster->GetOrderedCaloHitList());
-
-    if (orderedCaloHitList.empty())
+    if (pCluster->GetOrderedCaloHitList().empty())
         throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
 
     // ATTN In 2D case, we will actually calculate the quadrature sum of deltaX and deltaU/V/W
-    float minX(std::numeric_limits<float>::max()), maxX(-std::numeric_limits<float>::max());
-    float minY(std::numeric_limits<float>::max()), maxY(-std::numeric_limits<float>::max());
-    float minZ(std::numeric_limits<float>::max()), maxZ(-std::numeric_limits<float>::max());
-
-    for (OrderedCaloHitList::const_iterator iter = orderedCaloHitList.begin(), iterEnd = orderedCaloHitList.end(); iter != iterEnd; ++iter)
-    {
-        for (CaloHitList::const_iterator hitIter = iter->second->begin(), hitIterEnd = iter->second->end(); hitIter != hitIterEnd; ++hitIter)
-        {
-            const CartesianVector &hitPosition((*hitIter)->GetPositionVector());
-            minX = std::min(hitPosition.GetX(), minX);
-            maxX = std::max(hitPosition.GetX(), maxX);
-            minY = std::min(hitPosition.GetY(), minY);
-            maxY = std::max(hitPosition.GetY(), maxY);
-            minZ = std::min(hitPosition.GetZ(), minZ);
-            maxZ = std::max(hitPosition.GetZ(), maxZ);
-        }
-    }
+    CartesianVector minimumCoordinate(0.f, 0.f, 0.f), maximumCoordinate(0.f, 0.f, 0.f);
+    LArClusterHelper::GetClusterBoundingBox(pCluster, minimumCoordinate, maximumCoordinate);
 
-    const float deltaX(maxX - minX), deltaY(maxY - minY), deltaZ(maxZ - minZ);
+    const float deltaX(maximumCoordinate.GetX() - minimumCoordinate.GetX());
+    const float deltaY(maximumCoordinate.GetY() - minimumCoordinate.GetY());
+    const float deltaZ(maximumCoordinate.GetZ() - minimumCoordinate.GetZ());
     return (deltaX * deltaX + deltaY * deltaY + deltaZ * deltaZ);
 }
 
@@ -148,12 +138,18 @@ float LArClusterHelper::GetClosestDistance(const ClusterList &clusterList1, cons
     if (clusterList1.empty() || clusterList2.empty())
         throw StatusCodeException(STATUS_CODE_NOT_FOUND);
 
+    HitPositionBlocksVector blocksVector2;
+    blocksVector2.reserve(clusterList2.size());
+
+    for (const Cluster *const pCluster2 : clusterList2)
+        blocksVector2.emplace_back(pCluster2);
+
     float closestDistance(std::numeric_limits<float>::max());
 
     for (ClusterList::const_iterator iter1 = clusterList1.begin(), iterEnd1 = clusterList1.end(); iter1 != iterEnd1; ++iter1)
     {
         const Cluster *const pCluster1 = *iter1;
-        const float thisDistance(LArClusterHelper::GetClosestDistance(pCluster1, clusterList2));
+        const float thisDistance(LArClusterHelper::GetClosestDistance(HitPositionBlocks(pCluster1), blocksVector2));
 
         if (thisDistance < closestDistance)
             closestDistance = thisDistance;
@@ -169,18 +165,13 @@ float LArClusterHelper::GetClosestDistance(const Cluster *const pCluster, const
     if (clusterList.empty())
         throw StatusCodeException(STATUS_CODE_NOT_FOUND);
 
-    float closestDistance(std::numeric_limits<float>::max());
+    HitPositionBlocksVector blocksVector;
+    blocksVector.reserve(clusterList.size());
 
-    for (ClusterList::const_iterator iter = clusterList.begin(), iterEnd = clusterList.end(); iter != iterEnd; ++iter)
-    {
-        const Cluster *const pTestCluster = *iter;
-        const float thisDistance(LArClusterHelper::GetClosestDistance(pCluster, pTestCluster));
+    for (const Cluster *const pTestCluster : clusterList)
+        blocksVector.emplace_back(pTestCluster);
 
-        if (thisDistance < closestDistance)
-            closestDistance = thisDistance;
-    }
-
-    return closestDistance;
+    return LArClusterHelper::GetClosestDistance(HitPositionBlocks(pCluster), blocksVector);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -307,54 +298,54 @@ CartesianVector LArClusterHelper::GetClosestPosition(const CartesianVector &posi
 void LArClusterHelper::GetClosestPositions(
     const Cluster *const pCluster1, const Cluster *const pCluster2, CartesianVector &outputPosition1, CartesianVector &outputPosition2)
 {
-    bool distanceFound(false);
-    float minDistanceSquared(std::numeric_limits<float>::max());
+    const HitPositionBlocks blocks1(pCluster1), blocks2(pCluster2);
+    unsigned int index1(0), index2(0);
 
-    CartesianVector closestPosition1(0.f, 0.f, 0.f);
-    CartesianVector closestPosition2(0.f, 0.f, 0.f);
+    if (!LArClusterHelper::FindClosestHitPair(blocks1, blocks2, std::numeric_limits<float>::max(), false, index1, index2))
+        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
 
-    const OrderedCaloHitList &orderedCaloHitList1(pCluster1->GetOrderedCaloHitList());
-    const OrderedCaloHitList &orderedCaloHitList2(pCluster2->GetOrderedCaloHitList());
+    outputPosition1 = blocks1.m_caloHits.at(index1)->GetPositionVector();
+    outputPosition2 = blocks2.m_caloHits.at(index2)->GetPositionVector();
+}
 
-    // Loop over hits in cluster 1
-    for (OrderedCaloHitList::const_iterator iter1 = orderedCaloHitList1.begin(), iter1End = orderedCaloHitList1.end(); iter1 != iter1End; ++iter1)
-    {
-        for (CaloHitList::const_iterator hitIter1 = iter1->second->begin(), hitIter1End = iter1->second->end(); hitIter1 != hitIter1End; ++hitIter1)
-        {
-            const CartesianVector &positionVector1((*hitIter1)->GetPositionVector());
+//------------------------------------------------------------------------------------------------------------------------------------------
 
-            // Loop over hits in cluster 2
-            for (OrderedCaloHitList::const_iterator iter2 = orderedCaloHitList2.begin(), iter2End = orderedCaloHitList2.end(); iter2 != iter2End; ++iter2)
-            {
-                for (CaloHitList::const_iterator hitIter2 = iter2->second->begin(), hitIter2End = iter2->second->end(); hitIter2 != hitIter2End; ++hitIter2)
-                {
-                    const CartesianVector &positionVector2((*hitIter2)->GetPositionVector());
+bool LArClusterHelper::IsCloserThan(const Cluster *const pCluster1, const Cluster *const pCluster2, const float distance)
+{
+    const HitPositionBlocks blocks1(pCluster1), blocks2(pCluster2);
 
-                    const float distanceSquared((positionVector1 - positionVector2).GetMagnitudeSquared());
+    if ((0 == blocks1.GetNHits()) || (0 == blocks2.GetNHits()))
+        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
 
-                    if (distanceSquared < minDistanceSquared)
-                    {
-                        minDistanceSquared = distanceSquared;
-                        closestPosition1 = positionVector1;
-                        closestPosition2 = positionVector2;
-                        distanceFound = true;
-                    }
-                }
-            }
-        }
-    }
+    if (!(distance > 0.f))
+        return false;
 
-    if (!distanceFound)
-        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
+    // ATTN Use the smallest squared distance whose square root is not less than the distance, so results match GetClosestDistance
+    float maxDistanceSquared(distance * distance);
+
+    while (std::sqrt(maxDistanceSquared) < distance)
+        maxDistanceSquared = std::nextafter(maxDistanceSquared, std::numeric_limits<float>::infinity());
+
+    while ((maxDistanceSquared > 0.f) && (std::sqrt(std::nextafter(maxDistanceSquared, 0.f)) >= distance))
+        maxDistanceSquared = std::nextafter(maxDistanceSquared, 0.f);
 
-    outputPosition1 = closestPosition1;
-    outputPosition2 = closestPosition2;
+    unsigned int index1(0), index2(0);
+    return LArClusterHelper::FindClosestHitPair(blocks1, blocks2, maxDistanceSquared, true, index1, index2);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void LArClusterHelper::GetClusterBoundingBox(const Cluster *const pCluster, CartesianVector &minimumCoordinate, CartesianVector &maximumCoordinate)
 {
+    ClusterGeometry *const pClusterGeometry(LArClusterHelper::GetCachedGeometry(pCluster));
+
+    if (pClusterGeometry && pClusterGeometry->m_hasBoundingBox)
+    {
+        minimumCoordinate = pClusterGeometry->m_minimumCoordinate;
+        maximumCoordinate = pClusterGeometry->m_maximumCoordinate;
+        return;
+    }
+
     const OrderedCaloHitList &orderedCaloHitList(pCluster->GetOrderedCaloHitList());
 
     float xmin(std::numeric_limits<float>::max());
@@ -381,6 +372,30 @@ void LArClusterHelper::GetClusterBoundingBox(const Cluster *const pCluster, Cart
 
     minimumCoordinate.SetValues(xmin, ymin, zmin);
     maximumCoordinate.SetValues(xmax, ymax, zmax);
+
+    if (pClusterGeometry)
+    {
+        pClusterGeometry->m_minimumCoordinate = minimumCoordinate;
+        pClusterGeometry->m_maximumCoordinate = maximumCoordinate;
+        pClusterGeometry->m_hasBoundingBox = true;
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+float LArClusterHelper::GetBoundingBoxDistance(const CartesianVector &position, const Cluster *const pCluster)
+{
+    if (0 == pCluster->GetNCaloHits())
+        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
+
+    CartesianVector minimumCoordinate(0.f, 0.f, 0.f), maximumCoordinate(0.f, 0.f, 0.f);
+    LArClusterHelper::GetClusterBoundingBox(pCluster, minimumCoordinate, maximumCoordinate);
+
+    const float dx(std::max(0.f, std::max(minimumCoordinate.GetX() - position.GetX(), position.GetX() - maximumCoordinate.GetX())));
+    const float dy(std::max(0.f, std::max(minimumCoordinate.GetY() - position.GetY(), position.GetY() - maximumCoordinate.GetY())));
+    const float dz(std::max(0.f, std::max(minimumCoordinate.GetZ() - position.GetZ(), position.GetZ() - maximumCoordinate.GetZ())));
+
+    return std::sqrt(dx * dx + dy * dy + dz * dz);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -438,7 +453,23 @@ void LArClusterHelper::GetExtremalCoordinates(const ClusterList &clusterList, Ca
 
 void LArClusterHelper::GetExtremalCoordinates(const Cluster *const pCluster, CartesianVector &innerCoordinate, CartesianVector &outerCoordinate)
 {
-    return LArClusterHelper::GetExtremalCoordinates(pCluster->GetOrderedCaloHitList(), innerCoordinate, outerCoordinate);
+    ClusterGeometry *const pClusterGeometry(LArClusterHelper::GetCachedGeometry(pCluster));
+
+    if (pClusterGeometry && pClusterGeometry->m_hasExtremalCoordinates)
+    {
+        innerCoordinate = pClusterGeometry->m_innerCoordinate;
+        outerCoordinate = pClusterGeometry->m_outerCoordinate;
+        return;
+    }
+
+    LArClusterHelper::GetExtremalCoordinates(pCluster->GetOrderedCaloHitList(), innerCoordinate, outerCoordinate);
+
+    if (pClusterGeometry)
+    {
+        pClusterGeometry->m_innerCoordinate = innerCoordinate;
+        pClusterGeometry->m_outerCoordinate = outerCoordinate;
+        pClusterGeometry->m_hasExtremalCoordinates = true;
+    }
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -572,12 +603,43 @@ void LArClusterHelper::GetExtremalCoordinates(const CartesianPointVector &coordi
 
 void LArClusterHelper::GetCoordinateVector(const Cluster *const pCluster, CartesianPointVector &coordinateVector)
 {
-    for (const OrderedCaloHitList::value_type &layerEntry : pCluster->GetOrderedCaloHitList())
+    ClusterGeometry *const pClusterGeometry(LArClusterHelper::GetCachedGeometry(pCluster));
+
+    if (!pClusterGeometry)
     {
-        for (const CaloHit *const pCaloHit : *layerEntry.second)
-            coordinateVector.push_back(pCaloHit->GetPositionVector());
+        for (const OrderedCaloHitList::value_type &layerEntry : pCluster->GetOrderedCaloHitList())
+        {
+            for (const CaloHit *const pCaloHit : *layerEntry.second)
+                coordinateVector.push_back(pCaloHit->GetPositionVector());
+        }
+
+        std::sort(coordinateVector.begin(), coordinateVector.end(), LArClusterHelper::SortCoordinatesByPosition);
+        return;
+    }
+
+    if (!pClusterGeometry->m_hasCoordinateVector)
+    {
+        for (const OrderedCaloHitList::value_type &layerEntry : pCluster->GetOrderedCaloHitList())
+        {
+            for (const CaloHit *const pCaloHit : *layerEntry.second)
+                pClusterGeometry->m_coordinateVector.push_back(pCaloHit->GetPositionVector());
+        }
+
+        pClusterGeometry->m_sortedCoordinateVector = pClusterGeometry->m_coordinateVector;
+        std::sort(pClusterGeometry->m_sortedCoordinateVector.begin(), pClusterGeometry->m_sortedCoordinateVector.end(),
+            LArClusterHelper::SortCoordinatesByPosition);
+        pClusterGeometry->m_hasCoordinateVector = true;
+    }
+
+    // ATTN The sort tolerates small coordinate differences, so only reuse the sorted coordinates when they are not to be combined
+    if (coordinateVector.empty())
+    {
+        coordinateVector = pClusterGeometry->m_sortedCoordinateVector;
+        return;
     }
 
+    const CartesianPointVector &clusterCoordinateVector(pClusterGeometry->m_coordinateVector);
+    coordinateVector.insert(coordinateVector.end(), clusterCoordinateVector.begin(), clusterCoordinateVector.end());
     std::sort(coordinateVector.begin(), coordinateVector.end(), LArClusterHelper::SortCoordinatesByPosition);
 }
 
@@ -781,4 +843,251 @@ bool LArClusterHelper::SortCoordinatesByPosition(const CartesianVector &lhs, con
     return (deltaPosition.GetY() > std::numeric_limits<float>::epsilon());
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArClusterHelper::ClusterGeometry *LArClusterHelper::GetCachedGeometry(const Cluster *const pCluster)
+{
+    if (0 == m_nGeometryCacheScopes)
+        return nullptr;
+
+    ClusterGeometryMap::iterator iter(m_clusterGeometryMap.find(pCluster));
+
+    if (m_clusterGeometryMap.end() != iter)
+    {
+        if (iter->second.IsUpToDate(pCluster))
+            return &iter->second;
+
+        m_clusterGeometryMap.erase(iter);
+    }
+
+    return &m_clusterGeometryMap.insert(ClusterGeometryMap::value_type(pCluster, ClusterGeometry(pCluster))).first->second;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool LArClusterHelper::FindClosestHitPair(const HitPositionBlocks &blocks1, const HitPositionBlocks &blocks2,
+    const float maxDistanceSquared, const bool stopAtFirstPair, unsigned int &index1, unsigned int &index2)
+{
+    bool distanceFound(false);
+    float minDistanceSquared(maxDistanceSquared);
+
+    const unsigned int nHits1(blocks1.GetNHits()), nHits2(blocks2.GetNHits());
+    std::vector<unsigned int> candidateBlocks2;
+    candidateBlocks2.reserve(blocks2.GetNBlocks());
+
+    for (unsigned int iBlock1 = 0; iBlock1 < blocks1.GetNBlocks(); ++iBlock1)
+    {
+        // ATTN Blocks are only skipped if they cannot hold a strictly closer pair of hits, so the closest pair matches a full search
+        candidateBlocks2.clear();
+
+        for (unsigned int iBlock2 = 0; iBlock2 < blocks2.GetNBlocks(); ++iBlock2)
+        {
+            if (blocks1.GetMinDistanceSquared(iBlock1, blocks2, iBlock2) < minDistanceSquared)
+                candidateBlocks2.push_back(iBlock2);
+        }
+
+        const unsigned int begin1(iBlock1 * HitPositionBlocks::N_HITS_PER_BLOCK);
+        const unsigned int end1(std::min(begin1 + HitPositionBlocks::N_HITS_PER_BLOCK, nHits1));
+
+        for (unsigned int i1 = begin1; i1 < end1; ++i1)
+        {
+            const float x1(blocks1.m_x[i1]), y1(blocks1.m_y[i1]), z1(blocks1.m_z[i1]);
+
+            for (const unsigned int iBlock2 : candidateBlocks2)
+            {
+                if (blocks2.GetMinDistanceSquared(iBlock2, x1, y1, z1) >= minDistanceSquared)
+                    continue;
+
+                const unsigned int begin2(iBlock2 * HitPositionBlocks::N_HITS_PER_BLOCK);
+                const unsigned int end2(std::min(begin2 + HitPositionBlocks::N_HITS_PER_BLOCK, nHits2));
+
+                for (unsigned int i2 = begin2; i2 < end2; ++i2)
+                {
+                    const float dx(x1 - blocks2.m_x[i2]), dy(y1 - blocks2.m_y[i2]), dz(z1 - blocks2.m_z[i2]);
+                    const float distanceSquared(dx * dx + dy * dy + dz * dz);
+
+                    if (distanceSquared < minDistanceSquared)
+                    {
+                        minDistanceSquared = distanceSquared;
+                        index1 = i1;
+                        index2 = i2;
+                        distanceFound = true;
+
+                        if (stopAtFirstPair)
+                            return true;
+                    }
+                }
+            }
+        }
+    }
+
+    return distanceFound;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+float LArClusterHelper::GetClosestDistance(const HitPositionBlocks &blocks1, const HitPositionBlocks &blocks2)
+{
+    unsigned int index1(0), index2(0);
+
+    if (!LArClusterHelper::FindClosestHitPair(blocks1, blocks2, std::numeric_limits<float>::max(), false, index1, index2))
+        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
+
+    return (blocks1.m_caloHits.at(index1)->GetPositionVector() - blocks2.m_caloHits.at(index2)->GetPositionVector()).GetMagnitude();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+float LArClusterHelper::GetClosestDistance(const HitPositionBlocks &blocks, const HitPositionBlocksVector &blocksVector)
+{
+    float closestDistance(std::numeric_limits<float>::max());
+
+    for (const HitPositionBlocks &testBlocks : blocksVector)
+    {
+        // ATTN Skip clusters that cannot be closer than the closest found so far, retaining the exception for clusters without hits
+        if ((blocks.GetNHits() > 0) && (testBlocks.GetNHits() > 0) && (blocks.GetMinDistance(testBlocks) >= closestDistance))
+            continue;
+
+        const float thisDistance(LArClusterHelper::GetClosestDistance(blocks, testBlocks));
+
+        if (thisDistance < closestDistance)
+            closestDistance = thisDistance;
+    }
+
+    return closestDistance;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArClusterHelper::GeometryCacheScope::GeometryCacheScope()
+{
+    ++m_nGeometryCacheScopes;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArClusterHelper::GeometryCacheScope::~GeometryCacheScope()
+{
+    if (0 == --m_nGeometryCacheScopes)
+        m_clusterGeometryMap.clear();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArClusterHelper::ClusterGeometry::ClusterGeometry(const Cluster *const pCluster) :
+    m_nCaloHits(pCluster->GetNCaloHits()),
+    m_innerLayer(pCluster->GetNCaloHits() > 0 ? pCluster->GetInnerPseudoLayer() : 0),
+    m_outerLayer(pCluster->GetNCaloHits() > 0 ? pCluster->GetOuterPseudoLayer() : 0),
+    m_electromagneticEnergy(pCluster->GetElectromagneticEnergy()),
+    m_hadronicEnergy(pCluster->GetHadronicEnergy()),
+    m_hasBoundingBox(false),
+    m_minimumCoordinate(0.f, 0.f, 0.f),
+    m_maximumCoordinate(0.f, 0.f, 0.f),
+    m_hasExtremalCoordinates(false),
+    m_innerCoordinate(0.f, 0.f, 0.f),
+    m_outerCoordinate(0.f, 0.f, 0.f),
+    m_hasCoordinateVector(false)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool LArClusterHelper::ClusterGeometry::IsUpToDate(const Cluster *const pCluster) const
+{
+    const unsigned int nCaloHits(pCluster->GetNCaloHits());
+    const unsigned int innerLayer(nCaloHits > 0 ? pCluster->GetInnerPseudoLayer() : 0);
+    const unsigned int outerLayer(nCaloHits > 0 ? pCluster->GetOuterPseudoLayer() : 0);
+
+    return ((m_nCaloHits == nCaloHits) && (m_innerLayer == innerLayer) && (m_outerLayer == outerLayer) &&
+        (m_electromagneticEnergy == pCluster->GetElectromagneticEnergy()) && (m_hadronicEnergy == pCluster->GetHadronicEnergy()));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArClusterHelper::HitPositionBlocks::HitPositionBlocks(const Cluster *const pCluster)
+{
+    const unsigned int nCaloHits(pCluster->GetNCaloHits());
+    m_caloHits.reserve(nCaloHits);
+    m_x.reserve(nCaloHits);
+    m_y.reserve(nCaloHits);
+    m_z.reserve(nCaloHits);
+
+    for (const OrderedCaloHitList::value_type &layerEntry : pCluster->GetOrderedCaloHitList())
+    {
+        for (const CaloHit *const pCaloHit : *layerEntry.second)
+        {
+            const CartesianVector &position(pCaloHit->GetPositionVector());
+            m_caloHits.push_back(pCaloHit);
+            m_x.push_back(position.GetX());
+            m_y.push_back(position.GetY());
+            m_z.push_back(position.GetZ());
+        }
+    }
+
+    const unsigned int nHits(this->GetNHits());
+
+    for (unsigned int begin = 0; begin < nHits; begin += N_HITS_PER_BLOCK)
+    {
+        const unsigned int end(std::min(begin + N_HITS_PER_BLOCK, nHits));
+        m_minX.push_back(*std::min_element(m_x.begin() + begin, m_x.begin() + end));
+        m_maxX.push_back(*std::max_element(m_x.begin() + begin, m_x.begin() + end));
+        m_minY.push_back(*std::min_element(m_y.begin() + begin, m_y.begin() + end));
+        m_maxY.push_back(*std::max_element(m_y.begin() + begin, m_y.begin() + end));
+        m_minZ.push_back(*std::min_element(m_z.begin() + begin, m_z.begin() + end));
+        m_maxZ.push_back(*std::max_element(m_z.begin() + begin, m_z.begin() + end));
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+float LArClusterHelper::HitPositionBlocks::GetMinDistanceSquared(
+    const unsigned int iBlock, const float x, const float y, const float z) const
+{
+    const float dx(std::max(0.f, std::max(m_minX[iBlock] - x, x - m_maxX[iBlock])));
+    const float dy(std::max(0.f, std::max(m_minY[iBlock] - y, y - m_maxY[iBlock])));
+    const float dz(std::max(0.f, std::max(m_minZ[iBlock] - z, z - m_maxZ[iBlock])));
+
+    return (dx * dx + dy * dy + dz * dz);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+float LArClusterHelper::HitPositionBlocks::GetMinDistanceSquared(
+    const unsigned int iBlock, const HitPositionBlocks &other, const unsigned int iOtherBlock) const
+{
+    const float dx(std::max(0.f, std::max(other.m_minX[iOtherBlock] - m_maxX[iBlock], m_minX[iBlock] - other.m_maxX[iOtherBlock])));
+    const float dy(std::max(0.f, std::max(other.m_minY[iOtherBlock] - m_maxY[iBlock], m_minY[iBlock] - other.m_maxY[iOtherBlock])));
+    const float dz(std::max(0.f, std::max(other.m_minZ[iOtherBlock] - m_maxZ[iBlock], m_minZ[iBlock] - other.m_maxZ[iOtherBlock])));
+
+    return (dx * dx + dy * dy + dz * dz);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+float LArClusterHelper::HitPositionBlocks::GetMinDistance(const HitPositionBlocks &other) const
+{
+    if ((0 == this->GetNBlocks()) || (0 == other.GetNBlocks()))
+        return 0.f;
+
+    const float minX(*std::min_element(m_minX.begin(), m_minX.end())), maxX(*std::max_element(m_maxX.begin(), m_maxX.end()));
+    const float minY(*std::min_element(m_minY.begin(), m_minY.end())), maxY(*std::max_element(m_maxY.begin(), m_maxY.end()));
+    const float minZ(*std::min_element(m_minZ.begin(), m_minZ.end())), maxZ(*std::max_element(m_maxZ.begin(), m_maxZ.end()));
+
+    const float otherMinX(*std::min_element(other.m_minX.begin(), other.m_minX.end()));
+    const float otherMaxX(*std::max_element(other.m_maxX.begin(), other.m_maxX.end()));
+    const float otherMinY(*std::min_element(other.m_minY.begin(), other.m_minY.end()));
+    const float otherMaxY(*std::max_element(other.m_maxY.begin(), other.m_maxY.end()));
+    const float otherMinZ(*std::min_element(other.m_minZ.begin(), other.m_minZ.end()));
+    const float otherMaxZ(*std::max_element(other.m_maxZ.begin(), other.m_maxZ.end()));
+
+    const float dx(std::max(0.f, std::max(otherMinX - maxX, minX - otherMaxX)));
+    const float dy(std::max(0.f, std::max(otherMinY - maxY, minY - otherMaxY)));
+    const float dz(std::max(0.f, std::max(otherMinZ - maxZ, minZ - otherMaxZ)));
+
+    return std::sqrt(dx * dx + dy * dy + dz * dz);
+}
+
 } // namespace lar_content
@@ -10,6 +10,8 @@
 
 #include "Objects/Cluster.h"
 
+#include <unordered_map>
+
 namespace lar_content
 {
 
@@ -21,6 +23,29 @@ class LArClusterHelper
 public:
     typedef std::set<unsigned int> UIntSet;
 
+    /**
+     *  @brief  GeometryCacheScope class. While any instance exists on a thread, the cluster bounding boxes, extremal coordinates and
+     *          coordinate vectors calculated by this helper on that thread are cached, keyed by cluster address. Cached values are
+     *          recalculated if the cluster has since been modified, as judged by its number of hits, pseudo layer range and energy.
+     *          The cache is cleared when the last instance on the thread is destroyed.
+     */
+    class GeometryCacheScope
+    {
+    public:
+        /**
+         *  @brief  Default constructor
+         */
+        GeometryCacheScope();
+
+        /**
+         *  @brief  Destructor
+         */
+        ~GeometryCacheScope();
+
+        GeometryCacheScope(const GeometryCacheScope &) = delete;
+        GeometryCacheScope &operator=(const GeometryCacheScope &) = delete;
+    };
+
     /**
      *  @brief  Get the hit type associated with a two dimensional cluster
      *
@@ -216,6 +241,18 @@ public:
     static void GetClosestPositions(const pandora::Cluster *const pCluster1, const pandora::Cluster *const pCluster2,
         pandora::CartesianVector &position1, pandora::CartesianVector &position2);
 
+    /**
+     *  @brief  Whether the closest distance between a pair of clusters is less than a specified distance, equivalent to comparing the
+     *          result of GetClosestDistance with the distance, but returning as soon as any sufficiently close pair of hits is found
+     *
+     *  @param  pCluster1 address of the first cluster
+     *  @param  pCluster2 address of the second cluster
+     *  @param  distance the distance
+     *
+     *  @return boolean
+     */
+    static bool IsCloserThan(const pandora::Cluster *const pCluster1, const pandora::Cluster *const pCluster2, const float distance);
+
     /**
      *  @brief  Get positions of the two most distant calo hits in a list of cluster (ordered by Z)
      *
@@ -266,6 +303,17 @@ public:
     static void GetClusterBoundingBox(
         const pandora::Cluster *const pCluster, pandora::CartesianVector &minimumCoordinate, pandora::CartesianVector &maximumCoordinate);
 
+    /**
+     *  @brief  Get the distance between a position and the bounding box of the calo hits in a cluster, zero if the position is inside
+     *          the box. This is a lower bound on the closest distance between the position and the cluster.
+     *
+     *  @param  position the position
+     *  @param  pCluster address of the cluster
+     *
+     *  @return the bounding box distance
+     */
+    static float GetBoundingBoxDistance(const pandora::CartesianVector &position, const pandora::Cluster *const pCluster);
+
     /**
      *  @brief  Get vector of hit coordinates from an input cluster
      *
@@ -384,8 +432,190 @@ public:
      *  @param  rhs second point
      */
     static bool SortCoordinatesByPosition(const pandora::CartesianVector &lhs, const pandora::CartesianVector &rhs);
+
+private:
+    /**
+     *  @brief  ClusterGeometry class, holding the cached geometry properties of a cluster and the cluster properties used to identify
+     *          modified clusters
+     */
+    class ClusterGeometry
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  pCluster address of the cluster
+         */
+        ClusterGeometry(const pandora::Cluster *const pCluster);
+
+        /**
+         *  @brief  Whether the cached properties remain valid for a cluster, i.e. whether the cluster appears unmodified
+         *
+         *  @param  pCluster address of the cluster
+         *
+         *  @return boolean
+         */
+        bool IsUpToDate(const pandora::Cluster *const pCluster) const;
+
+        unsigned int m_nCaloHits;                               ///< The number of calo hits
+        unsigned int m_innerLayer;                              ///< The inner pseudo layer
+        unsigned int m_outerLayer;                              ///< The outer pseudo layer
+        float m_electromagneticEnergy;                          ///< The electromagnetic energy
+        float m_hadronicEnergy;                                 ///< The hadronic energy
+        bool m_hasBoundingBox;                                  ///< Whether the bounding box has been cached
+        pandora::CartesianVector m_minimumCoordinate;           ///< The bounding box minimum coordinate
+        pandora::CartesianVector m_maximumCoordinate;           ///< The bounding box maximum coordinate
+        bool m_hasExtremalCoordinates;                          ///< Whether the extremal coordinates have been cached
+        pandora::CartesianVector m_innerCoordinate;             ///< The inner extremal coordinate
+        pandora::CartesianVector m_outerCoordinate;             ///< The outer extremal coordinate
+        bool m_hasCoordinateVector;                             ///< Whether the coordinate vectors have been cached
+        pandora::CartesianPointVector m_coordinateVector;       ///< The coordinate vector, in ordered calo hit list order
+        pandora::CartesianPointVector m_sortedCoordinateVector; ///< The coordinate vector, sorted by position
+    };
+
+    typedef std::unordered_map<const pandora::Cluster *, ClusterGeometry> ClusterGeometryMap;
+
+    /**
+     *  @brief  Get the cached geometry properties for a cluster, discarding any that are out of date
+     *
+     *  @param  pCluster address of the cluster
+     *
+     *  @return address of the cached geometry properties, or nullptr if there is no geometry cache scope on the current thread
+     */
+    static ClusterGeometry *GetCachedGeometry(const pandora::Cluster *const pCluster);
+
+    static thread_local unsigned int m_nGeometryCacheScopes;     ///< The number of geometry cache scopes on the current thread
+    static thread_local ClusterGeometryMap m_clusterGeometryMap; ///< The cached cluster geometry properties for the current thread
+
+    /**
+     *  @brief  HitPositionBlocks class, holding the hit positions of a cluster in contiguous arrays, in ordered calo hit list order.
+     *          The hits are divided into consecutive blocks, each with a bounding box, so that closest distance searches can skip any
+     *          block that cannot contain a closer hit.
+     */
+    class HitPositionBlocks
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  pCluster address of the cluster
+         */
+        HitPositionBlocks(const pandora::Cluster *const pCluster);
+
+        /**
+         *  @brief  Get the number of hits
+         *
+         *  @return the number of hits
+         */
+        unsigned int GetNHits() const;
+
+        /**
+         *  @brief  Get the number of blocks
+         *
+         *  @return the number of blocks
+         */
+        unsigned int GetNBlocks() const;
+
+        /**
+         *  @brief  Get a lower bound on the squared distance between a position and any hit in a block, never exceeding the squared
+         *          distance calculated for any such hit
+         *
+         *  @param  iBlock the block index
+         *  @param  x the position x coordinate
+         *  @param  y the position y coordinate
+         *  @param  z the position z coordinate
+         *
+         *  @return the lower bound on the squared distance
+         */
+        float GetMinDistanceSquared(const unsigned int iBlock, const float x, const float y, const float z) const;
+
+        /**
+         *  @brief  Get a lower bound on the squared distance between any hit in a block and any hit in a block of another instance
+         *
+         *  @param  iBlock the block index
+         *  @param  other the other instance
+         *  @param  iOtherBlock the block index in the other instance
+         *
+         *  @return the lower bound on the squared distance
+         */
+        float GetMinDistanceSquared(const unsigned int iBlock, const HitPositionBlocks &other, const unsigned int iOtherBlock) const;
+
+        /**
+         *  @brief  Get a lower bound on the distance between any hit in this instance and any hit in another instance
+         *
+         *  @param  other the other instance
+         *
+         *  @return the lower bound on the distance
+         */
+        float GetMinDistance(const HitPositionBlocks &other) const;
+
+        static const unsigned int N_HITS_PER_BLOCK = 16; ///< The number of hits per block (the last block may hold fewer)
+
+        pandora::CaloHitVector m_caloHits; ///< The calo hits, in ordered calo hit list order
+        pandora::FloatVector m_x;          ///< The hit x coordinates
+        pandora::FloatVector m_y;          ///< The hit y coordinates
+        pandora::FloatVector m_z;          ///< The hit z coordinates
+        pandora::FloatVector m_minX;       ///< The minimum x coordinate in each block
+        pandora::FloatVector m_maxX;       ///< The maximum x coordinate in each block
+        pandora::FloatVector m_minY;       ///< The minimum y coordinate in each block
+        pandora::FloatVector m_maxY;       ///< The maximum y coordinate in each block
+        pandora::FloatVector m_minZ;       ///< The minimum z coordinate in each block
+        pandora::FloatVector m_maxZ;       ///< The maximum z coordinate in each block
+    };
+
+    typedef std::vector<HitPositionBlocks> HitPositionBlocksVector;
+
+    /**
+     *  @brief  Find the closest pair of hits between two clusters, considering the hits of the first cluster in order and, for each,
+     *          the hits of the second cluster in order, and recording a pair only if strictly closer than all pairs before it
+     *
+     *  @param  blocks1 the hit position blocks for the first cluster
+     *  @param  blocks2 the hit position blocks for the second cluster
+     *  @param  maxDistanceSquared the squared distance below which pairs of hits are considered
+     *  @param  stopAtFirstPair whether to stop at the first pair of hits recorded
+     *  @param  index1 to receive the index of the closest hit in the first cluster
+     *  @param  index2 to receive the index of the closest hit in the second cluster
+     *
+     *  @return whether a pair of hits was recorded
+     */
+    static bool FindClosestHitPair(const HitPositionBlocks &blocks1, const HitPositionBlocks &blocks2, const float maxDistanceSquared,
+        const bool stopAtFirstPair, unsigned int &index1, unsigned int &index2);
+
+    /**
+     *  @brief  Get closest distance between a pair of clusters, described by their hit position blocks
+     *
+     *  @param  blocks1 the hit position blocks for the first cluster
+     *  @param  blocks2 the hit position blocks for the second cluster
+     *
+     *  @return the closest distance
+     */
+    static float GetClosestDistance(const HitPositionBlocks &blocks1, const HitPositionBlocks &blocks2);
+
+    /**
+     *  @brief  Get closest distance between a cluster and a list of clusters, described by their hit position blocks
+     *
+     *  @param  blocks the hit position blocks for the cluster
+     *  @param  blocksVector the hit position blocks for each cluster in the list
+     *
+     *  @return the closest distance
+     */
+    static float GetClosestDistance(const HitPositionBlocks &blocks, const HitPositionBlocksVector &blocksVector);
 };
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline unsigned int LArClusterHelper::HitPositionBlocks::GetNHits() const
+{
+    return static_cast<unsigned int>(m_caloHits.size());
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline unsigned int LArClusterHelper::HitPositionBlocks::GetNBlocks() const
+{
+    return static_cast<unsigned int>(m_minX.size());
+}
+
 } // namespace lar_content
 
 #endif // #ifndef LAR_CLUSTER_HELPER_H
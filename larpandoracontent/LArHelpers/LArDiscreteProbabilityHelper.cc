@@ -8,6 +8,9 @@
 #include "Pandora/PandoraInternal.h"
 
 #include "larpandoracontent/LArHelpers/LArDiscreteProbabilityHelper.h"
+#include "larpandoracontent/LArHelpers/LArParallelHelper.h"
+
+#include <atomic>
 
 namespace lar_content
 {
@@ -37,6 +40,49 @@ float LArDiscreteProbabilityHelper::CalculateCorrelationCoefficientPValueFromPer
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+template <typename T>
+float LArDiscreteProbabilityHelper::CalculateCorrelationCoefficientPValueFromPermutationTest(
+    const T &t1, const T &t2, const std::uint64_t seed, const unsigned int nPermutations, const unsigned int nThreads)
+{
+    if (1 > nPermutations)
+        throw pandora::StatusCodeException(pandora::STATUS_CODE_INVALID_PARAMETER);
+
+    const float rNominal(LArDiscreteProbabilityHelper::CalculateCorrelationCoefficient(t1, t2));
+
+    pandora::FloatVector deviations1, deviations2;
+    LArDiscreteProbabilityHelper::GetDeviationsFromMean(t1, deviations1);
+    LArDiscreteProbabilityHelper::GetDeviationsFromMean(t2, deviations2);
+
+    const unsigned int nExtreme(
+        LArDiscreteProbabilityHelper::CountExtremePermutations(deviations1, deviations2, rNominal, seed, nPermutations, nThreads, -1.f));
+
+    return static_cast<float>(nExtreme) / static_cast<float>(nPermutations);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+bool LArDiscreteProbabilityHelper::IsCorrelationCoefficientPValueBelowThreshold(const T &t1, const T &t2, const float pValueThreshold,
+    const std::uint64_t seed, const unsigned int nPermutations, const unsigned int nThreads)
+{
+    if ((1 > nPermutations) || (pValueThreshold < 0.f))
+        throw pandora::StatusCodeException(pandora::STATUS_CODE_INVALID_PARAMETER);
+
+    const float rNominal(LArDiscreteProbabilityHelper::CalculateCorrelationCoefficient(t1, t2));
+
+    pandora::FloatVector deviations1, deviations2;
+    LArDiscreteProbabilityHelper::GetDeviationsFromMean(t1, deviations1);
+    LArDiscreteProbabilityHelper::GetDeviationsFromMean(t2, deviations2);
+
+    // ATTN: Any permutations skipped cannot change the outcome, so the comparison is identical to that using the full p-value
+    const unsigned int nExtreme(LArDiscreteProbabilityHelper::CountExtremePermutations(
+        deviations1, deviations2, rNominal, seed, nPermutations, nThreads, pValueThreshold));
+
+    return ((static_cast<float>(nExtreme) / static_cast<float>(nPermutations)) < pValueThreshold);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template <typename T>
 float LArDiscreteProbabilityHelper::CalculateCorrelationCoefficientPValueFromStudentTDistribution(
     const T &t1, const T &t2, const unsigned int nIntegrationSteps, const float upperLimit)
@@ -124,11 +170,111 @@ float LArDiscreteProbabilityHelper::CalculateMean(const T &t)
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+template <typename T>
+void LArDiscreteProbabilityHelper::GetDeviationsFromMean(const T &t, pandora::FloatVector &deviations)
+{
+    const unsigned int size(LArDiscreteProbabilityHelper::GetSize(t));
+    const float mean(LArDiscreteProbabilityHelper::CalculateMean(t));
+
+    deviations.reserve(size);
+
+    for (unsigned int iElement = 0; iElement < size; ++iElement)
+        deviations.push_back(LArDiscreteProbabilityHelper::GetElement(t, iElement) - mean);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+unsigned int LArDiscreteProbabilityHelper::CountExtremePermutations(const pandora::FloatVector &deviations1,
+    const pandora::FloatVector &deviations2, const float rNominal, const std::uint64_t seed, const unsigned int nPermutations,
+    const unsigned int nThreads, const float pValueThreshold)
+{
+    const unsigned int size(deviations1.size());
+
+    if ((size != deviations2.size()) || (2 > size))
+        throw pandora::StatusCodeException(pandora::STATUS_CODE_INVALID_PARAMETER);
+
+    // ATTN: Variances are unchanged by permutation, so only the covariance need be recalculated for each permutation
+    float variance1(0.f), variance2(0.f);
+
+    for (unsigned int iElement = 0; iElement < size; ++iElement)
+    {
+        variance1 += deviations1[iElement] * deviations1[iElement];
+        variance2 += deviations2[iElement] * deviations2[iElement];
+    }
+
+    const float sqrtVars(std::sqrt(variance1 * variance2));
+    if (sqrtVars < std::numeric_limits<float>::epsilon())
+        throw pandora::StatusCodeException(pandora::STATUS_CODE_FAILURE);
+
+    const unsigned int blockSize(64);
+    const unsigned int nBlocks((nPermutations + blockSize - 1) / blockSize);
+    const bool allowEarlyStop(!(pValueThreshold < 0.f));
+    const float nPermutationsFloat(static_cast<float>(nPermutations));
+    std::atomic<unsigned int> nExtreme(0), nProcessed(0);
+
+    LArParallelHelper::ForEach(nBlocks, nThreads, [&](const unsigned int iBlock) {
+        if (allowEarlyStop)
+        {
+            // ATTN: Load the processed count first, as its increments follow those of the extreme count, so the bounds are conservative
+            const unsigned int nProcessedSoFar(nProcessed.load());
+            const unsigned int nExtremeSoFar(nExtreme.load());
+
+            if ((static_cast<float>(nExtremeSoFar) / nPermutationsFloat >= pValueThreshold) ||
+                (static_cast<float>(nExtremeSoFar + nPermutations - nProcessedSoFar) / nPermutationsFloat < pValueThreshold))
+                return;
+        }
+
+        const unsigned int firstPermutation(iBlock * blockSize);
+        const unsigned int lastPermutation(std::min(firstPermutation + blockSize, nPermutations));
+        pandora::FloatVector permutedDeviations1(size);
+        unsigned int nBlockExtreme(0);
+
+        for (unsigned int iPermutation = firstPermutation; iPermutation < lastPermutation; ++iPermutation)
+        {
+            std::uint64_t state(seed + static_cast<std::uint64_t>(iPermutation) * 0xd1b54a32d192ed03ULL);
+            std::copy(deviations1.begin(), deviations1.end(), permutedDeviations1.begin());
+
+            // ATTN: Shuffling one dataset relative to the other samples the same distribution as shuffling both independently
+            for (unsigned int iElement = size - 1; iElement > 0; --iElement)
+            {
+                const unsigned int jElement(static_cast<unsigned int>(
+                    ((LArDiscreteProbabilityHelper::GetNextRandomNumber(state) >> 32) * static_cast<std::uint64_t>(iElement + 1)) >> 32));
+                std::swap(permutedDeviations1[iElement], permutedDeviations1[jElement]);
+            }
+
+            float covariance(0.f);
+
+            for (unsigned int iElement = 0; iElement < size; ++iElement)
+                covariance += permutedDeviations1[iElement] * deviations2[iElement];
+
+            if ((covariance / sqrtVars - rNominal) > std::numeric_limits<float>::epsilon())
+                nBlockExtreme++;
+        }
+
+        nExtreme += nBlockExtreme;
+        nProcessed += lastPermutation - firstPermutation;
+    });
+
+    return nExtreme.load();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template float LArDiscreteProbabilityHelper::CalculateCorrelationCoefficientPValueFromPermutationTest(
     const DiscreteProbabilityVector &, const DiscreteProbabilityVector &, std::mt19937 &, const unsigned int);
 template float LArDiscreteProbabilityHelper::CalculateCorrelationCoefficientPValueFromPermutationTest(
     const pandora::FloatVector &, const pandora::FloatVector &, std::mt19937 &, const unsigned int);
 
+template float LArDiscreteProbabilityHelper::CalculateCorrelationCoefficientPValueFromPermutationTest(
+    const DiscreteProbabilityVector &, const DiscreteProbabilityVector &, const std::uint64_t, const unsigned int, const unsigned int);
+template float LArDiscreteProbabilityHelper::CalculateCorrelationCoefficientPValueFromPermutationTest(
+    const pandora::FloatVector &, const pandora::FloatVector &, const std::uint64_t, const unsigned int, const unsigned int);
+
+template bool LArDiscreteProbabilityHelper::IsCorrelationCoefficientPValueBelowThreshold(const DiscreteProbabilityVector &,
+    const DiscreteProbabilityVector &, const float, const std::uint64_t, const unsigned int, const unsigned int);
+template bool LArDiscreteProbabilityHelper::IsCorrelationCoefficientPValueBelowThreshold(
+    const pandora::FloatVector &, const pandora::FloatVector &, const float, const std::uint64_t, const unsigned int, const unsigned int);
+
 template float LArDiscreteProbabilityHelper::CalculateCorrelationCoefficientPValueFromStudentTDistribution(
     const DiscreteProbabilityVector &, const DiscreteProbabilityVector &, const unsigned int, const float);
 template float LArDiscreteProbabilityHelper::CalculateCorrelationCoefficientPValueFromStudentTDistribution(
@@ -11,6 +11,7 @@
 #include "larpandoracontent/LArObjects/LArDiscreteProbabilityVector.h"
 
 #include <algorithm>
+#include <cstdint>
 #include <random>
 
 namespace lar_content
@@ -36,6 +37,40 @@ public:
     static float CalculateCorrelationCoefficientPValueFromPermutationTest(
         const T &t1, const T &t2, std::mt19937 &randomNumberGenerator, const unsigned int nPermutations);
 
+    /**
+     *  @brief  Calculate P value for measured correlation coefficient between two datasets via a permutation test, in which each
+     *          permutation draws from its own counter-based random number stream, so that the result depends upon the seed alone and
+     *          not upon the number of threads
+     *
+     *  @param  t1 the first input dataset
+     *  @param  t2 the second input dataset
+     *  @param  seed the seed from which the random number stream for each permutation is derived
+     *  @param  nPermutations the number of permutations to run
+     *  @param  nThreads the number of threads between which to share the permutations (zero to use all available hardware threads)
+     *
+     *  @return the p-value
+     */
+    template <typename T>
+    static float CalculateCorrelationCoefficientPValueFromPermutationTest(
+        const T &t1, const T &t2, const std::uint64_t seed, const unsigned int nPermutations, const unsigned int nThreads);
+
+    /**
+     *  @brief  Query whether the permutation test P value for measured correlation coefficient between two datasets is below a threshold,
+     *          stopping as soon as the outcome is decided. Permutations draw from the same random number streams as the full test.
+     *
+     *  @param  t1 the first input dataset
+     *  @param  t2 the second input dataset
+     *  @param  pValueThreshold the p-value threshold
+     *  @param  seed the seed from which the random number stream for each permutation is derived
+     *  @param  nPermutations the number of permutations to run
+     *  @param  nThreads the number of threads between which to share the permutations (zero to use all available hardware threads)
+     *
+     *  @return whether the p-value is below the threshold
+     */
+    template <typename T>
+    static bool IsCorrelationCoefficientPValueBelowThreshold(const T &t1, const T &t2, const float pValueThreshold,
+        const std::uint64_t seed, const unsigned int nPermutations, const unsigned int nThreads);
+
     /**
      *  @brief  Calculate P value for measured correlation coefficient between two datasets via a integrating the student T dist.
      *
@@ -72,6 +107,42 @@ public:
     static float CalculateMean(const T &t);
 
 private:
+    /**
+     *  @brief  Get the deviations of the elements of a dataset from the dataset mean
+     *
+     *  @param  t the dataset
+     *  @param  deviations to receive the deviations
+     */
+    template <typename T>
+    static void GetDeviationsFromMean(const T &t, pandora::FloatVector &deviations);
+
+    /**
+     *  @brief  Count the permutations of a pair of datasets whose correlation coefficient exceeds the nominal value. If a p-value threshold
+     *          is provided, remaining permutations are skipped once the p-value is known to lie on one side of the threshold.
+     *
+     *  @param  deviations1 the deviations of the first dataset from its mean
+     *  @param  deviations2 the deviations of the second dataset from its mean
+     *  @param  rNominal the nominal correlation coefficient
+     *  @param  seed the seed from which the random number stream for each permutation is derived
+     *  @param  nPermutations the number of permutations to run
+     *  @param  nThreads the number of threads between which to share the permutations
+     *  @param  pValueThreshold the p-value threshold, or a negative value to run all permutations
+     *
+     *  @return the number of permutations with a correlation coefficient exceeding the nominal value
+     */
+    static unsigned int CountExtremePermutations(const pandora::FloatVector &deviations1, const pandora::FloatVector &deviations2,
+        const float rNominal, const std::uint64_t seed, const unsigned int nPermutations, const unsigned int nThreads,
+        const float pValueThreshold);
+
+    /**
+     *  @brief  Draw the next number from a counter-based (splitmix64) random number stream
+     *
+     *  @param  state the stream state, advanced by each draw
+     *
+     *  @return the random number
+     */
+    static std::uint64_t GetNextRandomNumber(std::uint64_t &state);
+
     /**
      *  @brief  Make a randomised copy of a dataset
      *
@@ -139,6 +210,17 @@ private:
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+inline std::uint64_t LArDiscreteProbabilityHelper::GetNextRandomNumber(std::uint64_t &state)
+{
+    std::uint64_t z(state += 0x9e3779b97f4a7c15ULL);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+
+    return z ^ (z >> 31);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template <typename T>
 inline std::vector<T> LArDiscreteProbabilityHelper::MakeRandomisedSample(const std::vector<T> &t, std::mt19937 &randomNumberGenerator)
 {
@@ -0,0 +1,74 @@
+/**
+ *  @file   larpandoracontent/LArHelpers/LArEventDeadlineHelper.cc
+ *
+ *  @brief  Implementation of the event deadline helper class.
+ *
+ *  $Log: $
+ */
+
+#include "Pandora/AlgorithmHeaders.h"
+
+#include "larpandoracontent/LArHelpers/LArEventDeadlineHelper.h"
+
+using namespace pandora;
+
+namespace lar_content
+{
+
+LArEventDeadlineHelper::PandoraToDeadlineMap LArEventDeadlineHelper::m_pandoraToDeadlineMap;
+std::atomic<unsigned int> LArEventDeadlineHelper::m_nDeadlines(0);
+std::mutex LArEventDeadlineHelper::m_mutex;
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArEventDeadlineHelper::SetDeadline(const Pandora &pandora, const TimePoint &deadline)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    Deadline &pandoraDeadline(m_pandoraToDeadlineMap[&pandora]);
+    pandoraDeadline.m_deadline = deadline;
+    pandoraDeadline.m_wasExceeded = false;
+    m_nDeadlines.store(m_pandoraToDeadlineMap.size());
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool LArEventDeadlineHelper::IsDeadlineExceeded(const Pandora &pandora)
+{
+    if (0 == m_nDeadlines.load(std::memory_order_relaxed))
+        return false;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    PandoraToDeadlineMap::iterator iter(m_pandoraToDeadlineMap.find(&pandora));
+
+    if (m_pandoraToDeadlineMap.end() == iter)
+        return false;
+
+    if (std::chrono::steady_clock::now() > iter->second.m_deadline)
+        iter->second.m_wasExceeded = true;
+
+    return iter->second.m_wasExceeded;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool LArEventDeadlineHelper::WasDeadlineExceeded(const Pandora &pandora)
+{
+    if (0 == m_nDeadlines.load(std::memory_order_relaxed))
+        return false;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    PandoraToDeadlineMap::const_iterator iter(m_pandoraToDeadlineMap.find(&pandora));
+
+    return ((m_pandoraToDeadlineMap.end() != iter) && iter->second.m_wasExceeded);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArEventDeadlineHelper::Reset(const Pandora &pandora)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_pandoraToDeadlineMap.erase(&pandora);
+    m_nDeadlines.store(m_pandoraToDeadlineMap.size());
+}
+
+} // namespace lar_content
@@ -0,0 +1,88 @@
+/**
+ *  @file   larpandoracontent/LArHelpers/LArEventDeadlineHelper.h
+ *
+ *  @brief  Header file for the event deadline helper class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_EVENT_DEADLINE_HELPER_H
+#define LAR_EVENT_DEADLINE_HELPER_H 1
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <unordered_map>
+
+namespace pandora
+{
+class Pandora;
+} // namespace pandora
+
+namespace lar_content
+{
+
+/**
+ *  @brief  LArEventDeadlineHelper class, sharing a per-event processing deadline between the iterative algorithms of a pandora instance.
+ *          Algorithms check the deadline at their natural iteration boundaries and stop early once it has passed, leaving consistent
+ *          output. Checks are a single atomic load unless a deadline has been set for some pandora instance.
+ */
+class LArEventDeadlineHelper
+{
+public:
+    typedef std::chrono::steady_clock::time_point TimePoint;
+
+    /**
+     *  @brief  Set the deadline for a pandora instance, clearing any record that a previous deadline was exceeded
+     *
+     *  @param  pandora the pandora instance
+     *  @param  deadline the deadline
+     */
+    static void SetDeadline(const pandora::Pandora &pandora, const TimePoint &deadline);
+
+    /**
+     *  @brief  Whether the deadline for a pandora instance has passed, recording that it was exceeded if so. Algorithms finding the
+     *          deadline exceeded should stop iterating.
+     *
+     *  @param  pandora the pandora instance
+     *
+     *  @return boolean, false if no deadline has been set
+     */
+    static bool IsDeadlineExceeded(const pandora::Pandora &pandora);
+
+    /**
+     *  @brief  Whether any algorithm has found the deadline for a pandora instance exceeded, since the deadline was set
+     *
+     *  @param  pandora the pandora instance
+     *
+     *  @return boolean
+     */
+    static bool WasDeadlineExceeded(const pandora::Pandora &pandora);
+
+    /**
+     *  @brief  Remove the deadline for a pandora instance, to be called at the end of each event
+     *
+     *  @param  pandora the pandora instance
+     */
+    static void Reset(const pandora::Pandora &pandora);
+
+private:
+    /**
+     *  @brief  Deadline class, the deadline for a pandora instance and whether it has been found exceeded
+     */
+    class Deadline
+    {
+    public:
+        TimePoint m_deadline; ///< The deadline
+        bool m_wasExceeded;   ///< Whether an algorithm has found the deadline exceeded
+    };
+
+    typedef std::unordered_map<const pandora::Pandora *, Deadline> PandoraToDeadlineMap;
+
+    static PandoraToDeadlineMap m_pandoraToDeadlineMap; ///< The deadline for each pandora instance
+    static std::atomic<unsigned int> m_nDeadlines;      ///< The number of pandora instances with a deadline, for a lock-free early exit
+    static std::mutex m_mutex;                          ///< The mutex protecting the deadlines
+};
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_EVENT_DEADLINE_HELPER_H
@@ -18,24 +18,39 @@ using namespace pandora;
 namespace lar_content
 {
 
+std::mutex LArFileHelper::m_xmlDocumentMutex;
+bool LArFileHelper::m_shouldCacheXmlDocuments(false);
+LArFileHelper::XmlDocumentMap LArFileHelper::m_xmlDocumentMap;
+std::mutex LArFileHelper::m_filePathMutex;
+LArFileHelper::QualifiedFileNameMap LArFileHelper::m_qualifiedFileNameMap;
+LArFileHelper::FilePathListMap LArFileHelper::m_filePathListMap;
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 std::string LArFileHelper::FindFileInPath(const std::string &unqualifiedFileName, const std::string &environmentVariable, const std::string &delimiter)
 {
-    StringVector filePaths;
     const char *const pFilePathList(std::getenv(environmentVariable.c_str()));
+    const std::string filePathList(pFilePathList ? pFilePathList : "");
 
-    if (pFilePathList)
-        XmlHelper::TokenizeString(pFilePathList, filePaths, delimiter);
+    // ATTN Key on the path list itself rather than the variable name, so that a changed environment variable is respected
+    const std::string cacheKey(unqualifiedFileName + '\0' + filePathList + '\0' + delimiter);
 
-    // Always test unqualified file name too
-    filePaths.push_back("");
+    const std::lock_guard<std::mutex> lock(m_filePathMutex);
+    QualifiedFileNameMap::const_iterator cacheIter(m_qualifiedFileNameMap.find(cacheKey));
 
-    for (const std::string &filePath : filePaths)
+    if (m_qualifiedFileNameMap.end() != cacheIter)
+        return cacheIter->second;
+
+    for (const std::string &filePath : LArFileHelper::GetExistingFilePaths(filePathList, delimiter))
     {
         const std::string qualifiedFileNameAttempt(filePath + "/" + unqualifiedFileName);
         struct stat fileInfo;
 
         if (0 == stat(qualifiedFileNameAttempt.c_str(), &fileInfo))
+        {
+            m_qualifiedFileNameMap.emplace(cacheKey, qualifiedFileNameAttempt);
             return qualifiedFileNameAttempt;
+        }
     }
 
     std::cout << "Unable to find file  " << unqualifiedFileName << " in any path specified by environment variable " << environmentVariable
@@ -43,4 +58,69 @@ std::string LArFileHelper::FindFileInPath(const std::string &unqualifiedFileName
     throw StatusCodeException(STATUS_CODE_NOT_FOUND);
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const StringVector &LArFileHelper::GetExistingFilePaths(const std::string &filePathList, const std::string &delimiter)
+{
+    const std::string cacheKey(filePathList + '\0' + delimiter);
+    FilePathListMap::const_iterator cacheIter(m_filePathListMap.find(cacheKey));
+
+    if (m_filePathListMap.end() != cacheIter)
+        return cacheIter->second;
+
+    StringVector filePaths, existingFilePaths;
+
+    if (!filePathList.empty())
+        XmlHelper::TokenizeString(filePathList, filePaths, delimiter);
+
+    for (const std::string &filePath : filePaths)
+    {
+        struct stat fileInfo;
+
+        if ((0 == stat((filePath + "/").c_str(), &fileInfo)) && S_ISDIR(fileInfo.st_mode))
+            existingFilePaths.push_back(filePath);
+    }
+
+    // Always test unqualified file name too
+    existingFilePaths.push_back("");
+
+    return (m_filePathListMap[cacheKey] = existingFilePaths);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArFileHelper::SetXmlDocumentCaching(const bool shouldCache)
+{
+    const std::lock_guard<std::mutex> lock(m_xmlDocumentMutex);
+    m_shouldCacheXmlDocuments = shouldCache;
+
+    if (!shouldCache)
+        m_xmlDocumentMap.clear();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+std::shared_ptr<TiXmlDocument> LArFileHelper::LoadXmlDocument(const std::string &xmlFileName)
+{
+    const std::lock_guard<std::mutex> lock(m_xmlDocumentMutex);
+
+    if (m_shouldCacheXmlDocuments)
+    {
+        XmlDocumentMap::const_iterator iter(m_xmlDocumentMap.find(xmlFileName));
+
+        if (m_xmlDocumentMap.end() != iter)
+            return iter->second;
+    }
+
+    std::shared_ptr<TiXmlDocument> pXmlDocument(std::make_shared<TiXmlDocument>(xmlFileName));
+
+    if (!pXmlDocument->LoadFile())
+        return std::shared_ptr<TiXmlDocument>();
+
+    if (m_shouldCacheXmlDocuments)
+        m_xmlDocumentMap[xmlFileName] = pXmlDocument;
+
+    return pXmlDocument;
+}
+
 } // namespace lar_content
@@ -8,7 +8,12 @@
 #ifndef LAR_FILE_HELPER_H
 #define LAR_FILE_HELPER_H 1
 
+#include "Helpers/XmlHelper.h"
+
+#include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 
 namespace lar_content
 {
@@ -21,7 +26,9 @@ class LArFileHelper
 public:
     /**
      *  @brief  Find the fully-qualified file name by searching through a list of delimiter-separated paths in a named environment
-     *          variable. The fully-qualified file name will be provided for the first instance of the file name encountered.
+     *          variable. The fully-qualified file name will be provided for the first instance of the file name encountered. Resolved
+     *          file names are cached for the lifetime of the process, as are the existing directories in each path list, so repeated
+     *          calls do not probe the filesystem again.
      *
      *  @param  unqualifiedFileName the unqualified file name
      *  @param  environmentVariable the name of the environment variable specifying a list of delimiter-separated paths
@@ -30,6 +37,47 @@ public:
      *  @return the fully-qualified name if found, else a StatusCode exception will be raised
      */
     static std::string FindFileInPath(const std::string &unqualifiedFileName, const std::string &environmentVariable, const std::string &delimiter = ":");
+
+    /**
+     *  @brief  Set whether parsed xml documents should be cached and shared between all users of the same file, e.g. the many
+     *          algorithm instances created for multiple worker Pandora instances. Disabling the caching releases all cached documents.
+     *
+     *  @param  shouldCache whether to cache parsed xml documents
+     */
+    static void SetXmlDocumentCaching(const bool shouldCache);
+
+    /**
+     *  @brief  Load and parse an xml document, reusing the previously parsed document for the same file name if caching is enabled.
+     *          The document must not be modified by the caller.
+     *
+     *  @param  xmlFileName the xml file name
+     *
+     *  @return the parsed xml document, or an empty pointer if the file could not be loaded or parsed
+     */
+    static std::shared_ptr<pandora::TiXmlDocument> LoadXmlDocument(const std::string &xmlFileName);
+
+private:
+    /**
+     *  @brief  Get the existing directories in a list of delimiter-separated paths, stat-ing each path on first use only
+     *
+     *  @param  filePathList the list of delimiter-separated paths
+     *  @param  delimiter the specified delimiter
+     *
+     *  @return the existing directories, in path list order
+     */
+    static const pandora::StringVector &GetExistingFilePaths(const std::string &filePathList, const std::string &delimiter);
+
+    typedef std::unordered_map<std::string, std::shared_ptr<pandora::TiXmlDocument>> XmlDocumentMap;
+    typedef std::unordered_map<std::string, std::string> QualifiedFileNameMap;
+    typedef std::unordered_map<std::string, pandora::StringVector> FilePathListMap;
+
+    static std::mutex m_filePathMutex;                  ///< The mutex protecting the file path caches
+    static QualifiedFileNameMap m_qualifiedFileNameMap; ///< The resolved file names, indexed by file name, path list and delimiter
+    static FilePathListMap m_filePathListMap;           ///< The existing directories, indexed by path list and delimiter
+
+    static std::mutex m_xmlDocumentMutex;   ///< The mutex protecting the xml document cache
+    static bool m_shouldCacheXmlDocuments;  ///< Whether to cache parsed xml documents
+    static XmlDocumentMap m_xmlDocumentMap; ///< The cache of parsed xml documents, indexed by file name
 };
 
 } // namespace lar_content
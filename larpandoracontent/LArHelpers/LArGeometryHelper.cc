@@ -19,8 +19,13 @@
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
 
+#include "larpandoracontent/LArObjects/LArDetectorGapIndex.h"
+#include "larpandoracontent/LArObjects/LArGeometryConstants.h"
+#include "larpandoracontent/LArObjects/LArTPCVolumeIndex.h"
 #include "larpandoracontent/LArObjects/LArTwoDSlidingFitResult.h"
 
+#include "larpandoracontent/LArPlugins/LArRotationalTransformationPlugin.h"
+
 #include "Plugins/LArTransformationPlugin.h"
 
 using namespace pandora;
@@ -28,6 +33,19 @@ using namespace pandora;
 namespace lar_content
 {
 
+LArGeometryHelper::PandoraToDetectorGapIndexMap LArGeometryHelper::m_pandoraToDetectorGapIndexMap;
+std::mutex LArGeometryHelper::m_detectorGapIndexMutex;
+LArGeometryHelper::PandoraToTPCVolumeIndexMap LArGeometryHelper::m_pandoraToTPCVolumeIndexMap;
+std::mutex LArGeometryHelper::m_tpcVolumeIndexMutex;
+LArGeometryHelper::PandoraToGeometryConstantsMap LArGeometryHelper::m_pandoraToGeometryConstantsMap;
+std::mutex LArGeometryHelper::m_geometryConstantsMutex;
+std::atomic<unsigned int> LArGeometryHelper::m_geometryConstantsGeneration(0);
+thread_local const Pandora *LArGeometryHelper::m_pThreadPandora(nullptr);
+thread_local std::shared_ptr<const GeometryConstants> LArGeometryHelper::m_pThreadConstants;
+thread_local unsigned int LArGeometryHelper::m_threadGeneration(0);
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 float LArGeometryHelper::MergeTwoPositions(const Pandora &pandora, const HitType view1, const HitType view2, const float position1, const float position2)
 {
     if (view1 == view2)
@@ -68,6 +86,144 @@ float LArGeometryHelper::MergeTwoPositions(const Pandora &pandora, const HitType
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void LArGeometryHelper::MergeTwoPositions(const Pandora &pandora, const HitType view1, const HitType view2, const FloatVector &positions1,
+    const FloatVector &positions2, FloatVector &positions3)
+{
+    if ((view1 == view2) || (positions1.size() != positions2.size()))
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+    // ATTN Order the views as (U, V), (W, U) or (V, W), matching the argument order of the transformation plugin
+    const bool swapViews(((view1 == TPC_VIEW_V) && (view2 == TPC_VIEW_U)) || ((view1 == TPC_VIEW_U) && (view2 == TPC_VIEW_W)) ||
+        ((view1 == TPC_VIEW_W) && (view2 == TPC_VIEW_V)));
+    const HitType viewA(swapViews ? view2 : view1), viewB(swapViews ? view1 : view2);
+    const FloatVector &positionsA(swapViews ? positions2 : positions1), &positionsB(swapViews ? positions1 : positions2);
+
+    if (!(((viewA == TPC_VIEW_U) && (viewB == TPC_VIEW_V)) || ((viewA == TPC_VIEW_W) && (viewB == TPC_VIEW_U)) ||
+            ((viewA == TPC_VIEW_V) && (viewB == TPC_VIEW_W))))
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+    const LArTransformationPlugin *const pTransform(pandora.GetPlugins()->GetLArTransformationPlugin());
+    const LArRotationalTransformationPlugin *const pRotationalTransform(
+        dynamic_cast<const LArRotationalTransformationPlugin *>(pTransform));
+
+    if (pRotationalTransform)
+    {
+        const size_t nExistingPositions(positions3.size());
+        positions3.resize(nExistingPositions + positionsA.size());
+        float *const pPositions3(positions3.data() + nExistingPositions);
+
+        if (TPC_VIEW_U == viewA)
+            pRotationalTransform->UVtoW(positionsA.data(), positionsB.data(), positionsA.size(), pPositions3);
+        else if (TPC_VIEW_W == viewA)
+            pRotationalTransform->WUtoV(positionsA.data(), positionsB.data(), positionsA.size(), pPositions3);
+        else
+            pRotationalTransform->VWtoU(positionsA.data(), positionsB.data(), positionsA.size(), pPositions3);
+
+        return;
+    }
+
+    positions3.reserve(positions3.size() + positionsA.size());
+
+    if ((viewA == TPC_VIEW_U) && (viewB == TPC_VIEW_V))
+    {
+        for (size_t index = 0; index < positionsA.size(); ++index)
+            positions3.push_back(pTransform->UVtoW(positionsA[index], positionsB[index]));
+    }
+    else if ((viewA == TPC_VIEW_W) && (viewB == TPC_VIEW_U))
+    {
+        for (size_t index = 0; index < positionsA.size(); ++index)
+            positions3.push_back(pTransform->WUtoV(positionsA[index], positionsB[index]));
+    }
+    else if ((viewA == TPC_VIEW_V) && (viewB == TPC_VIEW_W))
+    {
+        for (size_t index = 0; index < positionsA.size(); ++index)
+            positions3.push_back(pTransform->VWtoU(positionsA[index], positionsB[index]));
+    }
+    else
+    {
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <HitType VIEW1, HitType VIEW2>
+float LArGeometryHelper::MergeTwoPositions(const Pandora &pandora, const float position1, const float position2)
+{
+    static_assert((VIEW1 != VIEW2) && ((TPC_VIEW_U == VIEW1) || (TPC_VIEW_V == VIEW1) || (TPC_VIEW_W == VIEW1)) &&
+                      ((TPC_VIEW_U == VIEW2) || (TPC_VIEW_V == VIEW2) || (TPC_VIEW_W == VIEW2)),
+        "LArGeometryHelper::MergeTwoPositions requires two different views from U, V and W");
+
+    const LArTransformationPlugin *const pTransform(pandora.GetPlugins()->GetLArTransformationPlugin());
+
+    if constexpr ((TPC_VIEW_U == VIEW1) && (TPC_VIEW_V == VIEW2))
+        return pTransform->UVtoW(position1, position2);
+    else if constexpr ((TPC_VIEW_V == VIEW1) && (TPC_VIEW_U == VIEW2))
+        return pTransform->UVtoW(position2, position1);
+    else if constexpr ((TPC_VIEW_W == VIEW1) && (TPC_VIEW_U == VIEW2))
+        return pTransform->WUtoV(position1, position2);
+    else if constexpr ((TPC_VIEW_U == VIEW1) && (TPC_VIEW_W == VIEW2))
+        return pTransform->WUtoV(position2, position1);
+    else if constexpr ((TPC_VIEW_V == VIEW1) && (TPC_VIEW_W == VIEW2))
+        return pTransform->VWtoU(position1, position2);
+    else
+        return pTransform->VWtoU(position2, position1);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <HitType VIEW1, HitType VIEW2>
+void LArGeometryHelper::MergeTwoPositions(
+    const Pandora &pandora, const FloatVector &positions1, const FloatVector &positions2, FloatVector &positions3)
+{
+    static_assert((VIEW1 != VIEW2) && ((TPC_VIEW_U == VIEW1) || (TPC_VIEW_V == VIEW1) || (TPC_VIEW_W == VIEW1)) &&
+                      ((TPC_VIEW_U == VIEW2) || (TPC_VIEW_V == VIEW2) || (TPC_VIEW_W == VIEW2)),
+        "LArGeometryHelper::MergeTwoPositions requires two different views from U, V and W");
+
+    if (positions1.size() != positions2.size())
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+    // ATTN Order the views as (U, V), (W, U) or (V, W), matching the argument order of the transformation plugin
+    constexpr bool swapViews(((TPC_VIEW_V == VIEW1) && (TPC_VIEW_U == VIEW2)) || ((TPC_VIEW_U == VIEW1) && (TPC_VIEW_W == VIEW2)) ||
+        ((TPC_VIEW_W == VIEW1) && (TPC_VIEW_V == VIEW2)));
+    constexpr HitType viewA(swapViews ? VIEW2 : VIEW1);
+    const FloatVector &positionsA(swapViews ? positions2 : positions1), &positionsB(swapViews ? positions1 : positions2);
+
+    const LArTransformationPlugin *const pTransform(pandora.GetPlugins()->GetLArTransformationPlugin());
+    const LArRotationalTransformationPlugin *const pRotationalTransform(
+        dynamic_cast<const LArRotationalTransformationPlugin *>(pTransform));
+
+    if (pRotationalTransform)
+    {
+        const size_t nExistingPositions(positions3.size());
+        positions3.resize(nExistingPositions + positionsA.size());
+        float *const pPositions3(positions3.data() + nExistingPositions);
+
+        if constexpr (TPC_VIEW_U == viewA)
+            pRotationalTransform->UVtoW(positionsA.data(), positionsB.data(), positionsA.size(), pPositions3);
+        else if constexpr (TPC_VIEW_W == viewA)
+            pRotationalTransform->WUtoV(positionsA.data(), positionsB.data(), positionsA.size(), pPositions3);
+        else
+            pRotationalTransform->VWtoU(positionsA.data(), positionsB.data(), positionsA.size(), pPositions3);
+
+        return;
+    }
+
+    positions3.reserve(positions3.size() + positionsA.size());
+
+    for (size_t index = 0; index < positionsA.size(); ++index)
+    {
+        if constexpr (TPC_VIEW_U == viewA)
+            positions3.push_back(pTransform->UVtoW(positionsA[index], positionsB[index]));
+        else if constexpr (TPC_VIEW_W == viewA)
+            positions3.push_back(pTransform->WUtoV(positionsA[index], positionsB[index]));
+        else
+            positions3.push_back(pTransform->VWtoU(positionsA[index], positionsB[index]));
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 CartesianVector LArGeometryHelper::MergeTwoDirections(
     const Pandora &pandora, const HitType view1, const HitType view2, const CartesianVector &direction1, const CartesianVector &direction2)
 {
@@ -262,36 +418,8 @@ void LArGeometryHelper::MergeThreePositions(const Pandora &pandora, const HitTyp
 void LArGeometryHelper::MergeThreePositions(const Pandora &pandora, const CartesianVector &positionU, const CartesianVector &positionV,
     const CartesianVector &positionW, CartesianVector &outputU, CartesianVector &outputV, CartesianVector &outputW, float &chiSquared)
 {
-    const float YfromUV(pandora.GetPlugins()->GetLArTransformationPlugin()->UVtoY(positionU.GetZ(), positionV.GetZ()));
-    const float YfromUW(pandora.GetPlugins()->GetLArTransformationPlugin()->UWtoY(positionU.GetZ(), positionW.GetZ()));
-    const float YfromVW(pandora.GetPlugins()->GetLArTransformationPlugin()->VWtoY(positionV.GetZ(), positionW.GetZ()));
-
-    const float ZfromUV(pandora.GetPlugins()->GetLArTransformationPlugin()->UVtoZ(positionU.GetZ(), positionV.GetZ()));
-    const float ZfromUW(pandora.GetPlugins()->GetLArTransformationPlugin()->UWtoZ(positionU.GetZ(), positionW.GetZ()));
-    const float ZfromVW(pandora.GetPlugins()->GetLArTransformationPlugin()->VWtoZ(positionV.GetZ(), positionW.GetZ()));
-
-    // ATTN For detectors where w and z are equivalent, remain consistent with original treatment. TODO Use new treatment always.
-    const bool useOldWZEquivalentTreatment(std::fabs(ZfromUW - ZfromVW) < std::numeric_limits<float>::epsilon());
-    const float aveX((positionU.GetX() + positionV.GetX() + positionW.GetX()) / 3.f);
-    const float aveY(useOldWZEquivalentTreatment ? YfromUV : (YfromUV + YfromUW + YfromVW) / 3.f);
-    const float aveZ(useOldWZEquivalentTreatment ? (positionW.GetZ() + 2.f * ZfromUV) / 3.f : (ZfromUV + ZfromUW + ZfromVW) / 3.f);
-
-    const float aveU(pandora.GetPlugins()->GetLArTransformationPlugin()->YZtoU(aveY, aveZ));
-    const float aveV(pandora.GetPlugins()->GetLArTransformationPlugin()->YZtoV(aveY, aveZ));
-    const float aveW(pandora.GetPlugins()->GetLArTransformationPlugin()->YZtoW(aveY, aveZ));
-
-    outputU.SetValues(aveX, 0.f, aveU);
-    outputV.SetValues(aveX, 0.f, aveV);
-    outputW.SetValues(aveX, 0.f, aveW);
-
-    const float sigmaUVW(LArGeometryHelper::GetSigmaUVW(pandora));
-    chiSquared = ((outputU.GetX() - positionU.GetX()) * (outputU.GetX() - positionU.GetX()) +
-                     (outputV.GetX() - positionV.GetX()) * (outputV.GetX() - positionV.GetX()) +
-                     (outputW.GetX() - positionW.GetX()) * (outputW.GetX() - positionW.GetX()) +
-                     (outputU.GetZ() - positionU.GetZ()) * (outputU.GetZ() - positionU.GetZ()) +
-                     (outputV.GetZ() - positionV.GetZ()) * (outputV.GetZ() - positionV.GetZ()) +
-                     (outputW.GetZ() - positionW.GetZ()) * (outputW.GetZ() - positionW.GetZ())) /
-                 (sigmaUVW * sigmaUVW);
+    LArGeometryHelper::MergeThreePositions(pandora.GetPlugins()->GetLArTransformationPlugin(), LArGeometryHelper::GetSigmaUVW(pandora),
+        positionU, positionV, positionW, outputU, outputV, outputW, chiSquared);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -373,62 +501,214 @@ CartesianVector LArGeometryHelper::ProjectDirection(const Pandora &pandora, cons
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-float LArGeometryHelper::GetWirePitch(const Pandora &pandora, const HitType view, const float maxWirePitchDiscrepancy)
+void LArGeometryHelper::ProjectPositions(
+    const Pandora &pandora, const CartesianPointVector &positions3D, const HitType view, CartesianPointVector &positions2D)
 {
-    if (view != TPC_VIEW_U && view != TPC_VIEW_V && view != TPC_VIEW_W)
-        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+    double yCoefficient(0.), zCoefficient(0.);
+    LArGeometryHelper::GetProjectionCoefficients(pandora, view, yCoefficient, zCoefficient);
 
-    const LArTPCMap &larTPCMap(pandora.GetGeometry()->GetLArTPCMap());
+    positions2D.reserve(positions2D.size() + positions3D.size());
 
-    if (larTPCMap.empty())
+    for (const CartesianVector &position3D : positions3D)
+        positions2D.emplace_back(position3D.GetX(), 0.f, zCoefficient * position3D.GetZ() + yCoefficient * position3D.GetY());
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArGeometryHelper::ProjectDirections(
+    const Pandora &pandora, const CartesianPointVector &directions3D, const HitType view, CartesianPointVector &directions2D)
+{
+    double yCoefficient(0.), zCoefficient(0.);
+    LArGeometryHelper::GetProjectionCoefficients(pandora, view, yCoefficient, zCoefficient);
+
+    directions2D.reserve(directions2D.size() + directions3D.size());
+
+    for (const CartesianVector &direction3D : directions3D)
     {
-        std::cout << "LArGeometryHelper::GetWirePitch - LArTPC description not registered with Pandora as required " << std::endl;
-        throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
+        const CartesianVector direction2D(direction3D.GetX(), 0.f, zCoefficient * direction3D.GetZ() + yCoefficient * direction3D.GetY());
+        directions2D.push_back(direction2D.GetUnitVector());
     }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArGeometryHelper::MergeTwoPositions3D(const Pandora &pandora, const HitType view1, const HitType view2,
+    const CartesianPointVector &positions1, const CartesianPointVector &positions2, CartesianPointVector &positions3D,
+    FloatVector &chiSquaredVector)
+{
+    if ((view1 == view2) || (positions1.size() != positions2.size()))
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
 
-    const LArTPC *const pFirstLArTPC(larTPCMap.begin()->second);
-    const float wirePitch(view == TPC_VIEW_U ? pFirstLArTPC->GetWirePitchU()
-                                             : (view == TPC_VIEW_V ? pFirstLArTPC->GetWirePitchV() : pFirstLArTPC->GetWirePitchW()));
+    // ATTN Order the views as (U, V), (V, W) or (W, U); the merge is symmetric under exchange of the two input views
+    const bool swapViews(((view1 == TPC_VIEW_V) && (view2 == TPC_VIEW_U)) || ((view1 == TPC_VIEW_W) && (view2 == TPC_VIEW_V)) ||
+        ((view1 == TPC_VIEW_U) && (view2 == TPC_VIEW_W)));
+    const HitType viewA(swapViews ? view2 : view1), viewB(swapViews ? view1 : view2);
+    const CartesianPointVector &positionsA(swapViews ? positions2 : positions1), &positionsB(swapViews ? positions1 : positions2);
 
-    for (const LArTPCMap::value_type &mapEntry : larTPCMap)
+    if (!(((viewA == TPC_VIEW_U) && (viewB == TPC_VIEW_V)) || ((viewA == TPC_VIEW_V) && (viewB == TPC_VIEW_W)) ||
+            ((viewA == TPC_VIEW_W) && (viewB == TPC_VIEW_U))))
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+    const LArTransformationPlugin *const pTransform(pandora.GetPlugins()->GetLArTransformationPlugin());
+    const LArRotationalTransformationPlugin *const pRotationalTransform(
+        dynamic_cast<const LArRotationalTransformationPlugin *>(pTransform));
+    const float sigmaUVW(LArGeometryHelper::GetSigmaUVW(pandora));
+
+    const size_t nPositions(positionsA.size());
+    FloatVector yValues(nPositions), zValues(nPositions);
+
+    if (pRotationalTransform)
     {
-        const LArTPC *const pLArTPC(mapEntry.second);
-        const float alternateWirePitch(
-            view == TPC_VIEW_U ? pLArTPC->GetWirePitchU() : (view == TPC_VIEW_V ? pLArTPC->GetWirePitchV() : pLArTPC->GetWirePitchW()));
+        // Gather the wire coordinates, so that the transformations can be applied to contiguous spans
+        FloatVector zValuesA(nPositions), zValuesB(nPositions), uValues(nPositions), vValues(nPositions);
+
+        for (size_t index = 0; index < nPositions; ++index)
+        {
+            zValuesA[index] = positionsA[index].GetZ();
+            zValuesB[index] = positionsB[index].GetZ();
+        }
 
-        if (std::fabs(wirePitch - alternateWirePitch) > maxWirePitchDiscrepancy)
+        if (TPC_VIEW_U == viewA)
         {
-            std::cout << "LArGeometryHelper::GetWirePitch - LArTPC configuration not supported" << std::endl;
-            throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+            uValues.swap(zValuesA);
+            vValues.swap(zValuesB);
         }
+        else if (TPC_VIEW_V == viewA)
+        {
+            pRotationalTransform->VWtoU(zValuesA.data(), zValuesB.data(), nPositions, uValues.data());
+            vValues.swap(zValuesA);
+        }
+        else
+        {
+            pRotationalTransform->WUtoV(zValuesA.data(), zValuesB.data(), nPositions, vValues.data());
+            uValues.swap(zValuesB);
+        }
+
+        pRotationalTransform->UVtoY(uValues.data(), vValues.data(), nPositions, yValues.data());
+        pRotationalTransform->UVtoZ(uValues.data(), vValues.data(), nPositions, zValues.data());
     }
+    else
+    {
+        for (size_t index = 0; index < nPositions; ++index)
+        {
+            const float zA(positionsA[index].GetZ()), zB(positionsB[index].GetZ());
+
+            float aveU(0.f), aveV(0.f);
+
+            if (TPC_VIEW_U == viewA)
+            {
+                aveU = zA;
+                aveV = zB;
+            }
+            else if (TPC_VIEW_V == viewA)
+            {
+                aveU = pTransform->VWtoU(zA, zB);
+                aveV = zA;
+            }
+            else
+            {
+                aveU = zB;
+                aveV = pTransform->WUtoV(zA, zB);
+            }
+
+            yValues[index] = pTransform->UVtoY(aveU, aveV);
+            zValues[index] = pTransform->UVtoZ(aveU, aveV);
+        }
+    }
+
+    positions3D.reserve(positions3D.size() + nPositions);
+    chiSquaredVector.reserve(chiSquaredVector.size() + nPositions);
+
+    for (size_t index = 0; index < nPositions; ++index)
+    {
+        const CartesianVector &positionA(positionsA[index]), &positionB(positionsB[index]);
+        const float aveX((positionA.GetX() + positionB.GetX()) / 2.f);
 
-    return wirePitch;
+        positions3D.emplace_back(aveX, yValues[index], zValues[index]);
+        const float deltaXA(aveX - positionA.GetX()), deltaXB(aveX - positionB.GetX());
+        chiSquaredVector.push_back((deltaXA * deltaXA + deltaXB * deltaXB) / (sigmaUVW * sigmaUVW));
+    }
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-CartesianVector LArGeometryHelper::GetWireAxis(const Pandora &pandora, const HitType view)
+void LArGeometryHelper::MergeThreePositions3D(const Pandora &pandora, const HitType view1, const HitType view2, const HitType view3,
+    const CartesianPointVector &positions1, const CartesianPointVector &positions2, const CartesianPointVector &positions3,
+    CartesianPointVector &positions3D, FloatVector &chiSquaredVector)
 {
-    if (view == TPC_VIEW_U)
+    if ((view1 == view2) || (view2 == view3) || (view3 == view1) || (positions1.size() != positions2.size()) ||
+        (positions1.size() != positions3.size()))
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+    const HitType views[3] = {view1, view2, view3};
+    const CartesianPointVector *const pPositions[3] = {&positions1, &positions2, &positions3};
+    const CartesianPointVector *pPositionsU(nullptr), *pPositionsV(nullptr), *pPositionsW(nullptr);
+
+    for (unsigned int iView = 0; iView < 3; ++iView)
     {
-        return CartesianVector(0.f, pandora.GetPlugins()->GetLArTransformationPlugin()->YZtoU(1.f, 0.f),
-            pandora.GetPlugins()->GetLArTransformationPlugin()->YZtoU(0.f, 1.f));
+        if (TPC_VIEW_U == views[iView])
+            pPositionsU = pPositions[iView];
+        else if (TPC_VIEW_V == views[iView])
+            pPositionsV = pPositions[iView];
+        else if (TPC_VIEW_W == views[iView])
+            pPositionsW = pPositions[iView];
     }
 
-    else if (view == TPC_VIEW_V)
+    if (!pPositionsU || !pPositionsV || !pPositionsW)
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+    const LArTransformationPlugin *const pTransform(pandora.GetPlugins()->GetLArTransformationPlugin());
+    const float sigmaUVW(LArGeometryHelper::GetSigmaUVW(pandora));
+
+    positions3D.reserve(positions3D.size() + positions1.size());
+    chiSquaredVector.reserve(chiSquaredVector.size() + positions1.size());
+
+    CartesianVector outputU(0.f, 0.f, 0.f), outputV(0.f, 0.f, 0.f), outputW(0.f, 0.f, 0.f);
+
+    for (size_t index = 0; index < positions1.size(); ++index)
     {
-        return CartesianVector(0.f, pandora.GetPlugins()->GetLArTransformationPlugin()->YZtoV(1.f, 0.f),
-            pandora.GetPlugins()->GetLArTransformationPlugin()->YZtoV(0.f, 1.f));
+        float chiSquared(0.f);
+        LArGeometryHelper::MergeThreePositions(pTransform, sigmaUVW, (*pPositionsU)[index], (*pPositionsV)[index], (*pPositionsW)[index],
+            outputU, outputV, outputW, chiSquared);
+
+        positions3D.emplace_back(
+            outputW.GetX(), pTransform->UVtoY(outputU.GetZ(), outputV.GetZ()), pTransform->UVtoZ(outputU.GetZ(), outputV.GetZ()));
+        chiSquaredVector.push_back(chiSquared);
     }
+}
 
-    else if (view == TPC_VIEW_W)
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+float LArGeometryHelper::GetWirePitch(const Pandora &pandora, const HitType view, const float maxWirePitchDiscrepancy)
+{
+    if (view != TPC_VIEW_U && view != TPC_VIEW_V && view != TPC_VIEW_W)
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+    const GeometryConstants &geometryConstants(LArGeometryHelper::GetGeometryConstants(pandora));
+
+    if (!geometryConstants.HasLArTPCs())
     {
-        return CartesianVector(0.f, pandora.GetPlugins()->GetLArTransformationPlugin()->YZtoW(1.f, 0.f),
-            pandora.GetPlugins()->GetLArTransformationPlugin()->YZtoW(0.f, 1.f));
+        std::cout << "LArGeometryHelper::GetWirePitch - LArTPC description not registered with Pandora as required " << std::endl;
+        throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
     }
 
-    throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+    if (geometryConstants.GetMaxWirePitchDiscrepancy(view) > maxWirePitchDiscrepancy)
+    {
+        std::cout << "LArGeometryHelper::GetWirePitch - LArTPC configuration not supported" << std::endl;
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+    }
+
+    return geometryConstants.GetWirePitch(view);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+CartesianVector LArGeometryHelper::GetWireAxis(const Pandora &pandora, const HitType view)
+{
+    if (view != TPC_VIEW_U && view != TPC_VIEW_V && view != TPC_VIEW_W)
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+    return LArGeometryHelper::GetGeometryConstants(pandora).GetWireAxis(view);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -449,13 +729,7 @@ void LArGeometryHelper::GetCommonDaughterVolumes(const Cluster *const pCluster1,
 bool LArGeometryHelper::IsInGap(const Pandora &pandora, const CartesianVector &testPoint2D, const HitType hitType, const float gapTolerance)
 {
     // ATTN: input test point MUST be a 2D position vector
-    for (const DetectorGap *const pDetectorGap : pandora.GetGeometry()->GetDetectorGapList())
-    {
-        if (pDetectorGap->IsInGap(testPoint2D, hitType, gapTolerance))
-            return true;
-    }
-
-    return false;
+    return LArGeometryHelper::GetDetectorGapIndex(pandora)->IsInGap(testPoint2D, hitType, gapTolerance);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -508,66 +782,199 @@ bool LArGeometryHelper::IsXSamplingPointInGap(const Pandora &pandora, const floa
 
 float LArGeometryHelper::CalculateGapDeltaZ(const Pandora &pandora, const float minZ, const float maxZ, const HitType hitType)
 {
-    if (maxZ - minZ < std::numeric_limits<float>::epsilon())
-        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+    return LArGeometryHelper::GetDetectorGapIndex(pandora)->CalculateGapDeltaZ(minZ, maxZ, hitType);
+}
 
-    float gapDeltaZ(0.f);
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+float LArGeometryHelper::GetSigmaUVW(const Pandora &pandora, const float maxSigmaDiscrepancy)
+{
+    const GeometryConstants &geometryConstants(LArGeometryHelper::GetGeometryConstants(pandora));
 
-    for (const DetectorGap *const pDetectorGap : pandora.GetGeometry()->GetDetectorGapList())
+    if (!geometryConstants.HasLArTPCs())
     {
-        const LineGap *const pLineGap = dynamic_cast<const LineGap *>(pDetectorGap);
+        std::cout << "LArGeometryHelper::GetSigmaUVW - LArTPC description not registered with Pandora as required " << std::endl;
+        throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
+    }
 
-        if (!pLineGap)
-            throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+    if (geometryConstants.GetMaxSigmaUVWDiscrepancy() > maxSigmaDiscrepancy)
+    {
+        std::cout << "LArGeometryHelper::GetSigmaUVW - Plugin does not support provided LArTPC configurations " << std::endl;
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+    }
 
-        const LineGapType lineGapType(pLineGap->GetLineGapType());
+    return geometryConstants.GetSigmaUVW();
+}
 
-        if (!(((TPC_VIEW_U == hitType) && (TPC_WIRE_GAP_VIEW_U == lineGapType)) || ((TPC_VIEW_V == hitType) && (TPC_WIRE_GAP_VIEW_V == lineGapType)) ||
-                ((TPC_VIEW_W == hitType) && (TPC_WIRE_GAP_VIEW_W == lineGapType))))
-        {
-            continue;
-        }
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArGeometryHelper::MergeThreePositions(const LArTransformationPlugin *const pTransform, const float sigmaUVW,
+    const CartesianVector &positionU, const CartesianVector &positionV, const CartesianVector &positionW, CartesianVector &outputU,
+    CartesianVector &outputV, CartesianVector &outputW, float &chiSquared)
+{
+    const float YfromUV(pTransform->UVtoY(positionU.GetZ(), positionV.GetZ()));
+    const float YfromUW(pTransform->UWtoY(positionU.GetZ(), positionW.GetZ()));
+    const float YfromVW(pTransform->VWtoY(positionV.GetZ(), positionW.GetZ()));
+
+    const float ZfromUV(pTransform->UVtoZ(positionU.GetZ(), positionV.GetZ()));
+    const float ZfromUW(pTransform->UWtoZ(positionU.GetZ(), positionW.GetZ()));
+    const float ZfromVW(pTransform->VWtoZ(positionV.GetZ(), positionW.GetZ()));
+
+    // ATTN For detectors where w and z are equivalent, remain consistent with original treatment. TODO Use new treatment always.
+    const bool useOldWZEquivalentTreatment(std::fabs(ZfromUW - ZfromVW) < std::numeric_limits<float>::epsilon());
+    const float aveX((positionU.GetX() + positionV.GetX() + positionW.GetX()) / 3.f);
+    const float aveY(useOldWZEquivalentTreatment ? YfromUV : (YfromUV + YfromUW + YfromVW) / 3.f);
+    const float aveZ(useOldWZEquivalentTreatment ? (positionW.GetZ() + 2.f * ZfromUV) / 3.f : (ZfromUV + ZfromUW + ZfromVW) / 3.f);
+
+    const float aveU(pTransform->YZtoU(aveY, aveZ));
+    const float aveV(pTransform->YZtoV(aveY, aveZ));
+    const float aveW(pTransform->YZtoW(aveY, aveZ));
+
+    outputU.SetValues(aveX, 0.f, aveU);
+    outputV.SetValues(aveX, 0.f, aveV);
+    outputW.SetValues(aveX, 0.f, aveW);
+
+    chiSquared = ((outputU.GetX() - positionU.GetX()) * (outputU.GetX() - positionU.GetX()) +
+                     (outputV.GetX() - positionV.GetX()) * (outputV.GetX() - positionV.GetX()) +
+                     (outputW.GetX() - positionW.GetX()) * (outputW.GetX() - positionW.GetX()) +
+                     (outputU.GetZ() - positionU.GetZ()) * (outputU.GetZ() - positionU.GetZ()) +
+                     (outputV.GetZ() - positionV.GetZ()) * (outputV.GetZ() - positionV.GetZ()) +
+                     (outputW.GetZ() - positionW.GetZ()) * (outputW.GetZ() - positionW.GetZ())) /
+                 (sigmaUVW * sigmaUVW);
+}
 
-        if ((pLineGap->GetLineStartZ() > maxZ) || (pLineGap->GetLineEndZ() < minZ))
-            continue;
+//------------------------------------------------------------------------------------------------------------------------------------------
 
-        const float gapMinZ(std::max(minZ, pLineGap->GetLineStartZ()));
-        const float gapMaxZ(std::min(maxZ, pLineGap->GetLineEndZ()));
+void LArGeometryHelper::GetProjectionCoefficients(const Pandora &pandora, const HitType view, double &yCoefficient, double &zCoefficient)
+{
+    const LArTransformationPlugin *const pTransform(pandora.GetPlugins()->GetLArTransformationPlugin());
 
-        if ((gapMaxZ - gapMinZ) > std::numeric_limits<float>::epsilon())
-            gapDeltaZ += (gapMaxZ - gapMinZ);
+    if (view == TPC_VIEW_U)
+    {
+        yCoefficient = pTransform->YZtoU(1., 0.);
+        zCoefficient = pTransform->YZtoU(0., 1.);
     }
+    else if (view == TPC_VIEW_V)
+    {
+        yCoefficient = pTransform->YZtoV(1., 0.);
+        zCoefficient = pTransform->YZtoV(0., 1.);
+    }
+    else if (view == TPC_VIEW_W)
+    {
+        yCoefficient = pTransform->YZtoW(1., 0.);
+        zCoefficient = pTransform->YZtoW(0., 1.);
+    }
+    else
+    {
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+std::shared_ptr<const TPCVolumeIndex> LArGeometryHelper::GetTPCVolumeIndex(const Pandora &pandora)
+{
+    const LArTPCMap &larTPCMap(pandora.GetGeometry()->GetLArTPCMap());
+
+    std::lock_guard<std::mutex> lock(m_tpcVolumeIndexMutex);
+    std::shared_ptr<const TPCVolumeIndex> &pTPCVolumeIndex(m_pandoraToTPCVolumeIndexMap[&pandora]);
 
-    return gapDeltaZ;
+    if (!pTPCVolumeIndex || !pTPCVolumeIndex->IsConsistent(larTPCMap))
+        pTPCVolumeIndex = std::make_shared<const TPCVolumeIndex>(larTPCMap);
+
+    return pTPCVolumeIndex;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-float LArGeometryHelper::GetSigmaUVW(const Pandora &pandora, const float maxSigmaDiscrepancy)
+std::shared_ptr<const DetectorGapIndex> LArGeometryHelper::GetDetectorGapIndex(const Pandora &pandora)
+{
+    const DetectorGapList &detectorGapList(pandora.GetGeometry()->GetDetectorGapList());
+
+    std::lock_guard<std::mutex> lock(m_detectorGapIndexMutex);
+    std::shared_ptr<const DetectorGapIndex> &pDetectorGapIndex(m_pandoraToDetectorGapIndexMap[&pandora]);
+
+    if (!pDetectorGapIndex || !pDetectorGapIndex->IsConsistent(detectorGapList))
+        pDetectorGapIndex = std::make_shared<const DetectorGapIndex>(detectorGapList);
+
+    return pDetectorGapIndex;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const GeometryConstants &LArGeometryHelper::GetGeometryConstants(const Pandora &pandora)
 {
     const LArTPCMap &larTPCMap(pandora.GetGeometry()->GetLArTPCMap());
+    const LArTransformationPlugin *const pTransform(pandora.GetPlugins()->GetLArTransformationPlugin());
 
-    if (larTPCMap.empty())
+    // ATTN The constants are immutable once published, so the copy held by this thread may be read without the lock until the next reset
+    if ((&pandora == m_pThreadPandora) && m_pThreadConstants && (m_geometryConstantsGeneration.load() == m_threadGeneration) &&
+        m_pThreadConstants->IsConsistent(larTPCMap, pTransform))
     {
-        std::cout << "LArGeometryHelper::GetSigmaUVW - LArTPC description not registered with Pandora as required " << std::endl;
-        throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
+        return *m_pThreadConstants;
     }
 
-    const LArTPC *const pFirstLArTPC(larTPCMap.begin()->second);
-    const float sigmaUVW(pFirstLArTPC->GetSigmaUVW());
+    std::lock_guard<std::mutex> lock(m_geometryConstantsMutex);
+    std::shared_ptr<const GeometryConstants> &pGeometryConstants(m_pandoraToGeometryConstantsMap[&pandora]);
+
+    if (!pGeometryConstants || !pGeometryConstants->IsConsistent(larTPCMap, pTransform))
+        pGeometryConstants = std::make_shared<const GeometryConstants>(larTPCMap, pTransform);
+
+    m_pThreadPandora = &pandora;
+    m_pThreadConstants = pGeometryConstants;
+    m_threadGeneration = m_geometryConstantsGeneration.load();
+
+    return *m_pThreadConstants;
+}
 
-    for (const LArTPCMap::value_type &mapEntry : larTPCMap)
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArGeometryHelper::Reset(const Pandora &pandora)
+{
     {
-        const LArTPC *const pLArTPC(mapEntry.second);
+        std::lock_guard<std::mutex> lock(m_detectorGapIndexMutex);
+        m_pandoraToDetectorGapIndexMap.erase(&pandora);
+    }
 
-        if (std::fabs(sigmaUVW - pLArTPC->GetSigmaUVW()) > maxSigmaDiscrepancy)
-        {
-            std::cout << "LArGeometryHelper::GetSigmaUVW - Plugin does not support provided LArTPC configurations " << std::endl;
-            throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
-        }
+    {
+        std::lock_guard<std::mutex> lock(m_tpcVolumeIndexMutex);
+        m_pandoraToTPCVolumeIndexMap.erase(&pandora);
     }
 
-    return sigmaUVW;
+    std::lock_guard<std::mutex> lock(m_geometryConstantsMutex);
+    m_pandoraToGeometryConstantsMap.erase(&pandora);
+
+    // ATTN Invalidate the copies held by all threads, which cannot be reached from here
+    ++m_geometryConstantsGeneration;
+
+    if (&pandora == m_pThreadPandora)
+    {
+        m_pThreadPandora = nullptr;
+        m_pThreadConstants.reset();
+    }
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template float LArGeometryHelper::MergeTwoPositions<TPC_VIEW_U, TPC_VIEW_V>(const Pandora &, const float, const float);
+template float LArGeometryHelper::MergeTwoPositions<TPC_VIEW_V, TPC_VIEW_U>(const Pandora &, const float, const float);
+template float LArGeometryHelper::MergeTwoPositions<TPC_VIEW_W, TPC_VIEW_U>(const Pandora &, const float, const float);
+template float LArGeometryHelper::MergeTwoPositions<TPC_VIEW_U, TPC_VIEW_W>(const Pandora &, const float, const float);
+template float LArGeometryHelper::MergeTwoPositions<TPC_VIEW_V, TPC_VIEW_W>(const Pandora &, const float, const float);
+template float LArGeometryHelper::MergeTwoPositions<TPC_VIEW_W, TPC_VIEW_V>(const Pandora &, const float, const float);
+
+template void LArGeometryHelper::MergeTwoPositions<TPC_VIEW_U, TPC_VIEW_V>(
+    const Pandora &, const FloatVector &, const FloatVector &, FloatVector &);
+template void LArGeometryHelper::MergeTwoPositions<TPC_VIEW_V, TPC_VIEW_U>(
+    const Pandora &, const FloatVector &, const FloatVector &, FloatVector &);
+template void LArGeometryHelper::MergeTwoPositions<TPC_VIEW_W, TPC_VIEW_U>(
+    const Pandora &, const FloatVector &, const FloatVector &, FloatVector &);
+template void LArGeometryHelper::MergeTwoPositions<TPC_VIEW_U, TPC_VIEW_W>(
+    const Pandora &, const FloatVector &, const FloatVector &, FloatVector &);
+template void LArGeometryHelper::MergeTwoPositions<TPC_VIEW_V, TPC_VIEW_W>(
+    const Pandora &, const FloatVector &, const FloatVector &, FloatVector &);
+template void LArGeometryHelper::MergeTwoPositions<TPC_VIEW_W, TPC_VIEW_V>(
+    const Pandora &, const FloatVector &, const FloatVector &, FloatVector &);
+
 } // namespace lar_content
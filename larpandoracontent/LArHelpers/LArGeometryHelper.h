@@ -12,17 +12,24 @@
 #include "Pandora/PandoraEnumeratedTypes.h"
 #include "Pandora/StatusCodes.h"
 
+#include <atomic>
+#include <memory>
+#include <mutex>
 #include <unordered_map>
 
 namespace pandora
 {
 class CartesianVector;
+class LArTransformationPlugin;
 class Pandora;
 } // namespace pandora
 
 namespace lar_content
 {
 
+class DetectorGapIndex;
+class GeometryConstants;
+class TPCVolumeIndex;
 class TwoDSlidingFitResult;
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -47,6 +54,47 @@ public:
     static float MergeTwoPositions(const pandora::Pandora &pandora, const pandora::HitType view1, const pandora::HitType view2,
         const float position1, const float position2);
 
+    /**
+     *  @brief  Merge two views (U,V) to give a third view (Z), for a list of position pairs. The transformation is resolved once for the
+     *          whole list, with results identical to those of the single-position merge.
+     *
+     *  @param  pandora the associated pandora instance
+     *  @param  view1 the first view
+     *  @param  view2 the second view
+     *  @param  positions1 the positions in the first view
+     *  @param  positions2 the positions in the second view, one per position in the first view
+     *  @param  positions3 to receive the merged positions in the third view, one per input pair
+     */
+    static void MergeTwoPositions(const pandora::Pandora &pandora, const pandora::HitType view1, const pandora::HitType view2,
+        const pandora::FloatVector &positions1, const pandora::FloatVector &positions2, pandora::FloatVector &positions3);
+
+    /**
+     *  @brief  Merge two views to give a third view, with the views fixed at compile time so that the choice of transformation and the
+     *          view checks are resolved during compilation. Results are identical to those of the runtime view overload.
+     *
+     *  @param  pandora the associated pandora instance
+     *  @param  position1 the position in the first view, VIEW1
+     *  @param  position2 the position in the second view, VIEW2
+     *
+     *  @return the merged position in the third view
+     */
+    template <pandora::HitType VIEW1, pandora::HitType VIEW2>
+    static float MergeTwoPositions(const pandora::Pandora &pandora, const float position1, const float position2);
+
+    /**
+     *  @brief  Merge two views to give a third view, for a list of position pairs, with the views fixed at compile time so that the choice
+     *          of transformation and the view checks are resolved during compilation. Results are identical to those of the runtime
+     *          view overload.
+     *
+     *  @param  pandora the associated pandora instance
+     *  @param  positions1 the positions in the first view, VIEW1
+     *  @param  positions2 the positions in the second view, VIEW2, one per position in the first view
+     *  @param  positions3 to receive the merged positions in the third view, one per input pair
+     */
+    template <pandora::HitType VIEW1, pandora::HitType VIEW2>
+    static void MergeTwoPositions(const pandora::Pandora &pandora, const pandora::FloatVector &positions1,
+        const pandora::FloatVector &positions2, pandora::FloatVector &positions3);
+
     /**
      *  @brief  Merge two views (U,V) to give a third view (Z).
      *
@@ -177,6 +225,61 @@ public:
     static pandora::CartesianVector ProjectDirection(
         const pandora::Pandora &pandora, const pandora::CartesianVector &direction3D, const pandora::HitType view);
 
+    /**
+     *  @brief  Project a vector of 3D positions into a given 2D view, fetching the transformation coefficients once for the whole vector
+     *
+     *  @param  pandora the associated pandora instance
+     *  @param  positions3D the positions in 3D
+     *  @param  view the 2D projection
+     *  @param  positions2D to receive the projected positions, appended in input order
+     */
+    static void ProjectPositions(const pandora::Pandora &pandora, const pandora::CartesianPointVector &positions3D,
+        const pandora::HitType view, pandora::CartesianPointVector &positions2D);
+
+    /**
+     *  @brief  Project a vector of 3D directions into a given 2D view, fetching the transformation coefficients once for the whole vector
+     *
+     *  @param  pandora the associated pandora instance
+     *  @param  directions3D the directions in 3D
+     *  @param  view the 2D projection
+     *  @param  directions2D to receive the projected unit directions, appended in input order
+     */
+    static void ProjectDirections(const pandora::Pandora &pandora, const pandora::CartesianPointVector &directions3D,
+        const pandora::HitType view, pandora::CartesianPointVector &directions2D);
+
+    /**
+     *  @brief  Merge vectors of 2D positions from two views to give unified 3D positions, resolving the views and detector sigma once
+     *
+     *  @param  pandora the associated pandora instance
+     *  @param  view1 the first view
+     *  @param  view2 the second view
+     *  @param  positions1 the positions in the first view
+     *  @param  positions2 the positions in the second view, with one entry per entry in positions1
+     *  @param  positions3D to receive the positions in 3D, appended in input order
+     *  @param  chiSquaredVector to receive the chi-squared values, appended in input order
+     */
+    static void MergeTwoPositions3D(const pandora::Pandora &pandora, const pandora::HitType view1, const pandora::HitType view2,
+        const pandora::CartesianPointVector &positions1, const pandora::CartesianPointVector &positions2,
+        pandora::CartesianPointVector &positions3D, pandora::FloatVector &chiSquaredVector);
+
+    /**
+     *  @brief  Merge vectors of 2D positions from three views to give unified 3D positions, resolving the views and detector sigma once
+     *
+     *  @param  pandora the associated pandora instance
+     *  @param  view1 the first view
+     *  @param  view2 the second view
+     *  @param  view3 the third view
+     *  @param  positions1 the positions in the first view
+     *  @param  positions2 the positions in the second view, with one entry per entry in positions1
+     *  @param  positions3 the positions in the third view, with one entry per entry in positions1
+     *  @param  positions3D to receive the positions in 3D, appended in input order
+     *  @param  chiSquaredVector to receive the chi-squared values, appended in input order
+     */
+    static void MergeThreePositions3D(const pandora::Pandora &pandora, const pandora::HitType view1, const pandora::HitType view2,
+        const pandora::HitType view3, const pandora::CartesianPointVector &positions1, const pandora::CartesianPointVector &positions2,
+        const pandora::CartesianPointVector &positions3, pandora::CartesianPointVector &positions3D,
+        pandora::FloatVector &chiSquaredVector);
+
     /**
      *  @brief  Return the wire pitch
      *
@@ -267,6 +370,92 @@ public:
      *  @param  pCluster2 the second cluster
      */
     static void GetCommonDaughterVolumes(const pandora::Cluster *const pCluster1, const pandora::Cluster *const pCluster2, UIntSet &intersect);
+
+    /**
+     *  @brief  Get the tpc volume index for a pandora instance, building it on first use and rebuilding it if the lar tpc map has since
+     *          changed
+     *
+     *  @param  pandora the associated pandora instance
+     *
+     *  @return the address of the tpc volume index, shared so that it outlives any concurrent rebuild or reset
+     */
+    static std::shared_ptr<const TPCVolumeIndex> GetTPCVolumeIndex(const pandora::Pandora &pandora);
+
+    /**
+     *  @brief  Remove the cached tpc volume index, detector gap index and geometry constants for a pandora instance, to be called at the
+     *          end of each event and so before the instance is deleted, as a later instance may be created at the same address
+     *
+     *  @param  pandora the pandora instance
+     */
+    static void Reset(const pandora::Pandora &pandora);
+
+private:
+    /**
+     *  @brief  Merge 2D positions from three views to give unified 2D positions for each view, using a given transformation plugin and
+     *          detector sigma
+     *
+     *  @param  pTransform the address of the transformation plugin
+     *  @param  sigmaUVW the sigmaUVW value for the detector geometry
+     *  @param  positionU input position in the U view
+     *  @param  positionV input position in the V view
+     *  @param  positionW input position in the W view
+     *  @param  outputU output position in the U view
+     *  @param  outputV output position in the V view
+     *  @param  outputW output position in the W view
+     *  @param  chiSquared to receive the chi-squared
+     */
+    static void MergeThreePositions(const pandora::LArTransformationPlugin *const pTransform, const float sigmaUVW,
+        const pandora::CartesianVector &positionU, const pandora::CartesianVector &positionV, const pandora::CartesianVector &positionW,
+        pandora::CartesianVector &outputU, pandora::CartesianVector &outputV, pandora::CartesianVector &outputW, float &chiSquared);
+
+    /**
+     *  @brief  Get the coefficients of the (y, z) to wire coordinate transformation for a given view, such that the wire coordinate is
+     *          yCoefficient * y + zCoefficient * z. As for GetWireAxis, the transformation plugin is assumed to be linear in y and z.
+     *
+     *  @param  pandora the associated pandora instance
+     *  @param  view the 2D projection
+     *  @param  yCoefficient to receive the y coefficient
+     *  @param  zCoefficient to receive the z coefficient
+     */
+    static void GetProjectionCoefficients(
+        const pandora::Pandora &pandora, const pandora::HitType view, double &yCoefficient, double &zCoefficient);
+
+    /**
+     *  @brief  Get the detector gap index for a pandora instance, building it on first use and rebuilding it if the detector gap list
+     *          has since changed
+     *
+     *  @param  pandora the associated pandora instance
+     *
+     *  @return the address of the detector gap index, shared so that it outlives any concurrent rebuild or reset
+     */
+    static std::shared_ptr<const DetectorGapIndex> GetDetectorGapIndex(const pandora::Pandora &pandora);
+
+    /**
+     *  @brief  Get the geometry constants for a pandora instance, deriving them on first use and again if the lar tpc map or
+     *          transformation plugin has since changed. The constants last used on each thread are held by that thread, so repeated
+     *          calls for the same pandora instance take no lock.
+     *
+     *  @param  pandora the associated pandora instance
+     *
+     *  @return the geometry constants, valid until the next call on the same thread or the next reset
+     */
+    static const GeometryConstants &GetGeometryConstants(const pandora::Pandora &pandora);
+
+    typedef std::unordered_map<const pandora::Pandora *, std::shared_ptr<const DetectorGapIndex>> PandoraToDetectorGapIndexMap;
+    typedef std::unordered_map<const pandora::Pandora *, std::shared_ptr<const TPCVolumeIndex>> PandoraToTPCVolumeIndexMap;
+    typedef std::unordered_map<const pandora::Pandora *, std::shared_ptr<const GeometryConstants>> PandoraToGeometryConstantsMap;
+
+    static PandoraToDetectorGapIndexMap m_pandoraToDetectorGapIndexMap;   ///< The detector gap index for each pandora instance
+    static std::mutex m_detectorGapIndexMutex;                            ///< The mutex protecting the detector gap indices
+    static PandoraToTPCVolumeIndexMap m_pandoraToTPCVolumeIndexMap;       ///< The tpc volume index for each pandora instance
+    static std::mutex m_tpcVolumeIndexMutex;                              ///< The mutex protecting the tpc volume indices
+    static PandoraToGeometryConstantsMap m_pandoraToGeometryConstantsMap; ///< The geometry constants for each pandora instance
+    static std::mutex m_geometryConstantsMutex;                           ///< The mutex protecting the geometry constants
+    static std::atomic<unsigned int> m_geometryConstantsGeneration;       ///< The geometry constants generation, bumped by each reset
+
+    static thread_local const pandora::Pandora *m_pThreadPandora;                    ///< The pandora instance last used on this thread
+    static thread_local std::shared_ptr<const GeometryConstants> m_pThreadConstants; ///< The geometry constants last used on this thread
+    static thread_local unsigned int m_threadGeneration;                             ///< The generation of the thread constants
 };
 //------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -89,9 +89,8 @@ LArHierarchyHelper::MCHierarchy::MCHierarchy(const ReconstructabilityCriteria &r
 
 LArHierarchyHelper::MCHierarchy::~MCHierarchy()
 {
-    for (const Node *pNode : m_rootNodes)
-        delete pNode;
     m_rootNodes.clear();
+    m_nodeArena.clear();
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -143,7 +142,7 @@ void LArHierarchyHelper::MCHierarchy::FillHierarchy(const MCParticleList &mcPart
                     allHits.insert(allHits.begin(), caloHits.begin(), caloHits.end());
                 }
             }
-            m_rootNodes.emplace_back(new Node(*this, allParticles, allHits));
+            m_rootNodes.emplace_back(this->CreateNode(allParticles, allHits));
         }
     }
     else if (foldParameters.m_foldToLeadingShowers)
@@ -166,7 +165,7 @@ void LArHierarchyHelper::MCHierarchy::FillHierarchy(const MCParticleList &mcPart
                     allHits.insert(allHits.begin(), caloHits.begin(), caloHits.end());
                 }
             }
-            Node *pNode{new Node(*this, allParticles, allHits)};
+            Node *pNode{this->CreateNode(allParticles, allHits)};
             m_rootNodes.emplace_back(pNode);
             if (!(isShower || isNeutron))
             {
@@ -194,7 +193,7 @@ void LArHierarchyHelper::MCHierarchy::FillHierarchy(const MCParticleList &mcPart
                 }
             }
 
-            Node *pNode{new Node(*this, leadingParticles, allHits)};
+            Node *pNode{this->CreateNode(leadingParticles, allHits)};
             m_rootNodes.emplace_back(pNode);
             for (const MCParticle *pChild : childParticles)
                 pNode->FillHierarchy(pChild, foldParameters);
@@ -216,7 +215,7 @@ void LArHierarchyHelper::MCHierarchy::FillHierarchy(const MCParticleList &mcPart
                     allHits.insert(allHits.begin(), caloHits.begin(), caloHits.end());
                 }
             }
-            Node *pNode{new Node(*this, allParticles, allHits)};
+            Node *pNode{this->CreateNode(allParticles, allHits)};
             m_rootNodes.emplace_back(pNode);
             // Find the children of this particle and recursively add them to the hierarchy
             const MCParticleList &children{pPrimary->GetDaughterList()};
@@ -538,8 +537,6 @@ LArHierarchyHelper::MCHierarchy::Node::~Node()
 {
     m_mcParticles.clear();
     m_caloHits.clear();
-    for (const Node *node : m_children)
-        delete node;
     m_children.clear();
 }
 
@@ -562,7 +559,7 @@ void LArHierarchyHelper::MCHierarchy::Node::FillHierarchy(const MCParticle *pRoo
             }
         }
 
-        Node *pNode{new Node(m_hierarchy, leadingParticles, allHits, this->m_tier + 1)};
+        Node *pNode{m_hierarchy.CreateNode(leadingParticles, allHits, this->m_tier + 1)};
         m_children.emplace_back(pNode);
         for (const MCParticle *pChild : childParticles)
             pNode->FillHierarchy(pChild, foldParameters);
@@ -600,7 +597,7 @@ void LArHierarchyHelper::MCHierarchy::Node::FillHierarchy(const MCParticle *pRoo
             // Only add the node if it either has children, or is a leaf node with hits
             if (hasChildren || (!hasChildren && !allHits.empty()))
             {
-                Node *pNode{new Node(m_hierarchy, allParticles, allHits, this->m_tier + 1)};
+                Node *pNode{m_hierarchy.CreateNode(allParticles, allHits, this->m_tier + 1)};
                 m_children.emplace_back(pNode);
                 if (hasChildren)
                 {
@@ -640,7 +637,7 @@ void LArHierarchyHelper::MCHierarchy::Node::FillFlat(const MCParticle *pRoot)
     }
     if (!allParticles.empty())
     {
-        Node *pNode{new Node(m_hierarchy, allParticles, allHits, this->m_tier + 1)};
+        Node *pNode{m_hierarchy.CreateNode(allParticles, allHits, this->m_tier + 1)};
         m_children.emplace_back(pNode);
     }
 }
@@ -769,9 +766,8 @@ LArHierarchyHelper::RecoHierarchy::RecoHierarchy() : m_pNeutrino{nullptr}
 
 LArHierarchyHelper::RecoHierarchy::~RecoHierarchy()
 {
-    for (const Node *pNode : m_rootNodes)
-        delete pNode;
     m_rootNodes.clear();
+    m_nodeArena.clear();
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -792,7 +788,7 @@ void LArHierarchyHelper::RecoHierarchy::FillHierarchy(const PfoList &pfoList, co
             CaloHitList allHits;
             for (const ParticleFlowObject *pPfo : allParticles)
                 LArPfoHelper::GetAllCaloHits(pPfo, allHits);
-            m_rootNodes.emplace_back(new Node(*this, allParticles, allHits));
+            m_rootNodes.emplace_back(this->CreateNode(allParticles, allHits));
         }
     }
     else if (foldParameters.m_foldToLeadingShowers)
@@ -811,7 +807,7 @@ void LArHierarchyHelper::RecoHierarchy::FillHierarchy(const PfoList &pfoList, co
             CaloHitList allHits;
             for (const ParticleFlowObject *pPfo : allParticles)
                 LArPfoHelper::GetAllCaloHits(pPfo, allHits);
-            Node *pNode{new Node(*this, allParticles, allHits)};
+            Node *pNode{this->CreateNode(allParticles, allHits)};
             m_rootNodes.emplace_back(pNode);
             if (!isShower)
             {
@@ -831,7 +827,7 @@ void LArHierarchyHelper::RecoHierarchy::FillHierarchy(const PfoList &pfoList, co
             CaloHitList allHits;
             for (const ParticleFlowObject *pPfo : allParticles)
                 LArPfoHelper::GetAllCaloHits(pPfo, allHits);
-            Node *pNode{new Node(*this, allParticles, allHits)};
+            Node *pNode{this->CreateNode(allParticles, allHits)};
             m_rootNodes.emplace_back(pNode);
             // Find the children of this particle and recursively add them to the hierarchy
             const PfoList &children{pPrimary->GetDaughterPfoList()};
@@ -908,8 +904,6 @@ LArHierarchyHelper::RecoHierarchy::Node::~Node()
 {
     m_pfos.clear();
     m_caloHits.clear();
-    for (const Node *node : m_children)
-        delete node;
     m_children.clear();
 }
 
@@ -936,7 +930,7 @@ void LArHierarchyHelper::RecoHierarchy::Node::FillHierarchy(const ParticleFlowOb
 
     if (hasChildren || (!hasChildren && !allHits.empty()))
     {
-        Node *pNode{new Node(m_hierarchy, allParticles, allHits)};
+        Node *pNode{m_hierarchy.CreateNode(allParticles, allHits)};
         m_children.emplace_back(pNode);
 
         if (hasChildren)
@@ -957,7 +951,7 @@ void LArHierarchyHelper::RecoHierarchy::Node::FillFlat(const ParticleFlowObject
     CaloHitList allHits;
     for (const ParticleFlowObject *pPfo : allParticles)
         LArPfoHelper::GetAllCaloHits(pPfo, allHits);
-    Node *pNode{new Node(m_hierarchy, allParticles, allHits)};
+    Node *pNode{m_hierarchy.CreateNode(allParticles, allHits)};
     m_children.emplace_back(pNode);
 }
 
@@ -1204,30 +1198,66 @@ void LArHierarchyHelper::MatchInfo::Match(const MCHierarchy &mcHierarchy, const
     std::sort(recoNodes.begin(), recoNodes.end(),
         [](const RecoHierarchy::Node *lhs, const RecoHierarchy::Node *rhs) { return lhs->GetCaloHits().size() > rhs->GetCaloHits().size(); });
 
+    // Index the reconstructable mc node hits (sorted, so repeats are adjacent), to count the hits shared with every mc node in one pass
+    typedef std::pair<size_t, size_t> NodeIndexMultiplicityPair;
+    std::unordered_map<const CaloHit *, std::vector<NodeIndexMultiplicityPair>> hitToMCNodesMap;
+    for (size_t mcIndex = 0; mcIndex < mcNodes.size(); ++mcIndex)
+    {
+        const MCHierarchy::Node *pMCNode{mcNodes[mcIndex]};
+        if (!pMCNode->IsReconstructable())
+            continue;
+        for (const CaloHit *pCaloHit : pMCNode->GetCaloHits())
+        {
+            std::vector<NodeIndexMultiplicityPair> &mcNodeEntries{hitToMCNodesMap[pCaloHit]};
+            if (!mcNodeEntries.empty() && (mcNodeEntries.back().first == mcIndex))
+                ++mcNodeEntries.back().second;
+            else
+                mcNodeEntries.emplace_back(mcIndex, 1);
+        }
+    }
+
     std::map<const MCHierarchy::Node *, MCMatches> mcToMatchMap;
+    std::vector<size_t> sharedHitsVector(mcNodes.size(), 0);
+    std::vector<size_t> touchedMCIndices;
     for (const RecoHierarchy::Node *pRecoNode : recoNodes)
     {
         const CaloHitList &recoHits{pRecoNode->GetCaloHits()};
-        const MCHierarchy::Node *pBestNode{nullptr};
-        size_t bestSharedHits{0};
-        for (const MCHierarchy::Node *pMCNode : mcNodes)
+
+        // ATTN Count as for a sorted range intersection, with each repeated hit contributing its smaller multiplicity
+        for (auto hitIter = recoHits.begin(); hitIter != recoHits.end();)
         {
-            if (!pMCNode->IsReconstructable())
+            const CaloHit *const pCaloHit{*hitIter};
+            size_t recoMultiplicity{0};
+            for (; (hitIter != recoHits.end()) && (*hitIter == pCaloHit); ++hitIter)
+                ++recoMultiplicity;
+
+            const auto mcIter{hitToMCNodesMap.find(pCaloHit)};
+            if (mcIter == hitToMCNodesMap.end())
                 continue;
-            const CaloHitList &mcHits{pMCNode->GetCaloHits()};
-            CaloHitVector intersection;
-            std::set_intersection(mcHits.begin(), mcHits.end(), recoHits.begin(), recoHits.end(), std::back_inserter(intersection));
+            for (const NodeIndexMultiplicityPair &mcNodeEntry : mcIter->second)
+            {
+                size_t &sharedHits{sharedHitsVector[mcNodeEntry.first]};
+                if (0 == sharedHits)
+                    touchedMCIndices.emplace_back(mcNodeEntry.first);
+                sharedHits += std::min(recoMultiplicity, mcNodeEntry.second);
+            }
+        }
 
-            if (!intersection.empty())
+        // ATTN Only the mc nodes sharing hits are visited, with ties going to the earliest mc node, then their counts are reset
+        const MCHierarchy::Node *pBestNode{nullptr};
+        size_t bestSharedHits{0}, bestMCIndex{0};
+        for (const size_t mcIndex : touchedMCIndices)
+        {
+            const size_t sharedHits{sharedHitsVector[mcIndex]};
+            if ((sharedHits > bestSharedHits) || ((sharedHits == bestSharedHits) && (mcIndex < bestMCIndex)))
             {
-                const size_t sharedHits{intersection.size()};
-                if (sharedHits > bestSharedHits)
-                {
-                    bestSharedHits = sharedHits;
-                    pBestNode = pMCNode;
-                }
+                bestSharedHits = sharedHits;
+                bestMCIndex = mcIndex;
+                pBestNode = mcNodes[mcIndex];
             }
+            sharedHitsVector[mcIndex] = 0;
         }
+        touchedMCIndices.clear();
         if (pBestNode)
         {
             auto iter{mcToMatchMap.find(pBestNode)};
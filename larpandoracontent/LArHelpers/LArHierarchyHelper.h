@@ -15,6 +15,9 @@
 #include "larpandoracontent/LArHelpers/LArMCParticleHelper.h"
 #include "larpandoracontent/LArHelpers/LArPfoHelper.h"
 
+#include <deque>
+#include <utility>
+
 namespace lar_content
 {
 
@@ -412,6 +415,17 @@ public:
          */
         bool IsReconstructable(const pandora::CaloHitList &caloHits) const;
 
+        /**
+         *  @brief  Create a node owned by this hierarchy, which remains valid until the hierarchy is destroyed
+         *
+         *  @param  args The node constructor arguments following the parent hierarchy
+         *
+         *  @return The address of the new node
+         */
+        template <typename... TARGS>
+        Node *CreateNode(TARGS &&... args);
+
+        std::deque<Node> m_nodeArena;              ///< The storage for all nodes in the hierarchy, with stable addresses
         NodeVector m_rootNodes;                    ///< The leading nodes (e.g. primary particles, cosmic rays, ...)
         ReconstructabilityCriteria m_recoCriteria; ///< The criteria used to determine if the node is reconstructable
         const pandora::MCParticle *m_pNeutrino;    ///< The incident neutrino, if it exists
@@ -580,6 +594,17 @@ public:
         const std::string ToString() const;
 
     private:
+        /**
+         *  @brief  Create a node owned by this hierarchy, which remains valid until the hierarchy is destroyed
+         *
+         *  @param  args The node constructor arguments following the parent hierarchy
+         *
+         *  @return The address of the new node
+         */
+        template <typename... TARGS>
+        Node *CreateNode(TARGS &&... args) const;
+
+        mutable std::deque<Node> m_nodeArena;           ///< The storage for all nodes in the hierarchy, with stable addresses
         NodeVector m_rootNodes;                         ///< The leading nodes (e.g. primary particles, cosmic rays, ...)
         const pandora::ParticleFlowObject *m_pNeutrino; ///< The incident neutrino, if it exists
     };
@@ -971,6 +996,15 @@ inline bool LArHierarchyHelper::MCHierarchy::IsTestBeamHierarchy() const
     return m_pNeutrino == nullptr;
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename... TARGS>
+inline LArHierarchyHelper::MCHierarchy::Node *LArHierarchyHelper::MCHierarchy::CreateNode(TARGS &&... args)
+{
+    m_nodeArena.emplace_back(*this, std::forward<TARGS>(args)...);
+    return &m_nodeArena.back();
+}
+
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -994,6 +1028,15 @@ inline const pandora::ParticleFlowObject *LArHierarchyHelper::RecoHierarchy::Get
     return m_pNeutrino;
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename... TARGS>
+inline LArHierarchyHelper::RecoHierarchy::Node *LArHierarchyHelper::RecoHierarchy::CreateNode(TARGS &&... args) const
+{
+    m_nodeArena.emplace_back(*this, std::forward<TARGS>(args)...);
+    return &m_nodeArena.back();
+}
+
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
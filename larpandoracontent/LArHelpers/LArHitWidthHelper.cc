@@ -120,19 +120,25 @@ unsigned int LArHitWidthHelper::GetNProposedConstituentHits(const Cluster *const
 LArHitWidthHelper::ConstituentHitVector LArHitWidthHelper::GetConstituentHits(
     const Cluster *const pCluster, const float maxConstituentHitWidth, const float hitWidthScalingFactor, const bool isUniform)
 {
-    if (maxConstituentHitWidth < std::numeric_limits<float>::epsilon())
-    {
-        std::cout << "LArHitWidthHelper::GetConstituentHits - Negative or equivalent to zero constitent hit width not allowed" << std::endl;
-        throw StatusCodeException(STATUS_CODE_NOT_ALLOWED);
-    }
+    ConstituentHitVector constituentHitVector;
+    LArHitWidthHelper::GetConstituentHits(pCluster, maxConstituentHitWidth, hitWidthScalingFactor, isUniform, constituentHitVector);
 
-    const OrderedCaloHitList &orderedCaloHitList(pCluster->GetOrderedCaloHitList());
+    return constituentHitVector;
+}
 
-    if (orderedCaloHitList.empty())
-        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
+//------------------------------------------------------------------------------------------------------------------------------------------
 
-    ConstituentHitVector constituentHitVector;
-    for (const OrderedCaloHitList::value_type &mapEntry : orderedCaloHitList)
+void LArHitWidthHelper::GetConstituentHits(const Cluster *const pCluster, const float maxConstituentHitWidth,
+    const float hitWidthScalingFactor, const bool isUniform, ConstituentHitVector &constituentHitVector)
+{
+    // ATTN Also validates the constituent hit width and cluster, so that the vector is left untouched if an exception is raised
+    const unsigned int nConstituentHits(
+        LArHitWidthHelper::GetNProposedConstituentHits(pCluster, maxConstituentHitWidth, hitWidthScalingFactor));
+
+    constituentHitVector.clear();
+    constituentHitVector.reserve(nConstituentHits);
+
+    for (const OrderedCaloHitList::value_type &mapEntry : pCluster->GetOrderedCaloHitList())
     {
         for (const CaloHit *const pCaloHit : *mapEntry.second)
         {
@@ -149,8 +155,6 @@ LArHitWidthHelper::ConstituentHitVector LArHitWidthHelper::GetConstituentHits(
             }
         }
     }
-
-    return constituentHitVector;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -222,6 +222,20 @@ public:
     static ConstituentHitVector GetConstituentHits(
         const pandora::Cluster *const pCluster, const float maxConstituentHitWidth, const float hitWidthScalingFactor, const bool isUniform);
 
+    /**
+     *  @brief  Break up the cluster hits into constituent hits, writing them into a caller-owned vector so that its storage can be reused
+     *          across clusters
+     *
+     *  @param  pCluster the input cluster
+     *  @param  maxConstituentHitWidth the maximum width of a constituent hit
+     *  @param  hitWidthScalingFactor the constituent hit width scaling factor
+     *  @param  isUniform whether to break up the hit into uniform constituent hits (and pad the hit) or not
+     *          in the non-uniform case constituent hits from different hits may have different weights
+     *  @param  constituentHitVector to receive the constituent hits, replacing its existing contents
+     */
+    static void GetConstituentHits(const pandora::Cluster *const pCluster, const float maxConstituentHitWidth,
+        const float hitWidthScalingFactor, const bool isUniform, ConstituentHitVector &constituentHitVector);
+
     /**
      *  @brief  Break up the calo hit into constituent hits
      *
@@ -0,0 +1,50 @@
+/**
+ *  @file   larpandoracontent/LArHelpers/LArMCHierarchySnapshotHelper.cc
+ *
+ *  @brief  Implementation of the mc hierarchy snapshot helper class.
+ *
+ *  $Log: $
+ */
+
+#include "Pandora/AlgorithmHeaders.h"
+
+#include "larpandoracontent/LArHelpers/LArMCHierarchySnapshotHelper.h"
+
+using namespace pandora;
+
+namespace lar_content
+{
+
+LArMCHierarchySnapshotHelper::PandoraToMCHierarchySnapshotCacheMap LArMCHierarchySnapshotHelper::m_pandoraToMCHierarchySnapshotCacheMap;
+std::mutex LArMCHierarchySnapshotHelper::m_mutex;
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const MCHierarchySnapshot &LArMCHierarchySnapshotHelper::GetMCHierarchySnapshot(
+    const Pandora &pandora, const MCParticleList &mcParticleList, const CaloHitList &caloHitList)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    MCHierarchySnapshotCache &mcHierarchySnapshotCache(m_pandoraToMCHierarchySnapshotCacheMap[&pandora]);
+    const MCHierarchySnapshotCache::key_type key(&mcParticleList, &caloHitList);
+    MCHierarchySnapshotCache::iterator iter(mcHierarchySnapshotCache.find(key));
+
+    if (mcHierarchySnapshotCache.end() != iter)
+    {
+        if (iter->second.IsConsistent(mcParticleList, caloHitList))
+            return iter->second;
+
+        mcHierarchySnapshotCache.erase(iter);
+    }
+
+    return mcHierarchySnapshotCache.emplace(key, MCHierarchySnapshot(mcParticleList, caloHitList)).first->second;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArMCHierarchySnapshotHelper::Reset(const Pandora &pandora)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_pandoraToMCHierarchySnapshotCacheMap.erase(&pandora);
+}
+
+} // namespace lar_content
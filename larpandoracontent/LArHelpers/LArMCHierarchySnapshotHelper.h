@@ -0,0 +1,62 @@
+/**
+ *  @file   larpandoracontent/LArHelpers/LArMCHierarchySnapshotHelper.h
+ *
+ *  @brief  Header file for the mc hierarchy snapshot helper class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_MC_HIERARCHY_SNAPSHOT_HELPER_H
+#define LAR_MC_HIERARCHY_SNAPSHOT_HELPER_H 1
+
+#include "larpandoracontent/LArObjects/LArMCHierarchySnapshot.h"
+
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+namespace lar_content
+{
+
+/**
+ *  @brief  LArMCHierarchySnapshotHelper class, sharing mc hierarchy snapshots of mc particle and calo hit lists between algorithms within
+ *          an event
+ */
+class LArMCHierarchySnapshotHelper
+{
+public:
+    /**
+     *  @brief  Get the mc hierarchy snapshot for given mc particle and calo hit lists, using a cached snapshot if one was previously built
+     *          for the same lists. Cached snapshots are rebuilt if either list has since changed in size. Intended for the input lists,
+     *          which are fixed throughout an event.
+     *
+     *  @param  pandora the pandora instance owning the lists
+     *  @param  mcParticleList the mc particle list
+     *  @param  caloHitList the calo hit list
+     *
+     *  @return the mc hierarchy snapshot, valid until the cache is reset
+     *
+     *  @throw  StatusCodeException if the snapshot cannot be built
+     */
+    static const MCHierarchySnapshot &GetMCHierarchySnapshot(
+        const pandora::Pandora &pandora, const pandora::MCParticleList &mcParticleList, const pandora::CaloHitList &caloHitList);
+
+    /**
+     *  @brief  Remove all cached mc hierarchy snapshots for a pandora instance, to be called at the end of each event
+     *
+     *  @param  pandora the pandora instance
+     */
+    static void Reset(const pandora::Pandora &pandora);
+
+private:
+    typedef std::pair<const pandora::MCParticleList *, const pandora::CaloHitList *> InputListPair;
+    typedef std::map<InputListPair, MCHierarchySnapshot> MCHierarchySnapshotCache;
+    typedef std::unordered_map<const pandora::Pandora *, MCHierarchySnapshotCache> PandoraToMCHierarchySnapshotCacheMap;
+
+    static PandoraToMCHierarchySnapshotCacheMap m_pandoraToMCHierarchySnapshotCacheMap; ///< The snapshot cache for each pandora instance
+    static std::mutex m_mutex;                                                          ///< The mutex protecting the snapshot caches
+};
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_MC_HIERARCHY_SNAPSHOT_HELPER_H
@@ -20,6 +20,9 @@
 #include "larpandoracontent/LArHelpers/LArMonitoringHelper.h"
 #include "larpandoracontent/LArHelpers/LArPfoHelper.h"
 
+#include "larpandoracontent/LArObjects/LArCompactMCWeights.h"
+#include "larpandoracontent/LArObjects/LArMCHierarchySnapshot.h"
+
 #include <algorithm>
 #include <cstdlib>
 
@@ -496,12 +499,22 @@ bool LArMCParticleHelper::SortByMomentum(const MCParticle *const pLhs, const MCP
 
 void LArMCParticleHelper::GetMCParticleToCaloHitMatches(const CaloHitList *const pCaloHitList, const MCRelationMap &mcToTargetMCMap,
     CaloHitToMCMap &hitToMCMap, MCContributionMap &mcToTrueHitListMap)
+{
+    CompactMCWeightTable emptyMCWeightTable;
+    LArMCParticleHelper::GetMCParticleToCaloHitMatches(pCaloHitList, emptyMCWeightTable, mcToTargetMCMap, hitToMCMap, mcToTrueHitListMap);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArMCParticleHelper::GetMCParticleToCaloHitMatches(const CaloHitList *const pCaloHitList, const CompactMCWeightTable &mcWeightTable,
+    const MCRelationMap &mcToTargetMCMap, CaloHitToMCMap &hitToMCMap, MCContributionMap &mcToTrueHitListMap)
 {
     for (const CaloHit *const pCaloHit : *pCaloHitList)
     {
         try
         {
-            const MCParticle *const pHitParticle(MCParticleHelper::GetMainMCParticle(pCaloHit));
+            const MCParticle *const pHitParticle(mcWeightTable.HasWeights(pCaloHit) ? mcWeightTable.GetMainMCParticle(pCaloHit)
+                                                                                    : MCParticleHelper::GetMainMCParticle(pCaloHit));
             const MCParticle *pTargetParticle(pHitParticle);
 
             // ATTN Do not map back to target if mc to primary mc map or mc to self map not provided
@@ -536,16 +549,6 @@ void LArMCParticleHelper::SelectReconstructableMCParticles(const MCParticleList
     parameters.m_foldBackHierarchy ? LArMCParticleHelper::GetMCPrimaryMap(pMCParticleList, mcToTargetMCMap)
                                    : LArMCParticleHelper::GetMCToSelfMap(pMCParticleList, mcToTargetMCMap);
 
-    // Remove non-reconstructable hits, e.g. those downstream of a neutron
-    // Unless selectInputHits == false
-    CaloHitList selectedCaloHitList;
-    LArMCParticleHelper::SelectCaloHits(pCaloHitList, mcToTargetMCMap, selectedCaloHitList, parameters.m_selectInputHits, parameters.m_maxPhotonPropagation);
-
-    // Obtain maps: [hit -> target mc particle], [target mc particle -> list of hits]
-    CaloHitToMCMap trueHitToTargetMCMap;
-    MCContributionMap targetMCToTrueHitListMap;
-    LArMCParticleHelper::GetMCParticleToCaloHitMatches(&selectedCaloHitList, mcToTargetMCMap, trueHitToTargetMCMap, targetMCToTrueHitListMap);
-
     // Obtain vector: target mc particles
     MCParticleVector targetMCVector;
     if (parameters.m_foldBackHierarchy)
@@ -557,12 +560,28 @@ void LArMCParticleHelper::SelectReconstructableMCParticles(const MCParticleList
         std::copy(pMCParticleList->begin(), pMCParticleList->end(), std::back_inserter(targetMCVector));
     }
 
-    // Select MCParticles matching criteria
-    MCParticleVector candidateTargets;
-    LArMCParticleHelper::SelectParticlesMatchingCriteria(targetMCVector, fCriteria, candidateTargets, parameters, false);
+    LArMCParticleHelper::SelectReconstructableTargetMCParticles(
+        mcToTargetMCMap, targetMCVector, pCaloHitList, parameters, fCriteria, selectedMCParticlesToHitsMap);
+}
 
-    // Ensure the MCParticles have enough "good" hits to be reconstructed
-    LArMCParticleHelper::SelectParticlesByHitCount(candidateTargets, targetMCToTrueHitListMap, mcToTargetMCMap, parameters, selectedMCParticlesToHitsMap);
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArMCParticleHelper::SelectReconstructableMCParticles(const MCHierarchySnapshot &mcHierarchySnapshot, const CaloHitList *pCaloHitList,
+    const PrimaryParameters &parameters, std::function<bool(const MCParticle *const)> fCriteria, MCContributionMap &selectedMCParticlesToHitsMap)
+{
+    if (parameters.m_foldBackHierarchy)
+    {
+        LArMCParticleHelper::SelectReconstructableTargetMCParticles(mcHierarchySnapshot.GetMCPrimaryMap(),
+            mcHierarchySnapshot.GetPrimaryMCParticles(), pCaloHitList, parameters, fCriteria, selectedMCParticlesToHitsMap);
+        return;
+    }
+
+    LArMCParticleHelper::MCRelationMap mcToSelfMap;
+    for (const MCParticle *const pMCParticle : mcHierarchySnapshot.GetInputMCParticles())
+        mcToSelfMap[pMCParticle] = pMCParticle;
+
+    LArMCParticleHelper::SelectReconstructableTargetMCParticles(
+        mcToSelfMap, mcHierarchySnapshot.GetInputMCParticles(), pCaloHitList, parameters, fCriteria, selectedMCParticlesToHitsMap);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -641,10 +660,13 @@ void LArMCParticleHelper::GetTestBeamHierarchyPfoToReconstructable2DHitsMap(cons
 void LArMCParticleHelper::GetPfoToReconstructable2DHitsMap(const PfoList &pfoList, const MCContributionMapVector &selectedMCParticleToHitsMaps,
     PfoContributionMap &pfoToReconstructable2DHitsMap, const bool foldBackHierarchy)
 {
+    CaloHitSet reconstructableCaloHitSet;
+    LArMCParticleHelper::GetReconstructableCaloHitSet(selectedMCParticleToHitsMaps, reconstructableCaloHitSet);
+
     for (const ParticleFlowObject *const pPfo : pfoList)
     {
         CaloHitList pfoHitList;
-        LArMCParticleHelper::CollectReconstructable2DHits(pPfo, selectedMCParticleToHitsMaps, pfoHitList, foldBackHierarchy);
+        LArMCParticleHelper::CollectReconstructable2DHits(pPfo, reconstructableCaloHitSet, pfoHitList, foldBackHierarchy);
 
         if (!pfoToReconstructable2DHitsMap.insert(PfoContributionMap::value_type(pPfo, pfoHitList)).second)
             throw StatusCodeException(STATUS_CODE_ALREADY_PRESENT);
@@ -656,10 +678,13 @@ void LArMCParticleHelper::GetPfoToReconstructable2DHitsMap(const PfoList &pfoLis
 void LArMCParticleHelper::GetTestBeamHierarchyPfoToReconstructable2DHitsMap(const PfoList &pfoList,
     const MCContributionMapVector &selectedMCParticleToHitsMaps, PfoContributionMap &pfoToReconstructable2DHitsMap, const bool foldBackHierarchy)
 {
+    CaloHitSet reconstructableCaloHitSet;
+    LArMCParticleHelper::GetReconstructableCaloHitSet(selectedMCParticleToHitsMaps, reconstructableCaloHitSet);
+
     for (const ParticleFlowObject *const pPfo : pfoList)
     {
         CaloHitList pfoHitList;
-        LArMCParticleHelper::CollectReconstructableTestBeamHierarchy2DHits(pPfo, selectedMCParticleToHitsMaps, pfoHitList, foldBackHierarchy);
+        LArMCParticleHelper::CollectReconstructableTestBeamHierarchy2DHits(pPfo, reconstructableCaloHitSet, pfoHitList, foldBackHierarchy);
 
         if (!pfoToReconstructable2DHitsMap.insert(PfoContributionMap::value_type(pPfo, pfoHitList)).second)
             throw StatusCodeException(STATUS_CODE_ALREADY_PRESENT);
@@ -677,16 +702,55 @@ void LArMCParticleHelper::GetPfoMCParticleHitSharingMaps(const PfoContributionMa
         sortedPfos.push_back(mapEntry.first);
     std::sort(sortedPfos.begin(), sortedPfos.end(), LArPfoHelper::SortByNHits);
 
+    // Index the selected mc particles by hit, so the hits each pfo shares with every mc particle are found in a single pass over its hits
+    typedef std::pair<unsigned int, const MCParticle *> MapIndexMCParticlePair;
+    typedef std::unordered_map<const CaloHit *, std::vector<MapIndexMCParticlePair>> CaloHitToMCParticlesMap;
+
+    CaloHitToMCParticlesMap caloHitToMCParticlesMap;
+    std::vector<MCParticleVector> sortedMCParticlesByMap;
+
+    for (unsigned int mapIndex = 0; mapIndex < selectedMCParticleToHitsMaps.size(); ++mapIndex)
+    {
+        MCParticleVector sortedMCParticles;
+        for (const auto &mapEntry : selectedMCParticleToHitsMaps.at(mapIndex))
+            sortedMCParticles.push_back(mapEntry.first);
+        std::sort(sortedMCParticles.begin(), sortedMCParticles.end(), PointerLessThan<MCParticle>());
+
+        for (const auto &mapEntry : selectedMCParticleToHitsMaps.at(mapIndex))
+        {
+            for (const CaloHit *const pCaloHit : mapEntry.second)
+            {
+                std::vector<MapIndexMCParticlePair> &mcParticles(caloHitToMCParticlesMap[pCaloHit]);
+                const MapIndexMCParticlePair mapIndexMCParticlePair(mapIndex, mapEntry.first);
+
+                if (mcParticles.end() == std::find(mcParticles.begin(), mcParticles.end(), mapIndexMCParticlePair))
+                    mcParticles.push_back(mapIndexMCParticlePair);
+            }
+        }
+
+        sortedMCParticlesByMap.push_back(sortedMCParticles);
+    }
+
     for (const ParticleFlowObject *const pPfo : sortedPfos)
     {
-        for (const MCContributionMap &mcParticleToHitsMap : selectedMCParticleToHitsMaps)
+        std::vector<MCContributionMap> sharedHitsByMap(selectedMCParticleToHitsMaps.size());
+
+        for (const CaloHit *const pCaloHit : pfoToReconstructable2DHitsMap.at(pPfo))
+        {
+            const CaloHitToMCParticlesMap::const_iterator hitIter(caloHitToMCParticlesMap.find(pCaloHit));
+
+            if (caloHitToMCParticlesMap.end() == hitIter)
+                continue;
+
+            for (const MapIndexMCParticlePair &mapIndexMCParticlePair : hitIter->second)
+                sharedHitsByMap.at(mapIndexMCParticlePair.first)[mapIndexMCParticlePair.second].push_back(pCaloHit);
+        }
+
+        for (unsigned int mapIndex = 0; mapIndex < selectedMCParticleToHitsMaps.size(); ++mapIndex)
         {
-            MCParticleVector sortedMCParticles;
-            for (const auto &mapEntry : mcParticleToHitsMap)
-                sortedMCParticles.push_back(mapEntry.first);
-            std::sort(sortedMCParticles.begin(), sortedMCParticles.end(), PointerLessThan<MCParticle>());
+            const MCContributionMap &sharedHitsMap(sharedHitsByMap.at(mapIndex));
 
-            for (const MCParticle *const pMCParticle : sortedMCParticles)
+            for (const MCParticle *const pMCParticle : sortedMCParticlesByMap.at(mapIndex))
             {
                 // Add map entries for this Pfo & MCParticle if required
                 if (pfoToMCParticleHitSharingMap.find(pPfo) == pfoToMCParticleHitSharingMap.end())
@@ -709,11 +773,12 @@ void LArMCParticleHelper::GetPfoMCParticleHitSharingMaps(const PfoContributionMa
                     throw StatusCodeException(STATUS_CODE_ALREADY_PRESENT);
 
                 // Add records to maps if there are any shared hits
-                const CaloHitList sharedHits(
-                    LArMCParticleHelper::GetSharedHits(pfoToReconstructable2DHitsMap.at(pPfo), mcParticleToHitsMap.at(pMCParticle)));
+                const MCContributionMap::const_iterator sharedHitsIter(sharedHitsMap.find(pMCParticle));
 
-                if (!sharedHits.empty())
+                if ((sharedHitsMap.end() != sharedHitsIter) && !sharedHitsIter->second.empty())
                 {
+                    const CaloHitList &sharedHits(sharedHitsIter->second);
+
                     mcHitPairs.push_back(MCParticleCaloHitListPair(pMCParticle, sharedHits));
                     pfoHitPairs.push_back(PfoCaloHitListPair(pPfo, sharedHits));
 
@@ -744,10 +809,13 @@ void LArMCParticleHelper::GetClusterToReconstructable2DHitsMap(const pandora::Cl
 void LArMCParticleHelper::GetClusterToReconstructable2DHitsMap(const pandora::ClusterList &clusterList,
     const MCContributionMapVector &selectedMCToHitsMaps, ClusterContributionMap &clusterToReconstructable2DHitsMap)
 {
+    CaloHitSet reconstructableCaloHitSet;
+    LArMCParticleHelper::GetReconstructableCaloHitSet(selectedMCToHitsMaps, reconstructableCaloHitSet);
+
     for (const Cluster *const pCluster : clusterList)
     {
         CaloHitList caloHitList;
-        LArMCParticleHelper::CollectReconstructable2DHits(pCluster, selectedMCToHitsMaps, caloHitList);
+        LArMCParticleHelper::CollectReconstructable2DHits(pCluster, reconstructableCaloHitSet, caloHitList);
 
         if (!clusterToReconstructable2DHitsMap.insert(ClusterContributionMap::value_type(pCluster, caloHitList)).second)
             throw StatusCodeException(STATUS_CODE_ALREADY_PRESENT);
@@ -945,9 +1013,23 @@ CaloHitList LArMCParticleHelper::GetSharedHits(const CaloHitList &hitListA, cons
 {
     CaloHitList sharedHits;
 
+    // ATTN For all but the shortest lists, test membership via a hash set rather than repeated list traversal
+    if ((hitListA.size() < 8) || (hitListB.size() < 8))
+    {
+        for (const CaloHit *const pCaloHit : hitListA)
+        {
+            if (std::find(hitListB.begin(), hitListB.end(), pCaloHit) != hitListB.end())
+                sharedHits.push_back(pCaloHit);
+        }
+
+        return sharedHits;
+    }
+
+    const CaloHitSet caloHitSetB(hitListB.begin(), hitListB.end());
+
     for (const CaloHit *const pCaloHit : hitListA)
     {
-        if (std::find(hitListB.begin(), hitListB.end(), pCaloHit) != hitListB.end())
+        if (caloHitSetB.count(pCaloHit))
             sharedHits.push_back(pCaloHit);
     }
 
@@ -956,6 +1038,41 @@ CaloHitList LArMCParticleHelper::GetSharedHits(const CaloHitList &hitListA, cons
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void LArMCParticleHelper::GetCaloHitToMCMap(const MCContributionMap &mcToHitsMap, CaloHitToMCMap &hitToMCMap)
+{
+    for (const MCContributionMap::value_type &mapEntry : mcToHitsMap)
+    {
+        for (const CaloHit *const pCaloHit : mapEntry.second)
+        {
+            const auto insertResult(hitToMCMap.insert(CaloHitToMCMap::value_type(pCaloHit, mapEntry.first)));
+
+            if (!insertResult.second && (insertResult.first->second != mapEntry.first))
+                throw StatusCodeException(STATUS_CODE_ALREADY_PRESENT);
+        }
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArMCParticleHelper::CountSharedHits(const CaloHitList &caloHitList, const CaloHitToMCMap &hitToMCMap,
+    MCParticleIntMap &mcToSharedHitCountMap, MCContributionMap *const pMCToSharedHitsMap)
+{
+    for (const CaloHit *const pCaloHit : caloHitList)
+    {
+        const CaloHitToMCMap::const_iterator iter(hitToMCMap.find(pCaloHit));
+
+        if (hitToMCMap.end() == iter)
+            continue;
+
+        ++mcToSharedHitCountMap[iter->second];
+
+        if (pMCToSharedHitsMap)
+            (*pMCToSharedHitsMap)[iter->second].push_back(pCaloHit);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 bool LArMCParticleHelper::AreTopologicallyContinuous(const MCParticle *const pMCParent, const MCParticle *const pMCChild, const float cosAngleTolerance)
 {
     CartesianVector childDirection{pMCChild->GetEndpoint() - pMCChild->GetVertex()};
@@ -991,8 +1108,8 @@ bool LArMCParticleHelper::AreTopologicallyContinuous(const MCParticle *const pMC
 // private
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void LArMCParticleHelper::CollectReconstructable2DHits(const ParticleFlowObject *const pPfo,
-    const MCContributionMapVector &selectedMCParticleToHitsMaps, CaloHitList &reconstructableCaloHitList2D, const bool foldBackHierarchy)
+void LArMCParticleHelper::CollectReconstructable2DHits(const ParticleFlowObject *const pPfo, const CaloHitSet &reconstructableCaloHitSet,
+    CaloHitList &reconstructableCaloHitList2D, const bool foldBackHierarchy)
 {
 
     PfoList pfoList;
@@ -1008,13 +1125,13 @@ void LArMCParticleHelper::CollectReconstructable2DHits(const ParticleFlowObject
         pfoList.push_back(pPfo);
     }
 
-    LArMCParticleHelper::CollectReconstructable2DHits(pfoList, selectedMCParticleToHitsMaps, reconstructableCaloHitList2D);
+    LArMCParticleHelper::CollectReconstructable2DHits(pfoList, reconstructableCaloHitSet, reconstructableCaloHitList2D);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void LArMCParticleHelper::CollectReconstructableTestBeamHierarchy2DHits(const ParticleFlowObject *const pPfo,
-    const MCContributionMapVector &selectedMCParticleToHitsMaps, CaloHitList &reconstructableCaloHitList2D, const bool foldBackHierarchy)
+    const CaloHitSet &reconstructableCaloHitSet, CaloHitList &reconstructableCaloHitList2D, const bool foldBackHierarchy)
 {
 
     PfoList pfoList;
@@ -1037,13 +1154,13 @@ void LArMCParticleHelper::CollectReconstructableTestBeamHierarchy2DHits(const Pa
         pfoList.push_back(pPfo);
     }
 
-    LArMCParticleHelper::CollectReconstructable2DHits(pfoList, selectedMCParticleToHitsMaps, reconstructableCaloHitList2D);
+    LArMCParticleHelper::CollectReconstructable2DHits(pfoList, reconstructableCaloHitSet, reconstructableCaloHitList2D);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void LArMCParticleHelper::CollectReconstructable2DHits(
-    const PfoList &pfoList, const MCContributionMapVector &selectedMCParticleToHitsMaps, CaloHitList &reconstructableCaloHitList2D)
+    const PfoList &pfoList, const CaloHitSet &reconstructableCaloHitSet, CaloHitList &reconstructableCaloHitList2D)
 {
     CaloHitList caloHitList2D;
     LArPfoHelper::GetCaloHits(pfoList, TPC_VIEW_U, caloHitList2D);
@@ -1056,31 +1173,15 @@ void LArMCParticleHelper::CollectReconstructable2DHits(
     // Filter for only reconstructable hits
     for (const CaloHit *const pCaloHit : caloHitList2D)
     {
-        bool isTargetHit(false);
-        for (const MCContributionMap &mcParticleToHitsMap : selectedMCParticleToHitsMaps)
-        {
-            // ATTN This map is unordered, but this does not impact search for specific target hit
-            for (const MCContributionMap::value_type &mapEntry : mcParticleToHitsMap)
-            {
-                if (std::find(mapEntry.second.begin(), mapEntry.second.end(), pCaloHit) != mapEntry.second.end())
-                {
-                    isTargetHit = true;
-                    break;
-                }
-            }
-            if (isTargetHit)
-                break;
-        }
-
-        if (isTargetHit)
+        if (reconstructableCaloHitSet.count(pCaloHit))
             reconstructableCaloHitList2D.push_back(pCaloHit);
     }
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void LArMCParticleHelper::CollectReconstructable2DHits(const pandora::Cluster *const pCluster,
-    const MCContributionMapVector &selectedMCToHitsMaps, pandora::CaloHitList &reconstructableCaloHitList2D)
+void LArMCParticleHelper::CollectReconstructable2DHits(
+    const pandora::Cluster *const pCluster, const CaloHitSet &reconstructableCaloHitSet, pandora::CaloHitList &reconstructableCaloHitList2D)
 {
     const CaloHitList &isolatedCaloHitList{pCluster->GetIsolatedCaloHitList()};
     CaloHitList caloHitList;
@@ -1091,28 +1192,25 @@ void LArMCParticleHelper::CollectReconstructable2DHits(const pandora::Cluster *c
     // Filter for only reconstructable hits
     for (const CaloHit *const pCaloHit : caloHitList)
     {
-        bool isTargetHit{false};
-        for (const MCContributionMap &mcParticleToHitsMap : selectedMCToHitsMaps)
-        { // ATTN This map is unordered, but this does not impact search for specific target hit
-            for (const MCContributionMap::value_type &mapEntry : mcParticleToHitsMap)
-            {
-                if (std::find(mapEntry.second.begin(), mapEntry.second.end(), pCaloHit) != mapEntry.second.end())
-                {
-                    isTargetHit = true;
-                    break;
-                }
-            }
-            if (isTargetHit)
-                break;
-        }
-
-        if (isTargetHit)
+        if (reconstructableCaloHitSet.count(pCaloHit))
             reconstructableCaloHitList2D.push_back(pCaloHit);
     }
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void LArMCParticleHelper::GetReconstructableCaloHitSet(
+    const MCContributionMapVector &selectedMCParticleToHitsMaps, CaloHitSet &reconstructableCaloHitSet)
+{
+    for (const MCContributionMap &mcParticleToHitsMap : selectedMCParticleToHitsMaps)
+    {
+        for (const MCContributionMap::value_type &mapEntry : mcParticleToHitsMap)
+            reconstructableCaloHitSet.insert(mapEntry.second.begin(), mapEntry.second.end());
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void LArMCParticleHelper::SelectCaloHits(const CaloHitList *const pCaloHitList, const LArMCParticleHelper::MCRelationMap &mcToTargetMCMap,
     CaloHitList &selectedCaloHitList, const bool selectInputHits, const float maxPhotonPropagation)
 {
@@ -1284,6 +1382,30 @@ void LArMCParticleHelper::SelectGoodCaloHits(const CaloHitList *const pSelectedC
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void LArMCParticleHelper::SelectReconstructableTargetMCParticles(const MCRelationMap &mcToTargetMCMap, const MCParticleVector &targetMCVector,
+    const CaloHitList *pCaloHitList, const PrimaryParameters &parameters, std::function<bool(const MCParticle *const)> fCriteria,
+    MCContributionMap &selectedMCParticlesToHitsMap)
+{
+    // Remove non-reconstructable hits, e.g. those downstream of a neutron
+    // Unless selectInputHits == false
+    CaloHitList selectedCaloHitList;
+    LArMCParticleHelper::SelectCaloHits(pCaloHitList, mcToTargetMCMap, selectedCaloHitList, parameters.m_selectInputHits, parameters.m_maxPhotonPropagation);
+
+    // Obtain maps: [hit -> target mc particle], [target mc particle -> list of hits]
+    CaloHitToMCMap trueHitToTargetMCMap;
+    MCContributionMap targetMCToTrueHitListMap;
+    LArMCParticleHelper::GetMCParticleToCaloHitMatches(&selectedCaloHitList, mcToTargetMCMap, trueHitToTargetMCMap, targetMCToTrueHitListMap);
+
+    // Select MCParticles matching criteria
+    MCParticleVector candidateTargets;
+    LArMCParticleHelper::SelectParticlesMatchingCriteria(targetMCVector, fCriteria, candidateTargets, parameters, false);
+
+    // Ensure the MCParticles have enough "good" hits to be reconstructed
+    LArMCParticleHelper::SelectParticlesByHitCount(candidateTargets, targetMCToTrueHitListMap, mcToTargetMCMap, parameters, selectedMCParticlesToHitsMap);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void LArMCParticleHelper::SelectParticlesMatchingCriteria(const MCParticleVector &inputMCParticles,
     std::function<bool(const MCParticle *const)> fCriteria, MCParticleVector &selectedParticles, const PrimaryParameters &parameters, const bool isTestBeam)
 {
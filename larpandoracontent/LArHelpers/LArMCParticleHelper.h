@@ -18,6 +18,9 @@
 namespace lar_content
 {
 
+class CompactMCWeightTable;
+class MCHierarchySnapshot;
+
 /**
  *  @brief  LArMCParticleHelper class
  */
@@ -300,6 +303,19 @@ public:
     static void GetMCParticleToCaloHitMatches(const pandora::CaloHitList *const pCaloHitList, const MCRelationMap &mcToTargetMCMap,
         CaloHitToMCMap &hitToMCMap, MCContributionMap &mcToTrueHitListMap);
 
+    /**
+     *  @brief  Match calo hits to their parent particles, identifying the main mc particle for each hit using a table of compact mc
+     *          weights where available, and the calo hit mc particle weight map otherwise
+     *
+     *  @param  pCaloHitList the input list of calo hits
+     *  @param  mcWeightTable the table of compact mc weights
+     *  @param  mcToTargetMCMap the mc particle to target (primary or self) mc particle map
+     *  @param  hitToMCMap output mapping between calo hits and their main MC particle
+     *  @param  mcToTrueHitListMap output mapping between MC particles and their associated hits
+     */
+    static void GetMCParticleToCaloHitMatches(const pandora::CaloHitList *const pCaloHitList, const CompactMCWeightTable &mcWeightTable,
+        const MCRelationMap &mcToTargetMCMap, CaloHitToMCMap &hitToMCMap, MCContributionMap &mcToTrueHitListMap);
+
     /**
      *  @brief  Select target, reconstructable mc particles that match given criteria.
      *
@@ -313,6 +329,20 @@ public:
         const PrimaryParameters &parameters, std::function<bool(const pandora::MCParticle *const)> fCriteria,
         MCContributionMap &selectedMCParticlesToHitsMap);
 
+    /**
+     *  @brief  Select target, reconstructable mc particles that match given criteria, taking the mc particles and their hierarchy from a
+     *          precomputed snapshot. The results are those of the mc particle list version for the list from which the snapshot was built
+     *
+     *  @param  mcHierarchySnapshot the mc hierarchy snapshot
+     *  @param  pCaloHitList the address of the list of CaloHits
+     *  @param  parameters validation parameters to decide when an MCParticle is considered reconstructable
+     *  @param  fCriteria a function which returns a bool (= shouldSelect) for a given input MCParticle
+     *  @param  selectedMCParticlesToHitsMap the output mapping from selected mcparticles to their hits
+     */
+    static void SelectReconstructableMCParticles(const MCHierarchySnapshot &mcHierarchySnapshot, const pandora::CaloHitList *pCaloHitList,
+        const PrimaryParameters &parameters, std::function<bool(const pandora::MCParticle *const)> fCriteria,
+        MCContributionMap &selectedMCParticlesToHitsMap);
+
     /**
      *  @brief  Select target, reconstructable mc particles in the relevant hierarchy that match given criteria.
      *
@@ -460,6 +490,28 @@ public:
      */
     static pandora::CaloHitList GetSharedHits(const pandora::CaloHitList &hitListA, const pandora::CaloHitList &hitListB);
 
+    /**
+     *  @brief  Get the lookup table from hit to owning mc particle for a mapping from mc particles to hits
+     *
+     *  @param  mcToHitsMap the mapping from mc particles to hits
+     *  @param  hitToMCMap to receive the mapping from each hit to its mc particle
+     *
+     *  @throw  StatusCodeException if a hit is associated with more than one mc particle
+     */
+    static void GetCaloHitToMCMap(const MCContributionMap &mcToHitsMap, CaloHitToMCMap &hitToMCMap);
+
+    /**
+     *  @brief  Count the hits in a list (typically those of a pfo) shared with every mc particle, in a single pass over the list. Each mc
+     *          particle count matches the size of GetSharedHits for the list and the hits of that mc particle.
+     *
+     *  @param  caloHitList the hit list
+     *  @param  hitToMCMap the mapping from hit to mc particle, e.g. from GetCaloHitToMCMap
+     *  @param  mcToSharedHitCountMap to receive the number of shared hits for each mc particle sharing at least one hit
+     *  @param  pMCToSharedHitsMap if provided, to receive the shared hits for each mc particle, in hit list order
+     */
+    static void CountSharedHits(const pandora::CaloHitList &caloHitList, const CaloHitToMCMap &hitToMCMap,
+        MCParticleIntMap &mcToSharedHitCountMap, MCContributionMap *const pMCToSharedHitsMap = nullptr);
+
     /*
      *  @brief  Check whether or not an MC particle comes from a Bremsstrahlung process
      *
@@ -551,44 +603,55 @@ private:
      *  @brief  For a given Pfo, collect the hits which are reconstructable (=good hits belonging to a selected reconstructable MCParticle)
      *
      *  @param  pPfo the input pfo
-     *  @param  selectedMCParticleToHitsMaps the input mappings from selected reconstructable MCParticles to hits
+     *  @param  reconstructableCaloHitSet the set of hits belonging to selected reconstructable MCParticles
      *  @param  reconstructableCaloHitList2D the output list of reconstructable 2D calo hits in the input pfo
      *  @param  foldBackHierarchy whether to fold the particle hierarchy back to primaries
      */
-    static void CollectReconstructable2DHits(const pandora::ParticleFlowObject *const pPfo, const MCContributionMapVector &selectedMCParticleToHitsMaps,
-        pandora::CaloHitList &reconstructableCaloHitList2D, const bool foldBackHierarchy);
+    static void CollectReconstructable2DHits(const pandora::ParticleFlowObject *const pPfo,
+        const pandora::CaloHitSet &reconstructableCaloHitSet, pandora::CaloHitList &reconstructableCaloHitList2D,
+        const bool foldBackHierarchy);
 
     /**
      *  @brief  For a given Pfo, collect the hits which are reconstructable (=good hits belonging to a selected reconstructable MCParticle)
      *          and belong in the test beam particle interaction hierarchy
      *
      *  @param  pPfo the input pfo
-     *  @param  selectedMCParticleToHitsMaps the input mappings from selected reconstructable MCParticles to hits
+     *  @param  reconstructableCaloHitSet the set of hits belonging to selected reconstructable MCParticles
      *  @param  reconstructableCaloHitList2D the output list of reconstructable 2D calo hits in the input pfo
      *  @param  foldBackHierarchy whether to fold the particle hierarchy back to leading particles
      */
     static void CollectReconstructableTestBeamHierarchy2DHits(const pandora::ParticleFlowObject *const pPfo,
-        const MCContributionMapVector &selectedMCParticleToHitsMaps, pandora::CaloHitList &reconstructableCaloHitList2D, const bool foldBackHierarchy);
+        const pandora::CaloHitSet &reconstructableCaloHitSet, pandora::CaloHitList &reconstructableCaloHitList2D,
+        const bool foldBackHierarchy);
 
     /**
      *  @brief  For a given Pfo list, collect the hits which are reconstructable (=good hits belonging to a selected reconstructable MCParticle)
      *
      *  @param  pfoList the input pfo list
-     *  @param  selectedMCParticleToHitsMaps the input mappings from selected reconstructable MCParticles to hits
+     *  @param  reconstructableCaloHitSet the set of hits belonging to selected reconstructable MCParticles
      *  @param  reconstructableCaloHitList2D the output list of reconstructable 2D calo hits in the input pfo
      */
-    static void CollectReconstructable2DHits(const pandora::PfoList &pfoList, const MCContributionMapVector &selectedMCParticleToHitsMaps,
+    static void CollectReconstructable2DHits(const pandora::PfoList &pfoList, const pandora::CaloHitSet &reconstructableCaloHitSet,
         pandora::CaloHitList &reconstructableCaloHitList2D);
 
     /**
      *  @brief  For a given cluster, collect the hits which are reconstructable (=good hits belonging to a selected reconstructable MCParticle)
      *
      *  @param  pCluster the input cluster
-     *  @param  selectedMCToHitsMaps the input mappings from selected reconstructable MCParticles to hits
+     *  @param  reconstructableCaloHitSet the set of hits belonging to selected reconstructable MCParticles
      *  @param  reconstructableCaloHitList2D the output list of reconstructable 2D calo hits in the input pfo
      */
-    static void CollectReconstructable2DHits(const pandora::Cluster *const pCluster,
-        const MCContributionMapVector &selectedMCParticleToHitsMaps, pandora::CaloHitList &reconstructableCaloHitList2D);
+    static void CollectReconstructable2DHits(const pandora::Cluster *const pCluster, const pandora::CaloHitSet &reconstructableCaloHitSet,
+        pandora::CaloHitList &reconstructableCaloHitList2D);
+
+    /**
+     *  @brief  Collect the hits belonging to any selected reconstructable MCParticle, so that hit membership can be tested in constant time
+     *
+     *  @param  selectedMCParticleToHitsMaps the input mappings from selected reconstructable MCParticles to hits
+     *  @param  reconstructableCaloHitSet to receive the set of hits belonging to selected reconstructable MCParticles
+     */
+    static void GetReconstructableCaloHitSet(
+        const MCContributionMapVector &selectedMCParticleToHitsMaps, pandora::CaloHitSet &reconstructableCaloHitSet);
 
     /**
      *  @brief  Apply further selection criteria to end up with a collection of "good" calo hits that can be use to define whether
@@ -603,6 +666,20 @@ private:
     static void SelectGoodCaloHits(const pandora::CaloHitList *const pSelectedCaloHitList, const MCRelationMap &mcToTargetMCMap,
         pandora::CaloHitList &selectedGoodCaloHitList, const bool selectInputHits, const float minHitSharingFraction);
 
+    /**
+     *  @brief  Select target, reconstructable mc particles that match given criteria, given the folding of the mc hierarchy to targets
+     *
+     *  @param  mcToTargetMCMap the mc particle to target (primary or self) mc particle map
+     *  @param  targetMCVector the candidate target mc particles
+     *  @param  pCaloHitList the address of the list of CaloHits
+     *  @param  parameters validation parameters to decide when an MCParticle is considered reconstructable
+     *  @param  fCriteria a function which returns a bool (= shouldSelect) for a given input MCParticle
+     *  @param  selectedMCParticlesToHitsMap the output mapping from selected mcparticles to their hits
+     */
+    static void SelectReconstructableTargetMCParticles(const MCRelationMap &mcToTargetMCMap, const pandora::MCParticleVector &targetMCVector,
+        const pandora::CaloHitList *pCaloHitList, const PrimaryParameters &parameters,
+        std::function<bool(const pandora::MCParticle *const)> fCriteria, MCContributionMap &selectedMCParticlesToHitsMap);
+
     /**
      *  @brief  Select mc particles matching given criteria from an input list
      *
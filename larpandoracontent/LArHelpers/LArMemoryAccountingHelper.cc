@@ -0,0 +1,174 @@
+/**
+ *  @file   larpandoracontent/LArHelpers/LArMemoryAccountingHelper.cc
+ *
+ *  @brief  Implementation of the memory accounting helper class.
+ *
+ *  $Log: $
+ */
+
+#include "Pandora/StatusCodes.h"
+
+#include "larpandoracontent/LArHelpers/LArMemoryAccountingHelper.h"
+
+namespace lar_content
+{
+
+std::atomic<unsigned int> LArMemoryAccountingHelper::m_nAccountingRequests(0);
+std::atomic<std::size_t> LArMemoryAccountingHelper::m_currentBytes[LArMemoryAccountingHelper::N_MEMORY_FAMILIES] = {};
+std::atomic<std::size_t> LArMemoryAccountingHelper::m_peakBytes[LArMemoryAccountingHelper::N_MEMORY_FAMILIES] = {};
+std::atomic<unsigned int> LArMemoryAccountingHelper::m_nActiveMeasurements(0);
+std::atomic<unsigned int> LArMemoryAccountingHelper::m_nOverlappingMeasurements(0);
+thread_local unsigned int LArMemoryAccountingHelper::m_nThreadActiveMeasurements(0);
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArMemoryAccountingHelper::RequestAccounting()
+{
+    ++m_nAccountingRequests;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArMemoryAccountingHelper::ReleaseAccounting()
+{
+    unsigned int nRequests(m_nAccountingRequests.load());
+
+    while ((nRequests > 0) && !m_nAccountingRequests.compare_exchange_weak(nRequests, nRequests - 1))
+    {
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArMemoryAccountingHelper::GetCurrentBytes(ByteCountVector &currentBytes)
+{
+    currentBytes.clear();
+
+    for (unsigned int i = 0; i < N_MEMORY_FAMILIES; ++i)
+        currentBytes.push_back(m_currentBytes[i].load());
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArMemoryAccountingHelper::BeginHighWaterMark(ByteCountVector &enclosingPeakBytes, unsigned int &nOverlappingMeasurements)
+{
+    // ATTN Of two overlapping measurements, the later to begin sees the other active, so the count changes during both measurements
+    nOverlappingMeasurements = m_nOverlappingMeasurements.load();
+
+    if (m_nActiveMeasurements.fetch_add(1) > m_nThreadActiveMeasurements++)
+        ++m_nOverlappingMeasurements;
+
+    enclosingPeakBytes.clear();
+
+    for (unsigned int i = 0; i < N_MEMORY_FAMILIES; ++i)
+        enclosingPeakBytes.push_back(m_peakBytes[i].exchange(m_currentBytes[i].load()));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool LArMemoryAccountingHelper::EndHighWaterMark(
+    const ByteCountVector &enclosingPeakBytes, const unsigned int nOverlappingMeasurements, ByteCountVector &peakBytes)
+{
+    if ((N_MEMORY_FAMILIES != enclosingPeakBytes.size()) || (0 == m_nThreadActiveMeasurements))
+        throw pandora::StatusCodeException(pandora::STATUS_CODE_INVALID_PARAMETER);
+
+    peakBytes.clear();
+
+    for (unsigned int i = 0; i < N_MEMORY_FAMILIES; ++i)
+    {
+        peakBytes.push_back(m_peakBytes[i].load());
+        RaisePeak(m_peakBytes[i], enclosingPeakBytes.at(i));
+    }
+
+    const bool isValid(m_nOverlappingMeasurements.load() == nOverlappingMeasurements);
+
+    --m_nThreadActiveMeasurements;
+    --m_nActiveMeasurements;
+
+    return isValid;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+std::string LArMemoryAccountingHelper::GetMemoryFamilyName(const MemoryFamily memoryFamily)
+{
+    switch (memoryFamily)
+    {
+        case SLIDING_FIT_MEMORY:
+            return "slidingFits";
+        case OVERLAP_CONTAINER_MEMORY:
+            return "overlapContainers";
+        case PROTO_HIT_MEMORY:
+            return "protoHits";
+        case KD_TREE_MEMORY:
+            return "kdTrees";
+        case WORKER_CALO_HIT_MEMORY:
+            return "workerCaloHits";
+        case WORKER_MC_PARTICLE_MEMORY:
+            return "workerMCParticles";
+        case TOTAL_MEMORY:
+            return "total";
+        default:
+            break;
+    }
+
+    throw pandora::StatusCodeException(pandora::STATUS_CODE_INVALID_PARAMETER);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArMemoryAccountingHelper::Allocate(const MemoryFamily memoryFamily, const std::size_t nBytes)
+{
+    RaisePeak(m_peakBytes[memoryFamily], m_currentBytes[memoryFamily].fetch_add(nBytes) + nBytes);
+    RaisePeak(m_peakBytes[TOTAL_MEMORY], m_currentBytes[TOTAL_MEMORY].fetch_add(nBytes) + nBytes);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArMemoryAccountingHelper::Deallocate(const MemoryFamily memoryFamily, const std::size_t nBytes)
+{
+    m_currentBytes[memoryFamily].fetch_sub(nBytes);
+    m_currentBytes[TOTAL_MEMORY].fetch_sub(nBytes);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArMemoryAccountingHelper::RaisePeak(std::atomic<std::size_t> &peakBytes, const std::size_t nBytes)
+{
+    std::size_t currentPeak(peakBytes.load());
+
+    while ((currentPeak < nBytes) && !peakBytes.compare_exchange_weak(currentPeak, nBytes))
+    {
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArMemoryAccountingHelper::MemoryRecord::MemoryRecord(const MemoryFamily memoryFamily) : m_memoryFamily(memoryFamily), m_nBytes(0)
+{
+    if (memoryFamily >= TOTAL_MEMORY)
+        throw pandora::StatusCodeException(pandora::STATUS_CODE_INVALID_PARAMETER);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArMemoryAccountingHelper::MemoryRecord::MemoryRecord(const MemoryRecord &rhs) : m_memoryFamily(rhs.m_memoryFamily), m_nBytes(0)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArMemoryAccountingHelper::MemoryRecord &LArMemoryAccountingHelper::MemoryRecord::operator=(const MemoryRecord &)
+{
+    return *this;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArMemoryAccountingHelper::MemoryRecord::~MemoryRecord()
+{
+    this->Clear();
+}
+
+} // namespace lar_content
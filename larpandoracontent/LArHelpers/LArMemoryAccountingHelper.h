@@ -0,0 +1,251 @@
+/**
+ *  @file   larpandoracontent/LArHelpers/LArMemoryAccountingHelper.h
+ *
+ *  @brief  Header file for the memory accounting helper class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_MEMORY_ACCOUNTING_HELPER_H
+#define LAR_MEMORY_ACCOUNTING_HELPER_H 1
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace lar_content
+{
+
+/**
+ *  @brief  LArMemoryAccountingHelper class, estimating the memory held by the main lar object families and recording its high-water marks.
+ *          Accounting is process-wide, with figures covering all pandora instances, and is inactive (a single atomic load per record
+ *          update) unless requested, e.g. by a profiling algorithm.
+ */
+class LArMemoryAccountingHelper
+{
+public:
+    /**
+     *  @brief  MemoryFamily enum, identifying the accounted object families
+     */
+    enum MemoryFamily
+    {
+        SLIDING_FIT_MEMORY,
+        OVERLAP_CONTAINER_MEMORY,
+        PROTO_HIT_MEMORY,
+        KD_TREE_MEMORY,
+        WORKER_CALO_HIT_MEMORY,
+        WORKER_MC_PARTICLE_MEMORY,
+        TOTAL_MEMORY,
+        N_MEMORY_FAMILIES
+    };
+
+    typedef std::vector<std::size_t> ByteCountVector;
+
+    /**
+     *  @brief  MemoryRecord class, holding the bytes accounted to a family by a single owning object, which are released on destruction
+     */
+    class MemoryRecord
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  memoryFamily the memory family
+         */
+        MemoryRecord(const MemoryFamily memoryFamily);
+
+        /**
+         *  @brief  Copy constructor, ATTN copies begin without accounted bytes
+         *
+         *  @param  rhs the memory record to copy
+         */
+        MemoryRecord(const MemoryRecord &rhs);
+
+        /**
+         *  @brief  Assignment operator, ATTN the accounted bytes are not transferred
+         *
+         *  @param  rhs the memory record to assign
+         */
+        MemoryRecord &operator=(const MemoryRecord &rhs);
+
+        /**
+         *  @brief  Destructor, releasing the accounted bytes
+         */
+        ~MemoryRecord();
+
+        /**
+         *  @brief  Account an allocation, if accounting is enabled
+         *
+         *  @param  nBytes the estimated number of bytes allocated
+         */
+        void Allocate(const std::size_t nBytes);
+
+        /**
+         *  @brief  Account a deallocation, limited to the bytes previously accounted by this record
+         *
+         *  @param  nBytes the estimated number of bytes deallocated
+         */
+        void Deallocate(const std::size_t nBytes);
+
+        /**
+         *  @brief  Release all bytes accounted by this record
+         */
+        void Clear();
+
+    private:
+        const MemoryFamily m_memoryFamily; ///< The memory family
+        std::atomic<std::size_t> m_nBytes; ///< The number of bytes accounted by this record
+    };
+
+    /**
+     *  @brief  Request memory accounting, which remains enabled until every request has been released
+     */
+    static void RequestAccounting();
+
+    /**
+     *  @brief  Release a request for memory accounting
+     */
+    static void ReleaseAccounting();
+
+    /**
+     *  @brief  Whether memory accounting is enabled
+     *
+     *  @return boolean
+     */
+    static bool IsAccountingEnabled();
+
+    /**
+     *  @brief  Get the estimated number of bytes for an element of a node-based container, including typical node bookkeeping
+     *
+     *  @return the number of bytes
+     */
+    template <typename T>
+    static std::size_t GetNodeBytes();
+
+    /**
+     *  @brief  Get the current accounted bytes, indexed by memory family
+     *
+     *  @param  currentBytes to receive the current bytes
+     */
+    static void GetCurrentBytes(ByteCountVector &currentBytes);
+
+    /**
+     *  @brief  Begin a high-water mark measurement, lowering the peaks to the current bytes. ATTN The peaks are process-wide and
+     *          measurements must nest: measurements that overlap in time with one on another thread, e.g. by profiling algorithms in
+     *          pandora instances running concurrently, lower and restore each other's peaks, so are reported as invalid when they end
+     *
+     *  @param  enclosingPeakBytes to receive the peaks of any enclosing measurement, to be restored when this measurement ends
+     *  @param  nOverlappingMeasurements to receive the count of overlapping measurements as this measurement began
+     */
+    static void BeginHighWaterMark(ByteCountVector &enclosingPeakBytes, unsigned int &nOverlappingMeasurements);
+
+    /**
+     *  @brief  End a high-water mark measurement, restoring the peaks of any enclosing measurement. ATTN Must end the most recently begun
+     *          measurement on this thread that has not yet ended, see BeginHighWaterMark
+     *
+     *  @param  enclosingPeakBytes the peaks of any enclosing measurement, as returned when this measurement began
+     *  @param  nOverlappingMeasurements the count of overlapping measurements, as returned when this measurement began
+     *  @param  peakBytes to receive the peak bytes during this measurement, indexed by memory family
+     *
+     *  @return whether the peak bytes are valid, i.e. no measurement on another thread overlapped this measurement
+     */
+    static bool EndHighWaterMark(
+        const ByteCountVector &enclosingPeakBytes, const unsigned int nOverlappingMeasurements, ByteCountVector &peakBytes);
+
+    /**
+     *  @brief  Get the name of a memory family
+     *
+     *  @param  memoryFamily the memory family
+     *
+     *  @return the name
+     */
+    static std::string GetMemoryFamilyName(const MemoryFamily memoryFamily);
+
+private:
+    /**
+     *  @brief  Account an allocation to a memory family and to the total
+     *
+     *  @param  memoryFamily the memory family
+     *  @param  nBytes the number of bytes
+     */
+    static void Allocate(const MemoryFamily memoryFamily, const std::size_t nBytes);
+
+    /**
+     *  @brief  Account a deallocation from a memory family and from the total
+     *
+     *  @param  memoryFamily the memory family
+     *  @param  nBytes the number of bytes
+     */
+    static void Deallocate(const MemoryFamily memoryFamily, const std::size_t nBytes);
+
+    /**
+     *  @brief  Raise a peak to at least a given number of bytes
+     *
+     *  @param  peakBytes the peak
+     *  @param  nBytes the number of bytes
+     */
+    static void RaisePeak(std::atomic<std::size_t> &peakBytes, const std::size_t nBytes);
+
+    static std::atomic<unsigned int> m_nAccountingRequests;            ///< The number of outstanding accounting requests
+    static std::atomic<std::size_t> m_currentBytes[N_MEMORY_FAMILIES]; ///< The current accounted bytes, by memory family
+    static std::atomic<std::size_t> m_peakBytes[N_MEMORY_FAMILIES];    ///< The peak accounted bytes, by memory family
+    static std::atomic<unsigned int> m_nActiveMeasurements;            ///< The number of high-water mark measurements active on any thread
+    static std::atomic<unsigned int> m_nOverlappingMeasurements;       ///< The number of measurements begun during one on another thread
+    static thread_local unsigned int m_nThreadActiveMeasurements;      ///< The number of high-water mark measurements active on this thread
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline bool LArMemoryAccountingHelper::IsAccountingEnabled()
+{
+    return (m_nAccountingRequests.load(std::memory_order_relaxed) > 0);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline std::size_t LArMemoryAccountingHelper::GetNodeBytes()
+{
+    return (sizeof(T) + 4 * sizeof(void *));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline void LArMemoryAccountingHelper::MemoryRecord::Allocate(const std::size_t nBytes)
+{
+    if (!LArMemoryAccountingHelper::IsAccountingEnabled())
+        return;
+
+    m_nBytes.fetch_add(nBytes, std::memory_order_relaxed);
+    LArMemoryAccountingHelper::Allocate(m_memoryFamily, nBytes);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline void LArMemoryAccountingHelper::MemoryRecord::Deallocate(const std::size_t nBytes)
+{
+    std::size_t recordedBytes(m_nBytes.load(std::memory_order_relaxed));
+
+    while ((recordedBytes > 0) && !m_nBytes.compare_exchange_weak(recordedBytes, recordedBytes - std::min(nBytes, recordedBytes)))
+    {
+    }
+
+    if (recordedBytes > 0)
+        LArMemoryAccountingHelper::Deallocate(m_memoryFamily, std::min(nBytes, recordedBytes));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline void LArMemoryAccountingHelper::MemoryRecord::Clear()
+{
+    const std::size_t recordedBytes(m_nBytes.exchange(0));
+
+    if (recordedBytes > 0)
+        LArMemoryAccountingHelper::Deallocate(m_memoryFamily, recordedBytes);
+}
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_MEMORY_ACCOUNTING_HELPER_H
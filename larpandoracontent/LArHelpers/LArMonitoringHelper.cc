@@ -25,6 +25,10 @@ using namespace pandora;
 namespace lar_content
 {
 
+std::atomic<bool> LArMonitoringHelper::m_isMonitoringEnabled(true);
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 unsigned int LArMonitoringHelper::CountHitsByType(const HitType hitType, const CaloHitList &caloHitList)
 {
     unsigned int nHitsOfSpecifiedType(0);
@@ -312,4 +316,22 @@ void LArMonitoringHelper::PrintMatchingTable(const PfoVector &orderedPfoVector,
     table.Print();
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool LArMonitoringHelper::IsMonitoringEnabled()
+{
+#ifdef MONITORING
+    return m_isMonitoringEnabled.load(std::memory_order_relaxed);
+#else
+    return false;
+#endif // MONITORING
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArMonitoringHelper::SetMonitoringEnabled(const bool isEnabled)
+{
+    m_isMonitoringEnabled.store(isEnabled, std::memory_order_relaxed);
+}
+
 } // namespace lar_content
@@ -12,6 +12,8 @@
 
 #include "larpandoracontent/LArHelpers/LArMCParticleHelper.h"
 
+#include <atomic>
+
 namespace lar_content
 {
 
@@ -75,6 +77,24 @@ public:
      */
     static void PrintMatchingTable(const pandora::PfoVector &orderedPfoVector, const pandora::MCParticleVector &orderedMCParticleVector,
         const LArMCParticleHelper::MCParticleToPfoHitSharingMap &mcParticleToPfoHitSharingMap, const unsigned int nMatches);
+
+    /**
+     *  @brief  Whether monitoring is enabled, i.e. the build has monitoring support and it has not been switched off at run time.
+     *          Monitoring algorithms should skip all list traversal and display object construction when it is not.
+     *
+     *  @return whether monitoring is enabled
+     */
+    static bool IsMonitoringEnabled();
+
+    /**
+     *  @brief  Switch monitoring on or off at run time, e.g. for batch jobs built with monitoring support but without a display
+     *
+     *  @param  isEnabled whether monitoring should be enabled, which has no effect for builds without monitoring support
+     */
+    static void SetMonitoringEnabled(const bool isEnabled);
+
+private:
+    static std::atomic<bool> m_isMonitoringEnabled; ///< Whether monitoring has been switched on at run time
 };
 
 } // namespace lar_content
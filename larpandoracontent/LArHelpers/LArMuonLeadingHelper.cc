@@ -12,6 +12,8 @@
 #include "larpandoracontent/LArHelpers/LArMCParticleHelper.h"
 #include "larpandoracontent/LArHelpers/LArMuonLeadingHelper.h"
 
+#include "larpandoracontent/LArObjects/LArMCHierarchySnapshot.h"
+
 #include "Pandora/PdgTable.h"
 
 #include "Objects/CaloHit.h"
@@ -119,6 +121,22 @@ void LArMuonLeadingHelper::GetMCToLeadingMap(const MCParticleList *const pMCPart
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void LArMuonLeadingHelper::GetMCToLeadingMap(const MCHierarchySnapshot &mcHierarchySnapshot, LArMCParticleHelper::MCRelationMap &mcToLeadingMap)
+{
+    for (const MCParticle *const pMCParticle : mcHierarchySnapshot.GetInputMCParticles())
+    {
+        const MCParticle *const pParentMCParticle(mcHierarchySnapshot.GetParentMCParticle(pMCParticle));
+
+        if (!LArMCParticleHelper::IsCosmicRay(pParentMCParticle))
+            continue;
+
+        mcToLeadingMap[pMCParticle] =
+            (pMCParticle == pParentMCParticle) ? pMCParticle : mcHierarchySnapshot.GetTierOneMCParticle(pMCParticle);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void LArMuonLeadingHelper::SelectReconstructableLeadingParticles(const MCParticleList *pMCParticleList, const CaloHitList *pCaloHitList,
     const ValidationParameters &parameters, const CaloHitList &recoMuonHitList, LArMCParticleHelper::MCContributionMap &selectedMCParticlesToHitsMap)
 {
@@ -126,27 +144,27 @@ void LArMuonLeadingHelper::SelectReconstructableLeadingParticles(const MCParticl
     LArMCParticleHelper::MCRelationMap mcToLeadingMCMap;
     LArMuonLeadingHelper::GetMCToLeadingMap(pMCParticleList, mcToLeadingMCMap);
 
-    // Select reconstructable hits, e.g. remove delta ray hits 'stolen' by the cosmic rays
-    CaloHitList selectedCaloHitList;
-    LeadingMCParticleToPostBremsstrahlungHitList leadingMCParticleToPostBremsstrahlungHitList;
-    LArMuonLeadingHelper::SelectCaloHits(pCaloHitList, mcToLeadingMCMap, selectedCaloHitList, parameters.m_selectInputHits,
-        parameters.m_minHitSharingFraction, recoMuonHitList, leadingMCParticleToPostBremsstrahlungHitList);
+    // Obtain vector: all mc particles
+    MCParticleVector leadingMCVector;
+    LArMuonLeadingHelper::SelectLeadingMCParticles(pMCParticleList, leadingMCVector);
 
-    // Obtain maps: [hit -> leading MCParticle], [leading MCParticle -> list of hits]
-    LArMCParticleHelper::CaloHitToMCMap trueHitToLeadingMCMap;
-    LArMCParticleHelper::MCContributionMap leadingMCToTrueHitListMap;
-    LArMCParticleHelper::GetMCParticleToCaloHitMatches(&selectedCaloHitList, mcToLeadingMCMap, trueHitToLeadingMCMap, leadingMCToTrueHitListMap);
+    LArMuonLeadingHelper::SelectReconstructableFoldedParticles(
+        mcToLeadingMCMap, leadingMCVector, pCaloHitList, parameters, recoMuonHitList, selectedMCParticlesToHitsMap);
+}
 
-    // Add in close post bremsstrahlung hits
-    LArMuonLeadingHelper::AddInPostBremsstrahlungHits(
-        leadingMCParticleToPostBremsstrahlungHitList, parameters.m_maxBremsstrahlungSeparation, leadingMCToTrueHitListMap);
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArMuonLeadingHelper::SelectReconstructableLeadingParticles(const MCHierarchySnapshot &mcHierarchySnapshot, const CaloHitList *pCaloHitList,
+    const ValidationParameters &parameters, const CaloHitList &recoMuonHitList, LArMCParticleHelper::MCContributionMap &selectedMCParticlesToHitsMap)
+{
+    LArMCParticleHelper::MCRelationMap mcToLeadingMCMap;
+    LArMuonLeadingHelper::GetMCToLeadingMap(mcHierarchySnapshot, mcToLeadingMCMap);
 
-    // Obtain vector: all mc particles
     MCParticleVector leadingMCVector;
-    LArMuonLeadingHelper::SelectLeadingMCParticles(pMCParticleList, leadingMCVector);
+    LArMuonLeadingHelper::SelectLeadingMCParticles(mcHierarchySnapshot, leadingMCVector);
 
-    // Ensure the MCParticles have enough "good" hits to be reconstructed
-    LArMCParticleHelper::SelectParticlesByHitCount(leadingMCVector, leadingMCToTrueHitListMap, mcToLeadingMCMap, parameters, selectedMCParticlesToHitsMap);
+    LArMuonLeadingHelper::SelectReconstructableFoldedParticles(
+        mcToLeadingMCMap, leadingMCVector, pCaloHitList, parameters, recoMuonHitList, selectedMCParticlesToHitsMap);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -367,6 +385,49 @@ void LArMuonLeadingHelper::SelectLeadingMCParticles(const MCParticleList *pMCPar
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void LArMuonLeadingHelper::SelectLeadingMCParticles(const MCHierarchySnapshot &mcHierarchySnapshot, MCParticleVector &selectedParticles)
+{
+    for (const MCParticle *const pMCParticle : mcHierarchySnapshot.GetInputMCParticles())
+    {
+        const MCParticle *const pParentMCParticle(mcHierarchySnapshot.GetParentMCParticle(pMCParticle));
+
+        if (!LArMCParticleHelper::IsCosmicRay(pParentMCParticle))
+            continue;
+
+        if ((pMCParticle == pParentMCParticle) || (mcHierarchySnapshot.GetHierarchyTier(pMCParticle) == 1))
+            selectedParticles.push_back(pMCParticle);
+    }
+
+    std::sort(selectedParticles.begin(), selectedParticles.end(), LArMCParticleHelper::SortByMomentum);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArMuonLeadingHelper::SelectReconstructableFoldedParticles(const LArMCParticleHelper::MCRelationMap &mcToLeadingMCMap,
+    const MCParticleVector &leadingMCVector, const CaloHitList *pCaloHitList, const ValidationParameters &parameters,
+    const CaloHitList &recoMuonHitList, LArMCParticleHelper::MCContributionMap &selectedMCParticlesToHitsMap)
+{
+    // Select reconstructable hits, e.g. remove delta ray hits 'stolen' by the cosmic rays
+    CaloHitList selectedCaloHitList;
+    LeadingMCParticleToPostBremsstrahlungHitList leadingMCParticleToPostBremsstrahlungHitList;
+    LArMuonLeadingHelper::SelectCaloHits(pCaloHitList, mcToLeadingMCMap, selectedCaloHitList, parameters.m_selectInputHits,
+        parameters.m_minHitSharingFraction, recoMuonHitList, leadingMCParticleToPostBremsstrahlungHitList);
+
+    // Obtain maps: [hit -> leading MCParticle], [leading MCParticle -> list of hits]
+    LArMCParticleHelper::CaloHitToMCMap trueHitToLeadingMCMap;
+    LArMCParticleHelper::MCContributionMap leadingMCToTrueHitListMap;
+    LArMCParticleHelper::GetMCParticleToCaloHitMatches(&selectedCaloHitList, mcToLeadingMCMap, trueHitToLeadingMCMap, leadingMCToTrueHitListMap);
+
+    // Add in close post bremsstrahlung hits
+    LArMuonLeadingHelper::AddInPostBremsstrahlungHits(
+        leadingMCParticleToPostBremsstrahlungHitList, parameters.m_maxBremsstrahlungSeparation, leadingMCToTrueHitListMap);
+
+    // Ensure the MCParticles have enough "good" hits to be reconstructed
+    LArMCParticleHelper::SelectParticlesByHitCount(leadingMCVector, leadingMCToTrueHitListMap, mcToLeadingMCMap, parameters, selectedMCParticlesToHitsMap);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void LArMuonLeadingHelper::GetPfoMatchContamination(const MCParticle *const pLeadingParticle, const CaloHitList &matchedPfoHitList,
     CaloHitList &parentTrackHits, CaloHitList &otherTrackHits, CaloHitList &otherShowerHits)
 {
@@ -14,6 +14,9 @@
 
 namespace lar_content
 {
+
+class MCHierarchySnapshot;
+
 /**
  *  @brief  LArMuonLeadingHelper class
  */
@@ -87,6 +90,20 @@ public:
         const pandora::CaloHitList *pCaloHitList, const ValidationParameters &parameters, const pandora::CaloHitList &recoMuonHitList,
         LArMCParticleHelper::MCContributionMap &selectedMCParticlesToHitsMap);
 
+    /**
+     *  @brief  Select target, reconstructable mc particles in the cosmic ray hierarchy, taking the mc particles and their hierarchy from a
+     *          precomputed snapshot. The results are those of the mc particle list version for the list from which the snapshot was built
+     *
+     *  @param  mcHierarchySnapshot the mc hierarchy snapshot
+     *  @param  pCaloHitList the address of the list of CaloHits
+     *  @param  parameters validation parameters to decide when an MCParticle is considered reconstructable
+     *  @param  recoMuonHitList the list of reconstructed cosmic ray hits
+     *  @param  selectedMCParticlesToHitsMap the output mapping from selected MCParticles to their hits
+     */
+    static void SelectReconstructableLeadingParticles(const MCHierarchySnapshot &mcHierarchySnapshot, const pandora::CaloHitList *pCaloHitList,
+        const ValidationParameters &parameters, const pandora::CaloHitList &recoMuonHitList,
+        LArMCParticleHelper::MCContributionMap &selectedMCParticlesToHitsMap);
+
     /**
      *  @brief  Separate a leading pfo hit list according to the true owner of the hit e.g. other shower
      *
@@ -165,6 +182,15 @@ private:
      */
     static void GetMCToLeadingMap(const pandora::MCParticleList *const pMCParticleList, LArMCParticleHelper::MCRelationMap &mcToLeadingMap);
 
+    /**
+     *  @brief  Construct the hierarchy folding map (cosmic rays folded to themselves, delta ray/michel hierarchy folded to leading
+     *          particle), taking the mc particles and their hierarchy from a precomputed snapshot
+     *
+     *  @param  mcHierarchySnapshot the mc hierarchy snapshot
+     *  @param  mcToLeadingMap the hierarchy folding map
+     */
+    static void GetMCToLeadingMap(const MCHierarchySnapshot &mcHierarchySnapshot, LArMCParticleHelper::MCRelationMap &mcToLeadingMap);
+
     /**
      *  @brief  Select a subset of calo hits representing those that represent "reconstructable" regions of the event
      *
@@ -221,6 +247,29 @@ private:
      *  @param  selectedParticles the output vector of selected MCParticles
      */
     static void SelectLeadingMCParticles(const pandora::MCParticleList *pMCParticleList, pandora::MCParticleVector &selectedParticles);
+
+    /**
+     *  @brief  Select all tier 0 and tier 1 MCParticles in cosmic ray hierarchies, taking the mc particles and their hierarchy from a
+     *          precomputed snapshot
+     *
+     *  @param  mcHierarchySnapshot the mc hierarchy snapshot
+     *  @param  selectedParticles the output vector of selected MCParticles
+     */
+    static void SelectLeadingMCParticles(const MCHierarchySnapshot &mcHierarchySnapshot, pandora::MCParticleVector &selectedParticles);
+
+    /**
+     *  @brief  Select target, reconstructable mc particles in the cosmic ray hierarchy, given the folding of the hierarchy to targets
+     *
+     *  @param  mcToLeadingMCMap the hierarchy folding map
+     *  @param  leadingMCVector the candidate target mc particles
+     *  @param  pCaloHitList the address of the list of CaloHits
+     *  @param  parameters validation parameters to decide when an MCParticle is considered reconstructable
+     *  @param  recoMuonHitList the list of reconstructed cosmic ray hits
+     *  @param  selectedMCParticlesToHitsMap the output mapping from selected MCParticles to their hits
+     */
+    static void SelectReconstructableFoldedParticles(const LArMCParticleHelper::MCRelationMap &mcToLeadingMCMap,
+        const pandora::MCParticleVector &leadingMCVector, const pandora::CaloHitList *pCaloHitList, const ValidationParameters &parameters,
+        const pandora::CaloHitList &recoMuonHitList, LArMCParticleHelper::MCContributionMap &selectedMCParticlesToHitsMap);
 };
 
 } // namespace lar_content
@@ -13,6 +13,12 @@ using namespace pandora;
 namespace lar_content
 {
 
+thread_local MvaFeatureCache *MvaFeatureCache::m_pAvailableCache(nullptr);
+LArMvaHelper::TrainingExampleWriterMap LArMvaHelper::m_trainingExampleWriterMap;
+std::mutex LArMvaHelper::m_trainingExampleWriterMutex;
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode LArMvaHelper::ProcessAlgorithmToolListToMap(const Algorithm &algorithm, const TiXmlHandle &xmlHandle,
     const std::string &listName, StringVector &algorithmToolNameVector, AlgorithmToolMap &algorithmToolMap)
 {
@@ -39,4 +45,51 @@ StatusCode LArMvaHelper::ProcessAlgorithmToolListToMap(const Algorithm &algorith
     return STATUS_CODE_SUCCESS;
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode LArMvaHelper::FlushTrainingExamples()
+{
+    std::lock_guard<std::mutex> lock(m_trainingExampleWriterMutex);
+    StatusCode statusCode(STATUS_CODE_SUCCESS);
+
+    for (const TrainingExampleWriterMap::value_type &mapEntry : m_trainingExampleWriterMap)
+    {
+        if (STATUS_CODE_SUCCESS != mapEntry.second->Flush())
+            statusCode = STATUS_CODE_FAILURE;
+    }
+
+    return statusCode;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+MvaTrainingExampleWriter *LArMvaHelper::GetTrainingExampleWriter(
+    const std::string &trainingOutputFile, const MvaTrainingExampleWriter::Format format)
+{
+    std::lock_guard<std::mutex> lock(m_trainingExampleWriterMutex);
+    std::unique_ptr<MvaTrainingExampleWriter> &pTrainingExampleWriter(m_trainingExampleWriterMap[trainingOutputFile]);
+
+    if (pTrainingExampleWriter && (format != pTrainingExampleWriter->GetFormat()))
+    {
+        std::cout << "LArMvaHelper: training examples for " << trainingOutputFile << " already written in another format" << std::endl;
+        return nullptr;
+    }
+
+    // ATTN A file that could not be opened is not recorded, so that the next example tries again, as when files were opened per example
+    if (!pTrainingExampleWriter)
+    {
+        std::unique_ptr<MvaTrainingExampleWriter> pNewWriter(std::make_unique<MvaTrainingExampleWriter>(trainingOutputFile, format));
+
+        if (!pNewWriter->IsOpen())
+        {
+            m_trainingExampleWriterMap.erase(trainingOutputFile);
+            return nullptr;
+        }
+
+        pTrainingExampleWriter = std::move(pNewWriter);
+    }
+
+    return pTrainingExampleWriter.get();
+}
+
 } // namespace lar_content
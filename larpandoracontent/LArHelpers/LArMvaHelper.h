@@ -9,6 +9,7 @@
 #define LAR_MVA_HELPER_H 1
 
 #include "larpandoracontent/LArObjects/LArMvaInterface.h"
+#include "larpandoracontent/LArObjects/LArMvaTrainingExampleWriter.h"
 
 #include "Api/PandoraContentApi.h"
 
@@ -22,10 +23,87 @@
 #include <chrono>
 #include <ctime>
 #include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <typeindex>
+#include <typeinfo>
+#include <utility>
 
 namespace lar_content
 {
 
+/**
+ *  @brief  MvaFeatureCache class, holding intermediate results that feature tools publish and reuse for the same object. Entries are
+ *          keyed by object address and name, so a cache must not outlive the objects for which it holds entries.
+ */
+class MvaFeatureCache
+{
+public:
+    /**
+     *  @brief  Scope class, making a feature cache available to feature tools run on the current thread for the lifetime of the scope
+     */
+    class Scope
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  featureCache the feature cache to make available
+         */
+        Scope(MvaFeatureCache &featureCache);
+
+        /**
+         *  @brief  Destructor, restoring any previously available feature cache
+         */
+        ~Scope();
+
+        Scope(const Scope &) = delete;
+        Scope &operator=(const Scope &) = delete;
+
+    private:
+        MvaFeatureCache *m_pPreviousCache; ///< The feature cache available before this scope
+    };
+
+    /**
+     *  @brief  Get an intermediate result for an object, constructing and storing it if it is not already present
+     *
+     *  @param  pObject the address of the object
+     *  @param  name the name of the intermediate result, which must identify the constructor arguments
+     *  @param  args the constructor arguments for the intermediate result
+     *
+     *  @return the intermediate result
+     *
+     *  @throw  StatusCodeException if an intermediate result of a different type is stored with the same object address and name
+     */
+    template <typename T, typename... TARGS>
+    std::shared_ptr<const T> Get(const void *const pObject, const std::string &name, TARGS &&... args);
+
+    /**
+     *  @brief  Clear the cache
+     */
+    void Clear();
+
+    /**
+     *  @brief  Get the feature cache available to feature tools run on the current thread
+     *
+     *  @return the address of the feature cache, or nullptr if no feature cache is available
+     */
+    static MvaFeatureCache *GetAvailableCache();
+
+private:
+    typedef std::pair<const void *, std::string> EntryKey;
+    typedef std::pair<std::type_index, std::shared_ptr<const void>> Entry;
+    typedef std::map<EntryKey, Entry> EntryMap;
+
+    EntryMap m_entryMap; ///< The map from object address and name to intermediate result
+
+    static thread_local MvaFeatureCache *m_pAvailableCache; ///< The feature cache available to feature tools run on the current thread
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 /**
  *  @brief  MvaFeatureTool class template
  */
@@ -73,13 +151,16 @@ class LArMvaHelper
 public:
     typedef MvaTypes::MvaFeature MvaFeature;
     typedef MvaTypes::MvaFeatureVector MvaFeatureVector;
+    typedef MvaTypes::MvaFeatureMatrix MvaFeatureMatrix;
+    typedef MvaTypes::DoubleVector DoubleVector;
     typedef std::map<std::string, double> DoubleMap;
 
     typedef MvaTypes::MvaFeatureMap MvaFeatureMap;
     typedef std::map<std::string, pandora::AlgorithmTool *> AlgorithmToolMap; // idea would be to put this in PandoraInternal.h at some point in PandoraSDK
 
     /**
-     *  @brief  Produce a training example with the given features and result
+     *  @brief  Produce a training example with the given features and result. The file is opened on first use and kept open, with
+     *          examples buffered until FlushTrainingExamples is called or the process ends.
      *
      *  @param  trainingOutputFile the file to which to append the example
      *  @param  featureContainer the container of features
@@ -89,6 +170,21 @@ public:
     template <typename TCONTAINER>
     static pandora::StatusCode ProduceTrainingExample(const std::string &trainingOutputFile, const bool result, TCONTAINER &&featureContainer);
 
+    /**
+     *  @brief  Produce a training example with the given features and result, in a given format. The format is fixed when the file is first
+     *          opened and later examples for the file must use the same format. Binary examples avoid the formatting cost of text output.
+     *
+     *  @param  trainingOutputFile the file to which to append the example
+     *  @param  format the format in which to write the example
+     *  @param  result the example result
+     *  @param  featureContainer the container of features
+     *
+     *  @return success
+     */
+    template <typename TCONTAINER>
+    static pandora::StatusCode ProduceTrainingExample(const std::string &trainingOutputFile, const MvaTrainingExampleWriter::Format format,
+        const bool result, TCONTAINER &&featureContainer);
+
     /**
      *  @brief  Produce a training example with the given features and result - using a map
      *
@@ -102,6 +198,13 @@ public:
     static pandora::StatusCode ProduceTrainingExample(
         const std::string &trainingOutputFile, const bool result, const pandora::StringVector &featureOrder, TCONTAINER &&featureContainer);
 
+    /**
+     *  @brief  Flush the buffered training examples for all training example files, e.g. at the end of a job
+     *
+     *  @return success, or failure if any file could not be written
+     */
+    static pandora::StatusCode FlushTrainingExamples();
+
     /**
      *  @brief  Use the trained classifier to predict the boolean class of an example
      *
@@ -159,6 +262,24 @@ public:
     template <typename TCONTAINER>
     static double CalculateProbability(const MvaInterface &classifier, const pandora::StringVector &featureOrder, TCONTAINER &&featureContainer);
 
+    /**
+     *  @brief  Use the trained classifier to calculate the classification scores for a number of examples in a single call
+     *
+     *  @param  classifier the classifier
+     *  @param  featureMatrix the input features, one feature vector per example
+     *  @param  scores to receive the classification score for each example, in the order of the input feature vectors
+     */
+    static void CalculateClassificationScores(const MvaInterface &classifier, const MvaFeatureMatrix &featureMatrix, DoubleVector &scores);
+
+    /**
+     *  @brief  Use the trained mva to calculate the classification probabilities for a number of examples in a single call
+     *
+     *  @param  classifier the classifier
+     *  @param  featureMatrix the input features, one feature vector per example
+     *  @param  probabilities to receive the classification probability for each example, in the order of the input feature vectors
+     */
+    static void CalculateProbabilities(const MvaInterface &classifier, const MvaFeatureMatrix &featureMatrix, DoubleVector &probabilities);
+
     /**
      *  @brief  Calculate the features in a given feature tool vector
      *
@@ -195,6 +316,20 @@ public:
     template <typename T, typename... Ts, typename... TARGS>
     static MvaFeatureVector CalculateFeaturesOfType(const MvaFeatureToolVector<Ts...> &featureToolVector, TARGS &&... args);
 
+    /**
+     *  @brief  Get an intermediate result for an object from the feature cache available to the running feature tools, so that it is
+     *          constructed once for all feature tools sharing the cache. Features calculated via this helper share a cache for the duration
+     *          of each call, or for longer if the caller provides an MvaFeatureCache::Scope.
+     *
+     *  @param  pObject the address of the object
+     *  @param  name the name of the intermediate result, which must identify the constructor arguments
+     *  @param  args the constructor arguments for the intermediate result
+     *
+     *  @return the intermediate result, constructed without caching if no feature cache is available
+     */
+    template <typename T, typename... TARGS>
+    static std::shared_ptr<const T> GetCachedIntermediate(const void *const pObject, const std::string &name, TARGS &&... args);
+
     /**
      *  @brief  Add a feature tool to a vector of feature tools
      *
@@ -247,59 +382,101 @@ public:
     static MvaFeatureVector ConcatenateFeatureLists();
 
 private:
-    /**
-     *  @brief  Get a timestamp string for this point in time
-     *
-     *  @return a timestamp string
-     */
-    static std::string GetTimestampString();
+    typedef std::map<std::string, std::unique_ptr<MvaTrainingExampleWriter>> TrainingExampleWriterMap;
 
     /**
-     *  @brief  Write the features of the given lists to file
+     *  @brief  Get the training example writer for a given file, opening the file on first use
      *
-     *  @param  outfile the std::ofstream object to use
-     *  @param  delimiter the delimiter string
-     *  @param  featureContainer a container of features to write
+     *  @param  trainingOutputFile the training example file
+     *  @param  format the format in which to write examples
      *
-     *  @return success
+     *  @return the address of the training example writer, or nullptr if the file could not be opened or is open in another format
      */
-    template <typename TCONTAINER>
-    static pandora::StatusCode WriteFeaturesToFile(std::ofstream &outfile, const std::string &delimiter, TCONTAINER &&featureContainer);
+    static MvaTrainingExampleWriter *GetTrainingExampleWriter(
+        const std::string &trainingOutputFile, const MvaTrainingExampleWriter::Format format);
 
-    /**
-     *  @brief  Write the features of the given list to file (implementation method)
-     *
-     *  @param  outfile the std::ofstream object to use
-     *  @param  delimiter the delimiter string
-     *  @param  featureContainer a container of features to write
-     *
-     *  @return success
-     */
-    template <typename TCONTAINER>
-    static pandora::StatusCode WriteFeaturesToFileImpl(std::ofstream &outfile, const std::string &delimiter, TCONTAINER &&featureContainer);
+    static TrainingExampleWriterMap m_trainingExampleWriterMap; ///< The training example writer for each training example file
+    static std::mutex m_trainingExampleWriterMutex;             ///< The mutex protecting the training example writers
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+inline MvaFeatureCache::Scope::Scope(MvaFeatureCache &featureCache) :
+    m_pPreviousCache(MvaFeatureCache::m_pAvailableCache)
+{
+    MvaFeatureCache::m_pAvailableCache = &featureCache;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline MvaFeatureCache::Scope::~Scope()
+{
+    MvaFeatureCache::m_pAvailableCache = m_pPreviousCache;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T, typename... TARGS>
+std::shared_ptr<const T> MvaFeatureCache::Get(const void *const pObject, const std::string &name, TARGS &&... args)
+{
+    const EntryKey entryKey(pObject, name);
+    const EntryMap::const_iterator iter(m_entryMap.find(entryKey));
+
+    if (m_entryMap.end() != iter)
+    {
+        if (std::type_index(typeid(T)) != iter->second.first)
+            throw pandora::StatusCodeException(pandora::STATUS_CODE_INVALID_PARAMETER);
+
+        return std::static_pointer_cast<const T>(iter->second.second);
+    }
+
+    const std::shared_ptr<const T> pIntermediate(std::make_shared<T>(std::forward<TARGS>(args)...));
+    m_entryMap.insert(EntryMap::value_type(entryKey, Entry(std::type_index(typeid(T)), pIntermediate)));
+
+    return pIntermediate;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline void MvaFeatureCache::Clear()
+{
+    m_entryMap.clear();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline MvaFeatureCache *MvaFeatureCache::GetAvailableCache()
+{
+    return MvaFeatureCache::m_pAvailableCache;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template <typename TCONTAINER>
 pandora::StatusCode LArMvaHelper::ProduceTrainingExample(const std::string &trainingOutputFile, const bool result, TCONTAINER &&featureContainer)
 {
-    std::ofstream outfile;
-    outfile.open(trainingOutputFile, std::ios_base::app); // always append to the output file
+    return ProduceTrainingExample(trainingOutputFile, MvaTrainingExampleWriter::TEXT, result, std::forward<TCONTAINER>(featureContainer));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
 
-    if (!outfile.is_open())
+template <typename TCONTAINER>
+pandora::StatusCode LArMvaHelper::ProduceTrainingExample(
+    const std::string &trainingOutputFile, const MvaTrainingExampleWriter::Format format, const bool result, TCONTAINER &&featureContainer)
+{
+    static_assert(std::is_same<typename std::decay<TCONTAINER>::type, LArMvaHelper::MvaFeatureVector>::value,
+        "LArMvaHelper: Could not write training set example because a passed parameter was not a vector of MvaFeatures");
+
+    MvaTrainingExampleWriter *const pTrainingExampleWriter(LArMvaHelper::GetTrainingExampleWriter(trainingOutputFile, format));
+
+    if (!pTrainingExampleWriter)
     {
         std::cout << "LArMvaHelper: could not open file for training examples at " << trainingOutputFile << std::endl;
         return pandora::STATUS_CODE_FAILURE;
     }
 
-    std::string delimiter(",");
-    outfile << GetTimestampString() << delimiter;
-
-    PANDORA_RETURN_RESULT_IF(pandora::STATUS_CODE_SUCCESS, !=, WriteFeaturesToFile(outfile, delimiter, featureContainer));
-    outfile << static_cast<int>(result) << '\n';
-
-    return pandora::STATUS_CODE_SUCCESS;
+    return pTrainingExampleWriter->Write(result, featureContainer);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -395,9 +572,27 @@ double LArMvaHelper::CalculateProbability(const MvaInterface &classifier, const
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+inline void LArMvaHelper::CalculateClassificationScores(
+    const MvaInterface &classifier, const MvaFeatureMatrix &featureMatrix, DoubleVector &scores)
+{
+    classifier.CalculateClassificationScores(featureMatrix, scores);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline void LArMvaHelper::CalculateProbabilities(
+    const MvaInterface &classifier, const MvaFeatureMatrix &featureMatrix, DoubleVector &probabilities)
+{
+    classifier.CalculateProbabilities(featureMatrix, probabilities);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template <typename... Ts, typename... TARGS>
 LArMvaHelper::MvaFeatureVector LArMvaHelper::CalculateFeatures(const MvaFeatureToolVector<Ts...> &featureToolVector, TARGS &&... args)
 {
+    MvaFeatureCache featureCache;
+    const MvaFeatureCache::Scope scope(MvaFeatureCache::GetAvailableCache() ? *MvaFeatureCache::GetAvailableCache() : featureCache);
     LArMvaHelper::MvaFeatureVector featureVector;
 
     for (MvaFeatureTool<Ts...> *const pFeatureTool : featureToolVector)
@@ -412,6 +607,8 @@ template <typename... Ts, typename... TARGS>
 LArMvaHelper::MvaFeatureMap LArMvaHelper::CalculateFeatures(const pandora::StringVector &featureToolOrder,
     const MvaFeatureToolMap<Ts...> &featureToolMap, pandora::StringVector &featureOrder, TARGS &&... args)
 {
+    MvaFeatureCache featureCache;
+    const MvaFeatureCache::Scope scope(MvaFeatureCache::GetAvailableCache() ? *MvaFeatureCache::GetAvailableCache() : featureCache);
     LArMvaHelper::MvaFeatureMap featureMap;
 
     for (auto const &pFeatureToolName : featureToolOrder)
@@ -434,6 +631,8 @@ template <typename T, typename... Ts, typename... TARGS>
 LArMvaHelper::MvaFeatureVector LArMvaHelper::CalculateFeaturesOfType(const MvaFeatureToolVector<Ts...> &featureToolVector, TARGS &&... args)
 {
     using TD = typename std::decay<T>::type;
+    MvaFeatureCache featureCache;
+    const MvaFeatureCache::Scope scope(MvaFeatureCache::GetAvailableCache() ? *MvaFeatureCache::GetAvailableCache() : featureCache);
     LArMvaHelper::MvaFeatureVector featureVector;
 
     for (MvaFeatureTool<Ts...> *const pFeatureTool : featureToolVector)
@@ -447,6 +646,19 @@ LArMvaHelper::MvaFeatureVector LArMvaHelper::CalculateFeaturesOfType(const MvaFe
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+template <typename T, typename... TARGS>
+std::shared_ptr<const T> LArMvaHelper::GetCachedIntermediate(const void *const pObject, const std::string &name, TARGS &&... args)
+{
+    MvaFeatureCache *const pFeatureCache(MvaFeatureCache::GetAvailableCache());
+
+    if (!pFeatureCache)
+        return std::make_shared<T>(std::forward<TARGS>(args)...);
+
+    return pFeatureCache->Get<T>(pObject, name, std::forward<TARGS>(args)...);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template <typename... Ts>
 pandora::StatusCode LArMvaHelper::AddFeatureToolToVector(pandora::AlgorithmTool *const pFeatureTool, MvaFeatureToolVector<Ts...> &featureToolVector)
 {
@@ -476,49 +688,6 @@ pandora::StatusCode LArMvaHelper::AddFeatureToolToMap(
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-inline std::string LArMvaHelper::GetTimestampString()
-{
-    std::time_t timestampNow = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
-
-    struct tm *pTimeInfo(NULL);
-    char buffer[80];
-
-    pTimeInfo = localtime(&timestampNow);
-    strftime(buffer, 80, "%x_%X", pTimeInfo);
-
-    std::string timeString(buffer);
-
-    if (!timeString.empty() && timeString.back() == '\n') // last char is always a newline
-        timeString.pop_back();
-
-    return timeString;
-}
-
-//------------------------------------------------------------------------------------------------------------------------------------------
-
-template <typename TCONTAINER>
-inline pandora::StatusCode LArMvaHelper::WriteFeaturesToFile(std::ofstream &outfile, const std::string &delimiter, TCONTAINER &&featureContainer)
-{
-    static_assert(std::is_same<typename std::decay<TCONTAINER>::type, LArMvaHelper::MvaFeatureVector>::value,
-        "LArMvaHelper: Could not write training set example because a passed parameter was not a vector of MvaFeatures");
-
-    PANDORA_RETURN_RESULT_IF(pandora::STATUS_CODE_SUCCESS, !=, WriteFeaturesToFileImpl(outfile, delimiter, featureContainer));
-    return pandora::STATUS_CODE_SUCCESS;
-}
-
-//------------------------------------------------------------------------------------------------------------------------------------------
-
-template <typename TCONTAINER>
-pandora::StatusCode LArMvaHelper::WriteFeaturesToFileImpl(std::ofstream &outfile, const std::string &delimiter, TCONTAINER &&featureContainer)
-{
-    for (const MvaFeature &feature : featureContainer)
-        outfile << feature.Get() << delimiter;
-
-    return pandora::STATUS_CODE_SUCCESS;
-}
-
-//------------------------------------------------------------------------------------------------------------------------------------------
-
 template <typename TLIST, typename... TLISTS>
 LArMvaHelper::MvaFeatureVector LArMvaHelper::ConcatenateFeatureLists(TLIST &&featureList, TLISTS &&... featureLists)
 {
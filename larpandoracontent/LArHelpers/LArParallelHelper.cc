@@ -0,0 +1,42 @@
+/**
+ *  @file   larpandoracontent/LArHelpers/LArParallelHelper.cc
+ *
+ *  @brief  Implementation of the parallel helper class.
+ *
+ *  $Log: $
+ */
+
+#include "larpandoracontent/LArHelpers/LArParallelHelper.h"
+
+namespace lar_content
+{
+
+std::atomic<bool> LArParallelHelper::m_isValidationMode(false);
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+unsigned int LArParallelHelper::GetNThreads(const unsigned int nRequestedThreads, const unsigned int nItems)
+{
+    unsigned int nThreads(nRequestedThreads);
+
+    if (0 == nThreads)
+        nThreads = std::thread::hardware_concurrency();
+
+    return std::max(1u, std::min(nThreads, nItems));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool LArParallelHelper::IsValidationMode()
+{
+    return m_isValidationMode.load();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArParallelHelper::SetValidationMode(const bool isValidationMode)
+{
+    m_isValidationMode.store(isValidationMode);
+}
+
+} // namespace lar_content
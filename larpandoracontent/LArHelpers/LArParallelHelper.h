@@ -0,0 +1,228 @@
+/**
+ *  @file   larpandoracontent/LArHelpers/LArParallelHelper.h
+ *
+ *  @brief  Header file for the parallel helper class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_PARALLEL_HELPER_H
+#define LAR_PARALLEL_HELPER_H 1
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <iostream>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace lar_content
+{
+
+/**
+ *  @brief  LArParallelHelper class
+ */
+class LArParallelHelper
+{
+public:
+    /**
+     *  @brief  Get the number of threads to use, given a requested number of threads and a number of items of work
+     *
+     *  @param  nRequestedThreads the requested number of threads (zero to use all available hardware threads)
+     *  @param  nItems the number of items of work
+     *
+     *  @return the number of threads to use, never more than the number of items, and always at least one
+     */
+    static unsigned int GetNThreads(const unsigned int nRequestedThreads, const unsigned int nItems);
+
+    /**
+     *  @brief  Call a function for each index in the range [0, nItems), sharing the work between a number of threads. With a single
+     *          thread, the function is called in index order from the calling thread. Otherwise, threads claim indices in increasing
+     *          order until all items are processed. If any call throws, the exception from the lowest index is rethrown after
+     *          all threads have finished, so that the outcome does not depend upon thread scheduling.
+     *
+     *  @param  nItems the number of items of work
+     *  @param  nRequestedThreads the requested number of threads (zero to use all available hardware threads)
+     *  @param  function the function to call, accepting a single unsigned int index argument
+     */
+    template <typename T>
+    static void ForEach(const unsigned int nItems, const unsigned int nRequestedThreads, const T &function);
+
+    /**
+     *  @brief  Evaluate a function for each index in the range [0, nItems), sharing the work between a number of threads and storing each
+     *          result at its index, so that the results do not depend upon thread scheduling. The function must not have side effects.
+     *          In validation mode, multi-threaded results are compared against a serial evaluation and any differences are reported.
+     *
+     *  @param  nItems the number of items of work
+     *  @param  nRequestedThreads the requested number of threads (zero to use all available hardware threads)
+     *  @param  function the function to evaluate, accepting a single unsigned int index argument and returning a value of type T
+     *  @param  results to receive the results, one per index, where T is default constructible, assignable and equality comparable
+     */
+    template <typename T, typename F>
+    static void Transform(const unsigned int nItems, const unsigned int nRequestedThreads, const F &function, std::vector<T> &results);
+
+    /**
+     *  @brief  Evaluate a function for each index in the range [0, nItems), sharing the work between a number of threads, then combine
+     *          the results serially in index order, so that the outcome (including that of non-associative floating point reductions)
+     *          does not depend upon the number of threads or their scheduling
+     *
+     *  @param  nItems the number of items of work
+     *  @param  nRequestedThreads the requested number of threads (zero to use all available hardware threads)
+     *  @param  function the function to evaluate, accepting a single unsigned int index argument and returning a value of type T
+     *  @param  initialValue the initial value of the reduction
+     *  @param  reduction the reduction, accepting the running value and the result for the next index, and returning the new value
+     *
+     *  @return the reduced value
+     */
+    template <typename T, typename F, typename R>
+    static T OrderedReduce(const unsigned int nItems, const unsigned int nRequestedThreads, const F &function, const T &initialValue,
+        const R &reduction);
+
+    /**
+     *  @brief  Get the keys of a (typically pointer-keyed, unordered) associative container, sorted using a provided comparison, so that
+     *          iteration over the container does not depend upon pointer values or hashing
+     *
+     *  @param  container the associative container
+     *  @param  sortFunction the comparison, e.g. LArClusterHelper::SortByNHits or LArClusterHelper::SortHitsByPosition
+     *  @param  keys to receive the sorted keys
+     */
+    template <typename C, typename S>
+    static void GetSortedKeys(const C &container, const S &sortFunction, std::vector<typename C::key_type> &keys);
+
+    /**
+     *  @brief  Whether validation mode is enabled, in which multi-threaded transforms are checked against a serial evaluation
+     *
+     *  @return boolean
+     */
+    static bool IsValidationMode();
+
+    /**
+     *  @brief  Set whether validation mode is enabled. This is a process-wide setting and is off by default, as it doubles the work
+     *
+     *  @param  isValidationMode whether validation mode is enabled
+     */
+    static void SetValidationMode(const bool isValidationMode);
+
+private:
+    static std::atomic<bool> m_isValidationMode; ///< Whether validation mode is enabled
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+void LArParallelHelper::ForEach(const unsigned int nItems, const unsigned int nRequestedThreads, const T &function)
+{
+    const unsigned int nThreads(LArParallelHelper::GetNThreads(nRequestedThreads, nItems));
+
+    if (nThreads <= 1)
+    {
+        for (unsigned int index = 0; index < nItems; ++index)
+            function(index);
+
+        return;
+    }
+
+    std::atomic<unsigned int> nextIndex(0);
+    std::vector<std::exception_ptr> exceptions(nItems);
+
+    auto worker = [&]() {
+        for (unsigned int index = nextIndex++; index < nItems; index = nextIndex++)
+        {
+            try
+            {
+                function(index);
+            }
+            catch (...)
+            {
+                exceptions[index] = std::current_exception();
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(nThreads - 1);
+
+    for (unsigned int iThread = 1; iThread < nThreads; ++iThread)
+        threads.emplace_back(worker);
+
+    worker();
+
+    for (std::thread &thread : threads)
+        thread.join();
+
+    for (const std::exception_ptr &pException : exceptions)
+    {
+        if (pException)
+            std::rethrow_exception(pException);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T, typename F>
+void LArParallelHelper::Transform(
+    const unsigned int nItems, const unsigned int nRequestedThreads, const F &function, std::vector<T> &results)
+{
+    // ATTN Elements of std::vector<bool> share storage, so may not be written concurrently
+    static_assert(!std::is_same<T, bool>::value, "LArParallelHelper::Transform does not support bool results");
+
+    results.clear();
+    results.resize(nItems);
+
+    LArParallelHelper::ForEach(nItems, nRequestedThreads, [&](const unsigned int index) { results[index] = function(index); });
+
+    if (!LArParallelHelper::IsValidationMode() || (LArParallelHelper::GetNThreads(nRequestedThreads, nItems) <= 1))
+        return;
+
+    unsigned int nDifferences(0), firstDifference(nItems);
+
+    for (unsigned int index = 0; index < nItems; ++index)
+    {
+        if (T(function(index)) == results[index])
+            continue;
+
+        if (0 == nDifferences++)
+            firstDifference = index;
+    }
+
+    if (nDifferences > 0)
+    {
+        std::cout << "LArParallelHelper::Transform - " << nDifferences << " of " << nItems
+                  << " multi-threaded results differ from the serial results, first at index " << firstDifference << std::endl;
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T, typename F, typename R>
+T LArParallelHelper::OrderedReduce(
+    const unsigned int nItems, const unsigned int nRequestedThreads, const F &function, const T &initialValue, const R &reduction)
+{
+    std::vector<T> results;
+    LArParallelHelper::Transform(nItems, nRequestedThreads, function, results);
+
+    T value(initialValue);
+
+    for (const T &result : results)
+        value = reduction(value, result);
+
+    return value;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename C, typename S>
+void LArParallelHelper::GetSortedKeys(const C &container, const S &sortFunction, std::vector<typename C::key_type> &keys)
+{
+    keys.clear();
+    keys.reserve(container.size());
+
+    for (const auto &entry : container)
+        keys.push_back(entry.first);
+
+    std::sort(keys.begin(), keys.end(), sortFunction);
+}
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_PARALLEL_HELPER_H
@@ -9,6 +9,7 @@
 #include "larpandoracontent/LArHelpers/LArPcaHelper.h"
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 #include "larpandoracontent/LArHelpers/LArObjectHelper.h"
+#include "larpandoracontent/LArHelpers/LArParallelHelper.h"
 
 #include <Eigen/Dense>
 
@@ -100,10 +101,65 @@ void LArPcaHelper::RunPca(const WeightedPointVector &pointVector, CartesianVecto
         zi2 += z * z * weight;
     }
 
+    LArPcaHelper::SolveCovariance(xi2, xiyi, xizi, yi2, yizi, zi2, sumWeight, pointVector.size(), outputEigenValues, outputEigenVectors);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArPcaHelper::RunPca(
+    const PcaAccumulator &accumulator, CartesianVector &centroid, EigenValues &outputEigenValues, EigenVectors &outputEigenVectors)
+{
+    if (0 == accumulator.m_nPoints)
+    {
+        std::cout << "LArPcaHelper::RunPca - no three dimensional hits provided" << std::endl;
+        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
+    }
+
+    if (std::fabs(accumulator.m_sumWeight) < std::numeric_limits<double>::epsilon())
+    {
+        std::cout << "LArPcaHelper::RunPca - sum of weights is zero" << std::endl;
+        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
+    }
+
+    centroid = CartesianVector(accumulator.m_meanX, accumulator.m_meanY, accumulator.m_meanZ);
+
+    LArPcaHelper::SolveCovariance(accumulator.m_sumXX, accumulator.m_sumXY, accumulator.m_sumXZ, accumulator.m_sumYY, accumulator.m_sumYZ,
+        accumulator.m_sumZZ, accumulator.m_sumWeight, accumulator.m_nPoints, outputEigenValues, outputEigenVectors);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+void LArPcaHelper::RunPca(const std::vector<T> &inputVector, PcaResultVector &pcaResults, const unsigned int nThreads)
+{
+    pcaResults.assign(inputVector.size(), PcaResult());
+
+    LArParallelHelper::ForEach(inputVector.size(), nThreads, [&](const unsigned int index) {
+        PcaResult &pcaResult(pcaResults.at(index));
+
+        try
+        {
+            LArPcaHelper::RunPca(inputVector.at(index), pcaResult.m_centroid, pcaResult.m_eigenValues, pcaResult.m_eigenVectors);
+            pcaResult.m_statusCode = STATUS_CODE_SUCCESS;
+        }
+        catch (const StatusCodeException &statusCodeException)
+        {
+            pcaResult.m_statusCode = statusCodeException.GetStatusCode();
+            pcaResult.m_eigenVectors.clear();
+        }
+    });
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArPcaHelper::SolveCovariance(const double sumXX, const double sumXY, const double sumXZ, const double sumYY, const double sumYZ,
+    const double sumZZ, const double sumWeight, const unsigned int nPoints, EigenValues &outputEigenValues,
+    EigenVectors &outputEigenVectors)
+{
     // Using Eigen package
     Eigen::Matrix3f sig;
 
-    sig << xi2, xiyi, xizi, xiyi, yi2, yizi, xizi, yizi, zi2;
+    sig << sumXX, sumXY, sumXZ, sumXY, sumYY, sumYZ, sumXZ, sumYZ, sumZZ;
 
     sig *= 1. / sumWeight;
 
@@ -111,10 +167,9 @@ void LArPcaHelper::RunPca(const WeightedPointVector &pointVector, CartesianVecto
 
     if (eigenMat.info() != Eigen::ComputationInfo::Success)
     {
-        std::cout << "LArPcaHelper::RunPca - decomposition failure, nThreeDHits = " << pointVector.size() << std::endl;
+        std::cout << "LArPcaHelper::RunPca - decomposition failure, nThreeDHits = " << nPoints << std::endl;
         throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
     }
-
     typedef std::pair<float, size_t> EigenValColPair;
     typedef std::vector<EigenValColPair> EigenValColVector;
 
@@ -137,9 +192,129 @@ void LArPcaHelper::RunPca(const WeightedPointVector &pointVector, CartesianVecto
         outputEigenVectors.emplace_back(eigenVecs(0, pair.second), eigenVecs(1, pair.second), eigenVecs(2, pair.second));
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArPcaHelper::PcaAccumulator::PcaAccumulator() :
+    m_nPoints(0),
+    m_sumWeight(0.),
+    m_meanX(0.),
+    m_meanY(0.),
+    m_meanZ(0.),
+    m_sumXX(0.),
+    m_sumXY(0.),
+    m_sumXZ(0.),
+    m_sumYY(0.),
+    m_sumYZ(0.),
+    m_sumZZ(0.)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArPcaHelper::PcaAccumulator::AddPoint(const CartesianVector &point, const double weight)
+{
+    if (weight < 0.)
+    {
+        std::cout << "LArPcaHelper::PcaAccumulator::AddPoint - negative weight found" << std::endl;
+        throw StatusCodeException(STATUS_CODE_NOT_ALLOWED);
+    }
+
+    ++m_nPoints;
+
+    if (!(weight > 0.))
+        return;
+
+    m_sumWeight += weight;
+
+    const double x(point.GetX()), y(point.GetY()), z(point.GetZ());
+    const double dx(x - m_meanX), dy(y - m_meanY), dz(z - m_meanZ);
+    const double fraction(weight / m_sumWeight);
+
+    m_meanX += dx * fraction;
+    m_meanY += dy * fraction;
+    m_meanZ += dz * fraction;
+
+    const double ex(x - m_meanX), ey(y - m_meanY), ez(z - m_meanZ);
+
+    m_sumXX += weight * dx * ex;
+    m_sumXY += weight * dx * ey;
+    m_sumXZ += weight * dx * ez;
+    m_sumYY += weight * dy * ey;
+    m_sumYZ += weight * dy * ez;
+    m_sumZZ += weight * dz * ez;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+void LArPcaHelper::PcaAccumulator::AddPoints(const T &t)
+{
+    for (const auto &point : t)
+        this->AddPoint(LArObjectHelper::TypeAdaptor::GetPosition(point));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArPcaHelper::PcaAccumulator::AddPoints(const WeightedPointVector &pointVector)
+{
+    for (const WeightedPoint &weightedPoint : pointVector)
+        this->AddPoint(weightedPoint.first, weightedPoint.second);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArPcaHelper::PcaAccumulator::Merge(const PcaAccumulator &other)
+{
+    m_nPoints += other.m_nPoints;
+
+    if (!(other.m_sumWeight > 0.))
+        return;
+
+    if (!(m_sumWeight > 0.))
+    {
+        const unsigned int nPoints(m_nPoints);
+        *this = other;
+        m_nPoints = nPoints;
+        return;
+    }
+
+    const double sumWeight(m_sumWeight + other.m_sumWeight);
+    const double dx(other.m_meanX - m_meanX), dy(other.m_meanY - m_meanY), dz(other.m_meanZ - m_meanZ);
+    const double factor(m_sumWeight * other.m_sumWeight / sumWeight);
+    const double fraction(other.m_sumWeight / sumWeight);
+
+    m_sumXX += other.m_sumXX + dx * dx * factor;
+    m_sumXY += other.m_sumXY + dx * dy * factor;
+    m_sumXZ += other.m_sumXZ + dx * dz * factor;
+    m_sumYY += other.m_sumYY + dy * dy * factor;
+    m_sumYZ += other.m_sumYZ + dy * dz * factor;
+    m_sumZZ += other.m_sumZZ + dz * dz * factor;
+
+    m_meanX += dx * fraction;
+    m_meanY += dy * fraction;
+    m_meanZ += dz * fraction;
+    m_sumWeight = sumWeight;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArPcaHelper::PcaResult::PcaResult() :
+    m_statusCode(STATUS_CODE_NOT_INITIALIZED),
+    m_centroid(0.f, 0.f, 0.f),
+    m_eigenValues(0.f, 0.f, 0.f)
+{
+}
+
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 template void LArPcaHelper::RunPca(const CartesianPointVector &, CartesianVector &, EigenValues &, EigenVectors &);
 template void LArPcaHelper::RunPca(const CaloHitList &, CartesianVector &, EigenValues &, EigenVectors &);
+template void LArPcaHelper::RunPca(const std::vector<CartesianPointVector> &, PcaResultVector &, const unsigned int);
+template void LArPcaHelper::RunPca(const std::vector<CaloHitList> &, PcaResultVector &, const unsigned int);
+template void LArPcaHelper::RunPca(const std::vector<WeightedPointVector> &, PcaResultVector &, const unsigned int);
+template void LArPcaHelper::PcaAccumulator::AddPoints(const CartesianPointVector &);
+template void LArPcaHelper::PcaAccumulator::AddPoints(const CaloHitList &);
 
 } // namespace lar_content
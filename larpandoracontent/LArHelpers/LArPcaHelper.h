@@ -10,6 +10,8 @@
 
 #include "Objects/CartesianVector.h"
 
+#include "Pandora/StatusCodes.h"
+
 #include <vector>
 
 namespace lar_content
@@ -26,6 +28,97 @@ public:
     typedef std::pair<const pandora::CartesianVector, double> WeightedPoint;
     typedef std::vector<WeightedPoint> WeightedPointVector;
 
+    /**
+     *  @brief  PcaAccumulator class, accumulating the weighted centroid and covariance of a set of points in a single, numerically stable
+     *          (Welford-style) pass. Accumulators can be updated as points are added, and combined when point sets are merged.
+     */
+    class PcaAccumulator
+    {
+    public:
+        /**
+         *  @brief  Default constructor
+         */
+        PcaAccumulator();
+
+        /**
+         *  @brief  Add a point
+         *
+         *  @param  point the point position
+         *  @param  weight the point weight, which must not be negative
+         */
+        void AddPoint(const pandora::CartesianVector &point, const double weight = 1.);
+
+        /**
+         *  @brief  Add points, each with unit weight
+         *
+         *  @param  t the input information, e.g. a calo hit list or cartesian point vector
+         */
+        template <typename T>
+        void AddPoints(const T &t);
+
+        /**
+         *  @brief  Add weighted points
+         *
+         *  @param  pointVector a vector of pairs of positions and weights
+         */
+        void AddPoints(const WeightedPointVector &pointVector);
+
+        /**
+         *  @brief  Merge the points accumulated by another accumulator into this accumulator
+         *
+         *  @param  other the other accumulator
+         */
+        void Merge(const PcaAccumulator &other);
+
+        /**
+         *  @brief  Get the number of points
+         *
+         *  @return the number of points
+         */
+        unsigned int GetNPoints() const;
+
+        /**
+         *  @brief  Get the sum of the point weights
+         *
+         *  @return the sum of the point weights
+         */
+        double GetSumWeight() const;
+
+    private:
+        unsigned int m_nPoints; ///< The number of points
+        double m_sumWeight;     ///< The sum of the point weights
+        double m_meanX;         ///< The weighted mean x coordinate
+        double m_meanY;         ///< The weighted mean y coordinate
+        double m_meanZ;         ///< The weighted mean z coordinate
+        double m_sumXX;         ///< The weighted sum of squared x deviations from the mean
+        double m_sumXY;         ///< The weighted sum of products of x and y deviations from the mean
+        double m_sumXZ;         ///< The weighted sum of products of x and z deviations from the mean
+        double m_sumYY;         ///< The weighted sum of squared y deviations from the mean
+        double m_sumYZ;         ///< The weighted sum of products of y and z deviations from the mean
+        double m_sumZZ;         ///< The weighted sum of squared z deviations from the mean
+
+        friend class LArPcaHelper;
+    };
+
+    /**
+     *  @brief  PcaResult class, holding the outcome of one principal component analysis in a batch
+     */
+    class PcaResult
+    {
+    public:
+        /**
+         *  @brief  Default constructor
+         */
+        PcaResult();
+
+        pandora::StatusCode m_statusCode;    ///< The status code, STATUS_CODE_SUCCESS if the analysis succeeded
+        pandora::CartesianVector m_centroid; ///< The centroid position
+        EigenValues m_eigenValues;           ///< The eigen values
+        EigenVectors m_eigenVectors;         ///< The eigen vectors
+    };
+
+    typedef std::vector<PcaResult> PcaResultVector;
+
     /**
      *  @brief  Run principal component analysis using input calo hits (TPC_VIEW_U,V,W or TPC_3D; all treated as 3D points)
      *
@@ -47,8 +140,63 @@ public:
      */
     static void RunPca(const WeightedPointVector &pointVector, pandora::CartesianVector &centroid, EigenValues &outputEigenValues,
         EigenVectors &outputEigenVectors);
+
+    /**
+     *  @brief  Run principal component analysis using the points gathered by an accumulator
+     *
+     *  @param  accumulator the accumulator
+     *  @param  centroid to receive the centroid position
+     *  @param  outputEigenValues to receive the eigen values
+     *  @param  outputEigenVectors to receive the eigen vectors
+     */
+    static void RunPca(const PcaAccumulator &accumulator, pandora::CartesianVector &centroid, EigenValues &outputEigenValues,
+        EigenVectors &outputEigenVectors);
+
+    /**
+     *  @brief  Run principal component analysis for each of a number of point sets, sharing the work between a number of threads. A
+     *          failure for one point set is recorded in its result, rather than stopping the batch.
+     *
+     *  @param  inputVector the vector of input information, one entry per point set
+     *  @param  pcaResults to receive the results, one per point set, in input order
+     *  @param  nThreads the number of threads to use (zero to use all available hardware threads)
+     */
+    template <typename T>
+    static void RunPca(const std::vector<T> &inputVector, PcaResultVector &pcaResults, const unsigned int nThreads = 1);
+
+private:
+    /**
+     *  @brief  Get the eigen values and vectors of a weighted covariance matrix
+     *
+     *  @param  sumXX the weighted sum of squared x deviations from the mean
+     *  @param  sumXY the weighted sum of products of x and y deviations from the mean
+     *  @param  sumXZ the weighted sum of products of x and z deviations from the mean
+     *  @param  sumYY the weighted sum of squared y deviations from the mean
+     *  @param  sumYZ the weighted sum of products of y and z deviations from the mean
+     *  @param  sumZZ the weighted sum of squared z deviations from the mean
+     *  @param  sumWeight the sum of the point weights
+     *  @param  nPoints the number of points
+     *  @param  outputEigenValues to receive the eigen values
+     *  @param  outputEigenVectors to receive the eigen vectors
+     */
+    static void SolveCovariance(const double sumXX, const double sumXY, const double sumXZ, const double sumYY, const double sumYZ,
+        const double sumZZ, const double sumWeight, const unsigned int nPoints, EigenValues &outputEigenValues,
+        EigenVectors &outputEigenVectors);
 };
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline unsigned int LArPcaHelper::PcaAccumulator::GetNPoints() const
+{
+    return m_nPoints;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline double LArPcaHelper::PcaAccumulator::GetSumWeight() const
+{
+    return m_sumWeight;
+}
+
 } // namespace lar_content
 
 #endif // #ifndef LAR_PCA_HELPER_H
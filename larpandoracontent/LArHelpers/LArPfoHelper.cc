@@ -564,19 +564,7 @@ LArShowerPCA LArPfoHelper::GetPrincipalComponents(const CartesianPointVector &po
     LArPcaHelper::EigenValues eigenValues(0.f, 0.f, 0.f);
     LArPcaHelper::RunPca(pointVector, centroid, eigenValues, eigenVecs);
 
-    // Require that principal eigenvalue should always be positive
-    if (eigenValues.GetX() < std::numeric_limits<float>::epsilon())
-        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
-
-    // By convention, principal axis should always point away from vertex
-    const float testProjection(eigenVecs.at(0).GetDotProduct(vertexPosition - centroid));
-    const float directionScaleFactor((testProjection > std::numeric_limits<float>::epsilon()) ? -1.f : 1.f);
-
-    const CartesianVector primaryAxis(eigenVecs.at(0) * directionScaleFactor);
-    const CartesianVector secondaryAxis(eigenVecs.at(1) * directionScaleFactor);
-    const CartesianVector tertiaryAxis(eigenVecs.at(2) * directionScaleFactor);
-
-    return LArShowerPCA(centroid, primaryAxis, secondaryAxis, tertiaryAxis, eigenValues);
+    return LArPfoHelper::BuildShowerPCA(centroid, eigenValues, eigenVecs, vertexPosition);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -590,6 +578,36 @@ LArShowerPCA LArPfoHelper::GetPrincipalComponents(const ParticleFlowObject *cons
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+LArShowerPCA LArPfoHelper::GetPrincipalComponents(const LArPcaHelper::PcaAccumulator &accumulator, const CartesianVector &vertexPosition)
+{
+    CartesianVector centroid(0.f, 0.f, 0.f);
+    LArPcaHelper::EigenVectors eigenVecs;
+    LArPcaHelper::EigenValues eigenValues(0.f, 0.f, 0.f);
+    LArPcaHelper::RunPca(accumulator, centroid, eigenValues, eigenVecs);
+
+    return LArPfoHelper::BuildShowerPCA(centroid, eigenValues, eigenVecs, vertexPosition);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArShowerPCA LArPfoHelper::GetSinglePassPrincipalComponents(const ParticleFlowObject *const pPfo, const Vertex *const pVertex)
+{
+    ClusterList clusterList;
+    LArPfoHelper::GetClusters(pPfo, TPC_3D, clusterList);
+
+    LArPcaHelper::PcaAccumulator accumulator;
+
+    for (const Cluster *const pCluster : clusterList)
+    {
+        for (const OrderedCaloHitList::value_type &layerEntry : pCluster->GetOrderedCaloHitList())
+            accumulator.AddPoints(*layerEntry.second);
+    }
+
+    return LArPfoHelper::GetPrincipalComponents(accumulator, pVertex->GetPosition());
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 bool LArPfoHelper::SortByHitProjection(const LArTrackTrajectoryPoint &lhs, const LArTrackTrajectoryPoint &rhs)
 {
     if (lhs.first != rhs.first)
@@ -678,6 +696,26 @@ void LArPfoHelper::GetBreadthFirstHierarchyRepresentation(const pandora::Particl
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+LArShowerPCA LArPfoHelper::BuildShowerPCA(const CartesianVector &centroid, const LArPcaHelper::EigenValues &eigenValues,
+    const LArPcaHelper::EigenVectors &eigenVecs, const CartesianVector &vertexPosition)
+{
+    // Require that principal eigenvalue should always be positive
+    if (eigenValues.GetX() < std::numeric_limits<float>::epsilon())
+        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
+
+    // By convention, principal axis should always point away from vertex
+    const float testProjection(eigenVecs.at(0).GetDotProduct(vertexPosition - centroid));
+    const float directionScaleFactor((testProjection > std::numeric_limits<float>::epsilon()) ? -1.f : 1.f);
+
+    const CartesianVector primaryAxis(eigenVecs.at(0) * directionScaleFactor);
+    const CartesianVector secondaryAxis(eigenVecs.at(1) * directionScaleFactor);
+    const CartesianVector tertiaryAxis(eigenVecs.at(2) * directionScaleFactor);
+
+    return LArShowerPCA(centroid, primaryAxis, secondaryAxis, tertiaryAxis, eigenValues);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template <typename T>
 void LArPfoHelper::SlidingFitTrajectoryImpl(const T *const pT, const CartesianVector &vertexPosition, const unsigned int layerWindow,
     const float layerPitch, LArTrackStateVector &trackStateVector, IntVector *const pIndexVector)
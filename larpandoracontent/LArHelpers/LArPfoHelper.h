@@ -12,6 +12,8 @@
 #include "Objects/ParticleFlowObject.h"
 #include "Objects/Vertex.h"
 
+#include "larpandoracontent/LArHelpers/LArPcaHelper.h"
+
 #include "larpandoracontent/LArObjects/LArPfoObjects.h"
 
 namespace lar_content
@@ -383,6 +385,25 @@ public:
      */
     static LArShowerPCA GetPrincipalComponents(const pandora::ParticleFlowObject *const pPfo, const pandora::Vertex *const pVertex);
 
+    /**
+     *  @brief  Perform PCA analysis on the points gathered by a single pass accumulator and return results
+     *
+     *  @param  accumulator the pca accumulator
+     *  @param  vertexPosition the input vertex position
+     */
+    static LArShowerPCA GetPrincipalComponents(
+        const LArPcaHelper::PcaAccumulator &accumulator, const pandora::CartesianVector &vertexPosition);
+
+    /**
+     *  @brief  Perform PCA analysis on Pfo, accumulating its 3D hit positions in a single pass without an intermediate copy, and return
+     *          results
+     *
+     *  @param  pPfo the address of the input Pfo
+     *  @param  pVertex the address of the input vertex
+     */
+    static LArShowerPCA GetSinglePassPrincipalComponents(
+        const pandora::ParticleFlowObject *const pPfo, const pandora::Vertex *const pVertex);
+
     /**
      *  @brief  Sort pfos by number of constituent hits
      *
@@ -410,6 +431,17 @@ public:
     static void GetBreadthFirstHierarchyRepresentation(const pandora::ParticleFlowObject *const pPfo, pandora::PfoList &pfoList);
 
 private:
+    /**
+     *  @brief  Build the shower PCA from the outcome of a principal component analysis, with axes pointing away from the vertex
+     *
+     *  @param  centroid the centroid position
+     *  @param  eigenValues the eigen values
+     *  @param  eigenVecs the eigen vectors
+     *  @param  vertexPosition the input vertex position
+     */
+    static LArShowerPCA BuildShowerPCA(const pandora::CartesianVector &centroid, const LArPcaHelper::EigenValues &eigenValues,
+        const LArPcaHelper::EigenVectors &eigenVecs, const pandora::CartesianVector &vertexPosition);
+
     /**
      *  @brief  Implementation of sliding fit trajectory extraction
      *
@@ -0,0 +1,189 @@
+/**
+ *  @file   larpandoracontent/LArHelpers/LArSlidingFitCacheHelper.cc
+ *
+ *  @brief  Implementation of the sliding fit cache helper class.
+ *
+ *  $Log: $
+ */
+
+#include "Objects/Cluster.h"
+
+#include "larpandoracontent/LArHelpers/LArClusterHelper.h"
+#include "larpandoracontent/LArHelpers/LArSlidingFitCacheHelper.h"
+
+#include <functional>
+
+using namespace pandora;
+
+namespace lar_content
+{
+
+LArSlidingFitCacheHelper::PandoraToSlidingFitCacheMap LArSlidingFitCacheHelper::m_pandoraToSlidingFitCacheMap;
+LArSlidingFitCacheHelper::PandoraToPointingClusterCacheMap LArSlidingFitCacheHelper::m_pandoraToPointingClusterCacheMap;
+LArSlidingFitCacheHelper::PandoraToByteCountMap LArSlidingFitCacheHelper::m_pandoraToAccountedBytesMap;
+LArMemoryAccountingHelper::MemoryRecord LArSlidingFitCacheHelper::m_memoryRecord(LArMemoryAccountingHelper::SLIDING_FIT_MEMORY);
+std::mutex LArSlidingFitCacheHelper::m_mutex;
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const TwoDSlidingFitResult &LArSlidingFitCacheHelper::GetSlidingFitResult(
+    const Pandora &pandora, const Cluster *const pCluster, const unsigned int layerFitHalfWindow, const float layerPitch)
+{
+    const ClusterState clusterState(pCluster);
+    const CacheKey cacheKey(pCluster, layerFitHalfWindow, layerPitch);
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        SlidingFitCache &slidingFitCache(m_pandoraToSlidingFitCacheMap[&pandora]);
+        SlidingFitCache::const_iterator iter(slidingFitCache.find(cacheKey));
+
+        if ((slidingFitCache.end() != iter) && (iter->second.first == clusterState))
+            return iter->second.second;
+    }
+
+    // ATTN Calculated without holding the lock, so that fits for different clusters may proceed concurrently
+    const TwoDSlidingFitResult slidingFitResult(pCluster, layerFitHalfWindow, layerPitch);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    SlidingFitCache &slidingFitCache(m_pandoraToSlidingFitCacheMap[&pandora]);
+    SlidingFitCache::iterator iter(slidingFitCache.find(cacheKey));
+
+    if (slidingFitCache.end() != iter)
+    {
+        if (iter->second.first == clusterState)
+            return iter->second.second;
+
+        LArSlidingFitCacheHelper::ReleaseCacheEntry(pandora, LArSlidingFitCacheHelper::GetEstimatedBytes(iter->second.second));
+        slidingFitCache.erase(iter);
+    }
+
+    LArSlidingFitCacheHelper::AccountCacheEntry(pandora, LArSlidingFitCacheHelper::GetEstimatedBytes(slidingFitResult));
+    return slidingFitCache.insert(SlidingFitCache::value_type(cacheKey, CacheEntry(clusterState, slidingFitResult))).first->second.second;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const LArPointingCluster &LArSlidingFitCacheHelper::GetPointingCluster(
+    const Pandora &pandora, const Cluster *const pCluster, const unsigned int layerFitHalfWindow, const float layerPitch)
+{
+    const ClusterState clusterState(pCluster);
+    const CacheKey cacheKey(pCluster, layerFitHalfWindow, layerPitch);
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        PointingClusterCache &pointingClusterCache(m_pandoraToPointingClusterCacheMap[&pandora]);
+        PointingClusterCache::const_iterator iter(pointingClusterCache.find(cacheKey));
+
+        if ((pointingClusterCache.end() != iter) && (iter->second.first == clusterState))
+            return iter->second.second;
+    }
+
+    // ATTN Built without holding the lock, as two dimensional pointing clusters use the cached sliding fit results
+    const LArPointingCluster pointingCluster((TPC_3D == LArClusterHelper::GetClusterHitType(pCluster))
+            ? LArPointingCluster(pCluster, layerFitHalfWindow, layerPitch)
+            : LArPointingCluster(LArSlidingFitCacheHelper::GetSlidingFitResult(pandora, pCluster, layerFitHalfWindow, layerPitch)));
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    PointingClusterCache &pointingClusterCache(m_pandoraToPointingClusterCacheMap[&pandora]);
+    PointingClusterCache::iterator iter(pointingClusterCache.find(cacheKey));
+
+    if (pointingClusterCache.end() != iter)
+    {
+        if (iter->second.first == clusterState)
+            return iter->second.second;
+
+        LArSlidingFitCacheHelper::ReleaseCacheEntry(pandora, LArMemoryAccountingHelper::GetNodeBytes<PointingClusterCache::value_type>());
+        pointingClusterCache.erase(iter);
+    }
+
+    LArSlidingFitCacheHelper::AccountCacheEntry(pandora, LArMemoryAccountingHelper::GetNodeBytes<PointingClusterCache::value_type>());
+    return pointingClusterCache.insert(PointingClusterCache::value_type(cacheKey, PointingClusterCacheEntry(clusterState, pointingCluster)))
+        .first->second.second;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArSlidingFitCacheHelper::Reset(const Pandora &pandora)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_pandoraToSlidingFitCacheMap.erase(&pandora);
+    m_pandoraToPointingClusterCacheMap.erase(&pandora);
+
+    PandoraToByteCountMap::iterator iter(m_pandoraToAccountedBytesMap.find(&pandora));
+
+    if (m_pandoraToAccountedBytesMap.end() != iter)
+    {
+        m_memoryRecord.Deallocate(iter->second);
+        m_pandoraToAccountedBytesMap.erase(iter);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArSlidingFitCacheHelper::AccountCacheEntry(const Pandora &pandora, const std::size_t nBytes)
+{
+    if (!LArMemoryAccountingHelper::IsAccountingEnabled())
+        return;
+
+    m_memoryRecord.Allocate(nBytes);
+    m_pandoraToAccountedBytesMap[&pandora] += nBytes;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArSlidingFitCacheHelper::ReleaseCacheEntry(const Pandora &pandora, const std::size_t nBytes)
+{
+    PandoraToByteCountMap::iterator iter(m_pandoraToAccountedBytesMap.find(&pandora));
+
+    if (m_pandoraToAccountedBytesMap.end() == iter)
+        return;
+
+    const std::size_t releasedBytes(std::min(nBytes, iter->second));
+    m_memoryRecord.Deallocate(releasedBytes);
+    iter->second -= releasedBytes;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+std::size_t LArSlidingFitCacheHelper::GetEstimatedBytes(const TwoDSlidingFitResult &slidingFitResult)
+{
+    const std::size_t layerFitResultBytes(LArMemoryAccountingHelper::GetNodeBytes<LayerFitResultMap::value_type>());
+    const std::size_t layerFitContributionBytes(LArMemoryAccountingHelper::GetNodeBytes<LayerFitContributionMap::value_type>());
+
+    return (LArMemoryAccountingHelper::GetNodeBytes<SlidingFitCache::value_type>() +
+        slidingFitResult.GetLayerFitResultMap().size() * layerFitResultBytes +
+        slidingFitResult.GetLayerFitContributionMap().size() * layerFitContributionBytes +
+        slidingFitResult.GetFitSegmentList().size() * sizeof(FitSegment));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArSlidingFitCacheHelper::ClusterState::ClusterState(const Cluster *const pCluster) :
+    m_nCaloHits(pCluster->GetNCaloHits()),
+    m_innerLayer(pCluster->GetNCaloHits() > 0 ? pCluster->GetInnerPseudoLayer() : 0),
+    m_outerLayer(pCluster->GetNCaloHits() > 0 ? pCluster->GetOuterPseudoLayer() : 0),
+    m_electromagneticEnergy(pCluster->GetElectromagneticEnergy()),
+    m_hadronicEnergy(pCluster->GetHadronicEnergy()),
+    m_hitSignature(0)
+{
+    // ATTN Summed over the calo hit addresses, so that a new cluster created at the address of a deleted cluster is recognised
+    const std::hash<const CaloHit *> caloHitHash;
+
+    for (const OrderedCaloHitList::value_type &layerEntry : pCluster->GetOrderedCaloHitList())
+    {
+        for (const CaloHit *const pCaloHit : *layerEntry.second)
+            m_hitSignature += caloHitHash(pCaloHit);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool LArSlidingFitCacheHelper::ClusterState::operator==(const ClusterState &rhs) const
+{
+    return ((m_nCaloHits == rhs.m_nCaloHits) && (m_innerLayer == rhs.m_innerLayer) && (m_outerLayer == rhs.m_outerLayer) &&
+        (m_electromagneticEnergy == rhs.m_electromagneticEnergy) && (m_hadronicEnergy == rhs.m_hadronicEnergy) &&
+        (m_hitSignature == rhs.m_hitSignature));
+}
+
+} // namespace lar_content
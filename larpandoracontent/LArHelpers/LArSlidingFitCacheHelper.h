@@ -0,0 +1,148 @@
+/**
+ *  @file   larpandoracontent/LArHelpers/LArSlidingFitCacheHelper.h
+ *
+ *  @brief  Header file for the sliding fit cache helper class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_SLIDING_FIT_CACHE_HELPER_H
+#define LAR_SLIDING_FIT_CACHE_HELPER_H 1
+
+#include "larpandoracontent/LArHelpers/LArMemoryAccountingHelper.h"
+
+#include "larpandoracontent/LArObjects/LArPointingCluster.h"
+#include "larpandoracontent/LArObjects/LArTwoDSlidingFitResult.h"
+
+#include <map>
+#include <mutex>
+#include <tuple>
+#include <unordered_map>
+
+namespace lar_content
+{
+
+/**
+ *  @brief  LArSlidingFitCacheHelper class, sharing sliding fit results and pointing clusters between algorithms within an event
+ */
+class LArSlidingFitCacheHelper
+{
+public:
+    /**
+     *  @brief  ClusterState class, summarising the cluster properties used to identify modified clusters
+     */
+    class ClusterState
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  pCluster the address of the cluster
+         */
+        ClusterState(const pandora::Cluster *const pCluster);
+
+        /**
+         *  @brief  Equality operator
+         *
+         *  @param  rhs the cluster state for comparison
+         *
+         *  @return whether the cluster states are identical
+         */
+        bool operator==(const ClusterState &rhs) const;
+
+    private:
+        unsigned int m_nCaloHits;      ///< The number of calo hits
+        unsigned int m_innerLayer;     ///< The inner pseudo layer
+        unsigned int m_outerLayer;     ///< The outer pseudo layer
+        float m_electromagneticEnergy; ///< The electromagnetic energy
+        float m_hadronicEnergy;        ///< The hadronic energy
+        std::size_t m_hitSignature;    ///< The sum of the hashed calo hit addresses
+    };
+
+    /**
+     *  @brief  Get the sliding fit result for a cluster, using a cached result if one was previously calculated for the same cluster,
+     *          layer fit half window and layer pitch. Cached results are discarded if the cluster has since been modified, as judged
+     *          by its number of hits, pseudo layer range, energy and calo hit addresses, or if the cluster address has been reused. The fit
+     *          is calculated without holding the cache lock.
+     *
+     *  @param  pandora the pandora instance
+     *  @param  pCluster the address of the cluster
+     *  @param  layerFitHalfWindow the layer fit half window
+     *  @param  layerPitch the layer pitch, units cm
+     *
+     *  @return the sliding fit result, valid until the cluster is next modified or the cache is reset
+     *
+     *  @throw  StatusCodeException if the sliding fit cannot be calculated
+     */
+    static const TwoDSlidingFitResult &GetSlidingFitResult(const pandora::Pandora &pandora, const pandora::Cluster *const pCluster,
+        const unsigned int layerFitHalfWindow, const float layerPitch);
+
+    /**
+     *  @brief  Get the pointing cluster for a two or three dimensional cluster, using a cached result if one was previously calculated for
+     *          the same cluster, layer fit half window and layer pitch. Cached results are discarded under the same conditions as sliding
+     *          fit results. Two dimensional pointing clusters are built from the cached sliding fit results.
+     *
+     *  @param  pandora the pandora instance
+     *  @param  pCluster the address of the cluster
+     *  @param  layerFitHalfWindow the layer fit half window
+     *  @param  layerPitch the layer pitch, units cm
+     *
+     *  @return the pointing cluster, valid until the cluster is next modified or the cache is reset
+     *
+     *  @throw  StatusCodeException if the pointing cluster cannot be calculated
+     */
+    static const LArPointingCluster &GetPointingCluster(const pandora::Pandora &pandora, const pandora::Cluster *const pCluster,
+        const unsigned int layerFitHalfWindow, const float layerPitch);
+
+    /**
+     *  @brief  Remove all cached sliding fit results and pointing clusters for a pandora instance, to be called at the end of each event
+     *          in every pandora instance using the cache, e.g. from the pre processing algorithm or the master algorithm reset
+     *
+     *  @param  pandora the pandora instance
+     */
+    static void Reset(const pandora::Pandora &pandora);
+
+private:
+    /**
+     *  @brief  Account the estimated memory of a new cache entry, if memory accounting is enabled, assuming the lock is held
+     *
+     *  @param  pandora the pandora instance
+     *  @param  nBytes the estimated number of bytes
+     */
+    static void AccountCacheEntry(const pandora::Pandora &pandora, const std::size_t nBytes);
+
+    /**
+     *  @brief  Release the estimated memory of a removed cache entry, assuming the lock is held
+     *
+     *  @param  pandora the pandora instance
+     *  @param  nBytes the estimated number of bytes
+     */
+    static void ReleaseCacheEntry(const pandora::Pandora &pandora, const std::size_t nBytes);
+
+    /**
+     *  @brief  Get the estimated memory of a sliding fit cache entry
+     *
+     *  @param  slidingFitResult the sliding fit result
+     *
+     *  @return the estimated number of bytes
+     */
+    static std::size_t GetEstimatedBytes(const TwoDSlidingFitResult &slidingFitResult);
+
+    typedef std::tuple<const pandora::Cluster *, unsigned int, float> CacheKey;
+    typedef std::pair<ClusterState, TwoDSlidingFitResult> CacheEntry;
+    typedef std::map<CacheKey, CacheEntry> SlidingFitCache;
+    typedef std::unordered_map<const pandora::Pandora *, SlidingFitCache> PandoraToSlidingFitCacheMap;
+    typedef std::pair<ClusterState, LArPointingCluster> PointingClusterCacheEntry;
+    typedef std::map<CacheKey, PointingClusterCacheEntry> PointingClusterCache;
+    typedef std::unordered_map<const pandora::Pandora *, PointingClusterCache> PandoraToPointingClusterCacheMap;
+    typedef std::unordered_map<const pandora::Pandora *, std::size_t> PandoraToByteCountMap;
+
+    static PandoraToSlidingFitCacheMap m_pandoraToSlidingFitCacheMap;           ///< The sliding fit cache for each pandora instance
+    static PandoraToPointingClusterCacheMap m_pandoraToPointingClusterCacheMap; ///< The pointing cluster cache for each pandora instance
+    static PandoraToByteCountMap m_pandoraToAccountedBytesMap;                  ///< The accounted cache memory for each pandora instance
+    static LArMemoryAccountingHelper::MemoryRecord m_memoryRecord;              ///< The memory accounting record for all caches
+    static std::mutex m_mutex;                                                  ///< The mutex protecting the caches
+};
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_SLIDING_FIT_CACHE_HELPER_H
@@ -0,0 +1,65 @@
+/**
+ *  @file   larpandoracontent/LArHelpers/LArSpatialIndexHelper.cc
+ *
+ *  @brief  Implementation of the spatial index helper class.
+ *
+ *  $Log: $
+ */
+
+#include "Pandora/AlgorithmHeaders.h"
+
+#include "larpandoracontent/LArHelpers/LArSpatialIndexHelper.h"
+
+using namespace pandora;
+
+namespace lar_content
+{
+
+LArSpatialIndexHelper::PandoraToSpatialIndexCacheMap LArSpatialIndexHelper::m_pandoraToSpatialIndexCacheMap;
+std::mutex LArSpatialIndexHelper::m_mutex;
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArSpatialIndexHelper::HitKDTree2D &LArSpatialIndexHelper::GetHitKDTree2D(
+    const Algorithm &algorithm, const std::string &caloHitListName, const HitType hitType)
+{
+    const CaloHitList *pCaloHitList(nullptr);
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::GetList(algorithm, caloHitListName, pCaloHitList));
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    CacheEntry &cacheEntry(m_pandoraToSpatialIndexCacheMap[&algorithm.GetPandora()][CacheKey(caloHitListName, hitType)]);
+
+    if (cacheEntry.m_pKDTree && (cacheEntry.m_pCaloHitList == pCaloHitList) && (cacheEntry.m_nCaloHits == pCaloHitList->size()))
+        return *cacheEntry.m_pKDTree;
+
+    CaloHitList viewCaloHitList;
+
+    for (const CaloHit *const pCaloHit : *pCaloHitList)
+    {
+        if (hitType == pCaloHit->GetHitType())
+            viewCaloHitList.push_back(pCaloHit);
+    }
+
+    cacheEntry.m_pCaloHitList = pCaloHitList;
+    cacheEntry.m_nCaloHits = pCaloHitList->size();
+    cacheEntry.m_pKDTree.reset(new HitKDTree2D);
+
+    if (!viewCaloHitList.empty())
+    {
+        std::vector<KDTreeNodeInfoT<const CaloHit *, 2>> hitKDNode2DList;
+        KDTreeBox hitsBoundingRegion2D(fill_and_bound_2d_kd_tree(viewCaloHitList, hitKDNode2DList));
+        cacheEntry.m_pKDTree->build(hitKDNode2DList, hitsBoundingRegion2D);
+    }
+
+    return *cacheEntry.m_pKDTree;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArSpatialIndexHelper::Reset(const Pandora &pandora)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_pandoraToSpatialIndexCacheMap.erase(&pandora);
+}
+
+} // namespace lar_content
@@ -0,0 +1,81 @@
+/**
+ *  @file   larpandoracontent/LArHelpers/LArSpatialIndexHelper.h
+ *
+ *  @brief  Header file for the spatial index helper class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_SPATIAL_INDEX_HELPER_H
+#define LAR_SPATIAL_INDEX_HELPER_H 1
+
+#include "larpandoracontent/LArUtility/KDTreeLinkerAlgoT.h"
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace pandora
+{
+class Algorithm;
+} // namespace pandora
+
+namespace lar_content
+{
+
+/**
+ *  @brief  LArSpatialIndexHelper class, sharing 2D kd trees of named calo hit lists between algorithms within an event
+ */
+class LArSpatialIndexHelper
+{
+public:
+    typedef KDTreeLinkerAlgo<const pandora::CaloHit *, 2> HitKDTree2D;
+
+    /**
+     *  @brief  Get the 2D kd tree for the hits of a given view in a named calo hit list, using a cached kd tree if one was previously
+     *          built for the same list and view. Cached kd trees are rebuilt if the list has since been replaced or its number of hits
+     *          has changed. Intended for the per-view calo hit lists, which are fixed once pre-processing is complete.
+     *
+     *  @param  algorithm the algorithm requesting the kd tree
+     *  @param  caloHitListName the name of the calo hit list
+     *  @param  hitType the view
+     *
+     *  @return the kd tree, valid until the list is next modified or the cache is reset
+     *
+     *  @throw  StatusCodeException if the calo hit list cannot be accessed
+     */
+    static HitKDTree2D &GetHitKDTree2D(
+        const pandora::Algorithm &algorithm, const std::string &caloHitListName, const pandora::HitType hitType);
+
+    /**
+     *  @brief  Remove all cached kd trees for a pandora instance, to be called at the end of each event
+     *
+     *  @param  pandora the pandora instance
+     */
+    static void Reset(const pandora::Pandora &pandora);
+
+private:
+    /**
+     *  @brief  CacheEntry class, a cached kd tree and the properties of the calo hit list from which it was built
+     */
+    class CacheEntry
+    {
+    public:
+        const pandora::CaloHitList *m_pCaloHitList; ///< The address of the calo hit list
+        unsigned int m_nCaloHits;                   ///< The number of hits in the calo hit list
+        std::unique_ptr<HitKDTree2D> m_pKDTree;     ///< The kd tree
+    };
+
+    typedef std::pair<std::string, pandora::HitType> CacheKey;
+    typedef std::map<CacheKey, CacheEntry> SpatialIndexCache;
+    typedef std::unordered_map<const pandora::Pandora *, SpatialIndexCache> PandoraToSpatialIndexCacheMap;
+
+    static PandoraToSpatialIndexCacheMap m_pandoraToSpatialIndexCacheMap; ///< The spatial index cache for each pandora instance
+    static std::mutex m_mutex;                                            ///< The mutex protecting the spatial index caches
+};
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_SPATIAL_INDEX_HELPER_H
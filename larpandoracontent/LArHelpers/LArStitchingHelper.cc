@@ -12,6 +12,8 @@
 
 #include "larpandoracontent/LArHelpers/LArStitchingHelper.h"
 
+#include "larpandoracontent/LArObjects/LArTPCAdjacencyGraph.h"
+
 #include <cmath>
 #include <limits>
 
@@ -20,48 +22,35 @@ using namespace pandora;
 namespace lar_content
 {
 
+LArStitchingHelper::PandoraToTPCAdjacencyGraphMap LArStitchingHelper::m_pandoraToTPCAdjacencyGraphMap;
+std::mutex LArStitchingHelper::m_tpcAdjacencyGraphMutex;
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 const LArTPC &LArStitchingHelper::FindClosestTPC(const Pandora &pandora, const LArTPC &inputTPC, const bool checkPositive)
 {
-    if (!MultiPandoraApi::GetPandoraInstanceMap().count(&pandora))
+    if (!MultiPandoraApi::IsPrimaryPandoraInstance(&pandora))
     {
         std::cout << "LArStitchingHelper::FindClosestTPC - functionality only available to primary/master Pandora instance " << std::endl;
         throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
     }
 
-    const LArTPCMap &larTPCMap(pandora.GetGeometry()->GetLArTPCMap());
-
-    const LArTPC *pClosestTPC(nullptr);
-    float closestSeparation(std::numeric_limits<float>::max());
-    const float maxDisplacement(30.f); // TODO: 30cm should be fine, but can we do better than a hard-coded number here?
-
-    for (const LArTPCMap::value_type &mapEntry : larTPCMap)
-    {
-        const LArTPC &checkTPC(*(mapEntry.second));
-
-        if (&inputTPC == &checkTPC)
-            continue;
-
-        if (checkPositive != (checkTPC.GetCenterX() > inputTPC.GetCenterX()))
-            continue;
+    return LArStitchingHelper::GetTPCAdjacencyGraph(pandora).GetClosestTPC(inputTPC, checkPositive);
+}
 
-        const float deltaX(std::fabs(checkTPC.GetCenterX() - inputTPC.GetCenterX()));
-        const float deltaY(std::fabs(checkTPC.GetCenterY() - inputTPC.GetCenterY()));
-        const float deltaZ(std::fabs(checkTPC.GetCenterZ() - inputTPC.GetCenterZ()));
+//------------------------------------------------------------------------------------------------------------------------------------------
 
-        if (deltaY > maxDisplacement || deltaZ > maxDisplacement)
-            continue;
+const TPCAdjacencyGraph &LArStitchingHelper::GetTPCAdjacencyGraph(const Pandora &pandora)
+{
+    const LArTPCMap &larTPCMap(pandora.GetGeometry()->GetLArTPCMap());
 
-        if (deltaX < closestSeparation)
-        {
-            closestSeparation = deltaX;
-            pClosestTPC = &checkTPC;
-        }
-    }
+    std::lock_guard<std::mutex> lock(m_tpcAdjacencyGraphMutex);
+    std::unique_ptr<const TPCAdjacencyGraph> &pTPCAdjacencyGraph(m_pandoraToTPCAdjacencyGraphMap[&pandora]);
 
-    if (!pClosestTPC)
-        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
+    if (!pTPCAdjacencyGraph || !pTPCAdjacencyGraph->IsConsistent(larTPCMap))
+        pTPCAdjacencyGraph.reset(new TPCAdjacencyGraph(larTPCMap));
 
-    return (*pClosestTPC);
+    return *pTPCAdjacencyGraph;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -14,9 +14,15 @@
 
 #include "larpandoracontent/LArObjects/LArPointingCluster.h"
 
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
 namespace lar_content
 {
 
+class TPCAdjacencyGraph;
+
 /**
  *  @brief  LArStitchingHelper class
  */
@@ -34,6 +40,16 @@ public:
      */
     static const pandora::LArTPC &FindClosestTPC(const pandora::Pandora &pandora, const pandora::LArTPC &inputTPC, const bool checkPositive);
 
+    /**
+     *  @brief  Get the tpc adjacency graph for a pandora instance, building it on first use and rebuilding it if the lar tpc map has since
+     *          changed. The graph answers the tpc pair queries below without comparing tpc geometries.
+     *
+     *  @param  pandora the pandora instance
+     *
+     *  @return the tpc adjacency graph
+     */
+    static const TPCAdjacencyGraph &GetTPCAdjacencyGraph(const pandora::Pandora &pandora);
+
     /**
      *  @brief  Whether particles from a given pair of tpcs can be stitched together
      *
@@ -144,6 +160,12 @@ public:
      *  @param  pPfo the address of the Pfo
      */
     static float GetPfoX0(const pandora::ParticleFlowObject *const pPfo);
+
+private:
+    typedef std::unordered_map<const pandora::Pandora *, std::unique_ptr<const TPCAdjacencyGraph>> PandoraToTPCAdjacencyGraphMap;
+
+    static PandoraToTPCAdjacencyGraphMap m_pandoraToTPCAdjacencyGraphMap; ///< The tpc adjacency graph for each pandora instance
+    static std::mutex m_tpcAdjacencyGraphMutex;                           ///< The mutex protecting the tpc adjacency graphs
 };
 
 } // namespace lar_content
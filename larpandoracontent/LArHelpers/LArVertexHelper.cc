@@ -14,6 +14,8 @@
 #include "larpandoracontent/LArHelpers/LArPointingClusterHelper.h"
 #include "larpandoracontent/LArHelpers/LArVertexHelper.h"
 
+#include "larpandoracontent/LArObjects/LArTPCVolumeIndex.h"
+
 #include <algorithm>
 #include <limits>
 
@@ -74,23 +76,11 @@ bool LArVertexHelper::IsInFiducialVolume(const Pandora &pandora, const Cartesian
         throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
     }
 
-    float tpcMinX{std::numeric_limits<float>::max()}, tpcMaxX{-std::numeric_limits<float>::max()};
-    float tpcMinY{std::numeric_limits<float>::max()}, tpcMaxY{-std::numeric_limits<float>::max()};
-    float tpcMinZ{std::numeric_limits<float>::max()}, tpcMaxZ{-std::numeric_limits<float>::max()};
-
-    for (const auto &[volumeId, pLArTPC] : larTPCMap)
-    {
-        (void)volumeId;
-        const float centreX{pLArTPC->GetCenterX()}, halfWidthX{0.5f * pLArTPC->GetWidthX()};
-        const float centreY{pLArTPC->GetCenterY()}, halfWidthY{0.5f * pLArTPC->GetWidthY()};
-        const float centreZ{pLArTPC->GetCenterZ()}, halfWidthZ{0.5f * pLArTPC->GetWidthZ()};
-        tpcMinX = std::min(tpcMinX, centreX - halfWidthX);
-        tpcMaxX = std::max(tpcMaxX, centreX + halfWidthX);
-        tpcMinY = std::min(tpcMinY, centreY - halfWidthY);
-        tpcMaxY = std::max(tpcMaxY, centreY + halfWidthY);
-        tpcMinZ = std::min(tpcMinZ, centreZ - halfWidthZ);
-        tpcMaxZ = std::max(tpcMaxZ, centreZ + halfWidthZ);
-    }
+    const std::shared_ptr<const TPCVolumeIndex> pTPCVolumeIndex(LArGeometryHelper::GetTPCVolumeIndex(pandora));
+    const CartesianVector &tpcMin(pTPCVolumeIndex->GetMinCoordinates()), &tpcMax(pTPCVolumeIndex->GetMaxCoordinates());
+    const float tpcMinX{tpcMin.GetX()}, tpcMaxX{tpcMax.GetX()};
+    const float tpcMinY{tpcMin.GetY()}, tpcMaxY{tpcMax.GetY()};
+    const float tpcMinZ{tpcMin.GetZ()}, tpcMaxZ{tpcMax.GetZ()};
 
     if (detector == "dune_fd_hd")
     {
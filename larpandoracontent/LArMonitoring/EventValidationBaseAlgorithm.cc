@@ -9,18 +9,25 @@
 #include "Pandora/AlgorithmHeaders.h"
 
 #include "larpandoracontent/LArHelpers/LArInteractionTypeHelper.h"
+#include "larpandoracontent/LArHelpers/LArMCHierarchySnapshotHelper.h"
 #include "larpandoracontent/LArHelpers/LArMonitoringHelper.h"
 #include "larpandoracontent/LArHelpers/LArPfoHelper.h"
 
 #include "larpandoracontent/LArMonitoring/EventValidationBaseAlgorithm.h"
 
 #include <sstream>
+#include <typeinfo>
 
 using namespace pandora;
 
 namespace lar_content
 {
 
+EventValidationBaseAlgorithm::PandoraToValidationInfoCacheMap EventValidationBaseAlgorithm::m_pandoraToValidationInfoCacheMap;
+std::mutex EventValidationBaseAlgorithm::m_validationInfoCacheMutex;
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 EventValidationBaseAlgorithm::EventValidationBaseAlgorithm() :
     m_fileIdentifier(0),
     m_eventNumber(0),
@@ -30,7 +37,8 @@ EventValidationBaseAlgorithm::EventValidationBaseAlgorithm() :
     m_useSmallPrimaries(true),
     m_matchingMinSharedHits(5),
     m_matchingMinCompleteness(0.1f),
-    m_matchingMinPurity(0.5f)
+    m_matchingMinPurity(0.5f),
+    m_shareValidationInfo(false)
 {
 }
 
@@ -53,6 +61,18 @@ EventValidationBaseAlgorithm::~EventValidationBaseAlgorithm()
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode EventValidationBaseAlgorithm::Reset()
+{
+    LArMCHierarchySnapshotHelper::Reset(this->GetPandora());
+
+    const std::lock_guard<std::mutex> lock(m_validationInfoCacheMutex);
+    m_pandoraToValidationInfoCacheMap.erase(&this->GetPandora());
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode EventValidationBaseAlgorithm::Run()
 {
     ++m_eventNumber;
@@ -66,8 +86,8 @@ StatusCode EventValidationBaseAlgorithm::Run()
     const PfoList *pPfoList = nullptr;
     (void)PandoraContentApi::GetList(*this, m_pfoListName, pPfoList);
 
-    ValidationInfo validationInfo;
-    this->FillValidationInfo(pMCParticleList, pCaloHitList, pPfoList, validationInfo);
+    ValidationInfo localValidationInfo;
+    const ValidationInfo &validationInfo(this->GetValidationInfo(pMCParticleList, pCaloHitList, pPfoList, localValidationInfo));
 
     if (m_printAllToScreen)
         this->PrintAllMatches(validationInfo);
@@ -83,6 +103,79 @@ StatusCode EventValidationBaseAlgorithm::Run()
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+const EventValidationBaseAlgorithm::ValidationInfo &EventValidationBaseAlgorithm::GetValidationInfo(
+    const MCParticleList *const pMCParticleList, const CaloHitList *const pCaloHitList, const PfoList *const pPfoList,
+    ValidationInfo &validationInfo) const
+{
+    if (!m_shareValidationInfo)
+    {
+        this->FillValidationInfo(pMCParticleList, pCaloHitList, pPfoList, validationInfo);
+        return validationInfo;
+    }
+
+    const std::string key(this->GetValidationInfoKey(pMCParticleList, pCaloHitList, pPfoList));
+
+    {
+        const std::lock_guard<std::mutex> lock(m_validationInfoCacheMutex);
+        const ValidationInfoCache &validationInfoCache(m_pandoraToValidationInfoCacheMap[&this->GetPandora()]);
+        const ValidationInfoCache::const_iterator iter(validationInfoCache.find(key));
+
+        if (validationInfoCache.end() != iter)
+            return iter->second;
+    }
+
+    // ATTN Fill without holding the lock, as only algorithms of this pandora instance, which run in turn, use its cache
+    this->FillValidationInfo(pMCParticleList, pCaloHitList, pPfoList, validationInfo);
+
+    const std::lock_guard<std::mutex> lock(m_validationInfoCacheMutex);
+    return m_pandoraToValidationInfoCacheMap[&this->GetPandora()].emplace(key, std::move(validationInfo)).first->second;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+std::string EventValidationBaseAlgorithm::GetValidationInfoKey(
+    const MCParticleList *const pMCParticleList, const CaloHitList *const pCaloHitList, const PfoList *const pPfoList) const
+{
+    std::ostringstream key;
+    key << typeid(*this).name() << ";" << pMCParticleList << ":" << (pMCParticleList ? pMCParticleList->size() : 0) << ";" << pCaloHitList
+        << ":" << (pCaloHitList ? pCaloHitList->size() : 0) << ";" << pPfoList << ";";
+
+    // ATTN Describe the pfo hierarchy, so that pfos modified between validation algorithms are not matched using stale validation info
+    if (pPfoList)
+    {
+        PfoList allConnectedPfos;
+        LArPfoHelper::GetAllConnectedPfos(*pPfoList, allConnectedPfos);
+
+        for (const ParticleFlowObject *const pPfo : allConnectedPfos)
+        {
+            unsigned int nCaloHits(0);
+
+            for (const Cluster *const pCluster : pPfo->GetClusterList())
+                nCaloHits += pCluster->GetNCaloHits() + pCluster->GetNIsolatedCaloHits();
+
+            key << pPfo << ":" << pPfo->GetDaughterPfoList().size() << ":" << nCaloHits << ",";
+        }
+    }
+
+    key << ";";
+    this->DescribeValidationSettings(key);
+
+    return key.str();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void EventValidationBaseAlgorithm::DescribeValidationSettings(std::ostream &stream) const
+{
+    stream << m_primaryParameters.m_minPrimaryGoodHits << ":" << m_primaryParameters.m_minHitsForGoodView << ":"
+           << m_primaryParameters.m_minPrimaryGoodViews << ":" << m_primaryParameters.m_selectInputHits << ":"
+           << m_primaryParameters.m_maxPhotonPropagation << ":" << m_primaryParameters.m_minHitSharingFraction << ":"
+           << m_primaryParameters.m_foldBackHierarchy << ":" << m_useSmallPrimaries << ":" << m_matchingMinSharedHits << ":"
+           << m_matchingMinCompleteness << ":" << m_matchingMinPurity;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void EventValidationBaseAlgorithm::InterpretMatching(
     const ValidationInfo &validationInfo, LArMCParticleHelper::MCParticleToPfoHitSharingMap &interpretedMCToPfoHitSharingMap) const
 {
@@ -257,6 +350,9 @@ StatusCode EventValidationBaseAlgorithm::ReadSettings(const TiXmlHandle xmlHandl
     PANDORA_RETURN_RESULT_IF_AND_IF(
         STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "MatchingMinPurity", m_matchingMinPurity));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "ShareValidationInfo", m_shareValidationInfo));
+
     if (m_writeToTree)
     {
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "OutputTree", m_treeName));
@@ -17,6 +17,10 @@
 #endif
 
 #include <map>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <unordered_map>
 
 namespace lar_content
 {
@@ -187,6 +191,14 @@ protected:
      */
     bool IsGoodMatch(const pandora::CaloHitList &trueHits, const pandora::CaloHitList &recoHits, const pandora::CaloHitList &sharedHits) const;
 
+    /**
+     *  @brief  Describe the settings on which the validation info depends. Algorithms of the same type with the same description fill
+     *          identical validation info from the same input lists, so may share it within an event.
+     *
+     *  @param  stream to receive the description
+     */
+    virtual void DescribeValidationSettings(std::ostream &stream) const;
+
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
     LArMCParticleHelper::PrimaryParameters m_primaryParameters; ///< The mc particle primary selection parameters
@@ -196,8 +208,38 @@ protected:
     std::string m_treeName; ///< Name of output tree
 
 private:
+    typedef std::map<std::string, ValidationInfo> ValidationInfoCache;
+    typedef std::unordered_map<const pandora::Pandora *, ValidationInfoCache> PandoraToValidationInfoCacheMap;
+
+    pandora::StatusCode Reset();
     pandora::StatusCode Run();
 
+    /**
+     *  @brief  Get the validation info for the input lists. If sharing is enabled, the validation info filled earlier in the event by
+     *          an algorithm with the same settings and unchanged input lists is reused, otherwise it is filled and offered for reuse.
+     *
+     *  @param  pMCParticleList the address of the mc particle list
+     *  @param  pCaloHitList the address of the calo hit list
+     *  @param  pPfoList the address of the pfo list
+     *  @param  validationInfo the validation info to fill, if it cannot be reused
+     *
+     *  @return the validation info
+     */
+    const ValidationInfo &GetValidationInfo(const pandora::MCParticleList *const pMCParticleList,
+        const pandora::CaloHitList *const pCaloHitList, const pandora::PfoList *const pPfoList, ValidationInfo &validationInfo) const;
+
+    /**
+     *  @brief  Get the key identifying shareable validation info, from the algorithm type and settings and the state of the input lists
+     *
+     *  @param  pMCParticleList the address of the mc particle list
+     *  @param  pCaloHitList the address of the calo hit list
+     *  @param  pPfoList the address of the pfo list
+     *
+     *  @return the key
+     */
+    std::string GetValidationInfoKey(const pandora::MCParticleList *const pMCParticleList, const pandora::CaloHitList *const pCaloHitList,
+        const pandora::PfoList *const pPfoList) const;
+
     /**
      *  @brief  Print all/raw matching information to screen
      *
@@ -233,6 +275,11 @@ private:
     float m_matchingMinPurity;            ///< The minimum particle purity to declare a match
 
     std::string m_fileName; ///< Name of output file
+
+    bool m_shareValidationInfo; ///< Whether to share validation info with algorithms of the same settings and inputs in the event
+
+    static PandoraToValidationInfoCacheMap m_pandoraToValidationInfoCacheMap; ///< The shared validation info for each pandora instance
+    static std::mutex m_validationInfoCacheMutex;                             ///< The mutex protecting the shared validation info
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
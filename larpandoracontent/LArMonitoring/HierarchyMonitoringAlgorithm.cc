@@ -10,6 +10,8 @@
 
 #include "larpandoracontent/LArMonitoring/HierarchyMonitoringAlgorithm.h"
 
+#include "larpandoracontent/LArHelpers/LArMonitoringHelper.h"
+
 using namespace pandora;
 
 namespace lar_content
@@ -34,13 +36,22 @@ HierarchyMonitoringAlgorithm::HierarchyMonitoringAlgorithm() :
 
 HierarchyMonitoringAlgorithm::~HierarchyMonitoringAlgorithm()
 {
-    PANDORA_MONITORING_API(SaveTree(this->GetPandora(), "processes", "processes.root", "UPDATE"));
+    if (LArMonitoringHelper::IsMonitoringEnabled())
+    {
+        PANDORA_MONITORING_API(SaveTree(this->GetPandora(), "processes", "processes.root", "UPDATE"));
+    }
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 StatusCode HierarchyMonitoringAlgorithm::Run()
 {
+    // ATTN Without monitoring, only the printed match table remains to be produced
+    const bool isMonitoringEnabled(LArMonitoringHelper::IsMonitoringEnabled());
+
+    if (!isMonitoringEnabled && !m_match)
+        return STATUS_CODE_SUCCESS;
+
     PANDORA_MONITORING_API(
         SetEveDisplayParameters(this->GetPandora(), true, DETECTOR_VIEW_XZ, m_transparencyThresholdE, m_energyScaleThresholdE, m_scalingFactor));
 
@@ -69,7 +80,9 @@ StatusCode HierarchyMonitoringAlgorithm::Run()
         LArHierarchyHelper::MatchInfo matchInfo;
         LArHierarchyHelper::MatchHierarchies(mcHierarchy, recoHierarchy, matchInfo);
         matchInfo.Print(mcHierarchy);
-        this->VisualizeMatches(matchInfo);
+
+        if (isMonitoringEnabled)
+            this->VisualizeMatches(matchInfo);
     }
     else
     {
@@ -9,6 +9,7 @@
 #include "Pandora/AlgorithmHeaders.h"
 
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
+#include "larpandoracontent/LArHelpers/LArMCHierarchySnapshotHelper.h"
 #include "larpandoracontent/LArHelpers/LArMonitoringHelper.h"
 #include "larpandoracontent/LArHelpers/LArMuonLeadingHelper.h"
 #include "larpandoracontent/LArHelpers/LArPfoHelper.h"
@@ -102,12 +103,15 @@ void MuonLeadingEventValidationAlgorithm::PerformUnfoldedMatching(const MCPartic
 {
     if (pMCParticleList && pCaloHitList)
     {
+        const MCHierarchySnapshot &mcHierarchySnapshot(
+            LArMCHierarchySnapshotHelper::GetMCHierarchySnapshot(this->GetPandora(), *pMCParticleList, *pCaloHitList));
+
         // Get reconstructable MCParticle hit ownership map (non-muon leading hierarchy is folded whilst muon is unfolded)
         LArMuonLeadingHelper::ValidationParameters validationParams(m_validationParameters);
         validationParams.m_minHitSharingFraction = minHitSharingFraction;
         LArMCParticleHelper::MCContributionMap targetMCParticleToHitsMap;
         LArMuonLeadingHelper::SelectReconstructableLeadingParticles(
-            pMCParticleList, pCaloHitList, validationParams, recoCosmicRayHitList, targetMCParticleToHitsMap);
+            mcHierarchySnapshot, pCaloHitList, validationParams, recoCosmicRayHitList, targetMCParticleToHitsMap);
 
         // Do not change the hit share fraction (these hits are classed as 'ambiguous' and should not be in the metrics)
         LArMuonLeadingHelper::ValidationParameters allValidationParams(m_validationParameters);
@@ -116,7 +120,7 @@ void MuonLeadingEventValidationAlgorithm::PerformUnfoldedMatching(const MCPartic
         allValidationParams.m_minHitSharingFraction = minHitSharingFraction;
         LArMCParticleHelper::MCContributionMap allMCParticleToHitsMap;
         LArMuonLeadingHelper::SelectReconstructableLeadingParticles(
-            pMCParticleList, pCaloHitList, allValidationParams, recoCosmicRayHitList, allMCParticleToHitsMap);
+            mcHierarchySnapshot, pCaloHitList, allValidationParams, recoCosmicRayHitList, allMCParticleToHitsMap);
 
         validationInfo.SetTargetMCParticleToHitsMap(targetMCParticleToHitsMap);
         validationInfo.SetAllMCParticleToHitsMap(allMCParticleToHitsMap);
@@ -907,6 +911,20 @@ void MuonLeadingEventValidationAlgorithm::GetHitsOfType(const CaloHitList &input
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void MuonLeadingEventValidationAlgorithm::DescribeValidationSettings(std::ostream &stream) const
+{
+    EventValidationBaseAlgorithm::DescribeValidationSettings(stream);
+
+    stream << ":" << m_validationParameters.m_minPrimaryGoodHits << ":" << m_validationParameters.m_minHitsForGoodView << ":"
+           << m_validationParameters.m_minPrimaryGoodViews << ":" << m_validationParameters.m_selectInputHits << ":"
+           << m_validationParameters.m_maxPhotonPropagation << ":" << m_validationParameters.m_minHitSharingFraction << ":"
+           << m_validationParameters.m_foldBackHierarchy << ":" << m_validationParameters.m_maxBremsstrahlungSeparation << ":"
+           << m_removeRecoCosmicRayHits << ":" << m_deltaRayMode << ":" << m_michelMode << ":" << m_visualize << ":"
+           << m_ignoreIncorrectCosmicRays;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode MuonLeadingEventValidationAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
 {
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
@@ -9,6 +9,7 @@
 #include "Pandora/AlgorithmHeaders.h"
 
 #include "larpandoracontent/LArHelpers/LArInteractionTypeHelper.h"
+#include "larpandoracontent/LArHelpers/LArMCHierarchySnapshotHelper.h"
 #include "larpandoracontent/LArHelpers/LArMonitoringHelper.h"
 #include "larpandoracontent/LArHelpers/LArPfoHelper.h"
 
@@ -38,12 +39,15 @@ void NeutrinoEventValidationAlgorithm::FillValidationInfo(const MCParticleList *
 {
     if (pMCParticleList && pCaloHitList)
     {
+        const MCHierarchySnapshot &mcHierarchySnapshot(
+            LArMCHierarchySnapshotHelper::GetMCHierarchySnapshot(this->GetPandora(), *pMCParticleList, *pCaloHitList));
+
         LArMCParticleHelper::MCContributionMap targetMCParticleToHitsMap;
         LArMCParticleHelper::SelectReconstructableMCParticles(
-            pMCParticleList, pCaloHitList, m_primaryParameters, LArMCParticleHelper::IsBeamNeutrinoFinalState, targetMCParticleToHitsMap);
+            mcHierarchySnapshot, pCaloHitList, m_primaryParameters, LArMCParticleHelper::IsBeamNeutrinoFinalState, targetMCParticleToHitsMap);
         if (!m_useTrueNeutrinosOnly)
             LArMCParticleHelper::SelectReconstructableMCParticles(
-                pMCParticleList, pCaloHitList, m_primaryParameters, LArMCParticleHelper::IsCosmicRay, targetMCParticleToHitsMap);
+                mcHierarchySnapshot, pCaloHitList, m_primaryParameters, LArMCParticleHelper::IsCosmicRay, targetMCParticleToHitsMap);
 
         LArMCParticleHelper::PrimaryParameters parameters(m_primaryParameters);
         parameters.m_minPrimaryGoodHits = 0;
@@ -51,10 +55,10 @@ void NeutrinoEventValidationAlgorithm::FillValidationInfo(const MCParticleList *
         parameters.m_minHitSharingFraction = 0.f;
         LArMCParticleHelper::MCContributionMap allMCParticleToHitsMap;
         LArMCParticleHelper::SelectReconstructableMCParticles(
-            pMCParticleList, pCaloHitList, parameters, LArMCParticleHelper::IsBeamNeutrinoFinalState, allMCParticleToHitsMap);
+            mcHierarchySnapshot, pCaloHitList, parameters, LArMCParticleHelper::IsBeamNeutrinoFinalState, allMCParticleToHitsMap);
         if (!m_useTrueNeutrinosOnly)
             LArMCParticleHelper::SelectReconstructableMCParticles(
-                pMCParticleList, pCaloHitList, parameters, LArMCParticleHelper::IsCosmicRay, allMCParticleToHitsMap);
+                mcHierarchySnapshot, pCaloHitList, parameters, LArMCParticleHelper::IsCosmicRay, allMCParticleToHitsMap);
 
         validationInfo.SetTargetMCParticleToHitsMap(targetMCParticleToHitsMap);
         validationInfo.SetAllMCParticleToHitsMap(allMCParticleToHitsMap);
@@ -515,6 +519,14 @@ void NeutrinoEventValidationAlgorithm::ProcessOutput(
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void NeutrinoEventValidationAlgorithm::DescribeValidationSettings(std::ostream &stream) const
+{
+    EventValidationBaseAlgorithm::DescribeValidationSettings(stream);
+    stream << ":" << m_useTrueNeutrinosOnly;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode NeutrinoEventValidationAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
 {
     PANDORA_RETURN_RESULT_IF_AND_IF(
@@ -9,6 +9,7 @@
 #include "Pandora/AlgorithmHeaders.h"
 
 #include "larpandoracontent/LArHelpers/LArInteractionTypeHelper.h"
+#include "larpandoracontent/LArHelpers/LArMCHierarchySnapshotHelper.h"
 #include "larpandoracontent/LArHelpers/LArMonitoringHelper.h"
 #include "larpandoracontent/LArHelpers/LArPfoHelper.h"
 
@@ -38,11 +39,14 @@ void TestBeamHierarchyEventValidationAlgorithm::FillValidationInfo(const MCParti
 {
     if (pMCParticleList && pCaloHitList)
     {
+        const MCHierarchySnapshot &mcHierarchySnapshot(
+            LArMCHierarchySnapshotHelper::GetMCHierarchySnapshot(this->GetPandora(), *pMCParticleList, *pCaloHitList));
+
         LArMCParticleHelper::MCContributionMap targetMCParticleToHitsMap;
         LArMCParticleHelper::SelectReconstructableTestBeamHierarchyMCParticles(
             pMCParticleList, pCaloHitList, m_primaryParameters, LArMCParticleHelper::IsLeadingBeamParticle, targetMCParticleToHitsMap);
         LArMCParticleHelper::SelectReconstructableMCParticles(
-            pMCParticleList, pCaloHitList, m_primaryParameters, LArMCParticleHelper::IsCosmicRay, targetMCParticleToHitsMap);
+            mcHierarchySnapshot, pCaloHitList, m_primaryParameters, LArMCParticleHelper::IsCosmicRay, targetMCParticleToHitsMap);
 
         LArMCParticleHelper::PrimaryParameters parameters(m_primaryParameters);
         parameters.m_minPrimaryGoodHits = 0;
@@ -52,7 +56,7 @@ void TestBeamHierarchyEventValidationAlgorithm::FillValidationInfo(const MCParti
         LArMCParticleHelper::SelectReconstructableTestBeamHierarchyMCParticles(
             pMCParticleList, pCaloHitList, parameters, LArMCParticleHelper::IsLeadingBeamParticle, allMCParticleToHitsMap);
         LArMCParticleHelper::SelectReconstructableMCParticles(
-            pMCParticleList, pCaloHitList, parameters, LArMCParticleHelper::IsCosmicRay, allMCParticleToHitsMap);
+            mcHierarchySnapshot, pCaloHitList, parameters, LArMCParticleHelper::IsCosmicRay, allMCParticleToHitsMap);
 
         validationInfo.SetTargetMCParticleToHitsMap(targetMCParticleToHitsMap);
         validationInfo.SetAllMCParticleToHitsMap(allMCParticleToHitsMap);
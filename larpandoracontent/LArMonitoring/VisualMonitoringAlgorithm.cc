@@ -10,11 +10,18 @@
 
 #include "larpandoracontent/LArMonitoring/VisualMonitoringAlgorithm.h"
 
+#include "larpandoracontent/LArHelpers/LArMonitoringHelper.h"
+
 using namespace pandora;
 
 namespace lar_content
 {
 
+VisualMonitoringAlgorithm::PandoraToDeferredVisualizationMap VisualMonitoringAlgorithm::m_pandoraToDeferredVisualizationMap;
+std::mutex VisualMonitoringAlgorithm::m_deferredVisualizationMutex;
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 VisualMonitoringAlgorithm::VisualMonitoringAlgorithm() :
     m_showCurrentMCParticles(false),
     m_showCurrentCaloHits(false),
@@ -34,7 +41,8 @@ VisualMonitoringAlgorithm::VisualMonitoringAlgorithm() :
     m_energyScaleThresholdE(1.f),
     m_scalingFactor(1.f),
     m_showPfoVertices(true),
-    m_showPfoHierarchy(true)
+    m_showPfoHierarchy(true),
+    m_deferVisualization(false)
 {
 }
 
@@ -42,80 +50,92 @@ VisualMonitoringAlgorithm::VisualMonitoringAlgorithm() :
 
 StatusCode VisualMonitoringAlgorithm::Run()
 {
-    PANDORA_MONITORING_API(SetEveDisplayParameters(this->GetPandora(), m_showDetector,
-        (m_detectorView.find("xz") != std::string::npos) ? DETECTOR_VIEW_XZ : (m_detectorView.find("xy") != std::string::npos) ? DETECTOR_VIEW_XY : DETECTOR_VIEW_DEFAULT,
-        m_transparencyThresholdE, m_energyScaleThresholdE, m_scalingFactor));
+    if (!LArMonitoringHelper::IsMonitoringEnabled())
+        return STATUS_CODE_SUCCESS;
+
+    if (m_displayEvent || !m_deferVisualization)
+    {
+        PANDORA_MONITORING_API(SetEveDisplayParameters(this->GetPandora(), m_showDetector,
+            (m_detectorView.find("xz") != std::string::npos)   ? DETECTOR_VIEW_XZ
+            : (m_detectorView.find("xy") != std::string::npos) ? DETECTOR_VIEW_XY
+                                                               : DETECTOR_VIEW_DEFAULT,
+            m_transparencyThresholdE, m_energyScaleThresholdE, m_scalingFactor));
+    }
+
+    // Visualize the lists recorded by deferring visual monitoring algorithms, before the event is displayed
+    if (m_displayEvent)
+        this->VisualizeDeferredLists();
 
     // Show current mc particles
     if (m_showCurrentMCParticles)
     {
-        this->VisualizeMCParticleList(std::string());
+        this->RequestVisualization(MC_PARTICLE_LIST, std::string());
     }
 
     // Show specified lists of mc particles
     for (StringVector::const_iterator iter = m_mcParticleListNames.begin(), iterEnd = m_mcParticleListNames.end(); iter != iterEnd; ++iter)
     {
-        this->VisualizeMCParticleList(*iter);
+        this->RequestVisualization(MC_PARTICLE_LIST, *iter);
     }
 
     // Show current calo hit list
     if (m_showCurrentCaloHits)
     {
-        this->VisualizeCaloHitList(std::string());
+        this->RequestVisualization(CALO_HIT_LIST, std::string());
     }
 
     // Show specified lists of calo hits
     for (StringVector::const_iterator iter = m_caloHitListNames.begin(), iterEnd = m_caloHitListNames.end(); iter != iterEnd; ++iter)
     {
-        this->VisualizeCaloHitList(*iter);
+        this->RequestVisualization(CALO_HIT_LIST, *iter);
     }
 
     // Show current cluster list
     if (m_showCurrentClusters)
     {
-        this->VisualizeClusterList(std::string());
+        this->RequestVisualization(CLUSTER_LIST, std::string());
     }
 
     // Show specified lists of clusters
     for (StringVector::const_iterator iter = m_clusterListNames.begin(), iterEnd = m_clusterListNames.end(); iter != iterEnd; ++iter)
     {
-        this->VisualizeClusterList(*iter);
+        this->RequestVisualization(CLUSTER_LIST, *iter);
     }
 
     // Show current track list
     if (m_showCurrentTracks)
     {
-        this->VisualizeTrackList(std::string());
+        this->RequestVisualization(TRACK_LIST, std::string());
     }
 
     // Show specified lists of tracks
     for (StringVector::const_iterator iter = m_trackListNames.begin(), iterEnd = m_trackListNames.end(); iter != iterEnd; ++iter)
     {
-        this->VisualizeTrackList(*iter);
+        this->RequestVisualization(TRACK_LIST, *iter);
     }
 
     // Show current particle flow objects
     if (m_showCurrentPfos)
     {
-        this->VisualizeParticleFlowList(std::string());
+        this->RequestVisualization(PFO_LIST, std::string());
     }
 
     // Show specified lists of pfo
     for (StringVector::const_iterator iter = m_pfoListNames.begin(), iterEnd = m_pfoListNames.end(); iter != iterEnd; ++iter)
     {
-        this->VisualizeParticleFlowList(*iter);
+        this->RequestVisualization(PFO_LIST, *iter);
     }
 
     // Show current vertex objects
     if (m_showCurrentVertices)
     {
-        this->VisualizeVertexList(std::string());
+        this->RequestVisualization(VERTEX_LIST, std::string());
     }
 
     // Show specified lists of vertices
     for (StringVector::const_iterator iter = m_vertexListNames.begin(), iterEnd = m_vertexListNames.end(); iter != iterEnd; ++iter)
     {
-        this->VisualizeVertexList(*iter);
+        this->RequestVisualization(VERTEX_LIST, *iter);
     }
 
     // Finally, display the event and pause application
@@ -134,6 +154,110 @@ StatusCode VisualMonitoringAlgorithm::Run()
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode VisualMonitoringAlgorithm::Reset()
+{
+    const std::lock_guard<std::mutex> lock(m_deferredVisualizationMutex);
+    m_pandoraToDeferredVisualizationMap.erase(&this->GetPandora());
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void VisualMonitoringAlgorithm::RequestVisualization(const ListType listType, const std::string &listName) const
+{
+    if (m_displayEvent || !m_deferVisualization)
+    {
+        this->VisualizeList(listType, listName);
+        return;
+    }
+
+    // ATTN Record the name of the current list, rather than its contents, as the current list will change before the event is displayed
+    std::string deferredListName(listName);
+
+    if (deferredListName.empty() && (STATUS_CODE_SUCCESS != this->GetCurrentListName(listType, deferredListName)))
+    {
+        if (PandoraContentApi::GetSettings(*this)->ShouldDisplayAlgorithmInfo())
+            std::cout << "VisualMonitoringAlgorithm: current list unavailable." << std::endl;
+        return;
+    }
+
+    const std::lock_guard<std::mutex> lock(m_deferredVisualizationMutex);
+    m_pandoraToDeferredVisualizationMap[&this->GetPandora()].emplace_back(this, listType, deferredListName);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void VisualMonitoringAlgorithm::VisualizeDeferredLists() const
+{
+    DeferredVisualizationVector deferredVisualizations;
+    {
+        const std::lock_guard<std::mutex> lock(m_deferredVisualizationMutex);
+        PandoraToDeferredVisualizationMap::iterator iter(m_pandoraToDeferredVisualizationMap.find(&this->GetPandora()));
+
+        if (m_pandoraToDeferredVisualizationMap.end() == iter)
+            return;
+
+        deferredVisualizations.swap(iter->second);
+        m_pandoraToDeferredVisualizationMap.erase(iter);
+    }
+
+    for (const DeferredVisualization &deferredVisualization : deferredVisualizations)
+        deferredVisualization.m_pAlgorithm->VisualizeList(deferredVisualization.m_listType, deferredVisualization.m_listName);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void VisualMonitoringAlgorithm::VisualizeList(const ListType listType, const std::string &listName) const
+{
+    switch (listType)
+    {
+        case MC_PARTICLE_LIST:
+            this->VisualizeMCParticleList(listName);
+            break;
+        case CALO_HIT_LIST:
+            this->VisualizeCaloHitList(listName);
+            break;
+        case TRACK_LIST:
+            this->VisualizeTrackList(listName);
+            break;
+        case CLUSTER_LIST:
+            this->VisualizeClusterList(listName);
+            break;
+        case PFO_LIST:
+            this->VisualizeParticleFlowList(listName);
+            break;
+        case VERTEX_LIST:
+            this->VisualizeVertexList(listName);
+            break;
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode VisualMonitoringAlgorithm::GetCurrentListName(const ListType listType, std::string &listName) const
+{
+    switch (listType)
+    {
+        case MC_PARTICLE_LIST:
+            return PandoraContentApi::GetCurrentListName<MCParticle>(*this, listName);
+        case CALO_HIT_LIST:
+            return PandoraContentApi::GetCurrentListName<CaloHit>(*this, listName);
+        case TRACK_LIST:
+            return PandoraContentApi::GetCurrentListName<Track>(*this, listName);
+        case CLUSTER_LIST:
+            return PandoraContentApi::GetCurrentListName<Cluster>(*this, listName);
+        case PFO_LIST:
+            return PandoraContentApi::GetCurrentListName<Pfo>(*this, listName);
+        case VERTEX_LIST:
+            return PandoraContentApi::GetCurrentListName<Vertex>(*this, listName);
+    }
+
+    return STATUS_CODE_INVALID_PARAMETER;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void VisualMonitoringAlgorithm::VisualizeMCParticleList(const std::string &listName) const
 {
     const MCParticleList *pMCParticleList = NULL;
@@ -428,6 +552,9 @@ StatusCode VisualMonitoringAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
     PANDORA_RETURN_RESULT_IF_AND_IF(
         STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "ShowPfoHierarchy", m_showPfoHierarchy));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "DeferVisualization", m_deferVisualization));
+
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
         XmlHelper::ReadVectorOfValues(xmlHandle, "SuppressMCParticles", m_suppressMCParticles));
 
@@ -453,4 +580,15 @@ StatusCode VisualMonitoringAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
     return STATUS_CODE_SUCCESS;
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+VisualMonitoringAlgorithm::DeferredVisualization::DeferredVisualization(
+    const VisualMonitoringAlgorithm *const pAlgorithm, const ListType listType, const std::string &listName) :
+    m_pAlgorithm(pAlgorithm),
+    m_listType(listType),
+    m_listName(listName)
+{
+}
+
 } // namespace lar_content
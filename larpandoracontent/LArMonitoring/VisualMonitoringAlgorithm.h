@@ -10,6 +10,9 @@
 
 #include "Pandora/Algorithm.h"
 
+#include <mutex>
+#include <unordered_map>
+
 namespace lar_content
 {
 
@@ -25,9 +28,77 @@ public:
     VisualMonitoringAlgorithm();
 
 private:
+    /**
+     *  @brief  ListType enumeration, identifying the type of a list to visualize
+     */
+    enum ListType
+    {
+        MC_PARTICLE_LIST,
+        CALO_HIT_LIST,
+        TRACK_LIST,
+        CLUSTER_LIST,
+        PFO_LIST,
+        VERTEX_LIST
+    };
+
+    /**
+     *  @brief  DeferredVisualization class, a lightweight reference to a list whose visualization has been deferred
+     */
+    class DeferredVisualization
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  pAlgorithm address of the visual monitoring algorithm whose settings will be used for the visualization
+         *  @param  listType the list type
+         *  @param  listName the list name
+         */
+        DeferredVisualization(const VisualMonitoringAlgorithm *const pAlgorithm, const ListType listType, const std::string &listName);
+
+        const VisualMonitoringAlgorithm *m_pAlgorithm; ///< The visual monitoring algorithm whose settings will be used
+        ListType m_listType;                           ///< The list type
+        std::string m_listName;                        ///< The list name
+    };
+
+    typedef std::vector<DeferredVisualization> DeferredVisualizationVector;
+    typedef std::unordered_map<const pandora::Pandora *, DeferredVisualizationVector> PandoraToDeferredVisualizationMap;
+
     pandora::StatusCode Run();
+    pandora::StatusCode Reset();
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
+    /**
+     *  @brief  Visualize a specified list, or defer its visualization until the event is displayed, if configured to do so
+     *
+     *  @param  listType the list type
+     *  @param  listName the list name, empty for the current list
+     */
+    void RequestVisualization(const ListType listType, const std::string &listName) const;
+
+    /**
+     *  @brief  Visualize the lists whose visualization was deferred, for this pandora instance, by any visual monitoring algorithm
+     */
+    void VisualizeDeferredLists() const;
+
+    /**
+     *  @brief  Visualize a specified list
+     *
+     *  @param  listType the list type
+     *  @param  listName the list name, empty for the current list
+     */
+    void VisualizeList(const ListType listType, const std::string &listName) const;
+
+    /**
+     *  @brief  Get the name of the current list of a specified type
+     *
+     *  @param  listType the list type
+     *  @param  listName to receive the list name
+     *
+     *  @return status code
+     */
+    pandora::StatusCode GetCurrentListName(const ListType listType, std::string &listName) const;
+
     /**
      *  @brief  Visualize mc particle list
      *
@@ -106,8 +177,13 @@ private:
     bool m_showPfoVertices;  ///< Whether to display pfo vertices
     bool m_showPfoHierarchy; ///< Whether to display daughter pfos only under parent pfo elements
 
+    bool m_deferVisualization; ///< Whether to only record the lists, if not displaying the event, and visualize them when it is displayed
+
     pandora::StringVector m_suppressMCParticles; ///< List of PDG numbers and energies for MC particles to be suppressed (e.g. " 22:0.1 2112:1.0 ")
     PdgCodeToEnergyMap m_particleSuppressionMap; ///< Map from pdg-codes to energy for suppression of particles types below specific energies
+
+    static PandoraToDeferredVisualizationMap m_pandoraToDeferredVisualizationMap; ///< The deferred visualizations for each pandora instance
+    static std::mutex m_deferredVisualizationMutex;                               ///< The mutex protecting the deferred visualizations
 };
 
 } // namespace lar_content
@@ -10,6 +10,7 @@
 
 #include "larpandoracontent/LArMonitoring/VisualParticleMonitoringAlgorithm.h"
 
+#include "larpandoracontent/LArHelpers/LArMonitoringHelper.h"
 #include "larpandoracontent/LArHelpers/LArPfoHelper.h"
 #include "larpandoracontent/LArObjects/LArCaloHit.h"
 #include "larpandoracontent/LArObjects/LArMCParticle.h"
@@ -43,6 +44,9 @@ VisualParticleMonitoringAlgorithm::~VisualParticleMonitoringAlgorithm()
 StatusCode VisualParticleMonitoringAlgorithm::Run()
 {
 #ifdef MONITORING
+    if (!LArMonitoringHelper::IsMonitoringEnabled())
+        return STATUS_CODE_SUCCESS;
+
     LArMCParticleHelper::MCContributionMap targetMCParticleToHitsMap;
     if (m_visualizeMC || m_showPfoMatchedMC)
     {
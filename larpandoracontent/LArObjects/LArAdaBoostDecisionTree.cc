@@ -8,6 +8,8 @@
 
 #include "Helpers/XmlHelper.h"
 
+#include "larpandoracontent/LArHelpers/LArFileHelper.h"
+
 #include "larpandoracontent/LArObjects/LArAdaBoostDecisionTree.h"
 
 using namespace pandora;
@@ -15,15 +17,19 @@ using namespace pandora;
 namespace lar_content
 {
 
+std::mutex AdaBoostDecisionTree::m_strongClassifierCacheMutex;
+AdaBoostDecisionTree::StrongClassifierCache AdaBoostDecisionTree::m_strongClassifierCache;
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 AdaBoostDecisionTree::AdaBoostDecisionTree() : m_pStrongClassifier(nullptr)
 {
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-AdaBoostDecisionTree::AdaBoostDecisionTree(const AdaBoostDecisionTree &rhs)
+AdaBoostDecisionTree::AdaBoostDecisionTree(const AdaBoostDecisionTree &rhs) : m_pStrongClassifier(rhs.m_pStrongClassifier)
 {
-    m_pStrongClassifier = new StrongClassifier(*(rhs.m_pStrongClassifier));
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -31,7 +37,7 @@ AdaBoostDecisionTree::AdaBoostDecisionTree(const AdaBoostDecisionTree &rhs)
 AdaBoostDecisionTree &AdaBoostDecisionTree::operator=(const AdaBoostDecisionTree &rhs)
 {
     if (this != &rhs)
-        m_pStrongClassifier = new StrongClassifier(*(rhs.m_pStrongClassifier));
+        m_pStrongClassifier = rhs.m_pStrongClassifier;
 
     return *this;
 }
@@ -40,7 +46,6 @@ AdaBoostDecisionTree &AdaBoostDecisionTree::operator=(const AdaBoostDecisionTree
 
 AdaBoostDecisionTree::~AdaBoostDecisionTree()
 {
-    delete m_pStrongClassifier;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -53,15 +58,28 @@ StatusCode AdaBoostDecisionTree::Initialize(const std::string &bdtXmlFileName, c
         return STATUS_CODE_ALREADY_INITIALIZED;
     }
 
-    TiXmlDocument xmlDocument(bdtXmlFileName);
+    const StrongClassifierKey strongClassifierKey(bdtXmlFileName, bdtName);
+
+    {
+        const std::lock_guard<std::mutex> lock(m_strongClassifierCacheMutex);
+        StrongClassifierCache::const_iterator iter(m_strongClassifierCache.find(strongClassifierKey));
+
+        if (m_strongClassifierCache.end() != iter)
+            m_pStrongClassifier = iter->second.lock();
+    }
+
+    if (m_pStrongClassifier)
+        return STATUS_CODE_SUCCESS;
 
-    if (!xmlDocument.LoadFile())
+    const std::shared_ptr<TiXmlDocument> pXmlDocument(LArFileHelper::LoadXmlDocument(bdtXmlFileName));
+
+    if (!pXmlDocument)
     {
         std::cout << "AdaBoostDecisionTree::Initialize - Invalid xml file." << std::endl;
         return STATUS_CODE_INVALID_PARAMETER;
     }
 
-    const TiXmlHandle xmlDocumentHandle(&xmlDocument);
+    const TiXmlHandle xmlDocumentHandle(pXmlDocument.get());
     TiXmlNode *pContainerXmlNode(TiXmlHandle(xmlDocumentHandle).FirstChildElement().Element());
 
     while (pContainerXmlNode)
@@ -96,11 +114,11 @@ StatusCode AdaBoostDecisionTree::Initialize(const std::string &bdtXmlFileName, c
 
     try
     {
-        m_pStrongClassifier = new StrongClassifier(&xmlHandle);
+        m_pStrongClassifier = std::shared_ptr<const StrongClassifier>(new StrongClassifier(&xmlHandle));
     }
     catch (StatusCodeException &statusCodeException)
     {
-        delete m_pStrongClassifier;
+        m_pStrongClassifier.reset();
 
         if (STATUS_CODE_INVALID_PARAMETER == statusCodeException.GetStatusCode())
             std::cout << "AdaBoostDecisionTree: Initialization failure, unknown component in xml file." << std::endl;
@@ -111,6 +129,9 @@ StatusCode AdaBoostDecisionTree::Initialize(const std::string &bdtXmlFileName, c
         return statusCodeException.GetStatusCode();
     }
 
+    const std::lock_guard<std::mutex> lock(m_strongClassifierCacheMutex);
+    m_strongClassifierCache[strongClassifierKey] = m_pStrongClassifier;
+
     return STATUS_CODE_SUCCESS;
 }
 
@@ -139,13 +160,30 @@ double AdaBoostDecisionTree::CalculateProbability(const LArMvaHelper::MvaFeature
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void AdaBoostDecisionTree::CalculateClassificationScores(
+    const LArMvaHelper::MvaFeatureMatrix &featureMatrix, LArMvaHelper::DoubleVector &scores) const
+{
+    this->CalculateScores(featureMatrix, scores);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void AdaBoostDecisionTree::CalculateProbabilities(
+    const LArMvaHelper::MvaFeatureMatrix &featureMatrix, LArMvaHelper::DoubleVector &probabilities) const
+{
+    LArMvaHelper::DoubleVector scores;
+    this->CalculateScores(featureMatrix, scores);
+
+    // ATTN: Same linear mapping from score to probability as for a single set of input features
+    for (const double score : scores)
+        probabilities.push_back((score + 1.) * 0.5);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 double AdaBoostDecisionTree::CalculateScore(const LArMvaHelper::MvaFeatureVector &features) const
 {
-    if (!m_pStrongClassifier)
-    {
-        std::cout << "AdaBoostDecisionTree: Attempting to use an uninitialized bdt" << std::endl;
-        throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
-    }
+    this->CheckInitialization();
 
     try
     {
@@ -154,28 +192,62 @@ double AdaBoostDecisionTree::CalculateScore(const LArMvaHelper::MvaFeatureVector
     }
     catch (StatusCodeException &statusCodeException)
     {
-        if (STATUS_CODE_NOT_FOUND == statusCodeException.GetStatusCode())
-        {
-            std::cout << "AdaBoostDecisionTree: Caught exception thrown when trying to cut on an unknown variable." << std::endl;
-        }
-        else if (STATUS_CODE_INVALID_PARAMETER == statusCodeException.GetStatusCode())
-        {
-            std::cout << "AdaBoostDecisionTree: Caught exception thrown when classifier weights sum to zero indicating defunct classifier."
-                      << std::endl;
-        }
-        else if (STATUS_CODE_OUT_OF_RANGE == statusCodeException.GetStatusCode())
-        {
-            std::cout << "AdaBoostDecisionTree: Caught exception thrown when heirarchy in decision tree is incomplete." << std::endl;
-        }
-        else
-        {
-            std::cout << "AdaBoostDecisionTree: Unexpected exception thrown." << std::endl;
-        }
+        this->ReportException(statusCodeException);
+        throw statusCodeException;
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void AdaBoostDecisionTree::CalculateScores(const LArMvaHelper::MvaFeatureMatrix &featureMatrix, LArMvaHelper::DoubleVector &scores) const
+{
+    this->CheckInitialization();
 
+    try
+    {
+        m_pStrongClassifier->Predict(featureMatrix, scores);
+    }
+    catch (StatusCodeException &statusCodeException)
+    {
+        this->ReportException(statusCodeException);
         throw statusCodeException;
     }
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void AdaBoostDecisionTree::CheckInitialization() const
+{
+    if (!m_pStrongClassifier)
+    {
+        std::cout << "AdaBoostDecisionTree: Attempting to use an uninitialized bdt" << std::endl;
+        throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void AdaBoostDecisionTree::ReportException(const StatusCodeException &statusCodeException) const
+{
+    if (STATUS_CODE_NOT_FOUND == statusCodeException.GetStatusCode())
+    {
+        std::cout << "AdaBoostDecisionTree: Caught exception thrown when trying to cut on an unknown variable." << std::endl;
+    }
+    else if (STATUS_CODE_INVALID_PARAMETER == statusCodeException.GetStatusCode())
+    {
+        std::cout << "AdaBoostDecisionTree: Caught exception thrown when classifier weights sum to zero indicating defunct classifier."
+                  << std::endl;
+    }
+    else if (STATUS_CODE_OUT_OF_RANGE == statusCodeException.GetStatusCode())
+    {
+        std::cout << "AdaBoostDecisionTree: Caught exception thrown when heirarchy in decision tree is incomplete." << std::endl;
+    }
+    else
+    {
+        std::cout << "AdaBoostDecisionTree: Unexpected exception thrown." << std::endl;
+    }
+}
+
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -260,7 +332,7 @@ AdaBoostDecisionTree::Node::~Node()
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-AdaBoostDecisionTree::WeakClassifier::WeakClassifier(const TiXmlHandle *const pXmlHandle) : m_weight(0.), m_treeId(0)
+AdaBoostDecisionTree::WeakClassifier::WeakClassifier(const TiXmlHandle *const pXmlHandle) : m_weight(0.), m_treeId(0), m_rootIndex(-1)
 {
     for (TiXmlElement *pHeadTiXmlElement = pXmlHandle->FirstChildElement().ToElement(); pHeadTiXmlElement != NULL;
          pHeadTiXmlElement = pHeadTiXmlElement->NextSiblingElement())
@@ -280,11 +352,17 @@ AdaBoostDecisionTree::WeakClassifier::WeakClassifier(const TiXmlHandle *const pX
             m_idToNodeMap.insert(IdToNodeMap::value_type(pNode->GetNodeId(), pNode));
         }
     }
+
+    this->FillFlatNodes();
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-AdaBoostDecisionTree::WeakClassifier::WeakClassifier(const WeakClassifier &rhs) : m_weight(rhs.m_weight), m_treeId(rhs.m_treeId)
+AdaBoostDecisionTree::WeakClassifier::WeakClassifier(const WeakClassifier &rhs) :
+    m_weight(rhs.m_weight),
+    m_treeId(rhs.m_treeId),
+    m_flatNodes(rhs.m_flatNodes),
+    m_rootIndex(rhs.m_rootIndex)
 {
     for (const auto &mapEntry : rhs.m_idToNodeMap)
     {
@@ -307,6 +385,7 @@ AdaBoostDecisionTree::WeakClassifier &AdaBoostDecisionTree::WeakClassifier::oper
 
         m_weight = rhs.m_weight;
         m_treeId = rhs.m_treeId;
+        this->FillFlatNodes();
     }
 
     return *this;
@@ -324,7 +403,24 @@ AdaBoostDecisionTree::WeakClassifier::~WeakClassifier()
 
 bool AdaBoostDecisionTree::WeakClassifier::Predict(const LArMvaHelper::MvaFeatureVector &features) const
 {
-    return this->EvaluateNode(0, features);
+    // ATTN Iterative equivalent of EvaluateNode from the root node, using the flat node vector
+    int index(m_rootIndex);
+
+    while (true)
+    {
+        if (index < 0)
+            throw StatusCodeException(STATUS_CODE_OUT_OF_RANGE);
+
+        const FlatNode &flatNode(m_flatNodes[index]);
+
+        if (flatNode.m_isLeaf)
+            return flatNode.m_outcome;
+
+        if (static_cast<int>(features.size()) <= flatNode.m_variableId)
+            throw StatusCodeException(STATUS_CODE_NOT_FOUND);
+
+        index = (features.at(flatNode.m_variableId).Get() <= flatNode.m_threshold) ? flatNode.m_leftIndex : flatNode.m_rightIndex;
+    }
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -358,6 +454,40 @@ bool AdaBoostDecisionTree::WeakClassifier::EvaluateNode(const int nodeId, const
     }
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void AdaBoostDecisionTree::WeakClassifier::FillFlatNodes()
+{
+    std::map<int, int> idToIndexMap;
+
+    for (const auto &mapEntry : m_idToNodeMap)
+        idToIndexMap.insert(std::map<int, int>::value_type(mapEntry.first, static_cast<int>(idToIndexMap.size())));
+
+    auto getIndex = [&idToIndexMap](const int nodeId) -> int {
+        const std::map<int, int>::const_iterator iter(idToIndexMap.find(nodeId));
+        return ((idToIndexMap.end() != iter) ? iter->second : -1);
+    };
+
+    m_flatNodes.clear();
+    m_flatNodes.reserve(m_idToNodeMap.size());
+
+    for (const auto &mapEntry : m_idToNodeMap)
+    {
+        const Node *const pNode(mapEntry.second);
+
+        FlatNode flatNode;
+        flatNode.m_threshold = pNode->GetThreshold();
+        flatNode.m_variableId = pNode->GetVariableId();
+        flatNode.m_leftIndex = pNode->IsLeaf() ? -1 : getIndex(pNode->GetLeftChildNodeId());
+        flatNode.m_rightIndex = pNode->IsLeaf() ? -1 : getIndex(pNode->GetRightChildNodeId());
+        flatNode.m_isLeaf = pNode->IsLeaf();
+        flatNode.m_outcome = pNode->GetOutcome();
+        m_flatNodes.push_back(flatNode);
+    }
+
+    m_rootIndex = getIndex(0);
+}
+
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -437,6 +567,40 @@ double AdaBoostDecisionTree::StrongClassifier::Predict(const LArMvaHelper::MvaFe
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void AdaBoostDecisionTree::StrongClassifier::Predict(
+    const LArMvaHelper::MvaFeatureMatrix &featureMatrix, LArMvaHelper::DoubleVector &scores) const
+{
+    // ATTN Weights are accumulated in the same order as for a single example, so each score is identical to that from the single example
+    LArMvaHelper::DoubleVector batchScores(featureMatrix.size(), 0.);
+    double weights(0.);
+
+    for (const WeakClassifier *const pWeakClassifier : m_weakClassifiers)
+    {
+        const double weight(pWeakClassifier->GetWeight());
+        weights += weight;
+
+        for (unsigned int index = 0; index < featureMatrix.size(); ++index)
+        {
+            if (pWeakClassifier->Predict(featureMatrix[index]))
+            {
+                batchScores[index] += weight;
+            }
+            else
+            {
+                batchScores[index] -= weight;
+            }
+        }
+    }
+
+    if (!(weights > std::numeric_limits<double>::epsilon()))
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+    for (const double score : batchScores)
+        scores.push_back(score / weights);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode AdaBoostDecisionTree::StrongClassifier::ReadComponent(TiXmlElement *pCurrentXmlElement)
 {
     const std::string componentName(pCurrentXmlElement->ValueStr());
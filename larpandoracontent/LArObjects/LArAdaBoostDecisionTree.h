@@ -16,6 +16,10 @@
 
 #include <functional>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
 #include <vector>
 
 namespace lar_content
@@ -88,6 +92,23 @@ public:
      */
     double CalculateProbability(const LArMvaHelper::MvaFeatureVector &features) const;
 
+    /**
+     *  @brief  Calculate the classification scores for a number of sets of input features, evaluating each tree for all examples in turn
+     *
+     *  @param  featureMatrix the input features, one feature vector per example
+     *  @param  scores to receive the classification score for each example, in the order of the input feature vectors
+     */
+    void CalculateClassificationScores(const LArMvaHelper::MvaFeatureMatrix &featureMatrix, LArMvaHelper::DoubleVector &scores) const;
+
+    /**
+     *  @brief  Calculate the classification probabilities for a number of sets of input features, evaluating each tree for all examples
+     *          in turn
+     *
+     *  @param  featureMatrix the input features, one feature vector per example
+     *  @param  probabilities to receive the classification probability for each example, in the order of the input feature vectors
+     */
+    void CalculateProbabilities(const LArMvaHelper::MvaFeatureMatrix &featureMatrix, LArMvaHelper::DoubleVector &probabilities) const;
+
 private:
     /**
      *  @brief Node class used for representing a decision tree
@@ -256,9 +277,32 @@ private:
         int GetTreeId() const;
 
     private:
-        IdToNodeMap m_idToNodeMap; ///< Decision tree nodes
-        double m_weight;           ///< Boost weight
-        int m_treeId;              ///< Decision tree id
+        /**
+         *  @brief  FlatNode class, a decision tree node packed into a contiguous vector for iterative evaluation
+         */
+        class FlatNode
+        {
+        public:
+            double m_threshold; ///< Threshold used for decision if decision node
+            int m_variableId;   ///< Variable cut on for decision if decision node
+            int m_leftIndex;    ///< Index of the left child node in the flat node vector, negative if not found
+            int m_rightIndex;   ///< Index of the right child node in the flat node vector, negative if not found
+            bool m_isLeaf;      ///< Is node a leaf
+            bool m_outcome;     ///< Outcome if leaf node
+        };
+
+        typedef std::vector<FlatNode> FlatNodeVector;
+
+        /**
+         *  @brief  Fill the flat node vector from the decision tree nodes, replacing node ids by vector indices
+         */
+        void FillFlatNodes();
+
+        IdToNodeMap m_idToNodeMap;  ///< Decision tree nodes
+        double m_weight;            ///< Boost weight
+        int m_treeId;               ///< Decision tree id
+        FlatNodeVector m_flatNodes; ///< Decision tree nodes, packed for evaluation
+        int m_rootIndex;            ///< Index of the root node in the flat node vector, negative if not found
     };
 
     typedef std::vector<const WeakClassifier *> WeakClassifiers;
@@ -304,6 +348,14 @@ private:
          */
         double Predict(const LArMvaHelper::MvaFeatureVector &features) const;
 
+        /**
+         *  @brief  Predict signal or background for a number of examples, evaluating each weak classifier for all examples in turn
+         *
+         *  @param  featureMatrix the input features, one feature vector per example
+         *  @param  scores to receive the score produced from trained model for each example
+         */
+        void Predict(const LArMvaHelper::MvaFeatureMatrix &featureMatrix, LArMvaHelper::DoubleVector &scores) const;
+
     private:
         /**
          *  @brief  Read xml element and if weak classifier add to member variables
@@ -322,7 +374,33 @@ private:
      */
     double CalculateScore(const LArMvaHelper::MvaFeatureVector &features) const;
 
-    StrongClassifier *m_pStrongClassifier; ///< Strong adaptive boost tree classifier
+    /**
+     *  @brief  Calculate scores for a number of examples using strong classifier
+     *
+     *  @param  featureMatrix the input features, one feature vector per example
+     *  @param  scores to receive the score for each example
+     */
+    void CalculateScores(const LArMvaHelper::MvaFeatureMatrix &featureMatrix, LArMvaHelper::DoubleVector &scores) const;
+
+    /**
+     *  @brief  Check the bdt is initialized, throwing if not
+     */
+    void CheckInitialization() const;
+
+    /**
+     *  @brief  Report the cause of an exception thrown by the strong classifier
+     *
+     *  @param  statusCodeException the exception
+     */
+    void ReportException(const pandora::StatusCodeException &statusCodeException) const;
+
+    typedef std::pair<std::string, std::string> StrongClassifierKey;
+    typedef std::map<StrongClassifierKey, std::weak_ptr<const StrongClassifier>> StrongClassifierCache;
+
+    std::shared_ptr<const StrongClassifier> m_pStrongClassifier; ///< Strong adaptive boost tree classifier, shared read-only between copies
+
+    static std::mutex m_strongClassifierCacheMutex;        ///< The mutex protecting the strong classifier cache
+    static StrongClassifierCache m_strongClassifierCache; ///< Live strong classifiers, indexed by xml file name and bdt name
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
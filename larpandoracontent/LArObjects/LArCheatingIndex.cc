@@ -0,0 +1,93 @@
+/**
+ *  @file   larpandoracontent/LArObjects/LArCheatingIndex.cc
+ *
+ *  @brief  Implementation of the lar cheating index class.
+ *
+ *  $Log: $
+ */
+
+#include "Helpers/MCParticleHelper.h"
+
+#include "Objects/CaloHit.h"
+#include "Objects/MCParticle.h"
+
+#include "larpandoracontent/LArHelpers/LArMCParticleHelper.h"
+
+#include "larpandoracontent/LArObjects/LArCheatingIndex.h"
+
+#include <algorithm>
+
+using namespace pandora;
+
+namespace lar_content
+{
+
+const MCParticle *CheatingIndex::GetMainMCParticle(const CaloHit *const pCaloHit)
+{
+    const HitToMCParticleMap::const_iterator iter(m_hitToMainMCParticleMap.find(pCaloHit));
+
+    if (m_hitToMainMCParticleMap.end() != iter)
+        return iter->second;
+
+    const MCParticle *const pMainMCParticle(MCParticleHelper::GetMainMCParticle(pCaloHit));
+    (void)m_hitToMainMCParticleMap.insert(HitToMCParticleMap::value_type(pCaloHit, pMainMCParticle));
+
+    return pMainMCParticle;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const MCParticleVector &CheatingIndex::GetMCParticlesByMomentum(const CaloHit *const pCaloHit)
+{
+    HitToMCParticleVectorMap::const_iterator iter(m_hitToMCParticleVectorMap.find(pCaloHit));
+
+    if (m_hitToMCParticleVectorMap.end() != iter)
+        return iter->second;
+
+    MCParticleVector mcParticleVector;
+    for (const MCParticleWeightMap::value_type &mapEntry : pCaloHit->GetMCParticleWeightMap())
+        mcParticleVector.push_back(mapEntry.first);
+
+    // ATTN Stable sort, matching the list sort previously used by the cheating tools
+    std::stable_sort(mcParticleVector.begin(), mcParticleVector.end(), LArMCParticleHelper::SortByMomentum);
+    iter = m_hitToMCParticleVectorMap.insert(HitToMCParticleVectorMap::value_type(pCaloHit, mcParticleVector)).first;
+
+    return iter->second;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const MCParticle *CheatingIndex::GetParentMCParticle(const MCParticle *const pMCParticle)
+{
+    // ATTN Record the root for every mc particle on the walk, so that each hierarchy is walked at most once
+    MCParticleVector walkedMCParticles;
+    const MCParticle *pParentMCParticle(pMCParticle);
+
+    while (true)
+    {
+        const MCParticleToMCParticleMap::const_iterator iter(m_mcParticleToParentMap.find(pParentMCParticle));
+
+        if (m_mcParticleToParentMap.end() != iter)
+        {
+            pParentMCParticle = iter->second;
+            break;
+        }
+
+        walkedMCParticles.push_back(pParentMCParticle);
+
+        if (pParentMCParticle->GetParentList().empty())
+            break;
+
+        if (1 != pParentMCParticle->GetParentList().size())
+            throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+        pParentMCParticle = *(pParentMCParticle->GetParentList().begin());
+    }
+
+    for (const MCParticle *const pWalkedMCParticle : walkedMCParticles)
+        m_mcParticleToParentMap[pWalkedMCParticle] = pParentMCParticle;
+
+    return pParentMCParticle;
+}
+
+} // namespace lar_content
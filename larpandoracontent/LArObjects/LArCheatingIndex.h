@@ -0,0 +1,69 @@
+/**
+ *  @file   larpandoracontent/LArObjects/LArCheatingIndex.h
+ *
+ *  @brief  Header file for the lar cheating index class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_CHEATING_INDEX_H
+#define LAR_CHEATING_INDEX_H 1
+
+#include "Pandora/PandoraInternal.h"
+
+#include <unordered_map>
+
+namespace lar_content
+{
+
+/**
+ *  @brief  CheatingIndex class, recording the truth relationships of calo hits and mc particles as they are first requested, so that
+ *          repeated lookups by the cheating algorithms and tools within an event need not rescan weight maps or walk mc hierarchies.
+ *          Entries rely upon calo hits and mc particles persisting until the end of the event.
+ */
+class CheatingIndex
+{
+public:
+    /**
+     *  @brief  Get the main mc particle for a calo hit, as for MCParticleHelper::GetMainMCParticle
+     *
+     *  @param  pCaloHit the address of the calo hit
+     *
+     *  @return the address of the main mc particle
+     *
+     *  @throw  StatusCodeException if the calo hit has no associated mc particles
+     */
+    const pandora::MCParticle *GetMainMCParticle(const pandora::CaloHit *const pCaloHit);
+
+    /**
+     *  @brief  Get the mc particles contributing to a calo hit, sorted as by LArMCParticleHelper::SortByMomentum
+     *
+     *  @param  pCaloHit the address of the calo hit
+     *
+     *  @return the contributing mc particles, sorted by momentum
+     */
+    const pandora::MCParticleVector &GetMCParticlesByMomentum(const pandora::CaloHit *const pCaloHit);
+
+    /**
+     *  @brief  Get the root mc particle of the hierarchy containing a given mc particle, as for LArMCParticleHelper::GetParentMCParticle
+     *
+     *  @param  pMCParticle the address of the mc particle
+     *
+     *  @return the address of the root mc particle
+     *
+     *  @throw  StatusCodeException if a mc particle in the hierarchy has more than one parent
+     */
+    const pandora::MCParticle *GetParentMCParticle(const pandora::MCParticle *const pMCParticle);
+
+private:
+    typedef std::unordered_map<const pandora::CaloHit *, const pandora::MCParticle *> HitToMCParticleMap;
+    typedef std::unordered_map<const pandora::CaloHit *, pandora::MCParticleVector> HitToMCParticleVectorMap;
+    typedef std::unordered_map<const pandora::MCParticle *, const pandora::MCParticle *> MCParticleToMCParticleMap;
+
+    HitToMCParticleMap m_hitToMainMCParticleMap;         ///< The main mc particle for each calo hit
+    HitToMCParticleVectorMap m_hitToMCParticleVectorMap; ///< The contributing mc particles, sorted by momentum, for each calo hit
+    MCParticleToMCParticleMap m_mcParticleToParentMap;   ///< The root mc particle for each mc particle
+};
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_CHEATING_INDEX_H
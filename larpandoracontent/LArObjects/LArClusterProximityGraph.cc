@@ -0,0 +1,160 @@
+/**
+ *  @file   larpandoracontent/LArObjects/LArClusterProximityGraph.cc
+ *
+ *  @brief  Implementation of the lar cluster proximity graph class.
+ *
+ *  $Log: $
+ */
+
+#include "Objects/Cluster.h"
+
+#include "larpandoracontent/LArHelpers/LArClusterHelper.h"
+
+#include "larpandoracontent/LArObjects/LArClusterProximityGraph.h"
+
+#include <algorithm>
+
+using namespace pandora;
+
+namespace lar_content
+{
+
+ClusterProximityGraph::ClusterProximityGraph(const float maxDistance) : m_maxDistance(maxDistance)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ClusterProximityGraph::Update(const ClusterVector &clusterVector)
+{
+    const ClusterSet clusterSet(clusterVector.begin(), clusterVector.end());
+    ClusterVector removedClusters;
+
+    // ATTN Only clusters in the vector are dereferenced, as clusters no longer in the vector may have been deleted
+    for (const ClusterNodeMap::value_type &mapEntry : m_clusterNodeMap)
+    {
+        if (!clusterSet.count(mapEntry.first) || (mapEntry.first->GetNCaloHits() != mapEntry.second.m_nCaloHits))
+            removedClusters.push_back(mapEntry.first);
+    }
+
+    for (const Cluster *const pCluster : removedClusters)
+        this->RemoveCluster(pCluster);
+
+    ClusterVector graphClusters;
+    CartesianPointVector minPositions, maxPositions;
+
+    for (const ClusterNodeMap::value_type &mapEntry : m_clusterNodeMap)
+        graphClusters.push_back(mapEntry.first);
+
+    for (const Cluster *const pCluster : graphClusters)
+    {
+        CartesianVector minPosition(0.f, 0.f, 0.f), maxPosition(0.f, 0.f, 0.f);
+        LArClusterHelper::GetClusterBoundingBox(pCluster, minPosition, maxPosition);
+        minPositions.push_back(minPosition);
+        maxPositions.push_back(maxPosition);
+    }
+
+    // ATTN Pad the bounding box separation, so that pairs are only skipped if their closest distance must exceed the maximum distance
+    const float maxSeparation(m_maxDistance + 0.01f);
+
+    for (const Cluster *const pCluster : clusterVector)
+    {
+        if (m_clusterNodeMap.count(pCluster))
+            continue;
+
+        CartesianVector minPosition(0.f, 0.f, 0.f), maxPosition(0.f, 0.f, 0.f);
+        LArClusterHelper::GetClusterBoundingBox(pCluster, minPosition, maxPosition);
+
+        ClusterNode &clusterNode(m_clusterNodeMap[pCluster]);
+        clusterNode.m_nCaloHits = pCluster->GetNCaloHits();
+
+        for (unsigned int iOther = 0; iOther < graphClusters.size(); ++iOther)
+        {
+            const CartesianVector &otherMinPosition(minPositions[iOther]), &otherMaxPosition(maxPositions[iOther]);
+
+            const float separationX(std::max(otherMinPosition.GetX() - maxPosition.GetX(), minPosition.GetX() - otherMaxPosition.GetX()));
+            const float separationY(std::max(otherMinPosition.GetY() - maxPosition.GetY(), minPosition.GetY() - otherMaxPosition.GetY()));
+            const float separationZ(std::max(otherMinPosition.GetZ() - maxPosition.GetZ(), minPosition.GetZ() - otherMaxPosition.GetZ()));
+
+            if ((separationX > maxSeparation) || (separationY > maxSeparation) || (separationZ > maxSeparation))
+                continue;
+
+            const Cluster *const pOtherCluster(graphClusters[iOther]);
+            const float distance(LArClusterHelper::GetClosestDistance(pCluster, pOtherCluster));
+
+            if (distance > m_maxDistance)
+                continue;
+
+            clusterNode.m_neighbours[pOtherCluster] = distance;
+            m_clusterNodeMap.at(pOtherCluster).m_neighbours[pCluster] = distance;
+        }
+
+        graphClusters.push_back(pCluster);
+        minPositions.push_back(minPosition);
+        maxPositions.push_back(maxPosition);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ClusterProximityGraph::MergeClusters(const Cluster *const pEnlargedCluster, const Cluster *const pDeletedCluster)
+{
+    ClusterNodeMap::iterator enlargedIter(m_clusterNodeMap.find(pEnlargedCluster));
+    ClusterNodeMap::iterator deletedIter(m_clusterNodeMap.find(pDeletedCluster));
+
+    if ((m_clusterNodeMap.end() == enlargedIter) || (m_clusterNodeMap.end() == deletedIter))
+    {
+        this->RemoveCluster(pEnlargedCluster);
+        this->RemoveCluster(pDeletedCluster);
+        return;
+    }
+
+    ClusterDistanceMap &enlargedNeighbours(enlargedIter->second.m_neighbours);
+
+    // ATTN The closest distance to the merged cluster is the smaller of the closest distances to its constituents; a missing edge means
+    // that the closest distance exceeds the maximum distance, so cannot be the smaller of the pair
+    for (const ClusterDistanceMap::value_type &mapEntry : deletedIter->second.m_neighbours)
+    {
+        if (pEnlargedCluster == mapEntry.first)
+            continue;
+
+        ClusterDistanceMap::iterator distanceIter(enlargedNeighbours.find(mapEntry.first));
+        const float distance(
+            (enlargedNeighbours.end() == distanceIter) ? mapEntry.second : std::min(distanceIter->second, mapEntry.second));
+
+        enlargedNeighbours[mapEntry.first] = distance;
+        m_clusterNodeMap.at(mapEntry.first).m_neighbours[pEnlargedCluster] = distance;
+    }
+
+    this->RemoveCluster(pDeletedCluster);
+    enlargedIter->second.m_nCaloHits = pEnlargedCluster->GetNCaloHits();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const ClusterProximityGraph::ClusterDistanceMap &ClusterProximityGraph::GetNeighbours(const Cluster *const pCluster) const
+{
+    const ClusterNodeMap::const_iterator iter(m_clusterNodeMap.find(pCluster));
+
+    if (m_clusterNodeMap.end() == iter)
+        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
+
+    return iter->second.m_neighbours;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ClusterProximityGraph::RemoveCluster(const Cluster *const pCluster)
+{
+    const ClusterNodeMap::iterator iter(m_clusterNodeMap.find(pCluster));
+
+    if (m_clusterNodeMap.end() == iter)
+        return;
+
+    for (const ClusterDistanceMap::value_type &mapEntry : iter->second.m_neighbours)
+        m_clusterNodeMap.at(mapEntry.first).m_neighbours.erase(pCluster);
+
+    m_clusterNodeMap.erase(iter);
+}
+
+} // namespace lar_content
@@ -0,0 +1,121 @@
+/**
+ *  @file   larpandoracontent/LArObjects/LArClusterProximityGraph.h
+ *
+ *  @brief  Header file for the lar cluster proximity graph class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_CLUSTER_PROXIMITY_GRAPH_H
+#define LAR_CLUSTER_PROXIMITY_GRAPH_H 1
+
+#include "Pandora/PandoraInternal.h"
+
+#include <unordered_map>
+
+namespace lar_content
+{
+
+/**
+ *  @brief  ClusterProximityGraph class, joining each pair of clusters whose closest distance, as for LArClusterHelper::GetClosestDistance,
+ *          does not exceed a maximum distance, with the edge weighted by that closest distance. The graph is updated incrementally as
+ *          clusters are merged, the closest distance to a merged cluster being the smaller of the closest distances to its constituents,
+ *          so that pair distances are calculated only for clusters new to the graph. Clusters are identified by address; a cluster that
+ *          has been modified outside the graph, as judged by its number of hits, is treated as new by the next update.
+ */
+class ClusterProximityGraph
+{
+public:
+    typedef std::unordered_map<const pandora::Cluster *, float> ClusterDistanceMap;
+
+    /**
+     *  @brief  Constructor
+     *
+     *  @param  maxDistance the maximum closest distance between clusters joined in the graph
+     */
+    ClusterProximityGraph(const float maxDistance);
+
+    /**
+     *  @brief  Update the graph to hold exactly the clusters in a provided vector, removing clusters not in the vector and calculating the
+     *          edges for clusters in the vector that are new to the graph
+     *
+     *  @param  clusterVector the cluster vector
+     */
+    void Update(const pandora::ClusterVector &clusterVector);
+
+    /**
+     *  @brief  Update the graph following the merge of one cluster into another. If only one cluster is present in the graph, both are
+     *          removed, so that the edges of the enlarged cluster are recalculated by the next update
+     *
+     *  @param  pEnlargedCluster the address of the enlarged cluster
+     *  @param  pDeletedCluster the address of the deleted cluster
+     */
+    void MergeClusters(const pandora::Cluster *const pEnlargedCluster, const pandora::Cluster *const pDeletedCluster);
+
+    /**
+     *  @brief  Whether the graph contains a given cluster
+     *
+     *  @param  pCluster the address of the cluster
+     *
+     *  @return boolean
+     */
+    bool Contains(const pandora::Cluster *const pCluster) const;
+
+    /**
+     *  @brief  Get the clusters joined to a given cluster, with their closest distances
+     *
+     *  @param  pCluster the address of the cluster
+     *
+     *  @return the map from joined cluster to closest distance
+     *
+     *  @throw  StatusCodeException if the cluster is not present in the graph
+     */
+    const ClusterDistanceMap &GetNeighbours(const pandora::Cluster *const pCluster) const;
+
+    /**
+     *  @brief  Get the maximum closest distance between clusters joined in the graph
+     *
+     *  @return the maximum distance
+     */
+    float GetMaxDistance() const;
+
+private:
+    /**
+     *  @brief  ClusterNode class, the graph entry for a cluster
+     */
+    class ClusterNode
+    {
+    public:
+        unsigned int m_nCaloHits;        ///< The number of hits in the cluster when its edges were last calculated
+        ClusterDistanceMap m_neighbours; ///< The map from joined cluster to closest distance
+    };
+
+    typedef std::unordered_map<const pandora::Cluster *, ClusterNode> ClusterNodeMap;
+
+    /**
+     *  @brief  Remove a cluster, and its edges, from the graph
+     *
+     *  @param  pCluster the address of the cluster
+     */
+    void RemoveCluster(const pandora::Cluster *const pCluster);
+
+    float m_maxDistance;             ///< The maximum closest distance between clusters joined in the graph
+    ClusterNodeMap m_clusterNodeMap; ///< The map from cluster to graph entry
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline bool ClusterProximityGraph::Contains(const pandora::Cluster *const pCluster) const
+{
+    return (m_clusterNodeMap.count(pCluster) > 0);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline float ClusterProximityGraph::GetMaxDistance() const
+{
+    return m_maxDistance;
+}
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_CLUSTER_PROXIMITY_GRAPH_H
@@ -0,0 +1,134 @@
+/**
+ *  @file   larpandoracontent/LArObjects/LArCompactMCWeights.cc
+ *
+ *  @brief  Implementation of the lar compact mc weights classes.
+ *
+ *  $Log: $
+ */
+
+#include "Objects/CaloHit.h"
+#include "Objects/MCParticle.h"
+
+#include "larpandoracontent/LArObjects/LArCompactMCWeights.h"
+
+#include <algorithm>
+
+using namespace pandora;
+
+namespace lar_content
+{
+
+CompactMCWeights::CompactMCWeights(IndexWeightVector indexWeightVector) :
+    m_nContributions(indexWeightVector.size()),
+    m_inlineEntries{}
+{
+    std::sort(indexWeightVector.begin(), indexWeightVector.end(), [](const IndexWeight &lhs, const IndexWeight &rhs) {
+        return (lhs.second > rhs.second) || ((lhs.second == rhs.second) && (lhs.first < rhs.first));
+    });
+
+    if (m_nContributions <= N_INLINE_CONTRIBUTIONS)
+    {
+        std::copy(indexWeightVector.begin(), indexWeightVector.end(), m_inlineEntries.begin());
+    }
+    else
+    {
+        indexWeightVector.shrink_to_fit();
+        m_overflowEntries = std::move(indexWeightVector);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+float CompactMCWeights::GetWeightSum() const
+{
+    float weightSum(0.f);
+
+    for (unsigned int rank = 0; rank < m_nContributions; ++rank)
+        weightSum += this->GetContribution(rank).second;
+
+    return weightSum;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void CompactMCWeightTable::Fill(const CaloHitList &caloHitList)
+{
+    this->Clear();
+
+    for (const CaloHit *const pCaloHit : caloHitList)
+    {
+        for (const MCParticleWeightMap::value_type &mapEntry : pCaloHit->GetMCParticleWeightMap())
+            m_mcParticleVector.push_back(mapEntry.first);
+    }
+
+    std::sort(m_mcParticleVector.begin(), m_mcParticleVector.end());
+    m_mcParticleVector.erase(std::unique(m_mcParticleVector.begin(), m_mcParticleVector.end()), m_mcParticleVector.end());
+
+    // ATTN Index mc particles in the order used to break weight ties when identifying the main mc particle for a hit
+    std::stable_sort(m_mcParticleVector.begin(), m_mcParticleVector.end(), PointerLessThan<MCParticle>());
+
+    std::unordered_map<const MCParticle *, unsigned int> mcParticleToIndexMap;
+    mcParticleToIndexMap.reserve(m_mcParticleVector.size());
+
+    for (unsigned int mcIndex = 0; mcIndex < m_mcParticleVector.size(); ++mcIndex)
+        mcParticleToIndexMap.emplace(m_mcParticleVector.at(mcIndex), mcIndex);
+
+    m_caloHitToWeightsMap.reserve(caloHitList.size());
+
+    for (const CaloHit *const pCaloHit : caloHitList)
+    {
+        const MCParticleWeightMap &mcParticleWeightMap(pCaloHit->GetMCParticleWeightMap());
+
+        CompactMCWeights::IndexWeightVector indexWeightVector;
+        indexWeightVector.reserve(mcParticleWeightMap.size());
+
+        for (const MCParticleWeightMap::value_type &mapEntry : mcParticleWeightMap)
+            indexWeightVector.emplace_back(mcParticleToIndexMap.at(mapEntry.first), mapEntry.second);
+
+        if (!m_caloHitToWeightsMap.emplace(pCaloHit, CompactMCWeights(std::move(indexWeightVector))).second)
+            throw StatusCodeException(STATUS_CODE_ALREADY_PRESENT);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void CompactMCWeightTable::Clear()
+{
+    m_mcParticleVector.clear();
+    m_caloHitToWeightsMap.clear();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const CompactMCWeights &CompactMCWeightTable::GetWeights(const CaloHit *const pCaloHit) const
+{
+    const CaloHitToWeightsMap::const_iterator iter(m_caloHitToWeightsMap.find(pCaloHit));
+
+    if (m_caloHitToWeightsMap.end() == iter)
+        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
+
+    return iter->second;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const MCParticle *CompactMCWeightTable::GetMainMCParticle(const CaloHit *const pCaloHit) const
+{
+    return this->GetMCParticle(this->GetWeights(pCaloHit).GetMainContributorIndex());
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void CompactMCWeightTable::FillMCParticleWeightMap(const CaloHit *const pCaloHit, MCParticleWeightMap &mcParticleWeightMap) const
+{
+    const CompactMCWeights &compactMCWeights(this->GetWeights(pCaloHit));
+
+    for (unsigned int rank = 0; rank < compactMCWeights.GetNContributions(); ++rank)
+    {
+        const CompactMCWeights::IndexWeight &indexWeight(compactMCWeights.GetContribution(rank));
+        mcParticleWeightMap[this->GetMCParticle(indexWeight.first)] = indexWeight.second;
+    }
+}
+
+} // namespace lar_content
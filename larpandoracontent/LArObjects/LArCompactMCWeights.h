@@ -0,0 +1,203 @@
+/**
+ *  @file   larpandoracontent/LArObjects/LArCompactMCWeights.h
+ *
+ *  @brief  Header file for the lar compact mc weights classes.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_COMPACT_MC_WEIGHTS_H
+#define LAR_COMPACT_MC_WEIGHTS_H 1
+
+#include "Pandora/PandoraInternal.h"
+
+#include <array>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace lar_content
+{
+
+/**
+ *  @brief  CompactMCWeights class, holding the mc particle contributions to a single calo hit as (mc index, weight) pairs, sorted by
+ *          decreasing weight, with ties broken by increasing mc index. Up to two contributions are stored inline, without heap allocation.
+ */
+class CompactMCWeights
+{
+public:
+    typedef std::pair<unsigned int, float> IndexWeight;
+    typedef std::vector<IndexWeight> IndexWeightVector;
+
+    /**
+     *  @brief  Constructor
+     *
+     *  @param  indexWeightVector the (mc index, weight) pairs, in any order, with each mc index appearing at most once
+     */
+    CompactMCWeights(IndexWeightVector indexWeightVector);
+
+    /**
+     *  @brief  Get the number of mc particle contributions
+     *
+     *  @return the number of mc particle contributions
+     */
+    unsigned int GetNContributions() const;
+
+    /**
+     *  @brief  Get the contribution with a given rank, where rank zero is the largest contribution
+     *
+     *  @param  rank the rank
+     *
+     *  @return the (mc index, weight) pair
+     */
+    const IndexWeight &GetContribution(const unsigned int rank) const;
+
+    /**
+     *  @brief  Get the mc index of the main contributor, matching the choice made by pandora::MCParticleHelper::GetMainMCParticle when
+     *          mc indices follow the pandora::PointerLessThan ordering of the mc particles
+     *
+     *  @return the mc index of the main contributor
+     *
+     *  @throw  StatusCodeException if there is no contribution with a positive weight
+     */
+    unsigned int GetMainContributorIndex() const;
+
+    /**
+     *  @brief  Get the sum of the contribution weights
+     *
+     *  @return the sum of the contribution weights
+     */
+    float GetWeightSum() const;
+
+private:
+    static const unsigned int N_INLINE_CONTRIBUTIONS = 2;
+
+    typedef std::array<IndexWeight, N_INLINE_CONTRIBUTIONS> InlineContributions;
+
+    unsigned int m_nContributions;       ///< The number of mc particle contributions
+    InlineContributions m_inlineEntries; ///< The contributions, if there are no more than the inline capacity
+    IndexWeightVector m_overflowEntries; ///< The contributions, if there are more than the inline capacity
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  CompactMCWeightTable class, holding compact mc weights for a list of calo hits, with a shared mc index for each mc particle
+ */
+class CompactMCWeightTable
+{
+public:
+    /**
+     *  @brief  Fill the table for a list of calo hits, replacing any existing contents
+     *
+     *  @param  caloHitList the list of calo hits
+     */
+    void Fill(const pandora::CaloHitList &caloHitList);
+
+    /**
+     *  @brief  Clear the table
+     */
+    void Clear();
+
+    /**
+     *  @brief  Whether the table holds mc weights for a given calo hit
+     *
+     *  @param  pCaloHit the address of the calo hit
+     *
+     *  @return boolean
+     */
+    bool HasWeights(const pandora::CaloHit *const pCaloHit) const;
+
+    /**
+     *  @brief  Get the compact mc weights for a given calo hit
+     *
+     *  @param  pCaloHit the address of the calo hit
+     *
+     *  @return the compact mc weights
+     *
+     *  @throw  StatusCodeException if the calo hit is not present in the table
+     */
+    const CompactMCWeights &GetWeights(const pandora::CaloHit *const pCaloHit) const;
+
+    /**
+     *  @brief  Get the mc particle with a given mc index
+     *
+     *  @param  mcIndex the mc index
+     *
+     *  @return the address of the mc particle
+     */
+    const pandora::MCParticle *GetMCParticle(const unsigned int mcIndex) const;
+
+    /**
+     *  @brief  Get the main mc particle contributing to a given calo hit, as would be returned by
+     *          pandora::MCParticleHelper::GetMainMCParticle
+     *
+     *  @param  pCaloHit the address of the calo hit
+     *
+     *  @return the address of the main mc particle
+     *
+     *  @throw  StatusCodeException if the calo hit is not present in the table, or has no contribution with a positive weight
+     */
+    const pandora::MCParticle *GetMainMCParticle(const pandora::CaloHit *const pCaloHit) const;
+
+    /**
+     *  @brief  Fill a mc particle weight map for a given calo hit, for interoperation with code using the calo hit weight map interface
+     *
+     *  @param  pCaloHit the address of the calo hit
+     *  @param  mcParticleWeightMap to receive the mc particle weights
+     *
+     *  @throw  StatusCodeException if the calo hit is not present in the table
+     */
+    void FillMCParticleWeightMap(const pandora::CaloHit *const pCaloHit, pandora::MCParticleWeightMap &mcParticleWeightMap) const;
+
+private:
+    typedef std::unordered_map<const pandora::CaloHit *, CompactMCWeights> CaloHitToWeightsMap;
+
+    pandora::MCParticleVector m_mcParticleVector; ///< The mc particles, by mc index
+    CaloHitToWeightsMap m_caloHitToWeightsMap;    ///< The map from calo hit to compact mc weights
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline unsigned int CompactMCWeights::GetNContributions() const
+{
+    return m_nContributions;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const CompactMCWeights::IndexWeight &CompactMCWeights::GetContribution(const unsigned int rank) const
+{
+    if (rank >= m_nContributions)
+        throw pandora::StatusCodeException(pandora::STATUS_CODE_OUT_OF_RANGE);
+
+    return (m_nContributions <= N_INLINE_CONTRIBUTIONS) ? m_inlineEntries[rank] : m_overflowEntries[rank];
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline unsigned int CompactMCWeights::GetMainContributorIndex() const
+{
+    if ((0 == m_nContributions) || !(this->GetContribution(0).second > 0.f))
+        throw pandora::StatusCodeException(pandora::STATUS_CODE_NOT_FOUND);
+
+    return this->GetContribution(0).first;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline bool CompactMCWeightTable::HasWeights(const pandora::CaloHit *const pCaloHit) const
+{
+    return (m_caloHitToWeightsMap.count(pCaloHit) > 0);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const pandora::MCParticle *CompactMCWeightTable::GetMCParticle(const unsigned int mcIndex) const
+{
+    return m_mcParticleVector.at(mcIndex);
+}
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_COMPACT_MC_WEIGHTS_H
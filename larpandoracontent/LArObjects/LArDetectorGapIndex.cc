@@ -0,0 +1,185 @@
+/**
+ *  @file   larpandoracontent/LArObjects/LArDetectorGapIndex.cc
+ *
+ *  @brief  Implementation of the lar detector gap index class.
+ *
+ *  $Log: $
+ */
+
+#include "Geometry/DetectorGap.h"
+
+#include "larpandoracontent/LArObjects/LArDetectorGapIndex.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+using namespace pandora;
+
+namespace lar_content
+{
+
+DetectorGapIndex::DetectorGapIndex(const DetectorGapList &detectorGapList) :
+    m_allGaps(detectorGapList.begin(), detectorGapList.end()),
+    m_allLineGaps(true)
+{
+    for (unsigned int gapIndex = 0; gapIndex < m_allGaps.size(); ++gapIndex)
+    {
+        const DetectorGap *const pDetectorGap(m_allGaps.at(gapIndex));
+        const LineGap *const pLineGap(dynamic_cast<const LineGap *>(pDetectorGap));
+
+        if (!pLineGap)
+        {
+            m_allLineGaps = false;
+            m_otherGaps.push_back(pDetectorGap);
+            continue;
+        }
+
+        const LineGapType lineGapType(pLineGap->GetLineGapType());
+        WireGapVector *const pWireGaps((TPC_WIRE_GAP_VIEW_U == lineGapType)   ? &m_wireGapsU
+                                       : (TPC_WIRE_GAP_VIEW_V == lineGapType) ? &m_wireGapsV
+                                       : (TPC_WIRE_GAP_VIEW_W == lineGapType) ? &m_wireGapsW
+                                                                              : nullptr);
+
+        if (!pWireGaps)
+        {
+            m_otherGaps.push_back(pDetectorGap);
+            continue;
+        }
+
+        pWireGaps->push_back({pLineGap->GetLineStartZ(), pLineGap->GetLineEndZ(), pLineGap->GetLineEndZ(), gapIndex, pLineGap});
+    }
+
+    for (WireGapVector *const pWireGaps : {&m_wireGapsU, &m_wireGapsV, &m_wireGapsW})
+    {
+        std::stable_sort(
+            pWireGaps->begin(), pWireGaps->end(), [](const WireGap &lhs, const WireGap &rhs) { return lhs.m_startZ < rhs.m_startZ; });
+
+        float maxEndZ(-std::numeric_limits<float>::max());
+
+        for (WireGap &wireGap : *pWireGaps)
+        {
+            maxEndZ = std::max(maxEndZ, wireGap.m_endZ);
+            wireGap.m_maxEndZ = maxEndZ;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool DetectorGapIndex::IsConsistent(const DetectorGapList &detectorGapList) const
+{
+    if (detectorGapList.size() != m_allGaps.size())
+        return false;
+
+    return (detectorGapList.empty() || ((detectorGapList.front() == m_allGaps.front()) && (detectorGapList.back() == m_allGaps.back())));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool DetectorGapIndex::IsInGap(const CartesianVector &testPoint2D, const HitType hitType, const float gapTolerance) const
+{
+    const WireGapVector *const pWireGaps(this->GetWireGaps(hitType));
+
+    if (!pWireGaps)
+    {
+        for (const DetectorGap *const pDetectorGap : m_allGaps)
+        {
+            if (pDetectorGap->IsInGap(testPoint2D, hitType, gapTolerance))
+                return true;
+        }
+
+        return false;
+    }
+
+    for (const DetectorGap *const pDetectorGap : m_otherGaps)
+    {
+        if (pDetectorGap->IsInGap(testPoint2D, hitType, gapTolerance))
+            return true;
+    }
+
+    // ATTN Widen the candidate range slightly, so that candidate selection is never tighter than the line gap containment test itself
+    const float z(testPoint2D.GetZ());
+    const float slack(4.f * std::numeric_limits<float>::epsilon() * (1.f + std::fabs(z) + std::fabs(gapTolerance)));
+
+    std::vector<const WireGap *> candidateGaps;
+    DetectorGapIndex::GetCandidateWireGaps(*pWireGaps, z - gapTolerance - slack, z + gapTolerance + slack, candidateGaps);
+
+    for (const WireGap *const pWireGap : candidateGaps)
+    {
+        if (pWireGap->m_pLineGap->IsInGap(testPoint2D, hitType, gapTolerance))
+            return true;
+    }
+
+    return false;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+float DetectorGapIndex::CalculateGapDeltaZ(const float minZ, const float maxZ, const HitType hitType) const
+{
+    if (maxZ - minZ < std::numeric_limits<float>::epsilon())
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+    if (!m_allLineGaps)
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+    const WireGapVector *const pWireGaps(this->GetWireGaps(hitType));
+
+    if (!pWireGaps)
+        return 0.f;
+
+    std::vector<const WireGap *> candidateGaps;
+    DetectorGapIndex::GetCandidateWireGaps(*pWireGaps, minZ, maxZ, candidateGaps);
+
+    // ATTN Sum contributions in detector gap list order, for consistency with a linear scan of the list
+    std::sort(candidateGaps.begin(), candidateGaps.end(), [](const WireGap *const pLhs, const WireGap *const pRhs) {
+        return pLhs->m_gapIndex < pRhs->m_gapIndex;
+    });
+
+    float gapDeltaZ(0.f);
+
+    for (const WireGap *const pWireGap : candidateGaps)
+    {
+        const float gapMinZ(std::max(minZ, pWireGap->m_startZ));
+        const float gapMaxZ(std::min(maxZ, pWireGap->m_endZ));
+
+        if ((gapMaxZ - gapMinZ) > std::numeric_limits<float>::epsilon())
+            gapDeltaZ += (gapMaxZ - gapMinZ);
+    }
+
+    return gapDeltaZ;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const DetectorGapIndex::WireGapVector *DetectorGapIndex::GetWireGaps(const HitType hitType) const
+{
+    return ((TPC_VIEW_U == hitType)   ? &m_wireGapsU
+            : (TPC_VIEW_V == hitType) ? &m_wireGapsV
+            : (TPC_VIEW_W == hitType) ? &m_wireGapsW
+                                      : nullptr);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void DetectorGapIndex::GetCandidateWireGaps(
+    const WireGapVector &wireGaps, const float minZ, const float maxZ, std::vector<const WireGap *> &candidateGaps)
+{
+    // Gaps are sorted by start z, so only those before the first gap starting beyond maxZ can overlap the range
+    const WireGapVector::const_iterator endIter(std::upper_bound(
+        wireGaps.begin(), wireGaps.end(), maxZ, [](const float value, const WireGap &wireGap) { return value < wireGap.m_startZ; }));
+
+    for (WireGapVector::const_iterator iter = endIter; iter != wireGaps.begin();)
+    {
+        --iter;
+
+        if (iter->m_maxEndZ < minZ)
+            break;
+
+        if (iter->m_endZ >= minZ)
+            candidateGaps.push_back(&(*iter));
+    }
+}
+
+} // namespace lar_content
@@ -0,0 +1,116 @@
+/**
+ *  @file   larpandoracontent/LArObjects/LArDetectorGapIndex.h
+ *
+ *  @brief  Header file for the lar detector gap index class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_DETECTOR_GAP_INDEX_H
+#define LAR_DETECTOR_GAP_INDEX_H 1
+
+#include "Objects/CartesianVector.h"
+
+#include "Pandora/PandoraEnumeratedTypes.h"
+#include "Pandora/PandoraInternal.h"
+
+#include <vector>
+
+namespace lar_content
+{
+
+/**
+ *  @brief  DetectorGapIndex class, holding the wire gaps for each view sorted by start z coordinate, so that gap queries need only examine
+ *          the gaps overlapping the query range. Gaps other than wire gaps are not indexed and are examined for every query.
+ */
+class DetectorGapIndex
+{
+public:
+    /**
+     *  @brief  Constructor
+     *
+     *  @param  detectorGapList the detector gap list
+     */
+    DetectorGapIndex(const pandora::DetectorGapList &detectorGapList);
+
+    /**
+     *  @brief  Whether the index was built from a given detector gap list
+     *
+     *  @param  detectorGapList the detector gap list
+     *
+     *  @return boolean
+     */
+    bool IsConsistent(const pandora::DetectorGapList &detectorGapList) const;
+
+    /**
+     *  @brief  Whether a 2D test point lies in a registered gap with the associated hit type, as for LArGeometryHelper::IsInGap
+     *
+     *  @param  testPoint2D the 2D test point
+     *  @param  hitType the hit type
+     *  @param  gapTolerance the gap tolerance
+     *
+     *  @return boolean
+     */
+    bool IsInGap(const pandora::CartesianVector &testPoint2D, const pandora::HitType hitType, const float gapTolerance) const;
+
+    /**
+     *  @brief  Calculate the total distance within a given 2D region that is composed of detector gaps, as for
+     *          LArGeometryHelper::CalculateGapDeltaZ
+     *
+     *  @param  minZ the minimum z coordinate
+     *  @param  maxZ the maximum z coordinate
+     *  @param  hitType the hit type
+     *
+     *  @return the total distance that is composed of detector gaps
+     *
+     *  @throw  StatusCodeException if the detector gap list contains gaps that are not line gaps
+     */
+    float CalculateGapDeltaZ(const float minZ, const float maxZ, const pandora::HitType hitType) const;
+
+private:
+    /**
+     *  @brief  WireGap class, a wire gap index entry
+     */
+    class WireGap
+    {
+    public:
+        float m_startZ;                     ///< The gap start z coordinate
+        float m_endZ;                       ///< The gap end z coordinate
+        float m_maxEndZ;                    ///< The maximum end z coordinate of this and all preceding entries
+        unsigned int m_gapIndex;            ///< The position of the gap in the detector gap list
+        const pandora::LineGap *m_pLineGap; ///< The address of the line gap
+    };
+
+    typedef std::vector<WireGap> WireGapVector;
+    typedef std::vector<const pandora::DetectorGap *> DetectorGapVector;
+
+    /**
+     *  @brief  Get the indexed wire gaps for a given hit type
+     *
+     *  @param  hitType the hit type
+     *
+     *  @return the address of the wire gaps, or nullptr if the hit type is not a wire view
+     */
+    const WireGapVector *GetWireGaps(const pandora::HitType hitType) const;
+
+    /**
+     *  @brief  Get the indexed wire gaps that may overlap a given z range
+     *
+     *  @param  wireGaps the indexed wire gaps for a view
+     *  @param  minZ the minimum z coordinate
+     *  @param  maxZ the maximum z coordinate
+     *  @param  candidateGaps to receive the addresses of the candidate wire gaps
+     */
+    static void GetCandidateWireGaps(
+        const WireGapVector &wireGaps, const float minZ, const float maxZ, std::vector<const WireGap *> &candidateGaps);
+
+    DetectorGapVector m_allGaps;   ///< All detector gaps, in detector gap list order
+    DetectorGapVector m_otherGaps; ///< The detector gaps that are not wire gaps, in detector gap list order
+    WireGapVector m_wireGapsU;     ///< The u view wire gaps, sorted by start z coordinate
+    WireGapVector m_wireGapsV;     ///< The v view wire gaps, sorted by start z coordinate
+    WireGapVector m_wireGapsW;     ///< The w view wire gaps, sorted by start z coordinate
+    bool m_allLineGaps;            ///< Whether all detector gaps are line gaps
+};
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_DETECTOR_GAP_INDEX_H
@@ -0,0 +1,87 @@
+/**
+ *  @file   larpandoracontent/LArObjects/LArGeometryConstants.cc
+ *
+ *  @brief  Implementation of the lar geometry constants class.
+ *
+ *  $Log: $
+ */
+
+#include "Geometry/LArTPC.h"
+
+#include "Pandora/StatusCodes.h"
+
+#include "Plugins/LArTransformationPlugin.h"
+
+#include "larpandoracontent/LArObjects/LArGeometryConstants.h"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace pandora;
+
+namespace lar_content
+{
+
+GeometryConstants::GeometryConstants(const LArTPCMap &larTPCMap, const LArTransformationPlugin *const pTransform) :
+    m_nLArTPCs(larTPCMap.size()),
+    m_pFirstLArTPC(larTPCMap.empty() ? nullptr : larTPCMap.begin()->second),
+    m_pLastLArTPC(larTPCMap.empty() ? nullptr : larTPCMap.rbegin()->second),
+    m_pTransform(pTransform),
+    m_wirePitches{{0.f, 0.f, 0.f}},
+    m_maxWirePitchDiscrepancies{{0.f, 0.f, 0.f}},
+    m_sigmaUVW(0.f),
+    m_maxSigmaUVWDiscrepancy(0.f)
+{
+    if (m_pFirstLArTPC)
+    {
+        m_wirePitches = {{m_pFirstLArTPC->GetWirePitchU(), m_pFirstLArTPC->GetWirePitchV(), m_pFirstLArTPC->GetWirePitchW()}};
+        m_sigmaUVW = m_pFirstLArTPC->GetSigmaUVW();
+    }
+
+    // ATTN The largest discrepancy exceeds a tolerance exactly when the discrepancy of some tpc does, as tested by a scan over the map
+    for (const LArTPCMap::value_type &mapEntry : larTPCMap)
+    {
+        const LArTPC *const pLArTPC(mapEntry.second);
+        const std::array<float, 3> wirePitches{{pLArTPC->GetWirePitchU(), pLArTPC->GetWirePitchV(), pLArTPC->GetWirePitchW()}};
+
+        for (unsigned int viewIndex = 0; viewIndex < 3; ++viewIndex)
+        {
+            m_maxWirePitchDiscrepancies[viewIndex] =
+                std::max(m_maxWirePitchDiscrepancies[viewIndex], std::fabs(m_wirePitches[viewIndex] - wirePitches[viewIndex]));
+        }
+
+        m_maxSigmaUVWDiscrepancy = std::max(m_maxSigmaUVWDiscrepancy, std::fabs(m_sigmaUVW - pLArTPC->GetSigmaUVW()));
+    }
+
+    m_wireAxes.emplace_back(0.f, pTransform->YZtoU(1.f, 0.f), pTransform->YZtoU(0.f, 1.f));
+    m_wireAxes.emplace_back(0.f, pTransform->YZtoV(1.f, 0.f), pTransform->YZtoV(0.f, 1.f));
+    m_wireAxes.emplace_back(0.f, pTransform->YZtoW(1.f, 0.f), pTransform->YZtoW(0.f, 1.f));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool GeometryConstants::IsConsistent(const LArTPCMap &larTPCMap, const LArTransformationPlugin *const pTransform) const
+{
+    if ((larTPCMap.size() != m_nLArTPCs) || (pTransform != m_pTransform))
+        return false;
+
+    return (larTPCMap.empty() || ((larTPCMap.begin()->second == m_pFirstLArTPC) && (larTPCMap.rbegin()->second == m_pLastLArTPC)));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+unsigned int GeometryConstants::GetViewIndex(const HitType view)
+{
+    if (TPC_VIEW_U == view)
+        return 0;
+
+    if (TPC_VIEW_V == view)
+        return 1;
+
+    if (TPC_VIEW_W == view)
+        return 2;
+
+    throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+}
+
+} // namespace lar_content
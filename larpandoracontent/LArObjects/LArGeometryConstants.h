@@ -0,0 +1,167 @@
+/**
+ *  @file   larpandoracontent/LArObjects/LArGeometryConstants.h
+ *
+ *  @brief  Header file for the lar geometry constants class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_GEOMETRY_CONSTANTS_H
+#define LAR_GEOMETRY_CONSTANTS_H 1
+
+#include "Objects/CartesianVector.h"
+
+#include "Pandora/PandoraEnumeratedTypes.h"
+#include "Pandora/PandoraInternal.h"
+
+#include <array>
+
+namespace pandora
+{
+class LArTransformationPlugin;
+} // namespace pandora
+
+namespace lar_content
+{
+
+/**
+ *  @brief  GeometryConstants class, holding the wire pitches, sigmaUVW and wire axes derived from the lar tpc map and transformation
+ *          plugin, together with the largest discrepancy of each tpc value from that of the first tpc, so that the consistency of the
+ *          tpc configurations can be tested without a scan over the lar tpc map
+ */
+class GeometryConstants
+{
+public:
+    /**
+     *  @brief  Constructor
+     *
+     *  @param  larTPCMap the lar tpc map
+     *  @param  pTransform the address of the transformation plugin
+     */
+    GeometryConstants(const pandora::LArTPCMap &larTPCMap, const pandora::LArTransformationPlugin *const pTransform);
+
+    /**
+     *  @brief  Whether the constants were derived from a given lar tpc map and transformation plugin
+     *
+     *  @param  larTPCMap the lar tpc map
+     *  @param  pTransform the address of the transformation plugin
+     *
+     *  @return boolean
+     */
+    bool IsConsistent(const pandora::LArTPCMap &larTPCMap, const pandora::LArTransformationPlugin *const pTransform) const;
+
+    /**
+     *  @brief  Whether the lar tpc map from which the constants were derived contains any tpcs
+     *
+     *  @return boolean
+     */
+    bool HasLArTPCs() const;
+
+    /**
+     *  @brief  Get the wire pitch of the first tpc for a given view
+     *
+     *  @param  view the view, which must be U, V or W
+     *
+     *  @return the wire pitch
+     */
+    float GetWirePitch(const pandora::HitType view) const;
+
+    /**
+     *  @brief  Get the largest discrepancy between the wire pitch of any tpc and that of the first tpc, for a given view
+     *
+     *  @param  view the view, which must be U, V or W
+     *
+     *  @return the largest wire pitch discrepancy
+     */
+    float GetMaxWirePitchDiscrepancy(const pandora::HitType view) const;
+
+    /**
+     *  @brief  Get the sigmaUVW of the first tpc
+     *
+     *  @return the sigmaUVW
+     */
+    float GetSigmaUVW() const;
+
+    /**
+     *  @brief  Get the largest discrepancy between the sigmaUVW of any tpc and that of the first tpc
+     *
+     *  @return the largest sigmaUVW discrepancy
+     */
+    float GetMaxSigmaUVWDiscrepancy() const;
+
+    /**
+     *  @brief  Get the wire axis for a given view
+     *
+     *  @param  view the view, which must be U, V or W
+     *
+     *  @return the wire axis
+     */
+    const pandora::CartesianVector &GetWireAxis(const pandora::HitType view) const;
+
+private:
+    /**
+     *  @brief  Get the index of the per-view constants for a given view
+     *
+     *  @param  view the view
+     *
+     *  @return the index
+     *
+     *  @throw  StatusCodeException if the view is not U, V or W
+     */
+    static unsigned int GetViewIndex(const pandora::HitType view);
+
+    unsigned int m_nLArTPCs;                              ///< The number of tpcs in the lar tpc map
+    const pandora::LArTPC *m_pFirstLArTPC;                ///< The address of the first tpc in the lar tpc map
+    const pandora::LArTPC *m_pLastLArTPC;                 ///< The address of the last tpc in the lar tpc map
+    const pandora::LArTransformationPlugin *m_pTransform; ///< The address of the transformation plugin
+    std::array<float, 3> m_wirePitches;                   ///< The wire pitches of the first tpc, for the U, V and W views
+    std::array<float, 3> m_maxWirePitchDiscrepancies;     ///< The largest wire pitch discrepancies, for the U, V and W views
+    float m_sigmaUVW;                                     ///< The sigmaUVW of the first tpc
+    float m_maxSigmaUVWDiscrepancy;                       ///< The largest sigmaUVW discrepancy
+    pandora::CartesianPointVector m_wireAxes;             ///< The wire axes, for the U, V and W views
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline bool GeometryConstants::HasLArTPCs() const
+{
+    return (m_nLArTPCs > 0);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline float GeometryConstants::GetWirePitch(const pandora::HitType view) const
+{
+    return m_wirePitches[GeometryConstants::GetViewIndex(view)];
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline float GeometryConstants::GetMaxWirePitchDiscrepancy(const pandora::HitType view) const
+{
+    return m_maxWirePitchDiscrepancies[GeometryConstants::GetViewIndex(view)];
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline float GeometryConstants::GetSigmaUVW() const
+{
+    return m_sigmaUVW;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline float GeometryConstants::GetMaxSigmaUVWDiscrepancy() const
+{
+    return m_maxSigmaUVWDiscrepancy;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const pandora::CartesianVector &GeometryConstants::GetWireAxis(const pandora::HitType view) const
+{
+    return m_wireAxes[GeometryConstants::GetViewIndex(view)];
+}
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_GEOMETRY_CONSTANTS_H
@@ -0,0 +1,247 @@
+/**
+ *  @file   larpandoracontent/LArObjects/LArMCHierarchySnapshot.cc
+ *
+ *  @brief  Implementation of the lar mc hierarchy snapshot class.
+ *
+ *  $Log: $
+ */
+
+#include "Helpers/MCParticleHelper.h"
+
+#include "Objects/CaloHit.h"
+#include "Objects/MCParticle.h"
+
+#include "larpandoracontent/LArObjects/LArMCHierarchySnapshot.h"
+
+#include <algorithm>
+
+using namespace pandora;
+
+namespace lar_content
+{
+
+MCHierarchySnapshot::MCHierarchySnapshot(const MCParticleList &mcParticleList, const CaloHitList &caloHitList) :
+    m_pMCParticleList(&mcParticleList),
+    m_pCaloHitList(&caloHitList),
+    m_nCaloHits(caloHitList.size()),
+    m_inputMCParticles(mcParticleList.begin(), mcParticleList.end())
+{
+    for (const MCParticle *const pMCParticle : m_inputMCParticles)
+    {
+        // ATTN Only walk up to the root for mc particles in hierarchies not yet added, so each hierarchy is traversed once
+        if (this->Contains(pMCParticle))
+            continue;
+
+        const MCParticle *pRootMCParticle(pMCParticle);
+
+        while (!pRootMCParticle->GetParentList().empty())
+        {
+            if (1 != pRootMCParticle->GetParentList().size())
+                throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+            pRootMCParticle = pRootMCParticle->GetParentList().front();
+        }
+
+        this->AddHierarchy(pRootMCParticle);
+    }
+
+    for (const CaloHit *const pCaloHit : caloHitList)
+    {
+        try
+        {
+            const MCParticleToIdMap::const_iterator iter(m_mcParticleToIdMap.find(MCParticleHelper::GetMainMCParticle(pCaloHit)));
+
+            if (m_mcParticleToIdMap.end() != iter)
+                ++m_mcEntries[iter->second].m_nCaloHits;
+        }
+        catch (const StatusCodeException &)
+        {
+        }
+    }
+
+    for (const MCParticle *const pMCParticle : m_inputMCParticles)
+    {
+        const MCParticle *const pPrimaryMCParticle(m_mcEntries[m_mcParticleToIdMap.at(pMCParticle)].m_pPrimary);
+
+        if (!pPrimaryMCParticle)
+            continue;
+
+        m_mcPrimaryMap[pMCParticle] = pPrimaryMCParticle;
+
+        if (pPrimaryMCParticle == pMCParticle)
+            m_primaryMCParticles.push_back(pMCParticle);
+    }
+
+    std::sort(m_primaryMCParticles.begin(), m_primaryMCParticles.end(), LArMCParticleHelper::SortByMomentum);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+unsigned int MCHierarchySnapshot::GetId(const MCParticle *const pMCParticle) const
+{
+    const MCParticleToIdMap::const_iterator iter(m_mcParticleToIdMap.find(pMCParticle));
+
+    if (m_mcParticleToIdMap.end() == iter)
+        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
+
+    return iter->second;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const MCParticle *MCHierarchySnapshot::GetParentMCParticle(const MCParticle *const pMCParticle) const
+{
+    return m_depthFirstMCParticles[m_mcEntries[this->GetId(pMCParticle)].m_rootId];
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+int MCHierarchySnapshot::GetHierarchyTier(const MCParticle *const pMCParticle) const
+{
+    return m_mcEntries[this->GetId(pMCParticle)].m_tier;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const MCParticle *MCHierarchySnapshot::GetTierOneMCParticle(const MCParticle *const pMCParticle) const
+{
+    if (!pMCParticle)
+        throw StatusCodeException(STATUS_CODE_FAILURE);
+
+    const MCEntry &mcEntry(m_mcEntries[this->GetId(pMCParticle)]);
+
+    if (0 == mcEntry.m_tier)
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+    return m_depthFirstMCParticles[mcEntry.m_tierOneId];
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const MCParticle *MCHierarchySnapshot::GetPrimaryMCParticle(const MCParticle *const pMCParticle) const
+{
+    const MCParticle *const pPrimaryMCParticle(m_mcEntries[this->GetId(pMCParticle)].m_pPrimary);
+
+    if (!pPrimaryMCParticle)
+        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
+
+    return pPrimaryMCParticle;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const MCParticle *MCHierarchySnapshot::GetLeadingMCParticle(const MCParticle *const pMCParticle) const
+{
+    const MCEntry &mcEntry(m_mcEntries[this->GetId(pMCParticle)]);
+
+    // ATTN: If not beam particle return primary particle
+    if (!LArMCParticleHelper::IsBeamParticle(m_depthFirstMCParticles[mcEntry.m_rootId]))
+        return this->GetPrimaryMCParticle(pMCParticle);
+
+    if (!mcEntry.m_pBeamLeading)
+        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
+
+    return mcEntry.m_pBeamLeading;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool MCHierarchySnapshot::IsDownstream(const MCParticle *const pAncestorMCParticle, const MCParticle *const pMCParticle) const
+{
+    const unsigned int ancestorId(this->GetId(pAncestorMCParticle)), id(this->GetId(pMCParticle));
+    return ((id >= ancestorId) && (id < m_mcEntries[ancestorId].m_endId));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void MCHierarchySnapshot::GetAllDescendentMCParticles(const MCParticle *const pMCParticle, MCParticleList &descendentMCParticleList) const
+{
+    const unsigned int id(this->GetId(pMCParticle));
+    const MCParticleVector::const_iterator firstIter(m_depthFirstMCParticles.begin() + id + 1);
+    descendentMCParticleList.insert(descendentMCParticleList.end(), firstIter, m_depthFirstMCParticles.begin() + m_mcEntries[id].m_endId);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+unsigned int MCHierarchySnapshot::GetNCaloHits(const MCParticle *const pMCParticle) const
+{
+    return m_mcEntries[this->GetId(pMCParticle)].m_nCaloHits;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void MCHierarchySnapshot::AddHierarchy(const MCParticle *const pRootMCParticle)
+{
+    // ATTN Iterative depth-first traversal, as mc hierarchies can be too deep for recursion. Besides the entries, each stack element
+    // records the next daughter to visit and the number of visible mc particles from the root down to and including its mc particle
+    class StackElement
+    {
+    public:
+        unsigned int m_id;                             ///< The depth-first position of the mc particle
+        MCParticleList::const_iterator m_daughterIter; ///< The next daughter to visit
+        unsigned int m_nVisible;                       ///< The number of visible mc particles from the root to the mc particle
+    };
+
+    std::vector<StackElement> stack;
+    const MCParticle *pMCParticle(pRootMCParticle);
+
+    while (true)
+    {
+        if (pMCParticle)
+        {
+            const unsigned int id(m_depthFirstMCParticles.size());
+
+            if (!m_mcParticleToIdMap.insert(MCParticleToIdMap::value_type(pMCParticle, id)).second)
+                throw StatusCodeException(STATUS_CODE_ALREADY_PRESENT);
+
+            const bool isVisible(LArMCParticleHelper::IsVisible(pMCParticle));
+            MCEntry mcEntry{0, id, id, id + 1, 0, isVisible ? pMCParticle : nullptr, isVisible ? pMCParticle : nullptr};
+            unsigned int nVisible(isVisible ? 1 : 0);
+
+            if (!stack.empty())
+            {
+                const MCEntry &parentEntry(m_mcEntries[stack.back().m_id]);
+                const unsigned int nParentVisible(stack.back().m_nVisible);
+
+                mcEntry.m_tier = parentEntry.m_tier + 1;
+                mcEntry.m_rootId = parentEntry.m_rootId;
+                mcEntry.m_tierOneId = (1 == mcEntry.m_tier) ? id : parentEntry.m_tierOneId;
+
+                // Primary is the first visible mc particle, leading is the last visible mc particle within the hierarchy tier limit
+                if (parentEntry.m_pPrimary)
+                    mcEntry.m_pPrimary = parentEntry.m_pPrimary;
+
+                if (!isVisible || (nParentVisible > 1))
+                    mcEntry.m_pBeamLeading = parentEntry.m_pBeamLeading;
+
+                nVisible += nParentVisible;
+            }
+
+            m_depthFirstMCParticles.push_back(pMCParticle);
+            m_mcEntries.push_back(mcEntry);
+            stack.push_back(StackElement{id, pMCParticle->GetDaughterList().begin(), nVisible});
+        }
+
+        StackElement &stackElement(stack.back());
+        const MCParticleList &daughterList(m_depthFirstMCParticles[stackElement.m_id]->GetDaughterList());
+
+        if (daughterList.end() != stackElement.m_daughterIter)
+        {
+            pMCParticle = *(stackElement.m_daughterIter++);
+
+            if (1 != pMCParticle->GetParentList().size())
+                throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+            continue;
+        }
+
+        m_mcEntries[stackElement.m_id].m_endId = m_depthFirstMCParticles.size();
+        stack.pop_back();
+        pMCParticle = nullptr;
+
+        if (stack.empty())
+            break;
+    }
+}
+
+} // namespace lar_content
@@ -0,0 +1,274 @@
+/**
+ *  @file   larpandoracontent/LArObjects/LArMCHierarchySnapshot.h
+ *
+ *  @brief  Header file for the lar mc hierarchy snapshot class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_MC_HIERARCHY_SNAPSHOT_H
+#define LAR_MC_HIERARCHY_SNAPSHOT_H 1
+
+#include "larpandoracontent/LArHelpers/LArMCParticleHelper.h"
+
+#include <unordered_map>
+#include <vector>
+
+namespace lar_content
+{
+
+/**
+ *  @brief  MCHierarchySnapshot class, holding the mc particle hierarchies connected to a list of mc particles in depth-first order, so
+ *          that each mc particle has a dense id and a contiguous range of descendants. The root, hierarchy tier, primary and leading
+ *          particles of each mc particle, together with the number of hits for which it is the main mc particle, are precomputed in a
+ *          single pass, such that all validation helpers can share the results rather than walking the parent/daughter links repeatedly.
+ */
+class MCHierarchySnapshot
+{
+public:
+    /**
+     *  @brief  Constructor
+     *
+     *  @param  mcParticleList the list of mc particles, all hierarchies connected to which are included in the snapshot
+     *  @param  caloHitList the list of calo hits to count for each main mc particle
+     *
+     *  @throw  StatusCodeException if any connected mc particle has more than one parent
+     */
+    MCHierarchySnapshot(const pandora::MCParticleList &mcParticleList, const pandora::CaloHitList &caloHitList);
+
+    /**
+     *  @brief  Whether the snapshot was built from given lists
+     *
+     *  @param  mcParticleList the list of mc particles
+     *  @param  caloHitList the list of calo hits
+     *
+     *  @return boolean
+     */
+    bool IsConsistent(const pandora::MCParticleList &mcParticleList, const pandora::CaloHitList &caloHitList) const;
+
+    /**
+     *  @brief  Whether the snapshot contains a given mc particle
+     *
+     *  @param  pMCParticle the address of the mc particle
+     *
+     *  @return boolean
+     */
+    bool Contains(const pandora::MCParticle *const pMCParticle) const;
+
+    /**
+     *  @brief  Get the number of mc particles in the snapshot, including those connected to, but absent from, the input list
+     *
+     *  @return the number of mc particles
+     */
+    unsigned int GetNMCParticles() const;
+
+    /**
+     *  @brief  Get the dense id of a given mc particle, its position in the depth-first ordering
+     *
+     *  @param  pMCParticle the address of the mc particle
+     *
+     *  @return the id
+     *
+     *  @throw  StatusCodeException if the mc particle is not present in the snapshot
+     */
+    unsigned int GetId(const pandora::MCParticle *const pMCParticle) const;
+
+    /**
+     *  @brief  Get the mc particle with a given dense id
+     *
+     *  @param  id the id
+     *
+     *  @return the address of the mc particle
+     */
+    const pandora::MCParticle *GetMCParticle(const unsigned int id) const;
+
+    /**
+     *  @brief  Get the mc particles of the input list, in input order
+     *
+     *  @return the input mc particles
+     */
+    const pandora::MCParticleVector &GetInputMCParticles() const;
+
+    /**
+     *  @brief  Get the root mc particle of the hierarchy containing a given mc particle, as for LArMCParticleHelper::GetParentMCParticle
+     *
+     *  @param  pMCParticle the address of the mc particle
+     *
+     *  @return the address of the root mc particle
+     */
+    const pandora::MCParticle *GetParentMCParticle(const pandora::MCParticle *const pMCParticle) const;
+
+    /**
+     *  @brief  Get the hierarchy tier of a given mc particle, as for LArMCParticleHelper::GetHierarchyTier
+     *
+     *  @param  pMCParticle the address of the mc particle
+     *
+     *  @return the hierarchy tier
+     */
+    int GetHierarchyTier(const pandora::MCParticle *const pMCParticle) const;
+
+    /**
+     *  @brief  Get the tier one ancestor of a given mc particle, as for LArMuonLeadingHelper::GetLeadingParticle
+     *
+     *  @param  pMCParticle the address of the mc particle
+     *
+     *  @return the address of the tier one ancestor, which may be the mc particle itself
+     *
+     *  @throw  StatusCodeException if the mc particle is a root mc particle
+     */
+    const pandora::MCParticle *GetTierOneMCParticle(const pandora::MCParticle *const pMCParticle) const;
+
+    /**
+     *  @brief  Get the primary mc particle of a given mc particle, as for LArMCParticleHelper::GetPrimaryMCParticle
+     *
+     *  @param  pMCParticle the address of the mc particle
+     *
+     *  @return the address of the primary mc particle
+     *
+     *  @throw  StatusCodeException if there is no visible mc particle between the root and the mc particle
+     */
+    const pandora::MCParticle *GetPrimaryMCParticle(const pandora::MCParticle *const pMCParticle) const;
+
+    /**
+     *  @brief  Get the leading mc particle of a given mc particle, as for LArMCParticleHelper::GetLeadingMCParticle with the default
+     *          hierarchy tier limit
+     *
+     *  @param  pMCParticle the address of the mc particle
+     *
+     *  @return the address of the leading mc particle
+     *
+     *  @throw  StatusCodeException if there is no leading mc particle, or if the root mc particle cannot be classified
+     */
+    const pandora::MCParticle *GetLeadingMCParticle(const pandora::MCParticle *const pMCParticle) const;
+
+    /**
+     *  @brief  Whether a mc particle lies downstream of another mc particle, where a mc particle is considered to lie downstream of itself
+     *
+     *  @param  pAncestorMCParticle the address of the candidate ancestor mc particle
+     *  @param  pMCParticle the address of the mc particle
+     *
+     *  @return boolean
+     */
+    bool IsDownstream(const pandora::MCParticle *const pAncestorMCParticle, const pandora::MCParticle *const pMCParticle) const;
+
+    /**
+     *  @brief  Append all descendents of a given mc particle to a list, in the order used by
+     *          LArMCParticleHelper::GetAllDescendentMCParticles when operating on an output list that does not already contain any of them
+     *
+     *  @param  pMCParticle the address of the mc particle
+     *  @param  descendentMCParticleList to receive the descendent mc particles
+     */
+    void GetAllDescendentMCParticles(const pandora::MCParticle *const pMCParticle, pandora::MCParticleList &descendentMCParticleList) const;
+
+    /**
+     *  @brief  Get the number of calo hits for which a given mc particle is the main mc particle
+     *
+     *  @param  pMCParticle the address of the mc particle
+     *
+     *  @return the number of calo hits
+     */
+    unsigned int GetNCaloHits(const pandora::MCParticle *const pMCParticle) const;
+
+    /**
+     *  @brief  Get the map from each input mc particle to its primary mc particle, as provided by LArMCParticleHelper::GetMCPrimaryMap
+     *
+     *  @return the mc to primary mc map
+     */
+    const LArMCParticleHelper::MCRelationMap &GetMCPrimaryMap() const;
+
+    /**
+     *  @brief  Get the primary input mc particles, as provided by LArMCParticleHelper::GetPrimaryMCParticleList
+     *
+     *  @return the primary mc particles, sorted by momentum
+     */
+    const pandora::MCParticleVector &GetPrimaryMCParticles() const;
+
+private:
+    /**
+     *  @brief  MCEntry class, the snapshot entry for a mc particle at a given position in the depth-first ordering
+     */
+    class MCEntry
+    {
+    public:
+        int m_tier;                                ///< The hierarchy tier
+        unsigned int m_rootId;                     ///< The depth-first position of the root mc particle
+        unsigned int m_tierOneId;                  ///< The depth-first position of the tier one ancestor, for mc particles below the root
+        unsigned int m_endId;                      ///< The depth-first position following the last descendent mc particle
+        unsigned int m_nCaloHits;                  ///< The number of calo hits for which this is the main mc particle
+        const pandora::MCParticle *m_pPrimary;     ///< The address of the primary mc particle, if any
+        const pandora::MCParticle *m_pBeamLeading; ///< The address of the leading mc particle, if the root is a beam particle
+    };
+
+    typedef std::vector<MCEntry> MCEntryVector;
+    typedef std::unordered_map<const pandora::MCParticle *, unsigned int> MCParticleToIdMap;
+
+    /**
+     *  @brief  Add a root mc particle and all of its descendents to the depth-first ordering
+     *
+     *  @param  pRootMCParticle the address of the root mc particle
+     */
+    void AddHierarchy(const pandora::MCParticle *const pRootMCParticle);
+
+    const pandora::MCParticleList *m_pMCParticleList;  ///< The address of the input mc particle list
+    const pandora::CaloHitList *m_pCaloHitList;        ///< The address of the input calo hit list
+    unsigned int m_nCaloHits;                          ///< The number of hits in the input calo hit list
+    pandora::MCParticleVector m_inputMCParticles;      ///< The input mc particles, in input order
+    pandora::MCParticleVector m_depthFirstMCParticles; ///< The mc particles, in depth-first order for each hierarchy in turn
+    MCEntryVector m_mcEntries;                         ///< The mc entries, by depth-first position
+    MCParticleToIdMap m_mcParticleToIdMap;             ///< The map from mc particle address to depth-first position
+    LArMCParticleHelper::MCRelationMap m_mcPrimaryMap; ///< The map from each input mc particle to its primary mc particle
+    pandora::MCParticleVector m_primaryMCParticles;    ///< The primary input mc particles, sorted by momentum
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline bool MCHierarchySnapshot::IsConsistent(const pandora::MCParticleList &mcParticleList, const pandora::CaloHitList &caloHitList) const
+{
+    return ((&mcParticleList == m_pMCParticleList) && (mcParticleList.size() == m_inputMCParticles.size()) &&
+        (&caloHitList == m_pCaloHitList) && (caloHitList.size() == m_nCaloHits));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline bool MCHierarchySnapshot::Contains(const pandora::MCParticle *const pMCParticle) const
+{
+    return (m_mcParticleToIdMap.count(pMCParticle) > 0);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline unsigned int MCHierarchySnapshot::GetNMCParticles() const
+{
+    return m_depthFirstMCParticles.size();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const pandora::MCParticle *MCHierarchySnapshot::GetMCParticle(const unsigned int id) const
+{
+    return m_depthFirstMCParticles.at(id);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const pandora::MCParticleVector &MCHierarchySnapshot::GetInputMCParticles() const
+{
+    return m_inputMCParticles;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const LArMCParticleHelper::MCRelationMap &MCHierarchySnapshot::GetMCPrimaryMap() const
+{
+    return m_mcPrimaryMap;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const pandora::MCParticleVector &MCHierarchySnapshot::GetPrimaryMCParticles() const
+{
+    return m_primaryMCParticles;
+}
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_MC_HIERARCHY_SNAPSHOT_H
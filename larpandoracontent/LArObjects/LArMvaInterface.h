@@ -81,6 +81,8 @@ public:
 
     typedef InitializedDouble MvaFeature;
     typedef std::vector<MvaFeature> MvaFeatureVector;
+    typedef std::vector<MvaFeatureVector> MvaFeatureMatrix;
+    typedef std::vector<double> DoubleVector;
     typedef std::map<std::string, MvaFeature> MvaFeatureMap;
 };
 
@@ -119,6 +121,22 @@ public:
      */
     virtual double CalculateProbability(const MvaTypes::MvaFeatureVector &features) const = 0;
 
+    /**
+     *  @brief  Calculate the classification scores for a number of sets of input features, based on the trained model
+     *
+     *  @param  featureMatrix the input features, one feature vector per example
+     *  @param  scores to receive the classification score for each example, in the order of the input feature vectors
+     */
+    virtual void CalculateClassificationScores(const MvaTypes::MvaFeatureMatrix &featureMatrix, MvaTypes::DoubleVector &scores) const;
+
+    /**
+     *  @brief  Calculate the classification probabilities for a number of sets of input features, based on the trained model
+     *
+     *  @param  featureMatrix the input features, one feature vector per example
+     *  @param  probabilities to receive the classification probability for each example, in the order of the input feature vectors
+     */
+    virtual void CalculateProbabilities(const MvaTypes::MvaFeatureMatrix &featureMatrix, MvaTypes::DoubleVector &probabilities) const;
+
     /**
      *  @brief  Destructor
      */
@@ -186,6 +204,25 @@ inline bool MvaTypes::InitializedDouble::IsInitialized() const
     return m_isInitialized;
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline void MvaInterface::CalculateClassificationScores(
+    const MvaTypes::MvaFeatureMatrix &featureMatrix, MvaTypes::DoubleVector &scores) const
+{
+    for (const MvaTypes::MvaFeatureVector &features : featureMatrix)
+        scores.push_back(this->CalculateClassificationScore(features));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline void MvaInterface::CalculateProbabilities(
+    const MvaTypes::MvaFeatureMatrix &featureMatrix, MvaTypes::DoubleVector &probabilities) const
+{
+    for (const MvaTypes::MvaFeatureVector &features : featureMatrix)
+        probabilities.push_back(this->CalculateProbability(features));
+}
+
 } // namespace lar_content
 
 #endif // #ifndef LAR_MVA_INTERFACE_H
@@ -0,0 +1,140 @@
+/**
+ *  @file   larpandoracontent/LArObjects/LArMvaTrainingExampleWriter.cc
+ *
+ *  @brief  Implementation of the lar mva training example writer class.
+ *
+ *  $Log: $
+ */
+
+#include "larpandoracontent/LArObjects/LArMvaTrainingExampleWriter.h"
+
+#include <chrono>
+#include <cstdint>
+#include <sstream>
+
+using namespace pandora;
+
+namespace lar_content
+{
+
+MvaTrainingExampleWriter::MvaTrainingExampleWriter(const std::string &fileName, const Format format, const unsigned int bufferSize) :
+    m_format(format),
+    m_buffer(bufferSize),
+    m_timestampTime(static_cast<std::time_t>(-1))
+{
+    // ATTN The buffer must be installed before the file is opened
+    if (!m_buffer.empty())
+        m_outfile.rdbuf()->pubsetbuf(m_buffer.data(), m_buffer.size());
+
+    const std::ios_base::openmode openMode((BINARY == m_format) ? (std::ios_base::app | std::ios_base::binary) : std::ios_base::app);
+    m_outfile.open(fileName, openMode);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+MvaTrainingExampleWriter::~MvaTrainingExampleWriter()
+{
+    (void)this->Flush();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool MvaTrainingExampleWriter::IsOpen() const
+{
+    return m_outfile.is_open();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+MvaTrainingExampleWriter::Format MvaTrainingExampleWriter::GetFormat() const
+{
+    return m_format;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode MvaTrainingExampleWriter::Write(const bool result, const MvaTypes::MvaFeatureVector &featureVector)
+{
+    const std::time_t time(std::chrono::system_clock::to_time_t(std::chrono::system_clock::now()));
+    std::string example;
+
+    // ATTN Encode the whole example before writing, so that an uninitialized feature leaves no partial example in the file
+    if (BINARY == m_format)
+    {
+        const std::int64_t timestamp(static_cast<std::int64_t>(time));
+        const std::uint32_t nFeatures(static_cast<std::uint32_t>(featureVector.size()));
+        const char resultByte(result ? 1 : 0);
+
+        example.reserve(sizeof(timestamp) + sizeof(nFeatures) + nFeatures * sizeof(double) + sizeof(resultByte));
+        example.append(reinterpret_cast<const char *>(&timestamp), sizeof(timestamp));
+        example.append(reinterpret_cast<const char *>(&nFeatures), sizeof(nFeatures));
+
+        for (const MvaTypes::MvaFeature &feature : featureVector)
+        {
+            const double value(feature.Get());
+            example.append(reinterpret_cast<const char *>(&value), sizeof(value));
+        }
+
+        example.push_back(resultByte);
+    }
+    else
+    {
+        const std::string delimiter(",");
+        std::ostringstream exampleStream;
+        exampleStream << delimiter;
+
+        for (const MvaTypes::MvaFeature &feature : featureVector)
+            exampleStream << feature.Get() << delimiter;
+
+        exampleStream << static_cast<int>(result) << '\n';
+        example = exampleStream.str();
+    }
+
+    const std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (!m_outfile.is_open())
+        return STATUS_CODE_FAILURE;
+
+    if (BINARY != m_format)
+        m_outfile << this->GetTimestampString(time);
+
+    m_outfile.write(example.data(), example.size());
+
+    return (m_outfile.good() ? STATUS_CODE_SUCCESS : STATUS_CODE_FAILURE);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode MvaTrainingExampleWriter::Flush()
+{
+    const std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (!m_outfile.is_open())
+        return STATUS_CODE_FAILURE;
+
+    m_outfile.flush();
+
+    return (m_outfile.good() ? STATUS_CODE_SUCCESS : STATUS_CODE_FAILURE);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const std::string &MvaTrainingExampleWriter::GetTimestampString(const std::time_t time)
+{
+    if (time == m_timestampTime)
+        return m_timestampString;
+
+    struct tm *pTimeInfo(localtime(&time));
+    char buffer[80];
+    strftime(buffer, 80, "%x_%X", pTimeInfo);
+
+    m_timestampTime = time;
+    m_timestampString = buffer;
+
+    if (!m_timestampString.empty() && m_timestampString.back() == '\n')
+        m_timestampString.pop_back();
+
+    return m_timestampString;
+}
+
+} // namespace lar_content
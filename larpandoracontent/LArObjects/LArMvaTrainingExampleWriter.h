@@ -0,0 +1,111 @@
+/**
+ *  @file   larpandoracontent/LArObjects/LArMvaTrainingExampleWriter.h
+ *
+ *  @brief  Header file for the lar mva training example writer class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_MVA_TRAINING_EXAMPLE_WRITER_H
+#define LAR_MVA_TRAINING_EXAMPLE_WRITER_H 1
+
+#include "larpandoracontent/LArObjects/LArMvaInterface.h"
+
+#include "Pandora/StatusCodes.h"
+
+#include <ctime>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace lar_content
+{
+
+/**
+ *  @brief  MvaTrainingExampleWriter class, keeping a training example file open for appending through a large buffer, so that the file
+ *          is opened once rather than once per example. Examples are written either as the text lines produced by
+ *          LArMvaHelper::ProduceTrainingExample (timestamp, features and result, comma separated), or as binary records, each holding
+ *          the timestamp as a 64-bit integer, the number of features as a 32-bit unsigned integer, the features as doubles and the result
+ *          as a single byte, all in native byte order.
+ */
+class MvaTrainingExampleWriter
+{
+public:
+    /**
+     *  @brief  Format enumeration
+     */
+    enum Format
+    {
+        TEXT,
+        BINARY
+    };
+
+    /**
+     *  @brief  Constructor, opening the file in append mode
+     *
+     *  @param  fileName the name of the training example file
+     *  @param  format the format in which to write examples
+     *  @param  bufferSize the size of the output buffer, in bytes
+     */
+    MvaTrainingExampleWriter(const std::string &fileName, const Format format = TEXT, const unsigned int bufferSize = 1 << 20);
+
+    /**
+     *  @brief  Destructor, flushing any buffered examples
+     */
+    ~MvaTrainingExampleWriter();
+
+    MvaTrainingExampleWriter(const MvaTrainingExampleWriter &) = delete;
+    MvaTrainingExampleWriter &operator=(const MvaTrainingExampleWriter &) = delete;
+
+    /**
+     *  @brief  Whether the file was opened successfully
+     *
+     *  @return boolean
+     */
+    bool IsOpen() const;
+
+    /**
+     *  @brief  Get the format in which examples are written
+     *
+     *  @return the format
+     */
+    Format GetFormat() const;
+
+    /**
+     *  @brief  Write a training example
+     *
+     *  @param  result the example result
+     *  @param  featureVector the example features
+     *
+     *  @return success
+     */
+    pandora::StatusCode Write(const bool result, const MvaTypes::MvaFeatureVector &featureVector);
+
+    /**
+     *  @brief  Flush any buffered examples to the file
+     *
+     *  @return success
+     */
+    pandora::StatusCode Flush();
+
+private:
+    /**
+     *  @brief  Get the timestamp string for a given time, as written with text examples
+     *
+     *  @param  time the time
+     *
+     *  @return the timestamp string
+     */
+    const std::string &GetTimestampString(const std::time_t time);
+
+    Format m_format;               ///< The format in which to write examples
+    std::vector<char> m_buffer;    ///< The output buffer
+    std::ofstream m_outfile;       ///< The output file stream
+    std::mutex m_mutex;            ///< The mutex guarding writes to the output file stream
+    std::time_t m_timestampTime;   ///< The time for which the timestamp string was last formatted
+    std::string m_timestampString; ///< The last formatted timestamp string
+};
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_MVA_TRAINING_EXAMPLE_WRITER_H
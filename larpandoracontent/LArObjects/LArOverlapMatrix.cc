@@ -29,16 +29,41 @@ namespace lar_content
 template <typename T>
 void OverlapMatrix<T>::GetUnambiguousElements(const bool ignoreUnavailable, ElementList &elementList) const
 {
+    // ATTN Navigation is two-way, 1<->2, so exploring from any view 1 cluster in a connected group yields the same outcome
+    ClusterSet ambiguousClusters1;
+    std::unordered_map<const Cluster *, const Cluster *> unambiguousClusters2;
+
     for (typename TheMatrix::const_iterator iter1 = this->begin(), iter1End = this->end(); iter1 != iter1End; ++iter1)
     {
-        ElementList tempElementList;
-        ClusterList clusterList1, clusterList2;
-        this->GetConnectedElements(iter1->first, ignoreUnavailable, tempElementList, clusterList1, clusterList2);
+        if (m_pKeyClusterFilter && !m_pKeyClusterFilter->count(iter1->first))
+            continue;
 
-        const Cluster *pCluster1(nullptr), *pCluster2(nullptr);
-        if (!this->DefaultAmbiguityFunction(clusterList1, clusterList2, pCluster1, pCluster2))
+        if (ambiguousClusters1.count(iter1->first))
             continue;
 
+        const Cluster *pCluster1(nullptr), *pCluster2(nullptr);
+        const auto unambiguousIter(unambiguousClusters2.find(iter1->first));
+
+        if (unambiguousClusters2.end() != unambiguousIter)
+        {
+            pCluster1 = unambiguousIter->first;
+            pCluster2 = unambiguousIter->second;
+        }
+        else
+        {
+            ElementList tempElementList;
+            ClusterList clusterList1, clusterList2;
+            this->GetConnectedElements(iter1->first, ignoreUnavailable, tempElementList, clusterList1, clusterList2);
+
+            if (!this->DefaultAmbiguityFunction(clusterList1, clusterList2, pCluster1, pCluster2))
+            {
+                ambiguousClusters1.insert(clusterList1.begin(), clusterList1.end());
+                continue;
+            }
+
+            unambiguousClusters2[pCluster1] = pCluster2;
+        }
+
         // ATTN With HIT_CUSTOM definitions, it is possible to navigate from different view 1 clusters to same combination
         if (iter1->first != pCluster1)
             continue;
@@ -50,8 +75,7 @@ void OverlapMatrix<T>::GetUnambiguousElements(const bool ignoreUnavailable, Elem
         if (iter1->second.end() == iter2)
             throw StatusCodeException(STATUS_CODE_FAILURE);
 
-        Element element(pCluster1, pCluster2, iter2->second);
-        elementList.push_back(element);
+        elementList.emplace_back(pCluster1, pCluster2, iter2->second);
     }
 
     std::sort(elementList.begin(), elementList.end());
@@ -90,13 +114,59 @@ template <typename T>
 void OverlapMatrix<T>::GetSortedKeyClusters(ClusterVector &sortedKeyClusters) const
 {
     for (typename TheMatrix::const_iterator iter1 = this->begin(), iter1End = this->end(); iter1 != iter1End; ++iter1)
+    {
+        if (m_pKeyClusterFilter && !m_pKeyClusterFilter->count(iter1->first))
+            continue;
+
         sortedKeyClusters.push_back(iter1->first);
+    }
 
     std::sort(sortedKeyClusters.begin(), sortedKeyClusters.end(), LArClusterHelper::SortByNHits);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+template <typename T>
+void OverlapMatrix<T>::GetConnectedClusters(const ClusterSet &seedClusters, ClusterSet &connectedClusters) const
+{
+    std::unordered_map<const Cluster *, ClusterVector> linkedClustersMap;
+    const std::vector<const ClusterNavigationMap *> navigationMaps{&m_clusterNavigationMap12, &m_clusterNavigationMap21};
+
+    for (const ClusterNavigationMap *const pNavigationMap : navigationMaps)
+    {
+        for (const ClusterNavigationMap::value_type &mapEntry : *pNavigationMap)
+        {
+            for (const Cluster *const pLinkedCluster : mapEntry.second)
+            {
+                linkedClustersMap[mapEntry.first].push_back(pLinkedCluster);
+                linkedClustersMap[pLinkedCluster].push_back(mapEntry.first);
+            }
+        }
+    }
+
+    ClusterVector clustersToExplore;
+
+    for (const Cluster *const pSeedCluster : seedClusters)
+    {
+        if (linkedClustersMap.count(pSeedCluster) && connectedClusters.insert(pSeedCluster).second)
+            clustersToExplore.push_back(pSeedCluster);
+    }
+
+    while (!clustersToExplore.empty())
+    {
+        const Cluster *const pCluster(clustersToExplore.back());
+        clustersToExplore.pop_back();
+
+        for (const Cluster *const pLinkedCluster : linkedClustersMap.at(pCluster))
+        {
+            if (connectedClusters.insert(pLinkedCluster).second)
+                clustersToExplore.push_back(pLinkedCluster);
+        }
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template <typename T>
 void OverlapMatrix<T>::SetOverlapResult(const pandora::Cluster *const pCluster1, const pandora::Cluster *const pCluster2, const OverlapResult &overlapResult)
 {
@@ -109,6 +179,8 @@ void OverlapMatrix<T>::SetOverlapResult(const pandora::Cluster *const pCluster1,
     if (!overlapList.insert(typename OverlapList::value_type(pCluster2, overlapResult)).second)
         throw pandora::StatusCodeException(pandora::STATUS_CODE_FAILURE);
 
+    m_memoryRecord.Allocate(LArMemoryAccountingHelper::GetNodeBytes<typename OverlapList::value_type>());
+
     ClusterList &navigation12(m_clusterNavigationMap12[pCluster1]);
     ClusterList &navigation21(m_clusterNavigationMap21[pCluster2]);
 
@@ -148,7 +220,10 @@ void OverlapMatrix<T>::RemoveCluster(const pandora::Cluster *const pCluster)
         typename TheMatrix::iterator iter = m_overlapMatrix.find(pCluster);
 
         if (m_overlapMatrix.end() != iter)
+        {
+            m_memoryRecord.Deallocate(iter->second.size() * LArMemoryAccountingHelper::GetNodeBytes<typename OverlapList::value_type>());
             m_overlapMatrix.erase(iter);
+        }
 
         for (ClusterNavigationMap::iterator navIter = m_clusterNavigationMap21.begin(); navIter != m_clusterNavigationMap21.end();)
         {
@@ -170,7 +245,10 @@ void OverlapMatrix<T>::RemoveCluster(const pandora::Cluster *const pCluster)
             typename OverlapList::iterator iter = iter1->second.find(pCluster);
 
             if (iter1->second.end() != iter)
+            {
+                m_memoryRecord.Deallocate(LArMemoryAccountingHelper::GetNodeBytes<typename OverlapList::value_type>());
                 iter1->second.erase(iter);
+            }
         }
 
         for (ClusterNavigationMap::iterator navIter = m_clusterNavigationMap12.begin(); navIter != m_clusterNavigationMap12.end();)
@@ -216,8 +294,7 @@ void OverlapMatrix<T>::GetConnectedElements(const Cluster *const pCluster, const
             if (ignoreUnavailable && (!iter1->first->IsAvailable() || !iter2->first->IsAvailable()))
                 continue;
 
-            Element element(iter1->first, iter2->first, iter2->second);
-            elementList.push_back(element);
+            elementList.emplace_back(iter1->first, iter2->first, iter2->second);
 
             if (clusterList1.end() == std::find(clusterList1.begin(), clusterList1.end(), iter1->first))
                 clusterList1.push_back(iter1->first);
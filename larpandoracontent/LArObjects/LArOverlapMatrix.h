@@ -10,6 +10,8 @@
 
 #include "Pandora/PandoraInternal.h"
 
+#include "larpandoracontent/LArHelpers/LArMemoryAccountingHelper.h"
+
 #include <unordered_map>
 #include <vector>
 
@@ -25,6 +27,11 @@ class OverlapMatrix
 public:
     typedef T OverlapResult;
 
+    /**
+     *  @brief  Default constructor
+     */
+    OverlapMatrix();
+
     /**
      *  @brief  Element class
      */
@@ -151,6 +158,23 @@ public:
      */
     void GetSortedKeyClusters(pandora::ClusterVector &sortedKeyClusters) const;
 
+    /**
+     *  @brief  Restrict the key clusters provided by GetSortedKeyClusters and explored by GetUnambiguousElements to those in a given set,
+     *          which should hold whole groups of connected clusters, or lift the restriction
+     *
+     *  @param  pKeyClusterFilter address of the set of permitted key clusters, which must outlive the restriction, or nullptr to lift it
+     */
+    void SetKeyClusterFilter(const pandora::ClusterSet *const pKeyClusterFilter);
+
+    /**
+     *  @brief  Get the clusters connected to any of a set of seed clusters, following the cluster navigation maps in both directions and
+     *          including unavailable clusters. Seed clusters are not dereferenced, so may include deleted clusters, which are ignored
+     *
+     *  @param  seedClusters the set of seed clusters
+     *  @param  connectedClusters to receive the connected clusters, in both views, including the seed clusters present in the matrix
+     */
+    void GetConnectedClusters(const pandora::ClusterSet &seedClusters, pandora::ClusterSet &connectedClusters) const;
+
     /**
      *  @brief  Get the overlap result for a specified pair of clusters
      *
@@ -236,13 +260,24 @@ private:
     void ExploreConnections(const pandora::Cluster *const pCluster, const bool ignoreUnavailable, pandora::ClusterList &clusterList1,
         pandora::ClusterList &clusterList2) const;
 
-    TheMatrix m_overlapMatrix;                     ///< The overlap matrix
-    ClusterNavigationMap m_clusterNavigationMap12; ///< The cluster navigation map 1->2
-    ClusterNavigationMap m_clusterNavigationMap21; ///< The cluster navigation map 2->1
+    TheMatrix m_overlapMatrix;                              ///< The overlap matrix
+    ClusterNavigationMap m_clusterNavigationMap12;          ///< The cluster navigation map 1->2
+    ClusterNavigationMap m_clusterNavigationMap21;          ///< The cluster navigation map 2->1
+    const pandora::ClusterSet *m_pKeyClusterFilter;         ///< The address of the set of permitted key clusters, nullptr if unrestricted
+    LArMemoryAccountingHelper::MemoryRecord m_memoryRecord; ///< The memory accounting record for the overlap results
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+template <typename T>
+inline OverlapMatrix<T>::OverlapMatrix() :
+    m_pKeyClusterFilter(nullptr),
+    m_memoryRecord(LArMemoryAccountingHelper::OVERLAP_CONTAINER_MEMORY)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template <typename T>
 inline void OverlapMatrix<T>::GetNConnections(const pandora::Cluster *const pCluster, const bool ignoreUnavailable, unsigned int &n1, unsigned int &n2) const
 {
@@ -261,6 +296,14 @@ inline void OverlapMatrix<T>::GetConnectedElements(const pandora::Cluster *const
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+template <typename T>
+inline void OverlapMatrix<T>::SetKeyClusterFilter(const pandora::ClusterSet *const pKeyClusterFilter)
+{
+    m_pKeyClusterFilter = pKeyClusterFilter;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template <typename T>
 inline typename OverlapMatrix<T>::const_iterator OverlapMatrix<T>::begin() const
 {
@@ -327,6 +370,8 @@ inline void OverlapMatrix<T>::Clear()
     m_overlapMatrix.clear();
     m_clusterNavigationMap12.clear();
     m_clusterNavigationMap21.clear();
+    m_pKeyClusterFilter = nullptr;
+    m_memoryRecord.Clear();
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
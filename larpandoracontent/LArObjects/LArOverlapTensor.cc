@@ -43,6 +43,10 @@ void OverlapTensor<T>::GetUnambiguousElements(const bool ignoreUnavailable, Elem
 {
     for (typename TheTensor::const_iterator iterU = this->begin(), iterUEnd = this->end(); iterU != iterUEnd; ++iterU)
     {
+        if (m_pKeyClusterFilter && !m_pKeyClusterFilter->count(iterU->first))
+            continue;
+
+        // ATTN Navigation is one-way, U->V->W->U, so the connected group found depends on the u cluster explored from
         ElementList tempElementList;
         ClusterList clusterListU, clusterListV, clusterListW;
         this->GetConnectedElements(iterU->first, ignoreUnavailable, tempElementList, clusterListU, clusterListV, clusterListW);
@@ -66,8 +70,7 @@ void OverlapTensor<T>::GetUnambiguousElements(const bool ignoreUnavailable, Elem
         if (iterV->second.end() == iterW)
             throw StatusCodeException(STATUS_CODE_FAILURE);
 
-        Element element(pClusterU, pClusterV, pClusterW, iterW->second);
-        elementList.push_back(element);
+        elementList.emplace_back(pClusterU, pClusterV, pClusterW, iterW->second);
     }
 
     std::sort(elementList.begin(), elementList.end());
@@ -108,13 +111,61 @@ template <typename T>
 void OverlapTensor<T>::GetSortedKeyClusters(ClusterVector &sortedKeyClusters) const
 {
     for (typename TheTensor::const_iterator iterU = this->begin(), iterUEnd = this->end(); iterU != iterUEnd; ++iterU)
+    {
+        if (m_pKeyClusterFilter && !m_pKeyClusterFilter->count(iterU->first))
+            continue;
+
         sortedKeyClusters.push_back(iterU->first);
+    }
 
     std::sort(sortedKeyClusters.begin(), sortedKeyClusters.end(), LArClusterHelper::SortByNHits);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+template <typename T>
+void OverlapTensor<T>::GetConnectedClusters(const ClusterSet &seedClusters, ClusterSet &connectedClusters) const
+{
+    // ATTN Navigation is one-way, U->V->W->U, so collect links in both directions to find every cluster from which a seed can be reached
+    std::unordered_map<const Cluster *, ClusterVector> linkedClustersMap;
+    const std::vector<const ClusterNavigationMap *> navigationMaps{
+        &m_clusterNavigationMapUV, &m_clusterNavigationMapVW, &m_clusterNavigationMapWU};
+
+    for (const ClusterNavigationMap *const pNavigationMap : navigationMaps)
+    {
+        for (const ClusterNavigationMap::value_type &mapEntry : *pNavigationMap)
+        {
+            for (const Cluster *const pLinkedCluster : mapEntry.second)
+            {
+                linkedClustersMap[mapEntry.first].push_back(pLinkedCluster);
+                linkedClustersMap[pLinkedCluster].push_back(mapEntry.first);
+            }
+        }
+    }
+
+    ClusterVector clustersToExplore;
+
+    for (const Cluster *const pSeedCluster : seedClusters)
+    {
+        if (linkedClustersMap.count(pSeedCluster) && connectedClusters.insert(pSeedCluster).second)
+            clustersToExplore.push_back(pSeedCluster);
+    }
+
+    while (!clustersToExplore.empty())
+    {
+        const Cluster *const pCluster(clustersToExplore.back());
+        clustersToExplore.pop_back();
+
+        for (const Cluster *const pLinkedCluster : linkedClustersMap.at(pCluster))
+        {
+            if (connectedClusters.insert(pLinkedCluster).second)
+                clustersToExplore.push_back(pLinkedCluster);
+        }
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template <typename T>
 void OverlapTensor<T>::SetOverlapResult(const pandora::Cluster *const pClusterU, const pandora::Cluster *const pClusterV,
     const pandora::Cluster *const pClusterW, const OverlapResult &overlapResult)
@@ -128,6 +179,8 @@ void OverlapTensor<T>::SetOverlapResult(const pandora::Cluster *const pClusterU,
     if (!overlapList.insert(typename OverlapList::value_type(pClusterW, overlapResult)).second)
         throw pandora::StatusCodeException(pandora::STATUS_CODE_FAILURE);
 
+    m_memoryRecord.Allocate(LArMemoryAccountingHelper::GetNodeBytes<typename OverlapList::value_type>());
+
     ClusterList &navigationUV(m_clusterNavigationMapUV[pClusterU]);
     ClusterList &navigationVW(m_clusterNavigationMapVW[pClusterV]);
     ClusterList &navigationWU(m_clusterNavigationMapWU[pClusterW]);
@@ -169,6 +222,7 @@ void OverlapTensor<T>::ReplaceOverlapResult(const pandora::Cluster *const pClust
 template <typename T>
 void OverlapTensor<T>::RemoveCluster(const pandora::Cluster *const pCluster)
 {
+    const std::size_t elementBytes(LArMemoryAccountingHelper::GetNodeBytes<typename OverlapList::value_type>());
     ClusterList additionalRemovals;
 
     if (m_clusterNavigationMapUV.erase(pCluster) > 0)
@@ -176,7 +230,12 @@ void OverlapTensor<T>::RemoveCluster(const pandora::Cluster *const pCluster)
         typename TheTensor::iterator iter = m_overlapTensor.find(pCluster);
 
         if (m_overlapTensor.end() != iter)
+        {
+            for (const typename OverlapMatrix::value_type &mapEntryV : iter->second)
+                m_memoryRecord.Deallocate(mapEntryV.second.size() * elementBytes);
+
             m_overlapTensor.erase(iter);
+        }
 
         for (ClusterNavigationMap::iterator navIter = m_clusterNavigationMapWU.begin(); navIter != m_clusterNavigationMapWU.end();)
         {
@@ -198,7 +257,10 @@ void OverlapTensor<T>::RemoveCluster(const pandora::Cluster *const pCluster)
             typename OverlapMatrix::iterator iter = iterU->second.find(pCluster);
 
             if (iterU->second.end() != iter)
+            {
+                m_memoryRecord.Deallocate(iter->second.size() * elementBytes);
                 iterU->second.erase(iter);
+            }
         }
 
         for (ClusterNavigationMap::iterator navIter = m_clusterNavigationMapUV.begin(); navIter != m_clusterNavigationMapUV.end();)
@@ -223,7 +285,10 @@ void OverlapTensor<T>::RemoveCluster(const pandora::Cluster *const pCluster)
                 typename OverlapList::iterator iter = iterV->second.find(pCluster);
 
                 if (iterV->second.end() != iter)
+                {
+                    m_memoryRecord.Deallocate(elementBytes);
                     iterV->second.erase(iter);
+                }
             }
         }
 
@@ -253,7 +318,8 @@ void OverlapTensor<T>::GetConnectedElements(const Cluster *const pCluster, const
     ClusterList &clusterListU, ClusterList &clusterListV, ClusterList &clusterListW) const
 {
     ClusterList localClusterListU, localClusterListV, localClusterListW;
-    this->ExploreConnections(pCluster, ignoreUnavailable, localClusterListU, localClusterListV, localClusterListW);
+    ClusterSet exploredClusters;
+    this->ExploreConnections(pCluster, ignoreUnavailable, localClusterListU, localClusterListV, localClusterListW, exploredClusters);
 
     // ATTN Now need to check that all clusters received are from fully available tensor elements
     elementList.clear();
@@ -261,9 +327,12 @@ void OverlapTensor<T>::GetConnectedElements(const Cluster *const pCluster, const
     clusterListV.clear();
     clusterListW.clear();
 
+    const ClusterSet connectedClustersU(localClusterListU.begin(), localClusterListU.end());
+    ClusterSet foundClustersU, foundClustersV, foundClustersW;
+
     for (typename TheTensor::const_iterator iterU = this->begin(), iterUEnd = this->end(); iterU != iterUEnd; ++iterU)
     {
-        if (localClusterListU.end() == std::find(localClusterListU.begin(), localClusterListU.end(), iterU->first))
+        if (!connectedClustersU.count(iterU->first))
             continue;
 
         for (typename OverlapMatrix::const_iterator iterV = iterU->second.begin(), iterVEnd = iterU->second.end(); iterV != iterVEnd; ++iterV)
@@ -273,14 +342,13 @@ void OverlapTensor<T>::GetConnectedElements(const Cluster *const pCluster, const
                 if (ignoreUnavailable && (!iterU->first->IsAvailable() || !iterV->first->IsAvailable() || !iterW->first->IsAvailable()))
                     continue;
 
-                Element element(iterU->first, iterV->first, iterW->first, iterW->second);
-                elementList.push_back(element);
+                elementList.emplace_back(iterU->first, iterV->first, iterW->first, iterW->second);
 
-                if (clusterListU.end() == std::find(clusterListU.begin(), clusterListU.end(), iterU->first))
+                if (foundClustersU.insert(iterU->first).second)
                     clusterListU.push_back(iterU->first);
-                if (clusterListV.end() == std::find(clusterListV.begin(), clusterListV.end(), iterV->first))
+                if (foundClustersV.insert(iterV->first).second)
                     clusterListV.push_back(iterV->first);
-                if (clusterListW.end() == std::find(clusterListW.begin(), clusterListW.end(), iterW->first))
+                if (foundClustersW.insert(iterW->first).second)
                     clusterListW.push_back(iterW->first);
             }
         }
@@ -293,7 +361,7 @@ void OverlapTensor<T>::GetConnectedElements(const Cluster *const pCluster, const
 
 template <typename T>
 void OverlapTensor<T>::ExploreConnections(const Cluster *const pCluster, const bool ignoreUnavailable, ClusterList &clusterListU,
-    ClusterList &clusterListV, ClusterList &clusterListW) const
+    ClusterList &clusterListV, ClusterList &clusterListW, ClusterSet &exploredClusters) const
 {
     if (ignoreUnavailable && !pCluster->IsAvailable())
         return;
@@ -307,7 +375,7 @@ void OverlapTensor<T>::ExploreConnections(const Cluster *const pCluster, const b
     const ClusterNavigationMap &navigationMap(
         (TPC_VIEW_U == hitType) ? m_clusterNavigationMapUV : (TPC_VIEW_V == hitType) ? m_clusterNavigationMapVW : m_clusterNavigationMapWU);
 
-    if (clusterList.end() != std::find(clusterList.begin(), clusterList.end(), pCluster))
+    if (!exploredClusters.insert(pCluster).second)
         return;
 
     clusterList.push_back(pCluster);
@@ -317,7 +385,7 @@ void OverlapTensor<T>::ExploreConnections(const Cluster *const pCluster, const b
         throw StatusCodeException(STATUS_CODE_FAILURE);
 
     for (ClusterList::const_iterator cIter = iter->second.begin(), cIterEnd = iter->second.end(); cIter != cIterEnd; ++cIter)
-        this->ExploreConnections(*cIter, ignoreUnavailable, clusterListU, clusterListV, clusterListW);
+        this->ExploreConnections(*cIter, ignoreUnavailable, clusterListU, clusterListV, clusterListW, exploredClusters);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
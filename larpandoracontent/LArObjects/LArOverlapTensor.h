@@ -10,6 +10,8 @@
 
 #include "Pandora/PandoraInternal.h"
 
+#include "larpandoracontent/LArHelpers/LArMemoryAccountingHelper.h"
+
 #include <unordered_map>
 #include <vector>
 
@@ -25,6 +27,11 @@ class OverlapTensor
 public:
     typedef T OverlapResult;
 
+    /**
+     *  @brief  Default constructor
+     */
+    OverlapTensor();
+
     /**
      *  @brief  Element class
      */
@@ -176,6 +183,23 @@ public:
      */
     void GetSortedKeyClusters(pandora::ClusterVector &sortedKeyClusters) const;
 
+    /**
+     *  @brief  Restrict the key clusters provided by GetSortedKeyClusters and explored by GetUnambiguousElements to those in a given set,
+     *          which should hold whole groups of connected clusters, or lift the restriction
+     *
+     *  @param  pKeyClusterFilter address of the set of permitted key clusters, which must outlive the restriction, or nullptr to lift it
+     */
+    void SetKeyClusterFilter(const pandora::ClusterSet *const pKeyClusterFilter);
+
+    /**
+     *  @brief  Get the clusters connected to any of a set of seed clusters, following the cluster navigation maps in both directions and
+     *          including unavailable clusters. Seed clusters are not dereferenced, so may include deleted clusters, which are ignored
+     *
+     *  @param  seedClusters the set of seed clusters
+     *  @param  connectedClusters to receive the connected clusters, in all views, including the seed clusters present in the tensor
+     */
+    void GetConnectedClusters(const pandora::ClusterSet &seedClusters, pandora::ClusterSet &connectedClusters) const;
+
     /**
      *  @brief  Get the overlap result for a specified trio of clusters
      *
@@ -282,18 +306,30 @@ private:
      *  @param  clusterListU connected u clusters
      *  @param  clusterListV connected v clusters
      *  @param  clusterListW connected w clusters
+     *  @param  exploredClusters the set of clusters already explored, in any view
      */
     void ExploreConnections(const pandora::Cluster *const pCluster, const bool ignoreUnavailable, pandora::ClusterList &clusterListU,
-        pandora::ClusterList &clusterListV, pandora::ClusterList &clusterListW) const;
-
-    TheTensor m_overlapTensor;                     ///< The overlap tensor
-    ClusterNavigationMap m_clusterNavigationMapUV; ///< The cluster navigation map U->V
-    ClusterNavigationMap m_clusterNavigationMapVW; ///< The cluster navigation map V->W
-    ClusterNavigationMap m_clusterNavigationMapWU; ///< The cluster navigation map W->U
+        pandora::ClusterList &clusterListV, pandora::ClusterList &clusterListW, pandora::ClusterSet &exploredClusters) const;
+
+    TheTensor m_overlapTensor;                              ///< The overlap tensor
+    ClusterNavigationMap m_clusterNavigationMapUV;          ///< The cluster navigation map U->V
+    ClusterNavigationMap m_clusterNavigationMapVW;          ///< The cluster navigation map V->W
+    ClusterNavigationMap m_clusterNavigationMapWU;          ///< The cluster navigation map W->U
+    const pandora::ClusterSet *m_pKeyClusterFilter;         ///< The address of the set of permitted key clusters, nullptr if unrestricted
+    LArMemoryAccountingHelper::MemoryRecord m_memoryRecord; ///< The memory accounting record for the overlap results
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+template <typename T>
+inline OverlapTensor<T>::OverlapTensor() :
+    m_pKeyClusterFilter(nullptr),
+    m_memoryRecord(LArMemoryAccountingHelper::OVERLAP_CONTAINER_MEMORY)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template <typename T>
 inline void OverlapTensor<T>::GetNConnections(
     const pandora::Cluster *const pCluster, const bool ignoreUnavailable, unsigned int &nU, unsigned int &nV, unsigned int &nW) const
@@ -313,6 +349,14 @@ inline void OverlapTensor<T>::GetConnectedElements(const pandora::Cluster *const
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+template <typename T>
+inline void OverlapTensor<T>::SetKeyClusterFilter(const pandora::ClusterSet *const pKeyClusterFilter)
+{
+    m_pKeyClusterFilter = pKeyClusterFilter;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template <typename T>
 inline typename OverlapTensor<T>::const_iterator OverlapTensor<T>::begin() const
 {
@@ -403,6 +447,8 @@ inline void OverlapTensor<T>::Clear()
     m_clusterNavigationMapUV.clear();
     m_clusterNavigationMapVW.clear();
     m_clusterNavigationMapWU.clear();
+    m_pKeyClusterFilter = nullptr;
+    m_memoryRecord.Clear();
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
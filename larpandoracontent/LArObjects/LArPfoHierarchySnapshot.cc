@@ -0,0 +1,245 @@
+/**
+ *  @file   larpandoracontent/LArObjects/LArPfoHierarchySnapshot.cc
+ *
+ *  @brief  Implementation of the lar pfo hierarchy snapshot class.
+ *
+ *  $Log: $
+ */
+
+#include "Objects/Cluster.h"
+#include "Objects/ParticleFlowObject.h"
+
+#include "larpandoracontent/LArHelpers/LArClusterHelper.h"
+#include "larpandoracontent/LArHelpers/LArPfoHelper.h"
+
+#include "larpandoracontent/LArObjects/LArPfoHierarchySnapshot.h"
+
+using namespace pandora;
+
+namespace lar_content
+{
+
+PfoHierarchySnapshot::PfoHierarchySnapshot(const PfoList &pfoList)
+{
+    for (const ParticleFlowObject *const pPfo : pfoList)
+    {
+        const ParticleFlowObject *pRootPfo(pPfo);
+
+        while (!pRootPfo->GetParentPfoList().empty())
+        {
+            if (1 != pRootPfo->GetParentPfoList().size())
+                throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+            pRootPfo = pRootPfo->GetParentPfoList().front();
+        }
+
+        if (this->Contains(pRootPfo))
+            continue;
+
+        m_rootPfos.push_back(pRootPfo);
+        this->AddDepthFirst(pRootPfo, 0, m_depthFirstPfos.size());
+    }
+
+    m_breadthFirstPfos.resize(m_depthFirstPfos.size(), nullptr);
+
+    for (const ParticleFlowObject *const pRootPfo : m_rootPfos)
+        this->AddBreadthFirst(this->GetIndex(pRootPfo));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const ParticleFlowObject *PfoHierarchySnapshot::GetRootPfo(const ParticleFlowObject *const pPfo) const
+{
+    return m_depthFirstPfos[m_pfoEntries[this->GetIndex(pPfo)].m_rootIndex];
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const ParticleFlowObject *PfoHierarchySnapshot::GetParentNeutrino(const ParticleFlowObject *const pPfo) const
+{
+    const ParticleFlowObject *const pRootPfo(this->GetRootPfo(pPfo));
+
+    if (!LArPfoHelper::IsNeutrino(pRootPfo))
+        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
+
+    return pRootPfo;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+int PfoHierarchySnapshot::GetHierarchyTier(const ParticleFlowObject *const pPfo) const
+{
+    return m_pfoEntries[this->GetIndex(pPfo)].m_tier;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+unsigned int PfoHierarchySnapshot::GetNDownstreamPfos(const ParticleFlowObject *const pPfo) const
+{
+    const unsigned int index(this->GetIndex(pPfo));
+    return (m_pfoEntries[index].m_endIndex - index);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool PfoHierarchySnapshot::IsDownstream(const ParticleFlowObject *const pAncestorPfo, const ParticleFlowObject *const pPfo) const
+{
+    const unsigned int ancestorIndex(this->GetIndex(pAncestorPfo)), index(this->GetIndex(pPfo));
+    return ((index >= ancestorIndex) && (index < m_pfoEntries[ancestorIndex].m_endIndex));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+unsigned int PfoHierarchySnapshot::GetNDownstreamHits(
+    const ParticleFlowObject *const pPfo, const HitType hitType, const bool includeIsolatedHits) const
+{
+    unsigned int hitTypeIndex(0);
+
+    if (!PfoHierarchySnapshot::GetHitTypeIndex(hitType, hitTypeIndex))
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+    const PfoEntry &pfoEntry(m_pfoEntries[this->GetIndex(pPfo)]);
+    return (pfoEntry.m_nHits[hitTypeIndex] + (includeIsolatedHits ? pfoEntry.m_nIsolatedHits[hitTypeIndex] : 0));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+unsigned int PfoHierarchySnapshot::GetNDownstreamTwoDHits(const ParticleFlowObject *const pPfo, const bool includeIsolatedHits) const
+{
+    const unsigned int nHitsU(this->GetNDownstreamHits(pPfo, TPC_VIEW_U, includeIsolatedHits));
+    const unsigned int nHitsV(this->GetNDownstreamHits(pPfo, TPC_VIEW_V, includeIsolatedHits));
+    const unsigned int nHitsW(this->GetNDownstreamHits(pPfo, TPC_VIEW_W, includeIsolatedHits));
+
+    return (nHitsU + nHitsV + nHitsW);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void PfoHierarchySnapshot::GetAllDownstreamPfos(const ParticleFlowObject *const pPfo, PfoList &outputPfoList) const
+{
+    const unsigned int index(this->GetIndex(pPfo));
+    outputPfoList.insert(outputPfoList.end(), m_depthFirstPfos.begin() + index, m_depthFirstPfos.begin() + m_pfoEntries[index].m_endIndex);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void PfoHierarchySnapshot::GetHierarchyPfos(const ParticleFlowObject *const pPfo, PfoList &outputPfoList) const
+{
+    const unsigned int rootIndex(m_pfoEntries[this->GetIndex(pPfo)].m_rootIndex);
+    const unsigned int endIndex(m_pfoEntries[rootIndex].m_endIndex);
+    outputPfoList.insert(outputPfoList.end(), m_depthFirstPfos.begin() + rootIndex, m_depthFirstPfos.begin() + endIndex);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void PfoHierarchySnapshot::GetBreadthFirstHierarchyRepresentation(const ParticleFlowObject *const pPfo, PfoList &pfoList) const
+{
+    const unsigned int rootIndex(m_pfoEntries[this->GetIndex(pPfo)].m_rootIndex);
+    const unsigned int endIndex(m_pfoEntries[rootIndex].m_endIndex);
+    pfoList.insert(pfoList.end(), m_breadthFirstPfos.begin() + rootIndex, m_breadthFirstPfos.begin() + endIndex);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+unsigned int PfoHierarchySnapshot::GetIndex(const ParticleFlowObject *const pPfo) const
+{
+    const PfoToIndexMap::const_iterator iter(m_pfoToIndexMap.find(pPfo));
+
+    if (m_pfoToIndexMap.end() == iter)
+        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
+
+    return iter->second;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool PfoHierarchySnapshot::GetHitTypeIndex(const HitType hitType, unsigned int &hitTypeIndex)
+{
+    switch (hitType)
+    {
+        case TPC_VIEW_U:
+            hitTypeIndex = 0;
+            return true;
+        case TPC_VIEW_V:
+            hitTypeIndex = 1;
+            return true;
+        case TPC_VIEW_W:
+            hitTypeIndex = 2;
+            return true;
+        case TPC_3D:
+            hitTypeIndex = 3;
+            return true;
+        default:
+            return false;
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void PfoHierarchySnapshot::CountHits(const ParticleFlowObject *const pPfo, PfoEntry &pfoEntry)
+{
+    for (const Cluster *const pCluster : pPfo->GetClusterList())
+    {
+        if (0 == pCluster->GetNCaloHits())
+            continue;
+
+        unsigned int hitTypeIndex(0);
+
+        if (!PfoHierarchySnapshot::GetHitTypeIndex(LArClusterHelper::GetClusterHitType(pCluster), hitTypeIndex))
+            continue;
+
+        pfoEntry.m_nHits[hitTypeIndex] += pCluster->GetNCaloHits();
+        pfoEntry.m_nIsolatedHits[hitTypeIndex] += pCluster->GetNIsolatedCaloHits();
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void PfoHierarchySnapshot::AddDepthFirst(const ParticleFlowObject *const pPfo, const int tier, const unsigned int rootIndex)
+{
+    const unsigned int index(m_depthFirstPfos.size());
+
+    if (!m_pfoToIndexMap.insert(PfoToIndexMap::value_type(pPfo, index)).second)
+        throw StatusCodeException(STATUS_CODE_ALREADY_PRESENT);
+
+    m_depthFirstPfos.push_back(pPfo);
+    m_pfoEntries.push_back(PfoEntry{tier, rootIndex, index + 1, HitCountArray(), HitCountArray()});
+    PfoHierarchySnapshot::CountHits(pPfo, m_pfoEntries.back());
+
+    for (const ParticleFlowObject *const pDaughterPfo : pPfo->GetDaughterPfoList())
+    {
+        if (1 != pDaughterPfo->GetParentPfoList().size())
+            throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+        const unsigned int daughterIndex(m_depthFirstPfos.size());
+        this->AddDepthFirst(pDaughterPfo, tier + 1, rootIndex);
+
+        // ATTN Daughter entries already hold the counts for their own downstream pfos
+        const PfoEntry &daughterEntry(m_pfoEntries[daughterIndex]);
+        PfoEntry &pfoEntry(m_pfoEntries[index]);
+
+        for (unsigned int hitTypeIndex = 0; hitTypeIndex < N_HIT_TYPES; ++hitTypeIndex)
+        {
+            pfoEntry.m_nHits[hitTypeIndex] += daughterEntry.m_nHits[hitTypeIndex];
+            pfoEntry.m_nIsolatedHits[hitTypeIndex] += daughterEntry.m_nIsolatedHits[hitTypeIndex];
+        }
+    }
+
+    m_pfoEntries[index].m_endIndex = m_depthFirstPfos.size();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void PfoHierarchySnapshot::AddBreadthFirst(const unsigned int rootIndex)
+{
+    unsigned int readIndex(rootIndex), writeIndex(rootIndex);
+    m_breadthFirstPfos[writeIndex++] = m_depthFirstPfos[rootIndex];
+
+    while (readIndex < writeIndex)
+    {
+        for (const ParticleFlowObject *const pDaughterPfo : m_breadthFirstPfos[readIndex++]->GetDaughterPfoList())
+            m_breadthFirstPfos[writeIndex++] = pDaughterPfo;
+    }
+}
+
+} // namespace lar_content
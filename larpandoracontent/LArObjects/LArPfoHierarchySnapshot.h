@@ -0,0 +1,242 @@
+/**
+ *  @file   larpandoracontent/LArObjects/LArPfoHierarchySnapshot.h
+ *
+ *  @brief  Header file for the lar pfo hierarchy snapshot class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_PFO_HIERARCHY_SNAPSHOT_H
+#define LAR_PFO_HIERARCHY_SNAPSHOT_H 1
+
+#include "Pandora/PandoraInternal.h"
+
+#include <array>
+#include <unordered_map>
+#include <vector>
+
+namespace lar_content
+{
+
+/**
+ *  @brief  PfoHierarchySnapshot class, holding the pfo hierarchies connected to a list of pfos in depth-first order, with the tier, root
+ *          and descendant range of each pfo precomputed, so that repeated hierarchy queries need not walk the parent/daughter links. Hit
+ *          counts are aggregated bottom-up over each pfo and its downstream pfos. The snapshot does not track later changes to the
+ *          hierarchy, or to the pfo clusters, and must be rebuilt if pfos are added, removed or re-parented.
+ */
+class PfoHierarchySnapshot
+{
+public:
+    /**
+     *  @brief  Constructor
+     *
+     *  @param  pfoList the list of pfos, all hierarchies connected to which are included in the snapshot
+     *
+     *  @throw  StatusCodeException if any connected pfo has more than one parent
+     */
+    PfoHierarchySnapshot(const pandora::PfoList &pfoList);
+
+    /**
+     *  @brief  Whether the snapshot contains a given pfo
+     *
+     *  @param  pPfo the address of the pfo
+     *
+     *  @return boolean
+     */
+    bool Contains(const pandora::ParticleFlowObject *const pPfo) const;
+
+    /**
+     *  @brief  Get the root pfo of the hierarchy containing a given pfo, as for LArPfoHelper::GetParentPfo
+     *
+     *  @param  pPfo the address of the pfo
+     *
+     *  @return the address of the root pfo
+     */
+    const pandora::ParticleFlowObject *GetRootPfo(const pandora::ParticleFlowObject *const pPfo) const;
+
+    /**
+     *  @brief  Get the parent neutrino of a given pfo, as for LArPfoHelper::GetParentNeutrino
+     *
+     *  @param  pPfo the address of the pfo
+     *
+     *  @return the address of the parent neutrino
+     *
+     *  @throw  StatusCodeException if the root pfo is not a neutrino
+     */
+    const pandora::ParticleFlowObject *GetParentNeutrino(const pandora::ParticleFlowObject *const pPfo) const;
+
+    /**
+     *  @brief  Get the hierarchy tier of a given pfo, as for LArPfoHelper::GetHierarchyTier
+     *
+     *  @param  pPfo the address of the pfo
+     *
+     *  @return the hierarchy tier
+     */
+    int GetHierarchyTier(const pandora::ParticleFlowObject *const pPfo) const;
+
+    /**
+     *  @brief  Get the number of pfos downstream of a given pfo, including the pfo itself
+     *
+     *  @param  pPfo the address of the pfo
+     *
+     *  @return the number of downstream pfos
+     */
+    unsigned int GetNDownstreamPfos(const pandora::ParticleFlowObject *const pPfo) const;
+
+    /**
+     *  @brief  Whether a pfo lies downstream of another pfo, where a pfo is considered to lie downstream of itself
+     *
+     *  @param  pAncestorPfo the address of the candidate ancestor pfo
+     *  @param  pPfo the address of the pfo
+     *
+     *  @return boolean
+     */
+    bool IsDownstream(const pandora::ParticleFlowObject *const pAncestorPfo, const pandora::ParticleFlowObject *const pPfo) const;
+
+    /**
+     *  @brief  Get the number of hits of a given type in the clusters of a given pfo and all pfos downstream of it
+     *
+     *  @param  pPfo the address of the pfo
+     *  @param  hitType the hit type, one of TPC_VIEW_U, TPC_VIEW_V, TPC_VIEW_W or TPC_3D
+     *  @param  includeIsolatedHits whether to include isolated hits
+     *
+     *  @return the number of downstream hits
+     *
+     *  @throw  StatusCodeException if the hit type is not supported
+     */
+    unsigned int GetNDownstreamHits(
+        const pandora::ParticleFlowObject *const pPfo, const pandora::HitType hitType, const bool includeIsolatedHits) const;
+
+    /**
+     *  @brief  Get the number of two dimensional hits (TPC_VIEW_U, V or W) in the clusters of a given pfo and all pfos downstream of it
+     *
+     *  @param  pPfo the address of the pfo
+     *  @param  includeIsolatedHits whether to include isolated hits
+     *
+     *  @return the number of downstream two dimensional hits
+     */
+    unsigned int GetNDownstreamTwoDHits(const pandora::ParticleFlowObject *const pPfo, const bool includeIsolatedHits) const;
+
+    /**
+     *  @brief  Append a given pfo and all pfos downstream of it to a list, in the order used by LArPfoHelper::GetAllDownstreamPfos when
+     *          operating on an output list that does not already contain any of these pfos
+     *
+     *  @param  pPfo the address of the pfo
+     *  @param  outputPfoList to receive the downstream pfos
+     */
+    void GetAllDownstreamPfos(const pandora::ParticleFlowObject *const pPfo, pandora::PfoList &outputPfoList) const;
+
+    /**
+     *  @brief  Append all pfos in the hierarchy containing a given pfo to a list, in depth-first order from the root pfo. This is the same
+     *          collection of pfos as provided by LArPfoHelper::GetAllConnectedPfos, though the ordering differs
+     *
+     *  @param  pPfo the address of the pfo
+     *  @param  outputPfoList to receive the pfos in the hierarchy
+     */
+    void GetHierarchyPfos(const pandora::ParticleFlowObject *const pPfo, pandora::PfoList &outputPfoList) const;
+
+    /**
+     *  @brief  Append all pfos in the hierarchy containing a given pfo to a list, as for
+     *          LArPfoHelper::GetBreadthFirstHierarchyRepresentation
+     *
+     *  @param  pPfo the address of the pfo
+     *  @param  pfoList to receive the pfos in the hierarchy, in breadth-first order from the root pfo
+     */
+    void GetBreadthFirstHierarchyRepresentation(const pandora::ParticleFlowObject *const pPfo, pandora::PfoList &pfoList) const;
+
+    /**
+     *  @brief  Get the root pfos, in order of first connection to the input pfo list
+     *
+     *  @return the root pfos
+     */
+    const pandora::PfoVector &GetRootPfos() const;
+
+private:
+    static const unsigned int N_HIT_TYPES = 4; ///< The number of hit types counted: TPC_VIEW_U, TPC_VIEW_V, TPC_VIEW_W and TPC_3D
+
+    typedef std::array<unsigned int, N_HIT_TYPES> HitCountArray;
+
+    /**
+     *  @brief  PfoEntry class, the snapshot entry for a pfo at a given position in the depth-first ordering
+     */
+    class PfoEntry
+    {
+    public:
+        int m_tier;                    ///< The hierarchy tier
+        unsigned int m_rootIndex;      ///< The depth-first position of the root pfo
+        unsigned int m_endIndex;       ///< The depth-first position following the last downstream pfo
+        HitCountArray m_nHits;         ///< The number of clustered hits of each type, for the pfo and all downstream pfos
+        HitCountArray m_nIsolatedHits; ///< The number of isolated hits of each type, for the pfo and all downstream pfos
+    };
+
+    typedef std::vector<PfoEntry> PfoEntryVector;
+    typedef std::unordered_map<const pandora::ParticleFlowObject *, unsigned int> PfoToIndexMap;
+
+    /**
+     *  @brief  Get the depth-first position of a given pfo
+     *
+     *  @param  pPfo the address of the pfo
+     *
+     *  @return the depth-first position
+     *
+     *  @throw  StatusCodeException if the pfo is not present in the snapshot
+     */
+    unsigned int GetIndex(const pandora::ParticleFlowObject *const pPfo) const;
+
+    /**
+     *  @brief  Get the position of a hit type in the hit count arrays
+     *
+     *  @param  hitType the hit type
+     *  @param  hitTypeIndex to receive the position of the hit type
+     *
+     *  @return whether the hit type is counted
+     */
+    static bool GetHitTypeIndex(const pandora::HitType hitType, unsigned int &hitTypeIndex);
+
+    /**
+     *  @brief  Count the hits in the clusters of a pfo, attributing isolated hits to the hit type of their cluster
+     *
+     *  @param  pPfo the address of the pfo
+     *  @param  pfoEntry the snapshot entry to receive the hit counts
+     */
+    static void CountHits(const pandora::ParticleFlowObject *const pPfo, PfoEntry &pfoEntry);
+
+    /**
+     *  @brief  Add a pfo and, recursively, its daughters to the depth-first ordering
+     *
+     *  @param  pPfo the address of the pfo
+     *  @param  tier the hierarchy tier of the pfo
+     *  @param  rootIndex the depth-first position of the root pfo
+     */
+    void AddDepthFirst(const pandora::ParticleFlowObject *const pPfo, const int tier, const unsigned int rootIndex);
+
+    /**
+     *  @brief  Fill the breadth-first ordering for the hierarchy with a given root pfo
+     *
+     *  @param  rootIndex the depth-first position of the root pfo
+     */
+    void AddBreadthFirst(const unsigned int rootIndex);
+
+    pandora::PfoVector m_rootPfos;         ///< The root pfos
+    pandora::PfoVector m_depthFirstPfos;   ///< The pfos, in depth-first order for each hierarchy in turn
+    pandora::PfoVector m_breadthFirstPfos; ///< The pfos, in breadth-first order within each depth-first hierarchy range
+    PfoEntryVector m_pfoEntries;           ///< The pfo entries, by depth-first position
+    PfoToIndexMap m_pfoToIndexMap;         ///< The map from pfo address to depth-first position
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline bool PfoHierarchySnapshot::Contains(const pandora::ParticleFlowObject *const pPfo) const
+{
+    return (m_pfoToIndexMap.count(pPfo) > 0);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const pandora::PfoVector &PfoHierarchySnapshot::GetRootPfos() const
+{
+    return m_rootPfos;
+}
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_PFO_HIERARCHY_SNAPSHOT_H
@@ -19,7 +19,7 @@ LArPointingCluster::LArPointingCluster(const Cluster *const pCluster, const unsi
     // TODO remove default layer fit window and z pitch values
     if (TPC_3D == LArClusterHelper::GetClusterHitType(pCluster))
     {
-        const ThreeDSlidingFitResult slidingFitResult(pCluster, fitHalfLayerWindow, fitLayerPitch);
+        const ThreeDSlidingFitResult slidingFitResult(pCluster, fitHalfLayerWindow, fitLayerPitch, ThreeDSlidingFitResult::ENDPOINTS_ONLY);
         this->BuildPointingCluster(slidingFitResult);
     }
     else
@@ -8,8 +8,12 @@
 
 #include "Helpers/XmlHelper.h"
 
+#include "larpandoracontent/LArHelpers/LArFileHelper.h"
+
 #include "larpandoracontent/LArObjects/LArSupportVectorMachine.h"
 
+#include <Eigen/Dense>
+
 using namespace pandora;
 
 namespace lar_content
@@ -74,6 +78,17 @@ StatusCode SupportVectorMachine::Initialize(const std::string &parameterLocation
         throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
     }
 
+    m_yAlphaValues.reserve(m_svInfoList.size());
+    m_supportVectorValues.reserve(m_svInfoList.size() * m_nFeatures);
+
+    for (const SupportVectorInfo &svInfo : m_svInfoList)
+    {
+        m_yAlphaValues.push_back(svInfo.m_yAlpha);
+
+        for (const LArMvaHelper::MvaFeature &value : svInfo.m_supportVector)
+            m_supportVectorValues.push_back(value.Get());
+    }
+
     m_isInitialized = true;
     return STATUS_CODE_SUCCESS;
 }
@@ -82,15 +97,15 @@ StatusCode SupportVectorMachine::Initialize(const std::string &parameterLocation
 
 void SupportVectorMachine::ReadXmlFile(const std::string &svmFileName, const std::string &svmName)
 {
-    TiXmlDocument xmlDocument(svmFileName);
+    const std::shared_ptr<TiXmlDocument> pXmlDocument(LArFileHelper::LoadXmlDocument(svmFileName));
 
-    if (!xmlDocument.LoadFile())
+    if (!pXmlDocument)
     {
         std::cout << "SupportVectorMachine::Initialize - Invalid xml file." << std::endl;
         throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
     }
 
-    const TiXmlHandle xmlDocumentHandle(&xmlDocument);
+    const TiXmlHandle xmlDocumentHandle(pXmlDocument.get());
     TiXmlNode *pContainerXmlNode(TiXmlHandle(xmlDocumentHandle).FirstChildElement().Element());
 
     // Try to find the svm container with the required name
@@ -247,19 +262,61 @@ StatusCode SupportVectorMachine::ReadSupportVector(const TiXmlHandle &currentHan
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-double SupportVectorMachine::CalculateClassificationScoreImpl(const LArMvaHelper::MvaFeatureVector &features) const
+void SupportVectorMachine::CalculateClassificationScores(
+    const LArMvaHelper::MvaFeatureMatrix &featureMatrix, LArMvaHelper::DoubleVector &scores) const
 {
-    if (!m_isInitialized)
+    if (USER_DEFINED == m_kernelType)
     {
-        std::cout << "SupportVectorMachine: could not perform classification because the svm was uninitialized" << std::endl;
-        throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
+        for (const LArMvaHelper::MvaFeatureVector &features : featureMatrix)
+            scores.push_back(this->CalculateClassificationScoreImpl(features));
+
+        return;
     }
 
-    if (m_svInfoList.empty())
+    this->CheckInitialization();
+
+    LArMvaHelper::DoubleVector exampleValues;
+    exampleValues.reserve(featureMatrix.size() * m_nFeatures);
+
+    for (const LArMvaHelper::MvaFeatureVector &features : featureMatrix)
+        this->AppendExampleValues(features, exampleValues);
+
+    this->CalculateKernelScores(exampleValues, featureMatrix.size(), scores);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void SupportVectorMachine::CalculateProbabilities(
+    const LArMvaHelper::MvaFeatureMatrix &featureMatrix, LArMvaHelper::DoubleVector &probabilities) const
+{
+    if (!m_enableProbability)
     {
-        std::cout << "SupportVectorMachine: could not perform classification because the initialized svm had no support vectors in the model"
-                  << std::endl;
-        throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
+        std::cout << "LArSupportVectorMachine: cannot calculate probabilities for this SVM" << std::endl;
+        throw pandora::STATUS_CODE_NOT_INITIALIZED;
+    }
+
+    LArMvaHelper::DoubleVector scores;
+    this->CalculateClassificationScores(featureMatrix, scores);
+
+    // ATTN: Same logistic mapping from score to probability as for a single set of input features
+    for (const double score : scores)
+        probabilities.push_back(1. / (1. + std::exp(m_probAParameter * score + m_probBParameter)));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+double SupportVectorMachine::CalculateClassificationScoreImpl(const LArMvaHelper::MvaFeatureVector &features) const
+{
+    this->CheckInitialization();
+
+    if (USER_DEFINED != m_kernelType)
+    {
+        LArMvaHelper::DoubleVector exampleValues, scores;
+        exampleValues.reserve(m_nFeatures);
+        this->AppendExampleValues(features, exampleValues);
+        this->CalculateKernelScores(exampleValues, 1, scores);
+
+        return scores.front();
     }
 
     LArMvaHelper::MvaFeatureVector standardizedFeatures;
@@ -281,4 +338,91 @@ double SupportVectorMachine::CalculateClassificationScoreImpl(const LArMvaHelper
     return classScore + m_bias;
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void SupportVectorMachine::CheckInitialization() const
+{
+    if (!m_isInitialized)
+    {
+        std::cout << "SupportVectorMachine: could not perform classification because the svm was uninitialized" << std::endl;
+        throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
+    }
+
+    if (m_svInfoList.empty())
+    {
+        std::cout << "SupportVectorMachine: could not perform classification because the initialized svm had no support vectors in the model"
+                  << std::endl;
+        throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void SupportVectorMachine::AppendExampleValues(
+    const LArMvaHelper::MvaFeatureVector &features, LArMvaHelper::DoubleVector &exampleValues) const
+{
+    if (features.size() < m_nFeatures)
+    {
+        std::cout << "SupportVectorMachine: could not perform classification because too few features were provided" << std::endl;
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+    }
+
+    for (std::size_t i = 0; i < m_nFeatures; ++i)
+    {
+        const double value(features.at(i).Get());
+        exampleValues.push_back(m_standardizeFeatures ? m_featureInfoList.at(i).StandardizeParameter(value) : value);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void SupportVectorMachine::CalculateKernelScores(
+    const LArMvaHelper::DoubleVector &exampleValues, const unsigned int nExamples, LArMvaHelper::DoubleVector &scores) const
+{
+    typedef Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> RowMajorMatrix;
+
+    const Eigen::Index nSupportVectors(m_yAlphaValues.size());
+    const Eigen::Map<const RowMajorMatrix> supportVectors(m_supportVectorValues.data(), nSupportVectors, m_nFeatures);
+    const Eigen::Map<const RowMajorMatrix> examples(exampleValues.data(), nExamples, m_nFeatures);
+    const Eigen::Map<const Eigen::VectorXd> yAlphas(m_yAlphaValues.data(), nSupportVectors);
+
+    // ATTN: Kernel values are held with one row per support vector and one column per example
+    Eigen::MatrixXd kernelValues(nSupportVectors, nExamples);
+
+    if (GAUSSIAN_RBF == m_kernelType)
+    {
+        for (Eigen::Index iExample = 0; iExample < examples.rows(); ++iExample)
+            kernelValues.col(iExample) = (supportVectors.rowwise() - examples.row(iExample)).rowwise().squaredNorm();
+
+        kernelValues = (-m_scaleFactor * kernelValues.array()).exp().matrix();
+    }
+    else
+    {
+        const double denominator(m_scaleFactor * m_scaleFactor);
+        if (denominator < std::numeric_limits<double>::epsilon())
+            throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+        kernelValues.noalias() = supportVectors * examples.transpose();
+        kernelValues /= denominator;
+
+        if (QUADRATIC == m_kernelType)
+        {
+            kernelValues = (kernelValues.array() + 1.).square().matrix();
+        }
+        else if (CUBIC == m_kernelType)
+        {
+            kernelValues = (kernelValues.array() + 1.).cube().matrix();
+        }
+        else if (LINEAR != m_kernelType)
+        {
+            throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+        }
+    }
+
+    const Eigen::VectorXd classScores(kernelValues.transpose() * yAlphas);
+
+    for (Eigen::Index iExample = 0; iExample < classScores.size(); ++iExample)
+        scores.push_back(classScores(iExample) + m_bias);
+}
+
 } // namespace lar_content
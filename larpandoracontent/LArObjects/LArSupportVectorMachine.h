@@ -86,6 +86,24 @@ public:
      */
     double CalculateProbability(const LArMvaHelper::MvaFeatureVector &features) const;
 
+    /**
+     *  @brief  Calculate the classification scores for a number of sets of input features, evaluating the kernel for all examples and
+     *          support vectors together
+     *
+     *  @param  featureMatrix the input features, one feature vector per example
+     *  @param  scores to receive the classification score for each example, in the order of the input feature vectors
+     */
+    void CalculateClassificationScores(const LArMvaHelper::MvaFeatureMatrix &featureMatrix, LArMvaHelper::DoubleVector &scores) const;
+
+    /**
+     *  @brief  Calculate the classification probabilities for a number of sets of input features, evaluating the kernel for all examples
+     *          and support vectors together
+     *
+     *  @param  featureMatrix the input features, one feature vector per example
+     *  @param  probabilities to receive the classification probability for each example, in the order of the input feature vectors
+     */
+    void CalculateProbabilities(const LArMvaHelper::MvaFeatureMatrix &featureMatrix, LArMvaHelper::DoubleVector &probabilities) const;
+
     /**
      *  @brief  Query whether this svm is initialized
      *
@@ -101,7 +119,7 @@ public:
     unsigned int GetNFeatures() const;
 
     /**
-     *  @brief  Set the kernel function to use
+     *  @brief  Set the kernel function to use, which will then be treated as a user-defined kernel
      *
      *  @param  kernelFunction the kernel function
      */
@@ -181,6 +199,9 @@ private:
     KernelFunction m_kernelFunction; ///< The kernel function
     KernelMap m_kernelMap;           ///< Map from the kernel types to the kernel functions
 
+    LArMvaHelper::DoubleVector m_yAlphaValues;        ///< The alpha-value multiplied by the y-value for each support vector
+    LArMvaHelper::DoubleVector m_supportVectorValues; ///< The support vector values, contiguous and row-major, one row per support vector
+
     /**
      *  @brief  Read the svm parameters from an xml file
      *
@@ -234,6 +255,29 @@ private:
      */
     double CalculateClassificationScoreImpl(const LArMvaHelper::MvaFeatureVector &features) const;
 
+    /**
+     *  @brief  Check that the svm is initialized and has support vectors, throwing an exception if not
+     */
+    void CheckInitialization() const;
+
+    /**
+     *  @brief  Append the values of a set of input features, standardized if required, to a contiguous list of example values
+     *
+     *  @param  features the input features
+     *  @param  exampleValues to receive the example values
+     */
+    void AppendExampleValues(const LArMvaHelper::MvaFeatureVector &features, LArMvaHelper::DoubleVector &exampleValues) const;
+
+    /**
+     *  @brief  Calculate the classification scores for a number of examples using the built-in kernel of the configured type
+     *
+     *  @param  exampleValues the example values, contiguous and row-major, one row per example
+     *  @param  nExamples the number of examples
+     *  @param  scores to receive the classification score for each example
+     */
+    void CalculateKernelScores(
+        const LArMvaHelper::DoubleVector &exampleValues, const unsigned int nExamples, LArMvaHelper::DoubleVector &scores) const;
+
     /**
      *  @brief  An inhomogeneous quadratic kernel
      *
@@ -332,6 +376,7 @@ inline unsigned int SupportVectorMachine::GetNFeatures() const
 
 inline void SupportVectorMachine::SetKernelFunction(KernelFunction kernelFunction)
 {
+    m_kernelType = USER_DEFINED;
     m_kernelFunction = std::move(kernelFunction);
 }
 
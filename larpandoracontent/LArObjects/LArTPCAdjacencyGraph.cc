@@ -0,0 +1,172 @@
+/**
+ *  @file   larpandoracontent/LArObjects/LArTPCAdjacencyGraph.cc
+ *
+ *  @brief  Implementation of the lar tpc adjacency graph class.
+ *
+ *  $Log: $
+ */
+
+#include "Geometry/LArTPC.h"
+
+#include "larpandoracontent/LArHelpers/LArStitchingHelper.h"
+
+#include "larpandoracontent/LArObjects/LArTPCAdjacencyGraph.h"
+
+#include <cmath>
+#include <limits>
+
+using namespace pandora;
+
+namespace lar_content
+{
+
+TPCAdjacencyGraph::TPCAdjacencyGraph(const LArTPCMap &larTPCMap)
+{
+    for (const LArTPCMap::value_type &mapEntry : larTPCMap)
+    {
+        if (!m_volumeIdToIndexMap.insert(VolumeIdToIndexMap::value_type(mapEntry.second->GetLArTPCVolumeId(), m_larTPCs.size())).second)
+            throw StatusCodeException(STATUS_CODE_ALREADY_PRESENT);
+
+        m_larTPCs.push_back(mapEntry.second);
+    }
+
+    const float maxDisplacement(30.f); // TODO: 30cm should be fine, but can we do better than a hard-coded number here?
+
+    for (const LArTPC *const pInputTPC : m_larTPCs)
+    {
+        for (const bool checkPositive : {true, false})
+        {
+            const LArTPC *pClosestTPC(nullptr);
+            float closestSeparation(std::numeric_limits<float>::max());
+
+            for (const LArTPC *const pCheckTPC : m_larTPCs)
+            {
+                if (pInputTPC == pCheckTPC)
+                    continue;
+
+                if (checkPositive != (pCheckTPC->GetCenterX() > pInputTPC->GetCenterX()))
+                    continue;
+
+                const float deltaX(std::fabs(pCheckTPC->GetCenterX() - pInputTPC->GetCenterX()));
+                const float deltaY(std::fabs(pCheckTPC->GetCenterY() - pInputTPC->GetCenterY()));
+                const float deltaZ(std::fabs(pCheckTPC->GetCenterZ() - pInputTPC->GetCenterZ()));
+
+                if (deltaY > maxDisplacement || deltaZ > maxDisplacement)
+                    continue;
+
+                if (deltaX < closestSeparation)
+                {
+                    closestSeparation = deltaX;
+                    pClosestTPC = pCheckTPC;
+                }
+            }
+
+            (checkPositive ? m_closestPositiveTPCs : m_closestNegativeTPCs).push_back(pClosestTPC);
+        }
+    }
+
+    m_tpcPairs.reserve(m_larTPCs.size() * m_larTPCs.size());
+
+    for (const LArTPC *const pFirstTPC : m_larTPCs)
+    {
+        for (const LArTPC *const pSecondTPC : m_larTPCs)
+        {
+            const bool areAdjacent(LArStitchingHelper::AreTPCsAdjacent(*pFirstTPC, *pSecondTPC));
+            const bool canBeStitched(LArStitchingHelper::CanTPCsBeStitched(*pFirstTPC, *pSecondTPC));
+            const float boundaryCenterX(areAdjacent ? LArStitchingHelper::GetTPCBoundaryCenterX(*pFirstTPC, *pSecondTPC) : 0.f);
+            const float boundaryWidthX(areAdjacent ? LArStitchingHelper::GetTPCBoundaryWidthX(*pFirstTPC, *pSecondTPC) : 0.f);
+            const float displacement(LArStitchingHelper::GetTPCDisplacement(*pFirstTPC, *pSecondTPC));
+
+            m_tpcPairs.push_back(TPCPair{areAdjacent, canBeStitched, boundaryCenterX, boundaryWidthX, displacement});
+        }
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool TPCAdjacencyGraph::IsConsistent(const LArTPCMap &larTPCMap) const
+{
+    if (larTPCMap.size() != m_larTPCs.size())
+        return false;
+
+    return (larTPCMap.empty() || ((larTPCMap.begin()->second == m_larTPCs.front()) && (larTPCMap.rbegin()->second == m_larTPCs.back())));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const LArTPC &TPCAdjacencyGraph::GetClosestTPC(const LArTPC &inputTPC, const bool checkPositive) const
+{
+    const unsigned int index(this->GetIndex(inputTPC));
+    const LArTPC *const pClosestTPC(checkPositive ? m_closestPositiveTPCs[index] : m_closestNegativeTPCs[index]);
+
+    if (!pClosestTPC)
+        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
+
+    return (*pClosestTPC);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool TPCAdjacencyGraph::CanTPCsBeStitched(const LArTPC &firstTPC, const LArTPC &secondTPC) const
+{
+    return this->GetTPCPair(firstTPC, secondTPC).m_canBeStitched;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool TPCAdjacencyGraph::AreTPCsAdjacent(const LArTPC &firstTPC, const LArTPC &secondTPC) const
+{
+    return this->GetTPCPair(firstTPC, secondTPC).m_areAdjacent;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+float TPCAdjacencyGraph::GetTPCBoundaryCenterX(const LArTPC &firstTPC, const LArTPC &secondTPC) const
+{
+    const TPCPair &tpcPair(this->GetTPCPair(firstTPC, secondTPC));
+
+    if (!tpcPair.m_areAdjacent)
+        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
+
+    return tpcPair.m_boundaryCenterX;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+float TPCAdjacencyGraph::GetTPCBoundaryWidthX(const LArTPC &firstTPC, const LArTPC &secondTPC) const
+{
+    const TPCPair &tpcPair(this->GetTPCPair(firstTPC, secondTPC));
+
+    if (!tpcPair.m_areAdjacent)
+        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
+
+    return tpcPair.m_boundaryWidthX;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+float TPCAdjacencyGraph::GetTPCDisplacement(const LArTPC &firstTPC, const LArTPC &secondTPC) const
+{
+    return this->GetTPCPair(firstTPC, secondTPC).m_displacement;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+unsigned int TPCAdjacencyGraph::GetIndex(const LArTPC &larTPC) const
+{
+    const VolumeIdToIndexMap::const_iterator iter(m_volumeIdToIndexMap.find(larTPC.GetLArTPCVolumeId()));
+
+    if (m_volumeIdToIndexMap.end() == iter)
+        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
+
+    return iter->second;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const TPCAdjacencyGraph::TPCPair &TPCAdjacencyGraph::GetTPCPair(const LArTPC &firstTPC, const LArTPC &secondTPC) const
+{
+    return m_tpcPairs[this->GetIndex(firstTPC) * m_larTPCs.size() + this->GetIndex(secondTPC)];
+}
+
+} // namespace lar_content
@@ -0,0 +1,158 @@
+/**
+ *  @file   larpandoracontent/LArObjects/LArTPCAdjacencyGraph.h
+ *
+ *  @brief  Header file for the lar tpc adjacency graph class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_TPC_ADJACENCY_GRAPH_H
+#define LAR_TPC_ADJACENCY_GRAPH_H 1
+
+#include "Pandora/PandoraInternal.h"
+
+#include <unordered_map>
+#include <vector>
+
+namespace lar_content
+{
+
+/**
+ *  @brief  TPCAdjacencyGraph class, holding the closest tpc in each x direction for every tpc, together with the stitching properties of
+ *          every pair of tpcs, so that tpc adjacency queries need not compare tpc geometries. Properties are calculated with the
+ *          LArStitchingHelper functions, so match their results exactly. Tpcs are identified by volume id, so the tpcs held by the
+ *          pandora worker instances may be used in place of those in the lar tpc map from which the graph was built.
+ */
+class TPCAdjacencyGraph
+{
+public:
+    /**
+     *  @brief  Constructor
+     *
+     *  @param  larTPCMap the lar tpc map
+     */
+    TPCAdjacencyGraph(const pandora::LArTPCMap &larTPCMap);
+
+    /**
+     *  @brief  Whether the graph was built from a given lar tpc map
+     *
+     *  @param  larTPCMap the lar tpc map
+     *
+     *  @return boolean
+     */
+    bool IsConsistent(const pandora::LArTPCMap &larTPCMap) const;
+
+    /**
+     *  @brief  Get the closest tpc to a given tpc, as for LArStitchingHelper::FindClosestTPC
+     *
+     *  @param  inputTPC the tpc
+     *  @param  checkPositive look in higher (lower) x positions if this is set to true (false)
+     *
+     *  @return the closest tpc, from the lar tpc map from which the graph was built
+     *
+     *  @throw  StatusCodeException if the tpc is not present in the graph, or there is no closest tpc
+     */
+    const pandora::LArTPC &GetClosestTPC(const pandora::LArTPC &inputTPC, const bool checkPositive) const;
+
+    /**
+     *  @brief  Whether particles from a given pair of tpcs can be stitched together, as for LArStitchingHelper::CanTPCsBeStitched
+     *
+     *  @param  firstTPC the first tpc
+     *  @param  secondTPC the second tpc
+     *
+     *  @return boolean
+     */
+    bool CanTPCsBeStitched(const pandora::LArTPC &firstTPC, const pandora::LArTPC &secondTPC) const;
+
+    /**
+     *  @brief  Whether a pair of tpcs are adjacent to each other, as for LArStitchingHelper::AreTPCsAdjacent
+     *
+     *  @param  firstTPC the first tpc
+     *  @param  secondTPC the second tpc
+     *
+     *  @return boolean
+     */
+    bool AreTPCsAdjacent(const pandora::LArTPC &firstTPC, const pandora::LArTPC &secondTPC) const;
+
+    /**
+     *  @brief  Get the centre in x at the boundary between a pair of tpcs, as for LArStitchingHelper::GetTPCBoundaryCenterX
+     *
+     *  @param  firstTPC the first tpc
+     *  @param  secondTPC the second tpc
+     *
+     *  @return boundary x centre
+     *
+     *  @throw  StatusCodeException if the tpcs are not adjacent
+     */
+    float GetTPCBoundaryCenterX(const pandora::LArTPC &firstTPC, const pandora::LArTPC &secondTPC) const;
+
+    /**
+     *  @brief  Get the width in x at the boundary between a pair of tpcs, as for LArStitchingHelper::GetTPCBoundaryWidthX
+     *
+     *  @param  firstTPC the first tpc
+     *  @param  secondTPC the second tpc
+     *
+     *  @return boundary x width
+     *
+     *  @throw  StatusCodeException if the tpcs are not adjacent
+     */
+    float GetTPCBoundaryWidthX(const pandora::LArTPC &firstTPC, const pandora::LArTPC &secondTPC) const;
+
+    /**
+     *  @brief  Get the distance between central positions of a pair of tpcs, as for LArStitchingHelper::GetTPCDisplacement
+     *
+     *  @param  firstTPC the first tpc
+     *  @param  secondTPC the second tpc
+     *
+     *  @return the distance
+     */
+    float GetTPCDisplacement(const pandora::LArTPC &firstTPC, const pandora::LArTPC &secondTPC) const;
+
+private:
+    /**
+     *  @brief  TPCPair class, the properties of an ordered pair of tpcs
+     */
+    class TPCPair
+    {
+    public:
+        bool m_areAdjacent;      ///< Whether the tpcs are adjacent
+        bool m_canBeStitched;    ///< Whether particles from the tpcs can be stitched together
+        float m_boundaryCenterX; ///< The boundary x centre, if the tpcs are adjacent
+        float m_boundaryWidthX;  ///< The boundary x width, if the tpcs are adjacent
+        float m_displacement;    ///< The distance between the tpc central positions
+    };
+
+    typedef std::vector<const pandora::LArTPC *> LArTPCVector;
+    typedef std::unordered_map<unsigned int, unsigned int> VolumeIdToIndexMap;
+    typedef std::vector<TPCPair> TPCPairVector;
+
+    /**
+     *  @brief  Get the index of a given tpc
+     *
+     *  @param  larTPC the tpc
+     *
+     *  @return the index
+     *
+     *  @throw  StatusCodeException if no tpc with the same volume id is present in the graph
+     */
+    unsigned int GetIndex(const pandora::LArTPC &larTPC) const;
+
+    /**
+     *  @brief  Get the properties of an ordered pair of tpcs
+     *
+     *  @param  firstTPC the first tpc
+     *  @param  secondTPC the second tpc
+     *
+     *  @return the tpc pair properties
+     */
+    const TPCPair &GetTPCPair(const pandora::LArTPC &firstTPC, const pandora::LArTPC &secondTPC) const;
+
+    LArTPCVector m_larTPCs;                  ///< The tpcs, in lar tpc map order
+    VolumeIdToIndexMap m_volumeIdToIndexMap; ///< The map from tpc volume id to index
+    LArTPCVector m_closestPositiveTPCs;      ///< The closest tpc at higher x for each tpc, by index, or nullptr if none
+    LArTPCVector m_closestNegativeTPCs;      ///< The closest tpc at lower x for each tpc, by index, or nullptr if none
+    TPCPairVector m_tpcPairs;                ///< The properties of each ordered pair of tpcs, by first index then second index
+};
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_TPC_ADJACENCY_GRAPH_H
@@ -0,0 +1,192 @@
+/**
+ *  @file   larpandoracontent/LArObjects/LArTPCVolumeIndex.cc
+ *
+ *  @brief  Implementation of the lar tpc volume index class.
+ *
+ *  $Log: $
+ */
+
+#include "Geometry/LArTPC.h"
+
+#include "larpandoracontent/LArObjects/LArTPCVolumeIndex.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+using namespace pandora;
+
+namespace lar_content
+{
+
+TPCVolumeIndex::TPCVolumeIndex(const LArTPCMap &larTPCMap) :
+    m_minCoordinates(std::numeric_limits<float>::max(), std::numeric_limits<float>::max(), std::numeric_limits<float>::max()),
+    m_maxCoordinates(-std::numeric_limits<float>::max(), -std::numeric_limits<float>::max(), -std::numeric_limits<float>::max()),
+    m_gridOrigin{{0.f, 0.f, 0.f}},
+    m_nCells{{1, 1, 1}},
+    m_cellSize{{0.f, 0.f, 0.f}}
+{
+    std::array<float, 3> minCoordinates, maxCoordinates, minWidths;
+    minCoordinates.fill(std::numeric_limits<float>::max());
+    maxCoordinates.fill(-std::numeric_limits<float>::max());
+    minWidths.fill(std::numeric_limits<float>::max());
+
+    for (const LArTPCMap::value_type &mapEntry : larTPCMap)
+    {
+        const LArTPC *const pLArTPC(mapEntry.second);
+        const std::array<float, 3> centres{{pLArTPC->GetCenterX(), pLArTPC->GetCenterY(), pLArTPC->GetCenterZ()}};
+        const std::array<float, 3> widths{{pLArTPC->GetWidthX(), pLArTPC->GetWidthY(), pLArTPC->GetWidthZ()}};
+
+        TPCVolume tpcVolume;
+        tpcVolume.m_pLArTPC = pLArTPC;
+
+        for (unsigned int axis = 0; axis < 3; ++axis)
+        {
+            const float halfWidth(0.5f * widths[axis]);
+            tpcVolume.m_min[axis] = centres[axis] - halfWidth;
+            tpcVolume.m_max[axis] = centres[axis] + halfWidth;
+            minCoordinates[axis] = std::min(minCoordinates[axis], tpcVolume.m_min[axis]);
+            maxCoordinates[axis] = std::max(maxCoordinates[axis], tpcVolume.m_max[axis]);
+            minWidths[axis] = std::min(minWidths[axis], widths[axis]);
+        }
+
+        m_tpcVolumes.push_back(tpcVolume);
+    }
+
+    if (m_tpcVolumes.empty())
+    {
+        m_cellOffsets.assign(2, 0);
+        return;
+    }
+
+    m_minCoordinates = CartesianVector(minCoordinates[0], minCoordinates[1], minCoordinates[2]);
+    m_maxCoordinates = CartesianVector(maxCoordinates[0], maxCoordinates[1], maxCoordinates[2]);
+    m_gridOrigin = minCoordinates;
+
+    // ATTN Cells are sized to the narrowest tpc along each axis, so that each cell overlaps few tpcs, with the cell count capped
+    const unsigned int maxCellsPerAxis(64);
+
+    for (unsigned int axis = 0; axis < 3; ++axis)
+    {
+        const float extent(maxCoordinates[axis] - minCoordinates[axis]);
+
+        if ((extent > 0.f) && (minWidths[axis] > 0.f))
+            m_nCells[axis] = std::min(maxCellsPerAxis, std::max(1u, static_cast<unsigned int>(std::ceil(extent / minWidths[axis]))));
+
+        m_cellSize[axis] = extent / static_cast<float>(m_nCells[axis]);
+    }
+
+    const unsigned int nCells(m_nCells[0] * m_nCells[1] * m_nCells[2]);
+    std::vector<std::array<unsigned int, 6>> cellRanges;
+
+    for (const TPCVolume &tpcVolume : m_tpcVolumes)
+    {
+        std::array<unsigned int, 6> cellRange;
+
+        for (unsigned int axis = 0; axis < 3; ++axis)
+        {
+            cellRange[2 * axis] = this->GetCellIndex(axis, tpcVolume.m_min[axis]);
+            cellRange[2 * axis + 1] = this->GetCellIndex(axis, tpcVolume.m_max[axis]);
+        }
+
+        cellRanges.push_back(cellRange);
+    }
+
+    // ATTN Count then fill, so that each cell lists its tpcs contiguously and in lar tpc map order
+    std::vector<unsigned int> cellCounts(nCells, 0);
+
+    for (unsigned int pass = 0; pass < 2; ++pass)
+    {
+        if (1 == pass)
+        {
+            m_cellOffsets.assign(nCells + 1, 0);
+
+            for (unsigned int cell = 0; cell < nCells; ++cell)
+                m_cellOffsets[cell + 1] = m_cellOffsets[cell] + cellCounts[cell];
+
+            m_cellTPCIndices.resize(m_cellOffsets.back());
+            std::fill(cellCounts.begin(), cellCounts.end(), 0);
+        }
+
+        for (unsigned int index = 0; index < cellRanges.size(); ++index)
+        {
+            const std::array<unsigned int, 6> &cellRange(cellRanges[index]);
+
+            for (unsigned int iz = cellRange[4]; iz <= cellRange[5]; ++iz)
+            {
+                for (unsigned int iy = cellRange[2]; iy <= cellRange[3]; ++iy)
+                {
+                    for (unsigned int ix = cellRange[0]; ix <= cellRange[1]; ++ix)
+                    {
+                        const unsigned int cell((iz * m_nCells[1] + iy) * m_nCells[0] + ix);
+
+                        if (1 == pass)
+                            m_cellTPCIndices[m_cellOffsets[cell] + cellCounts[cell]] = index;
+
+                        ++cellCounts[cell];
+                    }
+                }
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool TPCVolumeIndex::IsConsistent(const LArTPCMap &larTPCMap) const
+{
+    if (larTPCMap.size() != m_tpcVolumes.size())
+        return false;
+
+    return (larTPCMap.empty() ||
+        ((larTPCMap.begin()->second == m_tpcVolumes.front().m_pLArTPC) && (larTPCMap.rbegin()->second == m_tpcVolumes.back().m_pLArTPC)));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const LArTPC *TPCVolumeIndex::FindTPC(const CartesianVector &position) const
+{
+    if (m_tpcVolumes.empty())
+        return nullptr;
+
+    const std::array<float, 3> coordinates{{position.GetX(), position.GetY(), position.GetZ()}};
+    std::array<unsigned int, 3> cellIndices;
+
+    for (unsigned int axis = 0; axis < 3; ++axis)
+    {
+        cellIndices[axis] = this->GetCellIndex(axis, coordinates[axis]);
+    }
+
+    const unsigned int cell((cellIndices[2] * m_nCells[1] + cellIndices[1]) * m_nCells[0] + cellIndices[0]);
+
+    for (unsigned int offset = m_cellOffsets[cell]; offset < m_cellOffsets[cell + 1]; ++offset)
+    {
+        const TPCVolume &tpcVolume(m_tpcVolumes[m_cellTPCIndices[offset]]);
+        bool isInside(true);
+
+        for (unsigned int axis = 0; axis < 3; ++axis)
+            isInside = isInside && (coordinates[axis] >= tpcVolume.m_min[axis]) && (coordinates[axis] <= tpcVolume.m_max[axis]);
+
+        if (isInside)
+            return tpcVolume.m_pLArTPC;
+    }
+
+    return nullptr;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+unsigned int TPCVolumeIndex::GetCellIndex(const unsigned int axis, const float coordinate) const
+{
+    if (!(m_cellSize[axis] > 0.f))
+        return 0;
+
+    const float cellPosition((coordinate - m_gridOrigin[axis]) / m_cellSize[axis]);
+
+    if (!(cellPosition > 0.f))
+        return 0;
+
+    return std::min(m_nCells[axis] - 1, static_cast<unsigned int>(cellPosition));
+}
+
+} // namespace lar_content
@@ -0,0 +1,118 @@
+/**
+ *  @file   larpandoracontent/LArObjects/LArTPCVolumeIndex.h
+ *
+ *  @brief  Header file for the lar tpc volume index class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_TPC_VOLUME_INDEX_H
+#define LAR_TPC_VOLUME_INDEX_H 1
+
+#include "Objects/CartesianVector.h"
+
+#include "Pandora/PandoraInternal.h"
+
+#include <array>
+#include <vector>
+
+namespace lar_content
+{
+
+/**
+ *  @brief  TPCVolumeIndex class, holding the tpc volumes on a uniform grid spanning the detector, so that the tpc containing a position
+ *          can be found by examining only the tpcs that overlap a single grid cell. The overall detector extent is also precomputed.
+ */
+class TPCVolumeIndex
+{
+public:
+    /**
+     *  @brief  Constructor
+     *
+     *  @param  larTPCMap the lar tpc map
+     */
+    TPCVolumeIndex(const pandora::LArTPCMap &larTPCMap);
+
+    /**
+     *  @brief  Whether the index was built from a given lar tpc map
+     *
+     *  @param  larTPCMap the lar tpc map
+     *
+     *  @return boolean
+     */
+    bool IsConsistent(const pandora::LArTPCMap &larTPCMap) const;
+
+    /**
+     *  @brief  Find the tpc containing a given position, boundaries included. Where tpc volumes touch or overlap, the first tpc in the lar
+     *          tpc map is chosen, so the result is that of a scan over the lar tpc map
+     *
+     *  @param  position the position
+     *
+     *  @return the address of the tpc, or nullptr if no tpc contains the position
+     */
+    const pandora::LArTPC *FindTPC(const pandora::CartesianVector &position) const;
+
+    /**
+     *  @brief  Get the minimum coordinates of the union of the tpc volumes
+     *
+     *  @return the minimum coordinates
+     */
+    const pandora::CartesianVector &GetMinCoordinates() const;
+
+    /**
+     *  @brief  Get the maximum coordinates of the union of the tpc volumes
+     *
+     *  @return the maximum coordinates
+     */
+    const pandora::CartesianVector &GetMaxCoordinates() const;
+
+private:
+    /**
+     *  @brief  TPCVolume class, the extent of a tpc volume
+     */
+    class TPCVolume
+    {
+    public:
+        std::array<float, 3> m_min;       ///< The minimum coordinates
+        std::array<float, 3> m_max;       ///< The maximum coordinates
+        const pandora::LArTPC *m_pLArTPC; ///< The address of the tpc
+    };
+
+    typedef std::vector<TPCVolume> TPCVolumeVector;
+
+    /**
+     *  @brief  Get the grid cell index along a given axis for a given coordinate, clamped to the grid
+     *
+     *  @param  axis the axis
+     *  @param  coordinate the coordinate
+     *
+     *  @return the cell index
+     */
+    unsigned int GetCellIndex(const unsigned int axis, const float coordinate) const;
+
+    TPCVolumeVector m_tpcVolumes;               ///< The tpc volumes, in lar tpc map order
+    pandora::CartesianVector m_minCoordinates;  ///< The minimum coordinates of the union of the tpc volumes
+    pandora::CartesianVector m_maxCoordinates;  ///< The maximum coordinates of the union of the tpc volumes
+    std::array<float, 3> m_gridOrigin;          ///< The minimum coordinates of the grid
+    std::array<unsigned int, 3> m_nCells;       ///< The number of grid cells along each axis
+    std::array<float, 3> m_cellSize;            ///< The grid cell size along each axis
+    std::vector<unsigned int> m_cellOffsets;    ///< The offset of the first tpc index for each grid cell, plus a final end offset
+    std::vector<unsigned int> m_cellTPCIndices; ///< The indices of the tpc volumes overlapping each grid cell, in lar tpc map order
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const pandora::CartesianVector &TPCVolumeIndex::GetMinCoordinates() const
+{
+    return m_minCoordinates;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const pandora::CartesianVector &TPCVolumeIndex::GetMaxCoordinates() const
+{
+    return m_maxCoordinates;
+}
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_TPC_VOLUME_INDEX_H
@@ -12,6 +12,7 @@
 
 #include "larpandoracontent/LArObjects/LArThreeDSlidingConeFitResult.h"
 
+#include <cmath>
 #include <iterator>
 
 using namespace pandora;
@@ -67,6 +68,120 @@ float SimpleCone::GetBoundedHitFraction(const Cluster *const pCluster, const flo
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+SimpleConeBatch::SimpleConeBatch(const SimpleConeList &simpleConeList)
+{
+    for (const SimpleCone &simpleCone : simpleConeList)
+    {
+        m_apexX.push_back(simpleCone.GetConeApex().GetX());
+        m_apexY.push_back(simpleCone.GetConeApex().GetY());
+        m_apexZ.push_back(simpleCone.GetConeApex().GetZ());
+        m_directionX.push_back(simpleCone.GetConeDirection().GetX());
+        m_directionY.push_back(simpleCone.GetConeDirection().GetY());
+        m_directionZ.push_back(simpleCone.GetConeDirection().GetZ());
+        m_coneLength.push_back(simpleCone.GetConeLength());
+        m_coneTanHalfAngle.push_back(simpleCone.GetConeTanHalfAngle());
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void SimpleConeBatch::GetBoundedHitFractions(const Cluster *const pCluster, const float coneLength, const float coneTanHalfAngle1,
+    const float coneTanHalfAngle2, FloatVector &boundedFractions1, FloatVector &boundedFractions2) const
+{
+    FloatVector hitX, hitY, hitZ;
+    SimpleConeBatch::GetHitCoordinates(pCluster, hitX, hitY, hitZ);
+
+    const unsigned int nHits(hitX.size());
+    const unsigned int nClusterHits(pCluster->GetNCaloHits());
+
+    for (unsigned int iCone = 0; iCone < this->GetNCones(); ++iCone)
+    {
+        const float apexX(m_apexX[iCone]), apexY(m_apexY[iCone]), apexZ(m_apexZ[iCone]);
+        const float directionX(m_directionX[iCone]), directionY(m_directionY[iCone]), directionZ(m_directionZ[iCone]);
+        unsigned int nMatchedHits1(0), nMatchedHits2(0);
+
+        // ATTN Same arithmetic as SimpleCone::GetBoundedHitFraction, but without branches, so that the loop over hits can be vectorised
+        for (unsigned int iHit = 0; iHit < nHits; ++iHit)
+        {
+            const float dX(hitX[iHit] - apexX), dY(hitY[iHit] - apexY), dZ(hitZ[iHit] - apexZ);
+            const float rL(dX * directionX + dY * directionY + dZ * directionZ);
+            const float crossX(dY * directionZ - dZ * directionY);
+            const float crossY(dZ * directionX - dX * directionZ);
+            const float crossZ(dX * directionY - dY * directionX);
+            const float rT(std::sqrt(crossX * crossX + crossY * crossY + crossZ * crossZ));
+            const bool isWithinLength((rL >= 0.f) & (rL <= coneLength));
+
+            nMatchedHits1 += static_cast<unsigned int>(isWithinLength & (rL * coneTanHalfAngle1 > rT));
+            nMatchedHits2 += static_cast<unsigned int>(isWithinLength & (rL * coneTanHalfAngle2 > rT));
+        }
+
+        boundedFractions1.push_back((nClusterHits > 0) ? static_cast<float>(nMatchedHits1) / static_cast<float>(nClusterHits) : 0.f);
+        boundedFractions2.push_back((nClusterHits > 0) ? static_cast<float>(nMatchedHits2) / static_cast<float>(nClusterHits) : 0.f);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void SimpleConeBatch::GetBoundedHitFractionsAndMeanRTs(
+    const Cluster *const pCluster, FloatVector &boundedFractions, FloatVector &meanRTs) const
+{
+    FloatVector hitX, hitY, hitZ;
+    SimpleConeBatch::GetHitCoordinates(pCluster, hitX, hitY, hitZ);
+
+    const unsigned int nHits(hitX.size());
+    const unsigned int nClusterHits(pCluster->GetNCaloHits());
+
+    for (unsigned int iCone = 0; iCone < this->GetNCones(); ++iCone)
+    {
+        const float apexX(m_apexX[iCone]), apexY(m_apexY[iCone]), apexZ(m_apexZ[iCone]);
+        const float directionX(m_directionX[iCone]), directionY(m_directionY[iCone]), directionZ(m_directionZ[iCone]);
+        const float coneLength(m_coneLength[iCone]), coneTanHalfAngle(m_coneTanHalfAngle[iCone]);
+        unsigned int nMatchedHits(0);
+        float rTSum(0.f);
+
+        // ATTN Same arithmetic as SimpleCone::GetBoundedHitFraction and SimpleCone::GetMeanRT, summing rT in the same hit order
+        for (unsigned int iHit = 0; iHit < nHits; ++iHit)
+        {
+            const float dX(hitX[iHit] - apexX), dY(hitY[iHit] - apexY), dZ(hitZ[iHit] - apexZ);
+            const float rL(dX * directionX + dY * directionY + dZ * directionZ);
+            const float crossX(dY * directionZ - dZ * directionY);
+            const float crossY(dZ * directionX - dX * directionZ);
+            const float crossZ(dX * directionY - dY * directionX);
+            const float rT(std::sqrt(crossX * crossX + crossY * crossY + crossZ * crossZ));
+            const bool isWithinLength((rL >= 0.f) & (rL <= coneLength));
+
+            nMatchedHits += static_cast<unsigned int>(isWithinLength & (rL * coneTanHalfAngle > rT));
+            rTSum += rT;
+        }
+
+        boundedFractions.push_back((nClusterHits > 0) ? static_cast<float>(nMatchedHits) / static_cast<float>(nClusterHits) : 0.f);
+        meanRTs.push_back((nClusterHits > 0) ? rTSum / static_cast<float>(nClusterHits) : 0.f);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void SimpleConeBatch::GetHitCoordinates(const Cluster *const pCluster, FloatVector &hitX, FloatVector &hitY, FloatVector &hitZ)
+{
+    CartesianPointVector hitPositionVector;
+    LArClusterHelper::GetCoordinateVector(pCluster, hitPositionVector);
+
+    const unsigned int nHits(hitPositionVector.size());
+    hitX.resize(nHits);
+    hitY.resize(nHits);
+    hitZ.resize(nHits);
+
+    for (unsigned int iHit = 0; iHit < nHits; ++iHit)
+    {
+        hitX[iHit] = hitPositionVector[iHit].GetX();
+        hitY[iHit] = hitPositionVector[iHit].GetY();
+        hitZ[iHit] = hitPositionVector[iHit].GetZ();
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template <typename T>
 ThreeDSlidingConeFitResult::ThreeDSlidingConeFitResult(const T *const pT, const unsigned int slidingFitWindow, const float slidingFitLayerPitch) :
     m_slidingFitResult(ThreeDSlidingFitResult(pT, slidingFitWindow, slidingFitLayerPitch))
@@ -114,6 +114,77 @@ typedef std::vector<SimpleCone> SimpleConeList;
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+/**
+ *  @brief  SimpleConeBatch class, holding the apices, directions, lengths and angles of a list of simple cones as contiguous arrays, so
+ *          that hit containment can be tested against all cones together
+ */
+class SimpleConeBatch
+{
+public:
+    /**
+     *  @brief  Constructor
+     *
+     *  @param  simpleConeList the simple cone list
+     */
+    SimpleConeBatch(const SimpleConeList &simpleConeList);
+
+    /**
+     *  @brief  Get the number of cones
+     *
+     *  @return the number of cones
+     */
+    unsigned int GetNCones() const;
+
+    /**
+     *  @brief  Get the fractions of hits in a provided cluster that are bounded within each cone, using a provided cone length and two
+     *          provided cone angles. Results match those of SimpleCone::GetBoundedHitFraction, but cluster positions are extracted once.
+     *
+     *  @param  pCluster the address of the cluster
+     *  @param  coneLength the provided cone length
+     *  @param  coneTanHalfAngle1 the first provided tangent of the cone half-angle
+     *  @param  coneTanHalfAngle2 the second provided tangent of the cone half-angle
+     *  @param  boundedFractions1 to receive the bounded hit fraction for each cone, using the first cone angle
+     *  @param  boundedFractions2 to receive the bounded hit fraction for each cone, using the second cone angle
+     */
+    void GetBoundedHitFractions(const pandora::Cluster *const pCluster, const float coneLength, const float coneTanHalfAngle1,
+        const float coneTanHalfAngle2, pandora::FloatVector &boundedFractions1, pandora::FloatVector &boundedFractions2) const;
+
+    /**
+     *  @brief  Get the fractions of hits in a provided cluster that are bounded within each cone, using the fitted cone length and angle,
+     *          and the mean transverse distances to all hits from each cone. Results match those of SimpleCone::GetBoundedHitFraction and
+     *          SimpleCone::GetMeanRT, but cluster positions are extracted once.
+     *
+     *  @param  pCluster the address of the cluster
+     *  @param  boundedFractions to receive the bounded hit fraction for each cone
+     *  @param  meanRTs to receive the mean transverse distance to all hits (whether contained or not) for each cone
+     */
+    void GetBoundedHitFractionsAndMeanRTs(
+        const pandora::Cluster *const pCluster, pandora::FloatVector &boundedFractions, pandora::FloatVector &meanRTs) const;
+
+private:
+    /**
+     *  @brief  Get the hit coordinates of a provided cluster as contiguous arrays, in the order of LArClusterHelper::GetCoordinateVector
+     *
+     *  @param  pCluster the address of the cluster
+     *  @param  hitX to receive the hit x coordinates
+     *  @param  hitY to receive the hit y coordinates
+     *  @param  hitZ to receive the hit z coordinates
+     */
+    static void GetHitCoordinates(
+        const pandora::Cluster *const pCluster, pandora::FloatVector &hitX, pandora::FloatVector &hitY, pandora::FloatVector &hitZ);
+
+    pandora::FloatVector m_apexX;            ///< The x coordinates of the cone apices
+    pandora::FloatVector m_apexY;            ///< The y coordinates of the cone apices
+    pandora::FloatVector m_apexZ;            ///< The z coordinates of the cone apices
+    pandora::FloatVector m_directionX;       ///< The x components of the cone directions
+    pandora::FloatVector m_directionY;       ///< The y components of the cone directions
+    pandora::FloatVector m_directionZ;       ///< The z components of the cone directions
+    pandora::FloatVector m_coneLength;       ///< The fitted cone lengths
+    pandora::FloatVector m_coneTanHalfAngle; ///< The fitted tangents of the cone half-angles
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 typedef std::map<int, pandora::TrackState> TrackStateMap;
 
 /**
@@ -217,6 +288,14 @@ inline float SimpleCone::GetBoundedHitFraction(const pandora::Cluster *const pCl
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+inline unsigned int SimpleConeBatch::GetNCones() const
+{
+    return m_apexX.size();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 inline const ThreeDSlidingFitResult &ThreeDSlidingConeFitResult::GetSlidingFitResult() const
 {
     return m_slidingFitResult;
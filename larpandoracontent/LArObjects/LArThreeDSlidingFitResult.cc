@@ -25,86 +25,26 @@ namespace lar_content
 {
 
 template <typename T>
-ThreeDSlidingFitResult::ThreeDSlidingFitResult(const T *const pT, const unsigned int layerWindow, const float layerPitch) :
+ThreeDSlidingFitResult::ThreeDSlidingFitResult(
+    const T *const pT, const unsigned int layerWindow, const float layerPitch, const FitMode fitMode) :
     m_primaryAxis(ThreeDSlidingFitResult::GetPrimaryAxis(pT, layerPitch)),
     m_axisIntercept(m_primaryAxis.GetPosition()),
     m_axisDirection(m_primaryAxis.GetMomentum()),
     m_firstOrthoDirection(ThreeDSlidingFitResult::GetSeedDirection(m_axisDirection).GetCrossProduct(m_axisDirection).GetUnitVector()),
     m_secondOrthoDirection(m_axisDirection.GetCrossProduct(m_firstOrthoDirection).GetUnitVector()),
-    m_firstFitResult(TwoDSlidingFitResult(pT, layerWindow, layerPitch, m_axisIntercept, m_axisDirection, m_firstOrthoDirection)),
-    m_secondFitResult(TwoDSlidingFitResult(pT, layerWindow, layerPitch, m_axisIntercept, m_axisDirection, m_secondOrthoDirection)),
-    m_minLayer(std::max(m_firstFitResult.GetMinLayer(), m_secondFitResult.GetMinLayer())),
-    m_maxLayer(std::min(m_firstFitResult.GetMaxLayer(), m_secondFitResult.GetMaxLayer())),
-    m_minLayerPosition(0.f, 0.f, 0.f),
-    m_maxLayerPosition(0.f, 0.f, 0.f),
-    m_minLayerDirection(0.f, 0.f, 0.f),
-    m_maxLayerDirection(0.f, 0.f, 0.f)
+    m_layerWindow(layerWindow),
+    m_layerPitch(layerPitch),
+    m_pCluster(ThreeDSlidingFitResult::GetInputCluster(pT)),
+    m_pFitState(this->MakeFitState(pT, ENDPOINTS_ONLY != fitMode))
 {
-    if (m_minLayer > m_maxLayer)
-        throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
-
-    const float minL(m_firstFitResult.GetL(m_minLayer));
-    const float maxL(m_firstFitResult.GetL(m_maxLayer));
-
-    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->GetGlobalFitPosition(minL, m_minLayerPosition));
-    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->GetGlobalFitPosition(maxL, m_maxLayerPosition));
-    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->GetGlobalFitDirection(minL, m_minLayerDirection));
-    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->GetGlobalFitDirection(maxL, m_maxLayerDirection));
-}
-
-//------------------------------------------------------------------------------------------------------------------------------------------
-
-const pandora::Cluster *ThreeDSlidingFitResult::GetCluster() const
-{
-    return m_firstFitResult.GetCluster();
-}
-
-//------------------------------------------------------------------------------------------------------------------------------------------
-
-int ThreeDSlidingFitResult::GetMinLayer() const
-{
-    const int firstLayer(m_firstFitResult.GetMinLayer());
-    const int secondLayer(m_secondFitResult.GetMinLayer());
-
-    return std::min(firstLayer, secondLayer);
-}
-
-//------------------------------------------------------------------------------------------------------------------------------------------
-
-int ThreeDSlidingFitResult::GetMaxLayer() const
-{
-    const int firstLayer(m_firstFitResult.GetMaxLayer());
-    const int secondLayer(m_secondFitResult.GetMaxLayer());
-
-    return std::max(firstLayer, secondLayer);
-}
-
-//------------------------------------------------------------------------------------------------------------------------------------------
-
-float ThreeDSlidingFitResult::GetMinLayerRms() const
-{
-    const float firstRms(m_firstFitResult.GetMinLayerRms());
-    const float secondRms(m_secondFitResult.GetMinLayerRms());
-
-    return std::sqrt(firstRms * firstRms + secondRms * secondRms);
-}
-
-//------------------------------------------------------------------------------------------------------------------------------------------
-
-float ThreeDSlidingFitResult::GetMaxLayerRms() const
-{
-    const float firstRms(m_firstFitResult.GetMaxLayerRms());
-    const float secondRms(m_secondFitResult.GetMaxLayerRms());
-
-    return std::sqrt(firstRms * firstRms + secondRms * secondRms);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 float ThreeDSlidingFitResult::GetFitRms(const float rL) const
 {
-    const float firstRms(m_firstFitResult.GetFitRms(rL));
-    const float secondRms(m_secondFitResult.GetFitRms(rL));
+    const float firstRms(this->GetFirstFitResult().GetFitRms(rL));
+    const float secondRms(this->GetSecondFitResult().GetFitRms(rL));
 
     return std::sqrt(firstRms * firstRms + secondRms * secondRms);
 }
@@ -118,30 +58,36 @@ float ThreeDSlidingFitResult::GetLongitudinalDisplacement(const CartesianVector
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-StatusCode ThreeDSlidingFitResult::GetGlobalFitPosition(const float rL, CartesianVector &position) const
+StatusCode ThreeDSlidingFitResult::GetGlobalFitPosition(const FitState &fitState, const float rL, CartesianVector &position) const
 {
+    if (!fitState.m_pFirstFitResult || !fitState.m_pSecondFitResult)
+        return STATUS_CODE_NOT_INITIALIZED;
+
+    const TwoDSlidingFitResult &firstFitResult(*fitState.m_pFirstFitResult);
+    const TwoDSlidingFitResult &secondFitResult(*fitState.m_pSecondFitResult);
+
     // Check that input coordinates are between first and last layers
-    const int layer1(m_firstFitResult.GetLayer(rL));
-    const int layer2(m_secondFitResult.GetLayer(rL));
+    const int layer1(firstFitResult.GetLayer(rL));
+    const int layer2(secondFitResult.GetLayer(rL));
 
-    if (std::min(layer1, layer2) < m_minLayer || std::max(layer1, layer2) > m_maxLayer)
+    if (std::min(layer1, layer2) < fitState.m_minLayer || std::max(layer1, layer2) > fitState.m_maxLayer)
         return STATUS_CODE_INVALID_PARAMETER;
 
     // Get local positions from each sliding fit (TODO: Make this more efficient)
     CartesianVector firstPosition(0.f, 0.f, 0.f), secondPosition(0.f, 0.f, 0.f);
-    const StatusCode statusCode1(m_firstFitResult.GetGlobalFitPosition(rL, firstPosition));
+    const StatusCode statusCode1(firstFitResult.GetGlobalFitPosition(rL, firstPosition));
 
     if (STATUS_CODE_SUCCESS != statusCode1)
         return statusCode1;
 
-    const StatusCode statusCode2(m_secondFitResult.GetGlobalFitPosition(rL, secondPosition));
+    const StatusCode statusCode2(secondFitResult.GetGlobalFitPosition(rL, secondPosition));
 
     if (STATUS_CODE_SUCCESS != statusCode2)
         return statusCode2;
 
     float rL1(0.f), rT1(0.f), rL2(0.f), rT2(0.f);
-    m_firstFitResult.GetLocalPosition(firstPosition, rL1, rT1);
-    m_secondFitResult.GetLocalPosition(secondPosition, rL2, rT2);
+    firstFitResult.GetLocalPosition(firstPosition, rL1, rT1);
+    secondFitResult.GetLocalPosition(secondPosition, rL2, rT2);
 
     // Combine local positions to give an overall global direction
     this->GetGlobalPosition(rL, rT1, rT2, position);
@@ -151,30 +97,36 @@ StatusCode ThreeDSlidingFitResult::GetGlobalFitPosition(const float rL, Cartesia
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-StatusCode ThreeDSlidingFitResult::GetGlobalFitDirection(const float rL, CartesianVector &direction) const
+StatusCode ThreeDSlidingFitResult::GetGlobalFitDirection(const FitState &fitState, const float rL, CartesianVector &direction) const
 {
+    if (!fitState.m_pFirstFitResult || !fitState.m_pSecondFitResult)
+        return STATUS_CODE_NOT_INITIALIZED;
+
+    const TwoDSlidingFitResult &firstFitResult(*fitState.m_pFirstFitResult);
+    const TwoDSlidingFitResult &secondFitResult(*fitState.m_pSecondFitResult);
+
     // Check that input coordinates are between first and last layers
-    const int layer1(m_firstFitResult.GetLayer(rL));
-    const int layer2(m_secondFitResult.GetLayer(rL));
+    const int layer1(firstFitResult.GetLayer(rL));
+    const int layer2(secondFitResult.GetLayer(rL));
 
-    if (std::min(layer1, layer2) < m_minLayer || std::max(layer1, layer2) > m_maxLayer)
+    if (std::min(layer1, layer2) < fitState.m_minLayer || std::max(layer1, layer2) > fitState.m_maxLayer)
         return STATUS_CODE_INVALID_PARAMETER;
 
     // Get local directions from each sliding fit (TODO: Make this more efficient)
     CartesianVector firstDirection(0.f, 0.f, 0.f), secondDirection(0.f, 0.f, 0.f);
-    const StatusCode statusCode1(m_firstFitResult.GetGlobalFitDirection(rL, firstDirection));
+    const StatusCode statusCode1(firstFitResult.GetGlobalFitDirection(rL, firstDirection));
 
     if (STATUS_CODE_SUCCESS != statusCode1)
         return statusCode1;
 
-    const StatusCode statusCode2(m_secondFitResult.GetGlobalFitDirection(rL, secondDirection));
+    const StatusCode statusCode2(secondFitResult.GetGlobalFitDirection(rL, secondDirection));
 
     if (STATUS_CODE_SUCCESS != statusCode2)
         return statusCode2;
 
     float dTdL1(0.f), dTdL2(0.f);
-    m_firstFitResult.GetLocalDirection(firstDirection, dTdL1);
-    m_secondFitResult.GetLocalDirection(secondDirection, dTdL2);
+    firstFitResult.GetLocalDirection(firstDirection, dTdL1);
+    secondFitResult.GetLocalDirection(secondDirection, dTdL2);
 
     // Combine local directions to give an overall global direction
     this->GetGlobalDirection(dTdL1, dTdL2, direction);
@@ -184,6 +136,72 @@ StatusCode ThreeDSlidingFitResult::GetGlobalFitDirection(const float rL, Cartesi
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+template <typename T>
+ThreeDSlidingFitResult::FitStatePtr ThreeDSlidingFitResult::MakeFitState(const T *const pT, const bool retainFits) const
+{
+    std::shared_ptr<FitState> pFitState(new FitState);
+    pFitState->m_pFirstFitResult.reset(
+        new TwoDSlidingFitResult(pT, m_layerWindow, m_layerPitch, m_axisIntercept, m_axisDirection, m_firstOrthoDirection));
+    pFitState->m_pSecondFitResult.reset(
+        new TwoDSlidingFitResult(pT, m_layerWindow, m_layerPitch, m_axisIntercept, m_axisDirection, m_secondOrthoDirection));
+
+    const TwoDSlidingFitResult &firstFitResult(*pFitState->m_pFirstFitResult);
+    const TwoDSlidingFitResult &secondFitResult(*pFitState->m_pSecondFitResult);
+
+    pFitState->m_minLayer = std::max(firstFitResult.GetMinLayer(), secondFitResult.GetMinLayer());
+    pFitState->m_maxLayer = std::min(firstFitResult.GetMaxLayer(), secondFitResult.GetMaxLayer());
+
+    if (pFitState->m_minLayer > pFitState->m_maxLayer)
+        throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
+
+    pFitState->m_minOccupiedLayer = std::min(firstFitResult.GetMinLayer(), secondFitResult.GetMinLayer());
+    pFitState->m_maxOccupiedLayer = std::max(firstFitResult.GetMaxLayer(), secondFitResult.GetMaxLayer());
+
+    const float firstMinRms(firstFitResult.GetMinLayerRms()), secondMinRms(secondFitResult.GetMinLayerRms());
+    const float firstMaxRms(firstFitResult.GetMaxLayerRms()), secondMaxRms(secondFitResult.GetMaxLayerRms());
+    pFitState->m_minLayerRms = std::sqrt(firstMinRms * firstMinRms + secondMinRms * secondMinRms);
+    pFitState->m_maxLayerRms = std::sqrt(firstMaxRms * firstMaxRms + secondMaxRms * secondMaxRms);
+
+    const float minL(firstFitResult.GetL(pFitState->m_minLayer));
+    const float maxL(firstFitResult.GetL(pFitState->m_maxLayer));
+
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->GetGlobalFitPosition(*pFitState, minL, pFitState->m_minLayerPosition));
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->GetGlobalFitPosition(*pFitState, maxL, pFitState->m_maxLayerPosition));
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->GetGlobalFitDirection(*pFitState, minL, pFitState->m_minLayerDirection));
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->GetGlobalFitDirection(*pFitState, maxL, pFitState->m_maxLayerDirection));
+
+    if (!retainFits)
+    {
+        pFitState->m_pFirstFitResult.reset();
+        pFitState->m_pSecondFitResult.reset();
+    }
+
+    return pFitState;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const ThreeDSlidingFitResult::FitState &ThreeDSlidingFitResult::GetFitState() const
+{
+    return *m_pFitState;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const Cluster *ThreeDSlidingFitResult::GetInputCluster(const Cluster *const pCluster)
+{
+    return pCluster;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const Cluster *ThreeDSlidingFitResult::GetInputCluster(const CartesianPointVector *const)
+{
+    return nullptr;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void ThreeDSlidingFitResult::GetGlobalPosition(const float rL, const float rT1, const float rT2, CartesianVector &position) const
 {
     position = m_axisIntercept + m_axisDirection * rL + m_firstOrthoDirection * rT1 + m_secondOrthoDirection * rT2;
@@ -269,7 +287,8 @@ CartesianVector ThreeDSlidingFitResult::GetSeedDirection(const CartesianVector &
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-template ThreeDSlidingFitResult::ThreeDSlidingFitResult(const pandora::Cluster *const, const unsigned int, const float);
-template ThreeDSlidingFitResult::ThreeDSlidingFitResult(const pandora::CartesianPointVector *const, const unsigned int, const float);
+template ThreeDSlidingFitResult::ThreeDSlidingFitResult(const pandora::Cluster *const, const unsigned int, const float, const FitMode);
+template ThreeDSlidingFitResult::ThreeDSlidingFitResult(
+    const pandora::CartesianPointVector *const, const unsigned int, const float, const FitMode);
 
 } // namespace lar_content
@@ -12,6 +12,7 @@
 
 #include "larpandoracontent/LArObjects/LArTwoDSlidingFitResult.h"
 
+#include <memory>
 #include <unordered_map>
 
 namespace lar_content
@@ -23,15 +24,27 @@ namespace lar_content
 class ThreeDSlidingFitResult
 {
 public:
+    /**
+     *  @brief  FitMode enum, controlling when the orthogonal sliding fits are performed and what is retained from them
+     */
+    enum FitMode
+    {
+        FULL_FIT,      ///< Perform the orthogonal sliding fits on construction and retain them
+        ENDPOINTS_ONLY ///< Perform the orthogonal sliding fits on construction, then retain only the layer, end and direction results
+    };
+
     /**
      *  @brief  Constructor
      *
      *  @param  pT describing the positions to be fitted
      *  @param  slidingFitWindow the sliding fit window
      *  @param  slidingFitLayerPitch the sliding fit z pitch, units cm
+     *  @param  fitMode the fit mode. In endpoints only mode, the sliding fit results and the queries for arbitrary longitudinal coordinates
+     *          are unavailable.
      */
     template <typename T>
-    ThreeDSlidingFitResult(const T *const pT, const unsigned int slidingFitWindow, const float slidingFitLayerPitch);
+    ThreeDSlidingFitResult(
+        const T *const pT, const unsigned int slidingFitWindow, const float slidingFitLayerPitch, const FitMode fitMode = FULL_FIT);
 
     /**
      *  @brief  Get the address of the cluster
@@ -163,6 +176,91 @@ public:
     pandora::StatusCode GetGlobalFitDirection(const float rL, pandora::CartesianVector &direction) const;
 
 private:
+    /**
+     *  @brief  FitState class, holding the orthogonal sliding fits and the quantities derived from them
+     */
+    class FitState
+    {
+    public:
+        /**
+         *  @brief  Default constructor
+         */
+        FitState();
+
+        std::unique_ptr<const TwoDSlidingFitResult> m_pFirstFitResult;  ///< The first sliding fit result, if retained
+        std::unique_ptr<const TwoDSlidingFitResult> m_pSecondFitResult; ///< The second sliding fit result, if retained
+        int m_minLayer;                                                 ///< The minimum combined layer
+        int m_maxLayer;                                                 ///< The maximum combined layer
+        int m_minOccupiedLayer;                                         ///< The minimum occupied layer in either sliding fit
+        int m_maxOccupiedLayer;                                         ///< The maximum occupied layer in either sliding fit
+        float m_minLayerRms;                                            ///< The rms at the minimum layer
+        float m_maxLayerRms;                                            ///< The rms at the maximum layer
+        pandora::CartesianVector m_minLayerPosition;                    ///< The global position at the minimum combined layer
+        pandora::CartesianVector m_maxLayerPosition;                    ///< The global position at the maximum combined layer
+        pandora::CartesianVector m_minLayerDirection;                   ///< The global direction at the minimum combined layer
+        pandora::CartesianVector m_maxLayerDirection;                   ///< The global direction at the maximum combined layer
+    };
+
+    typedef std::shared_ptr<const FitState> FitStatePtr;
+
+    /**
+     *  @brief  Perform the orthogonal sliding fits and calculate the quantities derived from them
+     *
+     *  @param  pT describing the positions to be fitted
+     *  @param  retainFits whether to retain the sliding fit results
+     *
+     *  @return the fit state
+     */
+    template <typename T>
+    FitStatePtr MakeFitState(const T *const pT, const bool retainFits) const;
+
+    /**
+     *  @brief  Get the fit state
+     *
+     *  @return the fit state
+     */
+    const FitState &GetFitState() const;
+
+    /**
+     *  @brief  Get the address of the input cluster, for a cluster
+     *
+     *  @param  pCluster the address of the input cluster
+     *
+     *  @return the address of the input cluster
+     */
+    static const pandora::Cluster *GetInputCluster(const pandora::Cluster *const pCluster);
+
+    /**
+     *  @brief  Get the address of the input cluster, for a point vector
+     *
+     *  @param  pPointVector the address of the input point vector
+     *
+     *  @return nullptr, as there is no input cluster
+     */
+    static const pandora::Cluster *GetInputCluster(const pandora::CartesianPointVector *const pPointVector);
+
+    /**
+     *  @brief  Get global fit position for a given longitudinal coordinate, using a specified fit state
+     *
+     *  @param  fitState the fit state
+     *  @param  rL the longitudinal coordinate
+     *  @param  position the fitted position at these coordinates
+     *
+     *  @return status code, faster than throwing in regular use-cases
+     */
+    pandora::StatusCode GetGlobalFitPosition(const FitState &fitState, const float rL, pandora::CartesianVector &position) const;
+
+    /**
+     *  @brief  Get global fit direction for a given longitudinal coordinate, using a specified fit state
+     *
+     *  @param  fitState the fit state
+     *  @param  rL the longitudinal coordinate
+     *  @param  direction the fitted direction at these coordinates
+     *
+     *  @return status code, faster than throwing in regular use-cases
+     */
+    pandora::StatusCode GetGlobalFitDirection(const FitState &fitState, const float rL, pandora::CartesianVector &direction) const;
+
     /**
      *  @brief  Get global coordinates for a given pair of sliding linear fit coordinates
      *
@@ -216,15 +314,11 @@ private:
     const pandora::CartesianVector m_axisDirection;        ///< The axis direction vector
     const pandora::CartesianVector m_firstOrthoDirection;  ///< The orthogonal direction vector
     const pandora::CartesianVector m_secondOrthoDirection; ///< The orthogonal direction vector
-    const TwoDSlidingFitResult m_firstFitResult;           ///< The first sliding fit result
-    const TwoDSlidingFitResult m_secondFitResult;          ///< The second sliding fit result
-    const int m_minLayer;                                  ///< The minimum combined layer
-    const int m_maxLayer;                                  ///< The maximum combined layer
-
-    pandora::CartesianVector m_minLayerPosition;  ///< The global position at the minimum combined layer
-    pandora::CartesianVector m_maxLayerPosition;  ///< The global position at the maximum combined layer
-    pandora::CartesianVector m_minLayerDirection; ///< The global direction at the minimum combined layer
-    pandora::CartesianVector m_maxLayerDirection; ///< The global direction at the maximum combined layer
+    const unsigned int m_layerWindow;                      ///< The sliding fit window
+    const float m_layerPitch;                              ///< The sliding fit z pitch, units cm
+
+    const pandora::Cluster *const m_pCluster;              ///< The address of the input cluster, if any
+    const FitStatePtr m_pFitState;                         ///< The immutable fit state, shared between copies
 };
 
 typedef std::vector<ThreeDSlidingFitResult> ThreeDSlidingFitResultList;
@@ -249,42 +343,120 @@ inline const pandora::CartesianVector &ThreeDSlidingFitResult::GetAxisDirection(
 
 inline const TwoDSlidingFitResult &ThreeDSlidingFitResult::GetFirstFitResult() const
 {
-    return m_firstFitResult;
+    const FitState &fitState(this->GetFitState());
+
+    if (!fitState.m_pFirstFitResult)
+        throw pandora::StatusCodeException(pandora::STATUS_CODE_NOT_INITIALIZED);
+
+    return *fitState.m_pFirstFitResult;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 inline const TwoDSlidingFitResult &ThreeDSlidingFitResult::GetSecondFitResult() const
 {
-    return m_secondFitResult;
+    const FitState &fitState(this->GetFitState());
+
+    if (!fitState.m_pSecondFitResult)
+        throw pandora::StatusCodeException(pandora::STATUS_CODE_NOT_INITIALIZED);
+
+    return *fitState.m_pSecondFitResult;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 inline const pandora::CartesianVector &ThreeDSlidingFitResult::GetGlobalMinLayerPosition() const
 {
-    return m_minLayerPosition;
+    return this->GetFitState().m_minLayerPosition;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 inline const pandora::CartesianVector &ThreeDSlidingFitResult::GetGlobalMaxLayerPosition() const
 {
-    return m_maxLayerPosition;
+    return this->GetFitState().m_maxLayerPosition;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 inline const pandora::CartesianVector &ThreeDSlidingFitResult::GetGlobalMinLayerDirection() const
 {
-    return m_minLayerDirection;
+    return this->GetFitState().m_minLayerDirection;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 inline const pandora::CartesianVector &ThreeDSlidingFitResult::GetGlobalMaxLayerDirection() const
 {
-    return m_maxLayerDirection;
+    return this->GetFitState().m_maxLayerDirection;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const pandora::Cluster *ThreeDSlidingFitResult::GetCluster() const
+{
+    if (!m_pCluster)
+        throw pandora::StatusCodeException(pandora::STATUS_CODE_NOT_INITIALIZED);
+
+    return m_pCluster;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline int ThreeDSlidingFitResult::GetMinLayer() const
+{
+    return this->GetFitState().m_minOccupiedLayer;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline int ThreeDSlidingFitResult::GetMaxLayer() const
+{
+    return this->GetFitState().m_maxOccupiedLayer;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline float ThreeDSlidingFitResult::GetMinLayerRms() const
+{
+    return this->GetFitState().m_minLayerRms;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline float ThreeDSlidingFitResult::GetMaxLayerRms() const
+{
+    return this->GetFitState().m_maxLayerRms;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline pandora::StatusCode ThreeDSlidingFitResult::GetGlobalFitPosition(const float rL, pandora::CartesianVector &position) const
+{
+    return this->GetGlobalFitPosition(this->GetFitState(), rL, position);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline pandora::StatusCode ThreeDSlidingFitResult::GetGlobalFitDirection(const float rL, pandora::CartesianVector &direction) const
+{
+    return this->GetGlobalFitDirection(this->GetFitState(), rL, direction);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline ThreeDSlidingFitResult::FitState::FitState() :
+    m_minLayer(0),
+    m_maxLayer(0),
+    m_minOccupiedLayer(0),
+    m_maxOccupiedLayer(0),
+    m_minLayerRms(0.f),
+    m_maxLayerRms(0.f),
+    m_minLayerPosition(0.f, 0.f, 0.f),
+    m_maxLayerPosition(0.f, 0.f, 0.f),
+    m_minLayerDirection(0.f, 0.f, 0.f),
+    m_maxLayerDirection(0.f, 0.f, 0.f)
+{
 }
 
 } // namespace lar_content
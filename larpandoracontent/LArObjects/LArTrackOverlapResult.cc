@@ -12,6 +12,8 @@
 
 #include "larpandoracontent/LArObjects/LArTrackOverlapResult.h"
 
+#include <utility>
+
 using namespace pandora;
 
 namespace lar_content
@@ -268,6 +270,15 @@ FragmentOverlapResult::FragmentOverlapResult(const FragmentOverlapResult &rhs) :
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+FragmentOverlapResult::FragmentOverlapResult(FragmentOverlapResult &&rhs) :
+    TrackOverlapResult(rhs),
+    m_caloHitList(rhs.IsInitialized() ? std::move(rhs.m_caloHitList) : CaloHitList()),
+    m_clusterList(rhs.IsInitialized() ? std::move(rhs.m_clusterList) : ClusterList())
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 FragmentOverlapResult::~FragmentOverlapResult()
 {
 }
@@ -285,6 +296,17 @@ FragmentOverlapResult &FragmentOverlapResult::operator=(const FragmentOverlapRes
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+FragmentOverlapResult &FragmentOverlapResult::operator=(FragmentOverlapResult &&rhs)
+{
+    this->TrackOverlapResult::operator=(rhs);
+    m_caloHitList = std::move(rhs.m_caloHitList);
+    m_clusterList = std::move(rhs.m_clusterList);
+
+    return *this;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 pandora::HitType FragmentOverlapResult::GetFragmentHitType() const
 {
     if (m_caloHitList.empty())
@@ -319,6 +341,14 @@ DeltaRayOverlapResult::DeltaRayOverlapResult(const DeltaRayOverlapResult &rhs) :
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+DeltaRayOverlapResult::DeltaRayOverlapResult(DeltaRayOverlapResult &&rhs) :
+    TransverseOverlapResult(rhs),
+    m_commonMuonPfoList(std::move(rhs.m_commonMuonPfoList))
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 DeltaRayOverlapResult::~DeltaRayOverlapResult()
 {
 }
@@ -334,6 +364,17 @@ DeltaRayOverlapResult &DeltaRayOverlapResult::operator=(const DeltaRayOverlapRes
     return *this;
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+DeltaRayOverlapResult &DeltaRayOverlapResult::operator=(DeltaRayOverlapResult &&rhs)
+{
+    this->TransverseOverlapResult::operator=(rhs);
+
+    m_commonMuonPfoList = std::move(rhs.m_commonMuonPfoList);
+
+    return *this;
+}
+
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
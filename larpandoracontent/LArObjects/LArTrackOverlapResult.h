@@ -301,6 +301,13 @@ public:
      */
     FragmentOverlapResult(const FragmentOverlapResult &rhs);
 
+    /**
+     *  @brief  Move constructor, taking the hit and cluster lists rather than copying them
+     *
+     *  @param  rhs
+     */
+    FragmentOverlapResult(FragmentOverlapResult &&rhs);
+
     /**
      *  @brief  Destructor
      */
@@ -334,6 +341,13 @@ public:
      */
     FragmentOverlapResult &operator=(const FragmentOverlapResult &rhs);
 
+    /**
+     *  @brief  Fragments overlap result move assigment operator, taking the hit and cluster lists rather than copying them
+     *
+     *  @param  rhs the track overlap result to assign
+     */
+    FragmentOverlapResult &operator=(FragmentOverlapResult &&rhs);
+
 private:
     pandora::CaloHitList m_caloHitList; ///< The list of fragment-associated hits
     pandora::ClusterList m_clusterList; ///< The list of fragment-associated clusters
@@ -373,6 +387,13 @@ public:
      */
     DeltaRayOverlapResult(const DeltaRayOverlapResult &rhs);
 
+    /**
+     *  @brief  Move constructor, taking the common muon pfo list rather than copying it
+     *
+     *  @param  rhs
+     */
+    DeltaRayOverlapResult(DeltaRayOverlapResult &&rhs);
+
     /**
      *  @brief  Destructor
      */
@@ -392,6 +413,13 @@ public:
      */
     DeltaRayOverlapResult &operator=(const DeltaRayOverlapResult &rhs);
 
+    /**
+     *  @brief  Track overlap result move assigment operator, taking the common muon pfo list rather than copying it
+     *
+     *  @param  rhs the track overlap result to assign
+     */
+    DeltaRayOverlapResult &operator=(DeltaRayOverlapResult &&rhs);
+
 private:
     pandora::PfoList m_commonMuonPfoList; ///< The list of cosmic ray pfos that, in each view, lie close to the clusters of the tensor element
 };
@@ -9,6 +9,8 @@
 #include "larpandoracontent/LArObjects/LArTrackTwoViewOverlapResult.h"
 #include "Objects/Cluster.h"
 
+#include <utility>
+
 using namespace pandora;
 
 namespace lar_content
@@ -51,6 +53,18 @@ TwoViewDeltaRayOverlapResult::TwoViewDeltaRayOverlapResult(const TwoViewDeltaRay
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+TwoViewDeltaRayOverlapResult::TwoViewDeltaRayOverlapResult(TwoViewDeltaRayOverlapResult &&rhs) :
+    m_isInitialized(rhs.m_isInitialized),
+    m_xOverlap(rhs.GetXOverlap()),
+    m_commonMuonPfoList(std::move(rhs.m_commonMuonPfoList)),
+    m_pBestMatchedCluster(rhs.GetBestMatchedCluster()),
+    m_matchedClusterList(std::move(rhs.m_matchedClusterList)),
+    m_reducedChiSquared(rhs.GetReducedChiSquared())
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 TwoViewDeltaRayOverlapResult::~TwoViewDeltaRayOverlapResult()
 {
 }
@@ -93,6 +107,23 @@ TwoViewDeltaRayOverlapResult &TwoViewDeltaRayOverlapResult::operator=(const TwoV
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+TwoViewDeltaRayOverlapResult &TwoViewDeltaRayOverlapResult::operator=(TwoViewDeltaRayOverlapResult &&rhs)
+{
+    if (this == &rhs)
+        return *this;
+
+    m_isInitialized = rhs.m_isInitialized;
+    m_xOverlap = rhs.GetXOverlap();
+    m_commonMuonPfoList = std::move(rhs.m_commonMuonPfoList);
+    m_pBestMatchedCluster = rhs.GetBestMatchedCluster();
+    m_matchedClusterList = std::move(rhs.m_matchedClusterList);
+    m_reducedChiSquared = rhs.GetReducedChiSquared();
+
+    return *this;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 bool TwoViewDeltaRayOverlapResult::operator<(const TwoViewDeltaRayOverlapResult &rhs) const
 {
     if (this == &rhs)
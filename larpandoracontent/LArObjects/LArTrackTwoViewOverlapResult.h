@@ -47,6 +47,13 @@ public:
      */
     TwoViewDeltaRayOverlapResult(const TwoViewDeltaRayOverlapResult &rhs);
 
+    /**
+     *  @brief  Move constructor, taking the common muon pfo and matched cluster lists rather than copying them
+     *
+     *  @param  rhs
+     */
+    TwoViewDeltaRayOverlapResult(TwoViewDeltaRayOverlapResult &&rhs);
+
     /**
      *  @brief  Destructor
      */
@@ -108,6 +115,13 @@ public:
      */
     TwoViewDeltaRayOverlapResult &operator=(const TwoViewDeltaRayOverlapResult &rhs);
 
+    /**
+     *  @brief  Track overlap result move assigment operator, taking the common muon pfo and matched cluster lists rather than copying them
+     *
+     *  @param  rhs the track overlap result to assign
+     */
+    TwoViewDeltaRayOverlapResult &operator=(TwoViewDeltaRayOverlapResult &&rhs);
+
     /**
      *  @brief  Track two view overlap result less than operator
      *
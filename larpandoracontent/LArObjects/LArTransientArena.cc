@@ -0,0 +1,49 @@
+/**
+ *  @file   larpandoracontent/LArObjects/LArTransientArena.cc
+ *
+ *  @brief  Implementation of the lar transient arena class.
+ *
+ *  $Log: $
+ */
+
+#include "larpandoracontent/LArObjects/LArTransientArena.h"
+
+namespace lar_content
+{
+
+const size_t TransientArena::m_initialArenaBytes(64 * 1024);
+
+thread_local unsigned int TransientArena::m_nScopes(0);
+thread_local std::unique_ptr<std::pmr::monotonic_buffer_resource> TransientArena::m_pArena;
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+std::pmr::memory_resource *TransientArena::GetMemoryResource()
+{
+    if (0 == m_nScopes)
+        return std::pmr::get_default_resource();
+
+    return m_pArena.get();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+TransientArena::Scope::Scope()
+{
+    // ATTN The arena is retained by the thread between scopes, so that a late deallocation never reaches a destroyed memory resource
+    if (!m_pArena)
+        m_pArena = std::make_unique<std::pmr::monotonic_buffer_resource>(m_initialArenaBytes, std::pmr::new_delete_resource());
+
+    ++m_nScopes;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+TransientArena::Scope::~Scope()
+{
+    if (0 == --m_nScopes)
+        m_pArena->release();
+}
+
+} // namespace lar_content
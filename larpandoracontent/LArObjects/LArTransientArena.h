@@ -0,0 +1,81 @@
+/**
+ *  @file   larpandoracontent/LArObjects/LArTransientArena.h
+ *
+ *  @brief  Header file for the lar transient arena class and the arena container typedefs.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_TRANSIENT_ARENA_H
+#define LAR_TRANSIENT_ARENA_H 1
+
+#include <functional>
+#include <list>
+#include <memory>
+#include <memory_resource>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace lar_content
+{
+
+/**
+ *  @brief  TransientArena class, providing a monotonic memory arena for each thread. While any Scope instance exists on a thread, the
+ *          memory resource for that thread is its arena, from which allocations are made by bumping a pointer and which is released
+ *          wholesale when the outermost scope is destroyed. Otherwise the memory resource is the default memory resource.
+ *
+ *          Arena containers must be constructed with the memory resource, e.g. map(TransientArena::GetMemoryResource()), must be
+ *          destroyed before the outermost scope and must only be modified on the thread that constructed them.
+ */
+class TransientArena
+{
+public:
+    /**
+     *  @brief  Scope class, enabling the arena for the current thread over its lifetime, e.g. the lifetime of an algorithm run
+     */
+    class Scope
+    {
+    public:
+        /**
+         *  @brief  Default constructor
+         */
+        Scope();
+
+        /**
+         *  @brief  Destructor, releasing the arena memory if this is the outermost scope on the thread
+         */
+        ~Scope();
+
+        Scope(const Scope &) = delete;
+        Scope &operator=(const Scope &) = delete;
+    };
+
+    /**
+     *  @brief  Get the memory resource for the current thread, the arena if a scope exists on the thread, or the default memory resource
+     *
+     *  @return the address of the memory resource
+     */
+    static std::pmr::memory_resource *GetMemoryResource();
+
+private:
+    static const size_t m_initialArenaBytes; ///< The size of the first block allocated by an arena, with later blocks growing geometrically
+
+    static thread_local unsigned int m_nScopes;                                       ///< The number of scopes on the current thread
+    static thread_local std::unique_ptr<std::pmr::monotonic_buffer_resource> m_pArena; ///< The arena for the current thread
+};
+
+template <typename T>
+using ArenaVector = std::pmr::vector<T>;
+
+template <typename T>
+using ArenaList = std::pmr::list<T>;
+
+template <typename T, typename Hash = std::hash<T>>
+using ArenaUnorderedSet = std::pmr::unordered_set<T, Hash>;
+
+template <typename K, typename V, typename Hash = std::hash<K>>
+using ArenaUnorderedMap = std::pmr::unordered_map<K, V, Hash>;
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_TRANSIENT_ARENA_H
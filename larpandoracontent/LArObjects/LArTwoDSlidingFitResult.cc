@@ -30,7 +30,8 @@ TwoDSlidingFitResult::TwoDSlidingFitResult(const Cluster *const pCluster, const
     m_layerPitch(layerPitch),
     m_axisIntercept(0.f, 0.f, 0.f),
     m_axisDirection(0.f, 0.f, 0.f),
-    m_orthoDirection(0.f, 0.f, 0.f)
+    m_orthoDirection(0.f, 0.f, 0.f),
+    m_minFitLayer(0)
 {
     CartesianPointVector pointVector;
     LArClusterHelper::GetCoordinateVector(pCluster, pointVector);
@@ -64,7 +65,8 @@ TwoDSlidingFitResult::TwoDSlidingFitResult(const CartesianPointVector *const pPo
     m_layerPitch(layerPitch),
     m_axisIntercept(0.f, 0.f, 0.f),
     m_axisDirection(0.f, 0.f, 0.f),
-    m_orthoDirection(0.f, 0.f, 0.f)
+    m_orthoDirection(0.f, 0.f, 0.f),
+    m_minFitLayer(0)
 {
     this->CalculateAxes(*pPointVector, layerPitch);
     this->FillLayerFitContributionMap(*pPointVector);
@@ -83,7 +85,8 @@ TwoDSlidingFitResult::TwoDSlidingFitResult(const Cluster *const pCluster, const
     m_layerPitch(layerPitch),
     m_axisIntercept(axisIntercept),
     m_axisDirection(axisDirection),
-    m_orthoDirection(orthoDirection)
+    m_orthoDirection(orthoDirection),
+    m_minFitLayer(0)
 {
     const CartesianVector xAxis(1.f, 0.f, 0.f);
     const float cosOpeningAngle(xAxis.GetCosOpeningAngle(m_axisDirection));
@@ -115,7 +118,8 @@ TwoDSlidingFitResult::TwoDSlidingFitResult(const CartesianPointVector *const pPo
     m_layerPitch(layerPitch),
     m_axisIntercept(axisIntercept),
     m_axisDirection(axisDirection),
-    m_orthoDirection(orthoDirection)
+    m_orthoDirection(orthoDirection),
+    m_minFitLayer(0)
 {
     this->FillLayerFitContributionMap(*pPointVector);
     this->PerformSlidingLinearFit();
@@ -132,7 +136,8 @@ TwoDSlidingFitResult::TwoDSlidingFitResult(const unsigned int layerFitHalfWindow
     m_axisIntercept(axisIntercept),
     m_axisDirection(axisDirection),
     m_orthoDirection(orthoDirection),
-    m_layerFitContributionMap(layerFitContributionMap)
+    m_layerFitContributionMap(layerFitContributionMap),
+    m_minFitLayer(0)
 {
     this->PerformSlidingLinearFit();
     this->FindSlidingFitSegments();
@@ -415,6 +420,64 @@ StatusCode TwoDSlidingFitResult::GetGlobalFitProjection(const CartesianVector &i
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void TwoDSlidingFitResult::GetGlobalFitPositions(
+    const FloatVector &rLVector, CartesianPointVector &positionVector, StatusCodeVector &statusCodeVector) const
+{
+    if (m_layerFitResultMap.empty())
+        throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
+
+    const int maxLayer(m_layerFitResultMap.rbegin()->first);
+
+    bool hasSurroundingLayers(false);
+    LayerFitResultMap::const_iterator firstLayerIter(m_layerFitResultMap.end()), secondLayerIter(m_layerFitResultMap.end());
+
+    for (const float rL : rLVector)
+    {
+        // Surrounding layers can be reused if there is no layer fit result between them and the new start layer
+        const int thisLayer(this->GetLayer(rL));
+        const int startLayer((thisLayer >= maxLayer) ? thisLayer - 1 : thisLayer);
+
+        if (!hasSurroundingLayers || (firstLayerIter == secondLayerIter) || (startLayer < firstLayerIter->first) ||
+            (startLayer >= secondLayerIter->first))
+        {
+            const StatusCode statusCode(this->GetLongitudinalSurroundingLayers(rL, firstLayerIter, secondLayerIter));
+            hasSurroundingLayers = (STATUS_CODE_SUCCESS == statusCode);
+
+            if (!hasSurroundingLayers)
+            {
+                positionVector.push_back(CartesianVector(0.f, 0.f, 0.f));
+                statusCodeVector.push_back(statusCode);
+                continue;
+            }
+        }
+
+        double firstWeight(0.), secondWeight(0.);
+        this->GetLongitudinalInterpolationWeights(rL, firstLayerIter, secondLayerIter, firstWeight, secondWeight);
+
+        const LayerInterpolation layerInterpolation(firstLayerIter, secondLayerIter, firstWeight, secondWeight);
+        positionVector.push_back(this->GetGlobalFitPosition(layerInterpolation));
+        statusCodeVector.push_back(STATUS_CODE_SUCCESS);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void TwoDSlidingFitResult::GetGlobalFitProjections(const CartesianPointVector &inputPositionVector,
+    CartesianPointVector &projectedPositionVector, StatusCodeVector &statusCodeVector) const
+{
+    FloatVector rLVector;
+    rLVector.reserve(inputPositionVector.size());
+
+    for (const CartesianVector &inputPosition : inputPositionVector)
+    {
+        float rL(0.f), rT(0.f);
+        this->GetLocalPosition(inputPosition, rL, rT);
+        rLVector.push_back(rL);
+    }
+
+    this->GetGlobalFitPositions(rLVector, projectedPositionVector, statusCodeVector);
+}
+
 StatusCode TwoDSlidingFitResult::GetGlobalFitPositionListAtX(const float x, CartesianPointVector &positionList) const
 {
     LayerInterpolationList layerInterpolationList;
@@ -463,6 +526,61 @@ StatusCode TwoDSlidingFitResult::GetTransverseProjection(
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void TwoDSlidingFitResult::GetTransverseProjections(const FloatVector &xVector, const FitSegment &fitSegment,
+    CartesianPointVector &positionVector, CartesianPointVector &directionVector, StatusCodeVector &statusCodeVector) const
+{
+    if (m_layerFitResultMap.empty())
+        throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
+
+    LayerFitResultMap::const_iterator minLayerIter = m_layerFitResultMap.find(fitSegment.GetStartLayer());
+    if (m_layerFitResultMap.end() == minLayerIter)
+        throw StatusCodeException(STATUS_CODE_FAILURE);
+
+    LayerFitResultMap::const_iterator maxLayerIter = m_layerFitResultMap.find(fitSegment.GetEndLayer());
+    if (m_layerFitResultMap.end() == maxLayerIter)
+        throw StatusCodeException(STATUS_CODE_FAILURE);
+
+    CartesianVector minPosition(0.f, 0.f, 0.f), maxPosition(0.f, 0.f, 0.f);
+    this->GetGlobalPosition(minLayerIter->second.GetL(), minLayerIter->second.GetFitT(), minPosition);
+    this->GetGlobalPosition(maxLayerIter->second.GetL(), maxLayerIter->second.GetFitT(), maxPosition);
+
+    const bool hasXSpan(std::fabs(maxPosition.GetX() - minPosition.GetX()) >= std::numeric_limits<float>::epsilon());
+
+    positionVector.reserve(positionVector.size() + xVector.size());
+    directionVector.reserve(directionVector.size() + xVector.size());
+    statusCodeVector.reserve(statusCodeVector.size() + xVector.size());
+
+    for (const float x : xVector)
+    {
+        LayerFitResultMap::const_iterator firstLayerIter, secondLayerIter;
+        StatusCode statusCode(STATUS_CODE_NOT_FOUND);
+
+        if (hasXSpan)
+        {
+            statusCode = this->GetTransverseSurroundingLayers(
+                x, minLayerIter, maxLayerIter, minPosition, maxPosition, firstLayerIter, secondLayerIter);
+        }
+
+        if (STATUS_CODE_SUCCESS != statusCode)
+        {
+            positionVector.emplace_back(0.f, 0.f, 0.f);
+            directionVector.emplace_back(0.f, 0.f, 0.f);
+            statusCodeVector.push_back(statusCode);
+            continue;
+        }
+
+        double firstWeight(0.), secondWeight(0.);
+        this->GetTransverseInterpolationWeights(x, firstLayerIter, secondLayerIter, firstWeight, secondWeight);
+
+        const LayerInterpolation layerInterpolation(firstLayerIter, secondLayerIter, firstWeight, secondWeight);
+        positionVector.push_back(this->GetGlobalFitPosition(layerInterpolation));
+        directionVector.push_back(this->GetGlobalFitDirection(layerInterpolation));
+        statusCodeVector.push_back(STATUS_CODE_SUCCESS);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode TwoDSlidingFitResult::GetExtrapolatedPosition(const float rL, CartesianVector &position) const
 {
     const StatusCode statusCode(this->GetGlobalFitPosition(rL, position));
@@ -653,51 +771,58 @@ void TwoDSlidingFitResult::PerformSlidingLinearFit()
 
     const LayerFitContributionMap &layerFitContributionMap(this->GetLayerFitContributionMap());
     const int innerLayer(layerFitContributionMap.begin()->first);
+    const int outerLayer(layerFitContributionMap.rbegin()->first);
     const int layerFitHalfWindow(static_cast<int>(this->GetLayerFitHalfWindow()));
 
+    // Contiguous view of the contribution map, indexed by layer offset from the inner layer, to avoid map lookups within the window
+    std::vector<const LayerFitContribution *> layerFitContributions(static_cast<size_t>(outerLayer - innerLayer + 1), nullptr);
+
+    for (const LayerFitContributionMap::value_type &mapEntry : layerFitContributionMap)
+        layerFitContributions[static_cast<size_t>(mapEntry.first - innerLayer)] = &mapEntry.second;
+
+    auto getContribution = [&](const int layer) -> const LayerFitContribution * {
+        return ((layer < innerLayer) || (layer > outerLayer)) ? nullptr : layerFitContributions[static_cast<size_t>(layer - innerLayer)];
+    };
+
     for (int iLayer = innerLayer; iLayer < innerLayer + layerFitHalfWindow; ++iLayer)
     {
-        LayerFitContributionMap::const_iterator lyrIter = layerFitContributionMap.find(iLayer);
+        const LayerFitContribution *const pContribution(getContribution(iLayer));
 
-        if (layerFitContributionMap.end() != lyrIter)
+        if (pContribution)
         {
-            slidingSumT += lyrIter->second.GetSumT();
-            slidingSumL += lyrIter->second.GetSumL();
-            slidingSumTT += lyrIter->second.GetSumTT();
-            slidingSumLT += lyrIter->second.GetSumLT();
-            slidingSumLL += lyrIter->second.GetSumLL();
-            slidingNPoints += lyrIter->second.GetNPoints();
+            slidingSumT += pContribution->GetSumT();
+            slidingSumL += pContribution->GetSumL();
+            slidingSumTT += pContribution->GetSumTT();
+            slidingSumLT += pContribution->GetSumLT();
+            slidingSumLL += pContribution->GetSumLL();
+            slidingNPoints += pContribution->GetNPoints();
         }
     }
 
-    const int outerLayer(layerFitContributionMap.rbegin()->first);
-
     for (int iLayer = innerLayer; iLayer <= outerLayer; ++iLayer)
     {
-        const int fwdLayer(iLayer + layerFitHalfWindow);
-        LayerFitContributionMap::const_iterator fwdIter = layerFitContributionMap.find(fwdLayer);
+        const LayerFitContribution *const pFwdContribution(getContribution(iLayer + layerFitHalfWindow));
 
-        if (layerFitContributionMap.end() != fwdIter)
+        if (pFwdContribution)
         {
-            slidingSumT += fwdIter->second.GetSumT();
-            slidingSumL += fwdIter->second.GetSumL();
-            slidingSumTT += fwdIter->second.GetSumTT();
-            slidingSumLT += fwdIter->second.GetSumLT();
-            slidingSumLL += fwdIter->second.GetSumLL();
-            slidingNPoints += fwdIter->second.GetNPoints();
+            slidingSumT += pFwdContribution->GetSumT();
+            slidingSumL += pFwdContribution->GetSumL();
+            slidingSumTT += pFwdContribution->GetSumTT();
+            slidingSumLT += pFwdContribution->GetSumLT();
+            slidingSumLL += pFwdContribution->GetSumLL();
+            slidingNPoints += pFwdContribution->GetNPoints();
         }
 
-        const int bwdLayer(iLayer - layerFitHalfWindow - 1);
-        LayerFitContributionMap::const_iterator bwdIter = layerFitContributionMap.find(bwdLayer);
+        const LayerFitContribution *const pBwdContribution(getContribution(iLayer - layerFitHalfWindow - 1));
 
-        if (layerFitContributionMap.end() != bwdIter)
+        if (pBwdContribution)
         {
-            slidingSumT -= bwdIter->second.GetSumT();
-            slidingSumL -= bwdIter->second.GetSumL();
-            slidingSumTT -= bwdIter->second.GetSumTT();
-            slidingSumLT -= bwdIter->second.GetSumLT();
-            slidingSumLL -= bwdIter->second.GetSumLL();
-            slidingNPoints -= bwdIter->second.GetNPoints();
+            slidingSumT -= pBwdContribution->GetSumT();
+            slidingSumL -= pBwdContribution->GetSumL();
+            slidingSumTT -= pBwdContribution->GetSumTT();
+            slidingSumLT -= pBwdContribution->GetSumLT();
+            slidingSumLL -= pBwdContribution->GetSumLL();
+            slidingNPoints -= pBwdContribution->GetNPoints();
         }
 
         // require three points for meaningful results
@@ -705,7 +830,7 @@ void TwoDSlidingFitResult::PerformSlidingLinearFit()
             continue;
 
         // only fill the result map if there is an entry in the contribution map
-        if (layerFitContributionMap.end() == layerFitContributionMap.find(iLayer))
+        if (!getContribution(iLayer))
             continue;
 
         const double denominator(slidingSumLL - slidingSumL * slidingSumL / static_cast<double>(slidingNPoints));
@@ -737,6 +862,12 @@ void TwoDSlidingFitResult::PerformSlidingLinearFit()
 
     if (m_layerFitResultMap.empty())
         throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
+
+    m_minFitLayer = m_layerFitResultMap.begin()->first;
+    m_layerFitResultOccupancy.assign(static_cast<size_t>(m_layerFitResultMap.rbegin()->first - m_minFitLayer + 1), false);
+
+    for (const LayerFitResultMap::value_type &mapEntry : m_layerFitResultMap)
+        m_layerFitResultOccupancy[static_cast<size_t>(mapEntry.first - m_minFitLayer)] = true;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -987,10 +1118,11 @@ StatusCode TwoDSlidingFitResult::GetLongitudinalSurroundingLayers(
 
     for (int iLayer = startLayer; iLayer >= minLayer; --iLayer)
     {
-        firstLayerIter = m_layerFitResultMap.find(iLayer);
-
-        if (m_layerFitResultMap.end() != firstLayerIter)
+        if (this->HasLayerFitResult(iLayer))
+        {
+            firstLayerIter = m_layerFitResultMap.find(iLayer);
             break;
+        }
     }
 
     if (m_layerFitResultMap.end() == firstLayerIter)
@@ -1001,10 +1133,11 @@ StatusCode TwoDSlidingFitResult::GetLongitudinalSurroundingLayers(
 
     for (int iLayer = startLayer + 1; iLayer <= maxLayer; ++iLayer)
     {
-        secondLayerIter = m_layerFitResultMap.find(iLayer);
-
-        if (m_layerFitResultMap.end() != secondLayerIter)
+        if (this->HasLayerFitResult(iLayer))
+        {
+            secondLayerIter = m_layerFitResultMap.find(iLayer);
             break;
+        }
     }
 
     if (m_layerFitResultMap.end() == secondLayerIter)
@@ -1036,6 +1169,17 @@ StatusCode TwoDSlidingFitResult::GetTransverseSurroundingLayers(const float x, c
     if ((std::fabs(maxPosition.GetX() - minPosition.GetX()) < std::numeric_limits<float>::epsilon()))
         return STATUS_CODE_NOT_FOUND;
 
+    return this->GetTransverseSurroundingLayers(x, minLayerIter, maxLayerIter, minPosition, maxPosition, firstLayerIter, secondLayerIter);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode TwoDSlidingFitResult::GetTransverseSurroundingLayers(const float x, const LayerFitResultMap::const_iterator &minLayerIter,
+    const LayerFitResultMap::const_iterator &maxLayerIter, const CartesianVector &minPosition, const CartesianVector &maxPosition,
+    LayerFitResultMap::const_iterator &firstLayerIter, LayerFitResultMap::const_iterator &secondLayerIter) const
+{
+    const int minLayer(minLayerIter->first), maxLayer(maxLayerIter->first);
+
     // Find start layer
     const float minL(minLayerIter->second.GetL());
     const float maxL(maxLayerIter->second.GetL());
@@ -1048,10 +1192,11 @@ StatusCode TwoDSlidingFitResult::GetTransverseSurroundingLayers(const float x, c
 
     for (int iLayer = startLayer; iLayer <= maxLayer; ++iLayer)
     {
-        startLayerIter = m_layerFitResultMap.find(iLayer);
-
-        if (m_layerFitResultMap.end() != startLayerIter)
+        if (this->HasLayerFitResult(iLayer))
+        {
+            startLayerIter = m_layerFitResultMap.find(iLayer);
             break;
+        }
     }
 
     if (m_layerFitResultMap.end() == startLayerIter)
@@ -1074,10 +1219,11 @@ StatusCode TwoDSlidingFitResult::GetTransverseSurroundingLayers(const float x, c
 
     for (int iLayer = startLayerIter->first; (iLayer >= minLayer) && (iLayer <= maxLayer); iLayer += increment)
     {
-        LayerFitResultMap::const_iterator tempIter = m_layerFitResultMap.find(iLayer);
-        if (m_layerFitResultMap.end() == tempIter)
+        if (!this->HasLayerFitResult(iLayer))
             continue;
 
+        LayerFitResultMap::const_iterator tempIter = m_layerFitResultMap.find(iLayer);
+
         firstLayerIter = secondLayerIter;
         firstLayerPosition = secondLayerPosition;
         secondLayerIter = tempIter;
@@ -13,6 +13,7 @@
 #include "larpandoracontent/LArObjects/LArTwoDSlidingFitObjects.h"
 
 #include <unordered_map>
+#include <vector>
 
 namespace lar_content
 {
@@ -23,6 +24,8 @@ namespace lar_content
 class TwoDSlidingFitResult
 {
 public:
+    typedef std::vector<pandora::StatusCode> StatusCodeVector;
+
     /**
      *  @brief  Constructor using internal definition of primary axis
      *
@@ -327,6 +330,28 @@ public:
      */
     pandora::StatusCode GetGlobalFitProjection(const pandora::CartesianVector &inputPosition, pandora::CartesianVector &projectedPosition) const;
 
+    /**
+     *  @brief  Get positions on global fit for a list of longitudinal coordinates, in a single sweep. The surrounding layers found for
+     *          one coordinate are reused for the next whenever possible, so coordinates should ideally be sorted, in either order.
+     *
+     *  @param  rLVector the input longitudinal coordinates
+     *  @param  positionVector to receive the positions on the global fit, one per input coordinate (zero for failed queries)
+     *  @param  statusCodeVector to receive the status code for each input coordinate, as for GetGlobalFitPosition
+     */
+    void GetGlobalFitPositions(
+        const pandora::FloatVector &rLVector, pandora::CartesianPointVector &positionVector, StatusCodeVector &statusCodeVector) const;
+
+    /**
+     *  @brief  Get projected positions on global fit for a list of position vectors, in a single sweep. The surrounding layers found
+     *          for one position are reused for the next whenever possible, so positions should ideally be ordered along the fit.
+     *
+     *  @param  inputPositionVector the input coordinates
+     *  @param  projectedPositionVector to receive the projected positions, one per input coordinate (zero for failed queries)
+     *  @param  statusCodeVector to receive the status code for each input coordinate, as for GetGlobalFitProjection
+     */
+    void GetGlobalFitProjections(const pandora::CartesianPointVector &inputPositionVector,
+        pandora::CartesianPointVector &projectedPositionVector, StatusCodeVector &statusCodeVector) const;
+
     /**
      *  @brief  Get a list of projected positions for a given input x coordinate
      *
@@ -361,6 +386,20 @@ public:
     pandora::StatusCode GetTransverseProjection(
         const float x, const FitSegment &fitSegment, pandora::CartesianVector &position, pandora::CartesianVector &direction) const;
 
+    /**
+     *  @brief  Get projected positions and directions for a list of input x coordinates and a fit segment, in a single sweep. The layers
+     *          bounding the fit segment are found once for the whole list, rather than once per coordinate.
+     *
+     *  @param  xVector the input x coordinates
+     *  @param  fitSegment the portion of sliding linear fit
+     *  @param  positionVector to receive the output positions, one per input coordinate (zero for failed queries)
+     *  @param  directionVector to receive the output directions, one per input coordinate (zero for failed queries)
+     *  @param  statusCodeVector to receive the status code for each input coordinate, as for GetTransverseProjection
+     */
+    void GetTransverseProjections(const pandora::FloatVector &xVector, const FitSegment &fitSegment,
+        pandora::CartesianPointVector &positionVector, pandora::CartesianPointVector &directionVector,
+        StatusCodeVector &statusCodeVector) const;
+
     /**
      *  @brief  Get extrapolated position (beyond span) for a given input coordinate
      *
@@ -399,6 +438,8 @@ public:
     const FitSegment &GetFitSegment(const float rL) const;
 
 private:
+    typedef std::vector<bool> LayerOccupancy;
+
     /**
      *  @brief  Calculate the longitudinal and transverse axes
      */
@@ -512,6 +553,24 @@ private:
     pandora::StatusCode GetTransverseSurroundingLayers(const float x, const int minLayer, const int maxLayer,
         LayerFitResultMap::const_iterator &firstLayerIter, LayerFitResultMap::const_iterator &secondLayerIter) const;
 
+    /**
+     *  @brief  Get iterators for layers surrounding a specified transverse position, given the layers bounding the search
+     *
+     *  @param  x the transverse coordinate
+     *  @param  minLayerIter the iterator for the minimum allowed layer
+     *  @param  maxLayerIter the iterator for the maximum allowed layer
+     *  @param  minPosition the global fit position of the minimum allowed layer
+     *  @param  maxPosition the global fit position of the maximum allowed layer
+     *  @param  firstLayerIter to receive the iterator for the layer just below the input coordinate
+     *  @param  secondLayerIter to receive the iterator for the layer just above the input coordinate
+     *
+     *  @return status code, faster than throwing in regular use-cases
+     */
+    pandora::StatusCode GetTransverseSurroundingLayers(const float x, const LayerFitResultMap::const_iterator &minLayerIter,
+        const LayerFitResultMap::const_iterator &maxLayerIter, const pandora::CartesianVector &minPosition,
+        const pandora::CartesianVector &maxPosition, LayerFitResultMap::const_iterator &firstLayerIter,
+        LayerFitResultMap::const_iterator &secondLayerIter) const;
+
     /**
      *  @brief  Get interpolation weights for layers surrounding a specified longitudinal position
      *
@@ -536,6 +595,15 @@ private:
     void GetTransverseInterpolationWeights(const float x, const LayerFitResultMap::const_iterator &firstLayerIter,
         const LayerFitResultMap::const_iterator &secondLayerIter, double &firstWeight, double &secondWeight) const;
 
+    /**
+     *  @brief  Whether the layer fit result map has an entry for a specified layer, using the contiguous layer occupancy
+     *
+     *  @param  layer the layer
+     *
+     *  @return boolean
+     */
+    bool HasLayerFitResult(const int layer) const;
+
     const pandora::Cluster *m_pCluster;                ///< The address of the cluster
     unsigned int m_layerFitHalfWindow;                 ///< The layer fit half window
     float m_layerPitch;                                ///< The layer pitch, units cm
@@ -545,6 +613,8 @@ private:
     LayerFitResultMap m_layerFitResultMap;             ///< The layer fit result map
     LayerFitContributionMap m_layerFitContributionMap; ///< The layer fit contribution map
     FitSegmentList m_fitSegmentList;                   ///< The fit segment list
+    int m_minFitLayer;                                 ///< The minimum layer in the layer fit result map
+    LayerOccupancy m_layerFitResultOccupancy;          ///< Whether each layer, offset by the minimum layer, has a layer fit result
 };
 
 typedef std::vector<TwoDSlidingFitResult> TwoDSlidingFitResultList;
@@ -621,6 +691,17 @@ inline void TwoDSlidingFitResult::GetMinAndMaxZ(float &minZ, float &maxZ) const
     return this->GetMinAndMaxCoordinate(false, minZ, maxZ);
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline bool TwoDSlidingFitResult::HasLayerFitResult(const int layer) const
+{
+    if (layer < m_minFitLayer)
+        return false;
+
+    const unsigned int offset(static_cast<unsigned int>(layer - m_minFitLayer));
+    return ((offset < m_layerFitResultOccupancy.size()) && m_layerFitResultOccupancy[offset]);
+}
+
 } // namespace lar_content
 
 #endif // #ifndef LAR_TWO_D_SLIDING_FIT_RESULT_H
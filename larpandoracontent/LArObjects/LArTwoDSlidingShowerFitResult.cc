@@ -15,6 +15,7 @@
 #include <algorithm>
 #include <cmath>
 #include <limits>
+#include <utility>
 
 using namespace pandora;
 
@@ -24,9 +25,7 @@ namespace lar_content
 template <typename T>
 TwoDSlidingShowerFitResult::TwoDSlidingShowerFitResult(
     const T *const pT, const unsigned int slidingFitWindow, const float slidingFitLayerPitch, const float showerEdgeMultiplier) :
-    m_showerFitResult(TwoDSlidingFitResult(pT, slidingFitWindow, slidingFitLayerPitch)),
-    m_negativeEdgeFitResult(TwoDSlidingShowerFitResult::LArTwoDShowerEdgeFit(pT, m_showerFitResult, NEGATIVE_SHOWER_EDGE, showerEdgeMultiplier)),
-    m_positiveEdgeFitResult(TwoDSlidingShowerFitResult::LArTwoDShowerEdgeFit(pT, m_showerFitResult, POSITIVE_SHOWER_EDGE, showerEdgeMultiplier))
+    TwoDSlidingShowerFitResult(TwoDSlidingFitResult(pT, slidingFitWindow, slidingFitLayerPitch), pT, showerEdgeMultiplier)
 {
 }
 
@@ -34,8 +33,125 @@ TwoDSlidingShowerFitResult::TwoDSlidingShowerFitResult(
 
 void TwoDSlidingShowerFitResult::GetShowerEdges(const float x, const bool widenIfAmbiguity, FloatVector &edgePositions) const
 {
-    edgePositions.clear();
+    EdgeFitExtent edgeFitExtent;
+    CartesianPointVector fitPositionVector;
+    this->GetShowerEdges(x, widenIfAmbiguity, edgeFitExtent, fitPositionVector, edgePositions);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void TwoDSlidingShowerFitResult::GetShowerEdges(
+    const FloatVector &xValues, const bool widenIfAmbiguity, std::vector<FloatVector> &edgePositionsVector) const
+{
+    edgePositionsVector.assign(xValues.size(), FloatVector());
+
+    EdgeFitExtent edgeFitExtent;
     CartesianPointVector fitPositionVector;
+
+    for (unsigned int iValue = 0; iValue < xValues.size(); ++iValue)
+        this->GetShowerEdges(xValues.at(iValue), widenIfAmbiguity, edgeFitExtent, fitPositionVector, edgePositionsVector.at(iValue));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+TwoDSlidingShowerFitResult::TwoDSlidingShowerFitResult(
+    TwoDSlidingFitResult &&showerFitResult, const T *const pT, const float showerEdgeMultiplier) :
+    TwoDSlidingShowerFitResult(
+        std::move(showerFitResult), TwoDSlidingShowerFitResult::GetShowerEdgeContributions(pT, showerFitResult, showerEdgeMultiplier))
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+TwoDSlidingShowerFitResult::TwoDSlidingShowerFitResult(
+    TwoDSlidingFitResult &&showerFitResult, const ShowerEdgeContributions &showerEdgeContributions) :
+    m_showerFitResult(std::move(showerFitResult)),
+    m_negativeEdgeFitResult(m_showerFitResult.GetLayerFitHalfWindow(), m_showerFitResult.GetLayerPitch(),
+        m_showerFitResult.GetAxisIntercept(), m_showerFitResult.GetAxisDirection(), m_showerFitResult.GetOrthoDirection(),
+        showerEdgeContributions.m_negativeEdgeContributions),
+    m_positiveEdgeFitResult(m_showerFitResult.GetLayerFitHalfWindow(), m_showerFitResult.GetLayerPitch(),
+        m_showerFitResult.GetAxisIntercept(), m_showerFitResult.GetAxisDirection(), m_showerFitResult.GetOrthoDirection(),
+        showerEdgeContributions.m_positiveEdgeContributions)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+TwoDSlidingShowerFitResult::ShowerEdgeContributions TwoDSlidingShowerFitResult::GetShowerEdgeContributions(
+    const Cluster *const pCluster, const TwoDSlidingFitResult &fullShowerFit, const float showerEdgeMultiplier)
+{
+    CartesianPointVector pointVector;
+    LArClusterHelper::GetCoordinateVector(pCluster, pointVector);
+    return TwoDSlidingShowerFitResult::GetShowerEdgeContributions(&pointVector, fullShowerFit, showerEdgeMultiplier);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+TwoDSlidingShowerFitResult::ShowerEdgeContributions TwoDSlidingShowerFitResult::GetShowerEdgeContributions(
+    const CartesianPointVector *const pPointVector, const TwoDSlidingFitResult &fullShowerFit, const float showerEdgeMultiplier)
+{
+    // Examine all possible fit contributions, keeping the outermost candidate for each edge in each layer
+    const FitCoordinate noNegativeEdge(0.f, +std::numeric_limits<float>::max());
+    const FitCoordinate noPositiveEdge(0.f, -std::numeric_limits<float>::max());
+    EdgeFitCoordinateMap edgeFitCoordinateMap;
+
+    for (const CartesianVector &hitPosition : *pPointVector)
+    {
+        float rL(0.f), rT(0.f);
+        fullShowerFit.GetLocalPosition(hitPosition, rL, rT);
+        rT *= showerEdgeMultiplier;
+
+        CartesianVector fullShowerFitPosition(0.f, 0.f, 0.f);
+        if (STATUS_CODE_SUCCESS != fullShowerFit.GetGlobalFitPosition(rL, fullShowerFitPosition))
+            continue;
+
+        float rLFit(0.f), rTFit(0.f);
+        fullShowerFit.GetLocalPosition(fullShowerFitPosition, rLFit, rTFit);
+
+        // ATTN Could modify this hit selection, e.g. add inertia to edge positions
+        const float rTNegative((rT - rTFit > 0.f) ? rTFit : rT), rTPositive((rT - rTFit < 0.f) ? rTFit : rT);
+        const int layer(fullShowerFit.GetLayer(rL));
+
+        EdgeFitCoordinateMap::iterator iter(edgeFitCoordinateMap.find(layer));
+
+        if (edgeFitCoordinateMap.end() == iter)
+        {
+            const EdgeFitCoordinates noEdges(noNegativeEdge, noPositiveEdge);
+            iter = edgeFitCoordinateMap.insert(EdgeFitCoordinateMap::value_type(layer, noEdges)).first;
+        }
+
+        if (rTNegative < iter->second.first.second)
+            iter->second.first = FitCoordinate(rL, rTNegative);
+
+        if (rTPositive > iter->second.second.second)
+            iter->second.second = FitCoordinate(rL, rTPositive);
+    }
+
+    // Select fit contributions representing relevant shower edges
+    ShowerEdgeContributions showerEdgeContributions;
+
+    for (const EdgeFitCoordinateMap::value_type &mapEntry : edgeFitCoordinateMap)
+    {
+        const FitCoordinate &negativeEdge(mapEntry.second.first), &positiveEdge(mapEntry.second.second);
+
+        if (negativeEdge.second < noNegativeEdge.second)
+            showerEdgeContributions.m_negativeEdgeContributions[mapEntry.first].AddPoint(negativeEdge.first, negativeEdge.second);
+
+        if (positiveEdge.second > noPositiveEdge.second)
+            showerEdgeContributions.m_positiveEdgeContributions[mapEntry.first].AddPoint(positiveEdge.first, positiveEdge.second);
+    }
+
+    return showerEdgeContributions;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void TwoDSlidingShowerFitResult::GetShowerEdges(const float x, const bool widenIfAmbiguity, EdgeFitExtent &edgeFitExtent,
+    CartesianPointVector &fitPositionVector, FloatVector &edgePositions) const
+{
+    edgePositions.clear();
+    fitPositionVector.clear();
     PANDORA_THROW_RESULT_IF_AND_IF(
         STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, this->GetNegativeEdgeFitResult().GetGlobalFitPositionListAtX(x, fitPositionVector));
     PANDORA_THROW_RESULT_IF_AND_IF(
@@ -43,18 +159,29 @@ void TwoDSlidingShowerFitResult::GetShowerEdges(const float x, const bool widenI
 
     if (fitPositionVector.size() < 2)
     {
-        float minXn(0.f), maxXn(0.f), minXp(0.f), maxXp(0.f);
-        this->GetNegativeEdgeFitResult().GetMinAndMaxX(minXn, maxXn);
-        this->GetPositiveEdgeFitResult().GetMinAndMaxX(minXp, maxXp);
-        const float minX(std::min(minXn, minXp)), maxX(std::max(maxXn, maxXp));
+        if (!edgeFitExtent.m_isEvaluated)
+        {
+            float minXn(0.f), maxXn(0.f), minXp(0.f), maxXp(0.f);
+            this->GetNegativeEdgeFitResult().GetMinAndMaxX(minXn, maxXn);
+            this->GetPositiveEdgeFitResult().GetMinAndMaxX(minXp, maxXp);
+
+            float minZn(0.f), maxZn(0.f), minZp(0.f), maxZp(0.f);
+            this->GetNegativeEdgeFitResult().GetMinAndMaxZ(minZn, maxZn);
+            this->GetPositiveEdgeFitResult().GetMinAndMaxZ(minZp, maxZp);
+
+            edgeFitExtent.m_minX = std::min(minXn, minXp);
+            edgeFitExtent.m_maxX = std::max(maxXn, maxXp);
+            edgeFitExtent.m_minZ = std::min(minZn, minZp);
+            edgeFitExtent.m_maxZ = std::max(maxZn, maxZp);
+            edgeFitExtent.m_isEvaluated = true;
+        }
+
+        const float minX(edgeFitExtent.m_minX), maxX(edgeFitExtent.m_maxX);
 
         if ((x < minX) || (x > maxX))
             return;
 
-        float minZn(0.f), maxZn(0.f), minZp(0.f), maxZp(0.f);
-        this->GetNegativeEdgeFitResult().GetMinAndMaxZ(minZn, maxZn);
-        this->GetPositiveEdgeFitResult().GetMinAndMaxZ(minZp, maxZp);
-        const float minZ(std::min(minZn, minZp)), maxZ(std::max(maxZn, maxZp));
+        const float minZ(edgeFitExtent.m_minZ), maxZ(edgeFitExtent.m_maxZ);
 
         if (!widenIfAmbiguity)
         {
@@ -87,70 +214,10 @@ void TwoDSlidingShowerFitResult::GetShowerEdges(const float x, const bool widenI
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
-
-TwoDSlidingFitResult TwoDSlidingShowerFitResult::LArTwoDShowerEdgeFit(
-    const Cluster *const pCluster, const TwoDSlidingFitResult &fullShowerFit, const ShowerEdge showerEdge, const float showerEdgeMultiplier)
-{
-    CartesianPointVector pointVector;
-    LArClusterHelper::GetCoordinateVector(pCluster, pointVector);
-    return TwoDSlidingShowerFitResult::LArTwoDShowerEdgeFit(&pointVector, fullShowerFit, showerEdge, showerEdgeMultiplier);
-}
-
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-TwoDSlidingFitResult TwoDSlidingShowerFitResult::LArTwoDShowerEdgeFit(const CartesianPointVector *const pPointVector,
-    const TwoDSlidingFitResult &fullShowerFit, const ShowerEdge showerEdge, const float showerEdgeMultiplier)
+TwoDSlidingShowerFitResult::EdgeFitExtent::EdgeFitExtent() : m_isEvaluated(false), m_minX(0.f), m_maxX(0.f), m_minZ(0.f), m_maxZ(0.f)
 {
-    // Examine all possible fit contributions
-    FitCoordinateMap fitCoordinateMap;
-
-    for (const CartesianVector &hitPosition : *pPointVector)
-    {
-        float rL(0.f), rT(0.f);
-        fullShowerFit.GetLocalPosition(hitPosition, rL, rT);
-        rT *= showerEdgeMultiplier;
-
-        CartesianVector fullShowerFitPosition(0.f, 0.f, 0.f);
-        if (STATUS_CODE_SUCCESS != fullShowerFit.GetGlobalFitPosition(rL, fullShowerFitPosition))
-            continue;
-
-        float rLFit(0.f), rTFit(0.f);
-        fullShowerFit.GetLocalPosition(fullShowerFitPosition, rLFit, rTFit);
-
-        const float rTDiff(rT - rTFit);
-        if (((POSITIVE_SHOWER_EDGE == showerEdge) && (rTDiff < 0.f)) || ((NEGATIVE_SHOWER_EDGE == showerEdge) && (rTDiff > 0.f)))
-            rT = rTFit;
-
-        const int layer(fullShowerFit.GetLayer(rL));
-        fitCoordinateMap[layer].push_back(FitCoordinate(rL, rT));
-    }
-
-    // Select fit contributions representing relevant shower edge
-    LayerFitContributionMap layerFitContributionMap;
-
-    for (const FitCoordinateMap::value_type &mapEntry : fitCoordinateMap)
-    {
-        // ATTN Could modify this hit selection, e.g. add inertia to edge positions
-        bool bestFitCoordinateFound(false);
-        FitCoordinate bestFitCoordinate = (POSITIVE_SHOWER_EDGE == showerEdge) ? FitCoordinate(0.f, -std::numeric_limits<float>::max())
-                                                                               : FitCoordinate(0.f, +std::numeric_limits<float>::max());
-
-        for (const FitCoordinate &fitCoordinate : mapEntry.second)
-        {
-            if (((POSITIVE_SHOWER_EDGE == showerEdge) && (fitCoordinate.second > bestFitCoordinate.second)) ||
-                ((NEGATIVE_SHOWER_EDGE == showerEdge) && (fitCoordinate.second < bestFitCoordinate.second)))
-            {
-                bestFitCoordinate = fitCoordinate;
-                bestFitCoordinateFound = true;
-            }
-        }
-
-        if (bestFitCoordinateFound)
-            layerFitContributionMap[mapEntry.first].AddPoint(bestFitCoordinate.first, bestFitCoordinate.second);
-    }
-
-    return TwoDSlidingFitResult(fullShowerFit.GetLayerFitHalfWindow(), fullShowerFit.GetLayerPitch(), fullShowerFit.GetAxisIntercept(),
-        fullShowerFit.GetAxisDirection(), fullShowerFit.GetOrthoDirection(), layerFitContributionMap);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
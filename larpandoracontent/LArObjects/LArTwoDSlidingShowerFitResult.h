@@ -35,7 +35,8 @@ class TwoDSlidingShowerFitResult
 {
 public:
     /**
-     *  @brief  Constructor
+     *  @brief  Constructor. The positive and negative shower edge fits share the axes and layers of the full shower fit, with both edges
+     *          found in a single pass over the positions to be fitted.
      *
      *  @param  pT describing the positions to be fitted
      *  @param  slidingFitWindow the sliding fit window
@@ -76,36 +77,103 @@ public:
      */
     void GetShowerEdges(const float x, const bool widenIfAmbiguity, pandora::FloatVector &edgePositions) const;
 
+    /**
+     *  @brief  Get the most appropriate shower edges at each of a number of x coordinates, as for repeated calls to GetShowerEdges, but
+     *          evaluating the extent of the shower edge fits at most once
+     *
+     *  @param  xValues the x coordinates
+     *  @param  widenIfAmbiguity whether to widen the shower edges in cases of ambiguities (i.e. be generous)
+     *  @param  edgePositionsVector to receive the shower edges at each x coordinate, in the order of the x coordinates
+     */
+    void GetShowerEdges(
+        const pandora::FloatVector &xValues, const bool widenIfAmbiguity, std::vector<pandora::FloatVector> &edgePositionsVector) const;
+
 private:
     /**
-     *  @brief  Perform two dimensional sliding fit to shower edge, using specified primary axis
+     *  @brief  ShowerEdgeContributions class, the layer fit contributions for the negative and positive shower edges
+     */
+    class ShowerEdgeContributions
+    {
+    public:
+        LayerFitContributionMap m_negativeEdgeContributions; ///< The layer fit contributions for the negative shower edge
+        LayerFitContributionMap m_positiveEdgeContributions; ///< The layer fit contributions for the positive shower edge
+    };
+
+    /**
+     *  @brief  EdgeFitExtent class, the combined x and z extent of the shower edge fits, evaluated on first use
+     */
+    class EdgeFitExtent
+    {
+    public:
+        /**
+         *  @brief  Default constructor
+         */
+        EdgeFitExtent();
+
+        bool m_isEvaluated; ///< Whether the extent has been evaluated
+        float m_minX;       ///< The min x coordinate of the shower edge fits
+        float m_maxX;       ///< The max x coordinate of the shower edge fits
+        float m_minZ;       ///< The min z coordinate of the shower edge fits
+        float m_maxZ;       ///< The max z coordinate of the shower edge fits
+    };
+
+    /**
+     *  @brief  Constructor, finding the shower edges for an existing shower fit
+     *
+     *  @param  showerFitResult the sliding fit result for the full shower, to be moved into the new object
+     *  @param  pT describing the positions to be fitted
+     *  @param  showerEdgeMultiplier artificially tune width of shower envelope so as to make it more/less inclusive
+     */
+    template <typename T>
+    TwoDSlidingShowerFitResult(TwoDSlidingFitResult &&showerFitResult, const T *const pT, const float showerEdgeMultiplier);
+
+    /**
+     *  @brief  Constructor, fitting the shower edges from their layer fit contributions
+     *
+     *  @param  showerFitResult the sliding fit result for the full shower, to be moved into the new object
+     *  @param  showerEdgeContributions the layer fit contributions for the shower edges
+     */
+    TwoDSlidingShowerFitResult(TwoDSlidingFitResult &&showerFitResult, const ShowerEdgeContributions &showerEdgeContributions);
+
+    /**
+     *  @brief  Get the layer fit contributions for both shower edges, using the primary axis of the full shower fit
      *
      *  @param  pCluster the address of the input cluster
      *  @param  fullShowerFit the result of fitting the full shower
-     *  @param  showerEdge the shower edge
      *  @param  showerEdgeMultiplier artificially tune width of shower envelope so as to make it more/less inclusive
      *
-     *  @return the shower edge fit result
+     *  @return the shower edge layer fit contributions
      */
-    static TwoDSlidingFitResult LArTwoDShowerEdgeFit(const pandora::Cluster *const pCluster, const TwoDSlidingFitResult &fullShowerFit,
-        const ShowerEdge showerEdge, const float showerEdgeMultiplier);
+    static ShowerEdgeContributions GetShowerEdgeContributions(
+        const pandora::Cluster *const pCluster, const TwoDSlidingFitResult &fullShowerFit, const float showerEdgeMultiplier);
 
     /**
-     *  @brief  Perform two dimensional sliding fit to shower edge, using specified primary axis
+     *  @brief  Get the layer fit contributions for both shower edges, using the primary axis of the full shower fit
      *
      *  @param  pPointVector the address of the input point vector
      *  @param  fullShowerFit the result of fitting the full shower
-     *  @param  showerEdge the shower edge
      *  @param  showerEdgeMultiplier artificially tune width of shower envelope so as to make it more/less inclusive
      *
-     *  @return the shower edge fit result
+     *  @return the shower edge layer fit contributions
+     */
+    static ShowerEdgeContributions GetShowerEdgeContributions(const pandora::CartesianPointVector *const pPointVector,
+        const TwoDSlidingFitResult &fullShowerFit, const float showerEdgeMultiplier);
+
+    /**
+     *  @brief  Get the most appropriate shower edges at a given x coordinate
+     *
+     *  @param  x the x coordinate
+     *  @param  widenIfAmbiguity whether to widen the shower edges in cases of ambiguities (i.e. be generous)
+     *  @param  edgeFitExtent the extent of the shower edge fits, evaluated here if required and not yet evaluated
+     *  @param  fitPositionVector scratch space for the edge fit positions at the given x coordinate
+     *  @param  edgePositions to receive the list of intersections of the shower fit at the given x coordinate
      */
-    static TwoDSlidingFitResult LArTwoDShowerEdgeFit(const pandora::CartesianPointVector *const pPointVector,
-        const TwoDSlidingFitResult &fullShowerFit, const ShowerEdge showerEdge, const float showerEdgeMultiplier);
+    void GetShowerEdges(const float x, const bool widenIfAmbiguity, EdgeFitExtent &edgeFitExtent,
+        pandora::CartesianPointVector &fitPositionVector, pandora::FloatVector &edgePositions) const;
 
     typedef std::pair<float, float> FitCoordinate;
-    typedef std::vector<FitCoordinate> FitCoordinateList;
-    typedef std::map<int, FitCoordinateList> FitCoordinateMap;
+    typedef std::pair<FitCoordinate, FitCoordinate> EdgeFitCoordinates;
+    typedef std::map<int, EdgeFitCoordinates> EdgeFitCoordinateMap;
 
     TwoDSlidingFitResult m_showerFitResult;       ///< The sliding fit result for the full shower cluster
     TwoDSlidingFitResult m_negativeEdgeFitResult; ///< The sliding fit result for the negative shower edge
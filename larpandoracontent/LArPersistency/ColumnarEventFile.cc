@@ -0,0 +1,545 @@
+/**
+ *  @file   larpandoracontent/LArPersistency/ColumnarEventFile.cc
+ *
+ *  @brief  Implementation of the columnar event file reader and writer classes.
+ *
+ *  $Log: $
+ */
+
+#include "Api/PandoraApi.h"
+
+#include "Objects/CaloHit.h"
+#include "Objects/MCParticle.h"
+
+#include "larpandoracontent/LArPersistency/ColumnarEventFile.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <unordered_map>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace pandora;
+
+namespace lar_content
+{
+
+const char ColumnarEventFile::MAGIC[8] = {'L', 'A', 'R', 'C', 'O', 'L', 'E', 'V'};
+
+static_assert(sizeof(ColumnarEventFile::FileHeader) == 16, "Unexpected columnar event file header layout");
+static_assert(sizeof(ColumnarEventFile::EventHeader) == 16, "Unexpected columnar event header layout");
+static_assert(sizeof(ColumnarEventFile::CaloHitRecord) == 104, "Unexpected columnar calo hit record layout");
+static_assert(sizeof(ColumnarEventFile::MCParticleRecord) == 56, "Unexpected columnar mc particle record layout");
+static_assert(sizeof(ColumnarEventFile::CaloHitToMCParticleRecord) == 12, "Unexpected columnar calo hit to mc particle record layout");
+static_assert(sizeof(ColumnarEventFile::MCParentDaughterRecord) == 8, "Unexpected columnar mc parent daughter record layout");
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool ColumnarEventFile::IsColumnarEventFile(const std::string &fileName)
+{
+    const std::string::size_type position(fileName.find_last_of("."));
+
+    if (std::string::npos == position)
+        return false;
+
+    std::string fileExtension(fileName.substr(position));
+    std::transform(fileExtension.begin(), fileExtension.end(), fileExtension.begin(), ::tolower);
+
+    return (std::string(".pndrc") == fileExtension);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+ColumnarEventFileReader::ColumnarEventFileReader(
+    const Pandora &pandora, const std::string &fileName, const bool useLArCaloHits, const bool useLArMCParticles) :
+    m_pandora(pandora),
+    m_fileName(fileName),
+    m_useLArCaloHits(useLArCaloHits),
+    m_useLArMCParticles(useLArMCParticles),
+    m_pMappedFile(nullptr),
+    m_fileSize(0),
+    m_nextEvent(0)
+{
+    const int fileDescriptor(open(fileName.c_str(), O_RDONLY));
+
+    if (fileDescriptor < 0)
+    {
+        std::cout << "ColumnarEventFileReader: Unable to open file " << fileName << std::endl;
+        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
+    }
+
+    struct stat fileStatus;
+    void *pMappedFile(MAP_FAILED);
+
+    if ((0 == fstat(fileDescriptor, &fileStatus)) && (fileStatus.st_size > 0))
+    {
+        m_fileSize = static_cast<std::size_t>(fileStatus.st_size);
+        pMappedFile = mmap(nullptr, m_fileSize, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+    }
+
+    // ATTN The mapping remains valid after the file descriptor is closed
+    close(fileDescriptor);
+
+    if (MAP_FAILED == pMappedFile)
+    {
+        std::cout << "ColumnarEventFileReader: Unable to map file " << fileName << std::endl;
+        throw StatusCodeException(STATUS_CODE_FAILURE);
+    }
+
+    m_pMappedFile = static_cast<const char *>(pMappedFile);
+    madvise(pMappedFile, m_fileSize, MADV_SEQUENTIAL);
+
+    const StatusCode statusCode(this->IndexEvents());
+
+    if (STATUS_CODE_SUCCESS != statusCode)
+    {
+        munmap(pMappedFile, m_fileSize);
+        std::cout << "ColumnarEventFileReader: Invalid columnar event file " << fileName << std::endl;
+        throw StatusCodeException(statusCode);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+ColumnarEventFileReader::~ColumnarEventFileReader()
+{
+    munmap(const_cast<char *>(m_pMappedFile), m_fileSize);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ColumnarEventFileReader::GoToEvent(const unsigned int eventNumber)
+{
+    if (eventNumber > m_eventOffsets.size())
+        return STATUS_CODE_NOT_FOUND;
+
+    m_nextEvent = eventNumber;
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ColumnarEventFileReader::ReadEvent()
+{
+    if (m_nextEvent >= m_eventOffsets.size())
+        return STATUS_CODE_NOT_FOUND;
+
+    const char *pData(m_pMappedFile + m_eventOffsets.at(m_nextEvent++));
+    const ColumnarEventFile::EventHeader &eventHeader(*reinterpret_cast<const ColumnarEventFile::EventHeader *>(pData));
+    pData += sizeof(ColumnarEventFile::EventHeader);
+
+    const ColumnarEventFile::CaloHitRecord *const pCaloHitRecords(reinterpret_cast<const ColumnarEventFile::CaloHitRecord *>(pData));
+    pData += eventHeader.m_nCaloHits * sizeof(ColumnarEventFile::CaloHitRecord);
+
+    const ColumnarEventFile::MCParticleRecord *const pMCParticleRecords(
+        reinterpret_cast<const ColumnarEventFile::MCParticleRecord *>(pData));
+    pData += eventHeader.m_nMCParticles * sizeof(ColumnarEventFile::MCParticleRecord);
+
+    const ColumnarEventFile::CaloHitToMCParticleRecord *const pCaloHitToMCParticleRecords(
+        reinterpret_cast<const ColumnarEventFile::CaloHitToMCParticleRecord *>(pData));
+    pData += eventHeader.m_nCaloHitToMCParticles * sizeof(ColumnarEventFile::CaloHitToMCParticleRecord);
+
+    const ColumnarEventFile::MCParentDaughterRecord *const pMCParentDaughterRecords(
+        reinterpret_cast<const ColumnarEventFile::MCParentDaughterRecord *>(pData));
+
+    // ATTN The records themselves serve as the parent addresses, which are unique within the event and used to set the relationships
+    for (uint32_t i = 0; i < eventHeader.m_nCaloHits; ++i)
+    {
+        const ColumnarEventFile::CaloHitRecord &record(pCaloHitRecords[i]);
+
+        LArCaloHitParameters parameters;
+        parameters.m_positionVector = CartesianVector(record.m_positionVector[0], record.m_positionVector[1], record.m_positionVector[2]);
+        parameters.m_expectedDirection =
+            CartesianVector(record.m_expectedDirection[0], record.m_expectedDirection[1], record.m_expectedDirection[2]);
+        parameters.m_cellNormalVector =
+            CartesianVector(record.m_cellNormalVector[0], record.m_cellNormalVector[1], record.m_cellNormalVector[2]);
+        parameters.m_cellGeometry = static_cast<CellGeometry>(record.m_cellGeometry);
+        parameters.m_cellSize0 = record.m_cellSize0;
+        parameters.m_cellSize1 = record.m_cellSize1;
+        parameters.m_cellThickness = record.m_cellThickness;
+        parameters.m_nCellRadiationLengths = record.m_nCellRadiationLengths;
+        parameters.m_nCellInteractionLengths = record.m_nCellInteractionLengths;
+        parameters.m_time = record.m_time;
+        parameters.m_inputEnergy = record.m_inputEnergy;
+        parameters.m_mipEquivalentEnergy = record.m_mipEquivalentEnergy;
+        parameters.m_electromagneticEnergy = record.m_electromagneticEnergy;
+        parameters.m_hadronicEnergy = record.m_hadronicEnergy;
+        parameters.m_isDigital = (0 != record.m_isDigital);
+        parameters.m_hitType = static_cast<HitType>(record.m_hitType);
+        parameters.m_hitRegion = static_cast<HitRegion>(record.m_hitRegion);
+        parameters.m_layer = record.m_layer;
+        parameters.m_isInOuterSamplingLayer = (0 != record.m_isInOuterSamplingLayer);
+        parameters.m_pParentAddress = static_cast<const void *>(&record);
+        parameters.m_larTPCVolumeId = record.m_larTPCVolumeId;
+        parameters.m_daughterVolumeId = record.m_daughterVolumeId;
+
+        if (m_useLArCaloHits)
+        {
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::CaloHit::Create(m_pandora, parameters, m_larCaloHitFactory));
+        }
+        else
+        {
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::CaloHit::Create(m_pandora, parameters));
+        }
+    }
+
+    for (uint32_t i = 0; i < eventHeader.m_nMCParticles; ++i)
+    {
+        const ColumnarEventFile::MCParticleRecord &record(pMCParticleRecords[i]);
+
+        LArMCParticleParameters parameters;
+        parameters.m_energy = record.m_energy;
+        parameters.m_momentum = CartesianVector(record.m_momentum[0], record.m_momentum[1], record.m_momentum[2]);
+        parameters.m_vertex = CartesianVector(record.m_vertex[0], record.m_vertex[1], record.m_vertex[2]);
+        parameters.m_endpoint = CartesianVector(record.m_endpoint[0], record.m_endpoint[1], record.m_endpoint[2]);
+        parameters.m_particleId = record.m_particleId;
+        parameters.m_mcParticleType = static_cast<MCParticleType>(record.m_mcParticleType);
+        parameters.m_pParentAddress = static_cast<const void *>(&record);
+        parameters.m_nuanceCode = record.m_nuanceCode;
+        parameters.m_process = record.m_process;
+
+        if (m_useLArMCParticles)
+        {
+            PANDORA_RETURN_RESULT_IF(
+                STATUS_CODE_SUCCESS, !=, PandoraApi::MCParticle::Create(m_pandora, parameters, m_larMCParticleFactory));
+        }
+        else
+        {
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::MCParticle::Create(m_pandora, parameters));
+        }
+    }
+
+    for (uint32_t i = 0; i < eventHeader.m_nCaloHitToMCParticles; ++i)
+    {
+        const ColumnarEventFile::CaloHitToMCParticleRecord &record(pCaloHitToMCParticleRecords[i]);
+
+        if ((record.m_caloHitIndex >= eventHeader.m_nCaloHits) || (record.m_mcParticleIndex >= eventHeader.m_nMCParticles))
+            return STATUS_CODE_FAILURE;
+
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=,
+            PandoraApi::SetCaloHitToMCParticleRelationship(
+                m_pandora, &pCaloHitRecords[record.m_caloHitIndex], &pMCParticleRecords[record.m_mcParticleIndex], record.m_weight));
+    }
+
+    for (uint32_t i = 0; i < eventHeader.m_nMCParentDaughters; ++i)
+    {
+        const ColumnarEventFile::MCParentDaughterRecord &record(pMCParentDaughterRecords[i]);
+
+        if ((record.m_parentIndex >= eventHeader.m_nMCParticles) || (record.m_daughterIndex >= eventHeader.m_nMCParticles))
+            return STATUS_CODE_FAILURE;
+
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=,
+            PandoraApi::SetMCParentDaughterRelationship(
+                m_pandora, &pMCParticleRecords[record.m_parentIndex], &pMCParticleRecords[record.m_daughterIndex]));
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ColumnarEventFileReader::IndexEvents()
+{
+    if (m_fileSize < sizeof(ColumnarEventFile::FileHeader))
+        return STATUS_CODE_FAILURE;
+
+    const ColumnarEventFile::FileHeader &fileHeader(*reinterpret_cast<const ColumnarEventFile::FileHeader *>(m_pMappedFile));
+
+    if ((0 != std::memcmp(fileHeader.m_magic, ColumnarEventFile::MAGIC, sizeof(ColumnarEventFile::MAGIC))) ||
+        (ColumnarEventFile::VERSION != fileHeader.m_version))
+    {
+        return STATUS_CODE_FAILURE;
+    }
+
+    std::size_t offset(sizeof(ColumnarEventFile::FileHeader));
+
+    while (offset < m_fileSize)
+    {
+        if (m_fileSize - offset < sizeof(ColumnarEventFile::EventHeader))
+            return STATUS_CODE_FAILURE;
+
+        const ColumnarEventFile::EventHeader &eventHeader(
+            *reinterpret_cast<const ColumnarEventFile::EventHeader *>(m_pMappedFile + offset));
+        const std::size_t eventSize(sizeof(ColumnarEventFile::EventHeader) +
+            eventHeader.m_nCaloHits * sizeof(ColumnarEventFile::CaloHitRecord) +
+            eventHeader.m_nMCParticles * sizeof(ColumnarEventFile::MCParticleRecord) +
+            eventHeader.m_nCaloHitToMCParticles * sizeof(ColumnarEventFile::CaloHitToMCParticleRecord) +
+            eventHeader.m_nMCParentDaughters * sizeof(ColumnarEventFile::MCParentDaughterRecord));
+
+        if (m_fileSize - offset < eventSize)
+            return STATUS_CODE_FAILURE;
+
+        m_eventOffsets.push_back(offset);
+        offset += eventSize;
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+ColumnarEventFileWriter::ColumnarEventFileWriter(
+    const std::string &fileName, const bool shouldOverwrite, const unsigned int maxQueueDepth) :
+    m_maxQueueDepth(maxQueueDepth),
+    m_stopWriting(false),
+    m_writeFailed(false)
+{
+    const std::ios::openmode openMode(std::ios::out | std::ios::binary | (shouldOverwrite ? std::ios::trunc : std::ios::app));
+    m_fileStream.open(fileName, openMode);
+
+    if (!m_fileStream.is_open())
+    {
+        std::cout << "ColumnarEventFileWriter: Unable to open file " << fileName << std::endl;
+        throw StatusCodeException(STATUS_CODE_FAILURE);
+    }
+
+    m_fileStream.seekp(0, std::ios::end);
+
+    if (0 == m_fileStream.tellp())
+    {
+        ColumnarEventFile::FileHeader fileHeader;
+        std::memcpy(fileHeader.m_magic, ColumnarEventFile::MAGIC, sizeof(ColumnarEventFile::MAGIC));
+        fileHeader.m_version = ColumnarEventFile::VERSION;
+        fileHeader.m_unused = 0;
+        m_fileStream.write(reinterpret_cast<const char *>(&fileHeader), sizeof(fileHeader));
+    }
+    else
+    {
+        std::ifstream inputStream(fileName, std::ios::in | std::ios::binary);
+        ColumnarEventFile::FileHeader fileHeader;
+
+        if (!inputStream.read(reinterpret_cast<char *>(&fileHeader), sizeof(fileHeader)) ||
+            (0 != std::memcmp(fileHeader.m_magic, ColumnarEventFile::MAGIC, sizeof(ColumnarEventFile::MAGIC))) ||
+            (ColumnarEventFile::VERSION != fileHeader.m_version))
+        {
+            std::cout << "ColumnarEventFileWriter: Unable to append to invalid columnar event file " << fileName << std::endl;
+            throw StatusCodeException(STATUS_CODE_FAILURE);
+        }
+    }
+
+    if (m_maxQueueDepth > 0)
+        m_writerThread = std::thread(&ColumnarEventFileWriter::WriteQueuedEvents, this);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+ColumnarEventFileWriter::~ColumnarEventFileWriter()
+{
+    if (!m_writerThread.joinable())
+        return;
+
+    {
+        const std::lock_guard<std::mutex> lock(m_queueMutex);
+        m_stopWriting = true;
+    }
+
+    m_queueCondition.notify_all();
+    m_writerThread.join();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ColumnarEventFileWriter::WriteEvent(
+    const CaloHitList &caloHitList, const MCParticleList &mcParticleList, const bool shouldWriteMCRelationships)
+{
+    std::vector<ColumnarEventFile::CaloHitRecord> caloHitRecords;
+    std::vector<ColumnarEventFile::MCParticleRecord> mcParticleRecords;
+    std::vector<ColumnarEventFile::CaloHitToMCParticleRecord> caloHitToMCParticleRecords;
+    std::vector<ColumnarEventFile::MCParentDaughterRecord> mcParentDaughterRecords;
+    caloHitRecords.reserve(caloHitList.size());
+    mcParticleRecords.reserve(mcParticleList.size());
+
+    std::unordered_map<const MCParticle *, uint32_t> mcParticleToIndexMap;
+
+    for (const MCParticle *const pMCParticle : mcParticleList)
+    {
+        const LArMCParticle *const pLArMCParticle(dynamic_cast<const LArMCParticle *>(pMCParticle));
+        ColumnarEventFile::MCParticleRecord record;
+        record.m_energy = pMCParticle->GetEnergy();
+        record.m_momentum[0] = pMCParticle->GetMomentum().GetX();
+        record.m_momentum[1] = pMCParticle->GetMomentum().GetY();
+        record.m_momentum[2] = pMCParticle->GetMomentum().GetZ();
+        record.m_vertex[0] = pMCParticle->GetVertex().GetX();
+        record.m_vertex[1] = pMCParticle->GetVertex().GetY();
+        record.m_vertex[2] = pMCParticle->GetVertex().GetZ();
+        record.m_endpoint[0] = pMCParticle->GetEndpoint().GetX();
+        record.m_endpoint[1] = pMCParticle->GetEndpoint().GetY();
+        record.m_endpoint[2] = pMCParticle->GetEndpoint().GetZ();
+        record.m_particleId = pMCParticle->GetParticleId();
+        record.m_mcParticleType = static_cast<int32_t>(pMCParticle->GetMCParticleType());
+        record.m_nuanceCode = pLArMCParticle ? pLArMCParticle->GetNuanceCode() : 0;
+        record.m_process = pLArMCParticle ? static_cast<int32_t>(pLArMCParticle->GetProcess()) : 0;
+
+        mcParticleToIndexMap[pMCParticle] = mcParticleRecords.size();
+        mcParticleRecords.push_back(record);
+    }
+
+    for (const CaloHit *const pCaloHit : caloHitList)
+    {
+        const LArCaloHit *const pLArCaloHit(dynamic_cast<const LArCaloHit *>(pCaloHit));
+        ColumnarEventFile::CaloHitRecord record;
+        record.m_positionVector[0] = pCaloHit->GetPositionVector().GetX();
+        record.m_positionVector[1] = pCaloHit->GetPositionVector().GetY();
+        record.m_positionVector[2] = pCaloHit->GetPositionVector().GetZ();
+        record.m_expectedDirection[0] = pCaloHit->GetExpectedDirection().GetX();
+        record.m_expectedDirection[1] = pCaloHit->GetExpectedDirection().GetY();
+        record.m_expectedDirection[2] = pCaloHit->GetExpectedDirection().GetZ();
+        record.m_cellNormalVector[0] = pCaloHit->GetCellNormalVector().GetX();
+        record.m_cellNormalVector[1] = pCaloHit->GetCellNormalVector().GetY();
+        record.m_cellNormalVector[2] = pCaloHit->GetCellNormalVector().GetZ();
+        record.m_cellSize0 = pCaloHit->GetCellSize0();
+        record.m_cellSize1 = pCaloHit->GetCellSize1();
+        record.m_cellThickness = pCaloHit->GetCellThickness();
+        record.m_nCellRadiationLengths = pCaloHit->GetNCellRadiationLengths();
+        record.m_nCellInteractionLengths = pCaloHit->GetNCellInteractionLengths();
+        record.m_time = pCaloHit->GetTime();
+        record.m_inputEnergy = pCaloHit->GetInputEnergy();
+        record.m_mipEquivalentEnergy = pCaloHit->GetMipEquivalentEnergy();
+        record.m_electromagneticEnergy = pCaloHit->GetElectromagneticEnergy();
+        record.m_hadronicEnergy = pCaloHit->GetHadronicEnergy();
+        record.m_cellGeometry = static_cast<int32_t>(pCaloHit->GetCellGeometry());
+        record.m_hitType = static_cast<int32_t>(pCaloHit->GetHitType());
+        record.m_hitRegion = static_cast<int32_t>(pCaloHit->GetHitRegion());
+        record.m_layer = pCaloHit->GetLayer();
+        record.m_larTPCVolumeId = pLArCaloHit ? pLArCaloHit->GetLArTPCVolumeId() : std::numeric_limits<uint32_t>::max();
+        record.m_daughterVolumeId = pLArCaloHit ? pLArCaloHit->GetDaughterVolumeId() : 0;
+        record.m_isDigital = pCaloHit->IsDigital() ? 1 : 0;
+        record.m_isInOuterSamplingLayer = pCaloHit->IsInOuterSamplingLayer() ? 1 : 0;
+        record.m_unused[0] = 0;
+        record.m_unused[1] = 0;
+
+        if (shouldWriteMCRelationships)
+        {
+            // ATTN Order the contributions by mc particle index, so the file contents do not depend on the weight map iteration order
+            const std::size_t firstRecord(caloHitToMCParticleRecords.size());
+
+            for (const MCParticleWeightMap::value_type &weightMapEntry : pCaloHit->GetMCParticleWeightMap())
+            {
+                const auto iter(mcParticleToIndexMap.find(weightMapEntry.first));
+
+                if (mcParticleToIndexMap.end() != iter)
+                {
+                    caloHitToMCParticleRecords.push_back(
+                        {static_cast<uint32_t>(caloHitRecords.size()), iter->second, weightMapEntry.second});
+                }
+            }
+
+            std::sort(caloHitToMCParticleRecords.begin() + firstRecord, caloHitToMCParticleRecords.end(),
+                [](const ColumnarEventFile::CaloHitToMCParticleRecord &lhs, const ColumnarEventFile::CaloHitToMCParticleRecord &rhs) {
+                    return (lhs.m_mcParticleIndex < rhs.m_mcParticleIndex);
+                });
+        }
+
+        caloHitRecords.push_back(record);
+    }
+
+    if (shouldWriteMCRelationships)
+    {
+        for (const MCParticle *const pMCParticle : mcParticleList)
+        {
+            for (const MCParticle *const pDaughterMCParticle : pMCParticle->GetDaughterList())
+            {
+                const auto iter(mcParticleToIndexMap.find(pDaughterMCParticle));
+
+                if (mcParticleToIndexMap.end() != iter)
+                    mcParentDaughterRecords.push_back({mcParticleToIndexMap.at(pMCParticle), iter->second});
+            }
+        }
+    }
+
+    ColumnarEventFile::EventHeader eventHeader;
+    eventHeader.m_nCaloHits = caloHitRecords.size();
+    eventHeader.m_nMCParticles = mcParticleRecords.size();
+    eventHeader.m_nCaloHitToMCParticles = caloHitToMCParticleRecords.size();
+    eventHeader.m_nMCParentDaughters = mcParentDaughterRecords.size();
+
+    EventBuffer eventBuffer;
+    eventBuffer.reserve(sizeof(eventHeader) + caloHitRecords.size() * sizeof(ColumnarEventFile::CaloHitRecord) +
+        mcParticleRecords.size() * sizeof(ColumnarEventFile::MCParticleRecord) +
+        caloHitToMCParticleRecords.size() * sizeof(ColumnarEventFile::CaloHitToMCParticleRecord) +
+        mcParentDaughterRecords.size() * sizeof(ColumnarEventFile::MCParentDaughterRecord));
+    this->AppendToBuffer(&eventHeader, sizeof(eventHeader), eventBuffer);
+    this->AppendToBuffer(caloHitRecords.data(), caloHitRecords.size() * sizeof(ColumnarEventFile::CaloHitRecord), eventBuffer);
+    this->AppendToBuffer(mcParticleRecords.data(), mcParticleRecords.size() * sizeof(ColumnarEventFile::MCParticleRecord), eventBuffer);
+    this->AppendToBuffer(caloHitToMCParticleRecords.data(),
+        caloHitToMCParticleRecords.size() * sizeof(ColumnarEventFile::CaloHitToMCParticleRecord), eventBuffer);
+    this->AppendToBuffer(
+        mcParentDaughterRecords.data(), mcParentDaughterRecords.size() * sizeof(ColumnarEventFile::MCParentDaughterRecord), eventBuffer);
+
+    if (0 == m_maxQueueDepth)
+        return this->WriteBuffer(eventBuffer);
+
+    std::unique_lock<std::mutex> lock(m_queueMutex);
+    m_queueCondition.wait(lock, [this] { return (m_writeFailed || (m_eventBufferQueue.size() < m_maxQueueDepth)); });
+
+    if (m_writeFailed)
+        return STATUS_CODE_FAILURE;
+
+    m_eventBufferQueue.push_back(std::move(eventBuffer));
+    lock.unlock();
+    m_queueCondition.notify_all();
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ColumnarEventFileWriter::AppendToBuffer(const void *const pData, const std::size_t nBytes, EventBuffer &eventBuffer) const
+{
+    const char *const pBytes(static_cast<const char *>(pData));
+    eventBuffer.insert(eventBuffer.end(), pBytes, pBytes + nBytes);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ColumnarEventFileWriter::WriteBuffer(const EventBuffer &eventBuffer)
+{
+    m_fileStream.write(eventBuffer.data(), eventBuffer.size());
+    m_fileStream.flush();
+
+    return (m_fileStream.good() ? STATUS_CODE_SUCCESS : STATUS_CODE_FAILURE);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ColumnarEventFileWriter::WriteQueuedEvents()
+{
+    std::unique_lock<std::mutex> lock(m_queueMutex);
+
+    while (true)
+    {
+        m_queueCondition.wait(lock, [this] { return (m_stopWriting || !m_eventBufferQueue.empty()); });
+
+        // ATTN Drain the queue before stopping, so that every accepted event reaches the file
+        if (m_eventBufferQueue.empty())
+            return;
+
+        const EventBuffer eventBuffer(std::move(m_eventBufferQueue.front()));
+        m_eventBufferQueue.pop_front();
+        lock.unlock();
+        m_queueCondition.notify_all();
+
+        const bool writeFailed(STATUS_CODE_SUCCESS != this->WriteBuffer(eventBuffer));
+
+        lock.lock();
+
+        if (writeFailed)
+        {
+            std::cout << "ColumnarEventFileWriter: Background write failed, discarding " << m_eventBufferQueue.size() << " queued events"
+                      << std::endl;
+            m_writeFailed = true;
+            m_eventBufferQueue.clear();
+            lock.unlock();
+            m_queueCondition.notify_all();
+            return;
+        }
+    }
+}
+
+} // namespace lar_content
@@ -0,0 +1,282 @@
+/**
+ *  @file   larpandoracontent/LArPersistency/ColumnarEventFile.h
+ *
+ *  @brief  Header file for the columnar event file reader and writer classes.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_COLUMNAR_EVENT_FILE_H
+#define LAR_COLUMNAR_EVENT_FILE_H 1
+
+#include "Pandora/PandoraInternal.h"
+#include "Pandora/StatusCodes.h"
+
+#include "larpandoracontent/LArObjects/LArCaloHit.h"
+#include "larpandoracontent/LArObjects/LArMCParticle.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace pandora
+{
+class Pandora;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+namespace lar_content
+{
+
+/**
+ *  @brief  ColumnarEventFile class, defining the layout of a columnar event file. After a file header, each event is stored as an event
+ *          header followed by contiguous arrays of fixed-width calo hit, mc particle and relationship records, so that a memory-mapped
+ *          file can be used in place, with no parsing, to create the event objects
+ */
+class ColumnarEventFile
+{
+public:
+    /**
+     *  @brief  FileHeader class
+     */
+    class FileHeader
+    {
+    public:
+        char m_magic[8];    ///< The magic characters identifying a columnar event file
+        uint32_t m_version; ///< The file format version
+        uint32_t m_unused;  ///< Padding, reserved for future use
+    };
+
+    /**
+     *  @brief  EventHeader class
+     */
+    class EventHeader
+    {
+    public:
+        uint32_t m_nCaloHits;             ///< The number of calo hit records
+        uint32_t m_nMCParticles;          ///< The number of mc particle records
+        uint32_t m_nCaloHitToMCParticles; ///< The number of calo hit to mc particle relationship records
+        uint32_t m_nMCParentDaughters;    ///< The number of mc parent to daughter relationship records
+    };
+
+    /**
+     *  @brief  CaloHitRecord class
+     */
+    class CaloHitRecord
+    {
+    public:
+        float m_positionVector[3];        ///< The position vector
+        float m_expectedDirection[3];     ///< The unit vector in the expected direction of flight
+        float m_cellNormalVector[3];      ///< The unit normal to the sampling layer
+        float m_cellSize0;                ///< The cell size 0
+        float m_cellSize1;                ///< The cell size 1
+        float m_cellThickness;            ///< The cell thickness
+        float m_nCellRadiationLengths;    ///< The absorber material in front of the cell, in radiation lengths
+        float m_nCellInteractionLengths;  ///< The absorber material in front of the cell, in interaction lengths
+        float m_time;                     ///< The time of the energy deposition
+        float m_inputEnergy;              ///< The calorimeter energy, as input
+        float m_mipEquivalentEnergy;      ///< The calibrated mip equivalent energy
+        float m_electromagneticEnergy;    ///< The calibrated electromagnetic energy
+        float m_hadronicEnergy;           ///< The calibrated hadronic energy
+        int32_t m_cellGeometry;           ///< The cell geometry
+        int32_t m_hitType;                ///< The hit type
+        int32_t m_hitRegion;              ///< The hit region
+        uint32_t m_layer;                 ///< The subdetector readout layer number
+        uint32_t m_larTPCVolumeId;        ///< The lar tpc volume id
+        uint32_t m_daughterVolumeId;      ///< The daughter volume id
+        uint8_t m_isDigital;              ///< Whether the cell is a digital cell
+        uint8_t m_isInOuterSamplingLayer; ///< Whether the cell is in one of the outermost detector sampling layers
+        uint8_t m_unused[2];              ///< Padding, reserved for future use
+    };
+
+    /**
+     *  @brief  MCParticleRecord class
+     */
+    class MCParticleRecord
+    {
+    public:
+        float m_energy;           ///< The energy
+        float m_momentum[3];      ///< The momentum
+        float m_vertex[3];        ///< The production vertex
+        float m_endpoint[3];      ///< The endpoint
+        int32_t m_particleId;     ///< The particle id
+        int32_t m_mcParticleType; ///< The mc particle type
+        int32_t m_nuanceCode;     ///< The nuance code
+        int32_t m_process;        ///< The process creating the particle
+    };
+
+    /**
+     *  @brief  CaloHitToMCParticleRecord class
+     */
+    class CaloHitToMCParticleRecord
+    {
+    public:
+        uint32_t m_caloHitIndex;    ///< The index of the calo hit record within the event
+        uint32_t m_mcParticleIndex; ///< The index of the mc particle record within the event
+        float m_weight;             ///< The mc particle weight
+    };
+
+    /**
+     *  @brief  MCParentDaughterRecord class
+     */
+    class MCParentDaughterRecord
+    {
+    public:
+        uint32_t m_parentIndex;   ///< The index of the parent mc particle record within the event
+        uint32_t m_daughterIndex; ///< The index of the daughter mc particle record within the event
+    };
+
+    static const char MAGIC[8];        ///< The magic characters identifying a columnar event file
+    static const uint32_t VERSION = 1; ///< The current file format version
+
+    /**
+     *  @brief  Whether a file name identifies a columnar event file, by its extension
+     *
+     *  @param  fileName the file name
+     *
+     *  @return boolean
+     */
+    static bool IsColumnarEventFile(const std::string &fileName);
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  ColumnarEventFileReader class, creating the calo hits and mc particles of each event directly from a memory-mapped file
+ */
+class ColumnarEventFileReader
+{
+public:
+    /**
+     *  @brief  Constructor, mapping the file and indexing its events. Throws StatusCodeException if the file cannot be mapped or is invalid
+     *
+     *  @param  pandora the pandora instance in which to create the event objects
+     *  @param  fileName the file name
+     *  @param  useLArCaloHits whether to create lar calo hits, or standard pandora calo hits
+     *  @param  useLArMCParticles whether to create lar mc particles, or standard pandora mc particles
+     */
+    ColumnarEventFileReader(
+        const pandora::Pandora &pandora, const std::string &fileName, const bool useLArCaloHits, const bool useLArMCParticles);
+
+    /**
+     *  @brief  Destructor, unmapping the file
+     */
+    ~ColumnarEventFileReader();
+
+    /**
+     *  @brief  Skip to the specified event
+     *
+     *  @param  eventNumber the index of the event
+     *
+     *  @return STATUS_CODE_SUCCESS, or STATUS_CODE_NOT_FOUND if the file holds too few events
+     */
+    pandora::StatusCode GoToEvent(const unsigned int eventNumber);
+
+    /**
+     *  @brief  Create the objects of the next event in the file
+     *
+     *  @return STATUS_CODE_SUCCESS, or STATUS_CODE_NOT_FOUND if all events have been read
+     */
+    pandora::StatusCode ReadEvent();
+
+private:
+    typedef std::vector<std::size_t> OffsetVector;
+
+    /**
+     *  @brief  Index the events in the mapped file, checking that every record lies within the file
+     *
+     *  @return STATUS_CODE_SUCCESS, or STATUS_CODE_FAILURE if the file is invalid
+     */
+    pandora::StatusCode IndexEvents();
+
+    const pandora::Pandora &m_pandora;                 ///< The pandora instance in which to create the event objects
+    const std::string m_fileName;                      ///< The file name
+    const bool m_useLArCaloHits;                       ///< Whether to create lar calo hits, or standard pandora calo hits
+    const bool m_useLArMCParticles;                    ///< Whether to create lar mc particles, or standard pandora mc particles
+    const LArCaloHitFactory m_larCaloHitFactory;       ///< The lar calo hit factory
+    const LArMCParticleFactory m_larMCParticleFactory; ///< The lar mc particle factory
+    const char *m_pMappedFile;                         ///< The address of the mapped file
+    std::size_t m_fileSize;                            ///< The size of the mapped file, in bytes
+    OffsetVector m_eventOffsets;                       ///< The offset of each event header within the file
+    unsigned int m_nextEvent;                          ///< The index of the next event to read
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  ColumnarEventFileWriter class, appending events to a columnar event file
+ */
+class ColumnarEventFileWriter
+{
+public:
+    /**
+     *  @brief  Constructor. Throws StatusCodeException if the file cannot be opened or an existing file is invalid
+     *
+     *  @param  fileName the file name
+     *  @param  shouldOverwrite whether to overwrite an existing file, or append to it
+     *  @param  maxQueueDepth the maximum number of serialised events awaiting a background writer thread, zero to write synchronously
+     */
+    ColumnarEventFileWriter(const std::string &fileName, const bool shouldOverwrite, const unsigned int maxQueueDepth = 0);
+
+    /**
+     *  @brief  Destructor, waiting for the background writer thread to write any queued events
+     */
+    ~ColumnarEventFileWriter();
+
+    /**
+     *  @brief  Write an event, or serialise it and queue it for the background writer thread, waiting if the queue is full
+     *
+     *  @param  caloHitList the calo hits
+     *  @param  mcParticleList the mc particles
+     *  @param  shouldWriteMCRelationships whether to write the calo hit to mc particle and mc parent to daughter relationships
+     *
+     *  @return STATUS_CODE_SUCCESS, or STATUS_CODE_FAILURE if this or an earlier background write failed
+     */
+    pandora::StatusCode WriteEvent(
+        const pandora::CaloHitList &caloHitList, const pandora::MCParticleList &mcParticleList, const bool shouldWriteMCRelationships);
+
+private:
+    typedef std::vector<char> EventBuffer;
+    typedef std::deque<EventBuffer> EventBufferQueue;
+
+    /**
+     *  @brief  Append raw bytes to an event buffer
+     *
+     *  @param  pData the address of the bytes
+     *  @param  nBytes the number of bytes
+     *  @param  eventBuffer the event buffer to receive the bytes
+     */
+    void AppendToBuffer(const void *const pData, const std::size_t nBytes, EventBuffer &eventBuffer) const;
+
+    /**
+     *  @brief  Write a serialised event to the file
+     *
+     *  @param  eventBuffer the serialised event
+     *
+     *  @return STATUS_CODE_SUCCESS, or STATUS_CODE_FAILURE if the write failed
+     */
+    pandora::StatusCode WriteBuffer(const EventBuffer &eventBuffer);
+
+    /**
+     *  @brief  Write queued events until asked to stop, run by the background writer thread
+     */
+    void WriteQueuedEvents();
+
+    std::ofstream m_fileStream;               ///< The output file stream
+    const unsigned int m_maxQueueDepth;       ///< The maximum number of queued events, zero to write synchronously
+    std::mutex m_queueMutex;                  ///< The mutex protecting the event queue and flags
+    std::condition_variable m_queueCondition; ///< The condition variable signalling changes to the event queue and flags
+    EventBufferQueue m_eventBufferQueue;      ///< The serialised events awaiting the background writer thread
+    bool m_stopWriting;                       ///< Whether the background writer thread should stop once the queue is empty
+    bool m_writeFailed;                       ///< Whether a background write has failed
+    std::thread m_writerThread;               ///< The background writer thread
+};
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_COLUMNAR_EVENT_FILE_H
@@ -14,22 +14,39 @@
 #include "larpandoracontent/LArObjects/LArCaloHit.h"
 #include "larpandoracontent/LArObjects/LArMCParticle.h"
 
+#include "larpandoracontent/LArPersistency/ColumnarEventFile.h"
 #include "larpandoracontent/LArPersistency/EventReadingAlgorithm.h"
+#include "larpandoracontent/LArPersistency/ReconstructionCheckpoint.h"
 
 #include <algorithm>
+#include <fstream>
+#include <functional>
 
 using namespace pandora;
 
 namespace lar_content
 {
 
+std::mutex EventReadingAlgorithm::m_eventQueueMutex;
+EventReadingAlgorithm::EventQueueMap EventReadingAlgorithm::m_eventQueueMap;
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 EventReadingAlgorithm::EventReadingAlgorithm() :
     m_skipToEvent(0),
     m_useLArCaloHits(true),
     m_larCaloHitVersion(1),
     m_useLArMCParticles(true),
     m_larMCParticleVersion(2),
-    m_pEventFileReader(nullptr)
+    m_shouldPrefetchEventFiles(false),
+    m_prefetchBlockSize(1 << 20),
+    m_nEventShards(1),
+    m_eventShardIndex(0),
+    m_derivedHitListName("CaloHitList3D"),
+    m_pEventFileReader(nullptr),
+    m_pColumnarEventFileReader(nullptr),
+    m_stopPrefetching(false),
+    m_checkpointEventOrdinal(0)
 {
 }
 
@@ -37,7 +54,9 @@ EventReadingAlgorithm::EventReadingAlgorithm() :
 
 EventReadingAlgorithm::~EventReadingAlgorithm()
 {
+    this->StopPrefetching();
     delete m_pEventFileReader;
+    delete m_pColumnarEventFileReader;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -64,10 +83,74 @@ StatusCode EventReadingAlgorithm::Initialize()
         }
     }
 
-    if (!m_eventFileName.empty())
+    if (!m_checkpointFileName.empty())
+    {
+        m_checkpointFileStream.open(m_checkpointFileName, std::ios::in | std::ios::binary);
+
+        if (!m_checkpointFileStream.is_open())
+        {
+            std::cout << "EventReadingAlgorithm: Unable to open checkpoint file " << m_checkpointFileName << std::endl;
+            return STATUS_CODE_FAILURE;
+        }
+
+        // ATTN The checkpoints of the events skipped in the event file are passed over when the first checkpoint is read
+        m_checkpointEventOrdinal = m_skipToEvent;
+    }
+
+    if (!m_eventFileName.empty() && (!m_eventQueueName.empty() || (m_nEventShards > 1)))
+    {
+        auto pEventQueue(std::make_shared<EventQueue>());
+        pEventQueue->m_fileNames.push_back(m_eventFileName);
+        pEventQueue->m_fileNames.insert(pEventQueue->m_fileNames.end(), m_eventFileNameVector.rbegin(), m_eventFileNameVector.rend());
+        pEventQueue->m_skipToEvent = m_skipToEvent;
+        pEventQueue->m_nEventShards = m_nEventShards;
+        pEventQueue->m_eventShardIndex = m_eventShardIndex;
+        pEventQueue->m_fileIndex = 0;
+
+        // ATTN Skipped events are passed over, but the first event handed out still satisfies n % nShards == shardIndex
+        pEventQueue->m_nextEvent = m_skipToEvent + (m_eventShardIndex + m_nEventShards - m_skipToEvent % m_nEventShards) % m_nEventShards;
+
+        // ATTN The reader for the first queued event is created on demand, in the first call to Run
+        m_eventFileName.clear();
+
+        if (m_eventQueueName.empty())
+        {
+            m_pEventQueue = pEventQueue;
+        }
+        else
+        {
+            const std::lock_guard<std::mutex> lock(m_eventQueueMutex);
+            std::shared_ptr<EventQueue> &pSharedEventQueue(m_eventQueueMap[m_eventQueueName]);
+
+            if (!pSharedEventQueue)
+            {
+                pSharedEventQueue = pEventQueue;
+            }
+            else if (pSharedEventQueue->m_fileNames != pEventQueue->m_fileNames)
+            {
+                std::cout << "EventReadingAlgorithm: Event queue " << m_eventQueueName << " is shared with a different event file list"
+                          << std::endl;
+                return STATUS_CODE_INVALID_PARAMETER;
+            }
+            else if ((pSharedEventQueue->m_skipToEvent != pEventQueue->m_skipToEvent) ||
+                (pSharedEventQueue->m_nEventShards != pEventQueue->m_nEventShards) ||
+                (pSharedEventQueue->m_eventShardIndex != pEventQueue->m_eventShardIndex))
+            {
+                std::cout << "EventReadingAlgorithm: Event queue " << m_eventQueueName
+                          << " is shared with different SkipToEvent, NEventShards or EventShardIndex settings" << std::endl;
+                return STATUS_CODE_INVALID_PARAMETER;
+            }
+
+            m_pEventQueue = pSharedEventQueue;
+        }
+    }
+    else if (!m_eventFileName.empty())
     {
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReplaceEventFileReader(m_eventFileName));
-        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pEventFileReader->GoToEvent(m_skipToEvent));
+        const StatusCode statusCode(m_pColumnarEventFileReader ? m_pColumnarEventFileReader->GoToEvent(m_skipToEvent)
+                                                               : m_pEventFileReader->GoToEvent(m_skipToEvent));
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, statusCode);
+        this->StartPrefetching();
     }
 
     return STATUS_CODE_SUCCESS;
@@ -77,11 +160,16 @@ StatusCode EventReadingAlgorithm::Initialize()
 
 StatusCode EventReadingAlgorithm::Run()
 {
-    if ((nullptr != m_pEventFileReader) && !m_eventFileName.empty())
+    if (m_pEventQueue)
+    {
+        this->ReadQueuedEvent();
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::RepeatEventPreparation(*this));
+    }
+    else if (((nullptr != m_pEventFileReader) || (nullptr != m_pColumnarEventFileReader)) && !m_eventFileName.empty())
     {
         try
         {
-            m_pEventFileReader->ReadEvent();
+            this->ReadEvent();
         }
         catch (const StatusCodeException &)
         {
@@ -89,6 +177,17 @@ StatusCode EventReadingAlgorithm::Run()
         }
 
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::RepeatEventPreparation(*this));
+
+        // ATTN Checkpoints are read in step with the events, each checkpoint recording the ordinal of its event in the event file
+        if (m_checkpointFileStream.is_open())
+        {
+            const CaloHitList *pCaloHitList(nullptr);
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::GetCurrentList(*this, pCaloHitList));
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=,
+                ReconstructionCheckpoint::ReadEvent(
+                    *this, *pCaloHitList, m_derivedHitListName, m_checkpointEventOrdinal, m_checkpointFileStream));
+            ++m_checkpointEventOrdinal;
+        }
     }
 
     return STATUS_CODE_SUCCESS;
@@ -104,10 +203,11 @@ void EventReadingAlgorithm::MoveToNextEventFile()
     m_eventFileName = m_eventFileNameVector.back();
     m_eventFileNameVector.pop_back();
     PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReplaceEventFileReader(m_eventFileName));
+    this->StartPrefetching();
 
     try
     {
-        m_pEventFileReader->ReadEvent();
+        this->ReadEvent();
     }
     catch (const StatusCodeException &)
     {
@@ -121,8 +221,25 @@ StatusCode EventReadingAlgorithm::ReplaceEventFileReader(const std::string &file
 {
     delete m_pEventFileReader;
     m_pEventFileReader = nullptr;
+    delete m_pColumnarEventFileReader;
+    m_pColumnarEventFileReader = nullptr;
 
     std::cout << "EventReadingAlgorithm: Processing event file: " << fileName << std::endl;
+
+    if (ColumnarEventFile::IsColumnarEventFile(fileName))
+    {
+        try
+        {
+            m_pColumnarEventFileReader = new ColumnarEventFileReader(this->GetPandora(), fileName, m_useLArCaloHits, m_useLArMCParticles);
+        }
+        catch (const StatusCodeException &statusCodeException)
+        {
+            return statusCodeException.GetStatusCode();
+        }
+
+        return STATUS_CODE_SUCCESS;
+    }
+
     const FileType eventFileType(this->GetFileType(fileName));
 
     if (BINARY == eventFileType)
@@ -149,6 +266,76 @@ StatusCode EventReadingAlgorithm::ReplaceEventFileReader(const std::string &file
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void EventReadingAlgorithm::ReadEvent()
+{
+    if (nullptr != m_pColumnarEventFileReader)
+    {
+        // ATTN Mirror the pandora file readers, which signal the end of a file with an exception
+        const StatusCode statusCode(m_pColumnarEventFileReader->ReadEvent());
+
+        if (STATUS_CODE_SUCCESS != statusCode)
+            throw StatusCodeException(statusCode);
+    }
+    else
+    {
+        m_pEventFileReader->ReadEvent();
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void EventReadingAlgorithm::ReadQueuedEvent()
+{
+    while (true)
+    {
+        unsigned int fileIndex(0), eventNumber(0);
+
+        {
+            const std::lock_guard<std::mutex> lock(m_eventQueueMutex);
+
+            if (m_pEventQueue->m_fileIndex >= m_pEventQueue->m_fileNames.size())
+                throw StopProcessingException("All event files processed");
+
+            fileIndex = m_pEventQueue->m_fileIndex;
+            eventNumber = m_pEventQueue->m_nextEvent;
+            m_pEventQueue->m_nextEvent += m_pEventQueue->m_nEventShards;
+        }
+
+        const std::string &fileName(m_pEventQueue->m_fileNames.at(fileIndex));
+
+        if (fileName != m_eventFileName)
+        {
+            m_eventFileName = fileName;
+            PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReplaceEventFileReader(m_eventFileName));
+        }
+
+        try
+        {
+            const StatusCode statusCode(m_pColumnarEventFileReader ? m_pColumnarEventFileReader->GoToEvent(eventNumber)
+                                                                   : m_pEventFileReader->GoToEvent(eventNumber));
+
+            if (STATUS_CODE_SUCCESS != statusCode)
+                throw StatusCodeException(statusCode);
+
+            this->ReadEvent();
+            return;
+        }
+        catch (const StatusCodeException &)
+        {
+            // ATTN Several instances may run past the end of the same file, but only the first moves the queue on to the next file
+            const std::lock_guard<std::mutex> lock(m_eventQueueMutex);
+
+            if (fileIndex == m_pEventQueue->m_fileIndex)
+            {
+                ++m_pEventQueue->m_fileIndex;
+                m_pEventQueue->m_nextEvent = m_pEventQueue->m_eventShardIndex;
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 FileType EventReadingAlgorithm::GetFileType(const std::string &fileName) const
 {
     std::string fileExtension(fileName.substr(fileName.find_last_of(".")));
@@ -171,6 +358,54 @@ FileType EventReadingAlgorithm::GetFileType(const std::string &fileName) const
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void EventReadingAlgorithm::StartPrefetching()
+{
+    if (!m_shouldPrefetchEventFiles)
+        return;
+
+    this->StopPrefetching();
+
+    StringVector fileNames(1, m_eventFileName);
+
+    if (!m_eventFileNameVector.empty())
+        fileNames.push_back(m_eventFileNameVector.back());
+
+    m_prefetchThread = std::thread(&EventReadingAlgorithm::PrefetchFiles, fileNames, m_prefetchBlockSize, std::cref(m_stopPrefetching));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void EventReadingAlgorithm::StopPrefetching()
+{
+    if (!m_prefetchThread.joinable())
+        return;
+
+    m_stopPrefetching = true;
+    m_prefetchThread.join();
+    m_stopPrefetching = false;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void EventReadingAlgorithm::PrefetchFiles(
+    const StringVector &fileNames, const unsigned int blockSize, const std::atomic<bool> &stopPrefetching)
+{
+    std::vector<char> buffer(blockSize);
+
+    for (const std::string &fileName : fileNames)
+    {
+        std::ifstream fileStream(fileName, std::ios::in | std::ios::binary);
+
+        while (fileStream.read(buffer.data(), buffer.size()))
+        {
+            if (stopPrefetching)
+                return;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode EventReadingAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
 {
     ExternalEventReadingParameters *pExternalParameters(nullptr);
@@ -236,6 +471,45 @@ StatusCode EventReadingAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
     PANDORA_RETURN_RESULT_IF_AND_IF(
         STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "UseLArMCParticles", m_useLArMCParticles));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
+        XmlHelper::ReadValue(xmlHandle, "ShouldPrefetchEventFiles", m_shouldPrefetchEventFiles));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "PrefetchBlockSize", m_prefetchBlockSize));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "EventQueueName", m_eventQueueName));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "NEventShards", m_nEventShards));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "EventShardIndex", m_eventShardIndex));
+
+    if ((0 == m_nEventShards) || (m_eventShardIndex >= m_nEventShards))
+    {
+        std::cout << "EventReadingAlgorithm::ReadSettings - EventShardIndex must be less than NEventShards" << std::endl;
+        return STATUS_CODE_INVALID_PARAMETER;
+    }
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "CheckpointFileName", m_checkpointFileName));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "DerivedHitListName", m_derivedHitListName));
+
+    if (!m_checkpointFileName.empty() && (!m_eventQueueName.empty() || (m_nEventShards > 1)))
+    {
+        std::cout << "EventReadingAlgorithm::ReadSettings - Checkpoints must be read in step with sequentially read events" << std::endl;
+        return STATUS_CODE_INVALID_PARAMETER;
+    }
+
+    if (0 == m_prefetchBlockSize)
+    {
+        std::cout << "EventReadingAlgorithm::ReadSettings - PrefetchBlockSize must be greater than zero" << std::endl;
+        return STATUS_CODE_INVALID_PARAMETER;
+    }
+
     return STATUS_CODE_SUCCESS;
 }
 
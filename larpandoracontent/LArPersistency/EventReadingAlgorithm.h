@@ -14,6 +14,13 @@
 
 #include "Persistency/PandoraIO.h"
 
+#include <atomic>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+
 namespace pandora
 {
 class FileReader;
@@ -24,6 +31,8 @@ class FileReader;
 namespace lar_content
 {
 
+class ColumnarEventFileReader;
+
 /**
  *  @brief  EventReadingAlgorithm class
  */
@@ -52,6 +61,22 @@ public:
     };
 
 private:
+    /**
+     *  @brief  EventQueue class, handing out the events of an ordered list of event files, possibly to several algorithm instances
+     */
+    class EventQueue
+    {
+    public:
+        pandora::StringVector m_fileNames; ///< The ordered list of event file names
+        unsigned int m_skipToEvent;        ///< Index of first event to consider in first event file
+        unsigned int m_nEventShards;       ///< The number of shards into which the events of each file are divided
+        unsigned int m_eventShardIndex;    ///< The shard to process: event n of each file is processed if n % nShards == shardIndex
+        unsigned int m_fileIndex;          ///< The index of the current event file
+        unsigned int m_nextEvent;          ///< The index of the next event to hand out from the current event file
+    };
+
+    typedef std::map<std::string, std::shared_ptr<EventQueue>> EventQueueMap;
+
     pandora::StatusCode Initialize();
     pandora::StatusCode Run();
 
@@ -67,6 +92,17 @@ private:
      */
     pandora::StatusCode ReplaceEventFileReader(const std::string &fileName);
 
+    /**
+     *  @brief  Read the next event using the current event file reader. Throws StatusCodeException at the end of the file
+     */
+    void ReadEvent();
+
+    /**
+     *  @brief  Take the next event from the event queue and read it, replacing the event file reader if the event lies in a different
+     *          file. Throws StopProcessingException once the queue is exhausted
+     */
+    void ReadQueuedEvent();
+
     /**
      *  @brief  Analyze a provided file name to extract the file type/extension
      *
@@ -76,6 +112,27 @@ private:
      */
     pandora::FileType GetFileType(const std::string &fileName) const;
 
+    /**
+     *  @brief  Start a background thread reading ahead through the current and next event files, so that later reads by the event
+     *          file reader are served from the operating system file cache rather than from (possibly network-mounted) storage
+     */
+    void StartPrefetching();
+
+    /**
+     *  @brief  Stop any running read-ahead thread and wait for it to finish
+     */
+    void StopPrefetching();
+
+    /**
+     *  @brief  Read through the specified files in blocks, discarding the contents, until all files are read or a stop is requested
+     *
+     *  @param  fileNames the file names
+     *  @param  blockSize the block size, in bytes
+     *  @param  stopPrefetching flag indicating that the read-ahead should stop
+     */
+    static void PrefetchFiles(
+        const pandora::StringVector &fileNames, const unsigned int blockSize, const std::atomic<bool> &stopPrefetching);
+
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
     std::string m_geometryFileName;              ///< Name of the file containing geometry information
@@ -87,8 +144,24 @@ private:
     unsigned int m_larCaloHitVersion;    ///< LArCaloHit version for LArCaloHitFactory
     bool m_useLArMCParticles;            ///< Whether to read lar mc particles, or standard pandora mc particles
     unsigned int m_larMCParticleVersion; ///< LArMCParticle version for LArMCParticleFactory
-
-    pandora::FileReader *m_pEventFileReader; ///< Address of the event file reader
+    bool m_shouldPrefetchEventFiles;     ///< Whether to read ahead through the event files on a background thread
+    unsigned int m_prefetchBlockSize;    ///< The block size for reading ahead through the event files, in bytes
+    std::string m_eventQueueName;        ///< The name of an event queue shared with other instances in the process, empty for none
+    unsigned int m_nEventShards;         ///< The number of shards into which the events of each file are divided
+    unsigned int m_eventShardIndex;      ///< The shard to process: event n of each file is processed if n % nShards == shardIndex
+    std::string m_checkpointFileName;    ///< Name of the reconstruction checkpoint file to restore for each event, empty for none
+    std::string m_derivedHitListName;    ///< The name of the list in which to save derived calo hits restored from the checkpoint
+
+    pandora::FileReader *m_pEventFileReader;             ///< Address of the event file reader
+    ColumnarEventFileReader *m_pColumnarEventFileReader; ///< Address of the columnar event file reader, used in place of pandora readers
+    std::thread m_prefetchThread;                        ///< The background thread reading ahead through the event files
+    std::atomic<bool> m_stopPrefetching;                 ///< Flag indicating that the read-ahead thread should stop
+    std::shared_ptr<EventQueue> m_pEventQueue;           ///< The event queue, if events are to be taken from a queue
+    std::ifstream m_checkpointFileStream;                ///< The reconstruction checkpoint input file stream
+    unsigned int m_checkpointEventOrdinal;               ///< The ordinal, in the event file, of the next event whose checkpoint is read
+
+    static std::mutex m_eventQueueMutex;  ///< The mutex protecting the event queues
+    static EventQueueMap m_eventQueueMap; ///< The event queues shared between instances, indexed by name
 };
 
 } // namespace lar_content
@@ -11,13 +11,16 @@
 #include "Persistency/BinaryFileWriter.h"
 #include "Persistency/XmlFileWriter.h"
 
+#include "larpandoracontent/LArHelpers/LArMCHierarchySnapshotHelper.h"
 #include "larpandoracontent/LArHelpers/LArMCParticleHelper.h"
 #include "larpandoracontent/LArHelpers/LArMonitoringHelper.h"
 
 #include "larpandoracontent/LArObjects/LArCaloHit.h"
 #include "larpandoracontent/LArObjects/LArMCParticle.h"
 
+#include "larpandoracontent/LArPersistency/ColumnarEventFile.h"
 #include "larpandoracontent/LArPersistency/EventWritingAlgorithm.h"
+#include "larpandoracontent/LArPersistency/ReconstructionCheckpoint.h"
 
 using namespace pandora;
 
@@ -29,9 +32,13 @@ EventWritingAlgorithm::EventWritingAlgorithm() :
     m_eventFileType(UNKNOWN_FILE_TYPE),
     m_pEventFileWriter(nullptr),
     m_pGeometryFileWriter(nullptr),
+    m_useColumnarEventFile(false),
+    m_pColumnarEventFileWriter(nullptr),
+    m_asyncWriteQueueDepth(0),
     m_shouldWriteGeometry(false),
     m_writtenGeometry(false),
     m_shouldWriteEvents(true),
+    m_checkpointEventOrdinal(0),
     m_shouldWriteMCRelationships(true),
     m_shouldWriteTrackRelationships(true),
     m_shouldOverwriteEventFile(false),
@@ -69,6 +76,7 @@ EventWritingAlgorithm::~EventWritingAlgorithm()
 {
     delete m_pEventFileWriter;
     delete m_pGeometryFileWriter;
+    delete m_pColumnarEventFileWriter;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -93,7 +101,18 @@ StatusCode EventWritingAlgorithm::Initialize()
         }
     }
 
-    if (m_shouldWriteEvents)
+    if (m_shouldWriteEvents && m_useColumnarEventFile)
+    {
+        try
+        {
+            m_pColumnarEventFileWriter = new ColumnarEventFileWriter(m_eventFileName, m_shouldOverwriteEventFile, m_asyncWriteQueueDepth);
+        }
+        catch (const StatusCodeException &statusCodeException)
+        {
+            return statusCodeException.GetStatusCode();
+        }
+    }
+    else if (m_shouldWriteEvents)
     {
         const FileMode fileMode(m_shouldOverwriteEventFile ? OVERWRITE : APPEND);
 
@@ -117,6 +136,30 @@ StatusCode EventWritingAlgorithm::Initialize()
             m_pEventFileWriter->SetFactory(new LArMCParticleFactory);
     }
 
+    if (m_shouldWriteEvents && !m_checkpointFileName.empty())
+    {
+        // ATTN Appended checkpoints continue the event ordinals of those already in the file
+        if (!m_shouldOverwriteEventFile)
+        {
+            std::ifstream existingFileStream(m_checkpointFileName, std::ios::in | std::ios::binary);
+
+            if (existingFileStream.is_open())
+            {
+                PANDORA_RETURN_RESULT_IF(
+                    STATUS_CODE_SUCCESS, !=, ReconstructionCheckpoint::GetNextEventOrdinal(existingFileStream, m_checkpointEventOrdinal));
+            }
+        }
+
+        const std::ios::openmode fileMode(m_shouldOverwriteEventFile ? std::ios::trunc : std::ios::app);
+        m_checkpointFileStream.open(m_checkpointFileName, std::ios::out | std::ios::binary | fileMode);
+
+        if (!m_checkpointFileStream.is_open())
+        {
+            std::cout << "EventWritingAlgorithm: Unable to open checkpoint file " << m_checkpointFileName << std::endl;
+            return STATUS_CODE_FAILURE;
+        }
+    }
+
     return STATUS_CODE_SUCCESS;
 }
 
@@ -135,7 +178,9 @@ StatusCode EventWritingAlgorithm::Run()
     bool matchParticles(!m_shouldFilterByMCParticles || this->PassMCParticleFilter());
     bool matchNeutrinoVertexPosition(!m_shouldFilterByNeutrinoVertex || this->PassNeutrinoVertexFilter());
 
-    if (matchNuanceCode && matchParticles && matchNeutrinoVertexPosition && m_pEventFileWriter && m_shouldWriteEvents)
+    const bool hasEventFileWriter(m_pEventFileWriter || m_pColumnarEventFileWriter);
+
+    if (matchNuanceCode && matchParticles && matchNeutrinoVertexPosition && hasEventFileWriter && m_shouldWriteEvents)
     {
         const CaloHitList *pCaloHitList = nullptr;
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::GetCurrentList(*this, pCaloHitList));
@@ -146,8 +191,29 @@ StatusCode EventWritingAlgorithm::Run()
         const MCParticleList *pMCParticleList = nullptr;
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::GetCurrentList(*this, pMCParticleList));
 
-        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=,
-            m_pEventFileWriter->WriteEvent(*pCaloHitList, *pTrackList, *pMCParticleList, m_shouldWriteMCRelationships, m_shouldWriteTrackRelationships));
+        if (m_pColumnarEventFileWriter)
+        {
+            if (!pTrackList->empty())
+                std::cout << "EventWritingAlgorithm: Tracks are not persisted in columnar event files" << std::endl;
+
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=,
+                m_pColumnarEventFileWriter->WriteEvent(*pCaloHitList, *pMCParticleList, m_shouldWriteMCRelationships));
+        }
+        else
+        {
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=,
+                m_pEventFileWriter->WriteEvent(
+                    *pCaloHitList, *pTrackList, *pMCParticleList, m_shouldWriteMCRelationships, m_shouldWriteTrackRelationships));
+        }
+
+        // ATTN Checkpoint hit references are indices into the calo hit list just written, so checkpoints are written event-for-event
+        if (m_checkpointFileStream.is_open())
+        {
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=,
+                ReconstructionCheckpoint::WriteEvent(*this, *pCaloHitList, m_checkpointClusterListNames, m_checkpointVertexListNames,
+                    m_checkpointPfoListNames, m_checkpointEventOrdinal, m_checkpointFileStream));
+            ++m_checkpointEventOrdinal;
+        }
     }
 
     return STATUS_CODE_SUCCESS;
@@ -155,6 +221,14 @@ StatusCode EventWritingAlgorithm::Run()
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode EventWritingAlgorithm::Reset()
+{
+    LArMCHierarchySnapshotHelper::Reset(this->GetPandora());
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 bool EventWritingAlgorithm::PassNuanceCodeFilter() const
 {
     const MCParticleList *pMCParticleList = nullptr;
@@ -184,25 +258,49 @@ bool EventWritingAlgorithm::PassMCParticleFilter() const
     const CaloHitList *pCaloHitList = nullptr;
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::GetCurrentList(*this, pCaloHitList));
 
+    const MCHierarchySnapshot &mcHierarchySnapshot(
+        LArMCHierarchySnapshotHelper::GetMCHierarchySnapshot(this->GetPandora(), *pMCParticleList, *pCaloHitList));
+
+    // ATTN The reconstructable primaries are a subset of the candidate primaries, so too few candidates of a type fail before hit matching
+    MCParticleVector candidatePrimaryVector;
+
+    for (const MCParticle *const pMCPrimary : mcHierarchySnapshot.GetPrimaryMCParticles())
+    {
+        if (LArMCParticleHelper::IsBeamNeutrinoFinalState(pMCPrimary) ||
+            (!m_neutrinoInducedOnly && (LArMCParticleHelper::IsBeamParticle(pMCPrimary) || LArMCParticleHelper::IsCosmicRay(pMCPrimary))))
+        {
+            candidatePrimaryVector.push_back(pMCPrimary);
+        }
+    }
+
+    if (!this->PassPrimaryCounts(candidatePrimaryVector, false))
+        return false;
+
     LArMCParticleHelper::PrimaryParameters parameters;
     LArMCParticleHelper::MCContributionMap mcParticlesToGoodHitsMap;
     LArMCParticleHelper::SelectReconstructableMCParticles(
-        pMCParticleList, pCaloHitList, parameters, LArMCParticleHelper::IsBeamNeutrinoFinalState, mcParticlesToGoodHitsMap);
+        mcHierarchySnapshot, pCaloHitList, parameters, LArMCParticleHelper::IsBeamNeutrinoFinalState, mcParticlesToGoodHitsMap);
 
     if (!m_neutrinoInducedOnly)
     {
         LArMCParticleHelper::SelectReconstructableMCParticles(
-            pMCParticleList, pCaloHitList, parameters, LArMCParticleHelper::IsBeamParticle, mcParticlesToGoodHitsMap);
+            mcHierarchySnapshot, pCaloHitList, parameters, LArMCParticleHelper::IsBeamParticle, mcParticlesToGoodHitsMap);
         LArMCParticleHelper::SelectReconstructableMCParticles(
-            pMCParticleList, pCaloHitList, parameters, LArMCParticleHelper::IsCosmicRay, mcParticlesToGoodHitsMap);
+            mcHierarchySnapshot, pCaloHitList, parameters, LArMCParticleHelper::IsCosmicRay, mcParticlesToGoodHitsMap);
     }
 
-    unsigned int nNonNeutrons(0), nMuons(0), nElectrons(0), nProtons(0), nPhotons(0), nChargedPions(0);
-
     MCParticleVector mcPrimaryVector;
     for (const auto &mapEntry : mcParticlesToGoodHitsMap)
         mcPrimaryVector.push_back(mapEntry.first);
-    std::sort(mcPrimaryVector.begin(), mcPrimaryVector.end(), LArMCParticleHelper::SortByMomentum);
+
+    return this->PassPrimaryCounts(mcPrimaryVector, true);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool EventWritingAlgorithm::PassPrimaryCounts(const MCParticleVector &mcPrimaryVector, const bool requireExactCounts) const
+{
+    unsigned int nNonNeutrons(0), nMuons(0), nElectrons(0), nProtons(0), nPhotons(0), nChargedPions(0);
 
     for (const MCParticle *const pMCPrimary : mcPrimaryVector)
     {
@@ -222,6 +320,12 @@ bool EventWritingAlgorithm::PassMCParticleFilter() const
             ++nChargedPions;
     }
 
+    if (!requireExactCounts)
+    {
+        return ((nNonNeutrons >= m_nNonNeutrons) && (nMuons >= m_nMuons) && (nElectrons >= m_nElectrons) && (nProtons >= m_nProtons) &&
+            (nPhotons >= m_nPhotons) && (nChargedPions >= m_nChargedPions));
+    }
+
     if ((nNonNeutrons == m_nNonNeutrons) && (nMuons == m_nMuons) && (nElectrons == m_nElectrons) && (nProtons == m_nProtons) &&
         (nPhotons == m_nPhotons) && (nChargedPions == m_nChargedPions))
     {
@@ -306,6 +410,10 @@ StatusCode EventWritingAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
         {
             m_eventFileType = BINARY;
         }
+        else if (ColumnarEventFile::IsColumnarEventFile(m_eventFileName))
+        {
+            m_useColumnarEventFile = true;
+        }
         else
         {
             std::cout << "EventReadingAlgorithm: Unknown event file type specified " << std::endl;
@@ -313,6 +421,27 @@ StatusCode EventWritingAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
         }
     }
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "CheckpointFileName", m_checkpointFileName));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
+        XmlHelper::ReadVectorOfValues(xmlHandle, "CheckpointClusterListNames", m_checkpointClusterListNames));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
+        XmlHelper::ReadVectorOfValues(xmlHandle, "CheckpointVertexListNames", m_checkpointVertexListNames));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
+        XmlHelper::ReadVectorOfValues(xmlHandle, "CheckpointPfoListNames", m_checkpointPfoListNames));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "AsyncWriteQueueDepth", m_asyncWriteQueueDepth));
+
+    if ((m_asyncWriteQueueDepth > 0) && !m_useColumnarEventFile)
+    {
+        std::cout << "EventWritingAlgorithm: AsyncWriteQueueDepth requires a columnar (.pndrc) event file" << std::endl;
+        return STATUS_CODE_INVALID_PARAMETER;
+    }
+
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
         XmlHelper::ReadValue(xmlHandle, "ShouldWriteMCRelationships", m_shouldWriteMCRelationships));
 
@@ -12,6 +12,8 @@
 
 #include "Persistency/PandoraIO.h"
 
+#include <fstream>
+
 namespace pandora
 {
 class FileWriter;
@@ -22,6 +24,8 @@ class FileWriter;
 namespace lar_content
 {
 
+class ColumnarEventFileWriter;
+
 /**
  *  @brief  EventWritingAlgorithm class
  */
@@ -41,6 +45,7 @@ public:
 private:
     pandora::StatusCode Initialize();
     pandora::StatusCode Run();
+    pandora::StatusCode Reset();
 
     /**
      *  @brief  Whether current event passes nuance code filter
@@ -56,6 +61,16 @@ private:
      */
     bool PassMCParticleFilter() const;
 
+    /**
+     *  @brief  Whether the numbers of mc primaries of each requested type match the requested numbers
+     *
+     *  @param  mcPrimaryVector the mc primaries
+     *  @param  requireExactCounts whether the numbers must match exactly, or need only be no fewer than requested
+     *
+     *  @return boolean
+     */
+    bool PassPrimaryCounts(const pandora::MCParticleVector &mcPrimaryVector, const bool requireExactCounts) const;
+
     /**
      *  @brief  Whether current event passes neutrino vertex position filter (e.g. fiducial volume cut)
      *
@@ -71,6 +86,10 @@ private:
     pandora::FileWriter *m_pEventFileWriter;    ///< Address of the event file writer
     pandora::FileWriter *m_pGeometryFileWriter; ///< Address of the geometry file writer
 
+    bool m_useColumnarEventFile;                         ///< Whether to write events to a columnar event file, in place of pandora writers
+    ColumnarEventFileWriter *m_pColumnarEventFileWriter; ///< Address of the columnar event file writer
+    unsigned int m_asyncWriteQueueDepth;                 ///< The columnar writer's background queue depth, zero to write synchronously
+
     bool m_shouldWriteGeometry;     ///< Whether to write geometry to a specified file
     bool m_writtenGeometry;         ///< Whether geometry has been written
     std::string m_geometryFileName; ///< Name of the output geometry file
@@ -78,6 +97,13 @@ private:
     bool m_shouldWriteEvents;    ///< Whether to write events to a specified file
     std::string m_eventFileName; ///< Name of the output event file
 
+    std::string m_checkpointFileName;                   ///< Name of the output reconstruction checkpoint file, written alongside the events
+    pandora::StringVector m_checkpointClusterListNames; ///< The names of the cluster lists to checkpoint
+    pandora::StringVector m_checkpointVertexListNames;  ///< The names of the vertex lists to checkpoint
+    pandora::StringVector m_checkpointPfoListNames;     ///< The names of the pfo lists to checkpoint
+    std::ofstream m_checkpointFileStream;               ///< The reconstruction checkpoint output file stream
+    unsigned int m_checkpointEventOrdinal;              ///< The ordinal, in the event file, of the next event to checkpoint
+
     bool m_shouldWriteMCRelationships;    ///< Whether to write mc relationship information to the events file
     bool m_shouldWriteTrackRelationships; ///< Whether to write track relationship information to the events file
 
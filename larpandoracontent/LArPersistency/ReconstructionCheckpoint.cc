@@ -0,0 +1,616 @@
+/**
+ *  @file   larpandoracontent/LArPersistency/ReconstructionCheckpoint.cc
+ *
+ *  @brief  Implementation of the reconstruction checkpoint class.
+ *
+ *  $Log: $
+ */
+
+#include "Pandora/AlgorithmHeaders.h"
+
+#include "larpandoracontent/LArPersistency/ReconstructionCheckpoint.h"
+
+#include <sstream>
+#include <unordered_map>
+#include <vector>
+
+using namespace pandora;
+
+namespace lar_content
+{
+
+StatusCode ReconstructionCheckpoint::WriteEvent(const Algorithm &algorithm, const CaloHitList &caloHitList,
+    const StringVector &clusterListNames, const StringVector &vertexListNames, const StringVector &pfoListNames,
+    const uint32_t eventOrdinal, std::ostream &stream)
+{
+    std::unordered_map<const void *, uint32_t> inputHitToIndexMap;
+
+    for (const CaloHit *const pCaloHit : caloHitList)
+        inputHitToIndexMap.emplace(static_cast<const void *>(pCaloHit), inputHitToIndexMap.size());
+
+    // ATTN Hits outside the persisted list are referenced after the persisted hits, in order of first use
+    std::unordered_map<const CaloHit *, uint32_t> derivedHitToIndexMap;
+    CaloHitVector derivedHits;
+
+    const auto writeHitReferences = [&](const CaloHitList &clusterHits, std::ostream &objectStream) -> StatusCode {
+        WriteValue<uint32_t>(clusterHits.size(), objectStream);
+
+        for (const CaloHit *const pCaloHit : clusterHits)
+        {
+            const auto inputIter(inputHitToIndexMap.find(static_cast<const void *>(pCaloHit)));
+
+            if (inputHitToIndexMap.end() != inputIter)
+            {
+                WriteValue<uint32_t>(inputIter->second, objectStream);
+                continue;
+            }
+
+            if (!inputHitToIndexMap.count(pCaloHit->GetParentAddress()))
+            {
+                std::cout << "ReconstructionCheckpoint: Cluster hit is neither persisted nor derived from a persisted hit" << std::endl;
+                return STATUS_CODE_NOT_FOUND;
+            }
+
+            const auto derivedIter(derivedHitToIndexMap.emplace(pCaloHit, derivedHits.size()).first);
+
+            if (derivedIter->second == derivedHits.size())
+                derivedHits.push_back(pCaloHit);
+
+            WriteValue<uint32_t>(caloHitList.size() + derivedIter->second, objectStream);
+        }
+
+        return STATUS_CODE_SUCCESS;
+    };
+
+    std::ostringstream objectStream(std::ios::out | std::ios::binary);
+    std::unordered_map<const Cluster *, ObjectReference> clusterToReferenceMap;
+    WriteValue<uint32_t>(clusterListNames.size(), objectStream);
+
+    for (uint32_t listIndex = 0; listIndex < clusterListNames.size(); ++listIndex)
+    {
+        const ClusterList *pClusterList(nullptr);
+        PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_INITIALIZED, !=,
+            PandoraContentApi::GetList(algorithm, clusterListNames.at(listIndex), pClusterList));
+
+        WriteString(clusterListNames.at(listIndex), objectStream);
+        WriteValue<uint32_t>(pClusterList ? pClusterList->size() : 0, objectStream);
+
+        if (!pClusterList)
+            continue;
+
+        uint32_t objectIndex(0);
+
+        for (const Cluster *const pCluster : *pClusterList)
+        {
+            clusterToReferenceMap[pCluster] = {listIndex, objectIndex++};
+
+            CaloHitList clusterHits;
+            pCluster->GetOrderedCaloHitList().FillCaloHitList(clusterHits);
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, writeHitReferences(clusterHits, objectStream));
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, writeHitReferences(pCluster->GetIsolatedCaloHitList(), objectStream));
+        }
+    }
+
+    std::unordered_map<const Vertex *, ObjectReference> vertexToReferenceMap;
+    WriteValue<uint32_t>(vertexListNames.size(), objectStream);
+
+    for (uint32_t listIndex = 0; listIndex < vertexListNames.size(); ++listIndex)
+    {
+        const VertexList *pVertexList(nullptr);
+        PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_INITIALIZED, !=,
+            PandoraContentApi::GetList(algorithm, vertexListNames.at(listIndex), pVertexList));
+
+        WriteString(vertexListNames.at(listIndex), objectStream);
+        WriteValue<uint32_t>(pVertexList ? pVertexList->size() : 0, objectStream);
+
+        if (!pVertexList)
+            continue;
+
+        uint32_t objectIndex(0);
+
+        for (const Vertex *const pVertex : *pVertexList)
+        {
+            vertexToReferenceMap[pVertex] = {listIndex, objectIndex++};
+            WriteValue<float>(pVertex->GetPosition().GetX(), objectStream);
+            WriteValue<float>(pVertex->GetPosition().GetY(), objectStream);
+            WriteValue<float>(pVertex->GetPosition().GetZ(), objectStream);
+            WriteValue<int32_t>(static_cast<int32_t>(pVertex->GetVertexLabel()), objectStream);
+            WriteValue<int32_t>(static_cast<int32_t>(pVertex->GetVertexType()), objectStream);
+        }
+    }
+
+    // ATTN Index the pfos first, so that parent-daughter relationships can refer to pfos in any persisted list
+    std::vector<const PfoList *> pfoLists;
+    std::unordered_map<const ParticleFlowObject *, ObjectReference> pfoToReferenceMap;
+
+    for (uint32_t listIndex = 0; listIndex < pfoListNames.size(); ++listIndex)
+    {
+        const PfoList *pPfoList(nullptr);
+        PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_INITIALIZED, !=,
+            PandoraContentApi::GetList(algorithm, pfoListNames.at(listIndex), pPfoList));
+        pfoLists.push_back(pPfoList);
+
+        if (!pPfoList)
+            continue;
+
+        uint32_t objectIndex(0);
+
+        for (const ParticleFlowObject *const pPfo : *pPfoList)
+            pfoToReferenceMap[pPfo] = {listIndex, objectIndex++};
+    }
+
+    const auto writeReference = [&objectStream](const ObjectReference &reference) {
+        WriteValue<uint32_t>(reference.m_listIndex, objectStream);
+        WriteValue<uint32_t>(reference.m_objectIndex, objectStream);
+    };
+
+    std::vector<std::pair<ObjectReference, ObjectReference>> pfoRelationships;
+    WriteValue<uint32_t>(pfoListNames.size(), objectStream);
+
+    for (uint32_t listIndex = 0; listIndex < pfoListNames.size(); ++listIndex)
+    {
+        const PfoList *const pPfoList(pfoLists.at(listIndex));
+        WriteString(pfoListNames.at(listIndex), objectStream);
+        WriteValue<uint32_t>(pPfoList ? pPfoList->size() : 0, objectStream);
+
+        if (!pPfoList)
+            continue;
+
+        for (const ParticleFlowObject *const pPfo : *pPfoList)
+        {
+            WriteValue<int32_t>(pPfo->GetParticleId(), objectStream);
+            WriteValue<int32_t>(pPfo->GetCharge(), objectStream);
+            WriteValue<float>(pPfo->GetMass(), objectStream);
+            WriteValue<float>(pPfo->GetEnergy(), objectStream);
+            WriteValue<float>(pPfo->GetMomentum().GetX(), objectStream);
+            WriteValue<float>(pPfo->GetMomentum().GetY(), objectStream);
+            WriteValue<float>(pPfo->GetMomentum().GetZ(), objectStream);
+
+            WriteValue<uint32_t>(pPfo->GetClusterList().size(), objectStream);
+
+            for (const Cluster *const pCluster : pPfo->GetClusterList())
+            {
+                const auto iter(clusterToReferenceMap.find(pCluster));
+
+                if (clusterToReferenceMap.end() == iter)
+                {
+                    std::cout << "ReconstructionCheckpoint: Pfo cluster is not in a persisted cluster list" << std::endl;
+                    return STATUS_CODE_NOT_FOUND;
+                }
+
+                writeReference(iter->second);
+            }
+
+            WriteValue<uint32_t>(pPfo->GetVertexList().size(), objectStream);
+
+            for (const Vertex *const pVertex : pPfo->GetVertexList())
+            {
+                const auto iter(vertexToReferenceMap.find(pVertex));
+
+                if (vertexToReferenceMap.end() == iter)
+                {
+                    std::cout << "ReconstructionCheckpoint: Pfo vertex is not in a persisted vertex list" << std::endl;
+                    return STATUS_CODE_NOT_FOUND;
+                }
+
+                writeReference(iter->second);
+            }
+
+            WriteValue<uint32_t>(pPfo->GetPropertiesMap().size(), objectStream);
+
+            for (const auto &property : pPfo->GetPropertiesMap())
+            {
+                WriteString(property.first, objectStream);
+                WriteValue<float>(property.second, objectStream);
+            }
+
+            for (const ParticleFlowObject *const pDaughterPfo : pPfo->GetDaughterPfoList())
+            {
+                const auto iter(pfoToReferenceMap.find(pDaughterPfo));
+
+                if (pfoToReferenceMap.end() == iter)
+                {
+                    std::cout << "ReconstructionCheckpoint: Daughter pfo is not in a persisted pfo list" << std::endl;
+                    return STATUS_CODE_NOT_FOUND;
+                }
+
+                pfoRelationships.emplace_back(pfoToReferenceMap.at(pPfo), iter->second);
+            }
+        }
+    }
+
+    WriteValue<uint32_t>(pfoRelationships.size(), objectStream);
+
+    for (const auto &relationship : pfoRelationships)
+    {
+        writeReference(relationship.first);
+        writeReference(relationship.second);
+    }
+
+    std::ostringstream derivedHitStream(std::ios::out | std::ios::binary);
+    WriteValue<uint32_t>(derivedHits.size(), derivedHitStream);
+
+    for (const CaloHit *const pCaloHit : derivedHits)
+    {
+        WriteValue<uint32_t>(inputHitToIndexMap.at(pCaloHit->GetParentAddress()), derivedHitStream);
+        WriteValue<int32_t>(static_cast<int32_t>(pCaloHit->GetHitType()), derivedHitStream);
+        WriteValue<float>(pCaloHit->GetPositionVector().GetX(), derivedHitStream);
+        WriteValue<float>(pCaloHit->GetPositionVector().GetY(), derivedHitStream);
+        WriteValue<float>(pCaloHit->GetPositionVector().GetZ(), derivedHitStream);
+    }
+
+    // ATTN The payload size allows the checkpoints of skipped events to be passed over without being decoded
+    const std::string derivedHitBytes(derivedHitStream.str()), objectBytes(objectStream.str());
+    WriteValue<uint32_t>(EVENT_MARKER, stream);
+    WriteValue<uint32_t>(VERSION, stream);
+    WriteValue<uint32_t>(eventOrdinal, stream);
+    WriteValue<uint32_t>(caloHitList.size(), stream);
+    WriteValue<uint64_t>(derivedHitBytes.size() + objectBytes.size(), stream);
+
+    stream << derivedHitBytes << objectBytes;
+    stream.flush();
+
+    return (stream.good() ? STATUS_CODE_SUCCESS : STATUS_CODE_FAILURE);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ReconstructionCheckpoint::ReadEvent(const Algorithm &algorithm, const CaloHitList &caloHitList,
+    const std::string &derivedCaloHitListName, const uint32_t eventOrdinal, std::istream &stream)
+{
+    uint32_t checkpointOrdinal(0), nInputHits(0), nDerivedHits(0);
+    uint64_t nPayloadBytes(0);
+
+    while (true)
+    {
+        const StatusCode statusCode(ReadHeader(stream, checkpointOrdinal, nInputHits, nPayloadBytes));
+
+        if (STATUS_CODE_SUCCESS != statusCode)
+            return statusCode;
+
+        if (checkpointOrdinal >= eventOrdinal)
+            break;
+
+        if (!stream.ignore(static_cast<std::streamsize>(nPayloadBytes)))
+            return STATUS_CODE_NOT_FOUND;
+    }
+
+    if ((eventOrdinal != checkpointOrdinal) || (caloHitList.size() != nInputHits))
+    {
+        std::cout << "ReconstructionCheckpoint: Checkpoint does not match the current event" << std::endl;
+        return STATUS_CODE_FAILURE;
+    }
+
+    CaloHitVector caloHitVector(caloHitList.begin(), caloHitList.end());
+    CaloHitList derivedCaloHitList;
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, ReadValue(stream, nDerivedHits));
+
+    for (uint32_t i = 0; i < nDerivedHits; ++i)
+    {
+        uint32_t parentIndex(0);
+        int32_t hitType(0);
+        float x(0.f), y(0.f), z(0.f);
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, ReadValue(stream, parentIndex));
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, ReadValue(stream, hitType));
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, ReadValue(stream, x));
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, ReadValue(stream, y));
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, ReadValue(stream, z));
+
+        if (parentIndex >= nInputHits)
+            return STATUS_CODE_FAILURE;
+
+        // ATTN Mirror the derived hit parameters set by the three dimensional hit creation
+        const CaloHit *const pParentCaloHit(caloHitVector.at(parentIndex));
+        PandoraContentApi::CaloHit::Parameters parameters;
+        parameters.m_positionVector = CartesianVector(x, y, z);
+        parameters.m_hitType = static_cast<HitType>(hitType);
+        parameters.m_pParentAddress = static_cast<const void *>(pParentCaloHit);
+        parameters.m_cellThickness = pParentCaloHit->GetCellThickness();
+        parameters.m_cellGeometry = RECTANGULAR;
+        parameters.m_cellSize0 = pParentCaloHit->GetCellLengthScale();
+        parameters.m_cellSize1 = pParentCaloHit->GetCellLengthScale();
+        parameters.m_cellNormalVector = pParentCaloHit->GetCellNormalVector();
+        parameters.m_expectedDirection = pParentCaloHit->GetExpectedDirection();
+        parameters.m_nCellRadiationLengths = pParentCaloHit->GetNCellRadiationLengths();
+        parameters.m_nCellInteractionLengths = pParentCaloHit->GetNCellInteractionLengths();
+        parameters.m_time = pParentCaloHit->GetTime();
+        parameters.m_inputEnergy = pParentCaloHit->GetInputEnergy();
+        parameters.m_mipEquivalentEnergy = pParentCaloHit->GetMipEquivalentEnergy();
+        parameters.m_electromagneticEnergy = pParentCaloHit->GetElectromagneticEnergy();
+        parameters.m_hadronicEnergy = pParentCaloHit->GetHadronicEnergy();
+        parameters.m_isDigital = pParentCaloHit->IsDigital();
+        parameters.m_hitRegion = pParentCaloHit->GetHitRegion();
+        parameters.m_layer = pParentCaloHit->GetLayer();
+        parameters.m_isInOuterSamplingLayer = pParentCaloHit->IsInOuterSamplingLayer();
+
+        const CaloHit *pCaloHit(nullptr);
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::CaloHit::Create(algorithm, parameters, pCaloHit));
+        caloHitVector.push_back(pCaloHit);
+        derivedCaloHitList.push_back(pCaloHit);
+    }
+
+    if (!derivedCaloHitList.empty())
+    {
+        PANDORA_RETURN_RESULT_IF(
+            STATUS_CODE_SUCCESS, !=, PandoraContentApi::SaveList(algorithm, derivedCaloHitList, derivedCaloHitListName));
+    }
+
+    const auto readHits = [&](CaloHitList &hits) -> StatusCode {
+        uint32_t nHits(0);
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, ReadValue(stream, nHits));
+
+        for (uint32_t i = 0; i < nHits; ++i)
+        {
+            uint32_t hitIndex(0);
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, ReadValue(stream, hitIndex));
+
+            if (hitIndex >= caloHitVector.size())
+                return STATUS_CODE_FAILURE;
+
+            hits.push_back(caloHitVector.at(hitIndex));
+        }
+
+        return STATUS_CODE_SUCCESS;
+    };
+
+    uint32_t nClusterLists(0);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, ReadValue(stream, nClusterLists));
+    std::vector<ClusterVector> clusterLists(nClusterLists);
+
+    for (ClusterVector &clusterVector : clusterLists)
+    {
+        std::string listName;
+        uint32_t nClusters(0);
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, ReadString(stream, listName));
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, ReadValue(stream, nClusters));
+
+        if (0 == nClusters)
+            continue;
+
+        const ClusterList *pClusterList(nullptr);
+        std::string temporaryListName;
+        PANDORA_RETURN_RESULT_IF(
+            STATUS_CODE_SUCCESS, !=, PandoraContentApi::CreateTemporaryListAndSetCurrent(algorithm, pClusterList, temporaryListName));
+
+        for (uint32_t i = 0; i < nClusters; ++i)
+        {
+            PandoraContentApi::Cluster::Parameters parameters;
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, readHits(parameters.m_caloHitList));
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, readHits(parameters.m_isolatedCaloHitList));
+
+            const Cluster *pCluster(nullptr);
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::Cluster::Create(algorithm, parameters, pCluster));
+            clusterVector.push_back(pCluster);
+        }
+
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::SaveList<Cluster>(algorithm, listName));
+    }
+
+    uint32_t nVertexLists(0);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, ReadValue(stream, nVertexLists));
+    std::vector<VertexVector> vertexLists(nVertexLists);
+
+    for (VertexVector &vertexVector : vertexLists)
+    {
+        std::string listName;
+        uint32_t nVertices(0);
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, ReadString(stream, listName));
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, ReadValue(stream, nVertices));
+
+        if (0 == nVertices)
+            continue;
+
+        const VertexList *pVertexList(nullptr);
+        std::string temporaryListName;
+        PANDORA_RETURN_RESULT_IF(
+            STATUS_CODE_SUCCESS, !=, PandoraContentApi::CreateTemporaryListAndSetCurrent(algorithm, pVertexList, temporaryListName));
+
+        for (uint32_t i = 0; i < nVertices; ++i)
+        {
+            float x(0.f), y(0.f), z(0.f);
+            int32_t vertexLabel(0), vertexType(0);
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, ReadValue(stream, x));
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, ReadValue(stream, y));
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, ReadValue(stream, z));
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, ReadValue(stream, vertexLabel));
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, ReadValue(stream, vertexType));
+
+            PandoraContentApi::Vertex::Parameters parameters;
+            parameters.m_position = CartesianVector(x, y, z);
+            parameters.m_vertexLabel = static_cast<VertexLabel>(vertexLabel);
+            parameters.m_vertexType = static_cast<VertexType>(vertexType);
+
+            const Vertex *pVertex(nullptr);
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::Vertex::Create(algorithm, parameters, pVertex));
+            vertexVector.push_back(pVertex);
+        }
+
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::SaveList<Vertex>(algorithm, listName));
+    }
+
+    const auto readReference = [&stream](ObjectReference &reference) -> StatusCode {
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, ReadValue(stream, reference.m_listIndex));
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, ReadValue(stream, reference.m_objectIndex));
+        return STATUS_CODE_SUCCESS;
+    };
+
+    uint32_t nPfoLists(0);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, ReadValue(stream, nPfoLists));
+    std::vector<PfoVector> pfoLists(nPfoLists);
+
+    for (PfoVector &pfoVector : pfoLists)
+    {
+        std::string listName;
+        uint32_t nPfos(0);
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, ReadString(stream, listName));
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, ReadValue(stream, nPfos));
+
+        if (0 == nPfos)
+            continue;
+
+        const PfoList *pPfoList(nullptr);
+        std::string temporaryListName;
+        PANDORA_RETURN_RESULT_IF(
+            STATUS_CODE_SUCCESS, !=, PandoraContentApi::CreateTemporaryListAndSetCurrent(algorithm, pPfoList, temporaryListName));
+
+        for (uint32_t i = 0; i < nPfos; ++i)
+        {
+            int32_t particleId(0), charge(0);
+            float mass(0.f), energy(0.f), px(0.f), py(0.f), pz(0.f);
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, ReadValue(stream, particleId));
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, ReadValue(stream, charge));
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, ReadValue(stream, mass));
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, ReadValue(stream, energy));
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, ReadValue(stream, px));
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, ReadValue(stream, py));
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, ReadValue(stream, pz));
+
+            PandoraContentApi::ParticleFlowObject::Parameters pfoParameters;
+            pfoParameters.m_particleId = particleId;
+            pfoParameters.m_charge = charge;
+            pfoParameters.m_mass = mass;
+            pfoParameters.m_energy = energy;
+            pfoParameters.m_momentum = CartesianVector(px, py, pz);
+
+            uint32_t nClusters(0), nVertices(0), nProperties(0);
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, ReadValue(stream, nClusters));
+
+            for (uint32_t j = 0; j < nClusters; ++j)
+            {
+                ObjectReference reference;
+                PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, readReference(reference));
+
+                if ((reference.m_listIndex >= clusterLists.size()) ||
+                    (reference.m_objectIndex >= clusterLists.at(reference.m_listIndex).size()))
+                    return STATUS_CODE_FAILURE;
+
+                pfoParameters.m_clusterList.push_back(clusterLists.at(reference.m_listIndex).at(reference.m_objectIndex));
+            }
+
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, ReadValue(stream, nVertices));
+
+            for (uint32_t j = 0; j < nVertices; ++j)
+            {
+                ObjectReference reference;
+                PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, readReference(reference));
+
+                if ((reference.m_listIndex >= vertexLists.size()) ||
+                    (reference.m_objectIndex >= vertexLists.at(reference.m_listIndex).size()))
+                    return STATUS_CODE_FAILURE;
+
+                pfoParameters.m_vertexList.push_back(vertexLists.at(reference.m_listIndex).at(reference.m_objectIndex));
+            }
+
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, ReadValue(stream, nProperties));
+
+            for (uint32_t j = 0; j < nProperties; ++j)
+            {
+                std::string propertyName;
+                float propertyValue(0.f);
+                PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, ReadString(stream, propertyName));
+                PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, ReadValue(stream, propertyValue));
+                pfoParameters.m_propertiesToAdd[propertyName] = propertyValue;
+            }
+
+            const ParticleFlowObject *pPfo(nullptr);
+            PANDORA_RETURN_RESULT_IF(
+                STATUS_CODE_SUCCESS, !=, PandoraContentApi::ParticleFlowObject::Create(algorithm, pfoParameters, pPfo));
+            pfoVector.push_back(pPfo);
+        }
+
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::SaveList<Pfo>(algorithm, listName));
+    }
+
+    uint32_t nPfoRelationships(0);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, ReadValue(stream, nPfoRelationships));
+
+    for (uint32_t i = 0; i < nPfoRelationships; ++i)
+    {
+        ObjectReference parentReference, daughterReference;
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, readReference(parentReference));
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, readReference(daughterReference));
+
+        for (const ObjectReference &reference : {parentReference, daughterReference})
+        {
+            if ((reference.m_listIndex >= pfoLists.size()) || (reference.m_objectIndex >= pfoLists.at(reference.m_listIndex).size()))
+                return STATUS_CODE_FAILURE;
+        }
+
+        const ParticleFlowObject *const pParentPfo(pfoLists.at(parentReference.m_listIndex).at(parentReference.m_objectIndex));
+        const ParticleFlowObject *const pDaughterPfo(pfoLists.at(daughterReference.m_listIndex).at(daughterReference.m_objectIndex));
+        PANDORA_RETURN_RESULT_IF(
+            STATUS_CODE_SUCCESS, !=, PandoraContentApi::SetPfoParentDaughterRelationship(algorithm, pParentPfo, pDaughterPfo));
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ReconstructionCheckpoint::GetNextEventOrdinal(std::istream &stream, uint32_t &eventOrdinal)
+{
+    eventOrdinal = 0;
+
+    while (true)
+    {
+        uint32_t checkpointOrdinal(0), nInputHits(0);
+        uint64_t nPayloadBytes(0);
+        const StatusCode statusCode(ReadHeader(stream, checkpointOrdinal, nInputHits, nPayloadBytes));
+
+        if (STATUS_CODE_NOT_FOUND == statusCode)
+            return STATUS_CODE_SUCCESS;
+
+        if (STATUS_CODE_SUCCESS != statusCode)
+            return statusCode;
+
+        if (!stream.ignore(static_cast<std::streamsize>(nPayloadBytes)))
+            return STATUS_CODE_FAILURE;
+
+        eventOrdinal = checkpointOrdinal + 1;
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ReconstructionCheckpoint::ReadHeader(std::istream &stream, uint32_t &eventOrdinal, uint32_t &nInputHits, uint64_t &nPayloadBytes)
+{
+    uint32_t eventMarker(0), version(0);
+
+    if (STATUS_CODE_SUCCESS != ReadValue(stream, eventMarker))
+        return STATUS_CODE_NOT_FOUND;
+
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, ReadValue(stream, version));
+
+    if ((EVENT_MARKER != eventMarker) || (VERSION != version))
+    {
+        std::cout << "ReconstructionCheckpoint: Invalid checkpoint marker or unsupported checkpoint version " << version << std::endl;
+        return STATUS_CODE_FAILURE;
+    }
+
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, ReadValue(stream, eventOrdinal));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, ReadValue(stream, nInputHits));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, ReadValue(stream, nPayloadBytes));
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ReconstructionCheckpoint::WriteString(const std::string &value, std::ostream &stream)
+{
+    WriteValue<uint32_t>(value.size(), stream);
+    stream.write(value.data(), value.size());
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ReconstructionCheckpoint::ReadString(std::istream &stream, std::string &value)
+{
+    uint32_t length(0);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, ReadValue(stream, length));
+
+    value.resize(length);
+    return (stream.read(&value[0], length) ? STATUS_CODE_SUCCESS : STATUS_CODE_FAILURE);
+}
+
+} // namespace lar_content
@@ -0,0 +1,166 @@
+/**
+ *  @file   larpandoracontent/LArPersistency/ReconstructionCheckpoint.h
+ *
+ *  @brief  Header file for the reconstruction checkpoint class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_RECONSTRUCTION_CHECKPOINT_H
+#define LAR_RECONSTRUCTION_CHECKPOINT_H 1
+
+#include "Pandora/PandoraInternal.h"
+#include "Pandora/StatusCodes.h"
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+namespace pandora
+{
+class Algorithm;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+namespace lar_content
+{
+
+/**
+ *  @brief  ReconstructionCheckpoint class, persisting named cluster, vertex and pfo lists in a compact binary form, so that later
+ *          reconstruction stages can be restarted from them.
+ *
+ *          Calo hits are referenced by their index in the calo hit list persisted with the event, so a checkpoint must be restored into
+ *          an event read back from the same event file. Hits derived from those calo hits (e.g. 3D hits, whose parent address is the
+ *          2D hit) are recreated from their position and parent hit. Pfos may only reference clusters, vertices and daughter pfos held
+ *          in the checkpointed lists.
+ */
+class ReconstructionCheckpoint
+{
+public:
+    /**
+     *  @brief  Write the checkpoint for the current event
+     *
+     *  @param  algorithm the calling algorithm
+     *  @param  caloHitList the calo hit list persisted with the event
+     *  @param  clusterListNames the names of the cluster lists to persist
+     *  @param  vertexListNames the names of the vertex lists to persist
+     *  @param  pfoListNames the names of the pfo lists to persist
+     *  @param  eventOrdinal the ordinal of the event in the event file
+     *  @param  stream the output stream
+     *
+     *  @return STATUS_CODE_SUCCESS, or STATUS_CODE_NOT_FOUND if an object references a hit, cluster, vertex or pfo that is not persisted
+     */
+    static pandora::StatusCode WriteEvent(const pandora::Algorithm &algorithm, const pandora::CaloHitList &caloHitList,
+        const pandora::StringVector &clusterListNames, const pandora::StringVector &vertexListNames,
+        const pandora::StringVector &pfoListNames, const uint32_t eventOrdinal, std::ostream &stream);
+
+    /**
+     *  @brief  Read the checkpoint for the current event, recreating the derived hits and the named cluster, vertex and pfo lists.
+     *          Checkpoints for earlier events, e.g. those skipped when reading the event file, are passed over.
+     *
+     *  @param  algorithm the calling algorithm
+     *  @param  caloHitList the calo hit list read with the event
+     *  @param  derivedCaloHitListName the name of the list in which to save recreated derived hits
+     *  @param  eventOrdinal the ordinal of the event in the event file
+     *  @param  stream the input stream
+     *
+     *  @return STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND at the end of the stream, or STATUS_CODE_FAILURE if the checkpoint does not
+     *          match the event
+     */
+    static pandora::StatusCode ReadEvent(const pandora::Algorithm &algorithm, const pandora::CaloHitList &caloHitList,
+        const std::string &derivedCaloHitListName, const uint32_t eventOrdinal, std::istream &stream);
+
+    /**
+     *  @brief  Get the ordinal of the event following the last checkpointed event in a stream, so that checkpoints may be appended
+     *
+     *  @param  stream the input stream
+     *  @param  eventOrdinal to receive the ordinal of the next event, zero if the stream holds no checkpoints
+     *
+     *  @return STATUS_CODE_SUCCESS, or STATUS_CODE_FAILURE if the stream does not hold complete checkpoints
+     */
+    static pandora::StatusCode GetNextEventOrdinal(std::istream &stream, uint32_t &eventOrdinal);
+
+private:
+    /**
+     *  @brief  Read the header of the next checkpointed event
+     *
+     *  @param  stream the input stream
+     *  @param  eventOrdinal to receive the ordinal of the event
+     *  @param  nInputHits to receive the number of calo hits persisted with the event
+     *  @param  nPayloadBytes to receive the number of bytes following the header
+     *
+     *  @return STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND at the end of the stream, or STATUS_CODE_FAILURE if the header is invalid
+     */
+    static pandora::StatusCode ReadHeader(std::istream &stream, uint32_t &eventOrdinal, uint32_t &nInputHits, uint64_t &nPayloadBytes);
+
+    /**
+     *  @brief  ObjectReference class, identifying an object by the index of its persisted list and its index within the list
+     */
+    class ObjectReference
+    {
+    public:
+        uint32_t m_listIndex;   ///< The index of the persisted list
+        uint32_t m_objectIndex; ///< The index of the object within the list
+    };
+
+    /**
+     *  @brief  Write a value in its binary representation
+     *
+     *  @param  value the value
+     *  @param  stream the output stream
+     */
+    template <typename T>
+    static void WriteValue(const T &value, std::ostream &stream);
+
+    /**
+     *  @brief  Read a value in its binary representation
+     *
+     *  @param  stream the input stream
+     *  @param  value to receive the value
+     *
+     *  @return STATUS_CODE_SUCCESS, or STATUS_CODE_FAILURE if the stream ends
+     */
+    template <typename T>
+    static pandora::StatusCode ReadValue(std::istream &stream, T &value);
+
+    /**
+     *  @brief  Write a string, preceded by its length
+     *
+     *  @param  value the string
+     *  @param  stream the output stream
+     */
+    static void WriteString(const std::string &value, std::ostream &stream);
+
+    /**
+     *  @brief  Read a string, preceded by its length
+     *
+     *  @param  stream the input stream
+     *  @param  value to receive the string
+     *
+     *  @return STATUS_CODE_SUCCESS, or STATUS_CODE_FAILURE if the stream ends
+     */
+    static pandora::StatusCode ReadString(std::istream &stream, std::string &value);
+
+    static const uint32_t EVENT_MARKER = 0x4b43524c; ///< The marker preceding each checkpointed event
+    static const uint32_t VERSION = 2;               ///< The current checkpoint format version
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline void ReconstructionCheckpoint::WriteValue(const T &value, std::ostream &stream)
+{
+    stream.write(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline pandora::StatusCode ReconstructionCheckpoint::ReadValue(std::istream &stream, T &value)
+{
+    return (stream.read(reinterpret_cast<char *>(&value), sizeof(T)) ? pandora::STATUS_CODE_SUCCESS : pandora::STATUS_CODE_FAILURE);
+}
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_RECONSTRUCTION_CHECKPOINT_H
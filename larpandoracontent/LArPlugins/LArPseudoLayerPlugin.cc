@@ -12,6 +12,8 @@
 
 #include "Managers/GeometryManager.h"
 
+#include "Objects/CaloHit.h"
+
 #include "Pandora/Pandora.h"
 #include "Pandora/PandoraInputTypes.h"
 
@@ -32,12 +34,25 @@ LArPseudoLayerPlugin::LArPseudoLayerPlugin() : m_zPitch(std::numeric_limits<floa
 
 unsigned int LArPseudoLayerPlugin::GetPseudoLayer(const pandora::CartesianVector &positionVector) const
 {
-    const float zLayer((positionVector.GetZ() + m_zOffset) / m_zPitch + static_cast<float>(m_zerothLayer));
+    unsigned int pseudoLayer(0);
 
-    if (zLayer < std::numeric_limits<float>::epsilon())
+    if (!this->GetPseudoLayer(positionVector.GetZ(), pseudoLayer))
         throw StatusCodeException(STATUS_CODE_FAILURE);
 
-    return static_cast<unsigned int>(zLayer);
+    return pseudoLayer;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArPseudoLayerPlugin::GetPseudoLayers(const CaloHitVector &caloHitVector, PseudoLayerVector &pseudoLayers) const
+{
+    pseudoLayers.resize(caloHitVector.size());
+
+    for (size_t index = 0; index < caloHitVector.size(); ++index)
+    {
+        if (!this->GetPseudoLayer(caloHitVector[index]->GetPositionVector().GetZ(), pseudoLayers[index]))
+            throw StatusCodeException(STATUS_CODE_FAILURE);
+    }
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
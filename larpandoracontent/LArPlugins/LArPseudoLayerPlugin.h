@@ -10,6 +10,9 @@
 
 #include "Plugins/PseudoLayerPlugin.h"
 
+#include <limits>
+#include <vector>
+
 namespace lar_content
 {
 
@@ -24,9 +27,30 @@ public:
      */
     LArPseudoLayerPlugin();
 
+    typedef std::vector<unsigned int> PseudoLayerVector;
+
     unsigned int GetPseudoLayer(const pandora::CartesianVector &positionVector) const;
     unsigned int GetPseudoLayerAtIp() const;
 
+    /**
+     *  @brief  Get the pseudo layer for a given z coordinate, using the fixed-pitch arithmetic directly rather than the plugin interface.
+     *          The result is identical to that of GetPseudoLayer, but an out-of-range coordinate is reported rather than thrown.
+     *
+     *  @param  z the z coordinate
+     *  @param  pseudoLayer to receive the pseudo layer
+     *
+     *  @return whether the z coordinate lies within the pseudo layer range
+     */
+    bool GetPseudoLayer(const float z, unsigned int &pseudoLayer) const;
+
+    /**
+     *  @brief  Get the pseudo layers for an array of calo hits, in a single pass over their z coordinates
+     *
+     *  @param  caloHitVector the calo hit vector
+     *  @param  pseudoLayers to receive the pseudo layers, one per calo hit and in the same order
+     */
+    void GetPseudoLayers(const pandora::CaloHitVector &caloHitVector, PseudoLayerVector &pseudoLayers) const;
+
 private:
     pandora::StatusCode Initialize();
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
@@ -43,6 +67,19 @@ inline unsigned int LArPseudoLayerPlugin::GetPseudoLayerAtIp() const
     return 0;
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline bool LArPseudoLayerPlugin::GetPseudoLayer(const float z, unsigned int &pseudoLayer) const
+{
+    const float zLayer((z + m_zOffset) / m_zPitch + static_cast<float>(m_zerothLayer));
+
+    if (zLayer < std::numeric_limits<float>::epsilon())
+        return false;
+
+    pseudoLayer = static_cast<unsigned int>(zLayer);
+    return true;
+}
+
 } // namespace lar_content
 
 #endif // #ifndef LAR_PSEUDO_LAYER_PLUGIN_H
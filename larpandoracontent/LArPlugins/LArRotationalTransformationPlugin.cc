@@ -272,6 +272,117 @@ void LArRotationalTransformationPlugin::GetMinChiSquaredYZ(const double u, const
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void LArRotationalTransformationPlugin::UVtoW(const float *const pU, const float *const pV, const size_t nPoints, float *const pW) const
+{
+    LArRotationalTransformationPlugin::TransformLinear(pU, pV, nPoints, -m_sinWminusV, -m_sinUminusW, m_sinVminusU, pW);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArRotationalTransformationPlugin::VWtoU(const float *const pV, const float *const pW, const size_t nPoints, float *const pU) const
+{
+    LArRotationalTransformationPlugin::TransformLinear(pV, pW, nPoints, -m_sinUminusW, -m_sinVminusU, m_sinWminusV, pU);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArRotationalTransformationPlugin::WUtoV(const float *const pW, const float *const pU, const size_t nPoints, float *const pV) const
+{
+    LArRotationalTransformationPlugin::TransformLinear(pW, pU, nPoints, -m_sinVminusU, -m_sinWminusV, m_sinUminusW, pV);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArRotationalTransformationPlugin::UVtoY(const float *const pU, const float *const pV, const size_t nPoints, float *const pY) const
+{
+    LArRotationalTransformationPlugin::TransformLinear(pU, pV, nPoints, m_cosV, -m_cosU, m_sinVminusU, pY);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArRotationalTransformationPlugin::UVtoZ(const float *const pU, const float *const pV, const size_t nPoints, float *const pZ) const
+{
+    LArRotationalTransformationPlugin::TransformLinear(pU, pV, nPoints, m_sinV, -m_sinU, m_sinVminusU, pZ);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArRotationalTransformationPlugin::UWtoY(const float *const pU, const float *const pW, const size_t nPoints, float *const pY) const
+{
+    LArRotationalTransformationPlugin::TransformLinear(pU, pW, nPoints, -m_cosW, m_cosU, m_sinUminusW, pY);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArRotationalTransformationPlugin::UWtoZ(const float *const pU, const float *const pW, const size_t nPoints, float *const pZ) const
+{
+    LArRotationalTransformationPlugin::TransformLinear(pU, pW, nPoints, -m_sinW, m_sinU, m_sinUminusW, pZ);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArRotationalTransformationPlugin::VWtoY(const float *const pV, const float *const pW, const size_t nPoints, float *const pY) const
+{
+    LArRotationalTransformationPlugin::TransformLinear(pV, pW, nPoints, m_cosW, -m_cosV, m_sinWminusV, pY);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArRotationalTransformationPlugin::VWtoZ(const float *const pV, const float *const pW, const size_t nPoints, float *const pZ) const
+{
+    LArRotationalTransformationPlugin::TransformLinear(pV, pW, nPoints, m_sinW, -m_sinV, m_sinWminusV, pZ);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArRotationalTransformationPlugin::YZtoU(const float *const pY, const float *const pZ, const size_t nPoints, float *const pU) const
+{
+    LArRotationalTransformationPlugin::TransformLinear(pY, pZ, nPoints, -m_sinU, m_cosU, 1., pU);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArRotationalTransformationPlugin::YZtoV(const float *const pY, const float *const pZ, const size_t nPoints, float *const pV) const
+{
+    LArRotationalTransformationPlugin::TransformLinear(pY, pZ, nPoints, -m_sinV, m_cosV, 1., pV);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArRotationalTransformationPlugin::YZtoW(const float *const pY, const float *const pZ, const size_t nPoints, float *const pW) const
+{
+    LArRotationalTransformationPlugin::TransformLinear(pY, pZ, nPoints, -m_sinW, m_cosW, 1., pW);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArRotationalTransformationPlugin::GetMinChiSquaredYZ(const float *const pU, const float *const pV, const float *const pW,
+    const size_t nPoints, const double sigmaU, const double sigmaV, const double sigmaW, float *const pY, float *const pZ,
+    float *const pChiSquared) const
+{
+    for (size_t index = 0; index < nPoints; ++index)
+    {
+        double y(0.), z(0.), chiSquared(0.);
+        LArRotationalTransformationPlugin::GetMinChiSquaredYZ(pU[index], pV[index], pW[index], sigmaU, sigmaV, sigmaW, y, z, chiSquared);
+        pY[index] = static_cast<float>(y);
+        pZ[index] = static_cast<float>(z);
+        pChiSquared[index] = static_cast<float>(chiSquared);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArRotationalTransformationPlugin::TransformLinear(const float *const pA, const float *const pB, const size_t nPoints,
+    const double coefficientA, const double coefficientB, const double denominator, float *const pOutput)
+{
+    // ATTN Sign changes are folded into the coefficients and the terms summed in either order, both of which are exact, so the results are
+    // identical to those of the scalar transformations
+    for (size_t index = 0; index < nPoints; ++index)
+        pOutput[index] = static_cast<float>((pA[index] * coefficientA + pB[index] * coefficientB) / denominator);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode LArRotationalTransformationPlugin::Initialize()
 {
     const LArTPCMap &larTPCMap(this->GetPandora().GetGeometry()->GetLArTPCMap());
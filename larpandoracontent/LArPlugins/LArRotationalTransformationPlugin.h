@@ -44,10 +44,61 @@ public:
     virtual void GetMinChiSquaredYZ(const double u, const double v, const double w, const double sigmaU, const double sigmaV, const double sigmaW,
         const double uFit, const double vFit, const double wFit, const double sigmaFit, double &y, double &z, double &chiSquared) const;
 
+    /**
+     *  @brief  Batch variants of the coordinate transformations, each transforming spans of nPoints input coordinate pairs, e.g. (u, v)
+     *          for UVtoW, into a span of nPoints output coordinates. The loops use the precomputed wire angle sines and cosines and are
+     *          written to be auto-vectorised, whilst giving results identical to the scalar variants. Output spans must not overlap inputs.
+     */
+    void UVtoW(const float *const pU, const float *const pV, const size_t nPoints, float *const pW) const;
+    void VWtoU(const float *const pV, const float *const pW, const size_t nPoints, float *const pU) const;
+    void WUtoV(const float *const pW, const float *const pU, const size_t nPoints, float *const pV) const;
+
+    void UVtoY(const float *const pU, const float *const pV, const size_t nPoints, float *const pY) const;
+    void UVtoZ(const float *const pU, const float *const pV, const size_t nPoints, float *const pZ) const;
+    void UWtoY(const float *const pU, const float *const pW, const size_t nPoints, float *const pY) const;
+    void UWtoZ(const float *const pU, const float *const pW, const size_t nPoints, float *const pZ) const;
+    void VWtoY(const float *const pV, const float *const pW, const size_t nPoints, float *const pY) const;
+    void VWtoZ(const float *const pV, const float *const pW, const size_t nPoints, float *const pZ) const;
+
+    void YZtoU(const float *const pY, const float *const pZ, const size_t nPoints, float *const pU) const;
+    void YZtoV(const float *const pY, const float *const pZ, const size_t nPoints, float *const pV) const;
+    void YZtoW(const float *const pY, const float *const pZ, const size_t nPoints, float *const pW) const;
+
+    /**
+     *  @brief  Batch variant of GetMinChiSquaredYZ, for spans of nPoints (u, v, w) coordinates with common uncertainties
+     *
+     *  @param  pU address of the first u coordinate
+     *  @param  pV address of the first v coordinate
+     *  @param  pW address of the first w coordinate
+     *  @param  nPoints the number of points
+     *  @param  sigmaU the u coordinate uncertainty
+     *  @param  sigmaV the v coordinate uncertainty
+     *  @param  sigmaW the w coordinate uncertainty
+     *  @param  pY address of the first of nPoints y coordinates to receive the results
+     *  @param  pZ address of the first of nPoints z coordinates to receive the results
+     *  @param  pChiSquared address of the first of nPoints chi squared values to receive the results
+     */
+    void GetMinChiSquaredYZ(const float *const pU, const float *const pV, const float *const pW, const size_t nPoints, const double sigmaU,
+        const double sigmaV, const double sigmaW, float *const pY, float *const pZ, float *const pChiSquared) const;
+
 private:
     pandora::StatusCode Initialize();
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
+    /**
+     *  @brief  Apply a linear transformation, output = (coefficientA * a + coefficientB * b) / denominator, to spans of coordinates
+     *
+     *  @param  pA address of the first a coordinate
+     *  @param  pB address of the first b coordinate
+     *  @param  nPoints the number of coordinate pairs
+     *  @param  coefficientA the a coefficient
+     *  @param  coefficientB the b coefficient
+     *  @param  denominator the denominator
+     *  @param  pOutput address of the first of nPoints coordinates to receive the results
+     */
+    static void TransformLinear(const float *const pA, const float *const pB, const size_t nPoints, const double coefficientA,
+        const double coefficientB, const double denominator, float *const pOutput);
+
     double m_thetaU; ///< inclination of U wires (radians)
     double m_thetaV; ///< inclination of V wires (radians)
     double m_thetaW; ///< inclination of W wires (radians)
@@ -36,6 +36,13 @@ bool AmbiguousDeltaRayTool::Run(ThreeViewDeltaRayMatchingAlgorithm *const pAlgor
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+bool AmbiguousDeltaRayTool::ExaminesGroupsIndependently() const
+{
+    return true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void AmbiguousDeltaRayTool::ExamineConnectedElements(TensorType &overlapTensor) const
 {
     ClusterVector sortedKeyClusters;
@@ -25,6 +25,7 @@ public:
 
 private:
     bool Run(ThreeViewDeltaRayMatchingAlgorithm *const pAlgorithm, TensorType &overlapTensor);
+    bool ExaminesGroupsIndependently() const;
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
     /**
@@ -13,6 +13,9 @@
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
 
+#include <algorithm>
+#include <limits>
+
 using namespace pandora;
 
 namespace lar_content
@@ -91,10 +94,60 @@ void CosmicRayBaseMatchingAlgorithm::MatchClusters(
     if (hitType1 == hitType2)
         throw StatusCodeException(STATUS_CODE_FAILURE);
 
+    // ATTN Order the second view's clusters by their minimum x coordinate, so that only those with compatible x spans are tested
+    const float maxXSeparation(this->GetMaxXSeparation());
+    const bool pruneCandidates(maxXSeparation < std::numeric_limits<float>::max());
+
+    XSpanVector xSpans2;
+    UIntVector sortedIndices2;
+
+    for (unsigned int index2 = 0; index2 < clusterVector2.size(); ++index2)
+    {
+        float xMin2(0.f), xMax2(0.f);
+
+        if (pruneCandidates)
+            clusterVector2.at(index2)->GetClusterSpanX(xMin2, xMax2);
+
+        xSpans2.push_back(XSpan(xMin2, xMax2));
+        sortedIndices2.push_back(index2);
+    }
+
+    if (pruneCandidates)
+    {
+        std::sort(sortedIndices2.begin(), sortedIndices2.end(),
+            [&xSpans2](const unsigned int lhs, const unsigned int rhs) { return (xSpans2.at(lhs).first < xSpans2.at(rhs).first); });
+    }
+
     for (const Cluster *const pCluster1 : clusterVector1)
     {
-        for (const Cluster *const pCluster2 : clusterVector2)
+        UIntVector candidateIndices2;
+
+        if (pruneCandidates)
+        {
+            float xMin1(0.f), xMax1(0.f);
+            pCluster1->GetClusterSpanX(xMin1, xMax1);
+
+            for (const unsigned int index2 : sortedIndices2)
+            {
+                if (xSpans2.at(index2).first > xMax1 + maxXSeparation)
+                    break;
+
+                if (xSpans2.at(index2).second >= xMin1 - maxXSeparation)
+                    candidateIndices2.push_back(index2);
+            }
+
+            // ATTN Restore the input ordering, so that the matches are recorded in the same order as without pruning
+            std::sort(candidateIndices2.begin(), candidateIndices2.end());
+        }
+        else
+        {
+            candidateIndices2 = sortedIndices2;
+        }
+
+        for (const unsigned int index2 : candidateIndices2)
         {
+            const Cluster *const pCluster2(clusterVector2.at(index2));
+
             if (this->MatchClusters(pCluster1, pCluster2))
             {
                 UIntSet daughterVolumeIntersection;
@@ -109,6 +162,13 @@ void CosmicRayBaseMatchingAlgorithm::MatchClusters(
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+float CosmicRayBaseMatchingAlgorithm::GetMaxXSeparation() const
+{
+    return std::numeric_limits<float>::max();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void CosmicRayBaseMatchingAlgorithm::MatchThreeViews(const ClusterAssociationMap &matchedClusters12,
     const ClusterAssociationMap &matchedClusters23, const ClusterAssociationMap &matchedClusters31, ParticleList &matchedParticles) const
 {
@@ -48,6 +48,8 @@ protected:
     typedef std::vector<Particle> ParticleList;
     typedef std::unordered_map<const pandora::Cluster *, pandora::ClusterList> ClusterAssociationMap;
     typedef std::set<unsigned int> UIntSet;
+    typedef std::pair<float, float> XSpan;
+    typedef std::vector<XSpan> XSpanVector;
 
     /**
      *  @brief Select a set of clusters judged to be clean
@@ -67,6 +69,14 @@ protected:
      */
     virtual bool MatchClusters(const pandora::Cluster *const pCluster1, const pandora::Cluster *const pCluster2) const = 0;
 
+    /**
+     *  @brief Get the maximum separation between the x spans of two clusters that may still be matched, so that pairs of clusters
+     *         further apart can be discarded before MatchClusters is called. By default, no pairs are discarded.
+     *
+     *  @return the maximum x separation
+     */
+    virtual float GetMaxXSeparation() const;
+
     /**
      *  @brief Check that three clusters have a consistent 3D position
      *
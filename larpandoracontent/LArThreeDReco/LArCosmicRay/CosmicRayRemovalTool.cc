@@ -382,7 +382,7 @@ void CosmicRayRemovalTool::ReclusterRemnant(const HitType hitType, const Cluster
     {
         if (pRemnant->GetNCaloHits() < m_minRemnantClusterSize)
         {
-            if (LArClusterHelper::GetClosestDistance(pRemnant, pMuonCluster) < m_maxDistanceToTrack)
+            if (LArClusterHelper::IsCloserThan(pRemnant, pMuonCluster, m_maxDistanceToTrack))
             {
                 PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::MergeAndDeleteClusters(*m_pParentAlgorithm, pMuonCluster, pRemnant));
                 continue;
@@ -61,6 +61,14 @@ bool CosmicRayShowerMatchingAlgorithm::MatchClusters(const Cluster *const pClust
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+float CosmicRayShowerMatchingAlgorithm::GetMaxXSeparation() const
+{
+    // ATTN Matched clusters must overlap in x by more than m_minXOverlap, so only a negative overlap requirement permits a separation
+    return std::max(0.f, -m_minXOverlap);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 bool CosmicRayShowerMatchingAlgorithm::CheckMatchedClusters3D(
     const Cluster *const pCluster1, const Cluster *const pCluster2, const Cluster *const pCluster3) const
 {
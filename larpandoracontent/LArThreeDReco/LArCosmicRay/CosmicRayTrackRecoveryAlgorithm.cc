@@ -13,6 +13,10 @@
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
 #include "larpandoracontent/LArHelpers/LArPointingClusterHelper.h"
+#include "larpandoracontent/LArHelpers/LArSlidingFitCacheHelper.h"
+
+#include <algorithm>
+#include <iterator>
 
 using namespace pandora;
 
@@ -139,7 +143,8 @@ void CosmicRayTrackRecoveryAlgorithm::BuildSlidingFitResultMap(const ClusterVect
         {
             try
             {
-                const TwoDSlidingFitResult slidingFitResult(*iter, m_halfWindowLayers, slidingFitPitch);
+                const TwoDSlidingFitResult &slidingFitResult(
+                    LArSlidingFitCacheHelper::GetSlidingFitResult(this->GetPandora(), *iter, m_halfWindowLayers, slidingFitPitch));
 
                 if (!slidingFitResultMap.insert(TwoDSlidingFitResultMap::value_type(*iter, slidingFitResult)).second)
                     throw StatusCodeException(STATUS_CODE_FAILURE);
@@ -158,17 +163,26 @@ void CosmicRayTrackRecoveryAlgorithm::BuildSlidingFitResultMap(const ClusterVect
 void CosmicRayTrackRecoveryAlgorithm::MatchViews(const ClusterVector &clusterVector1, const ClusterVector &clusterVector2,
     const TwoDSlidingFitResultMap &slidingFitResultMap, ClusterAssociationMap &clusterAssociationMap) const
 {
+    DaughterVolumeIdsMap daughterVolumeIdsMap;
+
+    for (const ClusterVector *const pClusterVector : {&clusterVector1, &clusterVector2})
+    {
+        for (const Cluster *const pCluster : *pClusterVector)
+            LArClusterHelper::GetDaughterVolumeIDs(pCluster, daughterVolumeIdsMap[pCluster]);
+    }
+
     for (ClusterVector::const_iterator iter1 = clusterVector1.begin(), iterEnd1 = clusterVector1.end(); iter1 != iterEnd1; ++iter1)
-        this->MatchClusters(*iter1, clusterVector2, slidingFitResultMap, clusterAssociationMap);
+        this->MatchClusters(*iter1, clusterVector2, slidingFitResultMap, daughterVolumeIdsMap, clusterAssociationMap);
 
     for (ClusterVector::const_iterator iter2 = clusterVector2.begin(), iterEnd2 = clusterVector2.end(); iter2 != iterEnd2; ++iter2)
-        this->MatchClusters(*iter2, clusterVector1, slidingFitResultMap, clusterAssociationMap);
+        this->MatchClusters(*iter2, clusterVector1, slidingFitResultMap, daughterVolumeIdsMap, clusterAssociationMap);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void CosmicRayTrackRecoveryAlgorithm::MatchClusters(const Cluster *const pSeedCluster, const ClusterVector &targetClusters,
-    const TwoDSlidingFitResultMap &slidingFitResultMap, ClusterAssociationMap &clusterAssociationMap) const
+    const TwoDSlidingFitResultMap &slidingFitResultMap, const DaughterVolumeIdsMap &daughterVolumeIdsMap,
+    ClusterAssociationMap &clusterAssociationMap) const
 {
     // Match seed cluster to target clusters according to alignment in X position of start/end positions
     // Two possible matches: (a) one-to-one associations where both the track start and end positions match up
@@ -184,6 +198,11 @@ void CosmicRayTrackRecoveryAlgorithm::MatchClusters(const Cluster *const pSeedCl
     const CartesianVector &innerVertex1(slidingFitResult1.GetGlobalMinLayerPosition());
     const CartesianVector &outerVertex1(slidingFitResult1.GetGlobalMaxLayerPosition());
     const float xSpan1(std::fabs(outerVertex1.GetX() - innerVertex1.GetX()));
+    const float xMin1(std::min(innerVertex1.GetX(), outerVertex1.GetX()));
+    const float xMax1(std::max(innerVertex1.GetX(), outerVertex1.GetX()));
+
+    const HitType seedHitType(LArClusterHelper::GetClusterHitType(pSeedCluster));
+    const UIntSet &seedDaughterVolumeIds(daughterVolumeIdsMap.at(pSeedCluster));
 
     const Cluster *pBestClusterInner(NULL);
     const Cluster *pBestClusterOuter(NULL);
@@ -196,20 +215,20 @@ void CosmicRayTrackRecoveryAlgorithm::MatchClusters(const Cluster *const pSeedCl
     for (ClusterVector::const_iterator tIter = targetClusters.begin(), tIterEnd = targetClusters.end(); tIter != tIterEnd; ++tIter)
     {
         const Cluster *const pTargetCluster = *tIter;
+        const HitType targetHitType(LArClusterHelper::GetClusterHitType(pTargetCluster));
+        TwoDSlidingFitResultMap::const_iterator ftIter = slidingFitResultMap.find(pTargetCluster);
 
-        UIntSet daughterVolumeIntersection;
-        LArGeometryHelper::GetCommonDaughterVolumes(pSeedCluster, pTargetCluster, daughterVolumeIntersection);
-
-        if (daughterVolumeIntersection.empty())
-            continue;
-
-        if (LArClusterHelper::GetClusterHitType(pSeedCluster) == LArClusterHelper::GetClusterHitType(pTargetCluster))
-            throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+        // ATTN The x extents are compared before the daughter volumes, unless one of the checks that may throw would fail
+        if ((slidingFitResultMap.end() == ftIter) || (seedHitType == targetHitType))
+        {
+            if (!this->HasCommonDaughterVolume(seedDaughterVolumeIds, daughterVolumeIdsMap.at(pTargetCluster)))
+                continue;
 
-        TwoDSlidingFitResultMap::const_iterator ftIter = slidingFitResultMap.find(*tIter);
+            if (seedHitType == targetHitType)
+                throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
 
-        if (slidingFitResultMap.end() == ftIter)
             throw StatusCodeException(STATUS_CODE_FAILURE);
+        }
 
         const TwoDSlidingFitResult &slidingFitResult2(ftIter->second);
         const CartesianVector &innerVertex2(slidingFitResult2.GetGlobalMinLayerPosition());
@@ -219,8 +238,6 @@ void CosmicRayTrackRecoveryAlgorithm::MatchClusters(const Cluster *const pSeedCl
         if (xSpan2 > 1.5f * xSpan1)
             continue;
 
-        const float xMin1(std::min(innerVertex1.GetX(), outerVertex1.GetX()));
-        const float xMax1(std::max(innerVertex1.GetX(), outerVertex1.GetX()));
         const float xMin2(std::min(innerVertex2.GetX(), outerVertex2.GetX()));
         const float xMax2(std::max(innerVertex2.GetX(), outerVertex2.GetX()));
         const float xOverlap(std::min(xMax1, xMax2) - std::max(xMin1, xMin2));
@@ -228,6 +245,9 @@ void CosmicRayTrackRecoveryAlgorithm::MatchClusters(const Cluster *const pSeedCl
         if (xOverlap < m_clusterMinOverlapX)
             continue;
 
+        if (!this->HasCommonDaughterVolume(seedDaughterVolumeIds, daughterVolumeIdsMap.at(pTargetCluster)))
+            continue;
+
         const float dxMin(std::fabs(xMin2 - xMin1));
         const float dxMax(std::fabs(xMax2 - xMax1));
 
@@ -309,6 +329,28 @@ void CosmicRayTrackRecoveryAlgorithm::MatchClusters(const Cluster *const pSeedCl
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+bool CosmicRayTrackRecoveryAlgorithm::HasCommonDaughterVolume(const UIntSet &daughterVolumeIds1, const UIntSet &daughterVolumeIds2) const
+{
+    UIntSet daughterVolumeIntersection;
+    std::set_intersection(daughterVolumeIds1.begin(), daughterVolumeIds1.end(), daughterVolumeIds2.begin(), daughterVolumeIds2.end(),
+        std::inserter(daughterVolumeIntersection, daughterVolumeIntersection.begin()));
+
+    return !daughterVolumeIntersection.empty();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const ClusterList &CosmicRayTrackRecoveryAlgorithm::GetAssociatedClusters(
+    const ClusterAssociationMap &clusterAssociationMap, const Cluster *const pCluster) const
+{
+    static const ClusterList emptyClusterList;
+    const ClusterAssociationMap::const_iterator iter(clusterAssociationMap.find(pCluster));
+
+    return ((clusterAssociationMap.end() != iter) ? iter->second : emptyClusterList);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void CosmicRayTrackRecoveryAlgorithm::MatchThreeViews(const ClusterVector &clusterVectorU, const ClusterVector &clusterVectorV,
     const ClusterVector &clusterVectorW, const ClusterAssociationMap &matchedClustersUV, const ClusterAssociationMap &matchedClustersVW,
     const ClusterAssociationMap &matchedClustersWU, ParticleList &particleList) const
@@ -333,11 +375,8 @@ void CosmicRayTrackRecoveryAlgorithm::MatchThreeViews(const ClusterVector &clust
         if (vetoList.count(pCluster1))
             continue;
 
-        const ClusterAssociationMap::const_iterator iter311 = matchedClusters31.find(pCluster1);
-        const ClusterList matchedClusters31_pCluster1(iter311 != matchedClusters31.end() ? iter311->second : ClusterList());
-
-        const ClusterAssociationMap::const_iterator iter121 = matchedClusters12.find(pCluster1);
-        const ClusterList matchedClusters12_pCluster1(iter121 != matchedClusters12.end() ? iter121->second : ClusterList());
+        const ClusterList &matchedClusters31_pCluster1(this->GetAssociatedClusters(matchedClusters31, pCluster1));
+        const ClusterList &matchedClusters12_pCluster1(this->GetAssociatedClusters(matchedClusters12, pCluster1));
 
         for (ClusterVector::const_iterator iter2 = clusterVector2.begin(), iterEndV = clusterVector2.end(); iter2 != iterEndV; ++iter2)
         {
@@ -346,11 +385,20 @@ void CosmicRayTrackRecoveryAlgorithm::MatchThreeViews(const ClusterVector &clust
             if (vetoList.count(pCluster2))
                 continue;
 
-            const ClusterAssociationMap::const_iterator iter122 = matchedClusters12.find(pCluster2);
-            const ClusterList matchedClusters12_pCluster2(iter122 != matchedClusters12.end() ? iter122->second : ClusterList());
+            const ClusterList &matchedClusters12_pCluster2(this->GetAssociatedClusters(matchedClusters12, pCluster2));
+            const ClusterList &matchedClusters23_pCluster2(this->GetAssociatedClusters(matchedClusters23, pCluster2));
+
+            const bool match12(
+                (matchedClusters12_pCluster1.size() + matchedClusters12_pCluster2.size() > 0) &&
+                ((matchedClusters12_pCluster1.size() == 1 && std::find(matchedClusters12_pCluster1.begin(), matchedClusters12_pCluster1.end(),
+                                                                 pCluster2) != matchedClusters12_pCluster1.end()) ||
+                    (matchedClusters12_pCluster1.size() == 0)) &&
+                ((matchedClusters12_pCluster2.size() == 1 && std::find(matchedClusters12_pCluster2.begin(), matchedClusters12_pCluster2.end(),
+                                                                 pCluster1) != matchedClusters12_pCluster2.end()) ||
+                    (matchedClusters12_pCluster2.size() == 0)));
 
-            const ClusterAssociationMap::const_iterator iter232 = matchedClusters23.find(pCluster2);
-            const ClusterList matchedClusters23_pCluster2(iter232 != matchedClusters23.end() ? iter232->second : ClusterList());
+            if (!match12)
+                continue;
 
             for (ClusterVector::const_iterator iter3 = clusterVector3.begin(), iterEnd3 = clusterVector3.end(); iter3 != iterEnd3; ++iter3)
             {
@@ -359,20 +407,8 @@ void CosmicRayTrackRecoveryAlgorithm::MatchThreeViews(const ClusterVector &clust
                 if (vetoList.count(pCluster3))
                     continue;
 
-                const ClusterAssociationMap::const_iterator iter233 = matchedClusters23.find(pCluster3);
-                const ClusterList matchedClusters23_pCluster3(iter233 != matchedClusters23.end() ? iter233->second : ClusterList());
-
-                const ClusterAssociationMap::const_iterator iter313 = matchedClusters31.find(pCluster3);
-                const ClusterList matchedClusters31_pCluster3(iter313 != matchedClusters31.end() ? iter313->second : ClusterList());
-
-                const bool match12(
-                    (matchedClusters12_pCluster1.size() + matchedClusters12_pCluster2.size() > 0) &&
-                    ((matchedClusters12_pCluster1.size() == 1 && std::find(matchedClusters12_pCluster1.begin(), matchedClusters12_pCluster1.end(),
-                                                                     pCluster2) != matchedClusters12_pCluster1.end()) ||
-                        (matchedClusters12_pCluster1.size() == 0)) &&
-                    ((matchedClusters12_pCluster2.size() == 1 && std::find(matchedClusters12_pCluster2.begin(), matchedClusters12_pCluster2.end(),
-                                                                     pCluster1) != matchedClusters12_pCluster2.end()) ||
-                        (matchedClusters12_pCluster2.size() == 0)));
+                const ClusterList &matchedClusters23_pCluster3(this->GetAssociatedClusters(matchedClusters23, pCluster3));
+                const ClusterList &matchedClusters31_pCluster3(this->GetAssociatedClusters(matchedClusters31, pCluster3));
 
                 const bool match23(
                     (matchedClusters23_pCluster2.size() + matchedClusters23_pCluster3.size() > 0) &&
@@ -392,7 +428,7 @@ void CosmicRayTrackRecoveryAlgorithm::MatchThreeViews(const ClusterVector &clust
                                                                      pCluster3) != matchedClusters31_pCluster1.end()) ||
                         (matchedClusters31_pCluster1.size() == 0)));
 
-                if (match12 && match23 && match31)
+                if (match23 && match31)
                 {
                     Particle newParticle;
                     newParticle.m_clusterList.push_back(pCluster1);
@@ -435,11 +471,8 @@ void CosmicRayTrackRecoveryAlgorithm::MatchTwoViews(const ClusterVector &cluster
             if (vetoList.count(pCluster1))
                 continue;
 
-            const ClusterAssociationMap::const_iterator iter311 = matchedClusters31.find(pCluster1);
-            const ClusterList matchedClusters31_pCluster1(iter311 != matchedClusters31.end() ? iter311->second : ClusterList());
-
-            const ClusterAssociationMap::const_iterator iter121 = matchedClusters12.find(pCluster1);
-            const ClusterList matchedClusters12_pCluster1(iter121 != matchedClusters12.end() ? iter121->second : ClusterList());
+            const ClusterList &matchedClusters31_pCluster1(this->GetAssociatedClusters(matchedClusters31, pCluster1));
+            const ClusterList &matchedClusters12_pCluster1(this->GetAssociatedClusters(matchedClusters12, pCluster1));
 
             for (ClusterVector::const_iterator iter2 = clusterVector2.begin(), iterEnd2 = clusterVector2.end(); iter2 != iterEnd2; ++iter2)
             {
@@ -448,11 +481,8 @@ void CosmicRayTrackRecoveryAlgorithm::MatchTwoViews(const ClusterVector &cluster
                 if (vetoList.count(pCluster2))
                     continue;
 
-                const ClusterAssociationMap::const_iterator iter122 = matchedClusters12.find(pCluster2);
-                const ClusterList matchedClusters12_pCluster2(iter122 != matchedClusters12.end() ? iter122->second : ClusterList());
-
-                const ClusterAssociationMap::const_iterator iter232 = matchedClusters23.find(pCluster2);
-                const ClusterList matchedClusters23_pCluster2(iter232 != matchedClusters23.end() ? iter232->second : ClusterList());
+                const ClusterList &matchedClusters12_pCluster2(this->GetAssociatedClusters(matchedClusters12, pCluster2));
+                const ClusterList &matchedClusters23_pCluster2(this->GetAssociatedClusters(matchedClusters23, pCluster2));
 
                 const bool match12(
                     (matchedClusters12_pCluster1.size() == 1 && std::find(matchedClusters12_pCluster1.begin(), matchedClusters12_pCluster1.end(),
@@ -475,11 +505,8 @@ void CosmicRayTrackRecoveryAlgorithm::MatchTwoViews(const ClusterVector &cluster
                     if (vetoList.count(pCluster3))
                         continue;
 
-                    const ClusterAssociationMap::const_iterator iter233 = matchedClusters23.find(pCluster3);
-                    const ClusterList matchedClusters23_pCluster3(iter233 != matchedClusters23.end() ? iter233->second : ClusterList());
-
-                    const ClusterAssociationMap::const_iterator iter313 = matchedClusters31.find(pCluster3);
-                    const ClusterList matchedClusters31_pCluster3(iter313 != matchedClusters31.end() ? iter313->second : ClusterList());
+                    const ClusterList &matchedClusters23_pCluster3(this->GetAssociatedClusters(matchedClusters23, pCluster3));
+                    const ClusterList &matchedClusters31_pCluster3(this->GetAssociatedClusters(matchedClusters31, pCluster3));
 
                     const bool match3((matchedClusters31_pCluster3.size() + matchedClusters23_pCluster3.size() > 0) &&
                                       ((matchedClusters31_pCluster3.size() == 1 &&
@@ -531,11 +558,8 @@ void CosmicRayTrackRecoveryAlgorithm::MatchOneView(const ClusterVector &clusterV
             if (vetoList.count(pCluster1))
                 continue;
 
-            const ClusterAssociationMap::const_iterator iter311 = matchedClusters31.find(pCluster1);
-            const ClusterList matchedClusters31_pCluster1(iter311 != matchedClusters31.end() ? iter311->second : ClusterList());
-
-            const ClusterAssociationMap::const_iterator iter121 = matchedClusters12.find(pCluster1);
-            const ClusterList matchedClusters12_pCluster1(iter121 != matchedClusters12.end() ? iter121->second : ClusterList());
+            const ClusterList &matchedClusters31_pCluster1(this->GetAssociatedClusters(matchedClusters31, pCluster1));
+            const ClusterList &matchedClusters12_pCluster1(this->GetAssociatedClusters(matchedClusters12, pCluster1));
 
             if (matchedClusters12_pCluster1.size() + matchedClusters31_pCluster1.size() > 0)
                 continue;
@@ -550,11 +574,8 @@ void CosmicRayTrackRecoveryAlgorithm::MatchOneView(const ClusterVector &clusterV
                 if (vetoList.count(pCluster2))
                     continue;
 
-                const ClusterAssociationMap::const_iterator iter122 = matchedClusters12.find(pCluster2);
-                const ClusterList matchedClusters12_pCluster2(iter122 != matchedClusters12.end() ? iter122->second : ClusterList());
-
-                const ClusterAssociationMap::const_iterator iter232 = matchedClusters23.find(pCluster2);
-                const ClusterList matchedClusters23_pCluster2(iter232 != matchedClusters23.end() ? iter232->second : ClusterList());
+                const ClusterList &matchedClusters12_pCluster2(this->GetAssociatedClusters(matchedClusters12, pCluster2));
+                const ClusterList &matchedClusters23_pCluster2(this->GetAssociatedClusters(matchedClusters23, pCluster2));
 
                 if (matchedClusters12_pCluster2.size() == 1 &&
                     std::find(matchedClusters12_pCluster2.begin(), matchedClusters12_pCluster2.end(), pCluster1) !=
@@ -570,11 +591,8 @@ void CosmicRayTrackRecoveryAlgorithm::MatchOneView(const ClusterVector &clusterV
                 if (vetoList.count(pCluster3))
                     continue;
 
-                const ClusterAssociationMap::const_iterator iter233 = matchedClusters23.find(pCluster3);
-                const ClusterList matchedClusters23_pCluster3(iter233 != matchedClusters23.end() ? iter233->second : ClusterList());
-
-                const ClusterAssociationMap::const_iterator iter313 = matchedClusters31.find(pCluster3);
-                const ClusterList matchedClusters31_pCluster3(iter313 != matchedClusters31.end() ? iter313->second : ClusterList());
+                const ClusterList &matchedClusters23_pCluster3(this->GetAssociatedClusters(matchedClusters23, pCluster3));
+                const ClusterList &matchedClusters31_pCluster3(this->GetAssociatedClusters(matchedClusters31, pCluster3));
 
                 if (matchedClusters31_pCluster3.size() == 1 &&
                     std::find(matchedClusters31_pCluster3.begin(), matchedClusters31_pCluster3.end(), pCluster1) !=
@@ -606,35 +624,37 @@ void CosmicRayTrackRecoveryAlgorithm::BuildVetoList(const ParticleList &particle
 
 void CosmicRayTrackRecoveryAlgorithm::RemoveAmbiguities(const ParticleList &inputParticleList, ParticleList &outputParticleList) const
 {
-    for (ParticleList::const_iterator pIter1 = inputParticleList.begin(), pIterEnd1 = inputParticleList.end(); pIter1 != pIterEnd1; ++pIter1)
+    ClusterToParticleIndicesMap clusterToParticleIndicesMap;
+
+    for (unsigned int iParticle = 0; iParticle < inputParticleList.size(); ++iParticle)
+    {
+        for (const Cluster *const pCluster : inputParticleList.at(iParticle).m_clusterList)
+            clusterToParticleIndicesMap[pCluster].push_back(iParticle);
+    }
+
+    for (unsigned int iParticle1 = 0; iParticle1 < inputParticleList.size(); ++iParticle1)
     {
-        const Particle &particle1 = *pIter1;
+        const Particle &particle1 = inputParticleList.at(iParticle1);
         const ClusterList &clusterList1 = particle1.m_clusterList;
 
         try
         {
             bool isUnique(true);
 
-            for (ParticleList::const_iterator pIter2 = pIter1, pIterEnd2 = inputParticleList.end(); pIter2 != pIterEnd2; ++pIter2)
+            // ATTN Only later particles sharing a cluster are compared, as before, but these are found without scanning all later particles
+            for (const Cluster *const pCluster : clusterList1)
             {
-                const Particle &particle2 = *pIter2;
-                const ClusterList &clusterList2 = particle2.m_clusterList;
-
-                ClusterSet duplicateSet;
-
-                for (ClusterList::const_iterator cIter1 = clusterList1.begin(), cIterEnd1 = clusterList1.end(); cIter1 != cIterEnd1; ++cIter1)
+                for (const unsigned int iParticle2 : clusterToParticleIndicesMap.at(pCluster))
                 {
-                    const Cluster *pCluster = *cIter1;
-
-                    if (clusterList2.end() != std::find(clusterList2.begin(), clusterList2.end(), pCluster))
-                        duplicateSet.insert(pCluster);
+                    if ((iParticle2 >= iParticle1) && (clusterList1.size() != inputParticleList.at(iParticle2).m_clusterList.size()))
+                    {
+                        isUnique = false;
+                        break;
+                    }
                 }
 
-                if (duplicateSet.size() > 0 && clusterList1.size() != clusterList2.size())
-                {
-                    isUnique = false;
+                if (!isUnique)
                     break;
-                }
             }
 
             if (!isUnique)
@@ -43,6 +43,8 @@ private:
     typedef std::vector<Particle> ParticleList;
     typedef std::unordered_map<const pandora::Cluster *, pandora::ClusterList> ClusterAssociationMap;
     typedef std::set<unsigned int> UIntSet;
+    typedef std::unordered_map<const pandora::Cluster *, UIntSet> DaughterVolumeIdsMap;
+    typedef std::unordered_map<const pandora::Cluster *, std::vector<unsigned int>> ClusterToParticleIndicesMap;
 
     /**
      *  @brief Get a vector of available clusters
@@ -85,10 +87,33 @@ private:
      *  @param pSeedCluster the input seed cluster
      *  @param targetClusters the input list of target clusters
      *  @param slidingFitResultMap the input map of sliding linear fit results
+     *  @param daughterVolumeIdsMap the input map from cluster to daughter volume ids
      *  @param clusterAssociationMap the output map of cluster associations
      */
     void MatchClusters(const pandora::Cluster *const pSeedCluster, const pandora::ClusterVector &targetClusters,
-        const TwoDSlidingFitResultMap &slidingFitResultMap, ClusterAssociationMap &clusterAssociationMap) const;
+        const TwoDSlidingFitResultMap &slidingFitResultMap, const DaughterVolumeIdsMap &daughterVolumeIdsMap,
+        ClusterAssociationMap &clusterAssociationMap) const;
+
+    /**
+     *  @brief Whether two sets of daughter volume ids have any id in common
+     *
+     *  @param daughterVolumeIds1 the first set of daughter volume ids
+     *  @param daughterVolumeIds2 the second set of daughter volume ids
+     *
+     *  @return boolean
+     */
+    bool HasCommonDaughterVolume(const UIntSet &daughterVolumeIds1, const UIntSet &daughterVolumeIds2) const;
+
+    /**
+     *  @brief Get the clusters associated with a given cluster, without copying the associated cluster list
+     *
+     *  @param clusterAssociationMap the map of cluster associations
+     *  @param pCluster the address of the cluster
+     *
+     *  @return the list of associated clusters, which is empty if the cluster has no entry in the map
+     */
+    const pandora::ClusterList &GetAssociatedClusters(
+        const ClusterAssociationMap &clusterAssociationMap, const pandora::Cluster *const pCluster) const;
 
     /**
      *  @brief  Create candidate particles using three primary clusters
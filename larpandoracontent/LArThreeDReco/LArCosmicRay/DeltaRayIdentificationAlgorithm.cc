@@ -29,6 +29,9 @@ DeltaRayIdentificationAlgorithm::DeltaRayIdentificationAlgorithm() :
 
 StatusCode DeltaRayIdentificationAlgorithm::Run()
 {
+    // ATTN The bounding boxes used to pre-check the separations of each pair of pfos are only cached within a geometry cache scope
+    const LArClusterHelper::GeometryCacheScope geometryCacheScope;
+
     PfoVector parentPfos, daughterPfos;
     this->GetPfos(m_parentPfoListName, parentPfos);
     this->GetPfos(m_daughterPfoListName, daughterPfos);
@@ -41,9 +44,17 @@ StatusCode DeltaRayIdentificationAlgorithm::Run()
     }
 
     // Build parent/daughter associations (currently using length and proximity)
+    m_lengthSquaredMap.clear();
+    m_vertexVectorMap.clear();
+    m_clusterListMap.clear();
+
     PfoAssociationMap pfoAssociationMap;
     this->BuildAssociationMap(parentPfos, daughterPfos, pfoAssociationMap);
 
+    m_lengthSquaredMap.clear();
+    m_vertexVectorMap.clear();
+    m_clusterListMap.clear();
+
     // Create the parent/daughter links
     PfoList newDaughterPfoList;
     this->BuildParentDaughterLinks(pfoAssociationMap, newDaughterPfoList);
@@ -154,8 +165,8 @@ bool DeltaRayIdentificationAlgorithm::IsAssociated(
     if (pDaughterPfo == pParentPfo)
         return false;
 
-    const float daughterLengthSquared(LArPfoHelper::GetTwoDLengthSquared(pDaughterPfo));
-    const float parentLengthSquared(LArPfoHelper::GetTwoDLengthSquared(pParentPfo));
+    const float daughterLengthSquared(this->GetCachedTwoDLengthSquared(pDaughterPfo));
+    const float parentLengthSquared(this->GetCachedTwoDLengthSquared(pParentPfo));
 
     if (daughterLengthSquared > m_maxDaughterLengthSquared || parentLengthSquared < m_minParentLengthSquared || daughterLengthSquared > 0.5 * parentLengthSquared)
         return false;
@@ -167,6 +178,9 @@ bool DeltaRayIdentificationAlgorithm::IsAssociated(
 
     try
     {
+        if (this->IsBeyondTwoDSeparation(pDaughterPfo, pParentPfo, displacementCut))
+            return false;
+
         displacement = this->GetTwoDSeparation(pDaughterPfo, pParentPfo);
     }
     catch (StatusCodeException &statusCodeException)
@@ -183,17 +197,54 @@ bool DeltaRayIdentificationAlgorithm::IsAssociated(
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+bool DeltaRayIdentificationAlgorithm::IsBeyondTwoDSeparation(
+    const ParticleFlowObject *const pDaughterPfo, const ParticleFlowObject *const pParentPfo, const float displacementCut) const
+{
+    float sumViews(0.f);
+    float sumDisplacementSquared(0.f);
+
+    for (const HitType hitType : {TPC_VIEW_U, TPC_VIEW_V, TPC_VIEW_W})
+    {
+        const CartesianPointVector &vertexVector(this->GetCachedTwoDVertices(pDaughterPfo, hitType));
+
+        if (vertexVector.empty())
+            continue;
+
+        const ClusterList &clusterList(this->GetCachedClusters(pParentPfo, hitType));
+
+        if (clusterList.empty())
+            return false;
+
+        float bestDisplacement(std::numeric_limits<float>::max());
+
+        for (const CartesianVector &thisVertex : vertexVector)
+        {
+            for (const Cluster *const pCluster : clusterList)
+                bestDisplacement = std::min(bestDisplacement, LArClusterHelper::GetBoundingBoxDistance(thisVertex, pCluster));
+        }
+
+        sumDisplacementSquared += bestDisplacement * bestDisplacement;
+        sumViews += 1.f;
+    }
+
+    if (sumViews < std::numeric_limits<float>::epsilon())
+        return false;
+
+    // ATTN Bounding box distances never exceed hit distances; padding absorbs rounding differences between the two calculations
+    return (std::sqrt(sumDisplacementSquared / sumViews) > displacementCut + 0.01f);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 float DeltaRayIdentificationAlgorithm::GetTwoDSeparation(const ParticleFlowObject *const pDaughterPfo, const ParticleFlowObject *const pParentPfo) const
 {
-    CartesianPointVector vertexVectorU, vertexVectorV, vertexVectorW;
-    this->GetTwoDVertices(pDaughterPfo, TPC_VIEW_U, vertexVectorU);
-    this->GetTwoDVertices(pDaughterPfo, TPC_VIEW_V, vertexVectorV);
-    this->GetTwoDVertices(pDaughterPfo, TPC_VIEW_W, vertexVectorW);
+    const CartesianPointVector &vertexVectorU(this->GetCachedTwoDVertices(pDaughterPfo, TPC_VIEW_U));
+    const CartesianPointVector &vertexVectorV(this->GetCachedTwoDVertices(pDaughterPfo, TPC_VIEW_V));
+    const CartesianPointVector &vertexVectorW(this->GetCachedTwoDVertices(pDaughterPfo, TPC_VIEW_W));
 
-    ClusterList clusterListU, clusterListV, clusterListW;
-    LArPfoHelper::GetClusters(pParentPfo, TPC_VIEW_U, clusterListU);
-    LArPfoHelper::GetClusters(pParentPfo, TPC_VIEW_V, clusterListV);
-    LArPfoHelper::GetClusters(pParentPfo, TPC_VIEW_W, clusterListW);
+    const ClusterList &clusterListU(this->GetCachedClusters(pParentPfo, TPC_VIEW_U));
+    const ClusterList &clusterListV(this->GetCachedClusters(pParentPfo, TPC_VIEW_V));
+    const ClusterList &clusterListW(this->GetCachedClusters(pParentPfo, TPC_VIEW_W));
 
     float sumViews(0.f);
     float sumDisplacementSquared(0.f);
@@ -260,6 +311,11 @@ float DeltaRayIdentificationAlgorithm::GetClosestDistance(const CartesianPointVe
         for (ClusterList::const_iterator iter2 = clusterList.begin(), iterEnd2 = clusterList.end(); iter2 != iterEnd2; ++iter2)
         {
             const Cluster *const pCluster = *iter2;
+
+            // ATTN No hit can be closer than the bounding box; padding absorbs rounding differences between the two calculations
+            if (LArClusterHelper::GetBoundingBoxDistance(thisVertex, pCluster) > bestDisplacement + 0.01f)
+                continue;
+
             const float thisDisplacement(LArClusterHelper::GetClosestDistance(thisVertex, pCluster));
 
             if (thisDisplacement < bestDisplacement)
@@ -272,6 +328,53 @@ float DeltaRayIdentificationAlgorithm::GetClosestDistance(const CartesianPointVe
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+float DeltaRayIdentificationAlgorithm::GetCachedTwoDLengthSquared(const ParticleFlowObject *const pPfo) const
+{
+    PfoToFloatMap::const_iterator iter(m_lengthSquaredMap.find(pPfo));
+
+    if (m_lengthSquaredMap.end() == iter)
+        iter = m_lengthSquaredMap.emplace(pPfo, LArPfoHelper::GetTwoDLengthSquared(pPfo)).first;
+
+    return iter->second;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const CartesianPointVector &DeltaRayIdentificationAlgorithm::GetCachedTwoDVertices(
+    const ParticleFlowObject *const pPfo, const HitType hitType) const
+{
+    const PfoViewPair pfoViewPair(pPfo, hitType);
+    PfoViewToVertexVectorMap::const_iterator iter(m_vertexVectorMap.find(pfoViewPair));
+
+    if (m_vertexVectorMap.end() == iter)
+    {
+        CartesianPointVector vertexVector;
+        this->GetTwoDVertices(pPfo, hitType, vertexVector);
+        iter = m_vertexVectorMap.emplace(pfoViewPair, std::move(vertexVector)).first;
+    }
+
+    return iter->second;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const ClusterList &DeltaRayIdentificationAlgorithm::GetCachedClusters(const ParticleFlowObject *const pPfo, const HitType hitType) const
+{
+    const PfoViewPair pfoViewPair(pPfo, hitType);
+    PfoViewToClusterListMap::const_iterator iter(m_clusterListMap.find(pfoViewPair));
+
+    if (m_clusterListMap.end() == iter)
+    {
+        ClusterList clusterList;
+        LArPfoHelper::GetClusters(pPfo, hitType, clusterList);
+        iter = m_clusterListMap.emplace(pfoViewPair, std::move(clusterList)).first;
+    }
+
+    return iter->second;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void DeltaRayIdentificationAlgorithm::BuildParentDaughterLinks(const PfoAssociationMap &pfoAssociationMap, PfoList &daughterPfoList) const
 {
     PfoList pfoList;
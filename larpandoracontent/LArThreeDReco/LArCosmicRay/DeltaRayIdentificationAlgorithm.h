@@ -10,7 +10,9 @@
 
 #include "Pandora/Algorithm.h"
 
+#include <map>
 #include <unordered_map>
+#include <utility>
 
 namespace lar_content
 {
@@ -30,6 +32,10 @@ private:
     pandora::StatusCode Run();
 
     typedef std::unordered_map<const pandora::ParticleFlowObject *, const pandora::ParticleFlowObject *> PfoAssociationMap;
+    typedef std::unordered_map<const pandora::ParticleFlowObject *, float> PfoToFloatMap;
+    typedef std::pair<const pandora::ParticleFlowObject *, pandora::HitType> PfoViewPair;
+    typedef std::map<PfoViewPair, pandora::CartesianPointVector> PfoViewToVertexVectorMap;
+    typedef std::map<PfoViewPair, pandora::ClusterList> PfoViewToClusterListMap;
 
     /**
      *  @brief Get the vector of Pfos, given the input list name
@@ -59,6 +65,18 @@ private:
      */
     bool IsAssociated(const pandora::ParticleFlowObject *const pDaughterPfo, const pandora::ParticleFlowObject *const pParentPfo, float &displacement) const;
 
+    /**
+     *  @brief Determine whether the 2D separation between two Pfos must exceed a cut, using the cluster bounding boxes of the parent Pfo
+     *
+     *  @param pDaughterPfo the input daughter Pfo
+     *  @param pParentPfo the input parent Pfo
+     *  @param displacementCut the cut on the average displacement
+     *
+     *  @return boolean
+     */
+    bool IsBeyondTwoDSeparation(const pandora::ParticleFlowObject *const pDaughterPfo, const pandora::ParticleFlowObject *const pParentPfo,
+        const float displacementCut) const;
+
     /**
      *  @brief Calculate 2D separation between two Pfos
      *
@@ -86,6 +104,36 @@ private:
      */
     float GetClosestDistance(const pandora::CartesianPointVector &vertexVector, const pandora::ClusterList &clusterList) const;
 
+    /**
+     *  @brief Get the 2D length squared of a Pfo, calculated when first requested in the current run
+     *
+     *  @param pPfo the input Pfo
+     *
+     *  @return the 2D length squared
+     */
+    float GetCachedTwoDLengthSquared(const pandora::ParticleFlowObject *const pPfo) const;
+
+    /**
+     *  @brief Get the possible 2D vertex positions of a Pfo in a view, calculated when first requested in the current run
+     *
+     *  @param pPfo the input Pfo
+     *  @param hitType the hit type
+     *
+     *  @return the vector of possible vertex positions
+     */
+    const pandora::CartesianPointVector &GetCachedTwoDVertices(
+        const pandora::ParticleFlowObject *const pPfo, const pandora::HitType hitType) const;
+
+    /**
+     *  @brief Get the clusters of a Pfo in a view, collected when first requested in the current run
+     *
+     *  @param pPfo the input Pfo
+     *  @param hitType the hit type
+     *
+     *  @return the list of clusters
+     */
+    const pandora::ClusterList &GetCachedClusters(const pandora::ParticleFlowObject *const pPfo, const pandora::HitType hitType) const;
+
     /**
      *  @brief Build the parent/daughter links from the map of parent/daughter associations
      *
@@ -112,6 +160,10 @@ private:
     float m_distanceForMatching;      ///< Maximum allowed distance of delta ray from parent cosmic ray
     float m_minParentLengthSquared;   ///< Minimum allowed length of parent cosmic ray
     float m_maxDaughterLengthSquared; ///< Maximum allowed length of daughter delta ray
+
+    mutable PfoToFloatMap m_lengthSquaredMap;           ///< The 2D length squared of each Pfo, for the current run
+    mutable PfoViewToVertexVectorMap m_vertexVectorMap; ///< The possible 2D vertex positions of each Pfo in each view, for the current run
+    mutable PfoViewToClusterListMap m_clusterListMap;   ///< The clusters of each Pfo in each view, for the current run
 };
 
 } // namespace lar_content
@@ -48,9 +48,10 @@ StatusCode DeltaRayMatchingAlgorithm::Run()
     this->InitializeNearbyClusterMaps();
 
     ClusterLengthMap clusterLengthMap;
-    this->ThreeViewMatching(clusterLengthMap);
-    this->TwoViewMatching(clusterLengthMap);
-    this->OneViewMatching(clusterLengthMap);
+    ParentPfoCache parentPfoCache;
+    this->ThreeViewMatching(clusterLengthMap, parentPfoCache);
+    this->TwoViewMatching(clusterLengthMap, parentPfoCache);
+    this->OneViewMatching(clusterLengthMap, parentPfoCache);
 
     this->ClearNearbyClusterMaps();
 
@@ -96,6 +97,8 @@ void DeltaRayMatchingAlgorithm::InitializeNearbyClusterMap(const std::string &cl
     KDTreeBox hitsBoundingRegion2D(fill_and_bound_2d_kd_tree(allCaloHits, hitKDNode2DList));
     kdTree.build(hitKDNode2DList, hitsBoundingRegion2D);
 
+    HitKDNode2DList found;
+
     for (const Cluster *const pCluster : *pClusterList)
     {
         CaloHitList daughterHits;
@@ -105,7 +108,7 @@ void DeltaRayMatchingAlgorithm::InitializeNearbyClusterMap(const std::string &cl
         {
             KDTreeBox searchRegionHits = build_2d_kd_search_region(pCaloHit, m_searchRegion1D, m_searchRegion1D);
 
-            HitKDNode2DList found;
+            found.clear();
             kdTree.search(searchRegionHits, found);
 
             for (const auto &hit : found)
@@ -191,61 +194,95 @@ void DeltaRayMatchingAlgorithm::GetClusters(const std::string &inputClusterListN
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void DeltaRayMatchingAlgorithm::ThreeViewMatching(ClusterLengthMap &clusterLengthMap) const
+void DeltaRayMatchingAlgorithm::UpdateParentPfoCache(ParentPfoCache &parentPfoCache) const
+{
+    parentPfoCache.m_pfoVector.clear();
+    parentPfoCache.m_clusterToPfoIndicesMap.clear();
+
+    this->GetTrackPfos(m_parentPfoListName, parentPfoCache.m_pfoVector);
+    this->GetAllPfos(m_daughterPfoListName, parentPfoCache.m_pfoVector);
+
+    for (unsigned int pfoIndex = 0; pfoIndex < parentPfoCache.m_pfoVector.size(); ++pfoIndex)
+    {
+        ClusterList pfoClusterList;
+        LArPfoHelper::GetTwoDClusterList(parentPfoCache.m_pfoVector.at(pfoIndex), pfoClusterList);
+
+        for (const Cluster *const pPfoCluster : pfoClusterList)
+            parentPfoCache.m_clusterToPfoIndicesMap[pPfoCluster].push_back(pfoIndex);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void DeltaRayMatchingAlgorithm::InvalidateParentPfoCache(const ParticleList &particleList, ParentPfoCache &parentPfoCache) const
+{
+    for (const Particle &particle : particleList)
+    {
+        (void)parentPfoCache.m_pfoLengthMap.erase(particle.GetParentPfo());
+        (void)parentPfoCache.m_pfoToClusterDistanceMap.erase(particle.GetParentPfo());
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void DeltaRayMatchingAlgorithm::ThreeViewMatching(ClusterLengthMap &clusterLengthMap, ParentPfoCache &parentPfoCache) const
 {
     ClusterVector clustersU, clustersV, clustersW;
     this->GetClusters(m_inputClusterListNameU, clustersU);
     this->GetClusters(m_inputClusterListNameV, clustersV);
     this->GetClusters(m_inputClusterListNameW, clustersW);
+    this->UpdateParentPfoCache(parentPfoCache);
 
-    PfoLengthMap pfoLengthMap;
     ParticleList initialParticleList, finalParticleList;
-    this->ThreeViewMatching(clustersU, clustersV, clustersW, clusterLengthMap, pfoLengthMap, initialParticleList);
+    this->ThreeViewMatching(clustersU, clustersV, clustersW, clusterLengthMap, parentPfoCache, initialParticleList);
     this->SelectParticles(initialParticleList, clusterLengthMap, finalParticleList);
     this->CreateParticles(finalParticleList);
+    this->InvalidateParentPfoCache(finalParticleList, parentPfoCache);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void DeltaRayMatchingAlgorithm::TwoViewMatching(ClusterLengthMap &clusterLengthMap) const
+void DeltaRayMatchingAlgorithm::TwoViewMatching(ClusterLengthMap &clusterLengthMap, ParentPfoCache &parentPfoCache) const
 {
     ClusterVector clustersU, clustersV, clustersW;
     this->GetClusters(m_inputClusterListNameU, clustersU);
     this->GetClusters(m_inputClusterListNameV, clustersV);
     this->GetClusters(m_inputClusterListNameW, clustersW);
+    this->UpdateParentPfoCache(parentPfoCache);
 
-    PfoLengthMap pfoLengthMap;
     ParticleList initialParticleList, finalParticleList;
-    this->TwoViewMatching(clustersU, clustersV, clusterLengthMap, pfoLengthMap, initialParticleList);
-    this->TwoViewMatching(clustersV, clustersW, clusterLengthMap, pfoLengthMap, initialParticleList);
-    this->TwoViewMatching(clustersW, clustersU, clusterLengthMap, pfoLengthMap, initialParticleList);
+    this->TwoViewMatching(clustersU, clustersV, clusterLengthMap, parentPfoCache, initialParticleList);
+    this->TwoViewMatching(clustersV, clustersW, clusterLengthMap, parentPfoCache, initialParticleList);
+    this->TwoViewMatching(clustersW, clustersU, clusterLengthMap, parentPfoCache, initialParticleList);
     this->SelectParticles(initialParticleList, clusterLengthMap, finalParticleList);
     this->CreateParticles(finalParticleList);
+    this->InvalidateParentPfoCache(finalParticleList, parentPfoCache);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void DeltaRayMatchingAlgorithm::OneViewMatching(ClusterLengthMap &clusterLengthMap) const
+void DeltaRayMatchingAlgorithm::OneViewMatching(ClusterLengthMap &clusterLengthMap, ParentPfoCache &parentPfoCache) const
 {
     ClusterVector clustersU, clustersV, clustersW;
     this->GetClusters(m_inputClusterListNameU, clustersU);
     this->GetClusters(m_inputClusterListNameV, clustersV);
     this->GetClusters(m_inputClusterListNameW, clustersW);
+    this->UpdateParentPfoCache(parentPfoCache);
 
-    PfoLengthMap pfoLengthMap;
     ParticleList initialParticleList, finalParticleList;
-    this->ThreeViewMatching(clustersU, clustersV, clustersW, clusterLengthMap, pfoLengthMap, initialParticleList);
-    this->OneViewMatching(clustersU, clusterLengthMap, pfoLengthMap, initialParticleList);
-    this->OneViewMatching(clustersV, clusterLengthMap, pfoLengthMap, initialParticleList);
-    this->OneViewMatching(clustersW, clusterLengthMap, pfoLengthMap, initialParticleList);
+    this->ThreeViewMatching(clustersU, clustersV, clustersW, clusterLengthMap, parentPfoCache, initialParticleList);
+    this->OneViewMatching(clustersU, clusterLengthMap, parentPfoCache, initialParticleList);
+    this->OneViewMatching(clustersV, clusterLengthMap, parentPfoCache, initialParticleList);
+    this->OneViewMatching(clustersW, clusterLengthMap, parentPfoCache, initialParticleList);
     this->SelectParticles(initialParticleList, clusterLengthMap, finalParticleList);
     this->CreateParticles(finalParticleList);
+    this->InvalidateParentPfoCache(finalParticleList, parentPfoCache);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void DeltaRayMatchingAlgorithm::ThreeViewMatching(const ClusterVector &clusters1, const ClusterVector &clusters2,
-    const ClusterVector &clusters3, ClusterLengthMap &clusterLengthMap, PfoLengthMap &pfoLengthMap, ParticleList &particleList) const
+    const ClusterVector &clusters3, ClusterLengthMap &clusterLengthMap, ParentPfoCache &parentPfoCache, ParticleList &particleList) const
 {
     if (clusters1.empty() || clusters2.empty() || clusters3.empty())
         return;
@@ -269,7 +306,7 @@ void DeltaRayMatchingAlgorithm::ThreeViewMatching(const ClusterVector &clusters1
                     continue;
 
                 const ParticleFlowObject *pBestPfo = NULL;
-                this->FindBestParentPfo(pCluster1, pCluster2, pCluster3, clusterLengthMap, pfoLengthMap, pBestPfo);
+                this->FindBestParentPfo(pCluster1, pCluster2, pCluster3, clusterLengthMap, parentPfoCache, pBestPfo);
 
                 // ATTN Need to record all matches when all three views are used
                 particleList.push_back(Particle(pCluster1, pCluster2, pCluster3, pBestPfo));
@@ -281,7 +318,7 @@ void DeltaRayMatchingAlgorithm::ThreeViewMatching(const ClusterVector &clusters1
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void DeltaRayMatchingAlgorithm::TwoViewMatching(const ClusterVector &clusters1, const ClusterVector &clusters2,
-    ClusterLengthMap &clusterLengthMap, PfoLengthMap &pfoLengthMap, ParticleList &particleList) const
+    ClusterLengthMap &clusterLengthMap, ParentPfoCache &parentPfoCache, ParticleList &particleList) const
 {
     if (clusters1.empty() || clusters2.empty())
         return;
@@ -300,7 +337,7 @@ void DeltaRayMatchingAlgorithm::TwoViewMatching(const ClusterVector &clusters1,
                 continue;
 
             const ParticleFlowObject *pBestPfo = NULL;
-            this->FindBestParentPfo(pCluster1, pCluster2, NULL, clusterLengthMap, pfoLengthMap, pBestPfo);
+            this->FindBestParentPfo(pCluster1, pCluster2, NULL, clusterLengthMap, parentPfoCache, pBestPfo);
 
             if (NULL == pBestPfo)
                 continue;
@@ -313,7 +350,7 @@ void DeltaRayMatchingAlgorithm::TwoViewMatching(const ClusterVector &clusters1,
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void DeltaRayMatchingAlgorithm::OneViewMatching(
-    const ClusterVector &clusters, ClusterLengthMap &clusterLengthMap, PfoLengthMap &pfoLengthMap, ParticleList &particleList) const
+    const ClusterVector &clusters, ClusterLengthMap &clusterLengthMap, ParentPfoCache &parentPfoCache, ParticleList &particleList) const
 {
     if (clusters.empty())
         return;
@@ -324,7 +361,7 @@ void DeltaRayMatchingAlgorithm::OneViewMatching(
             continue;
 
         const ParticleFlowObject *pBestPfo = NULL;
-        this->FindBestParentPfo(pCluster, NULL, NULL, clusterLengthMap, pfoLengthMap, pBestPfo);
+        this->FindBestParentPfo(pCluster, NULL, NULL, clusterLengthMap, parentPfoCache, pBestPfo);
 
         if (NULL == pBestPfo)
             continue;
@@ -519,11 +556,10 @@ bool DeltaRayMatchingAlgorithm::AreClustersMatched(const Cluster *const pCluster
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void DeltaRayMatchingAlgorithm::FindBestParentPfo(const Cluster *const pCluster1, const Cluster *const pCluster2,
-    const Cluster *const pCluster3, ClusterLengthMap &clusterLengthMap, PfoLengthMap &pfoLengthMap, const ParticleFlowObject *&pBestPfo) const
+    const Cluster *const pCluster3, ClusterLengthMap &clusterLengthMap, ParentPfoCache &parentPfoCache,
+    const ParticleFlowObject *&pBestPfo) const
 {
-    PfoVector pfoVector;
-    this->GetTrackPfos(m_parentPfoListName, pfoVector);
-    this->GetAllPfos(m_daughterPfoListName, pfoVector);
+    const PfoVector &pfoVector(parentPfoCache.m_pfoVector);
 
     if (pfoVector.empty())
         throw StatusCodeException(STATUS_CODE_FAILURE);
@@ -551,9 +587,17 @@ void DeltaRayMatchingAlgorithm::FindBestParentPfo(const Cluster *const pCluster1
 
     float bestDistanceSquared(static_cast<float>(numViews) * m_distanceForMatching * m_distanceForMatching);
 
-    for (const ParticleFlowObject *const pPfo : pfoVector)
+    // ATTN Pfos without a cluster near to the first cluster are at the max distance, so cannot be selected
+    UIntVector pfoIndices;
+    this->GetNearbyParentPfoIndices(pCluster1 ? pCluster1 : pCluster2 ? pCluster2 : pCluster3, parentPfoCache, pfoIndices);
+
+    PfoToClusterDistanceMap &pfoToClusterDistanceMap(parentPfoCache.m_pfoToClusterDistanceMap);
+
+    for (const unsigned int pfoIndex : pfoIndices)
     {
-        if (lengthSquared > this->GetLengthFromCache(pPfo, pfoLengthMap))
+        const ParticleFlowObject *const pPfo(pfoVector.at(pfoIndex));
+
+        if (lengthSquared > this->GetLengthFromCache(pPfo, parentPfoCache.m_pfoLengthMap))
             continue;
 
         try
@@ -561,13 +605,13 @@ void DeltaRayMatchingAlgorithm::FindBestParentPfo(const Cluster *const pCluster1
             float distanceSquared(0.f);
 
             if (NULL != pCluster1)
-                distanceSquared += this->GetDistanceSquaredToPfo(pCluster1, pPfo);
+                distanceSquared += this->GetDistanceSquaredFromCache(pCluster1, pPfo, pfoToClusterDistanceMap);
 
             if (NULL != pCluster2)
-                distanceSquared += this->GetDistanceSquaredToPfo(pCluster2, pPfo);
+                distanceSquared += this->GetDistanceSquaredFromCache(pCluster2, pPfo, pfoToClusterDistanceMap);
 
             if (NULL != pCluster3)
-                distanceSquared += this->GetDistanceSquaredToPfo(pCluster3, pPfo);
+                distanceSquared += this->GetDistanceSquaredFromCache(pCluster3, pPfo, pfoToClusterDistanceMap);
 
             if (distanceSquared < bestDistanceSquared)
             {
@@ -585,6 +629,32 @@ void DeltaRayMatchingAlgorithm::FindBestParentPfo(const Cluster *const pCluster1
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void DeltaRayMatchingAlgorithm::GetNearbyParentPfoIndices(
+    const Cluster *const pCluster, const ParentPfoCache &parentPfoCache, UIntVector &pfoIndices) const
+{
+    const HitType hitType(LArClusterHelper::GetClusterHitType(pCluster));
+    const ClusterToClustersMap &nearbyClusters(
+        (TPC_VIEW_U == hitType) ? m_nearbyClustersU : (TPC_VIEW_V == hitType) ? m_nearbyClustersV : m_nearbyClustersW);
+    const ClusterToClustersMap::const_iterator nearbyIter(nearbyClusters.find(pCluster));
+
+    if (nearbyClusters.end() == nearbyIter)
+        return;
+
+    for (const Cluster *const pNearbyCluster : nearbyIter->second)
+    {
+        const ClusterToPfoIndicesMap::const_iterator pfoIter(parentPfoCache.m_clusterToPfoIndicesMap.find(pNearbyCluster));
+
+        if (parentPfoCache.m_clusterToPfoIndicesMap.end() != pfoIter)
+            pfoIndices.insert(pfoIndices.end(), pfoIter->second.begin(), pfoIter->second.end());
+    }
+
+    // ATTN Consider the pfos in their original order, so that ties are resolved as for a search over all pfos
+    std::sort(pfoIndices.begin(), pfoIndices.end());
+    pfoIndices.erase(std::unique(pfoIndices.begin(), pfoIndices.end()), pfoIndices.end());
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 float DeltaRayMatchingAlgorithm::GetLengthFromCache(const Cluster *const pCluster, ClusterLengthMap &clusterLengthMap) const
 {
     ClusterLengthMap::const_iterator iter = clusterLengthMap.find(pCluster);
@@ -666,6 +736,22 @@ float DeltaRayMatchingAlgorithm::GetDistanceSquaredToPfo(const Cluster *const pC
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+float DeltaRayMatchingAlgorithm::GetDistanceSquaredFromCache(
+    const Cluster *const pCluster, const ParticleFlowObject *const pPfo, PfoToClusterDistanceMap &pfoToClusterDistanceMap) const
+{
+    ClusterDistanceMap &clusterDistanceMap(pfoToClusterDistanceMap[pPfo]);
+    ClusterDistanceMap::const_iterator iter = clusterDistanceMap.find(pCluster);
+
+    if (clusterDistanceMap.end() != iter)
+        return iter->second;
+
+    const float distanceSquared(this->GetDistanceSquaredToPfo(pCluster, pPfo));
+    (void)clusterDistanceMap.insert(ClusterDistanceMap::value_type(pCluster, distanceSquared));
+    return distanceSquared;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void DeltaRayMatchingAlgorithm::CreateDaughterPfo(const ClusterList &clusterList, const ParticleFlowObject *const pParentPfo) const
 {
     const PfoList *pPfoList = NULL;
@@ -144,27 +144,60 @@ private:
 
     typedef std::unordered_map<const pandora::Cluster *, float> ClusterLengthMap;
     typedef std::unordered_map<const pandora::ParticleFlowObject *, float> PfoLengthMap;
+    typedef std::unordered_map<const pandora::Cluster *, float> ClusterDistanceMap;
+    typedef std::unordered_map<const pandora::ParticleFlowObject *, ClusterDistanceMap> PfoToClusterDistanceMap;
+    typedef std::unordered_map<const pandora::Cluster *, pandora::UIntVector> ClusterToPfoIndicesMap;
+
+    /**
+     *  @brief  ParentPfoCache class, describing the candidate parent pfos and caching their properties across the matching passes
+     */
+    class ParentPfoCache
+    {
+    public:
+        pandora::PfoVector m_pfoVector;                    ///< The candidate parent pfos for the current matching pass, in preference order
+        ClusterToPfoIndicesMap m_clusterToPfoIndicesMap;   ///< The indices of the candidate parent pfos containing each 2D cluster
+        PfoLengthMap m_pfoLengthMap;                       ///< The pfo length map, retained across the matching passes
+        PfoToClusterDistanceMap m_pfoToClusterDistanceMap; ///< The cluster distances to each pfo, retained across the matching passes
+    };
+
+    /**
+     *  @brief  Collect the candidate parent pfos for a matching pass, preserving any cached pfo properties
+     *
+     *  @param  parentPfoCache the parent pfo cache
+     */
+    void UpdateParentPfoCache(ParentPfoCache &parentPfoCache) const;
+
+    /**
+     *  @brief  Remove the cached properties of pfos that have received daughter clusters
+     *
+     *  @param  particleList the list of particles used to create daughters
+     *  @param  parentPfoCache the parent pfo cache
+     */
+    void InvalidateParentPfoCache(const ParticleList &particleList, ParentPfoCache &parentPfoCache) const;
 
     /**
      *  @brief  Match clusters using all three views
      *
      *  @param  clusterLengthMap the cluster length map
+     *  @param  parentPfoCache the parent pfo cache
      */
-    void ThreeViewMatching(ClusterLengthMap &clusterLengthMap) const;
+    void ThreeViewMatching(ClusterLengthMap &clusterLengthMap, ParentPfoCache &parentPfoCache) const;
 
     /**
      *  @brief  Match clusters using pairs of views
      *
      *  @param  clusterLengthMap the cluster length map
+     *  @param  parentPfoCache the parent pfo cache
      */
-    void TwoViewMatching(ClusterLengthMap &clusterLengthMap) const;
+    void TwoViewMatching(ClusterLengthMap &clusterLengthMap, ParentPfoCache &parentPfoCache) const;
 
     /**
      *  @brief  Match clusters using single views
      *
      *  @param  clusterLengthMap the cluster length map
+     *  @param  parentPfoCache the parent pfo cache
      */
-    void OneViewMatching(ClusterLengthMap &clusterLengthMap) const;
+    void OneViewMatching(ClusterLengthMap &clusterLengthMap, ParentPfoCache &parentPfoCache) const;
 
     /**
      *  @brief  Match clusters using all three views
@@ -173,11 +206,12 @@ private:
      *  @param  clusters2 the list of clusters in the second view
      *  @param  clusters3 the list of clusters in the third view
      *  @param  clusterLengthMap the cluster length map
-     *  @param  pfoLengthMap the pfo length map
+     *  @param  parentPfoCache the parent pfo cache
      *  @param  particleList the output list of particles
      */
     void ThreeViewMatching(const pandora::ClusterVector &clusters1, const pandora::ClusterVector &clusters2,
-        const pandora::ClusterVector &clusters3, ClusterLengthMap &clusterLengthMap, PfoLengthMap &pfoLengthMap, ParticleList &particleList) const;
+        const pandora::ClusterVector &clusters3, ClusterLengthMap &clusterLengthMap, ParentPfoCache &parentPfoCache,
+        ParticleList &particleList) const;
 
     /**
      *  @brief  Match clusters using a pair of views
@@ -185,21 +219,21 @@ private:
      *  @param  clusters1 the list of clusters in the first view
      *  @param  clusters2 the list of clusters in the second view
      *  @param  clusterLengthMap the cluster length map
-     *  @param  pfoLengthMap the pfo length map
+     *  @param  parentPfoCache the parent pfo cache
      *  @param  particleList the output list of particles
      */
     void TwoViewMatching(const pandora::ClusterVector &clusters1, const pandora::ClusterVector &clusters2,
-        ClusterLengthMap &clusterLengthMap, PfoLengthMap &pfoLengthMap, ParticleList &particleList) const;
+        ClusterLengthMap &clusterLengthMap, ParentPfoCache &parentPfoCache, ParticleList &particleList) const;
 
     /**
      *  @brief  Match clusters using a single view
      *
      *  @param  clusters the list of clusters in the provided view
      *  @param  clusterLengthMap the cluster length map
-     *  @param  pfoLengthMap the pfo length map
+     *  @param  parentPfoCache the parent pfo cache
      *  @param  particleList the output list of particles
      */
-    void OneViewMatching(const pandora::ClusterVector &clusters, ClusterLengthMap &clusterLengthMap, PfoLengthMap &pfoLengthMap,
+    void OneViewMatching(const pandora::ClusterVector &clusters, ClusterLengthMap &clusterLengthMap, ParentPfoCache &parentPfoCache,
         ParticleList &particleList) const;
 
     /**
@@ -225,11 +259,22 @@ private:
      *  @param  pClusterV pointer to V view cluster
      *  @param  pClusterW pointer to W view cluster
      *  @param  clusterLengthMap the cluster length map
-     *  @param  pfoLengthMap the pfo length map
+     *  @param  parentPfoCache the parent pfo cache
      *  @param  pBestPfo to receive the address of the best Pfo
      */
     void FindBestParentPfo(const pandora::Cluster *const pClusterU, const pandora::Cluster *const pClusterV, const pandora::Cluster *const pClusterW,
-        ClusterLengthMap &clusterLengthMap, PfoLengthMap &pfoLengthMap, const pandora::ParticleFlowObject *&pBestPfo) const;
+        ClusterLengthMap &clusterLengthMap, ParentPfoCache &parentPfoCache, const pandora::ParticleFlowObject *&pBestPfo) const;
+
+    /**
+     *  @brief  Get the indices of the candidate parent pfos with a cluster near to a given cluster, in order of preference. Only these
+     *          pfos can be within the matching distance of the cluster.
+     *
+     *  @param  pCluster the cluster
+     *  @param  parentPfoCache the parent pfo cache
+     *  @param  pfoIndices to receive the indices of the nearby candidate parent pfos
+     */
+    void GetNearbyParentPfoIndices(
+        const pandora::Cluster *const pCluster, const ParentPfoCache &parentPfoCache, pandora::UIntVector &pfoIndices) const;
 
     /**
      *  @brief  Reduce number of length (squared) calculations by caching results when they are first obtained
@@ -278,6 +323,18 @@ private:
      */
     float GetDistanceSquaredToPfo(const pandora::Cluster *const pCluster, const pandora::ParticleFlowObject *const pPfo) const;
 
+    /**
+     *  @brief  Reduce number of cluster to pfo distance calculations by caching results when they are first obtained
+     *
+     *  @param  pCluster the cluster
+     *  @param  pPfo the pfo
+     *  @param  pfoToClusterDistanceMap the cluster distances to each pfo
+     *
+     *  @return the distance between the cluster and the pfo
+     */
+    float GetDistanceSquaredFromCache(const pandora::Cluster *const pCluster, const pandora::ParticleFlowObject *const pPfo,
+        PfoToClusterDistanceMap &pfoToClusterDistanceMap) const;
+
     /**
      *  @brief  Create a new Pfo from an input cluster list and set up a parent/daughter relationship
      *
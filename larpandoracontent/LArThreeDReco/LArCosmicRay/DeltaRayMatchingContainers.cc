@@ -90,9 +90,9 @@ void DeltaRayMatchingContainers::BuildKDTree(const HitType hitType)
         allCaloHits.push_back(entry.first);
 
     HitKDNode2DList hitKDNode2DList;
-    KDTreeBox hitsBoundingRegion2D(fill_and_bound_2d_kd_tree(allCaloHits, hitKDNode2DList));
+    (void)fill_and_bound_2d_kd_tree(allCaloHits, hitKDNode2DList);
 
-    kdTree.build(hitKDNode2DList, hitsBoundingRegion2D);
+    kdTree.build(hitKDNode2DList);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -108,11 +108,13 @@ void DeltaRayMatchingContainers::AddToClusterProximityMap(const Cluster *const p
     CaloHitList caloHitList;
     pCluster->GetOrderedCaloHitList().FillCaloHitList(caloHitList);
 
+    HitKDNode2DList found;
+
     for (const CaloHit *const pCaloHit : caloHitList)
     {
-        HitKDNode2DList found;
         KDTreeBox searchRegionHits(build_2d_kd_search_region(pCaloHit, m_searchRegion1D, m_searchRegion1D));
 
+        found.clear();
         kdTree.search(searchRegionHits, found);
 
         for (const auto &hit : found)
@@ -169,8 +171,19 @@ void DeltaRayMatchingContainers::AddClustersToPfoMaps(const ParticleFlowObject *
 void DeltaRayMatchingContainers::AddClustersToContainers(const ClusterVector &newClusterVector, const PfoVector &pfoVector)
 {
     for (const Cluster *const pNewCluster : newClusterVector)
+    {
         this->AddToClusterMap(pNewCluster);
 
+        const HitType hitType(LArClusterHelper::GetClusterHitType(pNewCluster));
+        HitKDTree2D &kdTree((hitType == TPC_VIEW_U) ? m_kdTreeU : (hitType == TPC_VIEW_V) ? m_kdTreeV : m_kdTreeW);
+
+        CaloHitList caloHitList;
+        pNewCluster->GetOrderedCaloHitList().FillCaloHitList(caloHitList);
+
+        for (const CaloHit *const pCaloHit : caloHitList)
+            (void)kdTree.insert(HitKDNode2D(pCaloHit, pCaloHit->GetPositionVector().GetX(), pCaloHit->GetPositionVector().GetZ()));
+    }
+
     for (unsigned int i = 0; i < newClusterVector.size(); i++)
     {
         const Cluster *const pNewCluster(newClusterVector.at(i));
@@ -192,6 +205,7 @@ void DeltaRayMatchingContainers::RemoveClusterFromContainers(const Cluster *cons
     ClusterProximityMap &clusterProximityMap(
         (hitType == TPC_VIEW_U) ? m_clusterProximityMapU : (hitType == TPC_VIEW_V) ? m_clusterProximityMapV : m_clusterProximityMapW);
     ClusterToPfoMap &clusterToPfoMap((hitType == TPC_VIEW_U) ? m_clusterToPfoMapU : (hitType == TPC_VIEW_V) ? m_clusterToPfoMapV : m_clusterToPfoMapW);
+    HitKDTree2D &kdTree((hitType == TPC_VIEW_U) ? m_kdTreeU : (hitType == TPC_VIEW_V) ? m_kdTreeV : m_kdTreeW);
 
     CaloHitList caloHitList;
     pDeletedCluster->GetOrderedCaloHitList().FillCaloHitList(caloHitList);
@@ -204,6 +218,7 @@ void DeltaRayMatchingContainers::RemoveClusterFromContainers(const Cluster *cons
             throw StatusCodeException(STATUS_CODE_FAILURE);
 
         hitToClusterMap.erase(iter);
+        (void)kdTree.remove(pCaloHit);
     }
 
     const ClusterProximityMap::const_iterator clusterProximityIter(clusterProximityMap.find(pDeletedCluster));
@@ -10,7 +10,7 @@
 
 #include "Pandora/PandoraInternal.h"
 
-#include "larpandoracontent/LArUtility/KDTreeLinkerAlgoT.h"
+#include "larpandoracontent/LArUtility/KDTreeDynamicAlgoT.h"
 
 namespace lar_content
 {
@@ -63,7 +63,8 @@ public:
     void AddClustersToPfoMaps(const pandora::ParticleFlowObject *const pPfo);
 
     /**
-     *  @brief  Add a list of clusters to the hit to cluster and cluster proximity maps and, if appropriate, to the cluster to pfo map
+     *  @brief  Add a list of clusters to the hit to cluster and cluster proximity maps and KD trees and, if appropriate, to the cluster to
+     *          pfo map
      *
      *  @param  newClusterVector the ordered cluster vector
      *  @param  pfoVector the matching ordered vector of pfos to which the clusters belong (nullptr if not applicable)
@@ -71,7 +72,8 @@ public:
     void AddClustersToContainers(const pandora::ClusterVector &newClusterVector, const pandora::PfoVector &pfoVector);
 
     /**
-     *  @brief  Remove an input cluster's hits from the hit to cluster and cluster proximity maps and, if appropriate, from the cluster to pfo map
+     *  @brief  Remove an input cluster's hits from the hit to cluster and cluster proximity maps and KD trees and, if appropriate, from the
+     *          cluster to pfo map
      *
      *  @param  pDeletedCluster the input cluster
      */
@@ -86,7 +88,7 @@ public:
 
 private:
     typedef std::map<const pandora::CaloHit *, const pandora::Cluster *> HitToClusterMap;
-    typedef KDTreeLinkerAlgo<const pandora::CaloHit *, 2> HitKDTree2D;
+    typedef KDTreeDynamicAlgo<const pandora::CaloHit *, 2> HitKDTree2D;
     typedef KDTreeNodeInfoT<const pandora::CaloHit *, 2> HitKDNode2D;
     typedef std::vector<HitKDNode2D> HitKDNode2DList;
 
@@ -39,7 +39,9 @@ NViewDeltaRayMatchingAlgorithm<T>::NViewDeltaRayMatchingAlgorithm() :
     m_maxCosmicRayHitFraction(0.05f),
     m_maxDistanceToCluster(0.5f),
     m_maxDistanceToReferencePoint(5.f),
-    m_strayClusterSeparation(2.f)
+    m_strayClusterSeparation(2.f),
+    m_recordModifiedClusters(false),
+    m_nMuonClusterModifications(0)
 {
 }
 
@@ -116,12 +118,23 @@ StatusCode NViewDeltaRayMatchingAlgorithm<T>::GetMuonCluster(const PfoList &comm
 
 template <typename T>
 void NViewDeltaRayMatchingAlgorithm<T>::GetNearbyMuonPfos(const Cluster *const pCluster, ClusterList &consideredClusters, PfoList &nearbyMuonPfos) const
+{
+    ClusterSet consideredClusterSet(consideredClusters.begin(), consideredClusters.end());
+    this->GetNearbyMuonPfos(pCluster, consideredClusters, consideredClusterSet, nearbyMuonPfos);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+void NViewDeltaRayMatchingAlgorithm<T>::GetNearbyMuonPfos(
+    const Cluster *const pCluster, ClusterList &consideredClusters, ClusterSet &consideredClusterSet, PfoList &nearbyMuonPfos) const
 {
     const HitType hitType(LArClusterHelper::GetClusterHitType(pCluster));
     const DeltaRayMatchingContainers::ClusterToPfoMap &clusterToPfoMap(m_deltaRayMatchingContainers.GetClusterToPfoMap(hitType));
     const DeltaRayMatchingContainers::ClusterProximityMap &clusterProximityMap(m_deltaRayMatchingContainers.GetClusterProximityMap(hitType));
 
     consideredClusters.push_back(pCluster);
+    consideredClusterSet.insert(pCluster);
 
     const DeltaRayMatchingContainers::ClusterProximityMap::const_iterator clusterProximityIter(clusterProximityMap.find(pCluster));
 
@@ -130,7 +143,7 @@ void NViewDeltaRayMatchingAlgorithm<T>::GetNearbyMuonPfos(const Cluster *const p
 
     for (const Cluster *const pNearbyCluster : clusterProximityIter->second)
     {
-        if (std::find(consideredClusters.begin(), consideredClusters.end(), pNearbyCluster) != consideredClusters.end())
+        if (consideredClusterSet.count(pNearbyCluster))
             continue;
 
         const DeltaRayMatchingContainers::ClusterToPfoMap::const_iterator pfoIter(clusterToPfoMap.find(pNearbyCluster));
@@ -143,7 +156,7 @@ void NViewDeltaRayMatchingAlgorithm<T>::GetNearbyMuonPfos(const Cluster *const p
             continue;
         }
 
-        this->GetNearbyMuonPfos(pNearbyCluster, consideredClusters, nearbyMuonPfos);
+        this->GetNearbyMuonPfos(pNearbyCluster, consideredClusters, consideredClusterSet, nearbyMuonPfos);
     }
 }
 
@@ -462,7 +475,29 @@ StatusCode NViewDeltaRayMatchingAlgorithm<T>::ProjectMuonPositions(
     if ((muonClusterList1.size() != 1) || (muonClusterList2.size() != 1))
         return STATUS_CODE_NOT_FOUND;
 
-    return (this->GetProjectedPositions(muonClusterList1.front(), muonClusterList2.front(), projectedPositions));
+    const Cluster *const pMuonCluster1(muonClusterList1.front()), *const pMuonCluster2(muonClusterList2.front());
+
+    // ATTN The projection threshold counts any positions already present, so only projections made from scratch are cached
+    if (!projectedPositions.empty())
+        return (this->GetProjectedPositions(pMuonCluster1, pMuonCluster2, projectedPositions));
+
+    const MuonProjectionKey muonProjectionKey(pParentMuon, thirdViewHitType);
+    typename MuonProjectionMap::iterator iter(m_muonProjectionMap.find(muonProjectionKey));
+
+    if ((m_muonProjectionMap.end() == iter) || !iter->second.IsValid(pMuonCluster1, pMuonCluster2))
+    {
+        MuonProjection muonProjection(pMuonCluster1, pMuonCluster2);
+        muonProjection.m_statusCode = this->GetProjectedPositions(pMuonCluster1, pMuonCluster2, muonProjection.m_projectedPositions);
+
+        if (m_muonProjectionMap.end() != iter)
+            m_muonProjectionMap.erase(iter);
+
+        iter = m_muonProjectionMap.insert(typename MuonProjectionMap::value_type(muonProjectionKey, muonProjection)).first;
+    }
+
+    projectedPositions = iter->second.m_projectedPositions;
+
+    return iter->second.m_statusCode;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -665,7 +700,8 @@ StatusCode NViewDeltaRayMatchingAlgorithm<T>::ParameteriseMuon(const ParticleFlo
 
     const Cluster *const pMuonCluster(muonClusterList.front());
     const float slidingFitPitch(LArGeometryHelper::GetWireZPitch(this->GetPandora()));
-    const TwoDSlidingFitResult slidingFitResult(pMuonCluster, 40, slidingFitPitch);
+    const TwoDSlidingFitResult &slidingFitResult(
+        LArSlidingFitCacheHelper::GetSlidingFitResult(this->GetPandora(), pMuonCluster, 40, slidingFitPitch));
 
     CartesianVector deltaRayVertex(0.f, 0.f, 0.f), muonVertex(0.f, 0.f, 0.f);
     LArMuonLeadingHelper::GetClosestPositions(deltaRayProjectedPositions, pMuonCluster, deltaRayVertex, muonVertex);
@@ -771,6 +807,13 @@ bool NViewDeltaRayMatchingAlgorithm<T>::CreatePfos(ProtoParticleVector &protoPar
         }
     }
 
+    // ATTN Particle creation changes the availability of the clusters used
+    for (const ProtoParticle &protoParticle : protoParticleVector)
+    {
+        for (const Cluster *const pCluster : protoParticle.m_clusterList)
+            this->RecordModifiedCluster(pCluster);
+    }
+
     return (this->CreateThreeDParticles(protoParticleVector));
 }
 
@@ -841,6 +884,19 @@ void NViewDeltaRayMatchingAlgorithm<T>::UpdateUponDeletion(const Cluster *const
     const DeltaRayMatchingContainers::ClusterToPfoMap &clusterToPfoMap(m_deltaRayMatchingContainers.GetClusterToPfoMap(hitType));
     const bool isMuonCluster(clusterToPfoMap.find(pDeletedCluster) != clusterToPfoMap.end());
 
+    if (isMuonCluster)
+    {
+        this->RecordModifiedMuonCluster();
+    }
+    else if (m_recordModifiedClusters)
+    {
+        // ATTN Removing a cluster can disconnect, or remove, other clusters in its group, so record the whole group before the removal
+        ClusterSet connectedClusters;
+        this->GetConnectedClusters(ClusterSet({pDeletedCluster}), connectedClusters);
+        m_modifiedClusters.insert(m_modifiedClusters.end(), connectedClusters.begin(), connectedClusters.end());
+        this->RecordModifiedCluster(pDeletedCluster);
+    }
+
     m_deltaRayMatchingContainers.RemoveClusterFromContainers(pDeletedCluster);
 
     if (!isMuonCluster)
@@ -861,12 +917,37 @@ void NViewDeltaRayMatchingAlgorithm<T>::UpdateForNewClusters(const ClusterVector
 
         // ATTN: Only add delta ray clusters into the tensor
         if (!pMuonPfo)
+        {
+            this->RecordModifiedCluster(pNewCluster);
             NViewMatchingAlgorithm<T>::UpdateForNewCluster(pNewCluster);
+        }
+        else
+        {
+            this->RecordModifiedMuonCluster();
+        }
     }
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+template <typename T>
+void NViewDeltaRayMatchingAlgorithm<T>::RecordModifiedCluster(const Cluster *const pCluster)
+{
+    if (m_recordModifiedClusters)
+        m_modifiedClusters.push_back(pCluster);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+void NViewDeltaRayMatchingAlgorithm<T>::RecordModifiedMuonCluster()
+{
+    if (m_recordModifiedClusters)
+        ++m_nMuonClusterModifications;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template <typename T>
 void NViewDeltaRayMatchingAlgorithm<T>::TidyUp()
 {
@@ -875,10 +956,39 @@ void NViewDeltaRayMatchingAlgorithm<T>::TidyUp()
     m_strayClusterListU.clear();
     m_strayClusterListV.clear();
     m_strayClusterListW.clear();
+    m_muonProjectionMap.clear();
+    m_recordModifiedClusters = false;
+    m_modifiedClusters.clear();
+    m_nMuonClusterModifications = 0;
 
     return NViewMatchingAlgorithm<T>::TidyUp();
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+NViewDeltaRayMatchingAlgorithm<T>::MuonProjection::MuonProjection(const Cluster *const pCluster1, const Cluster *const pCluster2) :
+    m_pCluster1(pCluster1),
+    m_pCluster2(pCluster2),
+    m_clusterState1(pCluster1),
+    m_clusterState2(pCluster2),
+    m_statusCode(STATUS_CODE_NOT_FOUND)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+bool NViewDeltaRayMatchingAlgorithm<T>::MuonProjection::IsValid(const Cluster *const pCluster1, const Cluster *const pCluster2) const
+{
+    if ((pCluster1 != m_pCluster1) || (pCluster2 != m_pCluster2))
+        return false;
+
+    return ((LArSlidingFitCacheHelper::ClusterState(pCluster1) == m_clusterState1) &&
+        (LArSlidingFitCacheHelper::ClusterState(pCluster2) == m_clusterState2));
+}
+
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 template <typename T>
@@ -8,6 +8,8 @@
 #ifndef LAR_N_VIEW_DELTA_RAY_MATCHING_ALGORITHM_H
 #define LAR_N_VIEW_DELTA_RAY_MATCHING_ALGORITHM_H 1
 
+#include "larpandoracontent/LArHelpers/LArSlidingFitCacheHelper.h"
+
 #include "larpandoracontent/LArThreeDReco/LArThreeDBase/NViewMatchingAlgorithm.h"
 
 #include "larpandoracontent/LArThreeDReco/LArCosmicRay/DeltaRayMatchingContainers.h"
@@ -251,6 +253,18 @@ protected:
      */
     void GetNearbyMuonPfos(const pandora::Cluster *const pCluster, pandora::ClusterList &consideredClusters, pandora::PfoList &nearbyMuonPfos) const;
 
+    /**
+     *  @brief  Travel along paths of nearby clusters finding the cosmic ray clusters on which they terminate, tracking investigated
+     *          clusters in a set for fast lookup
+     *
+     *  @param  pCluster the address of the input cluster
+     *  @param  consideredClusters the list of investigated clusters
+     *  @param  consideredClusterSet the set of investigated clusters, matching the list
+     *  @param  nearbyMuonPfos the output list of the cosmic ray pfos to which the nearby cosmic ray clusters belong
+     */
+    void GetNearbyMuonPfos(const pandora::Cluster *const pCluster, pandora::ClusterList &consideredClusters,
+        pandora::ClusterSet &consideredClusterSet, pandora::PfoList &nearbyMuonPfos) const;
+
     /**
      *  @brief  Calculate the xSpan of a list of CaloHits
      *
@@ -290,9 +304,65 @@ protected:
      */
     void AddInStrayClusters(const pandora::Cluster *const pClusterToEnlarge, const pandora::ClusterList &collectedClusters);
 
+    /**
+     *  @brief  Get the clusters connected, within the matching container (tensor/matrix), to any of a set of seed clusters
+     *
+     *  @param  seedClusters the set of seed clusters, which are not dereferenced so may include deleted clusters
+     *  @param  connectedClusters to receive the connected clusters, including the seed clusters present in the container
+     */
+    virtual void GetConnectedClusters(const pandora::ClusterSet &seedClusters, pandora::ClusterSet &connectedClusters) const = 0;
+
+    /**
+     *  @brief  Record a modified delta ray cluster, if examining the overlap container
+     *
+     *  @param  pCluster address of the modified cluster
+     */
+    void RecordModifiedCluster(const pandora::Cluster *const pCluster);
+
+    /**
+     *  @brief  Record the modification of a cosmic ray cluster, if examining the overlap container. As any element sharing the cosmic ray
+     *          pfo may be affected, this invalidates every group of connected clusters
+     */
+    void RecordModifiedMuonCluster();
+
     void TidyUp();
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
+    /**
+     *  @brief  MuonProjection class, the projection of two views of a cosmic ray pfo into the third view
+     */
+    class MuonProjection
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  pCluster1 the address of the cosmic ray cluster in the first view
+         *  @param  pCluster2 the address of the cosmic ray cluster in the second view
+         */
+        MuonProjection(const pandora::Cluster *const pCluster1, const pandora::Cluster *const pCluster2);
+
+        /**
+         *  @brief  Whether the projection remains valid for the current cosmic ray clusters
+         *
+         *  @param  pCluster1 the address of the cosmic ray cluster in the first view
+         *  @param  pCluster2 the address of the cosmic ray cluster in the second view
+         *
+         *  @return boolean
+         */
+        bool IsValid(const pandora::Cluster *const pCluster1, const pandora::Cluster *const pCluster2) const;
+
+        const pandora::Cluster *m_pCluster1;                    ///< The address of the cosmic ray cluster in the first view
+        const pandora::Cluster *m_pCluster2;                    ///< The address of the cosmic ray cluster in the second view
+        LArSlidingFitCacheHelper::ClusterState m_clusterState1; ///< The state of the first cluster when the projection was made
+        LArSlidingFitCacheHelper::ClusterState m_clusterState2; ///< The state of the second cluster when the projection was made
+        pandora::StatusCode m_statusCode;                       ///< The status code returned by the projection
+        pandora::CartesianPointVector m_projectedPositions;     ///< The projected positions
+    };
+
+    typedef std::pair<const pandora::ParticleFlowObject *, pandora::HitType> MuonProjectionKey;
+    typedef std::map<MuonProjectionKey, MuonProjection> MuonProjectionMap;
+
     std::string m_muonPfoListName;                           ///< The list of reconstructed cosmic ray pfos
     pandora::ClusterList m_strayClusterListU;                ///< The list of U clusters that do not pass the tensor threshold requirement
     pandora::ClusterList m_strayClusterListV;                ///< The list of V clusters that do not pass the tensor threshold requirement
@@ -307,6 +377,10 @@ protected:
     float m_maxDistanceToCluster; ///< the maximum distance of a projected point to the cosmic ray cluster used when parameterising the cosmic ray cluster
     float m_maxDistanceToReferencePoint; ///< the maximum distance of a projected point to the cosmic ray vertex used when parameterising the cosmic ray cluster
     float m_strayClusterSeparation; ///< The maximum allowed separation of a stray cluster and a delta ray cluster for merge
+    mutable MuonProjectionMap m_muonProjectionMap; ///< The cached cosmic ray projections, by cosmic ray pfo and projected view
+    bool m_recordModifiedClusters;                 ///< Whether to record modified clusters, whilst examining the overlap container
+    pandora::ClusterVector m_modifiedClusters;     ///< The modified delta ray clusters, in order of modification, some since deleted
+    unsigned int m_nMuonClusterModifications;      ///< The number of cosmic ray cluster modifications, whilst examining the container
 };
 
 } // namespace lar_content
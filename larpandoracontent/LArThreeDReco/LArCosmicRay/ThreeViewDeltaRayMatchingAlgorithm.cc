@@ -105,22 +105,22 @@ void ThreeViewDeltaRayMatchingAlgorithm::FindCommonMuonParents(
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void ThreeViewDeltaRayMatchingAlgorithm::ExamineOverlapContainer()
+void ThreeViewDeltaRayMatchingAlgorithm::GetConnectedClusters(const ClusterSet &seedClusters, ClusterSet &connectedClusters) const
 {
-    // Apply tools sequentially restarting if a change is made and ending if the tools finish or the restart limit is reached
-    unsigned int repeatCounter(0);
+    this->GetMatchingControl().GetOverlapTensor().GetConnectedClusters(seedClusters, connectedClusters);
+}
 
-    for (auto toolIter = m_algorithmToolVector.begin(); toolIter != m_algorithmToolVector.end();)
-    {
-        DeltaRayTensorTool *const pTool(*toolIter);
-        const bool repeatTools(pTool->Run(this, this->GetMatchingControl().GetOverlapTensor()));
+//------------------------------------------------------------------------------------------------------------------------------------------
 
-        toolIter = repeatTools ? m_algorithmToolVector.begin() : toolIter + 1;
-        repeatCounter = repeatTools ? repeatCounter + 1 : repeatCounter;
+void ThreeViewDeltaRayMatchingAlgorithm::ExamineOverlapContainer()
+{
+    m_modifiedClusters.clear();
+    m_nMuonClusterModifications = 0;
+    m_recordModifiedClusters = true;
 
-        if (repeatCounter > m_nMaxTensorToolRepeats)
-            break;
-    }
+    // ATTN A cosmic ray cluster modification can affect any element sharing that pfo, so is a global modification
+    this->RunToolsOverModifiedGroups(this, m_algorithmToolVector, this->GetMatchingControl().GetOverlapTensor(), m_modifiedClusters,
+        m_nMuonClusterModifications, m_nMaxTensorToolRepeats, false);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -48,6 +48,7 @@ private:
     typedef std::vector<DeltaRayTensorTool *> TensorToolVector;
 
     void CalculateOverlapResult(const pandora::Cluster *const pClusterU, const pandora::Cluster *const pClusterV, const pandora::Cluster *const pClusterW);
+    void GetConnectedClusters(const pandora::ClusterSet &seedClusters, pandora::ClusterSet &connectedClusters) const;
     void ExamineOverlapContainer();
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
@@ -111,6 +112,14 @@ public:
      */
     virtual bool Run(ThreeViewDeltaRayMatchingAlgorithm *const pAlgorithm, TensorType &overlapTensor) = 0;
 
+    /**
+     *  @brief  Whether the tool examines each group of connected clusters independently, using only the elements of the group and the
+     *          clusters and cosmic ray pfos to which these refer, so that a run over a subset of groups is a run over those groups
+     *
+     *  @return boolean
+     */
+    virtual bool ExaminesGroupsIndependently() const;
+
     ThreeViewDeltaRayMatchingAlgorithm *m_pParentAlgorithm; ///< Address of the parent matching algorithm
 };
 
@@ -121,6 +130,13 @@ inline std::string ThreeViewDeltaRayMatchingAlgorithm::GetClusteringAlgName() co
     return m_reclusteringAlgorithmName;
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline bool DeltaRayTensorTool::ExaminesGroupsIndependently() const
+{
+    return false;
+}
+
 } // namespace lar_content
 
 #endif // #ifndef LAR_THREE_VIEW_DELTA_RAY_MATCHING_ALGORITHM_H
@@ -12,6 +12,7 @@
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
 #include "larpandoracontent/LArHelpers/LArPfoHelper.h"
+#include "larpandoracontent/LArHelpers/LArSlidingFitCacheHelper.h"
 #include "larpandoracontent/LArObjects/LArTwoDSlidingFitResult.h"
 
 using namespace pandora;
@@ -66,6 +67,13 @@ bool TwoViewCosmicRayRemovalTool::Run(TwoViewDeltaRayMatchingAlgorithm *const pA
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+bool TwoViewCosmicRayRemovalTool::ExaminesGroupsIndependently() const
+{
+    return true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 bool TwoViewCosmicRayRemovalTool::RemoveCosmicRayHits(const MatrixType::ElementList &elementList) const
 {
     ClusterSet modifiedClusters, checkedClusters;
@@ -182,7 +190,8 @@ bool TwoViewCosmicRayRemovalTool::IsContaminated(const MatrixType::Element &elem
         return false;
 
     const float slidingFitPitch(LArGeometryHelper::GetWireZPitch(this->GetPandora()));
-    const TwoDSlidingFitResult slidingFitResult(pMuonCluster, m_slidingFitWindow, slidingFitPitch);
+    const TwoDSlidingFitResult &slidingFitResult(
+        LArSlidingFitCacheHelper::GetSlidingFitResult(this->GetPandora(), pMuonCluster, m_slidingFitWindow, slidingFitPitch));
 
     CartesianVector muonDirection(0.f, 0.f, 0.f);
     slidingFitResult.GetGlobalDirection(slidingFitResult.GetLayerFitResultMap().begin()->second.GetGradient(), muonDirection);
@@ -494,7 +503,7 @@ void TwoViewCosmicRayRemovalTool::ReclusterRemnant(const HitType hitType, const
     {
         if (pRemnant->GetNCaloHits() < m_minRemnantClusterSize)
         {
-            if (LArClusterHelper::GetClosestDistance(pRemnant, pMuonCluster) < m_maxDistanceToTrack)
+            if (LArClusterHelper::IsCloserThan(pRemnant, pMuonCluster, m_maxDistanceToTrack))
             {
                 PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::MergeAndDeleteClusters(*m_pParentAlgorithm, pMuonCluster, pRemnant));
                 continue;
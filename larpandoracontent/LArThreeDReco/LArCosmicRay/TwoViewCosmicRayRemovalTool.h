@@ -26,6 +26,7 @@ public:
 
 private:
     bool Run(TwoViewDeltaRayMatchingAlgorithm *const pAlgorithm, MatrixType &overlapMatrix);
+    bool ExaminesGroupsIndependently() const;
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
     /**
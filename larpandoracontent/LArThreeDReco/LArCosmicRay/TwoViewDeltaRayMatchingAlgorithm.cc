@@ -368,6 +368,9 @@ void TwoViewDeltaRayMatchingAlgorithm::UpdateForThirdViewClusterModification(con
 {
     auto &theMatrix(this->GetMatchingControl().GetOverlapMatrix());
 
+    if (isMuon)
+        this->RecordModifiedMuonCluster();
+
     for (auto [pCluster1, overlapList] : theMatrix)
     {
         for (auto [pCluster2, overlapResult] : overlapList)
@@ -394,28 +397,30 @@ void TwoViewDeltaRayMatchingAlgorithm::UpdateForThirdViewClusterModification(con
             TwoViewDeltaRayOverlapResult newOverlapResult(
                 overlapResult.GetXOverlap(), overlapResult.GetCommonMuonPfoList(), pBestMatchedCluster, matchedClusters, reducedChiSquared);
             theMatrix.ReplaceOverlapResult(pCluster1, pCluster2, newOverlapResult);
+            this->RecordModifiedCluster(pCluster1);
+            this->RecordModifiedCluster(pCluster2);
         }
     }
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void TwoViewDeltaRayMatchingAlgorithm::ExamineOverlapContainer()
+void TwoViewDeltaRayMatchingAlgorithm::GetConnectedClusters(const ClusterSet &seedClusters, ClusterSet &connectedClusters) const
 {
-    // Apply tools sequentially restarting if a change is made and ending if the tools finish or the restart limit is reached
-    unsigned int repeatCounter(0);
+    this->GetMatchingControl().GetOverlapMatrix().GetConnectedClusters(seedClusters, connectedClusters);
+}
 
-    for (auto toolIter = m_algorithmToolVector.begin(); toolIter != m_algorithmToolVector.end();)
-    {
-        DeltaRayMatrixTool *const pTool(*toolIter);
-        const bool repeatTools(pTool->Run(this, this->GetMatchingControl().GetOverlapMatrix()));
+//------------------------------------------------------------------------------------------------------------------------------------------
 
-        toolIter = repeatTools ? m_algorithmToolVector.begin() : toolIter + 1;
-        repeatCounter = repeatTools ? repeatCounter + 1 : repeatCounter;
+void TwoViewDeltaRayMatchingAlgorithm::ExamineOverlapContainer()
+{
+    m_modifiedClusters.clear();
+    m_nMuonClusterModifications = 0;
+    m_recordModifiedClusters = true;
 
-        if (repeatCounter > m_nMaxMatrixToolRepeats)
-            break;
-    }
+    // ATTN A cosmic ray cluster modification can affect any element sharing that pfo, so is a global modification
+    this->RunToolsOverModifiedGroups(this, m_algorithmToolVector, this->GetMatchingControl().GetOverlapMatrix(), m_modifiedClusters,
+        m_nMuonClusterModifications, m_nMaxMatrixToolRepeats, false);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
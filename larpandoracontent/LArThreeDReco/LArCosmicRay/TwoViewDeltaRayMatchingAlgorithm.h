@@ -160,6 +160,7 @@ private:
      */
     void MergeThirdView(const MatrixType::Element &element, const pandora::Cluster *const pSeedCluster);
 
+    void GetConnectedClusters(const pandora::ClusterSet &seedClusters, pandora::ClusterSet &connectedClusters) const;
     void ExamineOverlapContainer();
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
@@ -212,9 +213,24 @@ public:
      */
     virtual bool Run(TwoViewDeltaRayMatchingAlgorithm *const pAlgorithm, MatrixType &matrixTensor) = 0;
 
+    /**
+     *  @brief  Whether the tool examines each group of connected clusters independently, using only the elements of the group and the
+     *          clusters and cosmic ray pfos to which these refer, so that a run over a subset of groups is a run over those groups
+     *
+     *  @return boolean
+     */
+    virtual bool ExaminesGroupsIndependently() const;
+
     TwoViewDeltaRayMatchingAlgorithm *m_pParentAlgorithm; ///< Address of the parent matching algorithm
 };
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline bool DeltaRayMatrixTool::ExaminesGroupsIndependently() const
+{
+    return false;
+}
+
 } // namespace lar_content
 
 #endif // #ifndef LAR_TWO_VIEW_DELTA_RAY_MATCHING_ALGORITHM_H
@@ -16,6 +16,8 @@
 
 #include "larpandoracontent/LArThreeDReco/LArEventBuilding/BranchAssociatedPfosTool.h"
 
+#include <limits>
+
 using namespace pandora;
 
 namespace lar_content
@@ -38,6 +40,8 @@ void BranchAssociatedPfosTool::Run(const NeutrinoHierarchyAlgorithm *const pAlgo
     if (PandoraContentApi::GetSettings(*pAlgorithm)->ShouldDisplayAlgorithmInfo())
         std::cout << "----> Running Algorithm Tool: " << this->GetInstanceName() << ", " << this->GetType() << std::endl;
 
+    // ATTN The parent cluster bounding boxes used to pre-check each association are only cached within a geometry cache scope
+    const LArClusterHelper::GeometryCacheScope geometryCacheScope;
     bool associationsMade(true);
 
     while (associationsMade)
@@ -70,7 +74,7 @@ void BranchAssociatedPfosTool::Run(const NeutrinoHierarchyAlgorithm *const pAlgo
                     continue;
 
                 PfoInfo *const pPfoInfo(pfoInfoMap.at(pPfo));
-                const LArPointingCluster pointingCluster(*(pPfoInfo->GetSlidingFitResult3D()));
+                const LArPointingCluster &pointingCluster(pPfoInfo->GetPointingCluster3D());
 
                 const float dNeutrinoVertex(std::min((pointingCluster.GetInnerVertex().GetPosition() - pNeutrinoVertex->GetPosition()).GetMagnitude(),
                     (pointingCluster.GetOuterVertex().GetPosition() - pNeutrinoVertex->GetPosition()).GetMagnitude()));
@@ -84,8 +88,8 @@ void BranchAssociatedPfosTool::Run(const NeutrinoHierarchyAlgorithm *const pAlgo
                 if (parentIsTrack && (dParentVertex < m_trackBranchAdditionFraction * parentLength3D))
                     continue;
 
-                const float dInnerVertex(LArClusterHelper::GetClosestDistance(pointingCluster.GetInnerVertex().GetPosition(), pParentCluster3D));
-                const float dOuterVertex(LArClusterHelper::GetClosestDistance(pointingCluster.GetOuterVertex().GetPosition(), pParentCluster3D));
+                const float dInnerVertex(this->GetParentClusterDistance(pointingCluster.GetInnerVertex().GetPosition(), pParentCluster3D));
+                const float dOuterVertex(this->GetParentClusterDistance(pointingCluster.GetOuterVertex().GetPosition(), pParentCluster3D));
 
                 if ((dInnerVertex < m_maxParentClusterDistance) || (dOuterVertex < m_maxParentClusterDistance))
                 {
@@ -102,6 +106,17 @@ void BranchAssociatedPfosTool::Run(const NeutrinoHierarchyAlgorithm *const pAlgo
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+float BranchAssociatedPfosTool::GetParentClusterDistance(const CartesianVector &position, const Cluster *const pParentCluster3D) const
+{
+    // ATTN Beyond the max distance the exact value cannot change the outcome; padding absorbs rounding differences with the bounding box
+    if (LArClusterHelper::GetBoundingBoxDistance(position, pParentCluster3D) > m_maxParentClusterDistance + 0.01f)
+        return std::numeric_limits<float>::max();
+
+    return LArClusterHelper::GetClosestDistance(position, pParentCluster3D);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode BranchAssociatedPfosTool::ReadSettings(const TiXmlHandle xmlHandle)
 {
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
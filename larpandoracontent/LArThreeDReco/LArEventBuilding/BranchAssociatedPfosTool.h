@@ -28,6 +28,16 @@ public:
         NeutrinoHierarchyAlgorithm::PfoInfoMap &pfoInfoMap);
 
 private:
+    /**
+     *  @brief  Get the closest distance between a position and a hit in the parent 3D cluster, if this could be within the max distance
+     *
+     *  @param  position the position
+     *  @param  pParentCluster3D address of the parent 3D cluster
+     *
+     *  @return the closest distance, or the max float value if the bounding box of the parent cluster is beyond the max distance
+     */
+    float GetParentClusterDistance(const pandora::CartesianVector &position, const pandora::Cluster *const pParentCluster3D) const;
+
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
     float m_minNeutrinoVertexDistance;   ///< Branch association: min distance from branch vertex to neutrino vertex
@@ -8,6 +8,7 @@
 
 #include "Pandora/AlgorithmHeaders.h"
 
+#include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 #include "larpandoracontent/LArHelpers/LArPointingClusterHelper.h"
 
 #include "larpandoracontent/LArObjects/LArPointingCluster.h"
@@ -40,6 +41,8 @@ void EndAssociatedPfosTool::Run(const NeutrinoHierarchyAlgorithm *const pAlgorit
     if (PandoraContentApi::GetSettings(*pAlgorithm)->ShouldDisplayAlgorithmInfo())
         std::cout << "----> Running Algorithm Tool: " << this->GetInstanceName() << ", " << this->GetType() << std::endl;
 
+    // ATTN The daughter cluster bounding boxes used to pre-check each association are only cached within a geometry cache scope
+    const LArClusterHelper::GeometryCacheScope geometryCacheScope;
     bool associationsMade(true);
 
     while (associationsMade)
@@ -57,7 +60,7 @@ void EndAssociatedPfosTool::Run(const NeutrinoHierarchyAlgorithm *const pAlgorit
         for (const ParticleFlowObject *const pParentPfo : assignedPfos)
         {
             PfoInfo *const pParentPfoInfo(pfoInfoMap.at(pParentPfo));
-            const LArPointingCluster parentPointingCluster(*(pParentPfoInfo->GetSlidingFitResult3D()));
+            const LArPointingCluster &parentPointingCluster(pParentPfoInfo->GetPointingCluster3D());
 
             const LArPointingCluster::Vertex &parentEndpoint(
                 pParentPfoInfo->IsInnerLayerAssociated() ? parentPointingCluster.GetOuterVertex() : parentPointingCluster.GetInnerVertex());
@@ -73,7 +76,7 @@ void EndAssociatedPfosTool::Run(const NeutrinoHierarchyAlgorithm *const pAlgorit
 
                 PfoInfo *const pPfoInfo(pfoInfoMap.at(pPfo));
 
-                const LArPointingCluster pointingCluster(*(pPfoInfo->GetSlidingFitResult3D()));
+                const LArPointingCluster &pointingCluster(pPfoInfo->GetPointingCluster3D());
                 const bool useInner((pointingCluster.GetInnerVertex().GetPosition() - parentEndpoint.GetPosition()).GetMagnitudeSquared() <
                                     (pointingCluster.GetOuterVertex().GetPosition() - parentEndpoint.GetPosition()).GetMagnitudeSquared());
 
@@ -105,6 +108,10 @@ bool EndAssociatedPfosTool::IsCloseToParentEndpoint(
 {
     try
     {
+        // ATTN A daughter close to the parent endpoint has a hit within twice the max distance of it; padding absorbs rounding differences
+        if (LArClusterHelper::GetBoundingBoxDistance(parentEndpoint, pDaughterCluster3D) > 2.f * m_maxParentEndpointDistance + 0.01f)
+            return false;
+
         CartesianVector parentPosition3D(0.f, 0.f, 0.f), daughterPosition3D(0.f, 0.f, 0.f);
         LArClusterHelper::GetClosestPositions(pParentCluster3D, pDaughterCluster3D, parentPosition3D, daughterPosition3D);
 
@@ -53,7 +53,8 @@ EventSlicingTool::EventSlicingTool() :
     m_coneBoundedFraction1(0.5f),
     m_coneTanHalfAngle2(0.75f),
     m_coneBoundedFraction2(0.75f),
-    m_use3DProjectionsInHitPickUp(true)
+    m_use3DProjectionsInHitPickUp(true),
+    m_useUnionFindSlicing(false)
 {
 }
 
@@ -169,6 +170,8 @@ void EventSlicingTool::GetThreeDClusters(
 
 void EventSlicingTool::GetClusterSliceList(const ClusterList &trackClusters3D, const ClusterList &showerClusters3D, ClusterSliceList &clusterSliceList) const
 {
+    // ATTN Cache the cluster bounding boxes used to reject distant cluster pairs before any proximity hit comparisons
+    const LArClusterHelper::GeometryCacheScope geometryCacheScope;
     const float layerPitch(LArGeometryHelper::GetWireZPitch(this->GetPandora()));
 
     ThreeDSlidingFitResultMap trackFitResults;
@@ -177,8 +180,8 @@ void EventSlicingTool::GetClusterSliceList(const ClusterList &trackClusters3D, c
     {
         try
         {
-            trackFitResults.insert(
-                ThreeDSlidingFitResultMap::value_type(pCluster3D, ThreeDSlidingFitResult(pCluster3D, m_halfWindowLayers, layerPitch)));
+            trackFitResults.insert(ThreeDSlidingFitResultMap::value_type(
+                pCluster3D, ThreeDSlidingFitResult(pCluster3D, m_halfWindowLayers, layerPitch, ThreeDSlidingFitResult::ENDPOINTS_ONLY)));
         }
         catch (StatusCodeException &)
         {
@@ -205,6 +208,12 @@ void EventSlicingTool::GetClusterSliceList(const ClusterList &trackClusters3D, c
     sortedClusters3D.insert(sortedClusters3D.end(), showerClusters3D.begin(), showerClusters3D.end());
     std::sort(sortedClusters3D.begin(), sortedClusters3D.end(), LArClusterHelper::SortByNHits);
 
+    if (m_useUnionFindSlicing)
+    {
+        this->GetUnionFindClusterSliceList(sortedClusters3D, trackFitResults, showerConeFitResults, clusterSliceList);
+        return;
+    }
+
     ClusterSet usedClusters;
 
     for (const Cluster *const pCluster3D : sortedClusters3D)
@@ -236,10 +245,7 @@ void EventSlicingTool::CollectAssociatedClusters(const Cluster *const pClusterIn
         if (usedClusters.count(pCandidateCluster) || (pClusterInSlice == pCandidateCluster))
             continue;
 
-        if ((m_usePointingAssociation && this->PassPointing(pClusterInSlice, pCandidateCluster, trackFitResults)) ||
-            (m_useProximityAssociation && this->PassProximity(pClusterInSlice, pCandidateCluster)) ||
-            (m_useShowerConeAssociation && (this->PassShowerCone(pClusterInSlice, pCandidateCluster, showerConeFitResults) ||
-                                               this->PassShowerCone(pCandidateCluster, pClusterInSlice, showerConeFitResults))))
+        if (this->PassAssociation(pClusterInSlice, pCandidateCluster, trackFitResults, showerConeFitResults))
         {
             addedClusters.push_back(pCandidateCluster);
             (void)usedClusters.insert(pCandidateCluster);
@@ -254,6 +260,76 @@ void EventSlicingTool::CollectAssociatedClusters(const Cluster *const pClusterIn
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void EventSlicingTool::GetUnionFindClusterSliceList(const ClusterVector &sortedClusters3D, const ThreeDSlidingFitResultMap &trackFitResults,
+    const ThreeDSlidingConeFitResultMap &showerConeFitResults, ClusterSliceList &clusterSliceList) const
+{
+    // ATTN The association is symmetric, so slices are the connected components holding a seed cluster. Each component is labelled by
+    // its lowest index cluster (its largest, given the sort), so the slices and their order match those of the recursive approach.
+    const unsigned int nClusters(sortedClusters3D.size());
+    UIntVector parentIndices(nClusters);
+
+    for (unsigned int iCluster = 0; iCluster < nClusters; ++iCluster)
+        parentIndices.at(iCluster) = iCluster;
+
+    auto findRoot = [&parentIndices](unsigned int index) {
+        while (parentIndices[index] != index)
+        {
+            parentIndices[index] = parentIndices[parentIndices[index]];
+            index = parentIndices[index];
+        }
+
+        return index;
+    };
+
+    for (unsigned int iCluster = 0; iCluster < nClusters; ++iCluster)
+    {
+        for (unsigned int jCluster = iCluster + 1; jCluster < nClusters; ++jCluster)
+        {
+            const unsigned int iRoot(findRoot(iCluster)), jRoot(findRoot(jCluster));
+
+            if (iRoot == jRoot)
+                continue;
+
+            if (this->PassAssociation(sortedClusters3D.at(iCluster), sortedClusters3D.at(jCluster), trackFitResults, showerConeFitResults))
+                parentIndices[std::max(iRoot, jRoot)] = std::min(iRoot, jRoot);
+        }
+    }
+
+    std::unordered_map<unsigned int, unsigned int> rootToSliceIndexMap;
+
+    for (unsigned int iCluster = 0; iCluster < nClusters; ++iCluster)
+    {
+        const unsigned int root(findRoot(iCluster));
+
+        if (root == iCluster)
+        {
+            if (sortedClusters3D.at(iCluster)->GetNCaloHits() < m_min3DHitsToSeedNewSlice)
+                continue;
+
+            rootToSliceIndexMap[root] = clusterSliceList.size();
+            clusterSliceList.push_back(ClusterVector());
+        }
+
+        const auto iter(rootToSliceIndexMap.find(root));
+
+        if (rootToSliceIndexMap.end() != iter)
+            clusterSliceList.at(iter->second).push_back(sortedClusters3D.at(iCluster));
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool EventSlicingTool::PassAssociation(const Cluster *const pClusterInSlice, const Cluster *const pCandidateCluster,
+    const ThreeDSlidingFitResultMap &trackFitResults, const ThreeDSlidingConeFitResultMap &showerConeFitResults) const
+{
+    return ((m_usePointingAssociation && this->PassPointing(pClusterInSlice, pCandidateCluster, trackFitResults)) ||
+            (m_useProximityAssociation && this->PassProximity(pClusterInSlice, pCandidateCluster)) ||
+            (m_useShowerConeAssociation && (this->PassShowerCone(pClusterInSlice, pCandidateCluster, showerConeFitResults) ||
+                                               this->PassShowerCone(pCandidateCluster, pClusterInSlice, showerConeFitResults))));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 bool EventSlicingTool::PassPointing(
     const Cluster *const pClusterInSlice, const Cluster *const pCandidateCluster, const ThreeDSlidingFitResultMap &trackFitResults) const
 {
@@ -279,6 +355,18 @@ bool EventSlicingTool::PassPointing(
 
 bool EventSlicingTool::PassProximity(const Cluster *const pClusterInSlice, const Cluster *const pCandidateCluster) const
 {
+    // ATTN The separation between bounding boxes never exceeds that of any hit pair, so this rejection leaves the outcome unchanged
+    CartesianVector minimum1(0.f, 0.f, 0.f), maximum1(0.f, 0.f, 0.f), minimum2(0.f, 0.f, 0.f), maximum2(0.f, 0.f, 0.f);
+    LArClusterHelper::GetClusterBoundingBox(pClusterInSlice, minimum1, maximum1);
+    LArClusterHelper::GetClusterBoundingBox(pCandidateCluster, minimum2, maximum2);
+
+    const float gapX(std::max(0.f, std::max(minimum2.GetX() - maximum1.GetX(), minimum1.GetX() - maximum2.GetX())));
+    const float gapY(std::max(0.f, std::max(minimum2.GetY() - maximum1.GetY(), minimum1.GetY() - maximum2.GetY())));
+    const float gapZ(std::max(0.f, std::max(minimum2.GetZ() - maximum1.GetZ(), minimum1.GetZ() - maximum2.GetZ())));
+
+    if (gapX * gapX + gapY * gapY + gapZ * gapZ >= m_maxHitSeparationSquared)
+        return false;
+
     for (const auto &orderedList1 : pClusterInSlice->GetOrderedCaloHitList())
     {
         for (const CaloHit *const pCaloHit1 : *(orderedList1.second))
@@ -324,14 +412,19 @@ bool EventSlicingTool::PassShowerCone(
         return false;
     }
 
-    for (const SimpleCone &simpleCone : simpleConeList)
-    {
-        const float coneLength(std::min(m_coneLengthMultiplier * clusterLength, m_maxConeLength));
+    const float coneLength(std::min(m_coneLengthMultiplier * clusterLength, m_maxConeLength));
+    const SimpleConeBatch simpleConeBatch(simpleConeList);
+
+    FloatVector boundedFractions1, boundedFractions2;
+    simpleConeBatch.GetBoundedHitFractions(
+        pNearbyCluster, coneLength, m_coneTanHalfAngle1, m_coneTanHalfAngle2, boundedFractions1, boundedFractions2);
 
-        if (simpleCone.GetBoundedHitFraction(pNearbyCluster, coneLength, m_coneTanHalfAngle1) < m_coneBoundedFraction1)
+    for (unsigned int iCone = 0; iCone < simpleConeBatch.GetNCones(); ++iCone)
+    {
+        if (boundedFractions1.at(iCone) < m_coneBoundedFraction1)
             continue;
 
-        if (simpleCone.GetBoundedHitFraction(pNearbyCluster, coneLength, m_coneTanHalfAngle2) < m_coneBoundedFraction2)
+        if (boundedFractions2.at(iCone) < m_coneBoundedFraction2)
             continue;
 
         return true;
@@ -527,69 +620,62 @@ void EventSlicingTool::GetRemainingClusters(const Algorithm *const pAlgorithm, c
 void EventSlicingTool::AssignRemainingHitsToSlices(
     const ClusterList &remainingClusters, const ClusterToSliceIndexMap &clusterToSliceIndexMap, SliceList &sliceList) const
 {
+    // ATTN The points are owned by the storage, which keeps their addresses stable as it grows, avoiding an allocation per point
+    PointStorage pointStorage;
     PointToSliceIndexMap pointToSliceIndexMap;
 
-    try
-    {
-        PointList pointsU, pointsV, pointsW;
-        this->GetKDTreeEntries2D(sliceList, pointsU, pointsV, pointsW, pointToSliceIndexMap);
+    PointList pointsU, pointsV, pointsW;
+    this->GetKDTreeEntries2D(sliceList, pointsU, pointsV, pointsW, pointStorage, pointToSliceIndexMap);
 
-        if (m_use3DProjectionsInHitPickUp)
-            this->GetKDTreeEntries3D(clusterToSliceIndexMap, pointsU, pointsV, pointsW, pointToSliceIndexMap);
+    if (m_use3DProjectionsInHitPickUp)
+        this->GetKDTreeEntries3D(clusterToSliceIndexMap, pointsU, pointsV, pointsW, pointStorage, pointToSliceIndexMap);
 
-        pointsU.sort(EventSlicingTool::SortPoints);
-        pointsV.sort(EventSlicingTool::SortPoints);
-        pointsW.sort(EventSlicingTool::SortPoints);
+    pointsU.sort(EventSlicingTool::SortPoints);
+    pointsV.sort(EventSlicingTool::SortPoints);
+    pointsW.sort(EventSlicingTool::SortPoints);
 
-        PointKDNode2DList kDNode2DListU, kDNode2DListV, kDNode2DListW;
-        KDTreeBox boundingRegionU = fill_and_bound_2d_kd_tree(pointsU, kDNode2DListU);
-        KDTreeBox boundingRegionV = fill_and_bound_2d_kd_tree(pointsV, kDNode2DListV);
-        KDTreeBox boundingRegionW = fill_and_bound_2d_kd_tree(pointsW, kDNode2DListW);
+    PointKDNode2DList kDNode2DListU, kDNode2DListV, kDNode2DListW;
+    KDTreeBox boundingRegionU = fill_and_bound_2d_kd_tree(pointsU, kDNode2DListU);
+    KDTreeBox boundingRegionV = fill_and_bound_2d_kd_tree(pointsV, kDNode2DListV);
+    KDTreeBox boundingRegionW = fill_and_bound_2d_kd_tree(pointsW, kDNode2DListW);
 
-        PointKDTree2D kdTreeU, kdTreeV, kdTreeW;
-        kdTreeU.build(kDNode2DListU, boundingRegionU);
-        kdTreeV.build(kDNode2DListV, boundingRegionV);
-        kdTreeW.build(kDNode2DListW, boundingRegionW);
+    PointKDTree2D kdTreeU, kdTreeV, kdTreeW;
+    kdTreeU.build(kDNode2DListU, boundingRegionU);
+    kdTreeV.build(kDNode2DListV, boundingRegionV);
+    kdTreeW.build(kDNode2DListW, boundingRegionW);
 
-        ClusterVector sortedRemainingClusters(remainingClusters.begin(), remainingClusters.end());
-        std::sort(sortedRemainingClusters.begin(), sortedRemainingClusters.end(), LArClusterHelper::SortByNHits);
+    ClusterVector sortedRemainingClusters(remainingClusters.begin(), remainingClusters.end());
+    std::sort(sortedRemainingClusters.begin(), sortedRemainingClusters.end(), LArClusterHelper::SortByNHits);
 
-        for (const Cluster *const pCluster2D : sortedRemainingClusters)
-        {
-            const HitType hitType(LArClusterHelper::GetClusterHitType(pCluster2D));
+    for (const Cluster *const pCluster2D : sortedRemainingClusters)
+    {
+        const HitType hitType(LArClusterHelper::GetClusterHitType(pCluster2D));
 
-            if ((TPC_VIEW_U != hitType) && (TPC_VIEW_V != hitType) && (TPC_VIEW_W != hitType))
-                throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+        if ((TPC_VIEW_U != hitType) && (TPC_VIEW_V != hitType) && (TPC_VIEW_W != hitType))
+        {
+            std::cout << "EventSlicingTool::AssignRemainingHitsToSlices - exception " << std::endl;
+            throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+        }
 
-            PointKDTree2D &kdTree((TPC_VIEW_U == hitType) ? kdTreeU : (TPC_VIEW_V == hitType) ? kdTreeV : kdTreeW);
-            const PointKDNode2D *pBestResultPoint(this->MatchClusterToSlice(pCluster2D, kdTree));
+        PointKDTree2D &kdTree((TPC_VIEW_U == hitType) ? kdTreeU : (TPC_VIEW_V == hitType) ? kdTreeV : kdTreeW);
+        const PointKDNode2D *pBestResultPoint(this->MatchClusterToSlice(pCluster2D, kdTree));
 
-            if (!pBestResultPoint)
-                continue;
+        if (!pBestResultPoint)
+            continue;
 
-            Slice &slice(sliceList.at(pointToSliceIndexMap.at(pBestResultPoint->data)));
-            CaloHitList &targetList((TPC_VIEW_U == hitType) ? slice.m_caloHitListU : (TPC_VIEW_V == hitType) ? slice.m_caloHitListV : slice.m_caloHitListW);
+        Slice &slice(sliceList.at(pointToSliceIndexMap.at(pBestResultPoint->data)));
+        CaloHitList &targetList(
+            (TPC_VIEW_U == hitType) ? slice.m_caloHitListU : (TPC_VIEW_V == hitType) ? slice.m_caloHitListV : slice.m_caloHitListW);
 
-            pCluster2D->GetOrderedCaloHitList().FillCaloHitList(targetList);
-            targetList.insert(targetList.end(), pCluster2D->GetIsolatedCaloHitList().begin(), pCluster2D->GetIsolatedCaloHitList().end());
-        }
+        pCluster2D->GetOrderedCaloHitList().FillCaloHitList(targetList);
+        targetList.insert(targetList.end(), pCluster2D->GetIsolatedCaloHitList().begin(), pCluster2D->GetIsolatedCaloHitList().end());
     }
-    catch (...)
-    {
-        std::cout << "EventSlicingTool::AssignRemainingHitsToSlices - exception " << std::endl;
-        for (const auto &pointMap : pointToSliceIndexMap)
-            delete pointMap.first;
-        throw;
-    }
-
-    for (const auto &pointMap : pointToSliceIndexMap)
-        delete pointMap.first;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void EventSlicingTool::GetKDTreeEntries2D(
-    const SliceList &sliceList, PointList &pointsU, PointList &pointsV, PointList &pointsW, PointToSliceIndexMap &pointToSliceIndexMap) const
+void EventSlicingTool::GetKDTreeEntries2D(const SliceList &sliceList, PointList &pointsU, PointList &pointsV, PointList &pointsW,
+    PointStorage &pointStorage, PointToSliceIndexMap &pointToSliceIndexMap) const
 {
     unsigned int sliceIndex(0);
 
@@ -597,23 +683,23 @@ void EventSlicingTool::GetKDTreeEntries2D(
     {
         for (const CaloHit *const pCaloHit : slice.m_caloHitListU)
         {
-            const CartesianVector *const pPoint(new CartesianVector(pCaloHit->GetPositionVector()));
-            pointToSliceIndexMap.insert(PointToSliceIndexMap::value_type(pPoint, sliceIndex));
-            pointsU.push_back(pPoint);
+            pointStorage.push_back(pCaloHit->GetPositionVector());
+            pointToSliceIndexMap.insert(PointToSliceIndexMap::value_type(&pointStorage.back(), sliceIndex));
+            pointsU.push_back(&pointStorage.back());
         }
 
         for (const CaloHit *const pCaloHit : slice.m_caloHitListV)
         {
-            const CartesianVector *const pPoint(new CartesianVector(pCaloHit->GetPositionVector()));
-            pointToSliceIndexMap.insert(PointToSliceIndexMap::value_type(pPoint, sliceIndex));
-            pointsV.push_back(pPoint);
+            pointStorage.push_back(pCaloHit->GetPositionVector());
+            pointToSliceIndexMap.insert(PointToSliceIndexMap::value_type(&pointStorage.back(), sliceIndex));
+            pointsV.push_back(&pointStorage.back());
         }
 
         for (const CaloHit *const pCaloHit : slice.m_caloHitListW)
         {
-            const CartesianVector *const pPoint(new CartesianVector(pCaloHit->GetPositionVector()));
-            pointToSliceIndexMap.insert(PointToSliceIndexMap::value_type(pPoint, sliceIndex));
-            pointsW.push_back(pPoint);
+            pointStorage.push_back(pCaloHit->GetPositionVector());
+            pointToSliceIndexMap.insert(PointToSliceIndexMap::value_type(&pointStorage.back(), sliceIndex));
+            pointsW.push_back(&pointStorage.back());
         }
 
         ++sliceIndex;
@@ -623,7 +709,7 @@ void EventSlicingTool::GetKDTreeEntries2D(
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void EventSlicingTool::GetKDTreeEntries3D(const ClusterToSliceIndexMap &clusterToSliceIndexMap, PointList &pointsU, PointList &pointsV,
-    PointList &pointsW, PointToSliceIndexMap &pointToSliceIndexMap) const
+    PointList &pointsW, PointStorage &pointStorage, PointToSliceIndexMap &pointToSliceIndexMap) const
 {
     ClusterList clusterList;
     for (const auto &mapEntry : clusterToSliceIndexMap)
@@ -637,19 +723,30 @@ void EventSlicingTool::GetKDTreeEntries3D(const ClusterToSliceIndexMap &clusterT
         CaloHitList caloHitList;
         pCluster3D->GetOrderedCaloHitList().FillCaloHitList(caloHitList);
 
+        CartesianPointVector positions3D;
+        positions3D.reserve(caloHitList.size());
+
         for (const CaloHit *const pCaloHit3D : caloHitList)
         {
             if (TPC_3D != pCaloHit3D->GetHitType())
                 throw StatusCodeException(STATUS_CODE_FAILURE);
 
-            const CartesianVector &position3D(pCaloHit3D->GetPositionVector());
+            positions3D.push_back(pCaloHit3D->GetPositionVector());
+        }
 
-            const CartesianVector *const pProjectionU(
-                new CartesianVector(LArGeometryHelper::ProjectPosition(this->GetPandora(), position3D, TPC_VIEW_U)));
-            const CartesianVector *const pProjectionV(
-                new CartesianVector(LArGeometryHelper::ProjectPosition(this->GetPandora(), position3D, TPC_VIEW_V)));
-            const CartesianVector *const pProjectionW(
-                new CartesianVector(LArGeometryHelper::ProjectPosition(this->GetPandora(), position3D, TPC_VIEW_W)));
+        CartesianPointVector projectionsU, projectionsV, projectionsW;
+        LArGeometryHelper::ProjectPositions(this->GetPandora(), positions3D, TPC_VIEW_U, projectionsU);
+        LArGeometryHelper::ProjectPositions(this->GetPandora(), positions3D, TPC_VIEW_V, projectionsV);
+        LArGeometryHelper::ProjectPositions(this->GetPandora(), positions3D, TPC_VIEW_W, projectionsW);
+
+        for (size_t iHit = 0; iHit < positions3D.size(); ++iHit)
+        {
+            pointStorage.push_back(projectionsU.at(iHit));
+            const CartesianVector *const pProjectionU(&pointStorage.back());
+            pointStorage.push_back(projectionsV.at(iHit));
+            const CartesianVector *const pProjectionV(&pointStorage.back());
+            pointStorage.push_back(projectionsW.at(iHit));
+            const CartesianVector *const pProjectionW(&pointStorage.back());
 
             pointsU.push_back(pProjectionU);
             pointsV.push_back(pProjectionV);
@@ -666,42 +763,26 @@ void EventSlicingTool::GetKDTreeEntries3D(const ClusterToSliceIndexMap &clusterT
 
 const EventSlicingTool::PointKDNode2D *EventSlicingTool::MatchClusterToSlice(const Cluster *const pCluster2D, PointKDTree2D &kdTree) const
 {
-    PointList clusterPointList;
+    const CartesianVector innerCentroid(pCluster2D->GetCentroid(pCluster2D->GetInnerPseudoLayer()));
+    const CartesianVector outerCentroid(pCluster2D->GetCentroid(pCluster2D->GetOuterPseudoLayer()));
+    const CartesianVector clusterPoints[3] = {innerCentroid, outerCentroid, (innerCentroid + outerCentroid) * 0.5f};
+
     const PointKDNode2D *pBestResultPoint(nullptr);
+    float bestDistance(std::numeric_limits<float>::max());
 
-    try
+    for (const CartesianVector &clusterPoint : clusterPoints)
     {
-        clusterPointList.push_back(new CartesianVector(pCluster2D->GetCentroid(pCluster2D->GetInnerPseudoLayer())));
-        clusterPointList.push_back(new CartesianVector(pCluster2D->GetCentroid(pCluster2D->GetOuterPseudoLayer())));
-        clusterPointList.push_back(new CartesianVector(
-            (pCluster2D->GetCentroid(pCluster2D->GetInnerPseudoLayer()) + pCluster2D->GetCentroid(pCluster2D->GetOuterPseudoLayer())) * 0.5f));
-
-        float bestDistance(std::numeric_limits<float>::max());
+        const PointKDNode2D *pResultPoint(nullptr);
+        float resultDistance(std::numeric_limits<float>::max());
+        const PointKDNode2D targetPoint(&clusterPoint, clusterPoint.GetX(), clusterPoint.GetZ());
+        kdTree.findNearestNeighbour(targetPoint, pResultPoint, resultDistance);
 
-        for (const CartesianVector *const pClusterPoint : clusterPointList)
+        if (pResultPoint && (resultDistance < bestDistance))
         {
-            const PointKDNode2D *pResultPoint(nullptr);
-            float resultDistance(std::numeric_limits<float>::max());
-            const PointKDNode2D targetPoint(pClusterPoint, pClusterPoint->GetX(), pClusterPoint->GetZ());
-            kdTree.findNearestNeighbour(targetPoint, pResultPoint, resultDistance);
-
-            if (pResultPoint && (resultDistance < bestDistance))
-            {
-                pBestResultPoint = pResultPoint;
-                bestDistance = resultDistance;
-            }
+            pBestResultPoint = pResultPoint;
+            bestDistance = resultDistance;
         }
     }
-    catch (...)
-    {
-        std::cout << "EventSlicingTool::MatchClusterToSlice - exception " << std::endl;
-        for (const CartesianVector *const pPoint : clusterPointList)
-            delete pPoint;
-        throw;
-    }
-
-    for (const CartesianVector *const pPoint : clusterPointList)
-        delete pPoint;
 
     return pBestResultPoint;
 }
@@ -793,6 +874,9 @@ StatusCode EventSlicingTool::ReadSettings(const TiXmlHandle xmlHandle)
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
         XmlHelper::ReadValue(xmlHandle, "Use3DProjectionsInHitPickUp", m_use3DProjectionsInHitPickUp));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "UseUnionFindSlicing", m_useUnionFindSlicing));
+
     return STATUS_CODE_SUCCESS;
 }
 
@@ -12,6 +12,7 @@
 
 #include "larpandoracontent/LArObjects/LArThreeDSlidingConeFitResult.h"
 
+#include <deque>
 #include <unordered_map>
 
 namespace lar_content
@@ -91,6 +92,31 @@ private:
         const ThreeDSlidingFitResultMap &trackFitResults, const ThreeDSlidingConeFitResultMap &showerConeFitResults,
         pandora::ClusterVector &clusterSlice, pandora::ClusterSet &usedClusters) const;
 
+    /**
+     *  @brief  Divide the provided sorted 3D clusters into slices using union-find over cluster pairs, testing each pair at most once and
+     *          skipping pairs already known to share a slice. Slices hold their clusters in the provided sort order.
+     *
+     *  @param  sortedClusters3D the 3D clusters, sorted by number of hits
+     *  @param  trackFitResults the map of sliding fit results for track candidate clusters
+     *  @param  showerConeFitResults the map of sliding cone fit results for shower candidate clusters
+     *  @param  clusterSliceList to receive the list of 3D clusters, divided into slices (one 3D cluster list per slice)
+     */
+    void GetUnionFindClusterSliceList(const pandora::ClusterVector &sortedClusters3D, const ThreeDSlidingFitResultMap &trackFitResults,
+        const ThreeDSlidingConeFitResultMap &showerConeFitResults, ClusterSliceList &clusterSliceList) const;
+
+    /**
+     *  @brief  Compare the provided clusters to assess whether they are associated via pointing, proximity or shower cones
+     *
+     *  @param  pClusterInSlice address of a cluster already in the slice
+     *  @param  pCandidateCluster address of the candidate cluster
+     *  @param  trackFitResults the map of sliding fit results for track candidate clusters
+     *  @param  showerConeFitResults the map of sliding cone fit results for shower candidate clusters
+     *
+     *  @return whether an addition to the cluster slice should be made
+     */
+    bool PassAssociation(const pandora::Cluster *const pClusterInSlice, const pandora::Cluster *const pCandidateCluster,
+        const ThreeDSlidingFitResultMap &trackFitResults, const ThreeDSlidingConeFitResultMap &showerConeFitResults) const;
+
     /**
      *  @brief  Compare the provided clusters to assess whether they are associated via pointing (checks association "both ways")
      *
@@ -225,6 +251,7 @@ private:
     typedef std::vector<PointKDNode2D> PointKDNode2DList;
 
     typedef std::list<const pandora::CartesianVector *> PointList;
+    typedef std::deque<pandora::CartesianVector> PointStorage;
     typedef std::unordered_map<const pandora::CartesianVector *, unsigned int> PointToSliceIndexMap;
 
     /**
@@ -234,10 +261,11 @@ private:
      *  @param  pointsU to receive the points in the u view
      *  @param  pointsV to receive the points in the v view
      *  @param  pointsW to receive the points in the w view
+     *  @param  pointStorage to receive ownership of the points
      *  @param  pointToSliceIndexMap to receive the mapping from points to slice index
      */
     void GetKDTreeEntries2D(const SlicingAlgorithm::SliceList &sliceList, PointList &pointsU, PointList &pointsV, PointList &pointsW,
-        PointToSliceIndexMap &pointToSliceIndexMap) const;
+        PointStorage &pointStorage, PointToSliceIndexMap &pointToSliceIndexMap) const;
 
     /**
      *  @brief  Use 2D hits already assigned to slices to populate kd trees to aid assignment of remaining clusters
@@ -246,10 +274,11 @@ private:
      *  @param  pointsU to receive the points in the u view
      *  @param  pointsV to receive the points in the v view
      *  @param  pointsW to receive the points in the w view
+     *  @param  pointStorage to receive ownership of the points
      *  @param  pointToSliceIndexMap to receive the mapping from points to slice index
      */
     void GetKDTreeEntries3D(const ClusterToSliceIndexMap &clusterToSliceIndexMap, PointList &pointsU, PointList &pointsV,
-        PointList &pointsW, PointToSliceIndexMap &pointToSliceIndexMap) const;
+        PointList &pointsW, PointStorage &pointStorage, PointToSliceIndexMap &pointToSliceIndexMap) const;
 
     /**
      *  @brief  Use the provided kd tree to efficiently identify the most appropriate slice for the provided 2D cluster
@@ -300,6 +329,7 @@ private:
     float m_coneBoundedFraction2;    ///< The minimum cluster bounded fraction for association 2
 
     bool m_use3DProjectionsInHitPickUp; ///< Whether to include 3D cluster projections when assigning remaining clusters to slices
+    bool m_useUnionFindSlicing;         ///< Whether to build slices by union-find, which orders the clusters within each slice by hits
 };
 
 } // namespace lar_content
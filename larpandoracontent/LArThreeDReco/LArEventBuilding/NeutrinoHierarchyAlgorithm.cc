@@ -12,6 +12,8 @@
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
 #include "larpandoracontent/LArHelpers/LArPfoHelper.h"
 
+#include "larpandoracontent/LArObjects/LArPointingCluster.h"
+
 #include "larpandoracontent/LArThreeDReco/LArEventBuilding/NeutrinoHierarchyAlgorithm.h"
 
 using namespace pandora;
@@ -340,6 +342,7 @@ NeutrinoHierarchyAlgorithm::PfoInfo::PfoInfo(const pandora::ParticleFlowObject *
     m_pCluster3D(nullptr),
     m_pVertex3D(nullptr),
     m_pSlidingFitResult3D(nullptr),
+    m_pPointingCluster3D(nullptr),
     m_isNeutrinoVertexAssociated(false),
     m_isInnerLayerAssociated(false),
     m_pParentPfo(nullptr)
@@ -364,6 +367,7 @@ NeutrinoHierarchyAlgorithm::PfoInfo::PfoInfo(const PfoInfo &rhs) :
     m_pCluster3D(rhs.m_pCluster3D),
     m_pVertex3D(rhs.m_pVertex3D),
     m_pSlidingFitResult3D(nullptr),
+    m_pPointingCluster3D(nullptr),
     m_isNeutrinoVertexAssociated(rhs.m_isNeutrinoVertexAssociated),
     m_isInnerLayerAssociated(rhs.m_isInnerLayerAssociated),
     m_pParentPfo(rhs.m_pParentPfo),
@@ -393,6 +397,9 @@ NeutrinoHierarchyAlgorithm::PfoInfo &NeutrinoHierarchyAlgorithm::PfoInfo::operat
         m_pParentPfo = rhs.m_pParentPfo;
         m_daughterPfoList = rhs.m_daughterPfoList;
 
+        delete m_pPointingCluster3D;
+        m_pPointingCluster3D = nullptr;
+
         delete m_pSlidingFitResult3D;
         m_pSlidingFitResult3D = new ThreeDSlidingFitResult(m_pCluster3D, rhs.m_pSlidingFitResult3D->GetFirstFitResult().GetLayerFitHalfWindow(),
             rhs.m_pSlidingFitResult3D->GetFirstFitResult().GetLayerPitch());
@@ -405,11 +412,23 @@ NeutrinoHierarchyAlgorithm::PfoInfo &NeutrinoHierarchyAlgorithm::PfoInfo::operat
 
 NeutrinoHierarchyAlgorithm::PfoInfo::~PfoInfo()
 {
+    delete m_pPointingCluster3D;
     delete m_pSlidingFitResult3D;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+const LArPointingCluster &NeutrinoHierarchyAlgorithm::PfoInfo::GetPointingCluster3D() const
+{
+    // ATTN Built on first request, rather than on construction, so that any exception is raised where it would be without caching
+    if (!m_pPointingCluster3D)
+        m_pPointingCluster3D = new LArPointingCluster(*m_pSlidingFitResult3D);
+
+    return *m_pPointingCluster3D;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void NeutrinoHierarchyAlgorithm::PfoInfo::SetNeutrinoVertexAssociation(const bool isNeutrinoVertexAssociated)
 {
     m_isNeutrinoVertexAssociated = isNeutrinoVertexAssociated;
@@ -17,6 +17,7 @@
 namespace lar_content
 {
 
+class LArPointingCluster;
 class PfoRelationTool;
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -87,6 +88,13 @@ public:
          */
         const ThreeDSlidingFitResult *GetSlidingFitResult3D() const;
 
+        /**
+         *  @brief  Get the three dimensional pointing cluster, built from the sliding fit result when first requested
+         *
+         *  @return the three dimensional pointing cluster
+         */
+        const LArPointingCluster &GetPointingCluster3D() const;
+
         /**
          *  @brief  Whether the pfo is associated with the neutrino vertex
          *
@@ -160,6 +168,7 @@ public:
         const pandora::Cluster *m_pCluster3D;          ///< The address of the three dimensional cluster
         const pandora::Vertex *m_pVertex3D;            ///< The address of the three dimensional vertex
         ThreeDSlidingFitResult *m_pSlidingFitResult3D; ///< The three dimensional sliding fit result
+        mutable LArPointingCluster *m_pPointingCluster3D; ///< The three dimensional pointing cluster, if built
 
         bool m_isNeutrinoVertexAssociated; ///< Whether the pfo is associated with the neutrino vertex
         bool m_isInnerLayerAssociated;     ///< If associated, whether association to parent (vtx or pfo) is at sliding fit inner layer
@@ -8,9 +8,10 @@
 
 #include "Pandora/AlgorithmHeaders.h"
 
-#include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 #include "larpandoracontent/LArHelpers/LArPfoHelper.h"
 
+#include "larpandoracontent/LArObjects/LArPfoHierarchySnapshot.h"
+
 #include "larpandoracontent/LArThreeDReco/LArEventBuilding/NeutrinoPropertiesAlgorithm.h"
 
 using namespace pandora;
@@ -67,9 +68,13 @@ void NeutrinoPropertiesAlgorithm::SetNeutrinoId(const ParticleFlowObject *const
     PfoVector daughterPfoVector(pNeutrinoPfo->GetDaughterPfoList().begin(), pNeutrinoPfo->GetDaughterPfoList().end());
     std::sort(daughterPfoVector.begin(), daughterPfoVector.end(), LArPfoHelper::SortByNHits);
 
+    // ATTN Hit counts for all daughter chains are aggregated in a single pass over the neutrino hierarchy
+    const PfoList neutrinoPfoList(1, pNeutrinoPfo);
+    const PfoHierarchySnapshot hierarchySnapshot(neutrinoPfoList);
+
     for (const ParticleFlowObject *const pDaughterPfo : daughterPfoVector)
     {
-        const unsigned int nTwoDHits(this->GetNTwoDHitsInPfoChain(pDaughterPfo));
+        const unsigned int nTwoDHits(hierarchySnapshot.GetNDownstreamTwoDHits(pDaughterPfo, m_includeIsolatedHits));
 
         if (!pPrimaryDaughter || (nTwoDHits > nPrimaryTwoDHits))
         {
@@ -102,33 +107,6 @@ void NeutrinoPropertiesAlgorithm::SetNeutrinoId(const ParticleFlowObject *const
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-unsigned int NeutrinoPropertiesAlgorithm::GetNTwoDHitsInPfoChain(const ParticleFlowObject *const pPfo) const
-{
-    unsigned int nTwoDHits(0);
-
-    for (const Cluster *const pCluster : pPfo->GetClusterList())
-    {
-        const HitType hitType(LArClusterHelper::GetClusterHitType(pCluster));
-
-        if ((TPC_VIEW_U == hitType) || (TPC_VIEW_V == hitType) || (TPC_VIEW_W == hitType))
-        {
-            nTwoDHits += pCluster->GetNCaloHits();
-
-            if (m_includeIsolatedHits)
-                nTwoDHits += pCluster->GetNIsolatedCaloHits();
-        }
-    }
-
-    for (const ParticleFlowObject *const pDaughterPfo : pPfo->GetDaughterPfoList())
-    {
-        nTwoDHits += this->GetNTwoDHitsInPfoChain(pDaughterPfo);
-    }
-
-    return nTwoDHits;
-}
-
-//------------------------------------------------------------------------------------------------------------------------------------------
-
 StatusCode NeutrinoPropertiesAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
 {
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "NeutrinoPfoListName", m_neutrinoPfoListName));
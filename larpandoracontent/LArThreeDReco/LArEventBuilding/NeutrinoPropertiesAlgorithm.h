@@ -34,15 +34,6 @@ private:
      */
     void SetNeutrinoId(const pandora::ParticleFlowObject *const pNeutrinoPfo) const;
 
-    /**
-     *  @brief  Get the number of two dimensional hits (TPC_VIEW_U, V or W) contained in clusters in a pfo and all its daughters
-     *
-     *  @param  pPfo address of the pfo
-     *
-     *  @return the number of two dimensional hits
-     */
-    unsigned int GetNTwoDHitsInPfoChain(const pandora::ParticleFlowObject *const pPfo) const;
-
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
     std::string m_neutrinoPfoListName; ///< The name of the output neutrino pfo list
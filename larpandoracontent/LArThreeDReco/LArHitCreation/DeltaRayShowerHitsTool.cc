@@ -51,6 +51,13 @@ void DeltaRayShowerHitsTool::Run(ThreeDHitCreationAlgorithm *const pAlgorithm, c
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+bool DeltaRayShowerHitsTool::UsesOtherPfoHits(const ParticleFlowObject *const pPfo) const
+{
+    return (LArPfoHelper::IsShower(pPfo) && (1 == pPfo->GetParentPfoList().size()));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void DeltaRayShowerHitsTool::CreateDeltaRayShowerHits3D(
     const CaloHitVector &inputTwoDHits, const CaloHitVector &parentHits3D, ProtoHitVector &protoHitVector) const
 {
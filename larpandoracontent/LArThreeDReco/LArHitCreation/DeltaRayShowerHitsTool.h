@@ -22,6 +22,8 @@ public:
     virtual void Run(ThreeDHitCreationAlgorithm *const pAlgorithm, const pandora::ParticleFlowObject *const pPfo,
         const pandora::CaloHitVector &inputTwoDHits, ProtoHitVector &protoHitVector);
 
+    bool UsesOtherPfoHits(const pandora::ParticleFlowObject *const pPfo) const;
+
 private:
     /**
      *  @brief  Create three dimensional hits, using a list of input two dimensional hits and the 3D hits from the parent particle
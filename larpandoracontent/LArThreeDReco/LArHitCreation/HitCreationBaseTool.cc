@@ -29,6 +29,13 @@ HitCreationBaseTool::~HitCreationBaseTool()
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+bool HitCreationBaseTool::UsesOtherPfoHits(const ParticleFlowObject *const) const
+{
+    return false;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void HitCreationBaseTool::GetBestPosition3D(const HitType hitType1, const HitType hitType2, const CartesianPointVector &fitPositionList1,
     const CartesianPointVector &fitPositionList2, ProtoHit &protoHit) const
 {
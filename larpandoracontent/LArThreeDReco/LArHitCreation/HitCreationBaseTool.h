@@ -46,6 +46,15 @@ public:
     virtual void Run(ThreeDHitCreationAlgorithm *const pAlgorithm, const pandora::ParticleFlowObject *const pPfo,
         const pandora::CaloHitVector &inputTwoDHits, ProtoHitVector &protoHitVector) = 0;
 
+    /**
+     *  @brief  Whether the tool, when run for a given pfo, may use the three dimensional hits created for other pfos
+     *
+     *  @param  pPfo the address of the pfo
+     *
+     *  @return boolean
+     */
+    virtual bool UsesOtherPfoHits(const pandora::ParticleFlowObject *const pPfo) const;
+
 protected:
     /**
      *  @brief  Get the three dimensional position using a provided two dimensional calo hit and candidate fit positions from the other two views
@@ -54,11 +54,15 @@ void ShowerHitsBaseTool::Run(ThreeDHitCreationAlgorithm *const pAlgorithm, const
 void ShowerHitsBaseTool::GetShowerHits3D(const CaloHitVector &inputTwoDHits, const CaloHitVector &caloHitVector1,
     const CaloHitVector &caloHitVector2, ProtoHitVector &protoHitVector) const
 {
+    // ATTN The filtered hit vectors are reused across input hits, to avoid reallocating them for every hit
+    CaloHitVector filteredHits1, filteredHits2;
+
     for (const CaloHit *const pCaloHit2D : inputTwoDHits)
     {
         try
         {
-            CaloHitVector filteredHits1, filteredHits2;
+            filteredHits1.clear();
+            filteredHits2.clear();
             this->FilterCaloHits(pCaloHit2D->GetPositionVector().GetX(), m_xTolerance, caloHitVector1, filteredHits1);
             this->FilterCaloHits(pCaloHit2D->GetPositionVector().GetX(), m_xTolerance, caloHitVector2, filteredHits2);
 
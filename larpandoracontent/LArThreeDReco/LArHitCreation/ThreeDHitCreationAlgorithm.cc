@@ -10,10 +10,14 @@
 
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
+#include "larpandoracontent/LArHelpers/LArMemoryAccountingHelper.h"
+#include "larpandoracontent/LArHelpers/LArParallelHelper.h"
 #include "larpandoracontent/LArHelpers/LArPfoHelper.h"
 
 #include "larpandoracontent/LArObjects/LArThreeDSlidingFitResult.h"
 
+#include "larpandoracontent/LArPlugins/LArPseudoLayerPlugin.h"
+
 #include "larpandoracontent/LArThreeDReco/LArHitCreation/HitCreationBaseTool.h"
 #include "larpandoracontent/LArThreeDReco/LArHitCreation/ThreeDHitCreationAlgorithm.h"
 
@@ -30,7 +34,8 @@ ThreeDHitCreationAlgorithm::ThreeDHitCreationAlgorithm() :
     m_slidingFitHalfWindow(10),
     m_nHitRefinementIterations(10),
     m_sigma3DFitMultiplier(0.2),
-    m_iterationMaxChi2Ratio(1.)
+    m_iterationMaxChi2Ratio(1.),
+    m_nPfoThreads(1)
 {
 }
 
@@ -66,30 +71,51 @@ StatusCode ThreeDHitCreationAlgorithm::Run()
     PfoVector pfoVector(pPfoList->begin(), pPfoList->end());
     std::sort(pfoVector.begin(), pfoVector.end(), LArPfoHelper::SortByNHits);
 
-    for (const ParticleFlowObject *const pPfo : pfoVector)
+    // ATTN The proto hits for a pfo depend only on that pfo, unless a tool uses the 3D hits of other pfos, so independent pfos can be
+    // treated up front, in parallel, with the 3D hits then created in the original order. Dependent pfos are treated as they are reached.
+    PfoProtoHitsVector pfoProtoHitsVector;
+    LArMemoryAccountingHelper::MemoryRecord protoHitMemoryRecord(LArMemoryAccountingHelper::PROTO_HIT_MEMORY);
+
+    if (1 != m_nPfoThreads)
     {
+        this->CalculateProtoHits(pfoVector, pfoProtoHitsVector);
+
+        for (const PfoProtoHits &pfoProtoHits : pfoProtoHitsVector)
+            protoHitMemoryRecord.Allocate(pfoProtoHits.m_protoHitVector.capacity() * sizeof(ProtoHit));
+    }
+
+    for (unsigned int pfoIndex = 0; pfoIndex < pfoVector.size(); ++pfoIndex)
+    {
+        const ParticleFlowObject *const pPfo(pfoVector.at(pfoIndex));
         ProtoHitVector protoHitVector;
 
-        for (HitCreationBaseTool *const pHitCreationTool : m_algorithmToolVector)
+        if ((pfoIndex < pfoProtoHitsVector.size()) && pfoProtoHitsVector.at(pfoIndex).m_isCalculated)
         {
-            CaloHitVector remainingTwoDHits;
-            this->SeparateTwoDHits(pPfo, protoHitVector, remainingTwoDHits);
+            PfoProtoHits &pfoProtoHits(pfoProtoHitsVector.at(pfoIndex));
 
-            if (remainingTwoDHits.empty())
-                break;
+            if (pfoProtoHits.m_pException)
+                std::rethrow_exception(pfoProtoHits.m_pException);
 
-            pHitCreationTool->Run(this, pPfo, remainingTwoDHits, protoHitVector);
+            protoHitVector.swap(pfoProtoHits.m_protoHitVector);
+        }
+        else
+        {
+            this->CalculateProtoHits(pPfo, protoHitVector);
+            protoHitMemoryRecord.Allocate(protoHitVector.capacity() * sizeof(ProtoHit));
         }
 
-        if ((m_iterateTrackHits && LArPfoHelper::IsTrack(pPfo)) || (m_iterateShowerHits && LArPfoHelper::IsShower(pPfo)))
-            this->IterativeTreatment(protoHitVector);
+        const std::size_t protoHitBytes(protoHitVector.capacity() * sizeof(ProtoHit));
 
         if (protoHitVector.empty())
+        {
+            protoHitMemoryRecord.Deallocate(protoHitBytes);
             continue;
+        }
 
         CaloHitList newThreeDHits;
         this->CreateThreeDHits(protoHitVector, newThreeDHits);
         this->AddThreeDHitsToPfo(pPfo, newThreeDHits);
+        protoHitMemoryRecord.Deallocate(protoHitBytes);
 
         allNewThreeDHits.insert(allNewThreeDHits.end(), newThreeDHits.begin(), newThreeDHits.end());
     }
@@ -102,6 +128,68 @@ StatusCode ThreeDHitCreationAlgorithm::Run()
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void ThreeDHitCreationAlgorithm::CalculateProtoHits(const ParticleFlowObject *const pPfo, ProtoHitVector &protoHitVector)
+{
+    for (HitCreationBaseTool *const pHitCreationTool : m_algorithmToolVector)
+    {
+        CaloHitVector remainingTwoDHits;
+        this->SeparateTwoDHits(pPfo, protoHitVector, remainingTwoDHits);
+
+        if (remainingTwoDHits.empty())
+            break;
+
+        pHitCreationTool->Run(this, pPfo, remainingTwoDHits, protoHitVector);
+    }
+
+    if ((m_iterateTrackHits && LArPfoHelper::IsTrack(pPfo)) || (m_iterateShowerHits && LArPfoHelper::IsShower(pPfo)))
+        this->IterativeTreatment(protoHitVector);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ThreeDHitCreationAlgorithm::CalculateProtoHits(const PfoVector &pfoVector, PfoProtoHitsVector &pfoProtoHitsVector)
+{
+    pfoProtoHitsVector.assign(pfoVector.size(), PfoProtoHits());
+    std::vector<unsigned int> independentPfoIndices;
+
+    for (unsigned int pfoIndex = 0; pfoIndex < pfoVector.size(); ++pfoIndex)
+    {
+        if (!this->UsesOtherPfoHits(pfoVector.at(pfoIndex)))
+            independentPfoIndices.push_back(pfoIndex);
+    }
+
+    // ATTN Exceptions are recorded, to be rethrown when the 3D hits for the pfo would have been created
+    LArParallelHelper::ForEach(independentPfoIndices.size(), m_nPfoThreads, [&](const unsigned int index) {
+        const unsigned int pfoIndex(independentPfoIndices.at(index));
+        PfoProtoHits &pfoProtoHits(pfoProtoHitsVector.at(pfoIndex));
+        pfoProtoHits.m_isCalculated = true;
+
+        try
+        {
+            this->CalculateProtoHits(pfoVector.at(pfoIndex), pfoProtoHits.m_protoHitVector);
+        }
+        catch (...)
+        {
+            pfoProtoHits.m_pException = std::current_exception();
+        }
+    });
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool ThreeDHitCreationAlgorithm::UsesOtherPfoHits(const ParticleFlowObject *const pPfo) const
+{
+    for (const HitCreationBaseTool *const pHitCreationTool : m_algorithmToolVector)
+    {
+        if (pHitCreationTool->UsesOtherPfoHits(pPfo))
+            return true;
+    }
+
+    return false;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void ThreeDHitCreationAlgorithm::SeparateTwoDHits(
     const ParticleFlowObject *const pPfo, const ProtoHitVector &protoHitVector, CaloHitVector &remainingHitVector) const
 {
@@ -151,23 +239,51 @@ void ThreeDHitCreationAlgorithm::IterativeTreatment(ProtoHitVector &protoHitVect
         double currentChi2(originalChi2 + originalChi2WrtFit);
 
         unsigned int nIterations(0);
+        CartesianPointVector newPoints3D;
+        std::vector<double> newChi2Vector;
 
         while (nIterations++ < m_nHitRefinementIterations)
         {
-            ProtoHitVector newProtoHitVector(protoHitVector);
-            const ThreeDSlidingFitResult newSlidingFitResult(&currentPoints3D, layerWindow, layerPitch);
-            this->RefineHitPositions(newSlidingFitResult, newProtoHitVector);
+            // ATTN The first iteration fits the original positions, so can reuse the original fit
+            if (1 == nIterations)
+            {
+                this->RefineHitPositions(originalSlidingFitResult, protoHitVector, newPoints3D, newChi2Vector);
+            }
+            else
+            {
+                const ThreeDSlidingFitResult newSlidingFitResult(&currentPoints3D, layerWindow, layerPitch);
+                this->RefineHitPositions(newSlidingFitResult, protoHitVector, newPoints3D, newChi2Vector);
+            }
 
             double newChi2(0.);
-            CartesianPointVector newPoints3D;
-            this->ExtractResults(newProtoHitVector, newChi2, newPoints3D);
+
+            for (const double chi2 : newChi2Vector)
+                newChi2 += chi2;
 
             if (newChi2 > m_iterationMaxChi2Ratio * currentChi2)
                 break;
 
+            bool isConverged(true);
+
+            for (unsigned int iHit = 0; iHit < protoHitVector.size(); ++iHit)
+            {
+                const CartesianVector &currentPosition(currentPoints3D.at(iHit)), &newPosition(newPoints3D.at(iHit));
+
+                if ((currentPosition.GetX() != newPosition.GetX()) || (currentPosition.GetY() != newPosition.GetY()) ||
+                    (currentPosition.GetZ() != newPosition.GetZ()))
+                {
+                    isConverged = false;
+                }
+
+                protoHitVector.at(iHit).SetPosition3D(newPosition, newChi2Vector.at(iHit));
+            }
+
             currentChi2 = newChi2;
-            currentPoints3D = newPoints3D;
-            protoHitVector = newProtoHitVector;
+            currentPoints3D.swap(newPoints3D);
+
+            // ATTN If no position has moved, the next fit would be unchanged and every later iteration would reproduce this one
+            if (isConverged)
+                break;
         }
     }
     catch (const StatusCodeException &)
@@ -248,20 +364,28 @@ double ThreeDHitCreationAlgorithm::GetHitMovementChi2(const ProtoHitVector &prot
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void ThreeDHitCreationAlgorithm::RefineHitPositions(const ThreeDSlidingFitResult &slidingFitResult, ProtoHitVector &protoHitVector) const
+void ThreeDHitCreationAlgorithm::RefineHitPositions(const ThreeDSlidingFitResult &slidingFitResult, const ProtoHitVector &protoHitVector,
+    CartesianPointVector &positionVector, std::vector<double> &chi2Vector) const
 {
+    positionVector.clear();
+    chi2Vector.clear();
+
     const double sigmaUVW(LArGeometryHelper::GetSigmaUVW(this->GetPandora()));
     const double sigmaFit(sigmaUVW); // ATTN sigmaFit and sigmaHit here should agree with treatment in HitCreation tools
     const double sigmaHit(sigmaUVW);
     const double sigma3DFit(sigmaUVW * m_sigma3DFitMultiplier);
 
-    for (ProtoHit &protoHit : protoHitVector)
+    for (const ProtoHit &protoHit : protoHitVector)
     {
         CartesianVector pointOnFit(0.f, 0.f, 0.f);
         const double rL(slidingFitResult.GetLongitudinalDisplacement(protoHit.GetPosition3D()));
 
         if (STATUS_CODE_SUCCESS != slidingFitResult.GetGlobalFitPosition(rL, pointOnFit))
+        {
+            positionVector.push_back(protoHit.GetPosition3D());
+            chi2Vector.push_back(protoHit.GetChi2());
             continue;
+        }
 
         const CaloHit *const pCaloHit2D(protoHit.GetParentCaloHit2D());
         const HitType hitType(pCaloHit2D->GetHitType());
@@ -313,7 +437,8 @@ void ThreeDHitCreationAlgorithm::RefineHitPositions(const ThreeDSlidingFitResult
             u, v, w, sigmaU, sigmaV, sigmaW, uFit, vFit, wFit, sigma3DFit, bestY, bestZ, chi2);
         position3D.SetValues(pCaloHit2D->GetPositionVector().GetX(), static_cast<float>(bestY), static_cast<float>(bestZ));
 
-        protoHit.SetPosition3D(position3D, chi2);
+        positionVector.push_back(position3D);
+        chi2Vector.push_back(chi2);
     }
 }
 
@@ -372,10 +497,20 @@ void ThreeDHitCreationAlgorithm::CreateThreeDHit(const ProtoHit &protoHit, const
 
 bool ThreeDHitCreationAlgorithm::CheckThreeDHit(const ProtoHit &protoHit) const
 {
+    const PseudoLayerPlugin *const pPseudoLayerPlugin(PandoraContentApi::GetPlugins(*this)->GetPseudoLayerPlugin());
+    const LArPseudoLayerPlugin *const pLArPseudoLayerPlugin(dynamic_cast<const LArPseudoLayerPlugin *>(pPseudoLayerPlugin));
+
+    // ATTN Use the inline arithmetic where available, avoiding an exception for every rejected hit
+    if (pLArPseudoLayerPlugin)
+    {
+        unsigned int pseudoLayer(0);
+        return pLArPseudoLayerPlugin->GetPseudoLayer(protoHit.GetPosition3D().GetZ(), pseudoLayer);
+    }
+
     try
     {
         // Check that corresponding pseudo layer is within range - TODO use full LArTPC geometry here
-        (void)PandoraContentApi::GetPlugins(*this)->GetPseudoLayerPlugin()->GetPseudoLayer(protoHit.GetPosition3D());
+        (void)pPseudoLayerPlugin->GetPseudoLayer(protoHit.GetPosition3D());
     }
     catch (StatusCodeException &)
     {
@@ -441,25 +576,31 @@ double ThreeDHitCreationAlgorithm::ProtoHit::GetChi2() const
 
 const ThreeDHitCreationAlgorithm::TrajectorySample &ThreeDHitCreationAlgorithm::ProtoHit::GetFirstTrajectorySample() const
 {
-    if (m_trajectorySampleVector.empty())
+    if (0 == m_nTrajectorySamples)
         throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
 
-    return m_trajectorySampleVector.front();
+    return m_firstTrajectorySample;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 const ThreeDHitCreationAlgorithm::TrajectorySample &ThreeDHitCreationAlgorithm::ProtoHit::GetLastTrajectorySample() const
 {
-    if (m_trajectorySampleVector.size() < 2)
+    if (m_nTrajectorySamples < 2)
         throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
 
-    return m_trajectorySampleVector.back();
+    return m_lastTrajectorySample;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+ThreeDHitCreationAlgorithm::PfoProtoHits::PfoProtoHits() : m_isCalculated(false)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode ThreeDHitCreationAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
 {
     AlgorithmToolVector algorithmToolVector;
@@ -497,6 +638,9 @@ StatusCode ThreeDHitCreationAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
     PANDORA_RETURN_RESULT_IF_AND_IF(
         STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "IterationMaxChi2Ratio", m_iterationMaxChi2Ratio));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "NPfoThreads", m_nPfoThreads));
+
     return STATUS_CODE_SUCCESS;
 }
 
@@ -11,6 +11,7 @@
 #include "Pandora/Algorithm.h"
 #include "Pandora/AlgorithmTool.h"
 
+#include <exception>
 #include <vector>
 
 namespace lar_content
@@ -153,11 +154,13 @@ public:
         void AddTrajectorySample(const TrajectorySample &trajectorySample);
 
     private:
-        const pandora::CaloHit *m_pParentCaloHit2D;      ///< The address of the parent 2D calo hit
-        bool m_isPositionSet;                            ///< Whether the output 3D position has been set
-        pandora::CartesianVector m_position3D;           ///< The output 3D position
-        double m_chi2;                                   ///< The output chi squared value
-        TrajectorySampleVector m_trajectorySampleVector; ///< The trajectory sample vector
+        const pandora::CaloHit *m_pParentCaloHit2D; ///< The address of the parent 2D calo hit
+        bool m_isPositionSet;                       ///< Whether the output 3D position has been set
+        pandora::CartesianVector m_position3D;      ///< The output 3D position
+        double m_chi2;                              ///< The output chi squared value
+        unsigned int m_nTrajectorySamples;          ///< The number of trajectory samples added
+        TrajectorySample m_firstTrajectorySample;   ///< The first trajectory sample added, if any
+        TrajectorySample m_lastTrajectorySample;    ///< The last trajectory sample added, if any
     };
 
     typedef std::vector<ProtoHit> ProtoHitVector;
@@ -178,8 +181,52 @@ public:
         const pandora::CaloHitVector &inputCaloHitVector, const pandora::HitType hitType, pandora::CaloHitVector &outputCaloHitVector) const;
 
 private:
+    /**
+     *  @brief  PfoProtoHits class, the outcome of calculating the proto hits for a pfo
+     */
+    class PfoProtoHits
+    {
+    public:
+        /**
+         *  @brief  Default constructor
+         */
+        PfoProtoHits();
+
+        bool m_isCalculated;             ///< Whether the proto hits have been calculated
+        ProtoHitVector m_protoHitVector; ///< The proto hits
+        std::exception_ptr m_pException; ///< The exception thrown when calculating the proto hits, if any
+    };
+
+    typedef std::vector<PfoProtoHits> PfoProtoHitsVector;
+
     pandora::StatusCode Run();
 
+    /**
+     *  @brief  Calculate the proto hits for a pfo, running the hit creation tools and any iterative treatment
+     *
+     *  @param  pPfo the address of the pfo
+     *  @param  protoHitVector to receive the proto hits
+     */
+    void CalculateProtoHits(const pandora::ParticleFlowObject *const pPfo, ProtoHitVector &protoHitVector);
+
+    /**
+     *  @brief  Calculate the proto hits for each pfo in a vector that does not depend on the 3D hits of other pfos, sharing the pfos
+     *          between a number of threads
+     *
+     *  @param  pfoVector the pfo vector
+     *  @param  pfoProtoHitsVector to receive the pfo proto hits, in pfo vector order
+     */
+    void CalculateProtoHits(const pandora::PfoVector &pfoVector, PfoProtoHitsVector &pfoProtoHitsVector);
+
+    /**
+     *  @brief  Whether any hit creation tool, when run for a given pfo, may use the three dimensional hits created for other pfos
+     *
+     *  @param  pPfo the address of the pfo
+     *
+     *  @return boolean
+     */
+    bool UsesOtherPfoHits(const pandora::ParticleFlowObject *const pPfo) const;
+
     /**
      *  @brief  Get the list of 2D calo hits in a pfo for which 3D hits have and have not been created
      *
@@ -226,12 +273,16 @@ private:
     double GetHitMovementChi2(const ProtoHitVector &protoHitVector) const;
 
     /**
-     *  @brief  Refine the 3D hit positions (and chi2) for a list of proto hits, in accordance with a provided 3D sliding fit trajectory
+     *  @brief  Refine the 3D hit positions (and chi2) for a list of proto hits, in accordance with a provided 3D sliding fit trajectory.
+     *          Hits for which no fit position is available retain their current position and chi2
      *
      *  @param  slidingFitResult the 3D sliding fit result
-     *  @param  protoHitVector the proto hit vector, non const as proto hit properties will be updated
+     *  @param  protoHitVector the proto hit vector
+     *  @param  positionVector to receive the refined 3D positions, in proto hit order
+     *  @param  chi2Vector to receive the refined chi2 values, in proto hit order
      */
-    void RefineHitPositions(const ThreeDSlidingFitResult &slidingFitResult, ProtoHitVector &protoHitVector) const;
+    void RefineHitPositions(const ThreeDSlidingFitResult &slidingFitResult, const ProtoHitVector &protoHitVector,
+        pandora::CartesianPointVector &positionVector, std::vector<double> &chi2Vector) const;
 
     /**
      *  @brief  Create new three dimensional hits from two dimensional hits
@@ -281,6 +332,7 @@ private:
     unsigned int m_nHitRefinementIterations; ///< The maximum number of hit refinement iterations
     double m_sigma3DFitMultiplier;           ///< Multiplicative factor: sigmaUVW (same as sigmaHit and sigma2DFit) to sigma3DFit
     double m_iterationMaxChi2Ratio;          ///< Max ratio between current and previous chi2 values to cease iterations
+    unsigned int m_nPfoThreads;              ///< The number of threads with which to calculate the pfo proto hits (zero for all)
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -321,7 +373,10 @@ inline ThreeDHitCreationAlgorithm::ProtoHit::ProtoHit(const pandora::CaloHit *co
     m_pParentCaloHit2D(pParentCaloHit2D),
     m_isPositionSet(false),
     m_position3D(0.f, 0.f, 0.f),
-    m_chi2(std::numeric_limits<double>::max())
+    m_chi2(std::numeric_limits<double>::max()),
+    m_nTrajectorySamples(0),
+    m_firstTrajectorySample(pandora::CartesianVector(0.f, 0.f, 0.f), pandora::HIT_CUSTOM, 0.),
+    m_lastTrajectorySample(pandora::CartesianVector(0.f, 0.f, 0.f), pandora::HIT_CUSTOM, 0.)
 {
 }
 
@@ -343,7 +398,7 @@ inline bool ThreeDHitCreationAlgorithm::ProtoHit::IsPositionSet() const
 
 inline unsigned int ThreeDHitCreationAlgorithm::ProtoHit::GetNTrajectorySamples() const
 {
-    return m_trajectorySampleVector.size();
+    return m_nTrajectorySamples;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -359,7 +414,12 @@ inline void ThreeDHitCreationAlgorithm::ProtoHit::SetPosition3D(const pandora::C
 
 inline void ThreeDHitCreationAlgorithm::ProtoHit::AddTrajectorySample(const TrajectorySample &trajectorySample)
 {
-    m_trajectorySampleVector.push_back(trajectorySample);
+    // ATTN Only the first and last samples are queried, so intermediate samples need not be held
+    if (0 == m_nTrajectorySamples)
+        m_firstTrajectorySample = trajectorySample;
+
+    m_lastTrajectorySample = trajectorySample;
+    ++m_nTrajectorySamples;
 }
 
 } // namespace lar_content
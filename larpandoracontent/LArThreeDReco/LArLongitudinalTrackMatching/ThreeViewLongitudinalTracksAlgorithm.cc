@@ -9,6 +9,7 @@
 #include "Pandora/AlgorithmHeaders.h"
 
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
+#include "larpandoracontent/LArHelpers/LArEventDeadlineHelper.h"
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
 
 #include "larpandoracontent/LArThreeDReco/LArLongitudinalTrackMatching/ThreeViewLongitudinalTracksAlgorithm.h"
@@ -204,6 +205,10 @@ void ThreeViewLongitudinalTracksAlgorithm::ExamineOverlapContainer()
 
     for (TensorToolVector::const_iterator iter = m_algorithmToolVector.begin(), iterEnd = m_algorithmToolVector.end(); iter != iterEnd;)
     {
+        // ATTN Stop at the event deadline, leaving the output of the completed tool runs
+        if (LArEventDeadlineHelper::IsDeadlineExceeded(this->GetPandora()))
+            break;
+
         if ((*iter)->Run(this, this->GetMatchingControl().GetOverlapTensor()))
         {
             iter = m_algorithmToolVector.begin();
@@ -247,6 +252,13 @@ StatusCode ThreeViewLongitudinalTracksAlgorithm::ReadSettings(const TiXmlHandle
     if (m_samplingPitch < std::numeric_limits<float>::epsilon())
         return STATUS_CODE_INVALID_PARAMETER;
 
+    // ATTN The overlap calculation only reads the cached sliding fits and the settings, so overlap results can be calculated in parallel
+    this->GetMatchingControl().SetOverlapFunction([this](const Cluster *const pClusterU, const Cluster *const pClusterV,
+                                                      const Cluster *const pClusterW, LongitudinalOverlapResult &overlapResult) {
+        this->CalculateOverlapResult(pClusterU, pClusterV, pClusterW, overlapResult);
+        return (overlapResult.IsInitialized() ? STATUS_CODE_SUCCESS : STATUS_CODE_NOT_FOUND);
+    });
+
     return BaseAlgorithm::ReadSettings(xmlHandle);
 }
 
@@ -8,6 +8,7 @@
 
 #include "Pandora/AlgorithmHeaders.h"
 
+#include "larpandoracontent/LArHelpers/LArEventDeadlineHelper.h"
 #include "larpandoracontent/LArHelpers/LArPfoHelper.h"
 
 #include "larpandoracontent/LArThreeDReco/LArPfoMopUp/RecursivePfoMopUpAlgorithm.h"
@@ -19,13 +20,24 @@ namespace lar_content
 
 StatusCode RecursivePfoMopUpAlgorithm::Run()
 {
+    if (0 == m_maxIterations)
+        return STATUS_CODE_SUCCESS;
+
     PfoMergeStatsList mergeStatsListBefore(this->GetPfoMergeStats());
 
     for (unsigned int iter = 0; iter < m_maxIterations; ++iter)
     {
+        // ATTN Stop at the event deadline, leaving the merges made by the completed iterations
+        if (LArEventDeadlineHelper::IsDeadlineExceeded(this->GetPandora()))
+            break;
+
         for (auto const &mopUpAlg : m_mopUpAlgorithms)
             PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::RunDaughterAlgorithm(*this, mopUpAlg));
 
+        // ATTN The stats after the final iteration could not change the outcome, so are not collected
+        if (iter + 1 == m_maxIterations)
+            break;
+
         PfoMergeStatsList mergeStatsListAfter(this->GetPfoMergeStats());
 
         if (std::equal(mergeStatsListBefore.cbegin(), mergeStatsListBefore.cend(), mergeStatsListAfter.cbegin(), mergeStatsListAfter.cend(), PfoMergeStatsComp))
@@ -41,6 +53,7 @@ StatusCode RecursivePfoMopUpAlgorithm::Run()
 
 RecursivePfoMopUpAlgorithm::PfoMergeStatsList RecursivePfoMopUpAlgorithm::GetPfoMergeStats() const
 {
+    static const std::string trackScoreName("TrackScore");
     PfoMergeStatsList pfoMergeStatsList;
 
     for (auto const &pfoListName : m_pfoListNames)
@@ -54,15 +67,16 @@ RecursivePfoMopUpAlgorithm::PfoMergeStatsList RecursivePfoMopUpAlgorithm::GetPfo
             ClusterNumHitsList pfoHits;
             ClusterList clusterList;
             LArPfoHelper::GetTwoDClusterList(pPfo, clusterList);
+            pfoHits.reserve(clusterList.size());
 
             for (auto const &cluster : clusterList)
                 pfoHits.push_back(cluster->GetNCaloHits());
 
             const PropertiesMap &pfoMeta(pPfo->GetPropertiesMap());
-            const auto &trackScoreIter(pfoMeta.find("TrackScore"));
+            const auto &trackScoreIter(pfoMeta.find(trackScoreName));
             const float trackScore(trackScoreIter != pfoMeta.end() ? trackScoreIter->second : -1.f);
 
-            pfoMergeStatsList.emplace_back(PfoMergeStats{pfoHits, trackScore});
+            pfoMergeStatsList.emplace_back(std::move(pfoHits), trackScore);
         }
     }
     return pfoMergeStatsList;
@@ -40,7 +40,7 @@ private:
          *  @param  Vector filled with number of hits in each of the PFO's clusters
          *  @param  MVA "Track Score" for the PFO
          */
-        PfoMergeStats(const ClusterNumHitsList &numClusterHits, const float trackScore);
+        PfoMergeStats(ClusterNumHitsList numClusterHits, const float trackScore);
 
         const ClusterNumHitsList m_numClusterHits; ///< Vector filled with number of hits in each of the PFO's clusters
         const float m_trackScore;                  ///< MVA "Track Score" for the PFO
@@ -81,8 +81,8 @@ inline RecursivePfoMopUpAlgorithm::RecursivePfoMopUpAlgorithm() : m_maxIteration
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-inline RecursivePfoMopUpAlgorithm::PfoMergeStats::PfoMergeStats(const ClusterNumHitsList &numClusterHits, const float trackScore) :
-    m_numClusterHits(numClusterHits),
+inline RecursivePfoMopUpAlgorithm::PfoMergeStats::PfoMergeStats(ClusterNumHitsList numClusterHits, const float trackScore) :
+    m_numClusterHits(std::move(numClusterHits)),
     m_trackScore(trackScore)
 {
 }
@@ -158,26 +158,30 @@ void SlidingConePfoMopUpAlgorithm::GetClusterMergeMap(const Vertex *const pVerte
             continue;
         }
 
+        const SimpleConeBatch simpleConeBatch(simpleConeList);
+
         for (const Cluster *const pNearbyCluster : clusters3D)
         {
             if (pNearbyCluster == pShowerCluster)
                 continue;
 
+            if (isShowerVertexAssociated && this->IsVertexAssociated(pNearbyCluster, pVertex, vertexAssociationMap))
+                continue;
+
+            FloatVector boundedFractions1, boundedFractions2;
+            simpleConeBatch.GetBoundedHitFractions(
+                pNearbyCluster, coneLength, m_coneTanHalfAngle1, m_coneTanHalfAngle2, boundedFractions1, boundedFractions2);
+
             ClusterMerge bestClusterMerge(nullptr, 0.f, 0.f);
 
-            for (const SimpleCone &simpleCone : simpleConeList)
+            for (unsigned int iCone = 0; iCone < simpleConeBatch.GetNCones(); ++iCone)
             {
-                const float boundedFraction1(simpleCone.GetBoundedHitFraction(pNearbyCluster, coneLength, m_coneTanHalfAngle1));
-                const float boundedFraction2(simpleCone.GetBoundedHitFraction(pNearbyCluster, coneLength, m_coneTanHalfAngle2));
-                const ClusterMerge clusterMerge(pShowerCluster, boundedFraction1, boundedFraction2);
+                const ClusterMerge clusterMerge(pShowerCluster, boundedFractions1.at(iCone), boundedFractions2.at(iCone));
 
                 if (clusterMerge < bestClusterMerge)
                     bestClusterMerge = clusterMerge;
             }
 
-            if (isShowerVertexAssociated && this->IsVertexAssociated(pNearbyCluster, pVertex, vertexAssociationMap))
-                continue;
-
             if (bestClusterMerge.GetParentCluster() && (bestClusterMerge.GetBoundedFraction1() > m_coneBoundedFraction1) &&
                 (bestClusterMerge.GetBoundedFraction2() > m_coneBoundedFraction2))
                 clusterMergeMap[pNearbyCluster].push_back(bestClusterMerge);
@@ -44,6 +44,9 @@ VertexBasedPfoMopUpAlgorithm::VertexBasedPfoMopUpAlgorithm() :
 
 StatusCode VertexBasedPfoMopUpAlgorithm::Run()
 {
+    // ATTN The daughter cluster bounding boxes used to pre-check each cluster association are only cached within a geometry cache scope
+    const LArClusterHelper::GeometryCacheScope geometryCacheScope;
+
     const VertexList *pVertexList = nullptr;
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_INITIALIZED, !=, PandoraContentApi::GetCurrentList(*this, pVertexList));
 
@@ -58,6 +61,9 @@ StatusCode VertexBasedPfoMopUpAlgorithm::Run()
         return STATUS_CODE_SUCCESS;
     }
 
+    m_clusterAssociationMap.clear();
+    m_coneParametersMap.clear();
+
     while (true)
     {
         PfoList vertexPfos, nonVertexPfos;
@@ -73,6 +79,9 @@ StatusCode VertexBasedPfoMopUpAlgorithm::Run()
             break;
     }
 
+    m_clusterAssociationMap.clear();
+    m_coneParametersMap.clear();
+
     return STATUS_CODE_SUCCESS;
 }
 
@@ -208,11 +217,20 @@ VertexBasedPfoMopUpAlgorithm::PfoAssociation VertexBasedPfoMopUpAlgorithm::GetPf
 VertexBasedPfoMopUpAlgorithm::ClusterAssociation VertexBasedPfoMopUpAlgorithm::GetClusterAssociation(
     const Vertex *const pVertex, const Cluster *const pVertexCluster, const Cluster *const pDaughterCluster) const
 {
-    const HitType vertexHitType(LArClusterHelper::GetClusterHitType(pVertexCluster));
-    const CartesianVector vertexPosition2D(LArGeometryHelper::ProjectPosition(this->GetPandora(), pVertex->GetPosition(), vertexHitType));
+    const ClusterPair clusterPair(pVertexCluster, pDaughterCluster);
+    const ClusterPairToAssociationMap::const_iterator iter(m_clusterAssociationMap.find(clusterPair));
 
-    const ConeParameters coneParameters(pVertexCluster, vertexPosition2D, m_coneAngleCentile, m_maxConeCosHalfAngle);
-    const float boundedFraction(coneParameters.GetBoundedFraction(pDaughterCluster, m_maxConeLengthMultiplier));
+    if (m_clusterAssociationMap.end() != iter)
+        return iter->second;
+
+    const ConeParameters &coneParameters(this->GetConeParameters(pVertex, pVertexCluster));
+    CartesianVector minPosition(0.f, 0.f, 0.f), maxPosition(0.f, 0.f, 0.f);
+    LArClusterHelper::GetClusterBoundingBox(pDaughterCluster, minPosition, maxPosition);
+
+    // ATTN The bounded fraction is zero, exactly as if calculated, for daughter clusters wholly in front of, or behind, the cone
+    const bool isUnbounded((pDaughterCluster->GetNCaloHits() > 0) &&
+        coneParameters.IsUnbounded(minPosition, maxPosition, m_maxConeLengthMultiplier));
+    const float boundedFraction(isUnbounded ? 0.f : coneParameters.GetBoundedFraction(pDaughterCluster, m_maxConeLengthMultiplier));
 
     const LArVertexHelper::ClusterDirection vertexClusterDirection(
         LArVertexHelper::GetClusterDirectionInZ(this->GetPandora(), pVertex, pVertexCluster, m_directionTanAngle, m_directionApexShift));
@@ -220,7 +238,52 @@ VertexBasedPfoMopUpAlgorithm::ClusterAssociation VertexBasedPfoMopUpAlgorithm::G
         LArVertexHelper::GetClusterDirectionInZ(this->GetPandora(), pVertex, pDaughterCluster, m_directionTanAngle, m_directionApexShift));
     const bool isConsistentDirection(vertexClusterDirection == daughterClusterDirection);
 
-    return ClusterAssociation(pVertexCluster, pDaughterCluster, boundedFraction, isConsistentDirection);
+    const ClusterAssociation clusterAssociation(pVertexCluster, pDaughterCluster, boundedFraction, isConsistentDirection);
+    m_clusterAssociationMap.emplace(clusterPair, clusterAssociation);
+
+    return clusterAssociation;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const VertexBasedPfoMopUpAlgorithm::ConeParameters &VertexBasedPfoMopUpAlgorithm::GetConeParameters(
+    const Vertex *const pVertex, const Cluster *const pVertexCluster) const
+{
+    const ClusterToConeParametersMap::const_iterator iter(m_coneParametersMap.find(pVertexCluster));
+
+    if (m_coneParametersMap.end() != iter)
+        return iter->second;
+
+    const HitType vertexHitType(LArClusterHelper::GetClusterHitType(pVertexCluster));
+    const CartesianVector vertexPosition2D(LArGeometryHelper::ProjectPosition(this->GetPandora(), pVertex->GetPosition(), vertexHitType));
+
+    const ConeParameters coneParameters(pVertexCluster, vertexPosition2D, m_coneAngleCentile, m_maxConeCosHalfAngle);
+    return m_coneParametersMap.emplace(pVertexCluster, coneParameters).first->second;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void VertexBasedPfoMopUpAlgorithm::RemoveCachedClusters(const PfoList &pfoList) const
+{
+    ClusterSet clusterSet;
+
+    for (const Pfo *const pPfo : pfoList)
+        clusterSet.insert(pPfo->GetClusterList().begin(), pPfo->GetClusterList().end());
+
+    for (const Cluster *const pCluster : clusterSet)
+        m_coneParametersMap.erase(pCluster);
+
+    for (ClusterPairToAssociationMap::iterator iter = m_clusterAssociationMap.begin(); iter != m_clusterAssociationMap.end();)
+    {
+        if (clusterSet.count(iter->first.first) || clusterSet.count(iter->first.second))
+        {
+            iter = m_clusterAssociationMap.erase(iter);
+        }
+        else
+        {
+            ++iter;
+        }
+    }
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -278,6 +341,7 @@ void VertexBasedPfoMopUpAlgorithm::MergePfos(const PfoAssociation &pfoAssociatio
     const Pfo *pDaughterPfo(pfoAssociation.GetDaughterPfo());
     const bool isDaughterShower(pShowerPfoList && (pShowerPfoList->end() != std::find(pShowerPfoList->begin(), pShowerPfoList->end(), pDaughterPfo)));
 
+    this->RemoveCachedClusters(PfoList{pVertexPfo, pDaughterPfo});
     this->MergeAndDeletePfos(pVertexPfo, pDaughterPfo);
 
     if (isvertexTrack && isDaughterShower)
@@ -438,6 +502,28 @@ float VertexBasedPfoMopUpAlgorithm::ConeParameters::GetBoundedFraction(const Clu
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+bool VertexBasedPfoMopUpAlgorithm::ConeParameters::IsUnbounded(
+    const CartesianVector &minPosition, const CartesianVector &maxPosition, const float coneLengthMultiplier) const
+{
+    // ATTN Padding absorbs rounding differences with the per-hit projections, and keeps hits clear of the apex, where angles are undefined
+    const float padding(0.01f);
+    const CartesianVector minDisplacement(minPosition - m_apex), maxDisplacement(maxPosition - m_apex);
+
+    const float dX1(m_direction.GetX() * minDisplacement.GetX()), dX2(m_direction.GetX() * maxDisplacement.GetX());
+    const float dY1(m_direction.GetY() * minDisplacement.GetY()), dY2(m_direction.GetY() * maxDisplacement.GetY());
+    const float dZ1(m_direction.GetZ() * minDisplacement.GetZ()), dZ2(m_direction.GetZ() * maxDisplacement.GetZ());
+
+    const float minProjection(std::min(dX1, dX2) + std::min(dY1, dY2) + std::min(dZ1, dZ2));
+    const float maxProjection(std::max(dX1, dX2) + std::max(dY1, dY2) + std::max(dZ1, dZ2));
+
+    if (minProjection > std::max(0.f, coneLengthMultiplier * m_coneLength) + padding)
+        return true;
+
+    return ((m_coneCosHalfAngle > 0.f) && (maxProjection < -padding));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 CartesianVector VertexBasedPfoMopUpAlgorithm::ConeParameters::GetDirectionEstimate() const
 {
     const OrderedCaloHitList &orderedCaloHitList(m_pCluster->GetOrderedCaloHitList());
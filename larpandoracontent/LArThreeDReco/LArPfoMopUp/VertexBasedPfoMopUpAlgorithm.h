@@ -212,6 +212,18 @@ protected:
          */
         float GetBoundedFraction(const pandora::Cluster *const pDaughterCluster, const float coneLengthMultiplier) const;
 
+        /**
+         *  @brief  Whether a bounding box is certain to contain no hits bounded by the cone, and no hits at the cone apex
+         *
+         *  @param  minPosition the minimum position of the bounding box
+         *  @param  maxPosition the maximum position of the bounding box
+         *  @param  coneLengthMultiplier cnsider hits as bound if inside cone with projected distance less than N times cone length
+         *
+         *  @return boolean
+         */
+        bool IsUnbounded(const pandora::CartesianVector &minPosition, const pandora::CartesianVector &maxPosition,
+            const float coneLengthMultiplier) const;
+
     private:
         /**
          *  @brief  Get the cone direction estimate, with apex fixed at the 2d vertex position
@@ -323,6 +335,23 @@ protected:
     ClusterAssociation GetClusterAssociation(const pandora::Vertex *const pVertex, const pandora::Cluster *const pVertexCluster,
         const pandora::Cluster *const pDaughterCluster) const;
 
+    /**
+     *  @brief  Get the cone parameters for a vertex-associated cluster, calculating them if not already held
+     *
+     *  @param  pVertex the address of the vertex
+     *  @param  pVertexCluster the address of the vertex-associated cluster
+     *
+     *  @return the cone parameters
+     */
+    const ConeParameters &GetConeParameters(const pandora::Vertex *const pVertex, const pandora::Cluster *const pVertexCluster) const;
+
+    /**
+     *  @brief  Remove the held associations and cone parameters involving the clusters of the given pfos, which are to be modified
+     *
+     *  @param  pfoList the list of pfos
+     */
+    void RemoveCachedClusters(const pandora::PfoList &pfoList) const;
+
     /**
      *  @brief  Process the list of pfo associations, merging the best-matching pfo
      *
@@ -343,6 +372,9 @@ protected:
 
     typedef std::set<pandora::HitType> HitTypeSet;
     typedef std::map<pandora::HitType, const pandora::Cluster *> HitTypeToClusterMap;
+    typedef std::pair<const pandora::Cluster *, const pandora::Cluster *> ClusterPair;
+    typedef std::map<ClusterPair, ClusterAssociation> ClusterPairToAssociationMap;
+    typedef std::unordered_map<const pandora::Cluster *, ConeParameters> ClusterToConeParametersMap;
 
     std::string m_trackPfoListName;  ///< The input track pfo list name
     std::string m_showerPfoListName; ///< The input shower pfo list name
@@ -364,6 +396,9 @@ protected:
 
     unsigned int m_minConsistentDirections;      ///< The minimum number of consistent cluster directions to allow a pfo merge
     unsigned int m_minConsistentDirectionsTrack; ///< The minimum number of consistent cluster directions to allow a merge involving a track pfo
+
+    mutable ClusterPairToAssociationMap m_clusterAssociationMap; ///< The cluster associations, held across merge rounds
+    mutable ClusterToConeParametersMap m_coneParametersMap;      ///< The vertex cluster cone parameters, held across merge rounds
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
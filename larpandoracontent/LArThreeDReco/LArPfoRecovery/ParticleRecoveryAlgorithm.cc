@@ -11,6 +11,7 @@
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
 #include "larpandoracontent/LArHelpers/LArPointingClusterHelper.h"
+#include "larpandoracontent/LArHelpers/LArSlidingFitCacheHelper.h"
 
 #include "larpandoracontent/LArObjects/LArPointingCluster.h"
 
@@ -187,14 +188,84 @@ void ParticleRecoveryAlgorithm::VertexClusterSelection(const ClusterList &inputC
 
 void ParticleRecoveryAlgorithm::FindOverlaps(const ClusterList &clusterList1, const ClusterList &clusterList2, SimpleOverlapTensor &overlapTensor) const
 {
-    for (ClusterList::const_iterator iter1 = clusterList1.begin(), iter1End = clusterList1.end(); iter1 != iter1End; ++iter1)
+    FloatVector xMinValues1, xMaxValues1, xMinValues2, xMaxValues2;
+
+    // ATTN Without gap treatment, clusters can only overlap convincingly if their x spans intersect, so other pairs need not be examined.
+    // Any cluster for which IsOverlap would throw prompts the full comparison, so that exceptions are unchanged.
+    const bool noGapTreatment(!m_checkGaps || PandoraContentApi::GetGeometry(*this)->GetDetectorGapList().empty());
+    const bool useXSpanSearch((m_minXOverlapFraction > 0.f) && noGapTreatment && this->GetXSpans(clusterList1, xMinValues1, xMaxValues1) &&
+        this->GetXSpans(clusterList2, xMinValues2, xMaxValues2));
+
+    if (!useXSpanSearch)
     {
-        for (ClusterList::const_iterator iter2 = clusterList2.begin(), iter2End = clusterList2.end(); iter2 != iter2End; ++iter2)
+        for (ClusterList::const_iterator iter1 = clusterList1.begin(), iter1End = clusterList1.end(); iter1 != iter1End; ++iter1)
         {
-            if (this->IsOverlap(*iter1, *iter2))
-                overlapTensor.AddAssociation(*iter1, *iter2);
+            for (ClusterList::const_iterator iter2 = clusterList2.begin(), iter2End = clusterList2.end(); iter2 != iter2End; ++iter2)
+            {
+                if (this->IsOverlap(*iter1, *iter2))
+                    overlapTensor.AddAssociation(*iter1, *iter2);
+            }
         }
+
+        return;
     }
+
+    const ClusterVector clusterVector2(clusterList2.begin(), clusterList2.end());
+    std::vector<std::pair<float, unsigned int>> sortedXMinValues2;
+
+    for (unsigned int index2 = 0; index2 < clusterVector2.size(); ++index2)
+        sortedXMinValues2.emplace_back(xMinValues2.at(index2), index2);
+
+    std::sort(sortedXMinValues2.begin(), sortedXMinValues2.end());
+
+    unsigned int index1(0);
+    std::vector<unsigned int> candidateIndices2;
+
+    for (const Cluster *const pCluster1 : clusterList1)
+    {
+        const float xMin1(xMinValues1.at(index1)), xMax1(xMaxValues1.at(index1));
+        ++index1;
+
+        candidateIndices2.clear();
+        const auto endIter(std::lower_bound(sortedXMinValues2.begin(), sortedXMinValues2.end(), std::make_pair(xMax1, 0u)));
+
+        for (auto iter = sortedXMinValues2.begin(); iter != endIter; ++iter)
+        {
+            if (xMaxValues2.at(iter->second) > xMin1)
+                candidateIndices2.push_back(iter->second);
+        }
+
+        // ATTN Examine candidates in input order, so that associations are added to the tensor as before
+        std::sort(candidateIndices2.begin(), candidateIndices2.end());
+
+        for (const unsigned int index2 : candidateIndices2)
+        {
+            if (this->IsOverlap(pCluster1, clusterVector2.at(index2)))
+                overlapTensor.AddAssociation(pCluster1, clusterVector2.at(index2));
+        }
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool ParticleRecoveryAlgorithm::GetXSpans(const ClusterList &clusterList, FloatVector &xMinValues, FloatVector &xMaxValues) const
+{
+    for (const Cluster *const pCluster : clusterList)
+    {
+        if (0 == pCluster->GetNCaloHits())
+            return false;
+
+        float xMin(0.f), xMax(0.f);
+        pCluster->GetClusterSpanX(xMin, xMax);
+
+        if ((xMax - xMin) < std::numeric_limits<float>::epsilon())
+            return false;
+
+        xMinValues.push_back(xMin);
+        xMaxValues.push_back(xMax);
+    }
+
+    return true;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -259,12 +330,13 @@ void ParticleRecoveryAlgorithm::CalculateEffectiveOverlapFractions(const Cluster
 void ParticleRecoveryAlgorithm::CalculateEffectiveSpan(
     const pandora::Cluster *const pCluster, const float xMin, const float xMax, float &xMinEff, float &xMaxEff) const
 {
-    // TODO cache sliding linear fit results and optimise protection against exceptions from TwoDSlidingFitResult and IsXSamplingPointInGap
+    // TODO optimise protection against exceptions from TwoDSlidingFitResult and IsXSamplingPointInGap
     try
     {
         const float slidingFitPitch(LArGeometryHelper::GetWireZPitch(this->GetPandora()));
 
-        const TwoDSlidingFitResult slidingFitResult(pCluster, m_slidingFitHalfWindow, slidingFitPitch);
+        const TwoDSlidingFitResult &slidingFitResult(
+            LArSlidingFitCacheHelper::GetSlidingFitResult(this->GetPandora(), pCluster, m_slidingFitHalfWindow, slidingFitPitch));
 
         const int nSamplingPointsLeft(1 + static_cast<int>((xMinEff - xMin) / m_sampleStepSize));
         const int nSamplingPointsRight(1 + static_cast<int>((xMax - xMaxEff) / m_sampleStepSize));
@@ -363,9 +435,9 @@ bool ParticleRecoveryAlgorithm::CheckConsistency(const Cluster *const pClusterU,
         return false;
     }
 
-    const float uv2w(LArGeometryHelper::MergeTwoPositions(this->GetPandora(), TPC_VIEW_U, TPC_VIEW_V, u, v));
-    const float vw2u(LArGeometryHelper::MergeTwoPositions(this->GetPandora(), TPC_VIEW_V, TPC_VIEW_W, v, w));
-    const float wu2v(LArGeometryHelper::MergeTwoPositions(this->GetPandora(), TPC_VIEW_W, TPC_VIEW_U, w, u));
+    const float uv2w(LArGeometryHelper::MergeTwoPositions<TPC_VIEW_U, TPC_VIEW_V>(this->GetPandora(), u, v));
+    const float vw2u(LArGeometryHelper::MergeTwoPositions<TPC_VIEW_V, TPC_VIEW_W>(this->GetPandora(), v, w));
+    const float wu2v(LArGeometryHelper::MergeTwoPositions<TPC_VIEW_W, TPC_VIEW_U>(this->GetPandora(), w, u));
 
     const float pseudoChi2(((u - vw2u) * (u - vw2u) + (v - wu2v) * (v - wu2v) + (w - uv2w) * (w - uv2w)) / 3.f);
 
@@ -421,21 +493,21 @@ void ParticleRecoveryAlgorithm::SimpleOverlapTensor::AddAssociation(const Cluste
     {
         m_clusterNavigationMapUV[pClusterU].push_back(pClusterV);
 
-        if (m_keyClusters.end() == std::find(m_keyClusters.begin(), m_keyClusters.end(), pClusterU))
+        if (m_keyClusterSet.insert(pClusterU).second)
             m_keyClusters.push_back(pClusterU);
     }
     else if (!pClusterU && pClusterV && pClusterW)
     {
         m_clusterNavigationMapVW[pClusterV].push_back(pClusterW);
 
-        if (m_keyClusters.end() == std::find(m_keyClusters.begin(), m_keyClusters.end(), pClusterV))
+        if (m_keyClusterSet.insert(pClusterV).second)
             m_keyClusters.push_back(pClusterV);
     }
     else if (pClusterU && !pClusterV && pClusterW)
     {
         m_clusterNavigationMapWU[pClusterW].push_back(pClusterU);
 
-        if (m_keyClusters.end() == std::find(m_keyClusters.begin(), m_keyClusters.end(), pClusterW))
+        if (m_keyClusterSet.insert(pClusterW).second)
             m_keyClusters.push_back(pClusterW);
     }
     else
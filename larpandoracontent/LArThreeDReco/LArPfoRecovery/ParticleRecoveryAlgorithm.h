@@ -64,6 +64,7 @@ private:
         typedef std::unordered_map<const pandora::Cluster *, pandora::ClusterList> ClusterNavigationMap;
 
         pandora::ClusterList m_keyClusters;            ///< The list of key clusters
+        pandora::ClusterSet m_keyClusterSet;           ///< The set of key clusters, for fast lookup
         ClusterNavigationMap m_clusterNavigationMapUV; ///< The cluster navigation map U->V
         ClusterNavigationMap m_clusterNavigationMapVW; ///< The cluster navigation map V->W
         ClusterNavigationMap m_clusterNavigationMapWU; ///< The cluster navigation map W->U
@@ -113,6 +114,17 @@ private:
      */
     void FindOverlaps(const pandora::ClusterList &clusterList1, const pandora::ClusterList &clusterList2, SimpleOverlapTensor &overlapTensor) const;
 
+    /**
+     *  @brief  Get the x spans of the clusters in a list, provided that no cluster is empty or has a vanishing x span
+     *
+     *  @param  clusterList the cluster list
+     *  @param  xMinValues to receive the min x value of each cluster, in list order
+     *  @param  xMaxValues to receive the max x value of each cluster, in list order
+     *
+     *  @return whether all clusters have non-vanishing x spans
+     */
+    bool GetXSpans(const pandora::ClusterList &clusterList, pandora::FloatVector &xMinValues, pandora::FloatVector &xMaxValues) const;
+
     /**
      *  @brief  Whether two clusters overlap convincingly in x
      *
@@ -13,6 +13,7 @@
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
 #include "larpandoracontent/LArHelpers/LArPointingClusterHelper.h"
+#include "larpandoracontent/LArHelpers/LArSlidingFitCacheHelper.h"
 
 using namespace pandora;
 
@@ -119,8 +120,10 @@ void VertexBasedPfoRecoveryAlgorithm::BuildSlidingFitResultMap(const ClusterVect
         {
             try
             {
-                const TwoDSlidingFitResult slidingFitResult(*iter, m_slidingFitHalfWindow, slidingFitPitch);
-                const LArPointingCluster pointingCluster(slidingFitResult);
+                const TwoDSlidingFitResult &slidingFitResult(
+                    LArSlidingFitCacheHelper::GetSlidingFitResult(this->GetPandora(), *iter, m_slidingFitHalfWindow, slidingFitPitch));
+                const LArPointingCluster &pointingCluster(
+                    LArSlidingFitCacheHelper::GetPointingCluster(this->GetPandora(), *iter, m_slidingFitHalfWindow, slidingFitPitch));
 
                 if (pointingCluster.GetLengthSquared() < std::numeric_limits<float>::epsilon())
                     continue;
@@ -52,6 +52,10 @@ void ConnectedRemnantsTool::FindConnectedShowers(
         if (!pKeyCluster->IsAvailable())
             continue;
 
+        // ATTN Elements connected to a used key cluster are all connected to an earlier key cluster, so already include a used cluster
+        if (usedClusters.count(pKeyCluster))
+            continue;
+
         TensorType::ElementList connectedElements;
         overlapTensor.GetConnectedElements(pKeyCluster, true, connectedElements);
 
@@ -46,6 +46,10 @@ void MopUpRemnantsTool::FindBestShowers(const TensorType &overlapTensor, ProtoPa
         if (!pKeyCluster->IsAvailable())
             continue;
 
+        // ATTN Elements connected to a used key cluster are all connected to an earlier key cluster, so already include a used cluster
+        if (usedClusters.count(pKeyCluster))
+            continue;
+
         TensorType::ElementList connectedElements;
         overlapTensor.GetConnectedElements(pKeyCluster, true, connectedElements);
 
@@ -71,9 +71,9 @@ void ThreeViewRemnantsAlgorithm::CalculateOverlapResult(const Cluster *const pCl
         return;
     }
 
-    const float uv2w(LArGeometryHelper::MergeTwoPositions(this->GetPandora(), TPC_VIEW_U, TPC_VIEW_V, u, v));
-    const float vw2u(LArGeometryHelper::MergeTwoPositions(this->GetPandora(), TPC_VIEW_V, TPC_VIEW_W, v, w));
-    const float wu2v(LArGeometryHelper::MergeTwoPositions(this->GetPandora(), TPC_VIEW_W, TPC_VIEW_U, w, u));
+    const float uv2w(LArGeometryHelper::MergeTwoPositions<TPC_VIEW_U, TPC_VIEW_V>(this->GetPandora(), u, v));
+    const float vw2u(LArGeometryHelper::MergeTwoPositions<TPC_VIEW_V, TPC_VIEW_W>(this->GetPandora(), v, w));
+    const float wu2v(LArGeometryHelper::MergeTwoPositions<TPC_VIEW_W, TPC_VIEW_U>(this->GetPandora(), w, u));
 
     const float pseudoChi2(((u - vw2u) * (u - vw2u) + (v - wu2v) * (v - wu2v) + (w - uv2w) * (w - uv2w)) / 3.f);
 
@@ -135,6 +135,15 @@ StatusCode ThreeViewRemnantsAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
 
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "PseudoChi2Cut", m_pseudoChi2Cut));
 
+    // ATTN Triplets whose x spans, widened by the overlap window, have no mutual x overlap never form overlap results, so can be skipped
+    this->GetMatchingControl().SetXSpanFunction(
+        [this](const Cluster *const pCluster, float &minX, float &maxX) {
+            pCluster->GetClusterSpanX(minX, maxX);
+            minX -= m_xOverlapWindow;
+            maxX += m_xOverlapWindow;
+        },
+        std::numeric_limits<float>::epsilon());
+
     return BaseAlgorithm::ReadSettings(xmlHandle);
 }
 
@@ -9,10 +9,14 @@
 #include "Pandora/AlgorithmHeaders.h"
 
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
+#include "larpandoracontent/LArHelpers/LArEventDeadlineHelper.h"
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
 
 #include "larpandoracontent/LArThreeDReco/LArShowerMatching/ThreeViewShowersAlgorithm.h"
 
+#include <algorithm>
+#include <utility>
+
 using namespace pandora;
 
 namespace lar_content
@@ -128,6 +132,7 @@ void ThreeViewShowersAlgorithm::PrepareInputClusters(ClusterList &preparedCluste
 void ThreeViewShowersAlgorithm::TidyUp()
 {
     m_slidingFitResultMap.clear();
+    m_hitPositionMap.clear();
     return BaseAlgorithm::TidyUp();
 }
 
@@ -140,6 +145,20 @@ void ThreeViewShowersAlgorithm::AddToSlidingFitCache(const Cluster *const pClust
 
     if (!m_slidingFitResultMap.insert(TwoDSlidingShowerFitResultMap::value_type(pCluster, slidingShowerFitResult)).second)
         throw StatusCodeException(STATUS_CODE_FAILURE);
+
+    HitPositionVector hitPositionVector;
+    hitPositionVector.reserve(pCluster->GetNCaloHits());
+
+    for (const OrderedCaloHitList::value_type &layerEntry : pCluster->GetOrderedCaloHitList())
+    {
+        for (const CaloHit *const pCaloHit : *layerEntry.second)
+            hitPositionVector.emplace_back(pCaloHit->GetPositionVector().GetX(), pCaloHit->GetPositionVector().GetZ());
+    }
+
+    std::sort(hitPositionVector.begin(), hitPositionVector.end());
+
+    if (!m_hitPositionMap.insert(HitPositionMap::value_type(pCluster, std::move(hitPositionVector))).second)
+        throw StatusCodeException(STATUS_CODE_FAILURE);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -150,6 +169,8 @@ void ThreeViewShowersAlgorithm::RemoveFromSlidingFitCache(const Cluster *const p
 
     if (m_slidingFitResultMap.end() != iter)
         m_slidingFitResultMap.erase(iter);
+
+    m_hitPositionMap.erase(pCluster);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -222,6 +243,9 @@ void ThreeViewShowersAlgorithm::GetShowerPositionMaps(const TwoDSlidingShowerFit
 {
     const unsigned int nPoints(static_cast<unsigned int>(xSampling.m_nPoints));
 
+    FloatVector xValues;
+    IntVector xBins;
+
     for (unsigned n = 0; n <= nPoints; ++n)
     {
         const float x(xSampling.m_minX + (xSampling.m_maxX - xSampling.m_minX) * static_cast<float>(n) / static_cast<float>(nPoints));
@@ -230,10 +254,20 @@ void ThreeViewShowersAlgorithm::GetShowerPositionMaps(const TwoDSlidingShowerFit
         if (STATUS_CODE_SUCCESS != xSampling.GetBin(x, xBin))
             continue;
 
-        FloatVector uValues, vValues, wValues;
-        fitResultU.GetShowerEdges(x, true, uValues);
-        fitResultV.GetShowerEdges(x, true, vValues);
-        fitResultW.GetShowerEdges(x, true, wValues);
+        xValues.push_back(x);
+        xBins.push_back(xBin);
+    }
+
+    std::vector<FloatVector> uValuesVector, vValuesVector, wValuesVector;
+    fitResultU.GetShowerEdges(xValues, true, uValuesVector);
+    fitResultV.GetShowerEdges(xValues, true, vValuesVector);
+    fitResultW.GetShowerEdges(xValues, true, wValuesVector);
+
+    for (unsigned int iValue = 0; iValue < xValues.size(); ++iValue)
+    {
+        const float x(xValues.at(iValue));
+        const int xBin(xBins.at(iValue));
+        FloatVector &uValues(uValuesVector.at(iValue)), &vValues(vValuesVector.at(iValue)), &wValues(wValuesVector.at(iValue));
 
         std::sort(uValues.begin(), uValues.end());
         std::sort(vValues.begin(), vValues.end());
@@ -243,10 +277,10 @@ void ThreeViewShowersAlgorithm::GetShowerPositionMaps(const TwoDSlidingShowerFit
         {
             const float uMin(uValues.front()), uMax(uValues.back());
             const float vMin(vValues.front()), vMax(vValues.back());
-            const float uv2wMinMin(LArGeometryHelper::MergeTwoPositions(this->GetPandora(), TPC_VIEW_U, TPC_VIEW_V, uMin, vMin));
-            const float uv2wMaxMax(LArGeometryHelper::MergeTwoPositions(this->GetPandora(), TPC_VIEW_U, TPC_VIEW_V, uMax, vMax));
-            const float uv2wMinMax(LArGeometryHelper::MergeTwoPositions(this->GetPandora(), TPC_VIEW_U, TPC_VIEW_V, uMin, vMax));
-            const float uv2wMaxMin(LArGeometryHelper::MergeTwoPositions(this->GetPandora(), TPC_VIEW_U, TPC_VIEW_V, uMax, vMin));
+            const float uv2wMinMin(LArGeometryHelper::MergeTwoPositions<TPC_VIEW_U, TPC_VIEW_V>(this->GetPandora(), uMin, vMin));
+            const float uv2wMaxMax(LArGeometryHelper::MergeTwoPositions<TPC_VIEW_U, TPC_VIEW_V>(this->GetPandora(), uMax, vMax));
+            const float uv2wMinMax(LArGeometryHelper::MergeTwoPositions<TPC_VIEW_U, TPC_VIEW_V>(this->GetPandora(), uMin, vMax));
+            const float uv2wMaxMin(LArGeometryHelper::MergeTwoPositions<TPC_VIEW_U, TPC_VIEW_V>(this->GetPandora(), uMax, vMin));
             positionMapsW.first.insert(ShowerPositionMap::value_type(xBin, ShowerExtent(x, uv2wMinMin, uv2wMaxMax)));
             positionMapsW.second.insert(ShowerPositionMap::value_type(xBin, ShowerExtent(x, uv2wMinMax, uv2wMaxMin)));
         }
@@ -255,10 +289,10 @@ void ThreeViewShowersAlgorithm::GetShowerPositionMaps(const TwoDSlidingShowerFit
         {
             const float uMin(uValues.front()), uMax(uValues.back());
             const float wMin(wValues.front()), wMax(wValues.back());
-            const float uw2vMinMin(LArGeometryHelper::MergeTwoPositions(this->GetPandora(), TPC_VIEW_U, TPC_VIEW_W, uMin, wMin));
-            const float uw2vMaxMax(LArGeometryHelper::MergeTwoPositions(this->GetPandora(), TPC_VIEW_U, TPC_VIEW_W, uMax, wMax));
-            const float uw2vMinMax(LArGeometryHelper::MergeTwoPositions(this->GetPandora(), TPC_VIEW_U, TPC_VIEW_W, uMin, wMax));
-            const float uw2vMaxMin(LArGeometryHelper::MergeTwoPositions(this->GetPandora(), TPC_VIEW_U, TPC_VIEW_W, uMax, wMin));
+            const float uw2vMinMin(LArGeometryHelper::MergeTwoPositions<TPC_VIEW_U, TPC_VIEW_W>(this->GetPandora(), uMin, wMin));
+            const float uw2vMaxMax(LArGeometryHelper::MergeTwoPositions<TPC_VIEW_U, TPC_VIEW_W>(this->GetPandora(), uMax, wMax));
+            const float uw2vMinMax(LArGeometryHelper::MergeTwoPositions<TPC_VIEW_U, TPC_VIEW_W>(this->GetPandora(), uMin, wMax));
+            const float uw2vMaxMin(LArGeometryHelper::MergeTwoPositions<TPC_VIEW_U, TPC_VIEW_W>(this->GetPandora(), uMax, wMin));
             positionMapsV.first.insert(ShowerPositionMap::value_type(xBin, ShowerExtent(x, uw2vMinMin, uw2vMaxMax)));
             positionMapsV.second.insert(ShowerPositionMap::value_type(xBin, ShowerExtent(x, uw2vMinMax, uw2vMaxMin)));
         }
@@ -267,10 +301,10 @@ void ThreeViewShowersAlgorithm::GetShowerPositionMaps(const TwoDSlidingShowerFit
         {
             const float vMin(vValues.front()), vMax(vValues.back());
             const float wMin(wValues.front()), wMax(wValues.back());
-            const float vw2uMinMin(LArGeometryHelper::MergeTwoPositions(this->GetPandora(), TPC_VIEW_V, TPC_VIEW_W, vMin, wMin));
-            const float vw2uMaxMax(LArGeometryHelper::MergeTwoPositions(this->GetPandora(), TPC_VIEW_V, TPC_VIEW_W, vMax, wMax));
-            const float vw2uMinMax(LArGeometryHelper::MergeTwoPositions(this->GetPandora(), TPC_VIEW_V, TPC_VIEW_W, vMin, wMax));
-            const float vw2uMaxMin(LArGeometryHelper::MergeTwoPositions(this->GetPandora(), TPC_VIEW_V, TPC_VIEW_W, vMax, wMin));
+            const float vw2uMinMin(LArGeometryHelper::MergeTwoPositions<TPC_VIEW_V, TPC_VIEW_W>(this->GetPandora(), vMin, wMin));
+            const float vw2uMaxMax(LArGeometryHelper::MergeTwoPositions<TPC_VIEW_V, TPC_VIEW_W>(this->GetPandora(), vMax, wMax));
+            const float vw2uMinMax(LArGeometryHelper::MergeTwoPositions<TPC_VIEW_V, TPC_VIEW_W>(this->GetPandora(), vMin, wMax));
+            const float vw2uMaxMin(LArGeometryHelper::MergeTwoPositions<TPC_VIEW_V, TPC_VIEW_W>(this->GetPandora(), vMax, wMin));
             positionMapsU.first.insert(ShowerPositionMap::value_type(xBin, ShowerExtent(x, vw2uMinMin, vw2uMaxMax)));
             positionMapsU.second.insert(ShowerPositionMap::value_type(xBin, ShowerExtent(x, vw2uMinMax, vw2uMaxMin)));
         }
@@ -285,34 +319,48 @@ void ThreeViewShowersAlgorithm::GetBestHitOverlapFraction(const Cluster *const p
     if ((xSampling.m_maxX - xSampling.m_minX) < std::numeric_limits<float>::epsilon())
         throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
 
+    const HitPositionMap::const_iterator hitIter(m_hitPositionMap.find(pCluster));
+
+    if (m_hitPositionMap.end() == hitIter)
+        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
+
     nSampledHits = 0;
     nMatchedHits = 0;
     unsigned int nMatchedHits1(0), nMatchedHits2(0);
-    const OrderedCaloHitList &orderedCaloHitList(pCluster->GetOrderedCaloHitList());
+    const HitPositionVector &hitPositionVector(hitIter->second);
+
+    // ATTN Hits are sorted by x, so the sampled hits are contiguous and their x bins do not decrease, allowing the maps to be swept
+    const auto isBelowRange = [&xSampling](const HitPositionVector::value_type &hitPosition) {
+        return ((hitPosition.first - xSampling.m_minX) < -std::numeric_limits<float>::epsilon());
+    };
+
+    HitPositionVector::const_iterator positionIter(std::partition_point(hitPositionVector.begin(), hitPositionVector.end(), isBelowRange));
 
-    for (OrderedCaloHitList::const_iterator iter = orderedCaloHitList.begin(), iterEnd = orderedCaloHitList.end(); iter != iterEnd; ++iter)
+    ShowerPositionMap::const_iterator positionIter1(positionMaps.first.begin()), positionIter2(positionMaps.second.begin());
+
+    for (; positionIter != hitPositionVector.end(); ++positionIter)
     {
-        for (CaloHitList::const_iterator hIter = iter->second->begin(), hIterEnd = iter->second->end(); hIter != hIterEnd; ++hIter)
-        {
-            const CaloHit *const pCaloHit = *hIter;
-            const float x(pCaloHit->GetPositionVector().GetX());
-            const float z(pCaloHit->GetPositionVector().GetZ());
+        const float x(positionIter->first), z(positionIter->second);
 
-            int xBin(-1);
-            if (STATUS_CODE_SUCCESS != xSampling.GetBin(x, xBin))
-                continue;
+        int xBin(-1);
+        if (STATUS_CODE_SUCCESS != xSampling.GetBin(x, xBin))
+            break;
 
-            ++nSampledHits;
+        ++nSampledHits;
 
-            ShowerPositionMap::const_iterator positionIter1 = positionMaps.first.find(xBin);
-            ShowerPositionMap::const_iterator positionIter2 = positionMaps.second.find(xBin);
+        while ((positionMaps.first.end() != positionIter1) && (positionIter1->first < xBin))
+            ++positionIter1;
 
-            if ((positionMaps.first.end() != positionIter1) && (z > positionIter1->second.GetLowEdgeZ()) && (z < positionIter1->second.GetHighEdgeZ()))
-                ++nMatchedHits1;
+        while ((positionMaps.second.end() != positionIter2) && (positionIter2->first < xBin))
+            ++positionIter2;
 
-            if ((positionMaps.second.end() != positionIter2) && (z > positionIter2->second.GetLowEdgeZ()) && (z < positionIter2->second.GetHighEdgeZ()))
-                ++nMatchedHits2;
-        }
+        if ((positionMaps.first.end() != positionIter1) && (positionIter1->first == xBin) && (z > positionIter1->second.GetLowEdgeZ()) &&
+            (z < positionIter1->second.GetHighEdgeZ()))
+            ++nMatchedHits1;
+
+        if ((positionMaps.second.end() != positionIter2) && (positionIter2->first == xBin) && (z > positionIter2->second.GetLowEdgeZ()) &&
+            (z < positionIter2->second.GetHighEdgeZ()))
+            ++nMatchedHits2;
     }
 
     nMatchedHits = std::max(nMatchedHits1, nMatchedHits2);
@@ -326,6 +374,10 @@ void ThreeViewShowersAlgorithm::ExamineOverlapContainer()
 
     for (TensorToolVector::const_iterator iter = m_algorithmToolVector.begin(), iterEnd = m_algorithmToolVector.end(); iter != iterEnd;)
     {
+        // ATTN Stop at the event deadline, leaving the output of the completed tool runs
+        if (LArEventDeadlineHelper::IsDeadlineExceeded(this->GetPandora()))
+            break;
+
         if ((*iter)->Run(this, this->GetMatchingControl().GetOverlapTensor()))
         {
             iter = m_algorithmToolVector.begin();
@@ -419,6 +471,23 @@ StatusCode ThreeViewShowersAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
 
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "Visualize", m_visualize));
 
+    // ATTN The overlap calculation only reads the cached shower fits and the settings, so overlap results can be calculated in parallel,
+    // unless the visualization is enabled
+    if (!m_visualize)
+    {
+        this->GetMatchingControl().SetOverlapFunction([this](const Cluster *const pClusterU, const Cluster *const pClusterV,
+                                                          const Cluster *const pClusterW, ShowerOverlapResult &overlapResult) {
+            return this->CalculateOverlapResult(pClusterU, pClusterV, pClusterW, overlapResult);
+        });
+    }
+
+    // ATTN Triplets whose shower fits have no mutual x overlap never form overlap results, so can be skipped
+    this->GetMatchingControl().SetXSpanFunction(
+        [this](const Cluster *const pCluster, float &minX, float &maxX) {
+            this->GetCachedSlidingFitResult(pCluster).GetShowerFitResult().GetMinAndMaxX(minX, maxX);
+        },
+        std::numeric_limits<float>::epsilon());
+
     return BaseAlgorithm::ReadSettings(xmlHandle);
 }
 
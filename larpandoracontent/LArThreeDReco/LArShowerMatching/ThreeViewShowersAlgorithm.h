@@ -16,6 +16,8 @@
 #include "larpandoracontent/LArThreeDReco/LArThreeDBase/NViewMatchingAlgorithm.h"
 #include "larpandoracontent/LArThreeDReco/LArThreeDBase/ThreeViewMatchingControl.h"
 
+#include <unordered_map>
+
 namespace lar_content
 {
 
@@ -86,17 +88,20 @@ private:
         float m_nPoints;      ///< The number of sampling points to be used
     };
 
+    typedef std::vector<std::pair<float, float>> HitPositionVector;
+    typedef std::unordered_map<const pandora::Cluster *, HitPositionVector> HitPositionMap;
+
     void TidyUp();
 
     /**
-     *  @brief  Add a new sliding fit result, for the specified cluster, to the algorithm cache
+     *  @brief  Add a new sliding fit result, and the hit positions, for the specified cluster, to the algorithm cache
      *
      *  @param  pCluster address of the relevant cluster
      */
     void AddToSlidingFitCache(const pandora::Cluster *const pCluster);
 
     /**
-     *  @brief  Remova an existing sliding fit result, for the specified cluster, from the algorithm cache
+     *  @brief  Remova an existing sliding fit result, and the hit positions, for the specified cluster, from the algorithm cache
      *
      *  @param  pCluster address of the relevant cluster
      */
@@ -153,6 +158,7 @@ private:
 
     unsigned int m_slidingFitWindow;                     ///< The layer window for the sliding linear fits
     TwoDSlidingShowerFitResultMap m_slidingFitResultMap; ///< The sliding shower fit result map
+    HitPositionMap m_hitPositionMap;                     ///< The map from cluster to its hit (x, z) positions, sorted by x
 
     bool m_ignoreUnavailableClusters;  ///< Whether to ignore (skip-over) unavailable clusters
     unsigned int m_minClusterCaloHits; ///< The min number of hits in base cluster selection method
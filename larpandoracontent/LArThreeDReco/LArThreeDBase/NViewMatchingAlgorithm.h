@@ -8,8 +8,13 @@
 #ifndef LAR_N_VIEW_MATCHING_ALGORITHM_H
 #define LAR_N_VIEW_MATCHING_ALGORITHM_H 1
 
+#include "larpandoracontent/LArHelpers/LArEventDeadlineHelper.h"
+
 #include "larpandoracontent/LArThreeDReco/LArThreeDBase/MatchingBaseAlgorithm.h"
 
+#include <limits>
+#include <vector>
+
 namespace lar_content
 {
 
@@ -44,6 +49,26 @@ protected:
      */
     MatchingType &GetMatchingControl();
 
+    /**
+     *  @brief  Apply tools to the overlap container sequentially, restarting if a change is made and ending if the tools finish, the
+     *          restart limit is reached or, if requested, the event deadline is exceeded. ATTN A tool examining groups independently,
+     *          having made no changes (other than pfo creation), need next only examine the groups containing clusters modified since the
+     *          start of that run, provided there has since been no global modification, which may affect any group. Other groups are
+     *          unchanged and would again yield nothing, so the sequence of changes made by the tools is unaltered.
+     *
+     *  @param  pAlgorithm the address of the algorithm, as passed to the tools
+     *  @param  toolVector the tools
+     *  @param  overlapContainer the overlap tensor or matrix
+     *  @param  modifiedClusters the clusters modified whilst the tools run, in order of modification, as recorded by the algorithm
+     *  @param  nGlobalModifications the number of global modifications whilst the tools run, as recorded by the algorithm
+     *  @param  nMaxToolRepeats the maximum number of tool restarts
+     *  @param  stopAtEventDeadline whether to stop once the event deadline is exceeded, leaving the output of the completed tool runs
+     */
+    template <typename TALGORITHM, typename TTOOL, typename TCONTAINER>
+    void RunToolsOverModifiedGroups(TALGORITHM *const pAlgorithm, const std::vector<TTOOL *> &toolVector, TCONTAINER &overlapContainer,
+        const pandora::ClusterVector &modifiedClusters, const unsigned int &nGlobalModifications, const unsigned int nMaxToolRepeats,
+        const bool stopAtEventDeadline) const;
+
     virtual void SelectAllInputClusters();
     virtual void PrepareAllInputClusters();
     virtual void PerformMainLoop();
@@ -61,6 +86,64 @@ inline T &NViewMatchingAlgorithm<T>::GetMatchingControl()
     return m_matchingControl;
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+template <typename TALGORITHM, typename TTOOL, typename TCONTAINER>
+void NViewMatchingAlgorithm<T>::RunToolsOverModifiedGroups(TALGORITHM *const pAlgorithm, const std::vector<TTOOL *> &toolVector,
+    TCONTAINER &overlapContainer, const pandora::ClusterVector &modifiedClusters, const unsigned int &nGlobalModifications,
+    const unsigned int nMaxToolRepeats, const bool stopAtEventDeadline) const
+{
+    const unsigned int fullRun(std::numeric_limits<unsigned int>::max());
+    std::vector<unsigned int> nModifiedClustersAtNoChange(toolVector.size(), fullRun);
+    std::vector<unsigned int> nGlobalModificationsAtNoChange(toolVector.size(), 0);
+    unsigned int repeatCounter(0);
+
+    for (unsigned int toolIndex = 0; toolIndex < toolVector.size();)
+    {
+        if (stopAtEventDeadline && LArEventDeadlineHelper::IsDeadlineExceeded(this->GetPandora()))
+            break;
+
+        TTOOL *const pTool(toolVector.at(toolIndex));
+        const unsigned int nModifiedClusters(modifiedClusters.size()), nGlobalModificationsAtStart(nGlobalModifications);
+        const bool isRestrictedRun((fullRun != nModifiedClustersAtNoChange.at(toolIndex)) &&
+            (nGlobalModificationsAtStart == nGlobalModificationsAtNoChange.at(toolIndex)));
+
+        pandora::ClusterSet keyClusterFilter;
+
+        if (isRestrictedRun)
+        {
+            const pandora::ClusterVector::const_iterator modifiedIter(modifiedClusters.begin() + nModifiedClustersAtNoChange.at(toolIndex));
+            const pandora::ClusterSet restrictedSeedClusters(modifiedIter, modifiedClusters.end());
+            overlapContainer.GetConnectedClusters(restrictedSeedClusters, keyClusterFilter);
+        }
+
+        bool changesMade(false);
+
+        if (!isRestrictedRun || !keyClusterFilter.empty())
+        {
+            overlapContainer.SetKeyClusterFilter(isRestrictedRun ? &keyClusterFilter : nullptr);
+            changesMade = pTool->Run(pAlgorithm, overlapContainer);
+            overlapContainer.SetKeyClusterFilter(nullptr);
+        }
+
+        if (changesMade)
+        {
+            nModifiedClustersAtNoChange.at(toolIndex) = fullRun;
+            toolIndex = 0;
+
+            if (++repeatCounter > nMaxToolRepeats)
+                break;
+        }
+        else
+        {
+            nModifiedClustersAtNoChange.at(toolIndex) = (pTool->ExaminesGroupsIndependently() ? nModifiedClusters : fullRun);
+            nGlobalModificationsAtNoChange.at(toolIndex) = nGlobalModificationsAtStart;
+            ++toolIndex;
+        }
+    }
+}
+
 } // namespace lar_content
 
 #endif // #ifndef LAR_N_VIEW_MATCHING_ALGORITHM_H
@@ -8,6 +8,15 @@
 #ifndef LAR_N_VIEW_MATCHING_CONTROL_H
 #define LAR_N_VIEW_MATCHING_CONTROL_H 1
 
+#include "Pandora/PandoraInternal.h"
+#include "Pandora/StatusCodes.h"
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <utility>
+#include <vector>
+
 namespace lar_content
 {
 
@@ -21,6 +30,8 @@ class MatchingBaseAlgorithm;
 class NViewMatchingControl
 {
 public:
+    typedef std::function<void(const pandora::Cluster *const, float &, float &)> XSpanFunction;
+
     /**
      *  @brief  Constructor
      *
@@ -33,7 +44,68 @@ public:
      */
     virtual ~NViewMatchingControl();
 
+    /**
+     *  @brief  Set a function providing the x span of a cluster, for algorithms that only find overlap results for cluster combinations
+     *          whose x spans mutually overlap by at least a minimum amount. Other combinations are then skipped by the main loop.
+     *
+     *  @param  xSpanFunction the x span function, receiving the cluster and the minimum and maximum x to set
+     *  @param  minXOverlap the minimum mutual x overlap, which must be positive
+     */
+    void SetXSpanFunction(const XSpanFunction &xSpanFunction, const float minXOverlap);
+
 protected:
+    typedef std::pair<float, float> XSpan;
+    typedef std::vector<XSpan> XSpanVector;
+    typedef std::vector<unsigned int> IndexVector;
+
+    /**
+     *  @brief  XSpanIndex class, the x spans of the clusters in a vector, with the cluster indices ordered by minimum x
+     */
+    class XSpanIndex
+    {
+    public:
+        XSpanVector m_xSpanVector; ///< The x spans, in the order of the cluster vector
+        IndexVector m_minXOrder;   ///< The cluster indices, in order of increasing minimum x
+    };
+
+    /**
+     *  @brief  Get the x span of a cluster, which is unbounded if no x span function is set
+     *
+     *  @param  pCluster address of the cluster
+     *
+     *  @return the x span
+     */
+    XSpan GetXSpan(const pandora::Cluster *const pCluster) const;
+
+    /**
+     *  @brief  Fill the x span index for the clusters in a vector, if an x span function is set
+     *
+     *  @param  clusterVector the cluster vector
+     *  @param  xSpanIndex to receive the x span index
+     */
+    void FillXSpanIndex(const pandora::ClusterVector &clusterVector, XSpanIndex &xSpanIndex) const;
+
+    /**
+     *  @brief  Sweep the x span index in order of minimum x, to find the clusters whose x spans overlap a given x interval by at least the
+     *          minimum x overlap. If no x span function is set, all clusters are found.
+     *
+     *  @param  nClusters the number of clusters in the vector
+     *  @param  xSpanIndex the x span index
+     *  @param  xSpan the x interval
+     *  @param  indexVector to receive the cluster indices, in increasing order
+     */
+    void GetXOverlapIndices(const unsigned int nClusters, const XSpanIndex &xSpanIndex, const XSpan &xSpan, IndexVector &indexVector) const;
+
+    /**
+     *  @brief  Get the intersection of two x spans
+     *
+     *  @param  xSpan1 the first x span
+     *  @param  xSpan2 the second x span
+     *
+     *  @return the intersection
+     */
+    static XSpan GetXSpanIntersection(const XSpan &xSpan1, const XSpan &xSpan2);
+
     /**
      *  @brief  Update to reflect addition of a new cluster to the problem space
      *
@@ -103,11 +175,15 @@ protected:
     virtual pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle) = 0;
 
     MatchingBaseAlgorithm *m_pAlgorithm; ///< The address of the matching base algorithm
+    XSpanFunction m_xSpanFunction;       ///< The function providing the x span of a cluster, if set
+    float m_minXOverlap;                 ///< The minimum mutual x overlap for cluster combinations, if the x span function is set
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-inline NViewMatchingControl::NViewMatchingControl(MatchingBaseAlgorithm *const pAlgorithm) : m_pAlgorithm(pAlgorithm)
+inline NViewMatchingControl::NViewMatchingControl(MatchingBaseAlgorithm *const pAlgorithm) :
+    m_pAlgorithm(pAlgorithm),
+    m_minXOverlap(std::numeric_limits<float>::epsilon())
 {
 }
 
@@ -117,6 +193,92 @@ inline NViewMatchingControl::~NViewMatchingControl()
 {
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline void NViewMatchingControl::SetXSpanFunction(const XSpanFunction &xSpanFunction, const float minXOverlap)
+{
+    if (minXOverlap < std::numeric_limits<float>::epsilon())
+        throw pandora::StatusCodeException(pandora::STATUS_CODE_INVALID_PARAMETER);
+
+    m_xSpanFunction = xSpanFunction;
+    m_minXOverlap = minXOverlap;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline NViewMatchingControl::XSpan NViewMatchingControl::GetXSpan(const pandora::Cluster *const pCluster) const
+{
+    if (!m_xSpanFunction)
+        return XSpan(-std::numeric_limits<float>::max(), std::numeric_limits<float>::max());
+
+    XSpan xSpan(0.f, 0.f);
+    m_xSpanFunction(pCluster, xSpan.first, xSpan.second);
+
+    return xSpan;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline void NViewMatchingControl::FillXSpanIndex(const pandora::ClusterVector &clusterVector, XSpanIndex &xSpanIndex) const
+{
+    xSpanIndex.m_xSpanVector.clear();
+    xSpanIndex.m_minXOrder.clear();
+
+    if (!m_xSpanFunction)
+        return;
+
+    for (unsigned int index = 0; index < clusterVector.size(); ++index)
+    {
+        xSpanIndex.m_xSpanVector.push_back(this->GetXSpan(clusterVector.at(index)));
+        xSpanIndex.m_minXOrder.push_back(index);
+    }
+
+    const XSpanVector &xSpanVector(xSpanIndex.m_xSpanVector);
+    std::stable_sort(xSpanIndex.m_minXOrder.begin(), xSpanIndex.m_minXOrder.end(),
+        [&xSpanVector](const unsigned int lhs, const unsigned int rhs) { return (xSpanVector.at(lhs).first < xSpanVector.at(rhs).first); });
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline void NViewMatchingControl::GetXOverlapIndices(
+    const unsigned int nClusters, const XSpanIndex &xSpanIndex, const XSpan &xSpan, IndexVector &indexVector) const
+{
+    indexVector.clear();
+
+    if (!m_xSpanFunction)
+    {
+        for (unsigned int index = 0; index < nClusters; ++index)
+            indexVector.push_back(index);
+
+        return;
+    }
+
+    // ATTN Clusters starting at or beyond the end of the interval have no positive overlap, so the sweep can stop at the first of them
+    for (const unsigned int index : xSpanIndex.m_minXOrder)
+    {
+        const XSpan &otherXSpan(xSpanIndex.m_xSpanVector.at(index));
+
+        if (otherXSpan.first >= xSpan.second)
+            break;
+
+        const XSpan intersection(NViewMatchingControl::GetXSpanIntersection(xSpan, otherXSpan));
+
+        if ((intersection.second - intersection.first) < m_minXOverlap)
+            continue;
+
+        indexVector.push_back(index);
+    }
+
+    std::sort(indexVector.begin(), indexVector.end());
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline NViewMatchingControl::XSpan NViewMatchingControl::GetXSpanIntersection(const XSpan &xSpan1, const XSpan &xSpan2)
+{
+    return XSpan(std::max(xSpan1.first, xSpan2.first), std::min(xSpan1.second, xSpan2.second));
+}
+
 } // namespace lar_content
 
 #endif // #ifndef LAR_N_VIEW_MATCHING_CONTROL_H
@@ -9,6 +9,7 @@
 #include "Pandora/AlgorithmHeaders.h"
 
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
+#include "larpandoracontent/LArHelpers/LArParallelHelper.h"
 
 #include "larpandoracontent/LArObjects/LArShowerOverlapResult.h"
 #include "larpandoracontent/LArObjects/LArTrackOverlapResult.h"
@@ -16,6 +17,8 @@
 #include "larpandoracontent/LArThreeDReco/LArThreeDBase/MatchingBaseAlgorithm.h"
 #include "larpandoracontent/LArThreeDReco/LArThreeDBase/ThreeViewMatchingControl.h"
 
+#include <exception>
+
 using namespace pandora;
 
 namespace lar_content
@@ -26,7 +29,8 @@ ThreeViewMatchingControl<T>::ThreeViewMatchingControl(MatchingBaseAlgorithm *con
     NViewMatchingControl(pAlgorithm),
     m_pInputClusterListU(nullptr),
     m_pInputClusterListV(nullptr),
-    m_pInputClusterListW(nullptr)
+    m_pInputClusterListW(nullptr),
+    m_nOverlapThreads(1)
 {
 }
 
@@ -47,6 +51,14 @@ typename ThreeViewMatchingControl<T>::TensorType &ThreeViewMatchingControl<T>::G
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+template <typename T>
+void ThreeViewMatchingControl<T>::SetOverlapFunction(const OverlapFunction &overlapFunction)
+{
+    m_overlapFunction = overlapFunction;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template <typename T>
 void ThreeViewMatchingControl<T>::UpdateForNewCluster(const Cluster *const pNewCluster)
 {
@@ -70,22 +82,29 @@ void ThreeViewMatchingControl<T>::UpdateForNewCluster(const Cluster *const pNewC
     std::sort(clusterVector2.begin(), clusterVector2.end(), LArClusterHelper::SortByNHits);
     std::sort(clusterVector3.begin(), clusterVector3.end(), LArClusterHelper::SortByNHits);
 
-    for (const Cluster *const pCluster2 : clusterVector2)
+    XSpanIndex xSpanIndex2, xSpanIndex3;
+    this->FillXSpanIndex(clusterVector2, xSpanIndex2);
+    this->FillXSpanIndex(clusterVector3, xSpanIndex3);
+
+    IndexPairVector indexPairVector;
+    this->GetIndexPairs(this->GetXSpan(pNewCluster), clusterVector2, xSpanIndex2, clusterVector3, xSpanIndex3, indexPairVector);
+
+    for (const IndexPair &indexPair : indexPairVector)
     {
-        for (const Cluster *const pCluster3 : clusterVector3)
+        const Cluster *const pCluster2(clusterVector2.at(indexPair.first));
+        const Cluster *const pCluster3(clusterVector3.at(indexPair.second));
+
+        if (TPC_VIEW_U == hitType)
         {
-            if (TPC_VIEW_U == hitType)
-            {
-                m_pAlgorithm->CalculateOverlapResult(pNewCluster, pCluster2, pCluster3);
-            }
-            else if (TPC_VIEW_V == hitType)
-            {
-                m_pAlgorithm->CalculateOverlapResult(pCluster2, pNewCluster, pCluster3);
-            }
-            else
-            {
-                m_pAlgorithm->CalculateOverlapResult(pCluster2, pCluster3, pNewCluster);
-            }
+            m_pAlgorithm->CalculateOverlapResult(pNewCluster, pCluster2, pCluster3);
+        }
+        else if (TPC_VIEW_V == hitType)
+        {
+            m_pAlgorithm->CalculateOverlapResult(pCluster2, pNewCluster, pCluster3);
+        }
+        else
+        {
+            m_pAlgorithm->CalculateOverlapResult(pCluster2, pCluster3, pNewCluster);
         }
     }
 }
@@ -225,13 +244,102 @@ void ThreeViewMatchingControl<T>::PerformMainLoop()
     std::sort(clusterVectorV.begin(), clusterVectorV.end(), LArClusterHelper::SortByNHits);
     std::sort(clusterVectorW.begin(), clusterVectorW.end(), LArClusterHelper::SortByNHits);
 
+    XSpanIndex xSpanIndexV, xSpanIndexW;
+    this->FillXSpanIndex(clusterVectorV, xSpanIndexV);
+    this->FillXSpanIndex(clusterVectorW, xSpanIndexW);
+
+    if (m_overlapFunction && (1 != m_nOverlapThreads))
+    {
+        this->PerformParallelMainLoop(clusterVectorU, clusterVectorV, xSpanIndexV, clusterVectorW, xSpanIndexW);
+        return;
+    }
+
+    IndexPairVector indexPairVector;
+
     for (const Cluster *const pClusterU : clusterVectorU)
     {
-        for (const Cluster *const pClusterV : clusterVectorV)
+        this->GetIndexPairs(this->GetXSpan(pClusterU), clusterVectorV, xSpanIndexV, clusterVectorW, xSpanIndexW, indexPairVector);
+
+        for (const IndexPair &indexPair : indexPairVector)
+            m_pAlgorithm->CalculateOverlapResult(pClusterU, clusterVectorV.at(indexPair.first), clusterVectorW.at(indexPair.second));
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+void ThreeViewMatchingControl<T>::PerformParallelMainLoop(const ClusterVector &clusterVectorU, const ClusterVector &clusterVectorV,
+    const XSpanIndex &xSpanIndexV, const ClusterVector &clusterVectorW, const XSpanIndex &xSpanIndexW)
+{
+    std::vector<OverlapElementVector> overlapElementVectors(clusterVectorU.size());
+    std::vector<std::exception_ptr> exceptions(clusterVectorU.size());
+
+    // ATTN An exception ends the triplets for its u cluster, and is held until the results preceding it in the serial order have been set
+    LArParallelHelper::ForEach(clusterVectorU.size(), m_nOverlapThreads, [&](const unsigned int indexU) {
+        try
+        {
+            const Cluster *const pClusterU(clusterVectorU.at(indexU));
+
+            IndexPairVector indexPairVector;
+            this->GetIndexPairs(this->GetXSpan(pClusterU), clusterVectorV, xSpanIndexV, clusterVectorW, xSpanIndexW, indexPairVector);
+
+            for (const IndexPair &indexPair : indexPairVector)
+            {
+                const Cluster *const pClusterV(clusterVectorV.at(indexPair.first));
+                const Cluster *const pClusterW(clusterVectorW.at(indexPair.second));
+
+                T overlapResult;
+                const StatusCode statusCode(m_overlapFunction(pClusterU, pClusterV, pClusterW, overlapResult));
+
+                if (STATUS_CODE_SUCCESS == statusCode)
+                {
+                    overlapElementVectors.at(indexU).push_back({pClusterV, pClusterW, overlapResult});
+                }
+                else if (STATUS_CODE_NOT_FOUND != statusCode)
+                {
+                    throw StatusCodeException(statusCode);
+                }
+            }
+        }
+        catch (...)
+        {
+            exceptions.at(indexU) = std::current_exception();
+        }
+    });
+
+    for (unsigned int indexU = 0; indexU < clusterVectorU.size(); ++indexU)
+    {
+        for (const OverlapElement &overlapElement : overlapElementVectors.at(indexU))
         {
-            for (const Cluster *const pClusterW : clusterVectorW)
-                m_pAlgorithm->CalculateOverlapResult(pClusterU, pClusterV, pClusterW);
+            m_overlapTensor.SetOverlapResult(
+                clusterVectorU.at(indexU), overlapElement.m_pClusterV, overlapElement.m_pClusterW, overlapElement.m_overlapResult);
         }
+
+        if (exceptions.at(indexU))
+            std::rethrow_exception(exceptions.at(indexU));
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+void ThreeViewMatchingControl<T>::GetIndexPairs(const XSpan &xSpan1, const ClusterVector &clusterVector2, const XSpanIndex &xSpanIndex2,
+    const ClusterVector &clusterVector3, const XSpanIndex &xSpanIndex3, IndexPairVector &indexPairVector) const
+{
+    indexPairVector.clear();
+
+    IndexVector indexVector2, indexVector3;
+    this->GetXOverlapIndices(clusterVector2.size(), xSpanIndex2, xSpan1, indexVector2);
+
+    for (const unsigned int index2 : indexVector2)
+    {
+        // ATTN The mutual x overlap of a triplet is the overlap of the third x span with the intersection of the first two
+        const XSpan xSpan12(
+            m_xSpanFunction ? NViewMatchingControl::GetXSpanIntersection(xSpan1, xSpanIndex2.m_xSpanVector.at(index2)) : xSpan1);
+        this->GetXOverlapIndices(clusterVector3.size(), xSpanIndex3, xSpan12, indexVector3);
+
+        for (const unsigned int index3 : indexVector3)
+            indexPairVector.push_back(IndexPair(index2, index3));
     }
 }
 
@@ -244,6 +352,9 @@ StatusCode ThreeViewMatchingControl<T>::ReadSettings(const TiXmlHandle xmlHandle
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "InputClusterListNameV", m_inputClusterListNameV));
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "InputClusterListNameW", m_inputClusterListNameW));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "NOverlapThreads", m_nOverlapThreads));
+
     return STATUS_CODE_SUCCESS;
 }
 
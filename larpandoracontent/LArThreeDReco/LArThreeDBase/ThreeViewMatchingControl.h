@@ -12,6 +12,10 @@
 
 #include "larpandoracontent/LArThreeDReco/LArThreeDBase/NViewMatchingControl.h"
 
+#include <functional>
+#include <utility>
+#include <vector>
+
 namespace lar_content
 {
 
@@ -23,6 +27,9 @@ class ThreeViewMatchingControl : public NViewMatchingControl
 {
 public:
     typedef OverlapTensor<T> TensorType;
+    typedef std::function<pandora::StatusCode(
+        const pandora::Cluster *const, const pandora::Cluster *const, const pandora::Cluster *const, T &)>
+        OverlapFunction;
 
     /**
      *  @brief  Constructor
@@ -43,7 +50,31 @@ public:
      */
     TensorType &GetOverlapTensor();
 
+    /**
+     *  @brief  Set a function calculating the overlap result for a u, v, w cluster triplet, returning STATUS_CODE_SUCCESS if an overlap
+     *          result is provided or STATUS_CODE_NOT_FOUND if not. The function must not modify any state, so that the main loop can
+     *          calculate the overlap results in parallel, before setting them in the overlap tensor in the serial order
+     *
+     *  @param  overlapFunction the overlap function
+     */
+    void SetOverlapFunction(const OverlapFunction &overlapFunction);
+
 private:
+    /**
+     *  @brief  OverlapElement class, an overlap result calculated for the v and w clusters of a triplet
+     */
+    class OverlapElement
+    {
+    public:
+        const pandora::Cluster *m_pClusterV; ///< The address of the v cluster
+        const pandora::Cluster *m_pClusterW; ///< The address of the w cluster
+        T m_overlapResult;                   ///< The overlap result
+    };
+
+    typedef std::vector<OverlapElement> OverlapElementVector;
+    typedef std::pair<unsigned int, unsigned int> IndexPair;
+    typedef std::vector<IndexPair> IndexPairVector;
+
     void UpdateForNewCluster(const pandora::Cluster *const pNewCluster);
     void UpdateUponDeletion(const pandora::Cluster *const pDeletedCluster);
     const std::string &GetClusterListName(const pandora::HitType hitType) const;
@@ -52,6 +83,33 @@ private:
     void SelectAllInputClusters();
     void PrepareAllInputClusters();
     void PerformMainLoop();
+
+    /**
+     *  @brief  Main loop over cluster triplets using the overlap function, calculating the overlap results for each u cluster in parallel
+     *
+     *  @param  clusterVectorU the sorted u clusters
+     *  @param  clusterVectorV the sorted v clusters
+     *  @param  xSpanIndexV the x span index for the v clusters
+     *  @param  clusterVectorW the sorted w clusters
+     *  @param  xSpanIndexW the x span index for the w clusters
+     */
+    void PerformParallelMainLoop(const pandora::ClusterVector &clusterVectorU, const pandora::ClusterVector &clusterVectorV,
+        const XSpanIndex &xSpanIndexV, const pandora::ClusterVector &clusterVectorW, const XSpanIndex &xSpanIndexW);
+
+    /**
+     *  @brief  Get the index pairs of the clusters in two vectors to combine with a given cluster, in the order of the serial loop,
+     *          skipping those with insufficient mutual x overlap if an x span function is set
+     *
+     *  @param  xSpan1 the x span of the given cluster
+     *  @param  clusterVector2 the second cluster vector
+     *  @param  xSpanIndex2 the x span index for the second cluster vector
+     *  @param  clusterVector3 the third cluster vector
+     *  @param  xSpanIndex3 the x span index for the third cluster vector
+     *  @param  indexPairVector to receive the pairs of indices into the second and third cluster vectors
+     */
+    void GetIndexPairs(const XSpan &xSpan1, const pandora::ClusterVector &clusterVector2, const XSpanIndex &xSpanIndex2,
+        const pandora::ClusterVector &clusterVector3, const XSpanIndex &xSpanIndex3, IndexPairVector &indexPairVector) const;
+
     void TidyUp();
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
@@ -69,6 +127,9 @@ private:
     std::string m_inputClusterListNameV; ///< The name of the view V cluster list
     std::string m_inputClusterListNameW; ///< The name of the view W cluster list
 
+    OverlapFunction m_overlapFunction; ///< The function calculating overlap results in parallel, if set
+    unsigned int m_nOverlapThreads;    ///< The number of threads calculating overlap results (0 to use all hardware threads)
+
     friend class ThreeViewTrackFragmentsAlgorithm; ///< ATTN This is for legacy purposes only
     friend class ThreeViewDeltaRayMatchingAlgorithm;
 
@@ -79,8 +79,16 @@ void TwoViewMatchingControl<T>::UpdateForNewCluster(const Cluster *const pNewClu
     ClusterVector clusterVector2(clusterList2.begin(), clusterList2.end());
     std::sort(clusterVector2.begin(), clusterVector2.end(), LArClusterHelper::SortByNHits);
 
-    for (const Cluster *const pCluster2 : clusterVector2)
+    XSpanIndex xSpanIndex2;
+    this->FillXSpanIndex(clusterVector2, xSpanIndex2);
+
+    IndexVector indexVector2;
+    this->GetXOverlapIndices(clusterVector2.size(), xSpanIndex2, this->GetXSpan(pNewCluster), indexVector2);
+
+    for (const unsigned int index2 : indexVector2)
     {
+        const Cluster *const pCluster2(clusterVector2.at(index2));
+
         if (1 == iter->second)
         {
             m_pAlgorithm->CalculateOverlapResult(pNewCluster, pCluster2);
@@ -219,10 +227,17 @@ void TwoViewMatchingControl<T>::PerformMainLoop()
     std::sort(clusterVector1.begin(), clusterVector1.end(), LArClusterHelper::SortByNHits);
     std::sort(clusterVector2.begin(), clusterVector2.end(), LArClusterHelper::SortByNHits);
 
+    XSpanIndex xSpanIndex2;
+    this->FillXSpanIndex(clusterVector2, xSpanIndex2);
+
+    IndexVector indexVector2;
+
     for (const Cluster *const pCluster1 : clusterVector1)
     {
-        for (const Cluster *const pCluster2 : clusterVector2)
-            m_pAlgorithm->CalculateOverlapResult(pCluster1, pCluster2);
+        this->GetXOverlapIndices(clusterVector2.size(), xSpanIndex2, this->GetXSpan(pCluster1), indexVector2);
+
+        for (const unsigned int index2 : indexVector2)
+            m_pAlgorithm->CalculateOverlapResult(pCluster1, clusterVector2.at(index2));
     }
 }
 
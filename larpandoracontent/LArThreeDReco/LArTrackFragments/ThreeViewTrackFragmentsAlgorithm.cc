@@ -9,6 +9,7 @@
 #include "Pandora/AlgorithmHeaders.h"
 
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
+#include "larpandoracontent/LArHelpers/LArEventDeadlineHelper.h"
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
 
 #include "larpandoracontent/LArThreeDReco/LArTrackFragments/ThreeViewTrackFragmentsAlgorithm.h"
@@ -99,8 +100,27 @@ void ThreeViewTrackFragmentsAlgorithm::UpdateForNewCluster(const Cluster *const
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void ThreeViewTrackFragmentsAlgorithm::UpdateUponDeletion(const Cluster *const pDeletedCluster)
+{
+    m_hitIndexMap.clear();
+    BaseAlgorithm::UpdateUponDeletion(pDeletedCluster);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool ThreeViewTrackFragmentsAlgorithm::CreateThreeDParticles(const ProtoParticleVector &protoParticleVector)
+{
+    // ATTN Clusters used in particles are no longer available, so their hits must be removed from the hit indices
+    m_hitIndexMap.clear();
+    return BaseAlgorithm::CreateThreeDParticles(protoParticleVector);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void ThreeViewTrackFragmentsAlgorithm::RebuildClusters(const ClusterList &rebuildList, ClusterList &newClusters) const
 {
+    m_hitIndexMap.clear();
+
     const ClusterList *pNewClusterList = nullptr;
     std::string oldClusterListName, newClusterListName;
 
@@ -116,6 +136,8 @@ void ThreeViewTrackFragmentsAlgorithm::RebuildClusters(const ClusterList &rebuil
 
 void ThreeViewTrackFragmentsAlgorithm::PerformMainLoop()
 {
+    m_hitIndexMap.clear();
+
     ClusterList clusterListU(this->GetSelectedClusterList(TPC_VIEW_U));
     ClusterList clusterListV(this->GetSelectedClusterList(TPC_VIEW_V));
     ClusterList clusterListW(this->GetSelectedClusterList(TPC_VIEW_W));
@@ -156,7 +178,8 @@ void ThreeViewTrackFragmentsAlgorithm::CalculateOverlapResult(const Cluster *con
         throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
 
     // Calculate new overlap result and replace old overlap result where necessary
-    FragmentOverlapResult oldOverlapResult, newOverlapResult;
+    FragmentOverlapResult newOverlapResult;
+    const FragmentOverlapResult *pOldOverlapResult(nullptr);
     const Cluster *pMatchedClusterU(nullptr), *pMatchedClusterV(nullptr), *pMatchedClusterW(nullptr);
 
     const TwoDSlidingFitResult &fitResult1(
@@ -191,27 +214,28 @@ void ThreeViewTrackFragmentsAlgorithm::CalculateOverlapResult(const Cluster *con
 
         try
         {
-            oldOverlapResult = overlapTensor.GetOverlapResult(pMatchedClusterU, pMatchedClusterV, pMatchedClusterW);
+            pOldOverlapResult = &overlapTensor.GetOverlapResult(pMatchedClusterU, pMatchedClusterV, pMatchedClusterW);
         }
         catch (StatusCodeException &)
         {
         }
     }
 
-    if (!oldOverlapResult.IsInitialized())
+    // ATTN The old overlap result is read in place, rather than copied, and is only replaced once it is no longer needed
+    if (!pOldOverlapResult || !pOldOverlapResult->IsInitialized())
     {
         overlapTensor.SetOverlapResult(pMatchedClusterU, pMatchedClusterV, pMatchedClusterW, newOverlapResult);
     }
-    else if (newOverlapResult.GetFragmentCaloHitList().size() > oldOverlapResult.GetFragmentCaloHitList().size())
+    else if (newOverlapResult.GetFragmentCaloHitList().size() > pOldOverlapResult->GetFragmentCaloHitList().size())
     {
         overlapTensor.ReplaceOverlapResult(pMatchedClusterU, pMatchedClusterV, pMatchedClusterW, newOverlapResult);
     }
-    else if (newOverlapResult.GetFragmentCaloHitList().size() == oldOverlapResult.GetFragmentCaloHitList().size())
+    else if (newOverlapResult.GetFragmentCaloHitList().size() == pOldOverlapResult->GetFragmentCaloHitList().size())
     {
         float newEnergySum(0.f), oldEnergySum(0.f);
         for (const CaloHit *const pCaloHit : newOverlapResult.GetFragmentCaloHitList())
             newEnergySum += pCaloHit->GetHadronicEnergy();
-        for (const CaloHit *const pCaloHit : oldOverlapResult.GetFragmentCaloHitList())
+        for (const CaloHit *const pCaloHit : pOldOverlapResult->GetFragmentCaloHitList())
             oldEnergySum += pCaloHit->GetHadronicEnergy();
 
         if (newEnergySum > oldEnergySum)
@@ -264,7 +288,7 @@ StatusCode ThreeViewTrackFragmentsAlgorithm::CalculateOverlapResult(const TwoDSl
     if (!this->CheckOverlapResult(overlapResult))
         return STATUS_CODE_NOT_FOUND;
 
-    fragmentOverlapResult = overlapResult;
+    fragmentOverlapResult = std::move(overlapResult);
     return STATUS_CODE_SUCCESS;
 }
 
@@ -336,24 +360,32 @@ StatusCode ThreeViewTrackFragmentsAlgorithm::GetProjectedPositions(
     if (nSamplingPoints < 1.f)
         return STATUS_CODE_NOT_FOUND;
 
-    // Loop over trajectory points
-    bool foundLastPosition(false);
-    CartesianVector lastPosition(0.f, 0.f, 0.f);
+    // Project trajectory points onto the fits, sweeping along each fit in a single pass
+    CartesianPointVector linearPositions1, linearPositions2;
 
     for (float iSample = 0.5f; iSample < nSamplingPoints; iSample += 1.f)
     {
         const CartesianVector linearPosition3D(vtxPosition3D + (endPosition3D - vtxPosition3D) * (iSample / nSamplingPoints));
-        const CartesianVector linearPosition1(LArGeometryHelper::ProjectPosition(this->GetPandora(), linearPosition3D, hitType1));
-        const CartesianVector linearPosition2(LArGeometryHelper::ProjectPosition(this->GetPandora(), linearPosition3D, hitType2));
+        linearPositions1.push_back(LArGeometryHelper::ProjectPosition(this->GetPandora(), linearPosition3D, hitType1));
+        linearPositions2.push_back(LArGeometryHelper::ProjectPosition(this->GetPandora(), linearPosition3D, hitType2));
+    }
 
-        float chi2(0.f);
-        CartesianVector fitPosition1(0.f, 0.f, 0.f), fitPosition2(0.f, 0.f, 0.f);
+    CartesianPointVector fitPositions1, fitPositions2;
+    TwoDSlidingFitResult::StatusCodeVector statusCodes1, statusCodes2;
+    fitResult1.GetGlobalFitProjections(linearPositions1, fitPositions1, statusCodes1);
+    fitResult2.GetGlobalFitProjections(linearPositions2, fitPositions2, statusCodes2);
 
-        if ((STATUS_CODE_SUCCESS != fitResult1.GetGlobalFitProjection(linearPosition1, fitPosition1)) ||
-            (STATUS_CODE_SUCCESS != fitResult2.GetGlobalFitProjection(linearPosition2, fitPosition2)))
-        {
+    // Loop over trajectory points
+    bool foundLastPosition(false);
+    CartesianVector lastPosition(0.f, 0.f, 0.f);
+
+    for (size_t iSample = 0; iSample < linearPositions1.size(); ++iSample)
+    {
+        if ((STATUS_CODE_SUCCESS != statusCodes1.at(iSample)) || (STATUS_CODE_SUCCESS != statusCodes2.at(iSample)))
             continue;
-        }
+
+        float chi2(0.f);
+        const CartesianVector &fitPosition1(fitPositions1.at(iSample)), &fitPosition2(fitPositions2.at(iSample));
 
         float rL1(0.f), rL2(0.f), rT1(0.f), rT2(0.f);
         fitResult1.GetLocalPosition(fitPosition1, rL1, rT1);
@@ -416,32 +448,31 @@ StatusCode ThreeViewTrackFragmentsAlgorithm::GetProjectedPositions(
 StatusCode ThreeViewTrackFragmentsAlgorithm::GetMatchedHits(const ClusterList &inputClusterList,
     const CartesianPointVector &projectedPositions, HitToClusterMap &hitToClusterMap, CaloHitList &matchedHits) const
 {
-    CaloHitVector availableCaloHits;
+    HitIndex &hitIndex(this->GetHitIndex(inputClusterList));
 
-    for (ClusterList::const_iterator iter = inputClusterList.begin(), iterEnd = inputClusterList.end(); iter != iterEnd; ++iter)
-    {
-        const Cluster *const pCluster = *iter;
-
-        if (!pCluster->IsAvailable())
-            continue;
+    // ATTN Hits outside the search region cannot be matched, nor can they displace a closer hit in the tie-breaking below
+    const float searchRegion(std::sqrt(m_maxPointDisplacementSquared) + 0.01f);
+    HitIndexKDNode2DList found;
+    UIntVector candidateIndices;
 
-        CaloHitList caloHitList;
-        pCluster->GetOrderedCaloHitList().FillCaloHitList(caloHitList);
-        availableCaloHits.insert(availableCaloHits.end(), caloHitList.begin(), caloHitList.end());
+    for (const CartesianVector &projectedPosition : projectedPositions)
+    {
+        found.clear();
+        hitIndex.m_kdTree.search(build_2d_kd_search_region(projectedPosition, searchRegion, searchRegion), found);
 
-        for (CaloHitList::const_iterator hIter = caloHitList.begin(), hIterEnd = caloHitList.end(); hIter != hIterEnd; ++hIter)
-            hitToClusterMap.insert(HitToClusterMap::value_type(*hIter, pCluster));
-    }
+        candidateIndices.clear();
+        for (const HitIndexKDNode2D &hitNode : found)
+            candidateIndices.push_back(hitNode.data);
 
-    std::sort(availableCaloHits.begin(), availableCaloHits.end(), LArClusterHelper::SortHitsByPosition);
+        // ATTN Candidate hits are considered in the order of the full sorted hit vector, so that ties are resolved as before
+        std::sort(candidateIndices.begin(), candidateIndices.end());
 
-    for (const CartesianVector &projectedPosition : projectedPositions)
-    {
         const CaloHit *pClosestCaloHit(nullptr);
         float closestDistanceSquared(std::numeric_limits<float>::max()), tieBreakerBestEnergy(0.f);
 
-        for (const CaloHit *const pCaloHit : availableCaloHits)
+        for (const unsigned int candidateIndex : candidateIndices)
         {
+            const CaloHit *const pCaloHit(hitIndex.m_sortedCaloHits[candidateIndex]);
             const float distanceSquared((pCaloHit->GetPositionVector() - projectedPosition).GetMagnitudeSquared());
 
             if ((distanceSquared < closestDistanceSquared) ||
@@ -456,7 +487,10 @@ StatusCode ThreeViewTrackFragmentsAlgorithm::GetMatchedHits(const ClusterList &i
 
         if ((closestDistanceSquared < m_maxPointDisplacementSquared) && (nullptr != pClosestCaloHit) &&
             (matchedHits.end() == std::find(matchedHits.begin(), matchedHits.end(), pClosestCaloHit)))
+        {
             matchedHits.push_back(pClosestCaloHit);
+            hitToClusterMap.insert(HitToClusterMap::value_type(pClosestCaloHit, hitIndex.m_hitToClusterMap.at(pClosestCaloHit)));
+        }
     }
 
     if (matchedHits.empty())
@@ -467,6 +501,53 @@ StatusCode ThreeViewTrackFragmentsAlgorithm::GetMatchedHits(const ClusterList &i
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+ThreeViewTrackFragmentsAlgorithm::HitIndex &ThreeViewTrackFragmentsAlgorithm::GetHitIndex(const ClusterList &inputClusterList) const
+{
+    HitIndexMap::iterator indexIter(m_hitIndexMap.find(&inputClusterList));
+
+    if (m_hitIndexMap.end() != indexIter)
+        return indexIter->second;
+
+    HitIndex &hitIndex(m_hitIndexMap[&inputClusterList]);
+
+    for (const Cluster *const pCluster : inputClusterList)
+    {
+        if (!pCluster->IsAvailable())
+            continue;
+
+        CaloHitList caloHitList;
+        pCluster->GetOrderedCaloHitList().FillCaloHitList(caloHitList);
+        hitIndex.m_sortedCaloHits.insert(hitIndex.m_sortedCaloHits.end(), caloHitList.begin(), caloHitList.end());
+
+        for (const CaloHit *const pCaloHit : caloHitList)
+            hitIndex.m_hitToClusterMap.insert(HitToClusterMap::value_type(pCaloHit, pCluster));
+    }
+
+    std::sort(hitIndex.m_sortedCaloHits.begin(), hitIndex.m_sortedCaloHits.end(), LArClusterHelper::SortHitsByPosition);
+
+    if (hitIndex.m_sortedCaloHits.empty())
+        return hitIndex;
+
+    HitIndexKDNode2DList hitKDNode2DList;
+    float minX(std::numeric_limits<float>::max()), maxX(-std::numeric_limits<float>::max());
+    float minZ(std::numeric_limits<float>::max()), maxZ(-std::numeric_limits<float>::max());
+
+    for (unsigned int index = 0; index < hitIndex.m_sortedCaloHits.size(); ++index)
+    {
+        const CartesianVector &position(hitIndex.m_sortedCaloHits[index]->GetPositionVector());
+        hitKDNode2DList.emplace_back(index, position.GetX(), position.GetZ());
+        minX = std::min(minX, position.GetX());
+        maxX = std::max(maxX, position.GetX());
+        minZ = std::min(minZ, position.GetZ());
+        maxZ = std::max(maxZ, position.GetZ());
+    }
+
+    hitIndex.m_kdTree.build(hitKDNode2DList, KDTreeBox(minX, maxX, minZ, maxZ));
+    return hitIndex;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode ThreeViewTrackFragmentsAlgorithm::GetMatchedClusters(const CaloHitList &matchedHits, const HitToClusterMap &hitToClusterMap,
     ClusterList &matchedClusters, const Cluster *&pBestMatchedCluster) const
 {
@@ -626,6 +707,10 @@ void ThreeViewTrackFragmentsAlgorithm::ExamineOverlapContainer()
 
     for (TensorToolVector::const_iterator iter = m_algorithmToolVector.begin(), iterEnd = m_algorithmToolVector.end(); iter != iterEnd;)
     {
+        // ATTN Stop at the event deadline, leaving the output of the completed tool runs
+        if (LArEventDeadlineHelper::IsDeadlineExceeded(this->GetPandora()))
+            break;
+
         if ((*iter)->Run(this, this->GetMatchingControl().GetOverlapTensor()))
         {
             iter = m_algorithmToolVector.begin();
@@ -642,6 +727,14 @@ void ThreeViewTrackFragmentsAlgorithm::ExamineOverlapContainer()
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void ThreeViewTrackFragmentsAlgorithm::TidyUp()
+{
+    m_hitIndexMap.clear();
+    BaseAlgorithm::TidyUp();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode ThreeViewTrackFragmentsAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
 {
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ProcessAlgorithm(*this, xmlHandle, "ClusterRebuilding", m_reclusteringAlgorithmName));
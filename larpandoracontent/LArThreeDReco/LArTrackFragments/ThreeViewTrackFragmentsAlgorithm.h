@@ -16,6 +16,8 @@
 #include "larpandoracontent/LArThreeDReco/LArThreeDBase/NViewTrackMatchingAlgorithm.h"
 #include "larpandoracontent/LArThreeDReco/LArThreeDBase/ThreeViewMatchingControl.h"
 
+#include "larpandoracontent/LArUtility/KDTreeLinkerAlgoT.h"
+
 #include <unordered_map>
 
 namespace lar_content
@@ -39,6 +41,8 @@ public:
     ThreeViewTrackFragmentsAlgorithm();
 
     void UpdateForNewCluster(const pandora::Cluster *const pNewCluster);
+    void UpdateUponDeletion(const pandora::Cluster *const pDeletedCluster);
+    bool CreateThreeDParticles(const ProtoParticleVector &protoParticleVector);
 
     /**
      *  @brief  Rebuild clusters after fragmentation
@@ -67,6 +71,31 @@ protected:
         const pandora::ClusterList &inputClusterList, const pandora::Cluster *&pBestMatchedCluster, FragmentOverlapResult &fragmentOverlapResult) const;
 
     typedef std::unordered_map<const pandora::CaloHit *, const pandora::Cluster *> HitToClusterMap;
+    typedef KDTreeLinkerAlgo<unsigned int, 2> HitIndexKDTree2D;
+    typedef KDTreeNodeInfoT<unsigned int, 2> HitIndexKDNode2D;
+    typedef std::vector<HitIndexKDNode2D> HitIndexKDNode2DList;
+
+    /**
+     *  @brief  HitIndex class, a spatial index over the hits of the available clusters in an input cluster list
+     */
+    class HitIndex
+    {
+    public:
+        pandora::CaloHitVector m_sortedCaloHits; ///< The hits of the available clusters, sorted by position
+        HitToClusterMap m_hitToClusterMap;       ///< The map from hit to available cluster
+        HitIndexKDTree2D m_kdTree;               ///< The kd tree over the hits, identified by index in the sorted hit vector
+    };
+
+    typedef std::unordered_map<const pandora::ClusterList *, HitIndex> HitIndexMap;
+
+    /**
+     *  @brief  Get the spatial index over the hits of the available clusters in an input cluster list, building it if required
+     *
+     *  @param  inputClusterList the input cluster list
+     *
+     *  @return the hit index
+     */
+    HitIndex &GetHitIndex(const pandora::ClusterList &inputClusterList) const;
 
     /**
      *  @brief  Get the list of projected positions, in the third view, corresponding to a pair of sliding fit results
@@ -81,7 +110,7 @@ protected:
         pandora::CartesianPointVector &projectedPositions) const;
 
     /**
-     *  @brief  Get the list of hits associated with the projected positions and a useful hit to cluster map
+     *  @brief  Get the list of hits associated with the projected positions and a useful hit to cluster map, holding the matched hits
      *
      *  @param  inputClusterList the input cluster list
      *  @param  projectedPositions the list of projected positions
@@ -137,6 +166,7 @@ protected:
     bool CheckOverlapResult(const FragmentOverlapResult &overlapResult) const;
 
     void ExamineOverlapContainer();
+    void TidyUp();
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
     typedef std::unordered_map<const pandora::Cluster *, unsigned int> ClusterToMatchedHitsMap;
@@ -153,6 +183,8 @@ protected:
     float m_maxPointDisplacementSquared;     ///< maximum allowed distance (squared) between projected points and associated hits
     float m_minMatchedSamplingPointFraction; ///< minimum fraction of matched sampling points
     unsigned int m_minMatchedHits;           ///< minimum number of matched calo hits
+
+    mutable HitIndexMap m_hitIndexMap; ///< The hit indices, by input cluster list, cleared whenever the clusters may have changed
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
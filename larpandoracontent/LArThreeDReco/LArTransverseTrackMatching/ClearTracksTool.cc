@@ -36,6 +36,13 @@ bool ClearTracksTool::Run(ThreeViewTransverseTracksAlgorithm *const pAlgorithm,
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+bool ClearTracksTool::ExaminesGroupsIndependently() const
+{
+    return true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void ClearTracksTool::CreateThreeDParticles(
     ThreeViewTransverseTracksAlgorithm *const pAlgorithm, const TensorType::ElementList &elementList, bool &particlesMade) const
 {
@@ -25,6 +25,7 @@ public:
     ClearTracksTool();
 
     bool Run(ThreeViewTransverseTracksAlgorithm *const pAlgorithm, TensorType &overlapTensor);
+    bool ExaminesGroupsIndependently() const;
 
 private:
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
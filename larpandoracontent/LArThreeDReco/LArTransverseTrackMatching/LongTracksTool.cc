@@ -82,6 +82,13 @@ bool LongTracksTool::Run(ThreeViewTransverseTracksAlgorithm *const pAlgorithm, T
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+bool LongTracksTool::ExaminesGroupsIndependently() const
+{
+    return true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void LongTracksTool::FindLongTracks(const TensorType &overlapTensor, ProtoParticleVector &protoParticleVector) const
 {
     ClusterSet usedClusters;
@@ -65,6 +65,9 @@ void MissingTrackSegmentTool::FindTracks(ThreeViewTransverseTracksAlgorithm *con
     ClusterVector sortedKeyClusters;
     overlapTensor.GetSortedKeyClusters(sortedKeyClusters);
 
+    // ATTN Merges are only made once all tracks are found, so fits made here remain valid for the duration of the tool run
+    SlidingFitCache slidingFitCache;
+
     for (const Cluster *const pKeyCluster : sortedKeyClusters)
     {
         if (!pKeyCluster->IsAvailable())
@@ -85,7 +88,7 @@ void MissingTrackSegmentTool::FindTracks(ThreeViewTransverseTracksAlgorithm *con
             if (!LongTracksTool::IsLongerThanDirectConnections(iIter, elementList, m_minMatchedSamplingPointRatio, usedClusters))
                 continue;
 
-            if (!this->PassesParticleChecks(pAlgorithm, *(*iIter), usedClusters, clusterMergeMap))
+            if (!this->PassesParticleChecks(pAlgorithm, *(*iIter), usedClusters, clusterMergeMap, slidingFitCache))
                 continue;
 
             ProtoParticle protoParticle;
@@ -138,7 +141,7 @@ void MissingTrackSegmentTool::SelectElements(
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 bool MissingTrackSegmentTool::PassesParticleChecks(ThreeViewTransverseTracksAlgorithm *const pAlgorithm, const TensorType::Element &element,
-    ClusterSet &usedClusters, ClusterMergeMap &clusterMergeMap) const
+    ClusterSet &usedClusters, ClusterMergeMap &clusterMergeMap, SlidingFitCache &slidingFitCache) const
 {
     try
     {
@@ -150,8 +153,8 @@ bool MissingTrackSegmentTool::PassesParticleChecks(ThreeViewTransverseTracksAlgo
         if (candidateClusters.empty())
             return false;
 
-        TwoDSlidingFitResultMap slidingFitResultMap;
-        this->GetSlidingFitResultMap(pAlgorithm, candidateClusters, slidingFitResultMap);
+        SlidingFitAddressMap slidingFitResultMap;
+        this->GetSlidingFitResultMap(pAlgorithm, candidateClusters, slidingFitCache, slidingFitResultMap);
 
         if (slidingFitResultMap.empty())
             return false;
@@ -194,7 +197,7 @@ void MissingTrackSegmentTool::GetCandidateClusters(
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void MissingTrackSegmentTool::GetSlidingFitResultMap(ThreeViewTransverseTracksAlgorithm *const pAlgorithm,
-    const ClusterList &candidateClusterList, TwoDSlidingFitResultMap &slidingFitResultMap) const
+    const ClusterList &candidateClusterList, SlidingFitCache &slidingFitCache, SlidingFitAddressMap &slidingFitResultMap) const
 {
     const float slidingFitPitch(LArGeometryHelper::GetWireZPitch(this->GetPandora()));
 
@@ -204,30 +207,41 @@ void MissingTrackSegmentTool::GetSlidingFitResultMap(ThreeViewTransverseTracksAl
 
         try
         {
-            const TwoDSlidingFitResult &slidingFitResult(pAlgorithm->GetCachedSlidingFitResult(pCluster));
-            (void)slidingFitResultMap.insert(TwoDSlidingFitResultMap::value_type(pCluster, slidingFitResult));
+            (void)slidingFitResultMap.insert(SlidingFitAddressMap::value_type(pCluster, &pAlgorithm->GetCachedSlidingFitResult(pCluster)));
             continue;
         }
         catch (StatusCodeException &)
         {
         }
 
-        try
-        {
-            const TwoDSlidingFitResult slidingFitResult(pCluster, pAlgorithm->GetSlidingFitWindow(), slidingFitPitch);
-            (void)slidingFitResultMap.insert(TwoDSlidingFitResultMap::value_type(pCluster, slidingFitResult));
+        if (slidingFitCache.m_failedFitClusters.count(pCluster))
             continue;
-        }
-        catch (StatusCodeException &)
+
+        TwoDSlidingFitResultMap::const_iterator fitIter(slidingFitCache.m_slidingFitResultMap.find(pCluster));
+
+        if (slidingFitCache.m_slidingFitResultMap.end() == fitIter)
         {
+            try
+            {
+                const TwoDSlidingFitResult slidingFitResult(pCluster, pAlgorithm->GetSlidingFitWindow(), slidingFitPitch);
+                TwoDSlidingFitResultMap &fitResultMap(slidingFitCache.m_slidingFitResultMap);
+                fitIter = fitResultMap.insert(TwoDSlidingFitResultMap::value_type(pCluster, slidingFitResult)).first;
+            }
+            catch (StatusCodeException &)
+            {
+                slidingFitCache.m_failedFitClusters.insert(pCluster);
+                continue;
+            }
         }
+
+        (void)slidingFitResultMap.insert(SlidingFitAddressMap::value_type(pCluster, &fitIter->second));
     }
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void MissingTrackSegmentTool::GetSegmentOverlapMap(ThreeViewTransverseTracksAlgorithm *const pAlgorithm, const Particle &particle,
-    const TwoDSlidingFitResultMap &slidingFitResultMap, SegmentOverlapMap &segmentOverlapMap) const
+    const SlidingFitAddressMap &slidingFitResultMap, SegmentOverlapMap &segmentOverlapMap) const
 {
     const TwoDSlidingFitResult &fitResult1(pAlgorithm->GetCachedSlidingFitResult(particle.m_pCluster1));
     const TwoDSlidingFitResult &fitResult2(pAlgorithm->GetCachedSlidingFitResult(particle.m_pCluster2));
@@ -262,7 +276,7 @@ void MissingTrackSegmentTool::GetSegmentOverlapMap(ThreeViewTransverseTracksAlgo
 
         for (const Cluster *const pCluster : clusterList)
         {
-            const TwoDSlidingFitResult &slidingFitResult(slidingFitResultMap.at(pCluster));
+            const TwoDSlidingFitResult &slidingFitResult(*slidingFitResultMap.at(pCluster));
             CartesianVector fitVector(0.f, 0.f, 0.f), fitDirection(0.f, 0.f, 0.f);
 
             if ((STATUS_CODE_SUCCESS != slidingFitResult.GetGlobalFitPositionAtX(x, fitVector)) ||
@@ -290,7 +304,7 @@ void MissingTrackSegmentTool::GetSegmentOverlapMap(ThreeViewTransverseTracksAlgo
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-bool MissingTrackSegmentTool::MakeDecisions(const Particle &particle, const TwoDSlidingFitResultMap &slidingFitResultMap,
+bool MissingTrackSegmentTool::MakeDecisions(const Particle &particle, const SlidingFitAddressMap &slidingFitResultMap,
     const SegmentOverlapMap &segmentOverlapMap, ClusterSet &usedClusters, ClusterMergeMap &clusterMergeMap) const
 {
     ClusterVector possibleMerges;
@@ -356,18 +370,18 @@ bool MissingTrackSegmentTool::PassesSamplingCuts(const SegmentOverlap &segmentOv
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 bool MissingTrackSegmentTool::IsPossibleMerge(const Cluster *const pCluster, const Particle &particle, const SegmentOverlap &segmentOverlap,
-    const TwoDSlidingFitResultMap &slidingFitResultMap) const
+    const SlidingFitAddressMap &slidingFitResultMap) const
 {
     if ((segmentOverlap.m_pseudoChi2Sum / static_cast<float>(segmentOverlap.m_nSamplingPoints)) > m_mergeMaxChi2PerSamplingPoint)
         return false;
 
-    TwoDSlidingFitResultMap::const_iterator fitIter = slidingFitResultMap.find(pCluster);
+    SlidingFitAddressMap::const_iterator fitIter = slidingFitResultMap.find(pCluster);
 
     if (slidingFitResultMap.end() == fitIter)
         throw StatusCodeException(STATUS_CODE_FAILURE);
 
     float mergeMinX(std::numeric_limits<float>::max()), mergeMaxX(-std::numeric_limits<float>::max());
-    fitIter->second.GetMinAndMaxX(mergeMinX, mergeMaxX);
+    fitIter->second->GetMinAndMaxX(mergeMinX, mergeMaxX);
 
     // cluster should not be wider than the longest span
     if ((mergeMinX < particle.m_longMinX - m_mergeXContainmentTolerance) || (mergeMaxX > particle.m_longMaxX + m_mergeXContainmentTolerance))
@@ -72,10 +72,22 @@ private:
         float m_matchedSamplingMaxX;           ///< The max matched sampling point x coordinate
     };
 
+    /**
+     *  @brief  SlidingFitCache class, holding the sliding fits of candidate clusters absent from the algorithm cache, for the duration of a
+     *          single tool run (during which no clusters are modified)
+     */
+    class SlidingFitCache
+    {
+    public:
+        TwoDSlidingFitResultMap m_slidingFitResultMap; ///< The sliding fit results of candidate clusters absent from the algorithm cache
+        pandora::ClusterSet m_failedFitClusters;       ///< The candidate clusters for which no sliding fit can be made
+    };
+
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
     typedef std::unordered_map<const pandora::Cluster *, SegmentOverlap> SegmentOverlapMap;
     typedef std::unordered_map<const pandora::Cluster *, pandora::ClusterList> ClusterMergeMap;
+    typedef std::unordered_map<const pandora::Cluster *, const TwoDSlidingFitResult *> SlidingFitAddressMap;
 
     /**
      *  @brief  Find remaining tracks, hidden by missing track segments (and maybe other ambiguities) in the tensor
@@ -104,9 +116,10 @@ private:
      *  @param  element the tensor element
      *  @param  usedClusters the list of used clusters
      *  @param  clusterMergeMap to receive the cluster merge map
+     *  @param  slidingFitCache the sliding fit cache for the current tool run
      */
     bool PassesParticleChecks(ThreeViewTransverseTracksAlgorithm *const pAlgorithm, const TensorType::Element &element,
-        pandora::ClusterSet &usedClusters, ClusterMergeMap &clusterMergeMap) const;
+        pandora::ClusterSet &usedClusters, ClusterMergeMap &clusterMergeMap, SlidingFitCache &slidingFitCache) const;
 
     /**
      *  @brief  Get a list of candidate clusters, which may represent missing track segments for a provided particle
@@ -118,14 +131,16 @@ private:
     void GetCandidateClusters(ThreeViewTransverseTracksAlgorithm *const pAlgorithm, const Particle &particle, pandora::ClusterList &candidateClusters) const;
 
     /**
-     *  @brief  Get a sliding fit result map for the list of candidate clusters
+     *  @brief  Get a sliding fit result map for the list of candidate clusters, using the algorithm cache where possible and otherwise
+     *          fitting each cluster at most once per tool run
      *
      *  @param  pAlgorithm address of the calling algorithm
      *  @param  candidateClusters the list of candidate clusters
-     *  @param  slidingFitResultMap to receive the sliding fit result map
+     *  @param  slidingFitCache the sliding fit cache for the current tool run
+     *  @param  slidingFitResultMap to receive the addresses of the sliding fit results
      */
     void GetSlidingFitResultMap(ThreeViewTransverseTracksAlgorithm *const pAlgorithm, const pandora::ClusterList &candidateClusterList,
-        TwoDSlidingFitResultMap &slidingFitResultMap) const;
+        SlidingFitCache &slidingFitCache, SlidingFitAddressMap &slidingFitResultMap) const;
 
     /**
      *  @brief  Get a segment overlap map, describing overlap between a provided particle and all clusters in a sliding fit result map
@@ -136,7 +151,7 @@ private:
      *  @param  segmentOverlapMap to receive the segment overlap map
      */
     void GetSegmentOverlapMap(ThreeViewTransverseTracksAlgorithm *const pAlgorithm, const Particle &particle,
-        const TwoDSlidingFitResultMap &slidingFitResultMap, SegmentOverlapMap &segmentOverlapMap) const;
+        const SlidingFitAddressMap &slidingFitResultMap, SegmentOverlapMap &segmentOverlapMap) const;
 
     /**
      *  @brief  Make decisions about whether to create a pfo for a provided particle and whether to make cluster merges
@@ -149,7 +164,7 @@ private:
      *
      *  @return whether to make the particle
      */
-    bool MakeDecisions(const Particle &particle, const TwoDSlidingFitResultMap &slidingFitResultMap,
+    bool MakeDecisions(const Particle &particle, const SlidingFitAddressMap &slidingFitResultMap,
         const SegmentOverlapMap &segmentOverlapMap, pandora::ClusterSet &usedClusters, ClusterMergeMap &clusterMergeMap) const;
 
     /**
@@ -172,7 +187,7 @@ private:
      *  @return boolean
      */
     bool IsPossibleMerge(const pandora::Cluster *const pCluster, const Particle &particle, const SegmentOverlap &segmentOverlap,
-        const TwoDSlidingFitResultMap &slidingFitResultMap) const;
+        const SlidingFitAddressMap &slidingFitResultMap) const;
 
     float m_minMatchedFraction;                  ///< The min matched sampling point fraction for particle creation
     unsigned int m_minMatchedSamplingPoints;     ///< The min number of matched sampling points for particle creation
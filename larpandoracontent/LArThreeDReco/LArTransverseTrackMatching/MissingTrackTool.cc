@@ -38,6 +38,13 @@ bool MissingTrackTool::Run(ThreeViewTransverseTracksAlgorithm *const pAlgorithm,
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+bool MissingTrackTool::ExaminesGroupsIndependently() const
+{
+    return true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void MissingTrackTool::FindMissingTracks(const TensorType &overlapTensor, ProtoParticleVector &protoParticleVector) const
 {
     ClusterSet usedClusters;
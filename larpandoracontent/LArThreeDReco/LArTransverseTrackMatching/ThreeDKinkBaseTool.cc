@@ -137,6 +137,13 @@ bool ThreeDKinkBaseTool::Run(ThreeViewTransverseTracksAlgorithm *const pAlgorith
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+bool ThreeDKinkBaseTool::ExaminesGroupsIndependently() const
+{
+    return true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void ThreeDKinkBaseTool::GetModifications(
     ThreeViewTransverseTracksAlgorithm *const pAlgorithm, const TensorType &overlapTensor, ModificationList &modificationList) const
 {
@@ -34,6 +34,7 @@ public:
     virtual ~ThreeDKinkBaseTool();
 
     bool Run(ThreeViewTransverseTracksAlgorithm *const pAlgorithm, TensorType &overlapTensor);
+    bool ExaminesGroupsIndependently() const;
 
 protected:
     /**
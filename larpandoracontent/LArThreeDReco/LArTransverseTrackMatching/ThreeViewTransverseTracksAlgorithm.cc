@@ -19,6 +19,7 @@ namespace lar_content
 {
 
 ThreeViewTransverseTracksAlgorithm::ThreeViewTransverseTracksAlgorithm() :
+    m_recordModifiedClusters(false),
     m_nMaxTensorToolRepeats(1000),
     m_maxFitSegmentIndex(50),
     m_pseudoChi2Cut(3.f),
@@ -32,6 +33,44 @@ ThreeViewTransverseTracksAlgorithm::ThreeViewTransverseTracksAlgorithm() :
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void ThreeViewTransverseTracksAlgorithm::UpdateForNewCluster(const Cluster *const pNewCluster)
+{
+    this->RecordModifiedCluster(pNewCluster);
+    BaseAlgorithm::UpdateForNewCluster(pNewCluster);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ThreeViewTransverseTracksAlgorithm::UpdateUponDeletion(const Cluster *const pDeletedCluster)
+{
+    // ATTN Removing a cluster can disconnect, or remove, other clusters in its group, so record the whole group before the removal
+    if (m_recordModifiedClusters)
+    {
+        ClusterSet connectedClusters;
+        this->GetMatchingControl().GetOverlapTensor().GetConnectedClusters(ClusterSet({pDeletedCluster}), connectedClusters);
+        m_modifiedClusters.insert(m_modifiedClusters.end(), connectedClusters.begin(), connectedClusters.end());
+    }
+
+    this->RecordModifiedCluster(pDeletedCluster);
+    BaseAlgorithm::UpdateUponDeletion(pDeletedCluster);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool ThreeViewTransverseTracksAlgorithm::CreateThreeDParticles(const ProtoParticleVector &protoParticleVector)
+{
+    // ATTN Particle creation changes the availability of the clusters used
+    for (const ProtoParticle &protoParticle : protoParticleVector)
+    {
+        for (const Cluster *const pCluster : protoParticle.m_clusterList)
+            this->RecordModifiedCluster(pCluster);
+    }
+
+    return BaseAlgorithm::CreateThreeDParticles(protoParticleVector);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void ThreeViewTransverseTracksAlgorithm::CalculateOverlapResult(const Cluster *const pClusterU, const Cluster *const pClusterV, const Cluster *const pClusterW)
 {
     TransverseOverlapResult overlapResult;
@@ -143,33 +182,53 @@ StatusCode ThreeViewTransverseTracksAlgorithm::GetSegmentOverlap(const FitSegmen
 
     const unsigned int nPoints(1 + static_cast<unsigned int>((nPointsU + nPointsV + nPointsW) / 3.f));
 
-    // Chi2 calculations
-    float pseudoChi2Sum(0.f);
-    unsigned int nSamplingPoints(0), nMatchedSamplingPoints(0);
+    FloatVector xVector;
+    xVector.reserve(nPoints + 1);
 
     for (unsigned int n = 0; n <= nPoints; ++n)
-    {
-        const float x(minX + (maxX - minX) * static_cast<float>(n) / static_cast<float>(nPoints));
+        xVector.push_back(minX + (maxX - minX) * static_cast<float>(n) / static_cast<float>(nPoints));
+
+    CartesianPointVector fitUVectors, fitVVectors, fitWVectors, fitUDirections, fitVDirections, fitWDirections;
+    TwoDSlidingFitResult::StatusCodeVector statusCodesU, statusCodesV, statusCodesW;
+    slidingFitResultU.GetTransverseProjections(xVector, fitSegmentU, fitUVectors, fitUDirections, statusCodesU);
+    slidingFitResultV.GetTransverseProjections(xVector, fitSegmentV, fitVVectors, fitVDirections, statusCodesV);
+    slidingFitResultW.GetTransverseProjections(xVector, fitSegmentW, fitWVectors, fitWDirections, statusCodesW);
 
-        CartesianVector fitUVector(0.f, 0.f, 0.f), fitVVector(0.f, 0.f, 0.f), fitWVector(0.f, 0.f, 0.f);
-        CartesianVector fitUDirection(0.f, 0.f, 0.f), fitVDirection(0.f, 0.f, 0.f), fitWDirection(0.f, 0.f, 0.f);
+    // Merge positions for sampling points with projections in all three views
+    UIntVector sampleIndices;
+    FloatVector uVector, vVector, wVector;
 
-        if ((STATUS_CODE_SUCCESS != slidingFitResultU.GetTransverseProjection(x, fitSegmentU, fitUVector, fitUDirection)) ||
-            (STATUS_CODE_SUCCESS != slidingFitResultV.GetTransverseProjection(x, fitSegmentV, fitVVector, fitVDirection)) ||
-            (STATUS_CODE_SUCCESS != slidingFitResultW.GetTransverseProjection(x, fitSegmentW, fitWVector, fitWDirection)))
+    for (unsigned int n = 0; n <= nPoints; ++n)
+    {
+        if ((STATUS_CODE_SUCCESS != statusCodesU[n]) || (STATUS_CODE_SUCCESS != statusCodesV[n]) ||
+            (STATUS_CODE_SUCCESS != statusCodesW[n]))
         {
             continue;
         }
 
-        const float u(fitUVector.GetZ()), v(fitVVector.GetZ()), w(fitWVector.GetZ());
-        const float uv2w(LArGeometryHelper::MergeTwoPositions(this->GetPandora(), TPC_VIEW_U, TPC_VIEW_V, u, v));
-        const float uw2v(LArGeometryHelper::MergeTwoPositions(this->GetPandora(), TPC_VIEW_U, TPC_VIEW_W, u, w));
-        const float vw2u(LArGeometryHelper::MergeTwoPositions(this->GetPandora(), TPC_VIEW_V, TPC_VIEW_W, v, w));
+        sampleIndices.push_back(n);
+        uVector.push_back(fitUVectors[n].GetZ());
+        vVector.push_back(fitVVectors[n].GetZ());
+        wVector.push_back(fitWVectors[n].GetZ());
+    }
 
-        ++nSamplingPoints;
-        const float deltaU((vw2u - u) * fitUDirection.GetX());
-        const float deltaV((uw2v - v) * fitVDirection.GetX());
-        const float deltaW((uv2w - w) * fitWDirection.GetX());
+    FloatVector uv2wVector, uw2vVector, vw2uVector;
+    LArGeometryHelper::MergeTwoPositions<TPC_VIEW_U, TPC_VIEW_V>(this->GetPandora(), uVector, vVector, uv2wVector);
+    LArGeometryHelper::MergeTwoPositions<TPC_VIEW_U, TPC_VIEW_W>(this->GetPandora(), uVector, wVector, uw2vVector);
+    LArGeometryHelper::MergeTwoPositions<TPC_VIEW_V, TPC_VIEW_W>(this->GetPandora(), vVector, wVector, vw2uVector);
+
+    // Chi2 calculations
+    const unsigned int nSamplingPoints(sampleIndices.size());
+    unsigned int nMatchedSamplingPoints(0);
+    float pseudoChi2Sum(0.f);
+
+    // ATTN Sum in sampling order, so that the rounding of the pseudo chi2 sum is unchanged
+    for (unsigned int iSample = 0; iSample < nSamplingPoints; ++iSample)
+    {
+        const unsigned int n(sampleIndices[iSample]);
+        const float deltaU((vw2uVector[iSample] - uVector[iSample]) * fitUDirections[n].GetX());
+        const float deltaV((uw2vVector[iSample] - vVector[iSample]) * fitVDirections[n].GetX());
+        const float deltaW((uv2wVector[iSample] - wVector[iSample]) * fitWDirections[n].GetX());
 
         const float pseudoChi2(deltaW * deltaW + deltaV * deltaV + deltaU * deltaU);
         pseudoChi2Sum += pseudoChi2;
@@ -294,24 +353,32 @@ void ThreeViewTransverseTracksAlgorithm::GetPreviousOverlapResults(const unsigne
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void ThreeViewTransverseTracksAlgorithm::RecordModifiedCluster(const Cluster *const pCluster)
+{
+    if (m_recordModifiedClusters)
+        m_modifiedClusters.push_back(pCluster);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void ThreeViewTransverseTracksAlgorithm::ExamineOverlapContainer()
 {
-    unsigned int repeatCounter(0);
+    const unsigned int nGlobalModifications(0);
 
-    for (TensorToolVector::const_iterator iter = m_algorithmToolVector.begin(), iterEnd = m_algorithmToolVector.end(); iter != iterEnd;)
-    {
-        if ((*iter)->Run(this, this->GetMatchingControl().GetOverlapTensor()))
-        {
-            iter = m_algorithmToolVector.begin();
+    m_modifiedClusters.clear();
+    m_recordModifiedClusters = true;
 
-            if (++repeatCounter > m_nMaxTensorToolRepeats)
-                break;
-        }
-        else
-        {
-            ++iter;
-        }
-    }
+    this->RunToolsOverModifiedGroups(this, m_algorithmToolVector, this->GetMatchingControl().GetOverlapTensor(), m_modifiedClusters,
+        nGlobalModifications, m_nMaxTensorToolRepeats, true);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ThreeViewTransverseTracksAlgorithm::TidyUp()
+{
+    m_recordModifiedClusters = false;
+    m_modifiedClusters.clear();
+    BaseAlgorithm::TidyUp();
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -355,6 +422,19 @@ StatusCode ThreeViewTransverseTracksAlgorithm::ReadSettings(const TiXmlHandle xm
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
         XmlHelper::ReadValue(xmlHandle, "MinSamplingPointsPerLayer", m_minSamplingPointsPerLayer));
 
+    // ATTN The overlap calculation only reads the cached sliding fits and the settings, so overlap results can be calculated in parallel
+    this->GetMatchingControl().SetOverlapFunction([this](const Cluster *const pClusterU, const Cluster *const pClusterV,
+                                                      const Cluster *const pClusterW, TransverseOverlapResult &overlapResult) {
+        return this->CalculateOverlapResult(pClusterU, pClusterV, pClusterW, overlapResult);
+    });
+
+    // ATTN Fit segments lie within the x span of their sliding fit, so triplets whose fits have no mutual x overlap can be skipped
+    this->GetMatchingControl().SetXSpanFunction(
+        [this](const Cluster *const pCluster, float &minX, float &maxX) {
+            this->GetCachedSlidingFitResult(pCluster).GetMinAndMaxX(minX, maxX);
+        },
+        std::numeric_limits<float>::epsilon());
+
     return BaseAlgorithm::ReadSettings(xmlHandle);
 }
 
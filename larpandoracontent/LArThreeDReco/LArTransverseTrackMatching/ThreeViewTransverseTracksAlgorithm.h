@@ -36,6 +36,10 @@ public:
      */
     ThreeViewTransverseTracksAlgorithm();
 
+    void UpdateForNewCluster(const pandora::Cluster *const pNewCluster);
+    void UpdateUponDeletion(const pandora::Cluster *const pDeletedCluster);
+    bool CreateThreeDParticles(const ProtoParticleVector &protoParticleVector);
+
 private:
     typedef std::map<unsigned int, TransverseOverlapResult> FitSegmentToOverlapResultMap;
     typedef std::map<unsigned int, FitSegmentToOverlapResultMap> FitSegmentMatrix;
@@ -103,12 +107,23 @@ private:
     void GetPreviousOverlapResults(const unsigned int indexU, const unsigned int indexV, const unsigned int indexW,
         FitSegmentTensor &fitSegmentSumTensor, TransverseOverlapResultVector &transverseOverlapResultVector) const;
 
+    /**
+     *  @brief  Record a modified cluster, if examining the overlap container
+     *
+     *  @param  pCluster address of the modified cluster
+     */
+    void RecordModifiedCluster(const pandora::Cluster *const pCluster);
+
     void ExamineOverlapContainer();
+    void TidyUp();
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
     typedef std::vector<TransverseTensorTool *> TensorToolVector;
     TensorToolVector m_algorithmToolVector; ///< The algorithm tool vector
 
+    bool m_recordModifiedClusters;             ///< Whether to record modified clusters, whilst examining the overlap container
+    pandora::ClusterVector m_modifiedClusters; ///< The modified clusters, in order of modification, which may since have been deleted
+
     unsigned int m_nMaxTensorToolRepeats;   ///< The maximum number of repeat loops over tensor tools
     unsigned int m_maxFitSegmentIndex;      ///< The maximum number of fit segments used when identifying best overlap result
     float m_pseudoChi2Cut;                  ///< The pseudo chi2 cut to identify matched sampling points
@@ -139,8 +154,23 @@ public:
      *  @return whether changes have been made by the tool
      */
     virtual bool Run(ThreeViewTransverseTracksAlgorithm *const pAlgorithm, TensorType &overlapTensor) = 0;
+
+    /**
+     *  @brief  Whether the tool examines each group of connected clusters independently, using only the tensor elements, availability
+     *          and sliding fits of the clusters in the group, so that a run examining only a subset of groups is a run over those groups
+     *
+     *  @return boolean
+     */
+    virtual bool ExaminesGroupsIndependently() const;
 };
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline bool TransverseTensorTool::ExaminesGroupsIndependently() const
+{
+    return false;
+}
+
 } // namespace lar_content
 
 #endif // #ifndef LAR_THREE_VIEW_TRANSVERSE_TRACKS_ALGORITHM_H
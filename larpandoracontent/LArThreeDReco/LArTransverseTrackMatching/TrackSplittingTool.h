@@ -25,6 +25,7 @@ public:
     TrackSplittingTool();
 
     bool Run(ThreeViewTransverseTracksAlgorithm *const pAlgorithm, TensorType &overlapTensor);
+    bool ExaminesGroupsIndependently() const;
 
 private:
     /**
@@ -49,6 +49,13 @@ bool TracksCrossingGapsTool::Run(ThreeViewTransverseTracksAlgorithm *const pAlgo
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+bool TracksCrossingGapsTool::ExaminesGroupsIndependently() const
+{
+    return true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void TracksCrossingGapsTool::FindTracks(
     ThreeViewTransverseTracksAlgorithm *const pAlgorithm, const TensorType &overlapTensor, ProtoParticleVector &protoParticleVector) const
 {
@@ -158,6 +165,10 @@ void TracksCrossingGapsTool::CalculateEffectiveOverlapSpan(ThreeViewTransverseTr
     float dxUmin(0.f), dxVmin(0.f), dxWmin(0.f);
     float dxUmax(0.f), dxVmax(0.f), dxWmax(0.f);
 
+    const TwoDSlidingFitResult &slidingFitResultU(pAlgorithm->GetCachedSlidingFitResult(element.GetClusterU()));
+    const TwoDSlidingFitResult &slidingFitResultV(pAlgorithm->GetCachedSlidingFitResult(element.GetClusterV()));
+    const TwoDSlidingFitResult &slidingFitResultW(pAlgorithm->GetCachedSlidingFitResult(element.GetClusterW()));
+
     // ATTN break out of loops to to avoid finding a non-related gap far from  cluster itself
     const int nSamplingPointsLeft(1 + static_cast<int>((minCommonX - xMinAll) / m_sampleStepSize));
     const int nSamplingPointsRight(1 + static_cast<int>((xMaxAll - maxCommonX) / m_sampleStepSize));
@@ -167,7 +178,7 @@ void TracksCrossingGapsTool::CalculateEffectiveOverlapSpan(ThreeViewTransverseTr
         bool gapInU(false), gapInV(false), gapInW(false);
         const float xSample(std::max(xMinAll, minCommonX - static_cast<float>(iSample) * m_sampleStepSize));
 
-        if (!this->PassesGapChecks(pAlgorithm, element, xSample, gapInU, gapInV, gapInW))
+        if (!this->PassesGapChecks(slidingFitResultU, slidingFitResultV, slidingFitResultW, xSample, gapInU, gapInV, gapInW))
             break;
 
         if (gapInU)
@@ -183,7 +194,7 @@ void TracksCrossingGapsTool::CalculateEffectiveOverlapSpan(ThreeViewTransverseTr
         bool gapInU(false), gapInV(false), gapInW(false);
         const float xSample(std::min(xMaxAll, maxCommonX + static_cast<float>(iSample) * m_sampleStepSize));
 
-        if (!this->PassesGapChecks(pAlgorithm, element, xSample, gapInU, gapInV, gapInW))
+        if (!this->PassesGapChecks(slidingFitResultU, slidingFitResultV, slidingFitResultW, xSample, gapInU, gapInV, gapInW))
             break;
 
         if (gapInU)
@@ -204,13 +215,9 @@ void TracksCrossingGapsTool::CalculateEffectiveOverlapSpan(ThreeViewTransverseTr
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-bool TracksCrossingGapsTool::PassesGapChecks(ThreeViewTransverseTracksAlgorithm *const pAlgorithm, const TensorType::Element &element,
-    const float xSample, bool &gapInU, bool &gapInV, bool &gapInW) const
+bool TracksCrossingGapsTool::PassesGapChecks(const TwoDSlidingFitResult &slidingFitResultU, const TwoDSlidingFitResult &slidingFitResultV,
+    const TwoDSlidingFitResult &slidingFitResultW, const float xSample, bool &gapInU, bool &gapInV, bool &gapInW) const
 {
-    const TwoDSlidingFitResult &slidingFitResultU(pAlgorithm->GetCachedSlidingFitResult(element.GetClusterU()));
-    const TwoDSlidingFitResult &slidingFitResultV(pAlgorithm->GetCachedSlidingFitResult(element.GetClusterV()));
-    const TwoDSlidingFitResult &slidingFitResultW(pAlgorithm->GetCachedSlidingFitResult(element.GetClusterW()));
-
     // If we have access to the global x position in all three clusters, there are no gaps involved (or cluster already spans small gaps)
     CartesianVector fitUPosition(0.f, 0.f, 0.f), fitVPosition(0.f, 0.f, 0.f), fitWPosition(0.f, 0.f, 0.f);
     const StatusCode statusCodeU(slidingFitResultU.GetGlobalFitPositionAtX(xSample, fitUPosition));
@@ -245,10 +252,11 @@ bool TracksCrossingGapsTool::CheckXPositionInGap(const float xSample, const TwoD
     const TwoDSlidingFitResult &slidingFitResult2, const TwoDSlidingFitResult &slidingFitResult3, bool &gapIn1, bool &gapIn2, bool &gapIn3) const
 {
     CartesianVector fitPosition2(0.f, 0.f, 0.f), fitPosition3(0.f, 0.f, 0.f);
+    const bool hasFitPosition2(STATUS_CODE_SUCCESS == slidingFitResult2.GetGlobalFitPositionAtX(xSample, fitPosition2));
+    const bool hasFitPosition3(STATUS_CODE_SUCCESS == slidingFitResult3.GetGlobalFitPositionAtX(xSample, fitPosition3));
 
     // If we have the global position at X from the two other clusters, calculate projection in the first view and check for gaps
-    if ((STATUS_CODE_SUCCESS == slidingFitResult2.GetGlobalFitPositionAtX(xSample, fitPosition2)) &&
-        (STATUS_CODE_SUCCESS == slidingFitResult3.GetGlobalFitPositionAtX(xSample, fitPosition3)))
+    if (hasFitPosition2 && hasFitPosition3)
     {
         const HitType hitType1(LArClusterHelper::GetClusterHitType(slidingFitResult1.GetCluster()));
         const HitType hitType2(LArClusterHelper::GetClusterHitType(slidingFitResult2.GetCluster()));
@@ -266,8 +274,7 @@ bool TracksCrossingGapsTool::CheckXPositionInGap(const float xSample, const TwoD
         return false;
 
     // If we dont have a projection at x in the other two clusters, check if they are in gaps or at the end of the cluster
-    if ((STATUS_CODE_SUCCESS != slidingFitResult2.GetGlobalFitPositionAtX(xSample, fitPosition2)) &&
-        (STATUS_CODE_SUCCESS != slidingFitResult3.GetGlobalFitPositionAtX(xSample, fitPosition3)))
+    if (!hasFitPosition2 && !hasFitPosition3)
     {
         const bool endIn2(this->IsEndOfCluster(xSample, slidingFitResult2));
         const bool endIn3(this->IsEndOfCluster(xSample, slidingFitResult3));
@@ -282,7 +289,7 @@ bool TracksCrossingGapsTool::CheckXPositionInGap(const float xSample, const TwoD
     }
 
     // Finally, check whether there is a second gap involved
-    if (STATUS_CODE_SUCCESS != slidingFitResult2.GetGlobalFitPositionAtX(xSample, fitPosition2))
+    if (!hasFitPosition2)
     {
         gapIn2 = LArGeometryHelper::IsXSamplingPointInGap(this->GetPandora(), xSample, slidingFitResult2, m_sampleStepSize);
         return (gapIn2 || this->IsEndOfCluster(xSample, slidingFitResult2));
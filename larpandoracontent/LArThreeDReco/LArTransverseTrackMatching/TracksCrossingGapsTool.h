@@ -26,6 +26,7 @@ public:
     TracksCrossingGapsTool();
 
     bool Run(ThreeViewTransverseTracksAlgorithm *const pAlgorithm, TensorType &overlapTensor);
+    bool ExaminesGroupsIndependently() const;
 
 private:
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
@@ -80,8 +81,9 @@ private:
     /**
      *  @brief  Check whether there is any gap in the three U-V-W clusters combination
      *
-     *  @param  pAlgorithm address of the calling algorithm
-     *  @param  element the connected tensor element
+     *  @param  slidingFitResultU the sliding fit result for the u cluster
+     *  @param  slidingFitResultV the sliding fit result for the v cluster
+     *  @param  slidingFitResultW the sliding fit result for the w cluster
      *  @param  xSample the x sampling position
      *  @param  gapInU to receive whether there is a gap in the u view
      *  @param  gapInV to receive whether there is a gap in the v view
@@ -89,8 +91,8 @@ private:
      *
      *  @return boolean
      */
-    bool PassesGapChecks(ThreeViewTransverseTracksAlgorithm *const pAlgorithm, const TensorType::Element &element, const float xSample,
-        bool &gapInU, bool &gapInV, bool &gapInW) const;
+    bool PassesGapChecks(const TwoDSlidingFitResult &slidingFitResultU, const TwoDSlidingFitResult &slidingFitResultV,
+        const TwoDSlidingFitResult &slidingFitResultW, const float xSample, bool &gapInU, bool &gapInV, bool &gapInW) const;
 
     /**
      *  @brief  Check individually each cluster where a gap might be present
@@ -25,6 +25,7 @@ public:
     TwoViewClearTracksTool();
 
     bool Run(TwoViewTransverseTracksAlgorithm *const pAlgorithm, MatrixType &overlapMatrix);
+    bool ExaminesGroupsIndependently() const;
 
 private:
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
@@ -81,6 +81,13 @@ bool TwoViewLongTracksTool::Run(TwoViewTransverseTracksAlgorithm *const pAlgorit
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+bool TwoViewLongTracksTool::ExaminesGroupsIndependently() const
+{
+    return true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void TwoViewLongTracksTool::FindLongTracks(const MatrixType &overlapMatrix, ProtoParticleVector &protoParticleVector) const
 {
     ClusterSet usedClusters;
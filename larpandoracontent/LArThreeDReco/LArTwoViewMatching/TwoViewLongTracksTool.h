@@ -46,6 +46,7 @@ public:
         const unsigned int minMatchedSamplingPointRatio, const pandora::ClusterSet &usedClusters);
 
     bool Run(TwoViewTransverseTracksAlgorithm *const pAlgorithm, MatrixType &overlapMatrix);
+    bool ExaminesGroupsIndependently() const;
 
 private:
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
@@ -38,6 +38,13 @@ bool TwoViewSimpleTracksTool::Run(TwoViewTransverseTracksAlgorithm *const pAlgor
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+bool TwoViewSimpleTracksTool::ExaminesGroupsIndependently() const
+{
+    return true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void TwoViewSimpleTracksTool::FindBestTrack(const MatrixType &overlapMatrix, ProtoParticleVector &protoParticleVector) const
 {
     ClusterVector sortedKeyClusters;
@@ -25,6 +25,7 @@ public:
     TwoViewSimpleTracksTool();
 
     bool Run(TwoViewTransverseTracksAlgorithm *const pAlgorithm, MatrixType &overlapMatrix);
+    bool ExaminesGroupsIndependently() const;
 
 private:
     /**
@@ -34,6 +34,7 @@ public:
     virtual ~TwoViewThreeDKinkTool();
 
     bool Run(TwoViewTransverseTracksAlgorithm *const pAlgorithm, MatrixType &overlapMatrix);
+    bool ExaminesGroupsIndependently() const;
 
 private:
     /**
@@ -21,10 +21,12 @@ namespace lar_content
 {
 
 TwoViewTransverseTracksAlgorithm::TwoViewTransverseTracksAlgorithm() :
+    m_recordModifiedClusters(false),
     m_nMaxMatrixToolRepeats(1000),
     m_downsampleFactor(5),
     m_minSamples(11),
     m_nPermutations(1000),
+    m_nPermutationThreads(1),
     m_localMatchingScoreThreshold(0.99f),
     m_maxDotProduct(0.998f),
     m_minOverallMatchingScore(0.1f),
@@ -35,6 +37,45 @@ TwoViewTransverseTracksAlgorithm::TwoViewTransverseTracksAlgorithm() :
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void TwoViewTransverseTracksAlgorithm::UpdateForNewCluster(const Cluster *const pNewCluster)
+{
+    this->RecordModifiedCluster(pNewCluster);
+    BaseAlgorithm::UpdateForNewCluster(pNewCluster);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void TwoViewTransverseTracksAlgorithm::UpdateUponDeletion(const Cluster *const pDeletedCluster)
+{
+    // ATTN Removing a cluster can disconnect, or remove, other clusters in its group, so record the whole group before the removal
+    if (m_recordModifiedClusters)
+    {
+        ClusterSet connectedClusters;
+        this->GetMatchingControl().GetOverlapMatrix().GetConnectedClusters(ClusterSet({pDeletedCluster}), connectedClusters);
+        m_modifiedClusters.insert(m_modifiedClusters.end(), connectedClusters.begin(), connectedClusters.end());
+    }
+
+    this->RecordModifiedCluster(pDeletedCluster);
+    m_primaryAxisDotDriftAxisMap.erase(pDeletedCluster);
+    BaseAlgorithm::UpdateUponDeletion(pDeletedCluster);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool TwoViewTransverseTracksAlgorithm::CreateThreeDParticles(const ProtoParticleVector &protoParticleVector)
+{
+    // ATTN Particle creation changes the availability of the clusters used
+    for (const ProtoParticle &protoParticle : protoParticleVector)
+    {
+        for (const Cluster *const pCluster : protoParticle.m_clusterList)
+            this->RecordModifiedCluster(pCluster);
+    }
+
+    return BaseAlgorithm::CreateThreeDParticles(protoParticleVector);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void TwoViewTransverseTracksAlgorithm::CalculateOverlapResult(const Cluster *const pCluster1, const Cluster *const pCluster2, const Cluster *const)
 {
     m_randomNumberGenerator.seed(
@@ -118,7 +159,8 @@ pandora::StatusCode TwoViewTransverseTracksAlgorithm::CalculateOverlapResult(
         LArDiscreteProbabilityHelper::CalculateCorrelationCoefficient(resampledDiscreteProbabilityVector1, resampledDiscreteProbabilityVector2));
 
     const float pvalue(LArDiscreteProbabilityHelper::CalculateCorrelationCoefficientPValueFromPermutationTest(
-        resampledDiscreteProbabilityVector1, resampledDiscreteProbabilityVector2, m_randomNumberGenerator, m_nPermutations));
+        resampledDiscreteProbabilityVector1, resampledDiscreteProbabilityVector2, m_randomNumberGenerator(), m_nPermutations,
+        m_nPermutationThreads));
 
     const float matchingScore(1.f - pvalue);
     if (matchingScore < m_minOverallMatchingScore)
@@ -154,6 +196,7 @@ unsigned int TwoViewTransverseTracksAlgorithm::CalculateNumberOfLocallyMatchingS
 
     pandora::FloatVector localValues1, localValues2;
     unsigned int nMatchedComparisons(0);
+    const float maxLocalPValue(1.f - m_localMatchingScoreThreshold - std::numeric_limits<float>::epsilon());
 
     for (unsigned int iValue = 0; iValue < discreteProbabilityVector1.GetSize(); ++iValue)
     {
@@ -161,11 +204,11 @@ unsigned int TwoViewTransverseTracksAlgorithm::CalculateNumberOfLocallyMatchingS
         localValues2.emplace_back(discreteProbabilityVector2.GetProbability(iValue));
         if (localValues1.size() == m_minSamples)
         {
-            float localPValue(0);
+            bool isLocallyMatched(true);
             try
             {
-                localPValue = LArDiscreteProbabilityHelper::CalculateCorrelationCoefficientPValueFromPermutationTest(
-                    localValues1, localValues2, randomNumberGenerator, m_nPermutations);
+                isLocallyMatched = LArDiscreteProbabilityHelper::IsCorrelationCoefficientPValueBelowThreshold(
+                    localValues1, localValues2, maxLocalPValue, randomNumberGenerator(), m_nPermutations, m_nPermutationThreads);
             }
             catch (const StatusCodeException &)
             {
@@ -181,7 +224,7 @@ unsigned int TwoViewTransverseTracksAlgorithm::CalculateNumberOfLocallyMatchingS
                 std::cout << std::endl;
             }
 
-            if ((1.f - localPValue) - m_localMatchingScoreThreshold > std::numeric_limits<float>::epsilon())
+            if (isLocallyMatched)
                 nMatchedComparisons++;
 
             localValues1.erase(localValues1.begin());
@@ -195,6 +238,11 @@ unsigned int TwoViewTransverseTracksAlgorithm::CalculateNumberOfLocallyMatchingS
 
 float TwoViewTransverseTracksAlgorithm::GetPrimaryAxisDotDriftAxis(const pandora::Cluster *const pCluster)
 {
+    const ClusterToDotProductMap::const_iterator iter(m_primaryAxisDotDriftAxisMap.find(pCluster));
+
+    if (m_primaryAxisDotDriftAxisMap.end() != iter)
+        return iter->second;
+
     pandora::CartesianPointVector pointVector;
     LArClusterHelper::GetCoordinateVector(pCluster, pointVector);
 
@@ -205,28 +253,41 @@ float TwoViewTransverseTracksAlgorithm::GetPrimaryAxisDotDriftAxis(const pandora
 
     const pandora::CartesianVector primaryAxis(eigenVecs.at(0));
     const pandora::CartesianVector driftAxis(1.f, 0.f, 0.f);
-    return primaryAxis.GetDotProduct(driftAxis);
+    const float dotProduct(primaryAxis.GetDotProduct(driftAxis));
+
+    m_primaryAxisDotDriftAxisMap[pCluster] = dotProduct;
+    return dotProduct;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void TwoViewTransverseTracksAlgorithm::RecordModifiedCluster(const Cluster *const pCluster)
+{
+    if (m_recordModifiedClusters)
+        m_modifiedClusters.push_back(pCluster);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void TwoViewTransverseTracksAlgorithm::ExamineOverlapContainer()
 {
-    unsigned int repeatCounter(0);
-    for (MatrixToolVector::const_iterator iter = m_algorithmToolVector.begin(), iterEnd = m_algorithmToolVector.end(); iter != iterEnd;)
-    {
-        if ((*iter)->Run(this, this->GetMatchingControl().GetOverlapMatrix()))
-        {
-            iter = m_algorithmToolVector.begin();
+    const unsigned int nGlobalModifications(0);
 
-            if (++repeatCounter > m_nMaxMatrixToolRepeats)
-                break;
-        }
-        else
-        {
-            ++iter;
-        }
-    }
+    m_modifiedClusters.clear();
+    m_recordModifiedClusters = true;
+
+    this->RunToolsOverModifiedGroups(this, m_algorithmToolVector, this->GetMatchingControl().GetOverlapMatrix(), m_modifiedClusters,
+        nGlobalModifications, m_nMaxMatrixToolRepeats, true);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void TwoViewTransverseTracksAlgorithm::TidyUp()
+{
+    m_recordModifiedClusters = false;
+    m_modifiedClusters.clear();
+    m_primaryAxisDotDriftAxisMap.clear();
+    BaseAlgorithm::TidyUp();
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -256,6 +317,9 @@ StatusCode TwoViewTransverseTracksAlgorithm::ReadSettings(const TiXmlHandle xmlH
 
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "NPermutations", m_nPermutations));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "NPermutationThreads", m_nPermutationThreads));
+
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
         XmlHelper::ReadValue(xmlHandle, "LocalMatchingScoreThreshold", m_localMatchingScoreThreshold));
 
@@ -267,6 +331,20 @@ StatusCode TwoViewTransverseTracksAlgorithm::ReadSettings(const TiXmlHandle xmlH
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
         XmlHelper::ReadValue(xmlHandle, "MinOverallLocallyMatchedFraction", m_minOverallLocallyMatchedFraction));
 
+    // ATTN Pairs without x overlap never form overlap results, so can be skipped. Clusters without x span are never skipped, so that
+    // the overlap calculation still reports them as invalid
+    this->GetMatchingControl().SetXSpanFunction(
+        [](const Cluster *const pCluster, float &minX, float &maxX) {
+            pCluster->GetClusterSpanX(minX, maxX);
+
+            if ((maxX - minX) < std::numeric_limits<float>::epsilon())
+            {
+                minX = -std::numeric_limits<float>::max();
+                maxX = std::numeric_limits<float>::max();
+            }
+        },
+        std::numeric_limits<float>::epsilon());
+
     return BaseAlgorithm::ReadSettings(xmlHandle);
 }
 
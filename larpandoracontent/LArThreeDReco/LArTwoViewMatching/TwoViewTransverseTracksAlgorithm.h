@@ -18,6 +18,7 @@
 #include "larpandoracontent/LArThreeDReco/LArThreeDBase/TwoViewMatchingControl.h"
 
 #include <random>
+#include <unordered_map>
 
 namespace lar_content
 {
@@ -40,6 +41,10 @@ public:
      */
     TwoViewTransverseTracksAlgorithm();
 
+    void UpdateForNewCluster(const pandora::Cluster *const pNewCluster);
+    void UpdateUponDeletion(const pandora::Cluster *const pDeletedCluster);
+    bool CreateThreeDParticles(const ProtoParticleVector &protoParticleVector);
+
 private:
     void CalculateOverlapResult(const pandora::Cluster *const pCluster1, const pandora::Cluster *const pCluster2, const pandora::Cluster *const);
 
@@ -66,7 +71,7 @@ private:
         const DiscreteProbabilityVector &discreteProbabilityVector2, std::mt19937 &randomNumberGenerator);
 
     /**
-     *  @brief  Get the dot product between the cluster's primary axis and the drift axis
+     *  @brief  Get the dot product between the cluster's primary axis and the drift axis, calculating it only on first use for each cluster
      *
      *  @param  pCluster the cluster
      *
@@ -74,21 +79,36 @@ private:
      */
     float GetPrimaryAxisDotDriftAxis(const pandora::Cluster *const pCluster);
 
+    /**
+     *  @brief  Record a modified cluster, if examining the overlap container
+     *
+     *  @param  pCluster address of the modified cluster
+     */
+    void RecordModifiedCluster(const pandora::Cluster *const pCluster);
+
     void ExamineOverlapContainer();
+    void TidyUp();
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
     typedef std::vector<TransverseMatrixTool *> MatrixToolVector;
     MatrixToolVector m_algorithmToolVector; ///< The algorithm tool vector
 
+    bool m_recordModifiedClusters;             ///< Whether to record modified clusters, whilst examining the overlap container
+    pandora::ClusterVector m_modifiedClusters; ///< The modified clusters, in order of modification, which may since have been deleted
+
     unsigned int m_nMaxMatrixToolRepeats;     ///< The maximum number of repeat loops over matrix tools
     unsigned int m_downsampleFactor;          ///< The downsampling (hit merging) applied to hits in the overlap region
     unsigned int m_minSamples;                ///< The minimum number of samples needed for comparing charges
     unsigned int m_nPermutations;             ///< The number of permutations for calculating p-values
+    unsigned int m_nPermutationThreads;       ///< The number of threads between which to share the permutations (zero for all available)
     float m_localMatchingScoreThreshold;      ///< The minimum score to classify a local region as matching
     float m_maxDotProduct;                    ///M The maximum allowed cluster primary qxis Dot drift axis to fill the overlap result
     float m_minOverallMatchingScore;          ///< The minimum required global matching score to fill the overlap result
     float m_minOverallLocallyMatchedFraction; ///< The minimum required lcoally matched fraction to fill the overlap result
     std::mt19937 m_randomNumberGenerator;     ///< The random number generator
+
+    typedef std::unordered_map<const pandora::Cluster *, float> ClusterToDotProductMap;
+    ClusterToDotProductMap m_primaryAxisDotDriftAxisMap; ///< The cached primary axis dot drift axis values, by cluster
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -111,8 +131,23 @@ public:
      *  @return whether changes have been made by the tool
      */
     virtual bool Run(TwoViewTransverseTracksAlgorithm *const pAlgorithm, MatrixType &overlapMatrix) = 0;
+
+    /**
+     *  @brief  Whether the tool examines each group of connected clusters independently, using only the matrix elements, availability
+     *          and sliding fits of the clusters in the group, so that a run examining only a subset of groups is a run over those groups
+     *
+     *  @return boolean
+     */
+    virtual bool ExaminesGroupsIndependently() const;
 };
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline bool TransverseMatrixTool::ExaminesGroupsIndependently() const
+{
+    return false;
+}
+
 } // namespace lar_content
 
 #endif // #ifndef LAR_TWO_VIEW_TRANSVERSE_TRACKS_ALGORITHM_H
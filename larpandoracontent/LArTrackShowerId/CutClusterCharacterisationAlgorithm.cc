@@ -10,6 +10,7 @@
 
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
+#include "larpandoracontent/LArHelpers/LArSlidingFitCacheHelper.h"
 
 #include "larpandoracontent/LArObjects/LArTwoDSlidingFitResult.h"
 #include "larpandoracontent/LArObjects/LArTwoDSlidingShowerFitResult.h"
@@ -96,7 +97,9 @@ bool CutClusterCharacterisationAlgorithm::IsClearTrack(const Cluster *const pClu
 
     try
     {
-        const TwoDSlidingFitResult slidingFitResult(pCluster, m_slidingFitWindow, LArGeometryHelper::GetWireZPitch(this->GetPandora()));
+        // ATTN The same fit is typically requested by other algorithms and feature tools, so draw it from the event cache
+        const TwoDSlidingFitResult &slidingFitResult(LArSlidingFitCacheHelper::GetSlidingFitResult(
+            this->GetPandora(), pCluster, m_slidingFitWindow, LArGeometryHelper::GetWireZPitch(this->GetPandora())));
         const CartesianVector globalMinLayerPosition(slidingFitResult.GetGlobalMinLayerPosition());
         straightLineLength = (slidingFitResult.GetGlobalMaxLayerPosition() - globalMinLayerPosition).GetMagnitude();
 
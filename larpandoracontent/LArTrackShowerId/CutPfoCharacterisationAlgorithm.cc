@@ -10,6 +10,7 @@
 
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
 #include "larpandoracontent/LArHelpers/LArPfoHelper.h"
+#include "larpandoracontent/LArHelpers/LArSlidingFitCacheHelper.h"
 
 #include "larpandoracontent/LArObjects/LArTwoDSlidingFitResult.h"
 
@@ -41,7 +42,9 @@ bool CutPfoCharacterisationAlgorithm::IsClearTrack(const Cluster *const pCluster
 
     try
     {
-        const TwoDSlidingFitResult slidingFitResult(pCluster, m_slidingFitWindow, LArGeometryHelper::GetWireZPitch(this->GetPandora()));
+        // ATTN The same fit is typically requested by other algorithms and feature tools, so draw it from the event cache
+        const TwoDSlidingFitResult &slidingFitResult(LArSlidingFitCacheHelper::GetSlidingFitResult(
+            this->GetPandora(), pCluster, m_slidingFitWindow, LArGeometryHelper::GetWireZPitch(this->GetPandora())));
         straightLineLength = (slidingFitResult.GetGlobalMaxLayerPosition() - slidingFitResult.GetGlobalMinLayerPosition()).GetMagnitude();
 
         for (const auto &mapEntry : slidingFitResult.GetLayerFitResultMap())
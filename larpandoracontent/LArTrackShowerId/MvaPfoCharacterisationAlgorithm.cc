@@ -9,6 +9,7 @@
 #include "Pandora/AlgorithmHeaders.h"
 
 #include "larpandoracontent/LArHelpers/LArFileHelper.h"
+#include "larpandoracontent/LArHelpers/LArParallelHelper.h"
 #include "larpandoracontent/LArHelpers/LArPfoHelper.h"
 
 #include "larpandoracontent/LArObjects/LArTwoDSlidingFitResult.h"
@@ -37,12 +38,107 @@ MvaPfoCharacterisationAlgorithm<T>::MvaPfoCharacterisationAlgorithm() :
     m_fiducialMinZ(-std::numeric_limits<float>::max()),
     m_fiducialMaxZ(std::numeric_limits<float>::max()),
     m_applyReconstructabilityChecks(false),
+    m_batchedCharacterisation(false),
+    m_nFeatureThreads(1),
     m_filePathEnvironmentVariable("FW_SEARCH_PATH")
 {
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+template <typename T>
+MvaPfoCharacterisationAlgorithm<T>::~MvaPfoCharacterisationAlgorithm()
+{
+    if (m_trainingSetMode && (STATUS_CODE_SUCCESS != LArMvaHelper::FlushTrainingExamples()))
+        std::cout << "MvaPfoCharacterisationAlgorithm: Unable to flush training examples" << std::endl;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+void MvaPfoCharacterisationAlgorithm<T>::IdentifyClearTracks(const PfoList &pfoList, PfoToIsTrackLikeMap &pfoToIsTrackLikeMap) const
+{
+    if (!m_batchedCharacterisation || m_trainingSetMode)
+        return;
+
+    // ATTN Feature calculation only reads the event, so pfos can be processed in parallel ahead of any list or metadata changes
+    // ATTN The interaction vertex is resolved here, as the current vertex list must not be accessed from the feature threads
+    const PfoVector pfoVector(pfoList.begin(), pfoList.end());
+    const Vertex *const pInteractionVertex(PfoFeatureContext::FindInteractionVertex(this));
+    PfoFeaturesVector pfoFeaturesVector(pfoVector.size());
+
+    LArParallelHelper::ForEach(pfoVector.size(), m_nFeatureThreads, [&](const unsigned int iPfo) {
+        this->CalculatePfoFeatures(pfoVector.at(iPfo), pInteractionVertex, pfoFeaturesVector.at(iPfo));
+    });
+
+    LArMvaHelper::DoubleVector scores(pfoVector.size(), 0.);
+
+    if (m_enableProbability)
+    {
+        for (const bool hasChargeInfo : {true, false})
+        {
+            UIntVector pfoIndices;
+            LArMvaHelper::MvaFeatureMatrix featureMatrix;
+
+            for (unsigned int iPfo = 0; iPfo < pfoVector.size(); ++iPfo)
+            {
+                const PfoFeatures &pfoFeatures(pfoFeaturesVector.at(iPfo));
+
+                if (!pfoFeatures.m_isValid || (hasChargeInfo != pfoFeatures.m_hasChargeInfo))
+                    continue;
+
+                LArMvaHelper::MvaFeatureVector featureVector;
+
+                for (const std::string &featureName : pfoFeatures.m_featureOrder)
+                    featureVector.push_back(pfoFeatures.m_featureMap.at(featureName));
+
+                pfoIndices.push_back(iPfo);
+                featureMatrix.push_back(featureVector);
+            }
+
+            if (featureMatrix.empty())
+                continue;
+
+            LArMvaHelper::DoubleVector probabilities;
+            LArMvaHelper::CalculateProbabilities((hasChargeInfo ? m_mva : m_mvaNoChargeInfo), featureMatrix, probabilities);
+
+            for (unsigned int iRow = 0; iRow < pfoIndices.size(); ++iRow)
+                scores.at(pfoIndices.at(iRow)) = probabilities.at(iRow);
+        }
+    }
+
+    for (unsigned int iPfo = 0; iPfo < pfoVector.size(); ++iPfo)
+    {
+        const ParticleFlowObject *const pPfo(pfoVector.at(iPfo));
+        const PfoFeatures &pfoFeatures(pfoFeaturesVector.at(iPfo));
+
+        if (!pfoFeatures.m_isValid)
+            continue;
+
+        if (!m_enableProbability)
+        {
+            const T &mva(pfoFeatures.m_hasChargeInfo ? m_mva : m_mvaNoChargeInfo);
+            pfoToIsTrackLikeMap[pPfo] = LArMvaHelper::Classify(mva, pfoFeatures.m_featureOrder, pfoFeatures.m_featureMap);
+            continue;
+        }
+
+        const double score(scores.at(iPfo));
+        object_creation::ParticleFlowObject::Metadata metadata;
+        metadata.m_propertiesToAdd["TrackScore"] = score;
+        if (m_persistFeatures)
+        {
+            for (auto const &[name, value] : pfoFeatures.m_featureMap)
+            {
+                metadata.m_propertiesToAdd[name] = value.Get();
+            }
+        }
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::ParticleFlowObject::AlterMetadata(*this, pPfo, metadata));
+        pfoToIsTrackLikeMap[pPfo] = (m_minProbabilityCut <= score);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template <typename T>
 bool MvaPfoCharacterisationAlgorithm<T>::IsClearTrack(const Cluster *const pCluster) const
 {
@@ -354,6 +450,12 @@ StatusCode MvaPfoCharacterisationAlgorithm<T>::ReadSettings(const TiXmlHandle xm
     PANDORA_RETURN_RESULT_IF_AND_IF(
         STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "MinProbabilityCut", m_minProbabilityCut));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
+        XmlHelper::ReadValue(xmlHandle, "BatchedCharacterisation", m_batchedCharacterisation));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "NFeatureThreads", m_nFeatureThreads));
+
     if (m_trainingSetMode)
     {
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "CaloHitListName", m_caloHitListName));
@@ -429,6 +531,47 @@ StatusCode MvaPfoCharacterisationAlgorithm<T>::ReadSettings(const TiXmlHandle xm
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+template <typename T>
+void MvaPfoCharacterisationAlgorithm<T>::CalculatePfoFeatures(
+    const ParticleFlowObject *const pPfo, const Vertex *const pInteractionVertex, PfoFeatures &pfoFeatures) const
+{
+    pfoFeatures.m_isValid = false;
+    pfoFeatures.m_hasChargeInfo = false;
+
+    // ATTN Pfos left invalid are characterised individually, which handles those without three dimensional information or features
+    if (!LArPfoHelper::IsThreeD(pPfo))
+        return;
+
+    // Charge related features are only calculated using hits in W view
+    ClusterList wClusterList;
+    LArPfoHelper::GetClusters(pPfo, TPC_VIEW_W, wClusterList);
+    pfoFeatures.m_hasChargeInfo = !wClusterList.empty();
+
+    const PfoCharacterisationFeatureTool::FeatureToolMap &chosenFeatureToolMap(
+        pfoFeatures.m_hasChargeInfo ? m_featureToolMapThreeD : m_featureToolMapNoChargeInfo);
+    const StringVector &chosenFeatureToolOrder(pfoFeatures.m_hasChargeInfo ? m_algorithmToolNames : m_algorithmToolNamesNoChargeInfo);
+
+    // ATTN Publish the feature context before running the feature tools, so that they reuse it rather than building their own
+    MvaFeatureCache featureCache;
+    const MvaFeatureCache::Scope scope(featureCache);
+    (void)PfoFeatureContext::Get(pInteractionVertex, pPfo);
+
+    pfoFeatures.m_featureMap =
+        LArMvaHelper::CalculateFeatures(chosenFeatureToolOrder, chosenFeatureToolMap, pfoFeatures.m_featureOrder, this, pPfo);
+
+    for (auto const &[featureKey, featureValue] : pfoFeatures.m_featureMap)
+    {
+        (void)featureKey;
+
+        if (!featureValue.IsInitialized())
+            return;
+    }
+
+    pfoFeatures.m_isValid = true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template <typename T>
 bool MvaPfoCharacterisationAlgorithm<T>::PassesFiducialCut(const CartesianVector &vertex) const
 {
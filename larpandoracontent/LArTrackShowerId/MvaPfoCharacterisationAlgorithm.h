@@ -18,6 +18,8 @@
 
 #include "Pandora/PandoraInternal.h"
 
+#include <vector>
+
 namespace lar_content
 {
 
@@ -33,7 +35,13 @@ public:
      */
     MvaPfoCharacterisationAlgorithm();
 
+    /**
+     *  @brief  Destructor, flushing any buffered training examples
+     */
+    ~MvaPfoCharacterisationAlgorithm();
+
 protected:
+    virtual void IdentifyClearTracks(const pandora::PfoList &pfoList, PfoToIsTrackLikeMap &pfoToIsTrackLikeMap) const;
     virtual bool IsClearTrack(const pandora::ParticleFlowObject *const pPfo) const;
     virtual bool IsClearTrack(const pandora::Cluster *const pCluster) const;
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
@@ -64,6 +72,8 @@ protected:
     float m_fiducialMinZ;                 ///< Fiducial volume minimum z
     float m_fiducialMaxZ;                 ///< Fiducial volume maximum z
     bool m_applyReconstructabilityChecks; ///< Whether to apply reconstructability checks during training
+    bool m_batchedCharacterisation;       ///< Whether to calculate features for a whole pfo list ahead of a single batched mva evaluation
+    unsigned int m_nFeatureThreads;       ///< The number of threads for batched feature calculation, zero to use all hardware threads
 
     std::string m_caloHitListName;    ///< Name of input calo hit list
     std::string m_mcParticleListName; ///< Name of input MC particle list
@@ -78,6 +88,30 @@ protected:
     LArMCParticleHelper::PrimaryParameters m_primaryParameters; ///< The mc particle primary selection parameters
 
 private:
+    /**
+     *  @brief  PfoFeatures class, holding the features calculated for a pfo in batched characterisation
+     */
+    class PfoFeatures
+    {
+    public:
+        bool m_isValid;                           ///< Whether all features could be calculated for a three dimensional pfo
+        bool m_hasChargeInfo;                     ///< Whether the pfo has a W view cluster, and thus charge info
+        pandora::StringVector m_featureOrder;     ///< The feature order
+        LArMvaHelper::MvaFeatureMap m_featureMap; ///< The feature map
+    };
+
+    typedef std::vector<PfoFeatures> PfoFeaturesVector;
+
+    /**
+     *  @brief  Calculate the features for a pfo in batched characterisation
+     *
+     *  @param  pPfo address of the pfo
+     *  @param  pInteractionVertex address of the interaction vertex, resolved ahead of the batch
+     *  @param  pfoFeatures to receive the features
+     */
+    void CalculatePfoFeatures(
+        const pandora::ParticleFlowObject *const pPfo, const pandora::Vertex *const pInteractionVertex, PfoFeatures &pfoFeatures) const;
+
     /**
      *  @brief  Checks if the interaction vertex is within the fiducial volume
      *
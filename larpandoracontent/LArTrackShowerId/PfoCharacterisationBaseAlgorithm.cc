@@ -53,10 +53,18 @@ StatusCode PfoCharacterisationBaseAlgorithm::Run()
             continue;
         }
 
+        PfoToIsTrackLikeMap pfoToIsTrackLikeMap;
+
+        if (m_useThreeDInformation)
+            this->IdentifyClearTracks(*pPfoList, pfoToIsTrackLikeMap);
+
         for (const ParticleFlowObject *const pPfo : *pPfoList)
         {
             PandoraContentApi::ParticleFlowObject::Metadata pfoMetadata;
-            const bool isTrackLike(m_useThreeDInformation ? this->IsClearTrack(pPfo) : this->IsClearTrack3x2D(pPfo));
+            const PfoToIsTrackLikeMap::const_iterator isTrackLikeIter(pfoToIsTrackLikeMap.find(pPfo));
+            const bool isTrackLike((pfoToIsTrackLikeMap.end() != isTrackLikeIter)
+                    ? isTrackLikeIter->second
+                    : (m_useThreeDInformation ? this->IsClearTrack(pPfo) : this->IsClearTrack3x2D(pPfo)));
 
             if (isTrackLike)
             {
@@ -105,6 +113,12 @@ StatusCode PfoCharacterisationBaseAlgorithm::Run()
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void PfoCharacterisationBaseAlgorithm::IdentifyClearTracks(const PfoList & /*pfoList*/, PfoToIsTrackLikeMap & /*pfoToIsTrackLikeMap*/) const
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 bool PfoCharacterisationBaseAlgorithm::IsClearTrack3x2D(const ParticleFlowObject *const pPfo) const
 {
     ClusterList twoDClusterList;
@@ -10,6 +10,8 @@
 
 #include "Pandora/Algorithm.h"
 
+#include <unordered_map>
+
 namespace lar_content
 {
 
@@ -30,8 +32,19 @@ public:
     virtual ~PfoCharacterisationBaseAlgorithm();
 
 protected:
+    typedef std::unordered_map<const pandora::ParticleFlowObject *, bool> PfoToIsTrackLikeMap;
+
     pandora::StatusCode Run();
 
+    /**
+     *  @brief  Identify, ahead of the individual characterisation of each pfo, which of the pfos in a list are clear tracks. Intended for
+     *          algorithms able to characterise a whole list of pfos at once; pfos absent from the output map are characterised individually
+     *
+     *  @param  pfoList the pfo list
+     *  @param  pfoToIsTrackLikeMap to receive the map from pfo to whether it is a clear track
+     */
+    virtual void IdentifyClearTracks(const pandora::PfoList &pfoList, PfoToIsTrackLikeMap &pfoToIsTrackLikeMap) const;
+
     /**
      *  @brief  Whether pfo is identified as a clear track using its three clusters
      *
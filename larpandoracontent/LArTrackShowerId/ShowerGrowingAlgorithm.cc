@@ -9,6 +9,7 @@
 #include "Pandora/AlgorithmHeaders.h"
 
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
+#include "larpandoracontent/LArHelpers/LArEventDeadlineHelper.h"
 
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
 #include "larpandoracontent/LArHelpers/LArPointingClusterHelper.h"
@@ -66,6 +67,9 @@ bool ShowerGrowingAlgorithm::SortClusters(const Cluster *const pLhs, const Clust
 
 StatusCode ShowerGrowingAlgorithm::Run()
 {
+    // ATTN The cluster bounding boxes used to pre-check each seed association are only cached within a geometry cache scope
+    const LArClusterHelper::GeometryCacheScope geometryCacheScope;
+
     for (const std::string &clusterListName : m_inputClusterListNames)
     {
         try
@@ -84,10 +88,12 @@ StatusCode ShowerGrowingAlgorithm::Run()
 
             this->SimpleModeShowerGrowing(pClusterList, clusterListName);
             m_clusterDirectionMap.clear();
+            m_associationTypeMap.clear();
         }
         catch (StatusCodeException &statusCodeException)
         {
             m_clusterDirectionMap.clear();
+            m_associationTypeMap.clear();
             throw statusCodeException;
         }
     }
@@ -117,10 +123,11 @@ void ShowerGrowingAlgorithm::SimpleModeShowerGrowing(const ClusterList *const pC
         this->ProcessSeedAssociationDetails(vertexSeedAssociationList, clusterListName, usedClusters);
     }
 
-    // Non-vertex showers
+    // Non-vertex showers, stopping at the event deadline with the showers grown so far
     const Cluster *pSeedCluster(nullptr);
 
-    while (this->GetNextSeedCandidate(pClusterList, usedClusters, pSeedCluster))
+    while (!LArEventDeadlineHelper::IsDeadlineExceeded(this->GetPandora()) &&
+           this->GetNextSeedCandidate(pClusterList, usedClusters, pSeedCluster))
     {
         SeedAssociationList seedAssociationList;
         this->GetSeedAssociationList(ClusterVector(1, pSeedCluster), pClusterList, seedAssociationList);
@@ -258,6 +265,7 @@ void ShowerGrowingAlgorithm::ProcessSeedAssociationDetails(
 void ShowerGrowingAlgorithm::ProcessBranchClusters(const Cluster *const pParentCluster, const ClusterVector &branchClusters, const std::string &listName) const
 {
     m_clusterDirectionMap.erase(pParentCluster);
+    this->RemoveCachedAssociationTypes(pParentCluster);
 
     for (const Cluster *const pBranchCluster : branchClusters)
     {
@@ -268,6 +276,7 @@ void ShowerGrowingAlgorithm::ProcessBranchClusters(const Cluster *const pParentC
         }
 
         m_clusterDirectionMap.erase(pBranchCluster);
+        this->RemoveCachedAssociationTypes(pBranchCluster);
     }
 }
 
@@ -275,6 +284,38 @@ void ShowerGrowingAlgorithm::ProcessBranchClusters(const Cluster *const pParentC
 
 ShowerGrowingAlgorithm::AssociationType ShowerGrowingAlgorithm::AreClustersAssociated(const Cluster *const pClusterSeed, const Cluster *const pCluster) const
 {
+    // ATTN Association types depend only upon the two clusters, so are cached until either cluster is modified by a merge
+    ClusterToAssociationTypeMap &associationTypeMap(m_associationTypeMap[pClusterSeed]);
+    ClusterToAssociationTypeMap::const_iterator iter(associationTypeMap.find(pCluster));
+
+    if (associationTypeMap.end() != iter)
+        return iter->second;
+
+    const AssociationType associationType(this->CalculateAssociationType(pClusterSeed, pCluster));
+    associationTypeMap[pCluster] = associationType;
+
+    return associationType;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+ShowerGrowingAlgorithm::AssociationType ShowerGrowingAlgorithm::CalculateAssociationType(
+    const Cluster *const pClusterSeed, const Cluster *const pCluster) const
+{
+    // Every association requires a layer centroid of one cluster to lie within the nearby distance of the other cluster. Layer centroids
+    // lie within the bounding box of their cluster, so clusters with well separated bounding boxes cannot be associated.
+    CartesianVector seedMinimum(0.f, 0.f, 0.f), seedMaximum(0.f, 0.f, 0.f), minimum(0.f, 0.f, 0.f), maximum(0.f, 0.f, 0.f);
+    LArClusterHelper::GetClusterBoundingBox(pClusterSeed, seedMinimum, seedMaximum);
+    LArClusterHelper::GetClusterBoundingBox(pCluster, minimum, maximum);
+
+    const float dX(std::max(0.f, std::max(minimum.GetX() - seedMaximum.GetX(), seedMinimum.GetX() - maximum.GetX())));
+    const float dY(std::max(0.f, std::max(minimum.GetY() - seedMaximum.GetY(), seedMinimum.GetY() - maximum.GetY())));
+    const float dZ(std::max(0.f, std::max(minimum.GetZ() - seedMaximum.GetZ(), seedMinimum.GetZ() - maximum.GetZ())));
+    const float maxBoundingBoxDistance(m_nearbyClusterDistance + 0.01f);
+
+    if ((dX * dX + dY * dY + dZ * dZ) > maxBoundingBoxDistance * maxBoundingBoxDistance)
+        return NONE;
+
     const VertexList *pVertexList(nullptr);
     PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::GetCurrentList(*this, pVertexList));
     const Vertex *const pVertex(
@@ -355,6 +396,16 @@ ShowerGrowingAlgorithm::AssociationType ShowerGrowingAlgorithm::AreClustersAssoc
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void ShowerGrowingAlgorithm::RemoveCachedAssociationTypes(const Cluster *const pCluster) const
+{
+    m_associationTypeMap.erase(pCluster);
+
+    for (auto &mapEntry : m_associationTypeMap)
+        mapEntry.second.erase(pCluster);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 float ShowerGrowingAlgorithm::GetFigureOfMerit(const SeedAssociationList &seedAssociationList) const
 {
     const VertexList *pVertexList(nullptr);
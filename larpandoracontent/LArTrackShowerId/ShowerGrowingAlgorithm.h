@@ -54,6 +54,10 @@ protected:
     typedef std::unordered_map<const pandora::Cluster *, LArVertexHelper::ClusterDirection> ClusterDirectionMap;
     mutable ClusterDirectionMap m_clusterDirectionMap; ///< The cluster direction map
 
+    typedef std::unordered_map<const pandora::Cluster *, AssociationType> ClusterToAssociationTypeMap;
+    typedef std::unordered_map<const pandora::Cluster *, ClusterToAssociationTypeMap> ClusterAssociationTypeMap;
+    mutable ClusterAssociationTypeMap m_associationTypeMap; ///< The map from seed cluster to candidate cluster to association type
+
 private:
     pandora::StatusCode Run();
 
@@ -121,6 +125,23 @@ private:
 
     AssociationType AreClustersAssociated(const pandora::Cluster *const pClusterSeed, const pandora::Cluster *const pCluster) const;
 
+    /**
+     *  @brief  Determine whether two clusters are associated, without reference to the cache of association types
+     *
+     *  @param  pClusterSeed address of cluster seed (may be daughter of primary seed)
+     *  @param  pCluster address of cluster
+     *
+     *  @return the association type
+     */
+    AssociationType CalculateAssociationType(const pandora::Cluster *const pClusterSeed, const pandora::Cluster *const pCluster) const;
+
+    /**
+     *  @brief  Remove all cached association types involving a cluster, as a seed or as a candidate
+     *
+     *  @param  pCluster address of the cluster
+     */
+    void RemoveCachedAssociationTypes(const pandora::Cluster *const pCluster) const;
+
     /**
      *  @brief  Get a figure of merit representing the consistency of the provided seed associated list
      *
@@ -24,6 +24,114 @@ using namespace pandora;
 namespace lar_content
 {
 
+PfoFeatureContext::PfoFeatureContext(const Algorithm *const pAlgorithm, const ParticleFlowObject *const pPfo) :
+    PfoFeatureContext(PfoFeatureContext::FindInteractionVertex(pAlgorithm), pPfo)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+PfoFeatureContext::PfoFeatureContext(const Vertex *const pInteractionVertex, const ParticleFlowObject *const pPfo) :
+    m_pInteractionVertex(pInteractionVertex),
+    m_isPcaCalculated(false),
+    m_pcaStatusCode(STATUS_CODE_SUCCESS),
+    m_centroid(0.f, 0.f, 0.f),
+    m_eigenValues(0.f, 0.f, 0.f),
+    m_isVertexOrderCalculated(false)
+{
+    LArPfoHelper::GetCaloHits(pPfo, TPC_3D, m_threeDCaloHitList);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+std::shared_ptr<const PfoFeatureContext> PfoFeatureContext::Get(const Algorithm *const pAlgorithm, const ParticleFlowObject *const pPfo)
+{
+    return LArMvaHelper::GetCachedIntermediate<PfoFeatureContext>(pPfo, "PfoFeatureContext", pAlgorithm, pPfo);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+std::shared_ptr<const PfoFeatureContext> PfoFeatureContext::Get(
+    const Vertex *const pInteractionVertex, const ParticleFlowObject *const pPfo)
+{
+    return LArMvaHelper::GetCachedIntermediate<PfoFeatureContext>(pPfo, "PfoFeatureContext", pInteractionVertex, pPfo);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const Vertex *PfoFeatureContext::FindInteractionVertex(const Algorithm *const pAlgorithm)
+{
+    const VertexList *pVertexList(nullptr);
+    (void)PandoraContentApi::GetCurrentList(*pAlgorithm, pVertexList);
+
+    if (!pVertexList || pVertexList->empty())
+        return nullptr;
+
+    unsigned int nInteractionVertices(0);
+    const Vertex *pInteractionVertex(nullptr);
+
+    for (const Vertex *pVertex : *pVertexList)
+    {
+        if ((pVertex->GetVertexLabel() == VERTEX_INTERACTION) && (pVertex->GetVertexType() == VERTEX_3D))
+        {
+            ++nInteractionVertices;
+            pInteractionVertex = pVertex;
+        }
+    }
+
+    return ((1 == nInteractionVertices) ? pInteractionVertex : nullptr);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void PfoFeatureContext::GetThreeDPca(
+    CartesianVector &centroid, LArPcaHelper::EigenValues &eigenValues, LArPcaHelper::EigenVectors &eigenVecs) const
+{
+    if (!m_isPcaCalculated)
+    {
+        m_isPcaCalculated = true;
+
+        try
+        {
+            LArPcaHelper::RunPca(m_threeDCaloHitList, m_centroid, m_eigenValues, m_eigenVecs);
+        }
+        catch (const StatusCodeException &statusCodeException)
+        {
+            m_pcaStatusCode = statusCodeException.GetStatusCode();
+        }
+    }
+
+    if (STATUS_CODE_SUCCESS != m_pcaStatusCode)
+        throw StatusCodeException(m_pcaStatusCode);
+
+    centroid = m_centroid;
+    eigenValues = m_eigenValues;
+    eigenVecs = m_eigenVecs;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const CaloHitVector &PfoFeatureContext::GetVertexOrderedThreeDCaloHits() const
+{
+    if (!m_isVertexOrderCalculated)
+    {
+        m_isVertexOrderCalculated = true;
+
+        if (m_pInteractionVertex && !m_threeDCaloHitList.empty())
+        {
+            // Order by distance to vertex, so first ones are closer to nuvertex
+            m_vertexOrderedHits.assign(m_threeDCaloHitList.begin(), m_threeDCaloHitList.end());
+            std::sort(m_vertexOrderedHits.begin(), m_vertexOrderedHits.end(),
+                ThreeDChargeFeatureTool::VertexComparator(m_pInteractionVertex->GetPosition()));
+        }
+    }
+
+    return m_vertexOrderedHits;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 TwoDShowerFitFeatureTool::TwoDShowerFitFeatureTool() : m_slidingShowerFitWindow(3), m_slidingLinearFitWindow(10000)
 {
 }
@@ -38,7 +146,10 @@ void TwoDShowerFitFeatureTool::Run(LArMvaHelper::MvaFeatureVector &featureVector
     float ratio(-1.f);
     try
     {
-        const TwoDSlidingFitResult slidingFitResultLarge(pCluster, m_slidingLinearFitWindow, LArGeometryHelper::GetWireZPitch(this->GetPandora()));
+        const std::shared_ptr<const TwoDSlidingFitResult> pSlidingFitResultLarge(LArMvaHelper::GetCachedIntermediate<TwoDSlidingFitResult>(
+            pCluster, "TwoDSlidingFit_" + std::to_string(m_slidingLinearFitWindow), pCluster, m_slidingLinearFitWindow,
+            LArGeometryHelper::GetWireZPitch(this->GetPandora())));
+        const TwoDSlidingFitResult &slidingFitResultLarge(*pSlidingFitResultLarge);
         const float straightLineLength =
             (slidingFitResultLarge.GetGlobalMaxLayerPosition() - slidingFitResultLarge.GetGlobalMinLayerPosition()).GetMagnitude();
         if (straightLineLength > std::numeric_limits<float>::epsilon())
@@ -159,9 +270,14 @@ void TwoDLinearFitFeatureTool::CalculateVariablesSlidingLinearFit(const pandora:
 {
     try
     {
-        const TwoDSlidingFitResult slidingFitResult(pCluster, m_slidingLinearFitWindow, LArGeometryHelper::GetWireZPitch(this->GetPandora()));
-        const TwoDSlidingFitResult slidingFitResultLarge(
-            pCluster, m_slidingLinearFitWindowLarge, LArGeometryHelper::GetWireZPitch(this->GetPandora()));
+        const std::shared_ptr<const TwoDSlidingFitResult> pSlidingFitResult(LArMvaHelper::GetCachedIntermediate<TwoDSlidingFitResult>(
+            pCluster, "TwoDSlidingFit_" + std::to_string(m_slidingLinearFitWindow), pCluster, m_slidingLinearFitWindow,
+            LArGeometryHelper::GetWireZPitch(this->GetPandora())));
+        const TwoDSlidingFitResult &slidingFitResult(*pSlidingFitResult);
+        const std::shared_ptr<const TwoDSlidingFitResult> pSlidingFitResultLarge(LArMvaHelper::GetCachedIntermediate<TwoDSlidingFitResult>(
+            pCluster, "TwoDSlidingFit_" + std::to_string(m_slidingLinearFitWindowLarge), pCluster, m_slidingLinearFitWindowLarge,
+            LArGeometryHelper::GetWireZPitch(this->GetPandora())));
+        const TwoDSlidingFitResult &slidingFitResultLarge(*pSlidingFitResultLarge);
 
         if (slidingFitResult.GetLayerFitResultMap().empty())
             throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
@@ -271,7 +387,10 @@ void TwoDVertexDistanceFeatureTool::Run(
     float straightLineLength(-1.f), ratio(-1.f);
     try
     {
-        const TwoDSlidingFitResult slidingFitResultLarge(pCluster, m_slidingLinearFitWindow, LArGeometryHelper::GetWireZPitch(this->GetPandora()));
+        const std::shared_ptr<const TwoDSlidingFitResult> pSlidingFitResultLarge(LArMvaHelper::GetCachedIntermediate<TwoDSlidingFitResult>(
+            pCluster, "TwoDSlidingFit_" + std::to_string(m_slidingLinearFitWindow), pCluster, m_slidingLinearFitWindow,
+            LArGeometryHelper::GetWireZPitch(this->GetPandora())));
+        const TwoDSlidingFitResult &slidingFitResultLarge(*pSlidingFitResultLarge);
         straightLineLength = (slidingFitResultLarge.GetGlobalMaxLayerPosition() - slidingFitResultLarge.GetGlobalMinLayerPosition()).GetMagnitude();
         if (straightLineLength > std::numeric_limits<float>::epsilon())
             ratio = (CutClusterCharacterisationAlgorithm::GetVertexDistance(pAlgorithm, pCluster)) / straightLineLength;
@@ -326,9 +445,8 @@ void PfoHierarchyFeatureTool::Run(
     if (PandoraContentApi::GetSettings(*pAlgorithm)->ShouldDisplayAlgorithmInfo())
         std::cout << "----> Running Algorithm Tool: " << this->GetInstanceName() << ", " << this->GetType() << std::endl;
 
-    CaloHitList parent3DHitList;
-    LArPfoHelper::GetCaloHits(pInputPfo, TPC_3D, parent3DHitList);
-    const unsigned int nParentHits3D(parent3DHitList.size());
+    const std::shared_ptr<const PfoFeatureContext> pPfoFeatureContext(PfoFeatureContext::Get(pAlgorithm, pInputPfo));
+    const unsigned int nParentHits3D(pPfoFeatureContext->GetThreeDCaloHitList().size());
 
     PfoList allDaughtersPfoList;
     LArPfoHelper::GetAllDownstreamPfos(pInputPfo, allDaughtersPfoList);
@@ -629,9 +747,14 @@ void ThreeDLinearFitFeatureTool::CalculateVariablesSlidingLinearFit(const pandor
 {
     try
     {
-        const TwoDSlidingFitResult slidingFitResult(pCluster, m_slidingLinearFitWindow, LArGeometryHelper::GetWireZPitch(this->GetPandora()));
-        const TwoDSlidingFitResult slidingFitResultLarge(
-            pCluster, m_slidingLinearFitWindowLarge, LArGeometryHelper::GetWireZPitch(this->GetPandora()));
+        const std::shared_ptr<const TwoDSlidingFitResult> pSlidingFitResult(LArMvaHelper::GetCachedIntermediate<TwoDSlidingFitResult>(
+            pCluster, "TwoDSlidingFit_" + std::to_string(m_slidingLinearFitWindow), pCluster, m_slidingLinearFitWindow,
+            LArGeometryHelper::GetWireZPitch(this->GetPandora())));
+        const TwoDSlidingFitResult &slidingFitResult(*pSlidingFitResult);
+        const std::shared_ptr<const TwoDSlidingFitResult> pSlidingFitResultLarge(LArMvaHelper::GetCachedIntermediate<TwoDSlidingFitResult>(
+            pCluster, "TwoDSlidingFit_" + std::to_string(m_slidingLinearFitWindowLarge), pCluster, m_slidingLinearFitWindowLarge,
+            LArGeometryHelper::GetWireZPitch(this->GetPandora())));
+        const TwoDSlidingFitResult &slidingFitResultLarge(*pSlidingFitResultLarge);
 
         if (slidingFitResult.GetLayerFitResultMap().empty())
             throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
@@ -732,28 +855,10 @@ void ThreeDVertexDistanceFeatureTool::Run(
 
     LArMvaHelper::MvaFeature vertexDistance;
 
-    const VertexList *pVertexList(nullptr);
-    (void)PandoraContentApi::GetCurrentList(*pAlgorithm, pVertexList);
+    const std::shared_ptr<const PfoFeatureContext> pPfoFeatureContext(PfoFeatureContext::Get(pAlgorithm, pInputPfo));
+    const Vertex *const pInteractionVertex(pPfoFeatureContext->GetInteractionVertex());
 
-    if (!pVertexList || pVertexList->empty())
-    {
-        featureVector.push_back(vertexDistance);
-        return;
-    }
-
-    unsigned int nInteractionVertices(0);
-    const Vertex *pInteractionVertex(nullptr);
-
-    for (const Vertex *pVertex : *pVertexList)
-    {
-        if ((pVertex->GetVertexLabel() == VERTEX_INTERACTION) && (pVertex->GetVertexType() == VERTEX_3D))
-        {
-            ++nInteractionVertices;
-            pInteractionVertex = pVertex;
-        }
-    }
-
-    if (pInteractionVertex && (1 == nInteractionVertices))
+    if (pInteractionVertex)
     {
         try
         {
@@ -761,8 +866,7 @@ void ThreeDVertexDistanceFeatureTool::Run(
         }
         catch (const StatusCodeException &)
         {
-            CaloHitList threeDCaloHitList;
-            LArPfoHelper::GetCaloHits(pInputPfo, TPC_3D, threeDCaloHitList);
+            const CaloHitList &threeDCaloHitList(pPfoFeatureContext->GetThreeDCaloHitList());
 
             if (!threeDCaloHitList.empty())
                 vertexDistance = (pInteractionVertex->GetPosition() - (threeDCaloHitList.front())->GetPositionVector()).GetMagnitude();
@@ -814,14 +918,13 @@ void ThreeDOpeningAngleFeatureTool::Run(
         std::cout << "----> Running Algorithm Tool: " << this->GetInstanceName() << ", " << this->GetType() << std::endl;
 
     // Need the 3D hits to calculate PCA components
-    CaloHitList threeDCaloHitList;
-    LArPfoHelper::GetCaloHits(pInputPfo, TPC_3D, threeDCaloHitList);
+    const std::shared_ptr<const PfoFeatureContext> pPfoFeatureContext(PfoFeatureContext::Get(pAlgorithm, pInputPfo));
 
     LArMvaHelper::MvaFeature diffAngle;
-    if (!threeDCaloHitList.empty())
+    if (!pPfoFeatureContext->GetThreeDCaloHitList().empty())
     {
         CartesianPointVector pointVectorStart, pointVectorEnd;
-        this->Divide3DCaloHitList(pAlgorithm, threeDCaloHitList, pointVectorStart, pointVectorEnd);
+        this->Divide3DCaloHitList(*pPfoFeatureContext, pointVectorStart, pointVectorEnd);
 
         // Able to calculate angles only if > 1 point provided
         if ((pointVectorStart.size() > 1) && (pointVectorEnd.size() > 1))
@@ -874,47 +977,24 @@ void ThreeDOpeningAngleFeatureTool::Run(LArMvaHelper::MvaFeatureMap &featureMap,
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void ThreeDOpeningAngleFeatureTool::Divide3DCaloHitList(const Algorithm *const pAlgorithm, const CaloHitList &threeDCaloHitList,
-    CartesianPointVector &pointVectorStart, CartesianPointVector &pointVectorEnd)
+void ThreeDOpeningAngleFeatureTool::Divide3DCaloHitList(
+    const PfoFeatureContext &pfoFeatureContext, CartesianPointVector &pointVectorStart, CartesianPointVector &pointVectorEnd)
 {
-    const VertexList *pVertexList(nullptr);
-    (void)PandoraContentApi::GetCurrentList(*pAlgorithm, pVertexList);
-
-    if (threeDCaloHitList.empty() || !pVertexList || pVertexList->empty())
-        return;
-
-    unsigned int nInteractionVertices(0);
-    const Vertex *pInteractionVertex(nullptr);
+    // ATTN Empty unless there are three dimensional hits and a unique interaction vertex
+    const CaloHitVector &threeDCaloHitVector(pfoFeatureContext.GetVertexOrderedThreeDCaloHits());
 
-    for (const Vertex *pVertex : *pVertexList)
-    {
-        if ((pVertex->GetVertexLabel() == VERTEX_INTERACTION) && (pVertex->GetVertexType() == VERTEX_3D))
-        {
-            ++nInteractionVertices;
-            pInteractionVertex = pVertex;
-        }
-    }
+    unsigned int iHit(1);
+    const unsigned int nHits(threeDCaloHitVector.size());
 
-    if (pInteractionVertex && (1 == nInteractionVertices))
+    for (const CaloHit *const pCaloHit : threeDCaloHitVector)
     {
-        // Order by distance to vertex, so first ones are closer to nuvertex
-        CaloHitVector threeDCaloHitVector(threeDCaloHitList.begin(), threeDCaloHitList.end());
-        std::sort(threeDCaloHitVector.begin(), threeDCaloHitVector.end(),
-            ThreeDChargeFeatureTool::VertexComparator(pInteractionVertex->GetPosition()));
+        if (static_cast<float>(iHit) / static_cast<float>(nHits) <= m_hitFraction)
+            pointVectorStart.push_back(pCaloHit->GetPositionVector());
 
-        unsigned int iHit(1);
-        const unsigned int nHits(threeDCaloHitVector.size());
+        if (static_cast<float>(iHit) / static_cast<float>(nHits) >= 1.f - m_hitFraction)
+            pointVectorEnd.push_back(pCaloHit->GetPositionVector());
 
-        for (const CaloHit *const pCaloHit : threeDCaloHitVector)
-        {
-            if (static_cast<float>(iHit) / static_cast<float>(nHits) <= m_hitFraction)
-                pointVectorStart.push_back(pCaloHit->GetPositionVector());
-
-            if (static_cast<float>(iHit) / static_cast<float>(nHits) >= 1.f - m_hitFraction)
-                pointVectorEnd.push_back(pCaloHit->GetPositionVector());
-
-            ++iHit;
-        }
+        ++iHit;
     }
 }
 
@@ -987,10 +1067,9 @@ void ThreeDPCAFeatureTool::Run(
     LArMvaHelper::MvaFeature pca1, pca2;
 
     // Need the 3D hits to calculate PCA components
-    CaloHitList threeDCaloHitList;
-    LArPfoHelper::GetCaloHits(pInputPfo, TPC_3D, threeDCaloHitList);
+    const std::shared_ptr<const PfoFeatureContext> pPfoFeatureContext(PfoFeatureContext::Get(pAlgorithm, pInputPfo));
 
-    if (!threeDCaloHitList.empty())
+    if (!pPfoFeatureContext->GetThreeDCaloHitList().empty())
     {
         try
         {
@@ -998,7 +1077,7 @@ void ThreeDPCAFeatureTool::Run(
             LArPcaHelper::EigenVectors eigenVecs;
             LArPcaHelper::EigenValues eigenValues(0.f, 0.f, 0.f);
 
-            LArPcaHelper::RunPca(threeDCaloHitList, centroid, eigenValues, eigenVecs);
+            pPfoFeatureContext->GetThreeDPca(centroid, eigenValues, eigenVecs);
             const float principalEigenvalue(eigenValues.GetX()), secondaryEigenvalue(eigenValues.GetY()), tertiaryEigenvalue(eigenValues.GetZ());
 
             if (principalEigenvalue > std::numeric_limits<float>::epsilon())
@@ -1073,7 +1152,11 @@ void ThreeDChargeFeatureTool::Run(
     LArPfoHelper::GetClusters(pInputPfo, TPC_VIEW_W, clusterListW);
 
     if (!clusterListW.empty())
-        this->CalculateChargeVariables(pAlgorithm, clusterListW.front(), totalCharge, chargeSigma, chargeMean, endCharge);
+    {
+        const Vertex *const pInteractionVertex(PfoFeatureContext::Get(pAlgorithm, pInputPfo)->GetInteractionVertex());
+        this->CalculateChargeVariables(
+            pAlgorithm, pInteractionVertex, clusterListW.front(), totalCharge, chargeSigma, chargeMean, endCharge);
+    }
 
     if (chargeMean > std::numeric_limits<float>::epsilon())
         charge1 = chargeSigma / chargeMean;
@@ -1109,8 +1192,8 @@ void ThreeDChargeFeatureTool::Run(LArMvaHelper::MvaFeatureMap &featureMap, Strin
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void ThreeDChargeFeatureTool::CalculateChargeVariables(const Algorithm *const pAlgorithm, const pandora::Cluster *const pCluster,
-    float &totalCharge, float &chargeSigma, float &chargeMean, float &endCharge)
+void ThreeDChargeFeatureTool::CalculateChargeVariables(const Algorithm *const pAlgorithm, const Vertex *const pInteractionVertex,
+    const pandora::Cluster *const pCluster, float &totalCharge, float &chargeSigma, float &chargeMean, float &endCharge)
 {
     totalCharge = 0.f;
     chargeSigma = 0.f;
@@ -1118,7 +1201,7 @@ void ThreeDChargeFeatureTool::CalculateChargeVariables(const Algorithm *const pA
     endCharge = 0.f;
 
     CaloHitList orderedCaloHitList;
-    this->OrderCaloHitsByDistanceToVertex(pAlgorithm, pCluster, orderedCaloHitList);
+    this->OrderCaloHitsByDistanceToVertex(pAlgorithm, pInteractionVertex, pCluster, orderedCaloHitList);
 
     FloatVector chargeVector;
     unsigned int hitCounter(0);
@@ -1152,28 +1235,10 @@ void ThreeDChargeFeatureTool::CalculateChargeVariables(const Algorithm *const pA
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void ThreeDChargeFeatureTool::OrderCaloHitsByDistanceToVertex(
-    const Algorithm *const pAlgorithm, const pandora::Cluster *const pCluster, CaloHitList &caloHitList)
+void ThreeDChargeFeatureTool::OrderCaloHitsByDistanceToVertex(const Algorithm *const pAlgorithm, const Vertex *const pInteractionVertex,
+    const pandora::Cluster *const pCluster, CaloHitList &caloHitList)
 {
-    const VertexList *pVertexList(nullptr);
-    (void)PandoraContentApi::GetCurrentList(*pAlgorithm, pVertexList);
-
-    if (!pVertexList || pVertexList->empty())
-        return;
-
-    unsigned int nInteractionVertices(0);
-    const Vertex *pInteractionVertex(nullptr);
-
-    for (const Vertex *pVertex : *pVertexList)
-    {
-        if ((pVertex->GetVertexLabel() == VERTEX_INTERACTION) && (pVertex->GetVertexType() == VERTEX_3D))
-        {
-            ++nInteractionVertices;
-            pInteractionVertex = pVertex;
-        }
-    }
-
-    if (pInteractionVertex && (1 == nInteractionVertices))
+    if (pInteractionVertex)
     {
         const HitType hitType(LArClusterHelper::GetClusterHitType(pCluster));
         const CartesianVector vertexPosition2D(LArGeometryHelper::ProjectPosition(pAlgorithm->GetPandora(), pInteractionVertex->GetPosition(), hitType));
@@ -9,9 +9,12 @@
 #define LAR_TRACK_SHOWER_ID_FEATURE_TOOLS_H 1
 
 #include "larpandoracontent/LArHelpers/LArMvaHelper.h"
+#include "larpandoracontent/LArHelpers/LArPcaHelper.h"
 
 #include "Pandora/PandoraInternal.h"
 
+#include <memory>
+
 namespace lar_content
 {
 
@@ -20,6 +23,109 @@ typedef MvaFeatureTool<const pandora::Algorithm *const, const pandora::ParticleF
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+/**
+ *   @brief  PfoFeatureContext class, holding the pfo geometry shared by the pfo characterisation feature tools. The three dimensional
+ *           hits and interaction vertex are collected on construction, whilst the pca and vertex hit ordering are calculated on first use.
+ */
+class PfoFeatureContext
+{
+public:
+    /**
+     *  @brief  Constructor
+     *
+     *  @param  pAlgorithm address of the algorithm, used to access the current vertex list
+     *  @param  pPfo address of the pfo
+     */
+    PfoFeatureContext(const pandora::Algorithm *const pAlgorithm, const pandora::ParticleFlowObject *const pPfo);
+
+    /**
+     *  @brief  Constructor
+     *
+     *  @param  pInteractionVertex address of the interaction vertex, as found by FindInteractionVertex
+     *  @param  pPfo address of the pfo
+     */
+    PfoFeatureContext(const pandora::Vertex *const pInteractionVertex, const pandora::ParticleFlowObject *const pPfo);
+
+    /**
+     *  @brief  Get the feature context for a pfo, shared by all feature tools using the available mva feature cache
+     *
+     *  @param  pAlgorithm address of the algorithm
+     *  @param  pPfo address of the pfo
+     *
+     *  @return the feature context
+     */
+    static std::shared_ptr<const PfoFeatureContext> Get(
+        const pandora::Algorithm *const pAlgorithm, const pandora::ParticleFlowObject *const pPfo);
+
+    /**
+     *  @brief  Get the feature context for a pfo, shared by all feature tools using the available mva feature cache. Publishing the
+     *          context in this way, ahead of the feature tools, means that the tools need not access the current vertex list.
+     *
+     *  @param  pInteractionVertex address of the interaction vertex, as found by FindInteractionVertex
+     *  @param  pPfo address of the pfo
+     *
+     *  @return the feature context
+     */
+    static std::shared_ptr<const PfoFeatureContext> Get(
+        const pandora::Vertex *const pInteractionVertex, const pandora::ParticleFlowObject *const pPfo);
+
+    /**
+     *  @brief  Find the interaction vertex in the current vertex list
+     *
+     *  @param  pAlgorithm address of the algorithm, used to access the current vertex list
+     *
+     *  @return address of the interaction vertex, nullptr unless the current list holds exactly one three dimensional interaction vertex
+     */
+    static const pandora::Vertex *FindInteractionVertex(const pandora::Algorithm *const pAlgorithm);
+
+    /**
+     *  @brief  Get the three dimensional calo hits of the pfo
+     *
+     *  @return the three dimensional calo hit list
+     */
+    const pandora::CaloHitList &GetThreeDCaloHitList() const;
+
+    /**
+     *  @brief  Get the interaction vertex
+     *
+     *  @return address of the interaction vertex, nullptr unless the current list holds exactly one three dimensional interaction vertex
+     */
+    const pandora::Vertex *GetInteractionVertex() const;
+
+    /**
+     *  @brief  Get the principal component analysis of the three dimensional calo hits
+     *
+     *  @param  centroid to receive the centroid
+     *  @param  eigenValues to receive the eigenvalues
+     *  @param  eigenVecs to receive the eigenvectors
+     *
+     *  @throw  StatusCodeException if the pca cannot be calculated
+     */
+    void GetThreeDPca(
+        pandora::CartesianVector &centroid, LArPcaHelper::EigenValues &eigenValues, LArPcaHelper::EigenVectors &eigenVecs) const;
+
+    /**
+     *  @brief  Get the three dimensional calo hits ordered by distance to the interaction vertex
+     *
+     *  @return the ordered calo hits, empty if there is no interaction vertex
+     */
+    const pandora::CaloHitVector &GetVertexOrderedThreeDCaloHits() const;
+
+private:
+    pandora::CaloHitList m_threeDCaloHitList;    ///< The three dimensional calo hits
+    const pandora::Vertex *m_pInteractionVertex; ///< The interaction vertex, if uniquely defined
+
+    mutable bool m_isPcaCalculated;                     ///< Whether the pca has been calculated
+    mutable pandora::StatusCode m_pcaStatusCode;        ///< The status code from the pca calculation
+    mutable pandora::CartesianVector m_centroid;        ///< The pca centroid
+    mutable LArPcaHelper::EigenValues m_eigenValues;    ///< The pca eigenvalues
+    mutable LArPcaHelper::EigenVectors m_eigenVecs;     ///< The pca eigenvectors
+    mutable bool m_isVertexOrderCalculated;             ///< Whether the vertex ordered calo hits have been calculated
+    mutable pandora::CaloHitVector m_vertexOrderedHits; ///< The three dimensional calo hits ordered by distance to the interaction vertex
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 /**
  *   @brief  TwoDShowerFitFeatureTool to calculate variables related to sliding shower fit
  */
@@ -284,14 +390,14 @@ private:
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
     /**
-     *  @brief  Obtain positions at the vertex and non-vertex end of a list of three dimensional calo hits
+     *  @brief  Obtain positions at the vertex and non-vertex end of the three dimensional calo hits of a pfo
      *
-     *  @param  threeDCaloHitList the list of three dimensional calo hits
+     *  @param  pfoFeatureContext the feature context of the pfo
      *  @param  pointVectorStart to receive the positions at the start/vertex region
      *  @param  pointVectorEnd to receive the positions at the end region (opposite end to vertex)
      */
-    void Divide3DCaloHitList(const pandora::Algorithm *const pAlgorithm, const pandora::CaloHitList &threeDCaloHitList,
-        pandora::CartesianPointVector &pointVectorStart, pandora::CartesianPointVector &pointVectorEnd);
+    void Divide3DCaloHitList(const PfoFeatureContext &pfoFeatureContext, pandora::CartesianPointVector &pointVectorStart,
+        pandora::CartesianPointVector &pointVectorEnd);
 
     /**
      *  @brief  Use the results of principal component analysis to calculate an opening angle
@@ -375,6 +481,7 @@ private:
      *  @brief  Calculation of the charge variables
      *
      *  @param  pAlgorithm, the algorithm
+     *  @param  pInteractionVertex, the interaction vertex, or nullptr if it is not uniquely defined
      *  @param  pCluster the cluster we are characterizing
      *  @param  totalCharge, to receive the total charge
      *  @param  chargeSigma, to receive the charge sigma
@@ -382,25 +489,40 @@ private:
      *  @param  startCharge, to receive the charge in the initial 10% hits
      *  @param  endCharge, to receive the charge in the last 10% hits
      */
-    void CalculateChargeVariables(const pandora::Algorithm *const pAlgorithm, const pandora::Cluster *const pCluster, float &totalCharge,
-        float &chargeSigma, float &chargeMean, float &endCharge);
+    void CalculateChargeVariables(const pandora::Algorithm *const pAlgorithm, const pandora::Vertex *const pInteractionVertex,
+        const pandora::Cluster *const pCluster, float &totalCharge, float &chargeSigma, float &chargeMean, float &endCharge);
 
     /**
      *  @brief  Function to order the calo hit list by distance to neutrino vertex
      *
      *  @param  pAlgorithm, the algorithm
+     *  @param  pInteractionVertex, the interaction vertex, or nullptr if it is not uniquely defined
      *  @param  pCluster the cluster we are characterizing
      *  @param  caloHitList to receive the ordered calo hit list
      *
      */
-    void OrderCaloHitsByDistanceToVertex(
-        const pandora::Algorithm *const pAlgorithm, const pandora::Cluster *const pCluster, pandora::CaloHitList &caloHitList);
+    void OrderCaloHitsByDistanceToVertex(const pandora::Algorithm *const pAlgorithm, const pandora::Vertex *const pInteractionVertex,
+        const pandora::Cluster *const pCluster, pandora::CaloHitList &caloHitList);
 
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
     float m_endChargeFraction; ///< Fraction of hits that will be considered to calculate end charge (default 10%)
 };
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const pandora::CaloHitList &PfoFeatureContext::GetThreeDCaloHitList() const
+{
+    return m_threeDCaloHitList;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const pandora::Vertex *PfoFeatureContext::GetInteractionVertex() const
+{
+    return m_pInteractionVertex;
+}
+
 } // namespace lar_content
 
 #endif // #ifndef LAR_TRACK_SHOWER_ID_FEATURE_TOOLS_H
@@ -25,6 +25,8 @@ ClusterAssociationAlgorithm::ClusterAssociationAlgorithm() : m_mergeMade(false),
 
 StatusCode ClusterAssociationAlgorithm::Run()
 {
+    const LArClusterHelper::GeometryCacheScope geometryCacheScope;
+
     const ClusterList *pClusterList = NULL;
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::GetCurrentList(*this, pClusterList));
 
@@ -34,6 +36,9 @@ StatusCode ClusterAssociationAlgorithm::Run()
     ClusterAssociationMap clusterAssociationMap;
     this->PopulateClusterAssociationMap(clusterVector, clusterAssociationMap);
 
+    ClusterReferenceMap clusterReferenceMap;
+    this->PopulateClusterReferenceMap(clusterAssociationMap, clusterReferenceMap);
+
     m_mergeMade = true;
 
     while (m_mergeMade)
@@ -45,12 +50,13 @@ StatusCode ClusterAssociationAlgorithm::Run()
 
             for (const Cluster *const pCluster : clusterVector)
             {
-                // ATTN The clusterVector may end up with dangling pointers; only protected by this check against managed cluster list
-                if (pClusterList->end() == std::find(pClusterList->begin(), pClusterList->end(), pCluster))
+                // ATTN The clusterVector may end up with dangling pointers; only protected by this check against up-to-date association
+                // map, from which each cluster is removed before it is deleted
+                if (!clusterAssociationMap.count(pCluster))
                     continue;
 
-                this->UnambiguousPropagation(pCluster, true, clusterAssociationMap);
-                this->UnambiguousPropagation(pCluster, false, clusterAssociationMap);
+                this->UnambiguousPropagation(pCluster, true, clusterAssociationMap, clusterReferenceMap);
+                this->UnambiguousPropagation(pCluster, false, clusterAssociationMap, clusterReferenceMap);
             }
         }
 
@@ -67,7 +73,7 @@ StatusCode ClusterAssociationAlgorithm::Run()
                 continue;
 
             if (mapIterFwd->second.m_backwardAssociations.empty() && !mapIterFwd->second.m_forwardAssociations.empty())
-                this->AmbiguousPropagation(pCluster, true, clusterAssociationMap);
+                this->AmbiguousPropagation(pCluster, true, clusterAssociationMap, clusterReferenceMap);
 
             ClusterAssociationMap::const_iterator mapIterBwd = clusterAssociationMap.find(pCluster);
 
@@ -75,7 +81,7 @@ StatusCode ClusterAssociationAlgorithm::Run()
                 continue;
 
             if (mapIterBwd->second.m_forwardAssociations.empty() && !mapIterBwd->second.m_backwardAssociations.empty())
-                this->AmbiguousPropagation(pCluster, false, clusterAssociationMap);
+                this->AmbiguousPropagation(pCluster, false, clusterAssociationMap, clusterReferenceMap);
         }
     }
 
@@ -84,7 +90,23 @@ StatusCode ClusterAssociationAlgorithm::Run()
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void ClusterAssociationAlgorithm::UnambiguousPropagation(const Cluster *const pCluster, const bool isForward, ClusterAssociationMap &clusterAssociationMap) const
+void ClusterAssociationAlgorithm::PopulateClusterReferenceMap(
+    const ClusterAssociationMap &clusterAssociationMap, ClusterReferenceMap &clusterReferenceMap) const
+{
+    for (const ClusterAssociationMap::value_type &mapEntry : clusterAssociationMap)
+    {
+        for (const Cluster *const pForwardCluster : mapEntry.second.m_forwardAssociations)
+            clusterReferenceMap[pForwardCluster].insert(mapEntry.first);
+
+        for (const Cluster *const pBackwardCluster : mapEntry.second.m_backwardAssociations)
+            clusterReferenceMap[pBackwardCluster].insert(mapEntry.first);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ClusterAssociationAlgorithm::UnambiguousPropagation(const Cluster *const pCluster, const bool isForward,
+    ClusterAssociationMap &clusterAssociationMap, ClusterReferenceMap &clusterReferenceMap) const
 {
     const Cluster *const pClusterToEnlarge = pCluster;
     ClusterAssociationMap::iterator iterEnlarge = clusterAssociationMap.find(pClusterToEnlarge);
@@ -108,17 +130,18 @@ void ClusterAssociationAlgorithm::UnambiguousPropagation(const Cluster *const pC
     if (clusterSetDelete.size() != 1)
         return;
 
-    this->UpdateForUnambiguousMerge(pClusterToEnlarge, pClusterToDelete, isForward, clusterAssociationMap);
+    this->UpdateForUnambiguousMerge(pClusterToEnlarge, pClusterToDelete, isForward, clusterAssociationMap, clusterReferenceMap);
 
     PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::MergeAndDeleteClusters(*this, pClusterToEnlarge, pClusterToDelete));
     m_mergeMade = true;
 
-    this->UnambiguousPropagation(pClusterToEnlarge, isForward, clusterAssociationMap);
+    this->UnambiguousPropagation(pClusterToEnlarge, isForward, clusterAssociationMap, clusterReferenceMap);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void ClusterAssociationAlgorithm::AmbiguousPropagation(const Cluster *const pCluster, const bool isForward, ClusterAssociationMap &clusterAssociationMap) const
+void ClusterAssociationAlgorithm::AmbiguousPropagation(const Cluster *const pCluster, const bool isForward,
+    ClusterAssociationMap &clusterAssociationMap, ClusterReferenceMap &clusterReferenceMap) const
 {
     ClusterAssociationMap::iterator cIter = clusterAssociationMap.find(pCluster);
 
@@ -151,20 +174,20 @@ void ClusterAssociationAlgorithm::AmbiguousPropagation(const Cluster *const pClu
 
     for (ClusterVector::iterator dIter = daughterClusterVector.begin(), dIterEnd = daughterClusterVector.end(); dIter != dIterEnd; ++dIter)
     {
-        this->UpdateForAmbiguousMerge(*dIter, clusterAssociationMap);
+        this->UpdateForAmbiguousMerge(*dIter, clusterAssociationMap, clusterReferenceMap);
 
         PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::MergeAndDeleteClusters(*this, pCluster, *dIter));
         m_mergeMade = true;
         *dIter = NULL;
     }
 
-    this->UpdateForAmbiguousMerge(pCluster, clusterAssociationMap);
+    this->UpdateForAmbiguousMerge(pCluster, clusterAssociationMap, clusterReferenceMap);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void ClusterAssociationAlgorithm::UpdateForUnambiguousMerge(const Cluster *const pClusterToEnlarge, const Cluster *const pClusterToDelete,
-    const bool isForwardMerge, ClusterAssociationMap &clusterAssociationMap) const
+    const bool isForwardMerge, ClusterAssociationMap &clusterAssociationMap, ClusterReferenceMap &clusterReferenceMap) const
 {
     ClusterAssociationMap::iterator iterEnlarge = clusterAssociationMap.find(pClusterToEnlarge);
     ClusterAssociationMap::iterator iterDelete = clusterAssociationMap.find(pClusterToDelete);
@@ -174,11 +197,45 @@ void ClusterAssociationAlgorithm::UpdateForUnambiguousMerge(const Cluster *const
 
     ClusterSet &clusterSetToMove(isForwardMerge ? iterDelete->second.m_forwardAssociations : iterDelete->second.m_backwardAssociations);
     ClusterSet &clusterSetToReplace(isForwardMerge ? iterEnlarge->second.m_forwardAssociations : iterEnlarge->second.m_backwardAssociations);
+    const ClusterSet &clusterSetToKeep(
+        isForwardMerge ? iterEnlarge->second.m_backwardAssociations : iterEnlarge->second.m_forwardAssociations);
+
+    for (const Cluster *const pReplacedCluster : clusterSetToReplace)
+    {
+        if (!clusterSetToKeep.count(pReplacedCluster))
+            clusterReferenceMap[pReplacedCluster].erase(pClusterToEnlarge);
+    }
+
     clusterSetToReplace = clusterSetToMove;
+
+    for (const Cluster *const pMovedCluster : clusterSetToReplace)
+        clusterReferenceMap[pMovedCluster].insert(pClusterToEnlarge);
+
+    for (const Cluster *const pForwardCluster : iterDelete->second.m_forwardAssociations)
+        clusterReferenceMap[pForwardCluster].erase(pClusterToDelete);
+
+    for (const Cluster *const pBackwardCluster : iterDelete->second.m_backwardAssociations)
+        clusterReferenceMap[pBackwardCluster].erase(pClusterToDelete);
+
     clusterAssociationMap.erase(iterDelete);
 
-    for (ClusterAssociationMap::iterator iter = clusterAssociationMap.begin(), iterEnd = clusterAssociationMap.end(); iter != iterEnd; ++iter)
+    // ATTN Only the clusters with an association to the deleted cluster need be updated, with no dependence upon the order of updates
+    ClusterVector referringClusters;
+    ClusterReferenceMap::iterator referenceIter = clusterReferenceMap.find(pClusterToDelete);
+
+    if (clusterReferenceMap.end() != referenceIter)
+    {
+        referringClusters.insert(referringClusters.end(), referenceIter->second.begin(), referenceIter->second.end());
+        clusterReferenceMap.erase(referenceIter);
+    }
+
+    for (const Cluster *const pReferringCluster : referringClusters)
     {
+        ClusterAssociationMap::iterator iter = clusterAssociationMap.find(pReferringCluster);
+
+        if (clusterAssociationMap.end() == iter)
+            continue;
+
         ClusterSet &forwardClusters = iter->second.m_forwardAssociations;
         ClusterSet &backwardClusters = iter->second.m_backwardAssociations;
 
@@ -189,41 +246,53 @@ void ClusterAssociationAlgorithm::UpdateForUnambiguousMerge(const Cluster *const
         {
             forwardClusters.erase(forwardIter);
             forwardClusters.insert(pClusterToEnlarge);
+            clusterReferenceMap[pClusterToEnlarge].insert(pReferringCluster);
         }
 
         if (backwardClusters.end() != backwardIter)
         {
             backwardClusters.erase(backwardIter);
             backwardClusters.insert(pClusterToEnlarge);
+            clusterReferenceMap[pClusterToEnlarge].insert(pReferringCluster);
         }
     }
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void ClusterAssociationAlgorithm::UpdateForAmbiguousMerge(const Cluster *const pCluster, ClusterAssociationMap &clusterAssociationMap) const
+void ClusterAssociationAlgorithm::UpdateForAmbiguousMerge(
+    const Cluster *const pCluster, ClusterAssociationMap &clusterAssociationMap, ClusterReferenceMap &clusterReferenceMap) const
 {
     ClusterAssociationMap::iterator cIter = clusterAssociationMap.find(pCluster);
 
     if (clusterAssociationMap.end() == cIter)
         throw StatusCodeException(STATUS_CODE_NOT_FOUND);
 
-    for (ClusterAssociationMap::iterator mIter = clusterAssociationMap.begin(), mIterEnd = clusterAssociationMap.end(); mIter != mIterEnd; ++mIter)
+    ClusterReferenceMap::iterator referenceIter = clusterReferenceMap.find(pCluster);
+
+    if (clusterReferenceMap.end() != referenceIter)
     {
-        ClusterSet &forwardClusters = mIter->second.m_forwardAssociations;
-        ClusterSet &backwardClusters = mIter->second.m_backwardAssociations;
+        for (const Cluster *const pReferringCluster : referenceIter->second)
+        {
+            ClusterAssociationMap::iterator mIter = clusterAssociationMap.find(pReferringCluster);
 
-        ClusterSet::iterator fIter = forwardClusters.find(pCluster);
-        ClusterSet::iterator bIter = backwardClusters.find(pCluster);
+            if (clusterAssociationMap.end() == mIter)
+                continue;
 
-        if (forwardClusters.end() != fIter)
-            forwardClusters.erase(fIter);
+            mIter->second.m_forwardAssociations.erase(pCluster);
+            mIter->second.m_backwardAssociations.erase(pCluster);
+        }
 
-        if (backwardClusters.end() != bIter)
-            backwardClusters.erase(bIter);
+        clusterReferenceMap.erase(referenceIter);
     }
 
-    clusterAssociationMap.erase(pCluster);
+    for (const Cluster *const pForwardCluster : cIter->second.m_forwardAssociations)
+        clusterReferenceMap[pForwardCluster].erase(pCluster);
+
+    for (const Cluster *const pBackwardCluster : cIter->second.m_backwardAssociations)
+        clusterReferenceMap[pBackwardCluster].erase(pCluster);
+
+    clusterAssociationMap.erase(cIter);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
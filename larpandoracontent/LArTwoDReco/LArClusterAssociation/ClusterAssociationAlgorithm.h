@@ -71,14 +71,28 @@ protected:
         const bool isForward, const pandora::Cluster *const pCurrentCluster, const pandora::Cluster *const pTestCluster) const = 0;
 
 private:
+    typedef std::unordered_map<const pandora::Cluster *, pandora::ClusterSet> ClusterReferenceMap;
+
+    /**
+     *  @brief  Populate the cluster reference map, the inverse of the cluster association map, identifying for each cluster those clusters
+     *          with a forward or backward association to it. This allows the association map to be updated for a merge by visiting only
+     *          the clusters associated with the merged clusters.
+     *
+     *  @param  clusterAssociationMap the cluster association map
+     *  @param  clusterReferenceMap to receive the populated cluster reference map
+     */
+    void PopulateClusterReferenceMap(const ClusterAssociationMap &clusterAssociationMap, ClusterReferenceMap &clusterReferenceMap) const;
+
     /**
      *  @brief  Unambiguous propagation
      *
      *  @param  pCluster address of the cluster to propagate
      *  @param  isForward whether propagation direction is forward
      *  @param  clusterAssociationMap the cluster association map
+     *  @param  clusterReferenceMap the cluster reference map
      */
-    void UnambiguousPropagation(const pandora::Cluster *const pCluster, const bool isForward, ClusterAssociationMap &clusterAssociationMap) const;
+    void UnambiguousPropagation(const pandora::Cluster *const pCluster, const bool isForward, ClusterAssociationMap &clusterAssociationMap,
+        ClusterReferenceMap &clusterReferenceMap) const;
 
     /**
      *  @brief  Ambiguous propagation
@@ -86,8 +100,10 @@ private:
      *  @param  pCluster address of the cluster to propagate
      *  @param  isForward whether propagation direction is forward
      *  @param  clusterAssociationMap the cluster association map
+     *  @param  clusterReferenceMap the cluster reference map
      */
-    void AmbiguousPropagation(const pandora::Cluster *const pCluster, const bool isForward, ClusterAssociationMap &clusterAssociationMap) const;
+    void AmbiguousPropagation(const pandora::Cluster *const pCluster, const bool isForward, ClusterAssociationMap &clusterAssociationMap,
+        ClusterReferenceMap &clusterReferenceMap) const;
 
     /**
      *  @brief  Update cluster association map to reflect an unambiguous cluster merge
@@ -96,17 +112,20 @@ private:
      *  @param  pClusterToDelete address of the cluster to be deleted
      *  @param  isForwardMerge whether merge is forward (pClusterToEnlarge is forward-associated with pClusterToDelete)
      *  @param  clusterAssociationMap the cluster association map
+     *  @param  clusterReferenceMap the cluster reference map
      */
     void UpdateForUnambiguousMerge(const pandora::Cluster *const pClusterToEnlarge, const pandora::Cluster *const pClusterToDelete,
-        const bool isForwardMerge, ClusterAssociationMap &clusterAssociationMap) const;
+        const bool isForwardMerge, ClusterAssociationMap &clusterAssociationMap, ClusterReferenceMap &clusterReferenceMap) const;
 
     /**
      *  @brief  Update cluster association map to reflect an ambiguous cluster merge
      *
      *  @param  pCluster address of the cluster to be cleared
      *  @param  clusterAssociationMap the cluster association map
+     *  @param  clusterReferenceMap the cluster reference map
      */
-    void UpdateForAmbiguousMerge(const pandora::Cluster *const pCluster, ClusterAssociationMap &clusterAssociationMap) const;
+    void UpdateForAmbiguousMerge(const pandora::Cluster *const pCluster, ClusterAssociationMap &clusterAssociationMap,
+        ClusterReferenceMap &clusterReferenceMap) const;
 
     /**
      *  @brief  Navigate along cluster associations, from specified cluster, in specified direction
@@ -10,16 +10,62 @@
 
 #include "larpandoracontent/LArTwoDReco/LArClusterAssociation/ClusterExtensionAlgorithm.h"
 
+#include <utility>
+
 using namespace pandora;
 
 namespace lar_content
 {
 
+StatusCode ClusterExtensionAlgorithm::Run()
+{
+    m_unchangedClusters.clear();
+    m_cachedAssociationMatrix.clear();
+
+    const StatusCode statusCode(ClusterMergingAlgorithm::Run());
+
+    m_unchangedClusters.clear();
+    m_cachedAssociationMatrix.clear();
+
+    return statusCode;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void ClusterExtensionAlgorithm::PopulateClusterMergeMap(const ClusterVector &clusterVector, ClusterMergeMap &clusterMergeMap) const
 {
+    // ATTN The associations for a pair of clusters depend only on those clusters, so associations between clusters left unchanged by
+    // the previous merge round are carried over, and only pairs involving a changed cluster are evaluated again
     ClusterAssociationMatrix clusterAssociationMatrix;
     this->FillClusterAssociationMatrix(clusterVector, clusterAssociationMatrix);
+
+    for (const auto &mapEntry : m_cachedAssociationMatrix)
+    {
+        if (!m_unchangedClusters.count(mapEntry.first))
+            continue;
+
+        for (const auto &associationEntry : mapEntry.second)
+        {
+            if (m_unchangedClusters.count(associationEntry.first))
+                (void)clusterAssociationMatrix[mapEntry.first].insert(associationEntry);
+        }
+    }
+
     this->FillClusterMergeMap(clusterAssociationMatrix, clusterMergeMap);
+
+    // The merge round only modifies or deletes clusters named in the merge map
+    m_unchangedClusters.clear();
+    m_unchangedClusters.insert(clusterVector.begin(), clusterVector.end());
+
+    for (const auto &mapEntry : clusterMergeMap)
+    {
+        (void)m_unchangedClusters.erase(mapEntry.first);
+
+        for (const Cluster *const pCluster : mapEntry.second)
+            (void)m_unchangedClusters.erase(pCluster);
+    }
+
+    m_cachedAssociationMatrix = std::move(clusterAssociationMatrix);
 }
 
 } // namespace lar_content
@@ -21,6 +21,7 @@ namespace lar_content
 class ClusterExtensionAlgorithm : public ClusterMergingAlgorithm
 {
 protected:
+    virtual pandora::StatusCode Run();
     void PopulateClusterMergeMap(const pandora::ClusterVector &clusterVector, ClusterMergeMap &clusterMergeMatrix) const;
 
     /**
@@ -112,6 +113,22 @@ protected:
      *  @param  clusterMergeMap the map of cluster merges
      */
     virtual void FillClusterMergeMap(const ClusterAssociationMatrix &clusterAssociationMatrix, ClusterMergeMap &clusterMergeMap) const = 0;
+
+    /**
+     *  @brief  Whether the associations between a pair of clusters are already known from the previous merge round, because neither
+     *          cluster has changed since. Implementations of FillClusterAssociationMatrix need not evaluate such pairs, as their
+     *          associations from the previous round are added to the cluster association matrix.
+     *
+     *  @param  pClusterI address of the first cluster
+     *  @param  pClusterJ address of the second cluster
+     *
+     *  @return boolean
+     */
+    bool IsCachedPair(const pandora::Cluster *const pClusterI, const pandora::Cluster *const pClusterJ) const;
+
+private:
+    mutable pandora::ClusterSet m_unchangedClusters;            ///< The clusters evaluated in the previous merge round and left unchanged
+    mutable ClusterAssociationMatrix m_cachedAssociationMatrix; ///< The cluster association matrix from the previous merge round
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -154,6 +171,13 @@ inline float ClusterExtensionAlgorithm::ClusterAssociation::GetFigureOfMerit() c
     return m_fom;
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline bool ClusterExtensionAlgorithm::IsCachedPair(const pandora::Cluster *const pClusterI, const pandora::Cluster *const pClusterJ) const
+{
+    return ((m_unchangedClusters.count(pClusterI) > 0) && (m_unchangedClusters.count(pClusterJ) > 0));
+}
+
 } // namespace lar_content
 
 #endif // #ifndef LAR_CLUSTER_EXTENSION_ALGORITHM_H
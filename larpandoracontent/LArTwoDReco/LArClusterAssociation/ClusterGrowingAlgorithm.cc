@@ -12,6 +12,8 @@
 
 #include "larpandoracontent/LArTwoDReco/LArClusterAssociation/ClusterGrowingAlgorithm.h"
 
+#include "larpandoracontent/LArUtility/KDTreeLinkerAlgoT.h"
+
 using namespace pandora;
 
 namespace lar_content
@@ -90,16 +92,62 @@ void ClusterGrowingAlgorithm::GetListOfNonSeedClusters(
 void ClusterGrowingAlgorithm::PopulateClusterMergeMap(
     const ClusterVector &seedClusters, const ClusterVector &nonSeedClusters, ClusterMergeMap &clusterMergeMap) const
 {
+    // ATTN Only seed clusters with a hit within the maximum separation in x and z can be joined, so index the seed cluster hits and visit
+    // just these candidates, in seed cluster order. The search region is widened slightly so that rounding cannot exclude a candidate.
+    CaloHitList seedCaloHits;
+    HitToIndexMap hitToSeedIndexMap;
+
+    for (unsigned int seedIndex = 0; seedIndex < seedClusters.size(); ++seedIndex)
+    {
+        CaloHitList daughterHits;
+        seedClusters.at(seedIndex)->GetOrderedCaloHitList().FillCaloHitList(daughterHits);
+        seedCaloHits.insert(seedCaloHits.end(), daughterHits.begin(), daughterHits.end());
+
+        for (const CaloHit *const pCaloHit : daughterHits)
+            (void)hitToSeedIndexMap.insert(HitToIndexMap::value_type(pCaloHit, seedIndex));
+    }
+
+    if (seedCaloHits.empty())
+        return;
+
+    HitKDTree2D kdTree;
+    HitKDNode2DList hitKDNode2DList;
+
+    KDTreeBox hitsBoundingRegion2D(fill_and_bound_2d_kd_tree(seedCaloHits, hitKDNode2DList));
+    kdTree.build(hitKDNode2DList, hitsBoundingRegion2D);
+
+    const float searchRegion(m_maxClusterSeparation + 0.01f);
+    HitKDNode2DList found;
+    std::vector<unsigned int> candidateSeedIndices;
+
     for (ClusterVector::const_iterator nIter = nonSeedClusters.begin(), nIterEnd = nonSeedClusters.end(); nIter != nIterEnd; ++nIter)
     {
         const Cluster *const pNonSeedCluster = *nIter;
 
+        CaloHitList daughterHits;
+        pNonSeedCluster->GetOrderedCaloHitList().FillCaloHitList(daughterHits);
+        candidateSeedIndices.clear();
+
+        for (const CaloHit *const pCaloHit : daughterHits)
+        {
+            KDTreeBox searchRegionHits(build_2d_kd_search_region(pCaloHit, searchRegion, searchRegion));
+
+            found.clear();
+            kdTree.search(searchRegionHits, found);
+
+            for (const auto &hit : found)
+                candidateSeedIndices.push_back(hitToSeedIndexMap.at(hit.data));
+        }
+
+        std::sort(candidateSeedIndices.begin(), candidateSeedIndices.end());
+        candidateSeedIndices.erase(std::unique(candidateSeedIndices.begin(), candidateSeedIndices.end()), candidateSeedIndices.end());
+
         const Cluster *pBestSeedCluster(NULL);
         float bestDistance(m_maxClusterSeparation);
 
-        for (ClusterVector::const_iterator sIter = seedClusters.begin(), sIterEnd = seedClusters.end(); sIter != sIterEnd; ++sIter)
+        for (const unsigned int seedIndex : candidateSeedIndices)
         {
-            const Cluster *const pThisSeedCluster = *sIter;
+            const Cluster *const pThisSeedCluster = seedClusters.at(seedIndex);
             const float thisDistance(LArClusterHelper::GetClosestDistance(pNonSeedCluster, pThisSeedCluster));
 
             if (thisDistance < bestDistance)
@@ -11,10 +11,18 @@
 #include "Pandora/Algorithm.h"
 
 #include <unordered_map>
+#include <vector>
 
 namespace lar_content
 {
 
+template <typename, unsigned int>
+class KDTreeLinkerAlgo;
+template <typename, unsigned int>
+class KDTreeNodeInfoT;
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 /**
  *  @brief  ClusterGrowingAlgorithm class
  */
@@ -49,6 +57,12 @@ protected:
     virtual void GetListOfSeedClusters(const pandora::ClusterVector &cleanClusters, pandora::ClusterVector &seedClusters) const = 0;
 
 private:
+    typedef KDTreeLinkerAlgo<const pandora::CaloHit *, 2> HitKDTree2D;
+    typedef KDTreeNodeInfoT<const pandora::CaloHit *, 2> HitKDNode2D;
+    typedef std::vector<HitKDNode2D> HitKDNode2DList;
+
+    typedef std::unordered_map<const pandora::CaloHit *, unsigned int> HitToIndexMap;
+
     /**
      *  @brief Get List of non-seed clusters
      *
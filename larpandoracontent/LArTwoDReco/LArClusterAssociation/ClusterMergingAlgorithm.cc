@@ -19,6 +19,9 @@ namespace lar_content
 
 StatusCode ClusterMergingAlgorithm::Run()
 {
+    const LArClusterHelper::GeometryCacheScope geometryCacheScope;
+    const TransientArena::Scope transientArenaScope;
+
     const ClusterList *pClusterList = NULL;
 
     if (m_inputClusterListName.empty())
@@ -39,19 +42,31 @@ StatusCode ClusterMergingAlgorithm::Run()
         return STATUS_CODE_SUCCESS;
     }
 
+    const float maxProximityDistance(this->GetMaxProximityDistance());
+    ClusterProximityGraph proximityGraph(maxProximityDistance);
+
     while (true)
     {
         ClusterVector unsortedVector, clusterVector;
         this->GetListOfCleanClusters(pClusterList, unsortedVector);
         this->GetSortedListOfCleanClusters(unsortedVector, clusterVector);
 
-        ClusterMergeMap clusterMergeMap;
-        this->PopulateClusterMergeMap(clusterVector, clusterMergeMap);
+        ClusterMergeMap clusterMergeMap(TransientArena::GetMemoryResource());
+
+        if (maxProximityDistance < 0.f)
+        {
+            this->PopulateClusterMergeMap(clusterVector, clusterMergeMap);
+        }
+        else
+        {
+            proximityGraph.Update(clusterVector);
+            this->PopulateClusterMergeMapFromGraph(clusterVector, proximityGraph, clusterMergeMap);
+        }
 
         if (clusterMergeMap.empty())
             break;
 
-        this->MergeClusters(clusterVector, clusterMergeMap);
+        this->MergeClusters(clusterVector, clusterMergeMap, proximityGraph);
     }
 
     return STATUS_CODE_SUCCESS;
@@ -59,7 +74,23 @@ StatusCode ClusterMergingAlgorithm::Run()
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void ClusterMergingAlgorithm::MergeClusters(ClusterVector &clusterVector, ClusterMergeMap &clusterMergeMap) const
+float ClusterMergingAlgorithm::GetMaxProximityDistance() const
+{
+    return -1.f;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ClusterMergingAlgorithm::PopulateClusterMergeMapFromGraph(
+    const ClusterVector &clusterVector, const ClusterProximityGraph &, ClusterMergeMap &clusterMergeMap) const
+{
+    this->PopulateClusterMergeMap(clusterVector, clusterMergeMap);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ClusterMergingAlgorithm::MergeClusters(
+    ClusterVector &clusterVector, ClusterMergeMap &clusterMergeMap, ClusterProximityGraph &proximityGraph) const
 {
     ClusterSet clusterVetoList;
 
@@ -88,6 +119,8 @@ void ClusterMergingAlgorithm::MergeClusters(ClusterVector &clusterVector, Cluste
                 PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=,
                     PandoraContentApi::MergeAndDeleteClusters(*this, pSeedCluster, pAssociatedCluster, m_inputClusterListName, m_inputClusterListName));
             }
+
+            proximityGraph.MergeClusters(pSeedCluster, pAssociatedCluster);
         }
     }
 }
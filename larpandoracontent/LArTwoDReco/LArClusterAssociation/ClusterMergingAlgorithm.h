@@ -10,7 +10,8 @@
 
 #include "Pandora/Algorithm.h"
 
-#include <unordered_map>
+#include "larpandoracontent/LArObjects/LArClusterProximityGraph.h"
+#include "larpandoracontent/LArObjects/LArTransientArena.h"
 
 namespace lar_content
 {
@@ -24,7 +25,7 @@ protected:
     virtual pandora::StatusCode Run();
     virtual pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
-    typedef std::unordered_map<const pandora::Cluster *, pandora::ClusterList> ClusterMergeMap;
+    typedef ArenaUnorderedMap<const pandora::Cluster *, pandora::ClusterList> ClusterMergeMap;
 
     /**
      *  @brief  Populate cluster vector with subset of cluster list, containing clusters judged to be clean
@@ -42,13 +43,34 @@ protected:
      */
     virtual void PopulateClusterMergeMap(const pandora::ClusterVector &clusterVector, ClusterMergeMap &clusterMergeMap) const = 0;
 
+    /**
+     *  @brief  Get the maximum closest distance between clusters joined in the proximity graph, which is maintained over the lifetime of
+     *          the algorithm run if this is not negative. The default is negative, so no proximity graph is maintained.
+     *
+     *  @return the maximum closest distance
+     */
+    virtual float GetMaxProximityDistance() const;
+
+    /**
+     *  @brief  Form associations between pointing clusters, using the proximity graph of clean clusters. This is used in place of
+     *          PopulateClusterMergeMap if the maximum proximity distance is not negative and, by default, forwards to it.
+     *
+     *  @param  clusterVector the vector of clean clusters
+     *  @param  proximityGraph the proximity graph, holding exactly the clean clusters
+     *  @param  clusterMergeMap the matrix of cluster associations
+     */
+    virtual void PopulateClusterMergeMapFromGraph(
+        const pandora::ClusterVector &clusterVector, const ClusterProximityGraph &proximityGraph, ClusterMergeMap &clusterMergeMap) const;
+
     /**
      *  @brief  Merge associated clusters
      *
      *  @param  clusterVector the vector of clean clusters
      *  @param  clusterMergeMap the matrix of cluster associations
+     *  @param  proximityGraph the proximity graph, to be updated to reflect the merges
      */
-    void MergeClusters(pandora::ClusterVector &clusterVector, ClusterMergeMap &clusterMergeMap) const;
+    void MergeClusters(
+        pandora::ClusterVector &clusterVector, ClusterMergeMap &clusterMergeMap, ClusterProximityGraph &proximityGraph) const;
 
     /**
      *  @brief  Collect up all clusters associations related to a given seed cluster
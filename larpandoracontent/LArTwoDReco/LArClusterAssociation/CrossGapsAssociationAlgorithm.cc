@@ -73,6 +73,9 @@ void CrossGapsAssociationAlgorithm::PopulateClusterAssociationMap(const ClusterV
         }
     }
 
+    // ATTN The gap flags for the sampling points extrapolated from each cluster are shared between all its candidate partners
+    ClusterToGapFlagsMap innerGapFlagsMap, outerGapFlagsMap;
+
     // ATTN This method assumes that clusters have been sorted by layer
     for (ClusterVector::const_iterator iterI = clusterVector.begin(), iterIEnd = clusterVector.end(); iterI != iterIEnd; ++iterI)
     {
@@ -94,7 +97,7 @@ void CrossGapsAssociationAlgorithm::PopulateClusterAssociationMap(const ClusterV
             if (slidingFitResultMap.end() == fitIterJ)
                 continue;
 
-            if (!this->AreClustersAssociated(fitIterI->second, fitIterJ->second))
+            if (!this->AreClustersAssociated(fitIterI->second, fitIterJ->second, innerGapFlagsMap, outerGapFlagsMap))
                 continue;
 
             clusterAssociationMap[pInnerCluster].m_forwardAssociations.insert(pOuterCluster);
@@ -121,22 +124,34 @@ bool CrossGapsAssociationAlgorithm::IsExtremalCluster(const bool isForward, cons
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-bool CrossGapsAssociationAlgorithm::AreClustersAssociated(const TwoDSlidingFitResult &innerFitResult, const TwoDSlidingFitResult &outerFitResult) const
+bool CrossGapsAssociationAlgorithm::AreClustersAssociated(const TwoDSlidingFitResult &innerFitResult,
+    const TwoDSlidingFitResult &outerFitResult, ClusterToGapFlagsMap &innerGapFlagsMap, ClusterToGapFlagsMap &outerGapFlagsMap) const
 {
-    if (outerFitResult.GetCluster()->GetInnerPseudoLayer() < innerFitResult.GetCluster()->GetInnerPseudoLayer())
+    const Cluster *const pInnerCluster(innerFitResult.GetCluster());
+    const Cluster *const pOuterCluster(outerFitResult.GetCluster());
+
+    if (pOuterCluster->GetInnerPseudoLayer() < pInnerCluster->GetInnerPseudoLayer())
         throw pandora::StatusCodeException(STATUS_CODE_NOT_ALLOWED);
 
-    if (outerFitResult.GetCluster()->GetInnerPseudoLayer() < innerFitResult.GetCluster()->GetOuterPseudoLayer())
+    if (pOuterCluster->GetInnerPseudoLayer() < pInnerCluster->GetOuterPseudoLayer())
         return false;
 
-    return (this->IsAssociated(innerFitResult.GetGlobalMaxLayerPosition(), innerFitResult.GetGlobalMaxLayerDirection(), outerFitResult) &&
-            this->IsAssociated(outerFitResult.GetGlobalMinLayerPosition(), outerFitResult.GetGlobalMinLayerDirection() * -1.f, innerFitResult));
+    // ATTN Gap flags are evaluated for the target hit type, so can only be shared between partners of the same hit type
+    const bool isSameHitType(LArClusterHelper::GetClusterHitType(pInnerCluster) == LArClusterHelper::GetClusterHitType(pOuterCluster));
+    GapFlagVector localInnerGapFlagVector, localOuterGapFlagVector;
+    GapFlagVector &innerGapFlagVector(isSameHitType ? innerGapFlagsMap[pInnerCluster] : localInnerGapFlagVector);
+    GapFlagVector &outerGapFlagVector(isSameHitType ? outerGapFlagsMap[pOuterCluster] : localOuterGapFlagVector);
+
+    return (this->IsAssociated(innerFitResult.GetGlobalMaxLayerPosition(), innerFitResult.GetGlobalMaxLayerDirection(), outerFitResult,
+                innerGapFlagVector) &&
+        this->IsAssociated(outerFitResult.GetGlobalMinLayerPosition(), outerFitResult.GetGlobalMinLayerDirection() * -1.f, innerFitResult,
+            outerGapFlagVector));
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-bool CrossGapsAssociationAlgorithm::IsAssociated(
-    const CartesianVector &startPosition, const CartesianVector &startDirection, const TwoDSlidingFitResult &targetFitResult) const
+bool CrossGapsAssociationAlgorithm::IsAssociated(const CartesianVector &startPosition, const CartesianVector &startDirection,
+    const TwoDSlidingFitResult &targetFitResult, GapFlagVector &gapFlagVector) const
 {
     const HitType hitType(LArClusterHelper::GetClusterHitType(targetFitResult.GetCluster()));
     unsigned int nSamplingPoints(0), nGapSamplingPoints(0), nMatchedSamplingPoints(0), nUnmatchedSampleRun(0);
@@ -146,7 +161,10 @@ bool CrossGapsAssociationAlgorithm::IsAssociated(
         ++nSamplingPoints;
         const CartesianVector samplingPoint(startPosition + startDirection * static_cast<float>(iSample) * m_sampleStepSize);
 
-        if (LArGeometryHelper::IsInGap(this->GetPandora(), samplingPoint, hitType, m_gapTolerance))
+        if (iSample == gapFlagVector.size())
+            gapFlagVector.push_back(LArGeometryHelper::IsInGap(this->GetPandora(), samplingPoint, hitType, m_gapTolerance));
+
+        if (gapFlagVector.at(iSample))
         {
             ++nGapSamplingPoints;
             nUnmatchedSampleRun = 0; // ATTN Choose to also reset run when entering gap region
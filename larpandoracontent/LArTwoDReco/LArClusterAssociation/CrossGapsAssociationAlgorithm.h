@@ -14,6 +14,9 @@
 
 #include "larpandoracontent/LArTwoDReco/LArClusterAssociation/ClusterAssociationAlgorithm.h"
 
+#include <unordered_map>
+#include <vector>
+
 namespace lar_content
 {
 
@@ -29,6 +32,9 @@ public:
     CrossGapsAssociationAlgorithm();
 
 private:
+    typedef std::vector<bool> GapFlagVector;
+    typedef std::unordered_map<const pandora::Cluster *, GapFlagVector> ClusterToGapFlagsMap;
+
     void GetListOfCleanClusters(const pandora::ClusterList *const pClusterList, pandora::ClusterVector &clusterVector) const;
     void PopulateClusterAssociationMap(const pandora::ClusterVector &clusterVector, ClusterAssociationMap &clusterAssociationMap) const;
     bool IsExtremalCluster(const bool isForward, const pandora::Cluster *const pCurrentCluster, const pandora::Cluster *const pTestCluster) const;
@@ -38,10 +44,13 @@ private:
      *
      *  @param  innerFitResult two dimensional sliding fit result for the inner cluster
      *  @param  outerFitResult two dimensional sliding fit result for the outer cluster
+     *  @param  innerGapFlagsMap the map from inner cluster to the gap flags for sampling points extrapolated forwards from it
+     *  @param  outerGapFlagsMap the map from outer cluster to the gap flags for sampling points extrapolated backwards from it
      *
      *  @return boolean
      */
-    bool AreClustersAssociated(const TwoDSlidingFitResult &innerFitResult, const TwoDSlidingFitResult &outerFitResult) const;
+    bool AreClustersAssociated(const TwoDSlidingFitResult &innerFitResult, const TwoDSlidingFitResult &outerFitResult,
+        ClusterToGapFlagsMap &innerGapFlagsMap, ClusterToGapFlagsMap &outerGapFlagsMap) const;
 
     /**
      *  @brief  Sample points along the extrapolation from a starting position to a target fit result to declare cluster association
@@ -49,11 +58,13 @@ private:
      *  @param  startPosition the start position
      *  @param  startDirection the start direction
      *  @param  targetFitResult the target fit result
+     *  @param  gapFlagVector the flags recording whether each sampling point considered so far lies in a gap, for the target hit type,
+     *          extended as further sampling points are considered
      *
      *  @return boolean
      */
     bool IsAssociated(const pandora::CartesianVector &startPosition, const pandora::CartesianVector &startDirection,
-        const TwoDSlidingFitResult &targetFitResult) const;
+        const TwoDSlidingFitResult &targetFitResult, GapFlagVector &gapFlagVector) const;
 
     /**
      *  @brief  Whether a sampling point lies near a target 2d sliding fit result
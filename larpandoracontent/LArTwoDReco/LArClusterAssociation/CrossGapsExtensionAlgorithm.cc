@@ -63,6 +63,9 @@ void CrossGapsExtensionAlgorithm::FillClusterAssociationMatrix(const ClusterVect
 
         for (const LArPointingCluster &pointingClusterOuter : outerPointingClusterList)
         {
+            if (this->IsCachedPair(pointingClusterInner.GetCluster(), pointingClusterOuter.GetCluster()))
+                continue;
+
             const LArPointingCluster::Vertex &pointingVertexOuter(pointingClusterOuter.GetOuterVertex());
             const float zOuter(pointingVertexOuter.GetPosition().GetZ());
 
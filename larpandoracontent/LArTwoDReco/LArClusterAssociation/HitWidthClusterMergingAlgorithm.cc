@@ -13,6 +13,11 @@
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
 #include "larpandoracontent/LArHelpers/LArPcaHelper.h"
 
+#include <algorithm>
+#include <limits>
+#include <tuple>
+#include <vector>
+
 using namespace pandora;
 
 namespace lar_content
@@ -57,8 +62,9 @@ void HitWidthClusterMergingAlgorithm::GetListOfCleanClusters(const ClusterList *
         if (clusterSparseness < m_minClusterSparseness)
             continue;
 
-        m_clusterToParametersMap.insert(std::pair<const Cluster *, LArHitWidthHelper::ClusterParameters>(
-            pCluster, LArHitWidthHelper::ClusterParameters(pCluster, m_maxConstituentHitWidth, false, m_hitWidthScalingFactor)));
+        // ATTN Construct the parameters in place, as their const constituent hit vector would otherwise be copied
+        m_clusterToParametersMap.emplace(std::piecewise_construct, std::forward_as_tuple(pCluster),
+            std::forward_as_tuple(pCluster, m_maxConstituentHitWidth, false, m_hitWidthScalingFactor));
 
         clusterVector.push_back(pCluster);
     }
@@ -71,20 +77,34 @@ void HitWidthClusterMergingAlgorithm::GetListOfCleanClusters(const ClusterList *
 void HitWidthClusterMergingAlgorithm::PopulateClusterAssociationMap(const ClusterVector &clusterVector, ClusterAssociationMap &clusterAssociationMap) const
 {
     // ATTN this method assumes that clusters have been sorted by extremal x position (low higherXExtrema -> high higherXExtrema)
-    for (ClusterVector::const_iterator iterCurrentCluster = clusterVector.begin(); iterCurrentCluster != clusterVector.end(); ++iterCurrentCluster)
+    const unsigned int nClusters(clusterVector.size());
+    std::vector<const LArHitWidthHelper::ClusterParameters *> clusterParametersVector(nClusters, nullptr);
+
+    for (unsigned int index = 0; index < nClusters; ++index)
+        clusterParametersVector.at(index) = &LArHitWidthHelper::GetClusterParameters(clusterVector.at(index), m_clusterToParametersMap);
+
+    // The minimum lowerXExtrema x position of the clusters from each position onwards, ending the sweep once no later test cluster is near
+    std::vector<float> minFollowingLowerX(nClusters + 1, std::numeric_limits<float>::max());
+
+    for (unsigned int index = nClusters; index > 0; --index)
+    {
+        const float lowerX(clusterParametersVector.at(index - 1)->GetLowerXExtrema().GetX());
+        minFollowingLowerX.at(index - 1) = std::min(minFollowingLowerX.at(index), lowerX);
+    }
+
+    for (unsigned int currentIndex = 0; currentIndex < nClusters; ++currentIndex)
     {
-        const Cluster *const pCurrentCluster = *iterCurrentCluster;
-        const LArHitWidthHelper::ClusterParameters &currentClusterParameters(
-            LArHitWidthHelper::GetClusterParameters(pCurrentCluster, m_clusterToParametersMap));
+        const Cluster *const pCurrentCluster = clusterVector.at(currentIndex);
+        const LArHitWidthHelper::ClusterParameters &currentClusterParameters(*clusterParametersVector.at(currentIndex));
+        const float maxTestLowerX(currentClusterParameters.GetHigherXExtrema().GetX() + m_maxXMergeDistance);
 
-        for (ClusterVector::const_iterator iterTestCluster = iterCurrentCluster; iterTestCluster != clusterVector.end(); ++iterTestCluster)
+        for (unsigned int testIndex = currentIndex + 1; testIndex < nClusters; ++testIndex)
         {
-            if (iterCurrentCluster == iterTestCluster)
-                continue;
+            if (minFollowingLowerX.at(testIndex) > maxTestLowerX)
+                break;
 
-            const Cluster *const pTestCluster = *iterTestCluster;
-            const LArHitWidthHelper::ClusterParameters &testClusterParameters(
-                LArHitWidthHelper::GetClusterParameters(pTestCluster, m_clusterToParametersMap));
+            const Cluster *const pTestCluster = clusterVector.at(testIndex);
+            const LArHitWidthHelper::ClusterParameters &testClusterParameters(*clusterParametersVector.at(testIndex));
 
             if (!this->AreClustersAssociated(currentClusterParameters, testClusterParameters))
                 continue;
@@ -102,12 +122,12 @@ void HitWidthClusterMergingAlgorithm::PopulateClusterAssociationMap(const Cluste
 bool HitWidthClusterMergingAlgorithm::IsExtremalCluster(const bool isForward, const Cluster *const pCurrentCluster, const Cluster *const pTestCluster) const
 {
     //ATTN - cannot use map since higherXExtrema may have changed during merging
-    const LArHitWidthHelper::ConstituentHitVector currentConstituentHitVector(
-        LArHitWidthHelper::GetConstituentHits(pCurrentCluster, m_maxConstituentHitWidth, m_hitWidthScalingFactor, false));
-    const LArHitWidthHelper::ConstituentHitVector testConstituentHitVector(
-        LArHitWidthHelper::GetConstituentHits(pTestCluster, m_maxConstituentHitWidth, m_hitWidthScalingFactor, false));
-    const CartesianVector currentHigherXExtrema(LArHitWidthHelper::GetExtremalCoordinatesHigherX(currentConstituentHitVector));
-    const CartesianVector testHigherXExtrema(LArHitWidthHelper::GetExtremalCoordinatesHigherX(testConstituentHitVector));
+    LArHitWidthHelper::GetConstituentHits(
+        pCurrentCluster, m_maxConstituentHitWidth, m_hitWidthScalingFactor, false, m_constituentHitBuffer);
+    const CartesianVector currentHigherXExtrema(LArHitWidthHelper::GetExtremalCoordinatesHigherX(m_constituentHitBuffer));
+
+    LArHitWidthHelper::GetConstituentHits(pTestCluster, m_maxConstituentHitWidth, m_hitWidthScalingFactor, false, m_constituentHitBuffer);
+    const CartesianVector testHigherXExtrema(LArHitWidthHelper::GetExtremalCoordinatesHigherX(m_constituentHitBuffer));
     float currentMaxX(currentHigherXExtrema.GetX()), testMaxX(testHigherXExtrema.GetX());
 
     if (isForward)
@@ -176,7 +196,9 @@ bool HitWidthClusterMergingAlgorithm::AreClustersAssociated(
         return false;
 
     // check that the new direction is consistent with the old clusters
-    LArHitWidthHelper::ConstituentHitVector newConstituentHitVector(currentFitParameters.GetConstituentHitVector());
+    LArHitWidthHelper::ConstituentHitVector &newConstituentHitVector(m_constituentHitBuffer);
+    newConstituentHitVector.assign(
+        currentFitParameters.GetConstituentHitVector().begin(), currentFitParameters.GetConstituentHitVector().end());
     newConstituentHitVector.insert(newConstituentHitVector.end(), testFitParameters.GetConstituentHitVector().begin(),
         testFitParameters.GetConstituentHitVector().end());
 
@@ -229,7 +251,8 @@ void HitWidthClusterMergingAlgorithm::GetClusterDirection(const LArHitWidthHelpe
     bool isLConstant(true), isTConstant(true);
 
     // get fitting subset vector
-    LArHitWidthHelper::ConstituentHitVector constituentHitSubsetVector;
+    LArHitWidthHelper::ConstituentHitVector &constituentHitSubsetVector(m_constituentHitSubsetBuffer);
+    constituentHitSubsetVector.clear();
     this->GetConstituentHitSubsetVector(constituentHitVector, fitReferencePoint, fittingWeight, constituentHitSubsetVector);
 
     // determine the fitting axes
@@ -307,7 +330,8 @@ void HitWidthClusterMergingAlgorithm::GetClusterDirection(const LArHitWidthHelpe
 void HitWidthClusterMergingAlgorithm::GetConstituentHitSubsetVector(const LArHitWidthHelper::ConstituentHitVector &constituentHitVector,
     const CartesianVector &fitReferencePoint, const float fittingWeight, LArHitWidthHelper::ConstituentHitVector &constituentHitSubsetVector) const
 {
-    LArHitWidthHelper::ConstituentHitVector sortedConstituentHitVector(constituentHitVector);
+    LArHitWidthHelper::ConstituentHitVector &sortedConstituentHitVector(m_sortedConstituentHitBuffer);
+    sortedConstituentHitVector.assign(constituentHitVector.begin(), constituentHitVector.end());
 
     // sort hits with respect to their distance to the fitReferencePoint (closest -> furthest)
     std::sort(sortedConstituentHitVector.begin(), sortedConstituentHitVector.end(),
@@ -330,15 +354,20 @@ void HitWidthClusterMergingAlgorithm::GetConstituentHitSubsetVector(const LArHit
 void HitWidthClusterMergingAlgorithm::GetFittingAxes(const LArHitWidthHelper::ConstituentHitVector &constituentHitSubsetVector,
     CartesianVector &axisDirection, CartesianVector &orthoDirection) const
 {
-    CartesianPointVector constituentHitSubsetPositionVector(LArHitWidthHelper::GetConstituentHitPositionVector(constituentHitSubsetVector));
-
-    if (constituentHitSubsetPositionVector.size() < 2)
+    if (constituentHitSubsetVector.size() < 2)
         throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
 
+    // ATTN Fill the unit weight pca input directly, as RunPca would for a vector of constituent hit positions
+    LArPcaHelper::WeightedPointVector &weightedPointVector(m_weightedPointBuffer);
+    weightedPointVector.clear();
+
+    for (const LArHitWidthHelper::ConstituentHit &constituentHit : constituentHitSubsetVector)
+        weightedPointVector.emplace_back(constituentHit.GetPositionVector(), 1.);
+
     CartesianVector centroid(0.f, 0.f, 0.f);
     LArPcaHelper::EigenVectors eigenVecs;
     LArPcaHelper::EigenValues eigenValues(0.f, 0.f, 0.f);
-    LArPcaHelper::RunPca(constituentHitSubsetPositionVector, centroid, eigenValues, eigenVecs);
+    LArPcaHelper::RunPca(weightedPointVector, centroid, eigenValues, eigenVecs);
 
     axisDirection = eigenVecs.at(0);
 
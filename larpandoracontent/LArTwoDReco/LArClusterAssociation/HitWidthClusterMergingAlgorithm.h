@@ -13,6 +13,7 @@
 #include "larpandoracontent/LArTwoDReco/LArClusterAssociation/ClusterAssociationAlgorithm.h"
 
 #include "larpandoracontent/LArHelpers/LArHitWidthHelper.h"
+#include "larpandoracontent/LArHelpers/LArPcaHelper.h"
 
 namespace lar_content
 {
@@ -140,6 +141,11 @@ private:
 
     // ATTN Dangling pointers emerge during cluster merging, here explicitly not dereferenced
     mutable LArHitWidthHelper::ClusterToParametersMap m_clusterToParametersMap; ///< The map [cluster -> cluster parameters]
+
+    mutable LArHitWidthHelper::ConstituentHitVector m_constituentHitBuffer;       ///< Reusable storage for cluster constituent hits
+    mutable LArHitWidthHelper::ConstituentHitVector m_sortedConstituentHitBuffer; ///< Reusable storage for distance-sorted constituent hits
+    mutable LArHitWidthHelper::ConstituentHitVector m_constituentHitSubsetBuffer; ///< Reusable storage for the constituent hits in a fit
+    mutable LArPcaHelper::WeightedPointVector m_weightedPointBuffer;              ///< Reusable storage for the fitting axes pca input
 };
 
 } //namespace lar_content
@@ -79,6 +79,9 @@ void LongitudinalExtensionAlgorithm::FillClusterAssociationMatrix(const ClusterV
             if (clusterI.GetCluster() == clusterJ.GetCluster())
                 continue;
 
+            if (this->IsCachedPair(clusterI.GetCluster(), clusterJ.GetCluster()))
+                continue;
+
             this->FillClusterAssociationMatrix(clusterI, clusterJ, clusterAssociationMatrix);
         }
     }
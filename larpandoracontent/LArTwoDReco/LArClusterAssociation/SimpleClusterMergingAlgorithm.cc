@@ -67,6 +67,48 @@ void SimpleClusterMergingAlgorithm::PopulateClusterMergeMap(const ClusterVector
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+float SimpleClusterMergingAlgorithm::GetMaxProximityDistance() const
+{
+    return m_maxClusterSeparation;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void SimpleClusterMergingAlgorithm::PopulateClusterMergeMapFromGraph(
+    const ClusterVector &clusterVector, const ClusterProximityGraph &proximityGraph, ClusterMergeMap &clusterMergeMap) const
+{
+    std::unordered_map<const Cluster *, unsigned int> clusterToIndexMap;
+
+    for (unsigned int index = 0; index < clusterVector.size(); ++index)
+        (void)clusterToIndexMap.emplace(clusterVector[index], index);
+
+    // ATTN Associations are added in the same order as by the pairwise search in PopulateClusterMergeMap, with the same criterion
+    for (unsigned int indexI = 0; indexI < clusterVector.size(); ++indexI)
+    {
+        const Cluster *const pClusterI(clusterVector[indexI]);
+        UIntVector associatedIndices;
+
+        for (const ClusterProximityGraph::ClusterDistanceMap::value_type &mapEntry : proximityGraph.GetNeighbours(pClusterI))
+        {
+            const unsigned int indexJ(clusterToIndexMap.at(mapEntry.first));
+
+            if ((indexJ > indexI) && !(mapEntry.second > m_maxClusterSeparation))
+                associatedIndices.push_back(indexJ);
+        }
+
+        std::sort(associatedIndices.begin(), associatedIndices.end());
+
+        for (const unsigned int indexJ : associatedIndices)
+        {
+            const Cluster *const pClusterJ(clusterVector[indexJ]);
+            clusterMergeMap[pClusterI].push_back(pClusterJ);
+            clusterMergeMap[pClusterJ].push_back(pClusterI);
+        }
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 bool SimpleClusterMergingAlgorithm::IsAssociated(const Cluster *const pClusterI, const Cluster *const pClusterJ) const
 {
     if (LArClusterHelper::GetClosestDistance(pClusterI, pClusterJ) > m_maxClusterSeparation)
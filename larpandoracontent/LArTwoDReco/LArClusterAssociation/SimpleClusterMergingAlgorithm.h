@@ -29,6 +29,9 @@ public:
 private:
     void GetListOfCleanClusters(const pandora::ClusterList *const pClusterList, pandora::ClusterVector &clusterVector) const;
     void PopulateClusterMergeMap(const pandora::ClusterVector &clusterVector, ClusterMergeMap &clusterMergeMap) const;
+    float GetMaxProximityDistance() const;
+    void PopulateClusterMergeMapFromGraph(
+        const pandora::ClusterVector &clusterVector, const ClusterProximityGraph &proximityGraph, ClusterMergeMap &clusterMergeMap) const;
 
     /**
      *  @brief Decide whether two clusters are associated
@@ -136,6 +136,8 @@ void TransverseAssociationAlgorithm::GetNearbyClusterMap(const ClusterVector &al
     KDTreeBox hitsBoundingRegion2D(fill_and_bound_2d_kd_tree(allCaloHits, hitKDNode2DList));
     kdTree.build(hitKDNode2DList, hitsBoundingRegion2D);
 
+    HitKDNode2DList found;
+
     for (const Cluster *const pCluster : allClusters)
     {
         CaloHitList daughterHits;
@@ -145,7 +147,7 @@ void TransverseAssociationAlgorithm::GetNearbyClusterMap(const ClusterVector &al
         {
             KDTreeBox searchRegionHits(build_2d_kd_search_region(pCaloHit, m_searchRegionX, m_searchRegionZ));
 
-            HitKDNode2DList found;
+            found.clear();
             kdTree.search(searchRegionHits, found);
 
             for (const auto &hit : found)
@@ -212,13 +214,33 @@ void TransverseAssociationAlgorithm::FillReducedAssociationMap(const ClusterToCl
 void TransverseAssociationAlgorithm::FillAssociationMap(const ClusterToClustersMap &nearbyClusters, const ClusterVector &firstVector,
     const ClusterVector &secondVector, ClusterAssociationMap &firstAssociationMap, ClusterAssociationMap &secondAssociationMap) const
 {
+    // ATTN Only nearby clusters can be associated, so visit just these, in their order within the second vector
+    ClusterToIndexMap secondIndexMap;
+
+    for (unsigned int index = 0; index < secondVector.size(); ++index)
+        (void)secondIndexMap.insert(ClusterToIndexMap::value_type(secondVector.at(index), index));
+
+    std::vector<unsigned int> candidateIndices;
+
     for (ClusterVector::const_iterator iterI = firstVector.begin(), iterEndI = firstVector.end(); iterI != iterEndI; ++iterI)
     {
         const Cluster *const pClusterI = *iterI;
 
-        for (ClusterVector::const_iterator iterJ = secondVector.begin(), iterEndJ = secondVector.end(); iterJ != iterEndJ; ++iterJ)
+        candidateIndices.clear();
+
+        for (const Cluster *const pNearbyCluster : nearbyClusters.at(pClusterI))
         {
-            const Cluster *const pClusterJ = *iterJ;
+            ClusterToIndexMap::const_iterator indexIter = secondIndexMap.find(pNearbyCluster);
+
+            if (secondIndexMap.end() != indexIter)
+                candidateIndices.push_back(indexIter->second);
+        }
+
+        std::sort(candidateIndices.begin(), candidateIndices.end());
+
+        for (const unsigned int index : candidateIndices)
+        {
+            const Cluster *const pClusterJ = secondVector.at(index);
 
             if (pClusterI == pClusterJ)
                 continue;
@@ -263,6 +285,14 @@ void TransverseAssociationAlgorithm::FillTransverseAssociationMap(const ClusterT
     const TransverseClusterList &transverseClusterList, const ClusterAssociationMap &transverseAssociationMap,
     ClusterAssociationMap &clusterAssociationMap) const
 {
+    // ATTN Only forward associated clusters can be associated, so visit just these, in their order within the transverse cluster list
+    ClusterToIndexMap transverseIndexMap;
+
+    for (unsigned int index = 0; index < transverseClusterList.size(); ++index)
+        (void)transverseIndexMap.insert(ClusterToIndexMap::value_type(transverseClusterList.at(index)->GetSeedCluster(), index));
+
+    std::vector<unsigned int> candidateIndices;
+
     for (TransverseClusterList::const_iterator iter1 = transverseClusterList.begin(), iterEnd1 = transverseClusterList.end(); iter1 != iterEnd1; ++iter1)
     {
         LArTransverseCluster *const pInnerTransverseCluster = *iter1;
@@ -272,10 +302,21 @@ void TransverseAssociationAlgorithm::FillTransverseAssociationMap(const ClusterT
         if (transverseAssociationMap.end() == iterInner)
             continue;
 
-        for (TransverseClusterList::const_iterator iter2 = transverseClusterList.begin(), iterEnd2 = transverseClusterList.end();
-             iter2 != iterEnd2; ++iter2)
+        candidateIndices.clear();
+
+        for (const Cluster *const pForwardCluster : iterInner->second.m_forwardAssociations)
         {
-            LArTransverseCluster *const pOuterTransverseCluster = *iter2;
+            ClusterToIndexMap::const_iterator indexIter = transverseIndexMap.find(pForwardCluster);
+
+            if (transverseIndexMap.end() != indexIter)
+                candidateIndices.push_back(indexIter->second);
+        }
+
+        std::sort(candidateIndices.begin(), candidateIndices.end());
+
+        for (const unsigned int index : candidateIndices)
+        {
+            LArTransverseCluster *const pOuterTransverseCluster = transverseClusterList.at(index);
             const Cluster *const pOuterCluster(pOuterTransverseCluster->GetSeedCluster());
 
             ClusterAssociationMap::const_iterator iterOuter = transverseAssociationMap.find(pOuterCluster);
@@ -552,24 +593,12 @@ void TransverseAssociationAlgorithm::GetExtremalCoordinatesZ(const Cluster *cons
 
 void TransverseAssociationAlgorithm::GetExtremalCoordinatesXZ(const Cluster *const pCluster, const bool useX, float &minXZ, float &maxXZ) const
 {
-    minXZ = +std::numeric_limits<float>::max();
-    maxXZ = -std::numeric_limits<float>::max();
-
-    const OrderedCaloHitList &orderedCaloHitList(pCluster->GetOrderedCaloHitList());
+    // ATTN The bounding box is cached for the duration of the run, rather than recalculated for every cluster comparison
+    CartesianVector minimumCoordinate(0.f, 0.f, 0.f), maximumCoordinate(0.f, 0.f, 0.f);
+    LArClusterHelper::GetClusterBoundingBox(pCluster, minimumCoordinate, maximumCoordinate);
 
-    for (OrderedCaloHitList::const_iterator iter = orderedCaloHitList.begin(), iterEnd = orderedCaloHitList.end(); iter != iterEnd; ++iter)
-    {
-        for (CaloHitList::const_iterator hitIter = iter->second->begin(), hitIterEnd = iter->second->end(); hitIter != hitIterEnd; ++hitIter)
-        {
-            const float caloHitXZ(useX ? (*hitIter)->GetPositionVector().GetX() : (*hitIter)->GetPositionVector().GetZ());
-
-            if (caloHitXZ < minXZ)
-                minXZ = caloHitXZ;
-
-            if (caloHitXZ > maxXZ)
-                maxXZ = caloHitXZ;
-        }
-    }
+    minXZ = (useX ? minimumCoordinate.GetX() : minimumCoordinate.GetZ());
+    maxXZ = (useX ? maximumCoordinate.GetX() : maximumCoordinate.GetZ());
 
     if (maxXZ < minXZ)
         throw pandora::StatusCodeException(STATUS_CODE_FAILURE);
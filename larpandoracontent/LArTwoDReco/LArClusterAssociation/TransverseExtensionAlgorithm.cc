@@ -70,6 +70,9 @@ void TransverseExtensionAlgorithm::FillClusterAssociationMatrix(const ClusterVec
             if (parentCluster.GetCluster() == pDaughterCluster)
                 continue;
 
+            if (this->IsCachedPair(parentCluster.GetCluster(), pDaughterCluster))
+                continue;
+
             this->FillClusterAssociationMatrix(parentCluster, pDaughterCluster, clusterAssociationMatrix);
         }
     }
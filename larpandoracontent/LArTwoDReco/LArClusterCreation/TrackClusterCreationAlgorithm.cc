@@ -184,12 +184,31 @@ StatusCode TrackClusterCreationAlgorithm::AddFilteredCaloHits(
 void TrackClusterCreationAlgorithm::MakePrimaryAssociations(const OrderedCaloHitList &orderedCaloHitList,
     HitAssociationMap &forwardHitAssociationMap, HitAssociationMap &backwardHitAssociationMap) const
 {
+    LayerHitIndexMap layerHitIndexMap;
+
+    for (OrderedCaloHitList::const_iterator iter = orderedCaloHitList.begin(), iterEnd = orderedCaloHitList.end(); iter != iterEnd; ++iter)
+    {
+        LayerHitIndex &layerHitIndex(layerHitIndexMap[iter->first]);
+        layerHitIndex.m_caloHits.assign(iter->second->begin(), iter->second->end());
+        std::sort(layerHitIndex.m_caloHits.begin(), layerHitIndex.m_caloHits.end(), LArClusterHelper::SortHitsByPosition);
+
+        layerHitIndex.m_xIndices.reserve(layerHitIndex.m_caloHits.size());
+
+        for (unsigned int index = 0; index < layerHitIndex.m_caloHits.size(); ++index)
+            layerHitIndex.m_xIndices.emplace_back(layerHitIndex.m_caloHits[index]->GetPositionVector().GetX(), index);
+
+        std::sort(layerHitIndex.m_xIndices.begin(), layerHitIndex.m_xIndices.end());
+    }
+
+    // ATTN Only hits within the maximum separation in x can be associated. The window is widened slightly so that rounding cannot exclude
+    // any such hit, and candidate hits are visited in position order, so the associations are those of an exhaustive pairwise search
+    const float maxDeltaX(std::sqrt(m_maxCaloHitSeparationSquared) + 0.01f);
+    std::vector<unsigned int> candidateIndices;
+
     for (OrderedCaloHitList::const_iterator iterI = orderedCaloHitList.begin(), iterIEnd = orderedCaloHitList.end(); iterI != iterIEnd; ++iterI)
     {
         unsigned int nLayersConsidered(0);
-
-        CaloHitVector caloHitsI(iterI->second->begin(), iterI->second->end());
-        std::sort(caloHitsI.begin(), caloHitsI.end(), LArClusterHelper::SortHitsByPosition);
+        const LayerHitIndex &layerHitIndexI(layerHitIndexMap.at(iterI->first));
 
         for (OrderedCaloHitList::const_iterator iterJ = iterI, iterJEnd = orderedCaloHitList.end();
              (nLayersConsidered++ <= m_maxGapLayers + 1) && (iterJ != iterJEnd); ++iterJ)
@@ -197,13 +216,29 @@ void TrackClusterCreationAlgorithm::MakePrimaryAssociations(const OrderedCaloHit
             if (iterJ->first == iterI->first || iterJ->first > iterI->first + m_maxGapLayers + 1)
                 continue;
 
-            CaloHitVector caloHitsJ(iterJ->second->begin(), iterJ->second->end());
-            std::sort(caloHitsJ.begin(), caloHitsJ.end(), LArClusterHelper::SortHitsByPosition);
+            const LayerHitIndex &layerHitIndexJ(layerHitIndexMap.at(iterJ->first));
 
-            for (const CaloHit *const pCaloHitI : caloHitsI)
+            for (const CaloHit *const pCaloHitI : layerHitIndexI.m_caloHits)
             {
-                for (const CaloHit *const pCaloHitJ : caloHitsJ)
-                    this->CreatePrimaryAssociation(pCaloHitI, pCaloHitJ, forwardHitAssociationMap, backwardHitAssociationMap);
+                const float x(pCaloHitI->GetPositionVector().GetX());
+                const HitXIndexVector::const_iterator lowerIter(std::lower_bound(layerHitIndexJ.m_xIndices.begin(),
+                    layerHitIndexJ.m_xIndices.end(), x - maxDeltaX,
+                    [](const HitXIndexVector::value_type &xIndex, const float value) { return (xIndex.first < value); }));
+                const HitXIndexVector::const_iterator upperIter(std::upper_bound(lowerIter, layerHitIndexJ.m_xIndices.end(), x + maxDeltaX,
+                    [](const float value, const HitXIndexVector::value_type &xIndex) { return (value < xIndex.first); }));
+
+                candidateIndices.clear();
+
+                for (HitXIndexVector::const_iterator xIter = lowerIter; xIter != upperIter; ++xIter)
+                    candidateIndices.push_back(xIter->second);
+
+                std::sort(candidateIndices.begin(), candidateIndices.end());
+
+                for (const unsigned int index : candidateIndices)
+                {
+                    this->CreatePrimaryAssociation(
+                        pCaloHitI, layerHitIndexJ.m_caloHits.at(index), forwardHitAssociationMap, backwardHitAssociationMap);
+                }
             }
         }
     }
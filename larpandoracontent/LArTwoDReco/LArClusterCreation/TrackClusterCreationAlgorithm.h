@@ -10,7 +10,10 @@
 
 #include "Pandora/Algorithm.h"
 
+#include <map>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace lar_content
 {
@@ -84,6 +87,19 @@ private:
         float m_secondaryDistanceSquared;           ///< the secondary distance squared
     };
 
+    typedef std::vector<std::pair<float, unsigned int>> HitXIndexVector;
+
+    /**
+     *  @brief  LayerHitIndex class, holding the hits in a pseudo layer in position order, indexed by x coordinate
+     */
+    class LayerHitIndex
+    {
+    public:
+        pandora::CaloHitVector m_caloHits; ///< The hits, in position order
+        HitXIndexVector m_xIndices;        ///< The x coordinate and position order index of each hit, sorted by x coordinate
+    };
+
+    typedef std::map<unsigned int, LayerHitIndex> LayerHitIndexMap;
     typedef std::unordered_map<const pandora::CaloHit *, HitAssociation> HitAssociationMap;
     typedef std::unordered_map<const pandora::CaloHit *, const pandora::CaloHit *> HitJoinMap;
     typedef std::unordered_map<const pandora::CaloHit *, const pandora::Cluster *> HitToClusterMap;
@@ -38,6 +38,9 @@ void BoundedClusterMopUpAlgorithm::ClusterMopUp(const ClusterList &pfoClusters,
     ClusterVector sortedRemnantClusters(remnantClusters.begin(), remnantClusters.end());
     std::sort(sortedRemnantClusters.begin(), sortedRemnantClusters.end(), LArClusterHelper::SortByNHits);
 
+    ClusterExtentVector remnantClusterExtents;
+    this->GetClusterExtents(sortedRemnantClusters, remnantClusterExtents);
+
     for (const Cluster *const pPfoCluster : sortedPfoClusters)
     {
         CaloHitList clusterHitList;
@@ -51,9 +54,16 @@ void BoundedClusterMopUpAlgorithm::ClusterMopUp(const ClusterList &pfoClusters,
             ShowerPositionMap showerPositionMap;
             const XSampling xSampling(fitResult.GetShowerFitResult());
             this->GetShowerPositionMap(fitResult, xSampling, showerPositionMap);
-            for (const Cluster *const pRemnantCluster : sortedRemnantClusters)
+
+            ShowerExtentTable showerExtentTable;
+            ClusterExtent showerExtent;
+            this->GetShowerExtentTable(xSampling, showerPositionMap, showerExtentTable, showerExtent);
+
+            for (unsigned int iRemnant = 0; iRemnant < sortedRemnantClusters.size(); ++iRemnant)
             {
-                const float boundedFraction(this->GetBoundedFraction(pRemnantCluster, xSampling, showerPositionMap));
+                const Cluster *const pRemnantCluster(sortedRemnantClusters.at(iRemnant));
+                const float boundedFraction(this->GetBoundedFraction(
+                    pRemnantCluster, remnantClusterExtents.at(iRemnant), xSampling, showerExtentTable, showerExtent));
 
                 if (boundedFraction < m_minBoundedFraction)
                     continue;
@@ -79,12 +89,21 @@ void BoundedClusterMopUpAlgorithm::ClusterMopUp(const ClusterList &pfoClusters,
 void BoundedClusterMopUpAlgorithm::GetShowerPositionMap(
     const TwoDSlidingShowerFitResult &fitResult, const XSampling &xSampling, ShowerPositionMap &showerPositionMap) const
 {
+    FloatVector xValues;
+
     for (int n = 0; n <= xSampling.m_nPoints; ++n)
     {
         const float x(xSampling.m_minX + (xSampling.m_maxX - xSampling.m_minX) * static_cast<float>(n) / static_cast<float>(xSampling.m_nPoints));
+        xValues.push_back(x);
+    }
+
+    std::vector<FloatVector> edgePositionsVector;
+    fitResult.GetShowerEdges(xValues, false, edgePositionsVector);
 
-        FloatVector edgePositions;
-        fitResult.GetShowerEdges(x, false, edgePositions);
+    for (unsigned int iValue = 0; iValue < xValues.size(); ++iValue)
+    {
+        const float x(xValues.at(iValue));
+        FloatVector &edgePositions(edgePositionsVector.at(iValue));
 
         if (edgePositions.size() < 2)
             continue;
@@ -104,14 +123,42 @@ void BoundedClusterMopUpAlgorithm::GetShowerPositionMap(
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-float BoundedClusterMopUpAlgorithm::GetBoundedFraction(
-    const Cluster *const pCluster, const XSampling &xSampling, const ShowerPositionMap &showerPositionMap) const
+void BoundedClusterMopUpAlgorithm::GetShowerExtentTable(const XSampling &xSampling, const ShowerPositionMap &showerPositionMap,
+    ShowerExtentTable &showerExtentTable, ClusterExtent &showerExtent) const
+{
+    showerExtentTable.clear();
+    showerExtent = ClusterExtent();
+
+    if (showerPositionMap.empty())
+        return;
+
+    // ATTN The shower position map keys are the non-negative bins of sampling positions lying within the sampling range
+    showerExtentTable.resize(showerPositionMap.rbegin()->first + 1, nullptr);
+    showerExtent.m_minX = xSampling.m_minX;
+    showerExtent.m_maxX = xSampling.m_maxX;
+
+    for (const ShowerPositionMap::value_type &mapEntry : showerPositionMap)
+    {
+        showerExtentTable.at(mapEntry.first) = &mapEntry.second;
+        showerExtent.m_minZ = std::min(showerExtent.m_minZ, mapEntry.second.GetLowEdgeZ());
+        showerExtent.m_maxZ = std::max(showerExtent.m_maxZ, mapEntry.second.GetHighEdgeZ());
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+float BoundedClusterMopUpAlgorithm::GetBoundedFraction(const Cluster *const pCluster, const ClusterExtent &clusterExtent,
+    const XSampling &xSampling, const ShowerExtentTable &showerExtentTable, const ClusterExtent &showerExtent) const
 {
     if (((xSampling.m_maxX - xSampling.m_minX) < std::numeric_limits<float>::epsilon()) || (0 >= xSampling.m_nPoints) || (0 == pCluster->GetNCaloHits()))
     {
         throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
     }
 
+    // ATTN A cluster lying clear of the shower has no bounded hits, the padding absorbs any rounding in the per-hit checks
+    if (!clusterExtent.IsOverlapping(showerExtent, 1.f))
+        return 0.f;
+
     unsigned int nMatchedHits(0);
     const OrderedCaloHitList &orderedCaloHitList(pCluster->GetOrderedCaloHitList());
 
@@ -123,18 +170,18 @@ float BoundedClusterMopUpAlgorithm::GetBoundedFraction(
             const float x(pCaloHit->GetPositionVector().GetX());
             const float z(pCaloHit->GetPositionVector().GetZ());
 
-            try
-            {
-                const int xBin(xSampling.GetBin(x));
+            if (!xSampling.IsInRange(x))
+                continue;
 
-                ShowerPositionMap::const_iterator positionIter = showerPositionMap.find(xBin);
+            const int xBin(xSampling.GetBin(x));
 
-                if ((showerPositionMap.end() != positionIter) && (z > positionIter->second.GetLowEdgeZ()) && (z < positionIter->second.GetHighEdgeZ()))
-                    ++nMatchedHits;
-            }
-            catch (StatusCodeException &)
-            {
-            }
+            if ((xBin < 0) || (xBin >= static_cast<int>(showerExtentTable.size())))
+                continue;
+
+            const ShowerExtent *const pShowerExtent(showerExtentTable[xBin]);
+
+            if (pShowerExtent && (z > pShowerExtent->GetLowEdgeZ()) && (z < pShowerExtent->GetHighEdgeZ()))
+                ++nMatchedHits;
         }
     }
 
@@ -156,9 +203,16 @@ BoundedClusterMopUpAlgorithm::XSampling::XSampling(const TwoDSlidingFitResult &f
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+bool BoundedClusterMopUpAlgorithm::XSampling::IsInRange(const float x) const
+{
+    return (((x - m_minX) >= -std::numeric_limits<float>::epsilon()) && ((x - m_maxX) <= +std::numeric_limits<float>::epsilon()));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 int BoundedClusterMopUpAlgorithm::XSampling::GetBin(const float x) const
 {
-    if (((x - m_minX) < -std::numeric_limits<float>::epsilon()) || ((x - m_maxX) > +std::numeric_limits<float>::epsilon()))
+    if (!this->IsInRange(x))
         throw StatusCodeException(STATUS_CODE_NOT_FOUND);
 
     return static_cast<int>(0.5f + static_cast<float>(m_nPoints) * (x - m_minX) / (m_maxX - m_minX));
@@ -14,6 +14,8 @@
 
 #include "larpandoracontent/LArTwoDReco/LArClusterMopUp/ClusterMopUpBaseAlgorithm.h"
 
+#include <vector>
+
 namespace lar_content
 {
 
@@ -43,6 +45,15 @@ private:
          */
         XSampling(const TwoDSlidingFitResult &fitResult);
 
+        /**
+         *  @brief  Whether an x position lies within the sampling range
+         *
+         *  @param  x  the input x coordinate
+         *
+         *  @return boolean
+         */
+        bool IsInRange(const float x) const;
+
         /**
          *  @brief  Convert an x position into a sampling bin
          *
@@ -55,6 +66,8 @@ private:
         int m_nPoints; ///< The number of sampling points to be used
     };
 
+    typedef std::vector<const ShowerExtent *> ShowerExtentTable;
+
     void ClusterMopUp(const pandora::ClusterList &pfoClusters, const pandora::ClusterList &remnantClusters) const;
 
     /**
@@ -67,15 +80,29 @@ private:
     void GetShowerPositionMap(const TwoDSlidingShowerFitResult &fitResult, const XSampling &xSampling, ShowerPositionMap &showerPositionMap) const;
 
     /**
-     *  @brief  Get the fraction of hits in a cluster bounded by a specified shower position map
+     *  @brief  Get the shower extent table, holding the shower position map entries indexed by x bin, and the overall shower extent
      *
-     *  @param  pCluster address of the cluster
      *  @param  xSampling the x sampling details
      *  @param  showerPositionMap the shower position map
+     *  @param  showerExtentTable to receive the shower extent table
+     *  @param  showerExtent to receive the overall shower extent
+     */
+    void GetShowerExtentTable(const XSampling &xSampling, const ShowerPositionMap &showerPositionMap, ShowerExtentTable &showerExtentTable,
+        ClusterExtent &showerExtent) const;
+
+    /**
+     *  @brief  Get the fraction of hits in a cluster bounded by a specified shower extent table
+     *
+     *  @param  pCluster address of the cluster
+     *  @param  clusterExtent the extent of the hits in the cluster
+     *  @param  xSampling the x sampling details
+     *  @param  showerExtentTable the shower extent table
+     *  @param  showerExtent the overall shower extent
      *
      *  @return the fraction of bounded hits
      */
-    float GetBoundedFraction(const pandora::Cluster *const pCluster, const XSampling &xSampling, const ShowerPositionMap &showerPositionMap) const;
+    float GetBoundedFraction(const pandora::Cluster *const pCluster, const ClusterExtent &clusterExtent, const XSampling &xSampling,
+        const ShowerExtentTable &showerExtentTable, const ClusterExtent &showerExtent) const;
 
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
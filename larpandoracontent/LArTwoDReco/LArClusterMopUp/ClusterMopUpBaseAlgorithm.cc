@@ -140,6 +140,25 @@ void ClusterMopUpBaseAlgorithm::MakeClusterMerges(const ClusterAssociationMap &c
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void ClusterMopUpBaseAlgorithm::GetClusterExtents(const ClusterVector &clusterVector, ClusterExtentVector &clusterExtents) const
+{
+    clusterExtents.clear();
+    clusterExtents.reserve(clusterVector.size());
+
+    for (const Cluster *const pCluster : clusterVector)
+    {
+        CartesianVector minimumCoordinate(0.f, 0.f, 0.f), maximumCoordinate(0.f, 0.f, 0.f);
+        LArClusterHelper::GetClusterBoundingBox(pCluster, minimumCoordinate, maximumCoordinate);
+
+        ClusterExtent clusterExtent;
+        clusterExtent.Include(minimumCoordinate);
+        clusterExtent.Include(maximumCoordinate);
+        clusterExtents.push_back(clusterExtent);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode ClusterMopUpBaseAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
 {
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadVectorOfValues(xmlHandle, "PfoListNames", m_pfoListNames));
@@ -150,4 +169,15 @@ StatusCode ClusterMopUpBaseAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
     return MopUpBaseAlgorithm::ReadSettings(xmlHandle);
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+ClusterMopUpBaseAlgorithm::ClusterExtent::ClusterExtent() :
+    m_minX(std::numeric_limits<float>::max()),
+    m_maxX(-std::numeric_limits<float>::max()),
+    m_minZ(std::numeric_limits<float>::max()),
+    m_maxZ(-std::numeric_limits<float>::max())
+{
+}
+
 } // namespace lar_content
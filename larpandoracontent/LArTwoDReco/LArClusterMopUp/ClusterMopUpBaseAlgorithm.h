@@ -10,7 +10,9 @@
 
 #include "larpandoracontent/LArUtility/MopUpBaseAlgorithm.h"
 
+#include <algorithm>
 #include <unordered_map>
+#include <vector>
 
 namespace lar_content
 {
@@ -71,6 +73,50 @@ protected:
     typedef std::unordered_map<const pandora::Cluster *, float> AssociationDetails;
     typedef std::unordered_map<const pandora::Cluster *, AssociationDetails> ClusterAssociationMap;
 
+    /**
+     *  @brief  ClusterExtent class, the extent in x and z of the hits in a cluster, or of a region
+     */
+    class ClusterExtent
+    {
+    public:
+        /**
+         *  @brief  Default constructor, for an empty extent
+         */
+        ClusterExtent();
+
+        /**
+         *  @brief  Extend to include a given position
+         *
+         *  @param  position the position
+         */
+        void Include(const pandora::CartesianVector &position);
+
+        /**
+         *  @brief  Whether the extent overlaps another extent, once padded by a given tolerance
+         *
+         *  @param  other the other extent
+         *  @param  tolerance the tolerance
+         *
+         *  @return boolean
+         */
+        bool IsOverlapping(const ClusterExtent &other, const float tolerance) const;
+
+        float m_minX; ///< The min x value
+        float m_maxX; ///< The max x value
+        float m_minZ; ///< The min z value
+        float m_maxZ; ///< The max z value
+    };
+
+    typedef std::vector<ClusterExtent> ClusterExtentVector;
+
+    /**
+     *  @brief  Get the extents of the hits in each of a vector of clusters
+     *
+     *  @param  clusterVector the cluster vector
+     *  @param  clusterExtents to receive the cluster extents, in cluster vector order
+     */
+    void GetClusterExtents(const pandora::ClusterVector &clusterVector, ClusterExtentVector &clusterExtents) const;
+
     /**
      *  @brief  Make the cluster merges specified in the cluster association map, using list name information in the cluster list name map
      *
@@ -84,6 +130,24 @@ protected:
     bool m_excludePfosContainingTracks;   ///< Whether to exclude any pfos containing clusters flagged as fixed tracks
 };
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline void ClusterMopUpBaseAlgorithm::ClusterExtent::Include(const pandora::CartesianVector &position)
+{
+    m_minX = std::min(m_minX, position.GetX());
+    m_maxX = std::max(m_maxX, position.GetX());
+    m_minZ = std::min(m_minZ, position.GetZ());
+    m_maxZ = std::max(m_maxZ, position.GetZ());
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline bool ClusterMopUpBaseAlgorithm::ClusterExtent::IsOverlapping(const ClusterExtent &other, const float tolerance) const
+{
+    return ((m_minX < other.m_maxX + tolerance) && (other.m_minX < m_maxX + tolerance) && (m_minZ < other.m_maxZ + tolerance) &&
+        (other.m_minZ < m_maxZ + tolerance));
+}
+
 } // namespace lar_content
 
 #endif // #ifndef LAR_CLUSTER_MOP_UP_BASE_ALGORITHM_H
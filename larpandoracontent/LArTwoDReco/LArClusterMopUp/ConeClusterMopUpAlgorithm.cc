@@ -50,6 +50,9 @@ void ConeClusterMopUpAlgorithm::ClusterMopUp(const ClusterList &pfoClusters, con
     ClusterVector sortedRemnantClusters(remnantClusters.begin(), remnantClusters.end());
     std::sort(sortedRemnantClusters.begin(), sortedRemnantClusters.end(), LArClusterHelper::SortByNHits);
 
+    ClusterExtentVector remnantClusterExtents;
+    this->GetClusterExtents(sortedRemnantClusters, remnantClusterExtents);
+
     for (const Cluster *const pPfoCluster : sortedPfoClusters)
     {
         try
@@ -114,9 +117,30 @@ void ConeClusterMopUpAlgorithm::ClusterMopUp(const ClusterList &pfoClusters, con
                 continue;
             }
 
+            // Cone extent, the cone being contained within the quadrilateral bounded by its edges at the min and max longitudinal positions
+            ClusterExtent coneExtent;
+
+            for (const float rL : {minL, maxL})
+            {
+                const float rTP(minP.second + (rL - minP.first) * ((maxP.second - minP.second) / (maxP.first - minP.first)));
+                const float rTN(minN.second + (rL - minN.first) * ((maxN.second - minN.second) / (maxN.first - minN.first)));
+
+                CartesianVector positionP(0.f, 0.f, 0.f), positionN(0.f, 0.f, 0.f);
+                showerFitResult.GetShowerFitResult().GetGlobalPosition(rL, rTP, positionP);
+                showerFitResult.GetShowerFitResult().GetGlobalPosition(rL, rTN, positionN);
+                coneExtent.Include(positionP);
+                coneExtent.Include(positionN);
+            }
+
             // Bounded fraction calculation
-            for (const Cluster *const pRemnantCluster : sortedRemnantClusters)
+            for (unsigned int iRemnant = 0; iRemnant < sortedRemnantClusters.size(); ++iRemnant)
             {
+                const Cluster *const pRemnantCluster(sortedRemnantClusters.at(iRemnant));
+
+                // ATTN A cluster lying clear of the cone has no bounded hits, the padding absorbs any rounding in the per-hit checks
+                if ((0.f < m_minBoundedFraction) && !remnantClusterExtents.at(iRemnant).IsOverlapping(coneExtent, 1.f))
+                    continue;
+
                 const unsigned int nHits(pRemnantCluster->GetNCaloHits());
 
                 unsigned int nMatchedHits(0);
@@ -77,17 +77,23 @@ void IsolatedClusterMopUpAlgorithm::DissolveClustersToHits(const ClusterList &cl
 void IsolatedClusterMopUpAlgorithm::GetCaloHitToClusterMap(
     const CaloHitList &caloHitList, const ClusterList &clusterList, CaloHitToClusterMap &caloHitToClusterMap) const
 {
+    // ATTN The host cluster hits change between mop up passes, so the index is built only when there are newly available hits to place
+    if (caloHitList.empty())
+        return;
+
     CaloHitList allCaloHits;
     CaloHitToClusterMap hitToParentClusterMap;
 
     for (const Cluster *const pCluster : clusterList)
     {
-        CaloHitList daughterHits;
-        pCluster->GetOrderedCaloHitList().FillCaloHitList(daughterHits);
-        allCaloHits.insert(allCaloHits.end(), daughterHits.begin(), daughterHits.end());
-
-        for (const CaloHit *const pCaloHit : daughterHits)
-            (void)hitToParentClusterMap.insert(CaloHitToClusterMap::value_type(pCaloHit, pCluster));
+        for (const OrderedCaloHitList::value_type &layerEntry : pCluster->GetOrderedCaloHitList())
+        {
+            for (const CaloHit *const pCaloHit : *layerEntry.second)
+            {
+                allCaloHits.push_back(pCaloHit);
+                (void)hitToParentClusterMap.insert(CaloHitToClusterMap::value_type(pCaloHit, pCluster));
+            }
+        }
     }
 
     HitKDTree2D kdTree;
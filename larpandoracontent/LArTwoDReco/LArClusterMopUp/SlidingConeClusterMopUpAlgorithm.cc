@@ -173,21 +173,41 @@ void SlidingConeClusterMopUpAlgorithm::GetClusterMergeMap(const Vertex *const pV
             continue;
         }
 
+        // ATTN The projected cones depend only on the view, so are built once per view and tested against each cluster as a batch
+        std::map<HitType, SimpleConeBatch> coneBatchMap2D;
+
         for (const Cluster *const pNearbyCluster2D : availableClusters2D)
         {
             ClusterMerge bestClusterMerge(nullptr, 0.f, 0.f);
             const HitType hitType(LArClusterHelper::GetClusterHitType(pNearbyCluster2D));
+            std::map<HitType, SimpleConeBatch>::const_iterator batchIter(coneBatchMap2D.find(hitType));
+
+            if (coneBatchMap2D.end() == batchIter)
+            {
+                SimpleConeList simpleConeList2D;
+
+                for (const SimpleCone &simpleCone3D : simpleConeList3D)
+                {
+                    const CartesianVector coneBaseCentre3D(simpleCone3D.GetConeApex() + simpleCone3D.GetConeDirection() * coneLength3D);
+                    const CartesianVector coneApex2D(
+                        LArGeometryHelper::ProjectPosition(this->GetPandora(), simpleCone3D.GetConeApex(), hitType));
+                    const CartesianVector coneBaseCentre2D(
+                        LArGeometryHelper::ProjectPosition(this->GetPandora(), coneBaseCentre3D, hitType));
+
+                    const CartesianVector apexToBase2D(coneBaseCentre2D - coneApex2D);
+                    simpleConeList2D.emplace_back(
+                        coneApex2D, apexToBase2D.GetUnitVector(), apexToBase2D.GetMagnitude(), m_coneTanHalfAngle);
+                }
+
+                batchIter = coneBatchMap2D.emplace(hitType, SimpleConeBatch(simpleConeList2D)).first;
+            }
+
+            FloatVector boundedFractions, meanRTs;
+            batchIter->second.GetBoundedHitFractionsAndMeanRTs(pNearbyCluster2D, boundedFractions, meanRTs);
 
-            for (const SimpleCone &simpleCone3D : simpleConeList3D)
+            for (unsigned int iCone = 0; iCone < boundedFractions.size(); ++iCone)
             {
-                const CartesianVector coneBaseCentre3D(simpleCone3D.GetConeApex() + simpleCone3D.GetConeDirection() * coneLength3D);
-                const CartesianVector coneApex2D(LArGeometryHelper::ProjectPosition(this->GetPandora(), simpleCone3D.GetConeApex(), hitType));
-                const CartesianVector coneBaseCentre2D(LArGeometryHelper::ProjectPosition(this->GetPandora(), coneBaseCentre3D, hitType));
-
-                const CartesianVector apexToBase2D(coneBaseCentre2D - coneApex2D);
-                const SimpleCone simpleCone2D(coneApex2D, apexToBase2D.GetUnitVector(), apexToBase2D.GetMagnitude(), m_coneTanHalfAngle);
-                const ClusterMerge clusterMerge(
-                    pShowerCluster, simpleCone2D.GetBoundedHitFraction(pNearbyCluster2D), simpleCone2D.GetMeanRT(pNearbyCluster2D));
+                const ClusterMerge clusterMerge(pShowerCluster, boundedFractions[iCone], meanRTs[iCone]);
 
                 if (clusterMerge < bestClusterMerge)
                     bestClusterMerge = clusterMerge;
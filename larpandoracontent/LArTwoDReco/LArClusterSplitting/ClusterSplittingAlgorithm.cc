@@ -9,6 +9,7 @@
 #include "Pandora/AlgorithmHeaders.h"
 
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
+#include "larpandoracontent/LArHelpers/LArParallelHelper.h"
 
 #include "larpandoracontent/LArTwoDReco/LArClusterSplitting/ClusterSplittingAlgorithm.h"
 
@@ -17,6 +18,12 @@ using namespace pandora;
 namespace lar_content
 {
 
+ClusterSplittingAlgorithm::ClusterSplittingAlgorithm() : m_nSplittingThreads(1)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode ClusterSplittingAlgorithm::Run()
 {
     if (m_inputClusterListNames.empty())
@@ -57,12 +64,25 @@ StatusCode ClusterSplittingAlgorithm::RunUsingCurrentList() const
     ClusterList internalClusterList(pClusterList->begin(), pClusterList->end());
     internalClusterList.sort(LArClusterHelper::SortByNHits);
 
-    for (ClusterList::iterator iter = internalClusterList.begin(); iter != internalClusterList.end(); ++iter)
+    // ATTN Dividing the hits in an input cluster depends only on that cluster, so the input clusters can be divided up front, in
+    // parallel, with the splits then made in the original order. Fragments appended to the list are divided as they are reached.
+    ClusterDivisionVector clusterDivisions;
+
+    if (1 != m_nSplittingThreads)
+        this->DivideClusters(internalClusterList, clusterDivisions);
+
+    unsigned int clusterIndex(0);
+
+    for (ClusterList::iterator iter = internalClusterList.begin(); iter != internalClusterList.end(); ++iter, ++clusterIndex)
     {
         const Cluster *const pCluster = *iter;
         ClusterList clusterSplittingList;
 
-        if (STATUS_CODE_SUCCESS != this->SplitCluster(pCluster, clusterSplittingList))
+        const StatusCode statusCode(clusterIndex < clusterDivisions.size()
+                ? this->SplitCluster(pCluster, clusterDivisions.at(clusterIndex), clusterSplittingList)
+                : this->SplitCluster(pCluster, clusterSplittingList));
+
+        if (STATUS_CODE_SUCCESS != statusCode)
             continue;
 
         internalClusterList.splice(internalClusterList.end(), clusterSplittingList);
@@ -74,14 +94,63 @@ StatusCode ClusterSplittingAlgorithm::RunUsingCurrentList() const
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void ClusterSplittingAlgorithm::DivideClusters(const ClusterList &clusterList, ClusterDivisionVector &clusterDivisions) const
+{
+    const ClusterVector clusterVector(clusterList.begin(), clusterList.end());
+    clusterDivisions.assign(clusterVector.size(), ClusterDivision());
+
+    // ATTN Exceptions are recorded, to be rethrown when the split for the cluster would have been attempted
+    LArParallelHelper::ForEach(clusterVector.size(), m_nSplittingThreads, [&](const unsigned int index) {
+        ClusterDivision &clusterDivision(clusterDivisions.at(index));
+
+        try
+        {
+            clusterDivision.m_statusCode =
+                this->DivideCaloHits(clusterVector.at(index), clusterDivision.m_firstCaloHitList, clusterDivision.m_secondCaloHitList);
+        }
+        catch (...)
+        {
+            clusterDivision.m_pException = std::current_exception();
+        }
+    });
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode ClusterSplittingAlgorithm::SplitCluster(const Cluster *const pCluster, ClusterList &clusterSplittingList) const
 {
     // Split cluster into two CaloHit lists
-    PandoraContentApi::Cluster::Parameters firstParameters, secondParameters;
+    CaloHitList firstCaloHitList, secondCaloHitList;
 
-    if (STATUS_CODE_SUCCESS != this->DivideCaloHits(pCluster, firstParameters.m_caloHitList, secondParameters.m_caloHitList))
+    if (STATUS_CODE_SUCCESS != this->DivideCaloHits(pCluster, firstCaloHitList, secondCaloHitList))
         return STATUS_CODE_NOT_FOUND;
 
+    return this->SplitCluster(pCluster, firstCaloHitList, secondCaloHitList, clusterSplittingList);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ClusterSplittingAlgorithm::SplitCluster(
+    const Cluster *const pCluster, ClusterDivision &clusterDivision, ClusterList &clusterSplittingList) const
+{
+    if (clusterDivision.m_pException)
+        std::rethrow_exception(clusterDivision.m_pException);
+
+    if (STATUS_CODE_SUCCESS != clusterDivision.m_statusCode)
+        return STATUS_CODE_NOT_FOUND;
+
+    return this->SplitCluster(pCluster, clusterDivision.m_firstCaloHitList, clusterDivision.m_secondCaloHitList, clusterSplittingList);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ClusterSplittingAlgorithm::SplitCluster(
+    const Cluster *const pCluster, CaloHitList &firstCaloHitList, CaloHitList &secondCaloHitList, ClusterList &clusterSplittingList) const
+{
+    PandoraContentApi::Cluster::Parameters firstParameters, secondParameters;
+    firstParameters.m_caloHitList.swap(firstCaloHitList);
+    secondParameters.m_caloHitList.swap(secondCaloHitList);
+
     if (firstParameters.m_caloHitList.empty() || secondParameters.m_caloHitList.empty())
         return STATUS_CODE_NOT_ALLOWED;
 
@@ -108,11 +177,20 @@ StatusCode ClusterSplittingAlgorithm::SplitCluster(const Cluster *const pCluster
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+ClusterSplittingAlgorithm::ClusterDivision::ClusterDivision() : m_statusCode(STATUS_CODE_NOT_FOUND)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode ClusterSplittingAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
 {
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
         XmlHelper::ReadVectorOfValues(xmlHandle, "InputClusterListNames", m_inputClusterListNames));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "NSplittingThreads", m_nSplittingThreads));
+
     return STATUS_CODE_SUCCESS;
 }
 
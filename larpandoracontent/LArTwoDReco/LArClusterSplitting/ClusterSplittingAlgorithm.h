@@ -10,7 +10,9 @@
 
 #include "Pandora/Algorithm.h"
 
+#include <exception>
 #include <list>
+#include <vector>
 
 namespace lar_content
 {
@@ -20,6 +22,12 @@ namespace lar_content
  */
 class ClusterSplittingAlgorithm : public pandora::Algorithm
 {
+public:
+    /**
+     *  @brief  Default constructor
+     */
+    ClusterSplittingAlgorithm();
+
 protected:
     virtual pandora::StatusCode Run();
     virtual pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
@@ -30,7 +38,8 @@ protected:
     pandora::StatusCode RunUsingCurrentList() const;
 
     /**
-     *  @brief  Divide calo hits in a cluster into two lists, each associated with a separate fragment cluster
+     *  @brief  Divide calo hits in a cluster into two lists, each associated with a separate fragment cluster. ATTN May be called on
+     *          worker threads, so must not access the content api: any lists required should be read in Run, on the calling thread
      *
      *  @param  pCluster address of the cluster
      *  @param  firstCaloHitList the hits in the first fragment
@@ -40,6 +49,33 @@ protected:
         const pandora::Cluster *const pCluster, pandora::CaloHitList &firstCaloHitList, pandora::CaloHitList &secondCaloHitList) const = 0;
 
 private:
+    /**
+     *  @brief  ClusterDivision class, the outcome of dividing the calo hits in a cluster
+     */
+    class ClusterDivision
+    {
+    public:
+        /**
+         *  @brief  Default constructor
+         */
+        ClusterDivision();
+
+        pandora::StatusCode m_statusCode;         ///< The status code returned by DivideCaloHits
+        pandora::CaloHitList m_firstCaloHitList;  ///< The hits in the first fragment
+        pandora::CaloHitList m_secondCaloHitList; ///< The hits in the second fragment
+        std::exception_ptr m_pException;          ///< The exception thrown by DivideCaloHits, if any
+    };
+
+    typedef std::vector<ClusterDivision> ClusterDivisionVector;
+
+    /**
+     *  @brief  Divide the calo hits in each of a list of clusters, sharing the clusters between a number of threads
+     *
+     *  @param  clusterList the list of clusters
+     *  @param  clusterDivisions to receive the cluster divisions, in cluster list order
+     */
+    void DivideClusters(const pandora::ClusterList &clusterList, ClusterDivisionVector &clusterDivisions) const;
+
     /**
      *  @brief  Split cluster into two fragments
      *
@@ -48,7 +84,29 @@ private:
      */
     pandora::StatusCode SplitCluster(const pandora::Cluster *const pCluster, pandora::ClusterList &clusterSplittingList) const;
 
+    /**
+     *  @brief  Split cluster into two fragments, as previously determined by DivideClusters
+     *
+     *  @param  pCluster address of the cluster
+     *  @param  clusterDivision the cluster division, the calo hit lists of which are consumed
+     *  @param  clusterSplittingList to receive the two cluster fragments
+     */
+    pandora::StatusCode SplitCluster(
+        const pandora::Cluster *const pCluster, ClusterDivision &clusterDivision, pandora::ClusterList &clusterSplittingList) const;
+
+    /**
+     *  @brief  Split cluster into two fragments with the given calo hits
+     *
+     *  @param  pCluster address of the cluster
+     *  @param  firstCaloHitList the hits in the first fragment, which are consumed
+     *  @param  secondCaloHitList the hits in the second fragment, which are consumed
+     *  @param  clusterSplittingList to receive the two cluster fragments
+     */
+    pandora::StatusCode SplitCluster(const pandora::Cluster *const pCluster, pandora::CaloHitList &firstCaloHitList,
+        pandora::CaloHitList &secondCaloHitList, pandora::ClusterList &clusterSplittingList) const;
+
     pandora::StringVector m_inputClusterListNames; ///< The list of input cluster list names - if empty, use the current cluster list
+    unsigned int m_nSplittingThreads;              ///< The number of threads with which to divide the input clusters (zero for all)
 };
 
 } // namespace lar_content
@@ -15,6 +15,8 @@
 
 #include "larpandoracontent/LArUtility/KDTreeLinkerAlgoT.h"
 
+#include <algorithm>
+
 using namespace pandora;
 
 namespace lar_content
@@ -250,27 +252,84 @@ void CrossedTrackSplittingAlgorithm::FindCandidateSplitPositions(
     std::sort(caloHitVector1.begin(), caloHitVector1.end(), LArClusterHelper::SortHitsByPosition);
     std::sort(caloHitVector2.begin(), caloHitVector2.end(), LArClusterHelper::SortHitsByPosition);
 
+    IndexedHitVector indexedHitVector1, indexedHitVector2;
+    this->GetIndexedHits(pCluster1, indexedHitVector1);
+    this->GetIndexedHits(pCluster2, indexedHitVector2);
+
     for (const CaloHit *const pCaloHit : caloHitVector1)
     {
         const CartesianVector position1(pCaloHit->GetPositionVector());
-        const CartesianVector position2(LArClusterHelper::GetClosestPosition(position1, pCluster2));
+        CartesianVector position2(0.f, 0.f, 0.f);
 
-        if ((position1 - position2).GetMagnitudeSquared() < m_maxClusterSeparationSquared)
+        if (this->GetClosestPosition(position1, indexedHitVector2, position2))
             candidateVector.push_back((position1 + position2) * 0.5);
     }
 
     for (const CaloHit *const pCaloHit : caloHitVector2)
     {
         const CartesianVector position2(pCaloHit->GetPositionVector());
-        const CartesianVector position1(LArClusterHelper::GetClosestPosition(position2, pCluster1));
+        CartesianVector position1(0.f, 0.f, 0.f);
 
-        if ((position2 - position1).GetMagnitudeSquared() < m_maxClusterSeparationSquared)
+        if (this->GetClosestPosition(position2, indexedHitVector1, position1))
             candidateVector.push_back((position2 + position1) * 0.5);
     }
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void CrossedTrackSplittingAlgorithm::GetIndexedHits(const Cluster *const pCluster, IndexedHitVector &indexedHitVector) const
+{
+    unsigned int hitIndex(0);
+
+    for (const OrderedCaloHitList::value_type &layerEntry : pCluster->GetOrderedCaloHitList())
+    {
+        for (const CaloHit *const pCaloHit : *layerEntry.second)
+            indexedHitVector.emplace_back(pCaloHit, hitIndex++);
+    }
+
+    std::sort(indexedHitVector.begin(), indexedHitVector.end(), [](const IndexedHit &lhs, const IndexedHit &rhs) {
+        const float lhsX(lhs.first->GetPositionVector().GetX()), rhsX(rhs.first->GetPositionVector().GetX());
+        return ((lhsX < rhsX) || (!(rhsX < lhsX) && (lhs.second < rhs.second)));
+    });
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool CrossedTrackSplittingAlgorithm::GetClosestPosition(
+    const CartesianVector &position, const IndexedHitVector &indexedHitVector, CartesianVector &closestPosition) const
+{
+    // ATTN Only hits within the max separation in x can be accepted, with ties resolved by ordered calo hit list position as for the
+    // cluster helper. The search window is padded to absorb rounding.
+    const float searchDistance(m_maxClusterSeparation + 0.01f);
+    const float minX(position.GetX() - searchDistance), maxX(position.GetX() + searchDistance);
+
+    IndexedHitVector::const_iterator iter(std::lower_bound(indexedHitVector.begin(), indexedHitVector.end(), minX,
+        [](const IndexedHit &indexedHit, const float x) { return (indexedHit.first->GetPositionVector().GetX() < x); }));
+
+    const IndexedHit *pClosestIndexedHit(nullptr);
+    float closestDistanceSquared(std::numeric_limits<float>::max());
+
+    for (; (iter != indexedHitVector.end()) && (iter->first->GetPositionVector().GetX() <= maxX); ++iter)
+    {
+        const float distanceSquared((iter->first->GetPositionVector() - position).GetMagnitudeSquared());
+
+        if ((distanceSquared < closestDistanceSquared) ||
+            ((distanceSquared == closestDistanceSquared) && pClosestIndexedHit && (iter->second < pClosestIndexedHit->second)))
+        {
+            closestDistanceSquared = distanceSquared;
+            pClosestIndexedHit = &(*iter);
+        }
+    }
+
+    if (!pClosestIndexedHit || !(closestDistanceSquared < m_maxClusterSeparationSquared))
+        return false;
+
+    closestPosition = pClosestIndexedHit->first->GetPositionVector();
+    return true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode CrossedTrackSplittingAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
 {
     PANDORA_RETURN_RESULT_IF_AND_IF(
@@ -40,6 +40,8 @@ private:
 
     typedef std::unordered_map<const pandora::Cluster *, pandora::ClusterSet> ClusterToClustersMap;
     typedef std::unordered_map<const pandora::CaloHit *, const pandora::Cluster *> HitToClusterMap;
+    typedef std::pair<const pandora::CaloHit *, unsigned int> IndexedHit;
+    typedef std::vector<IndexedHit> IndexedHitVector;
 
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
     pandora::StatusCode PreparationStep(const pandora::ClusterVector &clusterVector);
@@ -57,6 +59,26 @@ private:
     void FindCandidateSplitPositions(const pandora::Cluster *const pCluster1, const pandora::Cluster *const pCluster2,
         pandora::CartesianPointVector &candidateVector) const;
 
+    /**
+     *  @brief  Get the hits in a cluster, each with its position in the cluster ordered calo hit list, sorted by x coordinate
+     *
+     *  @param  pCluster the cluster
+     *  @param  indexedHitVector to receive the indexed hits
+     */
+    void GetIndexedHits(const pandora::Cluster *const pCluster, IndexedHitVector &indexedHitVector) const;
+
+    /**
+     *  @brief  Get the closest hit position to a given position, as for LArClusterHelper::GetClosestPosition, if within the max separation
+     *
+     *  @param  position the position
+     *  @param  indexedHitVector the indexed hits of the cluster, sorted by x coordinate
+     *  @param  closestPosition to receive the closest hit position
+     *
+     *  @return whether the closest hit position lies within the max cluster separation
+     */
+    bool GetClosestPosition(const pandora::CartesianVector &position, const IndexedHitVector &indexedHitVector,
+        pandora::CartesianVector &closestPosition) const;
+
     float m_maxClusterSeparation;        ///< maximum separation of two clusters
     float m_maxClusterSeparationSquared; ///< maximum separation of two clusters (squared)
     float m_minCosRelativeAngle;         ///< maximum relative angle between tracks after un-crossing
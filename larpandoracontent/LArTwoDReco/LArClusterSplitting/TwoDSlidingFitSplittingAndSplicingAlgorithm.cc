@@ -9,6 +9,7 @@
 #include "Pandora/AlgorithmHeaders.h"
 
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
+#include "larpandoracontent/LArHelpers/LArParallelHelper.h"
 #include "larpandoracontent/LArHelpers/LArPointingClusterHelper.h"
 
 #include "larpandoracontent/LArTwoDReco/LArClusterSplitting/TwoDSlidingFitSplittingAndSplicingAlgorithm.h"
@@ -23,7 +24,8 @@ TwoDSlidingFitSplittingAndSplicingAlgorithm::TwoDSlidingFitSplittingAndSplicingA
     m_longHalfWindowLayers(20),
     m_minClusterLength(7.5f),
     m_vetoDisplacement(1.5f),
-    m_runCosmicMode(false)
+    m_runCosmicMode(false),
+    m_nPairThreads(1)
 {
 }
 
@@ -123,100 +125,119 @@ void TwoDSlidingFitSplittingAndSplicingAlgorithm::BuildClusterExtensionList(cons
     ClusterExtensionList &clusterExtensionList) const
 {
     // Loop over each possible pair of clusters
+    ClusterPairVector clusterPairs;
+
     for (ClusterVector::const_iterator iterI = clusterVector.begin(), iterEndI = clusterVector.end(); iterI != iterEndI; ++iterI)
     {
-        const Cluster *const pClusterI = *iterI;
-
         for (ClusterVector::const_iterator iterJ = iterI, iterEndJ = clusterVector.end(); iterJ != iterEndJ; ++iterJ)
         {
-            const Cluster *const pClusterJ = *iterJ;
+            if (*iterI != *iterJ)
+                clusterPairs.emplace_back(*iterI, *iterJ);
+        }
+    }
 
-            if (pClusterI == pClusterJ)
-                continue;
+    // ATTN Pairs are evaluated independently, using only the prebuilt sliding fits, so can be shared between threads. Candidate splits
+    // are then collected in the original pair order.
+    std::vector<ClusterExtensionList> pairExtensionLists(clusterPairs.size());
 
-            // Get the branch and replacement sliding fits for this pair of clusters
-            TwoDSlidingFitResultMap::const_iterator iterBranchI = branchSlidingFitResultMap.find(*iterI);
-            TwoDSlidingFitResultMap::const_iterator iterBranchJ = branchSlidingFitResultMap.find(*iterJ);
+    LArParallelHelper::ForEach(clusterPairs.size(), m_nPairThreads, [&](const unsigned int index) {
+        this->BuildClusterExtension(clusterPairs.at(index).first, clusterPairs.at(index).second, branchSlidingFitResultMap,
+            replacementSlidingFitResultMap, pairExtensionLists.at(index));
+    });
 
-            TwoDSlidingFitResultMap::const_iterator iterReplacementI = replacementSlidingFitResultMap.find(*iterI);
-            TwoDSlidingFitResultMap::const_iterator iterReplacementJ = replacementSlidingFitResultMap.find(*iterJ);
+    for (const ClusterExtensionList &pairExtensionList : pairExtensionLists)
+        clusterExtensionList.insert(clusterExtensionList.end(), pairExtensionList.begin(), pairExtensionList.end());
+}
 
-            if (branchSlidingFitResultMap.end() == iterBranchI || branchSlidingFitResultMap.end() == iterBranchJ ||
-                replacementSlidingFitResultMap.end() == iterReplacementI || replacementSlidingFitResultMap.end() == iterReplacementJ)
-            {
-                // TODO May want to raise an exception under certain conditions
-                continue;
-            }
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void TwoDSlidingFitSplittingAndSplicingAlgorithm::BuildClusterExtension(const Cluster *const pClusterI, const Cluster *const pClusterJ,
+    const TwoDSlidingFitResultMap &branchSlidingFitResultMap, const TwoDSlidingFitResultMap &replacementSlidingFitResultMap,
+    ClusterExtensionList &clusterExtensionList) const
+{
+    // Get the branch and replacement sliding fits for this pair of clusters
+    TwoDSlidingFitResultMap::const_iterator iterBranchI = branchSlidingFitResultMap.find(pClusterI);
+    TwoDSlidingFitResultMap::const_iterator iterBranchJ = branchSlidingFitResultMap.find(pClusterJ);
 
-            const TwoDSlidingFitResult &branchSlidingFitI(iterBranchI->second);
-            const TwoDSlidingFitResult &branchSlidingFitJ(iterBranchJ->second);
+    TwoDSlidingFitResultMap::const_iterator iterReplacementI = replacementSlidingFitResultMap.find(pClusterI);
+    TwoDSlidingFitResultMap::const_iterator iterReplacementJ = replacementSlidingFitResultMap.find(pClusterJ);
 
-            const TwoDSlidingFitResult &replacementSlidingFitI(iterReplacementI->second);
-            const TwoDSlidingFitResult &replacementSlidingFitJ(iterReplacementJ->second);
+    if (branchSlidingFitResultMap.end() == iterBranchI || branchSlidingFitResultMap.end() == iterBranchJ ||
+        replacementSlidingFitResultMap.end() == iterReplacementI || replacementSlidingFitResultMap.end() == iterReplacementJ)
+    {
+        // TODO May want to raise an exception under certain conditions
+        return;
+    }
 
-            // Search for a split in clusterI
-            float branchChisqI(0.f);
-            CartesianVector branchSplitPositionI(0.f, 0.f, 0.f);
-            CartesianVector branchSplitDirectionI(0.f, 0.f, 0.f);
-            CartesianVector replacementStartPositionJ(0.f, 0.f, 0.f);
+    const TwoDSlidingFitResult &branchSlidingFitI(iterBranchI->second);
+    const TwoDSlidingFitResult &branchSlidingFitJ(iterBranchJ->second);
 
-            try
-            {
-                this->FindBestSplitPosition(branchSlidingFitI, replacementSlidingFitJ, replacementStartPositionJ, branchSplitPositionI, branchSplitDirectionI);
-                branchChisqI = this->CalculateBranchChi2(pClusterI, branchSplitPositionI, branchSplitDirectionI);
-            }
-            catch (StatusCodeException &)
-            {
-            }
+    const TwoDSlidingFitResult &replacementSlidingFitI(iterReplacementI->second);
+    const TwoDSlidingFitResult &replacementSlidingFitJ(iterReplacementJ->second);
 
-            // Search for a split in clusterJ
-            float branchChisqJ(0.f);
-            CartesianVector branchSplitPositionJ(0.f, 0.f, 0.f);
-            CartesianVector branchSplitDirectionJ(0.f, 0.f, 0.f);
-            CartesianVector replacementStartPositionI(0.f, 0.f, 0.f);
+    // Search for a split in clusterI
+    float branchChisqI(0.f);
+    CartesianVector branchSplitPositionI(0.f, 0.f, 0.f);
+    CartesianVector branchSplitDirectionI(0.f, 0.f, 0.f);
+    CartesianVector replacementStartPositionJ(0.f, 0.f, 0.f);
 
+    try
+    {
+        this->FindBestSplitPosition(
+            branchSlidingFitI, replacementSlidingFitJ, replacementStartPositionJ, branchSplitPositionI, branchSplitDirectionI);
+        branchChisqI = this->CalculateBranchChi2(pClusterI, branchSplitPositionI, branchSplitDirectionI);
+    }
+    catch (StatusCodeException &)
+    {
+    }
+
+    // Search for a split in clusterJ
+    float branchChisqJ(0.f);
+    CartesianVector branchSplitPositionJ(0.f, 0.f, 0.f);
+    CartesianVector branchSplitDirectionJ(0.f, 0.f, 0.f);
+    CartesianVector replacementStartPositionI(0.f, 0.f, 0.f);
+
+    try
+    {
+        this->FindBestSplitPosition(
+            branchSlidingFitJ, replacementSlidingFitI, replacementStartPositionI, branchSplitPositionJ, branchSplitDirectionJ);
+        branchChisqJ = this->CalculateBranchChi2(pClusterJ, branchSplitPositionJ, branchSplitDirectionJ);
+    }
+    catch (StatusCodeException &)
+    {
+    }
+
+    // Re-calculate chi2 values if both clusters have a split
+    if (branchChisqI > 0.f && branchChisqJ > 0.f)
+    {
+        const CartesianVector relativeDirection((branchSplitPositionJ - branchSplitPositionI).GetUnitVector());
+
+        if (branchSplitDirectionI.GetDotProduct(relativeDirection) > 0.f && branchSplitDirectionJ.GetDotProduct(relativeDirection) < 0.f)
+        {
             try
             {
-                this->FindBestSplitPosition(branchSlidingFitJ, replacementSlidingFitI, replacementStartPositionI, branchSplitPositionJ, branchSplitDirectionJ);
-                branchChisqJ = this->CalculateBranchChi2(pClusterJ, branchSplitPositionJ, branchSplitDirectionJ);
+                const float newBranchChisqI(this->CalculateBranchChi2(pClusterI, branchSplitPositionI, relativeDirection));
+                const float newBranchChisqJ(this->CalculateBranchChi2(pClusterJ, branchSplitPositionJ, relativeDirection * -1.f));
+                branchChisqI = newBranchChisqI;
+                branchChisqJ = newBranchChisqJ;
             }
             catch (StatusCodeException &)
             {
             }
+        }
+    }
 
-            // Re-calculate chi2 values if both clusters have a split
-            if (branchChisqI > 0.f && branchChisqJ > 0.f)
-            {
-                const CartesianVector relativeDirection((branchSplitPositionJ - branchSplitPositionI).GetUnitVector());
-
-                if (branchSplitDirectionI.GetDotProduct(relativeDirection) > 0.f && branchSplitDirectionJ.GetDotProduct(relativeDirection) < 0.f)
-                {
-                    try
-                    {
-                        const float newBranchChisqI(this->CalculateBranchChi2(pClusterI, branchSplitPositionI, relativeDirection));
-                        const float newBranchChisqJ(this->CalculateBranchChi2(pClusterJ, branchSplitPositionJ, relativeDirection * -1.f));
-                        branchChisqI = newBranchChisqI;
-                        branchChisqJ = newBranchChisqJ;
-                    }
-                    catch (StatusCodeException &)
-                    {
-                    }
-                }
-            }
-
-            // Select the overall best split position
-            if (branchChisqI > branchChisqJ)
-            {
-                clusterExtensionList.push_back(
-                    ClusterExtension(pClusterI, pClusterJ, replacementStartPositionJ, branchSplitPositionI, branchSplitDirectionI));
-            }
+    // Select the overall best split position
+    if (branchChisqI > branchChisqJ)
+    {
+        clusterExtensionList.push_back(
+            ClusterExtension(pClusterI, pClusterJ, replacementStartPositionJ, branchSplitPositionI, branchSplitDirectionI));
+    }
 
-            else if (branchChisqJ > branchChisqI)
-            {
-                clusterExtensionList.push_back(
-                    ClusterExtension(pClusterJ, pClusterI, replacementStartPositionI, branchSplitPositionJ, branchSplitDirectionJ));
-            }
-        }
+    else if (branchChisqJ > branchChisqI)
+    {
+        clusterExtensionList.push_back(
+            ClusterExtension(pClusterJ, pClusterI, replacementStartPositionI, branchSplitPositionJ, branchSplitDirectionJ));
     }
 }
 
@@ -435,6 +456,9 @@ StatusCode TwoDSlidingFitSplittingAndSplicingAlgorithm::ReadSettings(const TiXml
 
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "CosmicMode", m_runCosmicMode));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "NPairThreads", m_nPairThreads));
+
     return STATUS_CODE_SUCCESS;
 }
 
@@ -83,6 +83,7 @@ protected:
     };
 
     typedef std::vector<ClusterExtension> ClusterExtensionList;
+    typedef std::vector<std::pair<const pandora::Cluster *, const pandora::Cluster *>> ClusterPairVector;
 
     /**
      *  @brief  Output the best split positions in branch and replacement clusters
@@ -127,6 +128,19 @@ private:
     void BuildClusterExtensionList(const pandora::ClusterVector &clusterVector, const TwoDSlidingFitResultMap &branchResultMap,
         const TwoDSlidingFitResultMap &replacementResultMap, ClusterExtensionList &clusterExtensionList) const;
 
+    /**
+     *  @brief  Search for the candidate split for a pair of clusters, using their prebuilt sliding fit results
+     *
+     *  @param  pClusterI the address of the first cluster
+     *  @param  pClusterJ the address of the second cluster
+     *  @param  branchResultMap the sliding fit result map for branch clusters
+     *  @param  replacementResultMap the sliding fit result map for replacement clusters
+     *  @param  clusterExtensionList to receive the candidate split, if any
+     */
+    void BuildClusterExtension(const pandora::Cluster *const pClusterI, const pandora::Cluster *const pClusterJ,
+        const TwoDSlidingFitResultMap &branchResultMap, const TwoDSlidingFitResultMap &replacementResultMap,
+        ClusterExtensionList &clusterExtensionList) const;
+
     /**
      *  @brief  Finalize the list of candidate splits
      *
@@ -186,6 +200,7 @@ private:
     float m_minClusterLength;             ///<
     float m_vetoDisplacement;             ///<
     bool m_runCosmicMode;                 ///<
+    unsigned int m_nPairThreads;          ///< The number of threads between which to share the cluster pairs (zero for all available)
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
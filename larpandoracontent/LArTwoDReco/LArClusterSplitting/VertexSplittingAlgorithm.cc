@@ -18,7 +18,11 @@ using namespace pandora;
 namespace lar_content
 {
 
-VertexSplittingAlgorithm::VertexSplittingAlgorithm() : m_splitDisplacementSquared(4.f * 4.f), m_vertexDisplacementSquared(1.f * 1.f)
+VertexSplittingAlgorithm::VertexSplittingAlgorithm() :
+    m_splitDisplacementSquared(4.f * 4.f),
+    m_vertexDisplacementSquared(1.f * 1.f),
+    m_vertexStatusCode(STATUS_CODE_NOT_INITIALIZED),
+    m_pSelectedVertex(nullptr)
 {
     // ATTN Some default values differ from base class
     m_minClusterLength = 1.f;
@@ -26,7 +30,24 @@ VertexSplittingAlgorithm::VertexSplittingAlgorithm() : m_splitDisplacementSquare
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-StatusCode VertexSplittingAlgorithm::FindBestSplitPosition(const TwoDSlidingFitResult &slidingFitResult, CartesianVector &splitPosition) const
+StatusCode VertexSplittingAlgorithm::Run()
+{
+    // ATTN The vertex list is read once per run, rather than once per cluster, so that clusters divided on worker threads need not
+    // access the content api
+    m_pSelectedVertex = nullptr;
+    m_vertexStatusCode = this->GetSelectedVertex(m_pSelectedVertex);
+
+    const StatusCode statusCode(TwoDSlidingFitSplittingAlgorithm::Run());
+
+    m_pSelectedVertex = nullptr;
+    m_vertexStatusCode = STATUS_CODE_NOT_INITIALIZED;
+
+    return statusCode;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode VertexSplittingAlgorithm::GetSelectedVertex(const Vertex *&pSelectedVertex) const
 {
     // Identify event vertex
     const VertexList *pVertexList(NULL);
@@ -38,15 +59,25 @@ StatusCode VertexSplittingAlgorithm::FindBestSplitPosition(const TwoDSlidingFitR
     if (pVertexList->size() != 1)
         return STATUS_CODE_OUT_OF_RANGE;
 
-    const Cluster *const pCluster(slidingFitResult.GetCluster());
-    const HitType hitType(LArClusterHelper::GetClusterHitType(pCluster));
+    if (VERTEX_3D != (*(pVertexList->begin()))->GetVertexType())
+        return STATUS_CODE_INVALID_PARAMETER;
 
-    const Vertex *const pSelectedVertex(*(pVertexList->begin()));
+    pSelectedVertex = *(pVertexList->begin());
 
-    if (VERTEX_3D != pSelectedVertex->GetVertexType())
-        return STATUS_CODE_INVALID_PARAMETER;
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode VertexSplittingAlgorithm::FindBestSplitPosition(const TwoDSlidingFitResult &slidingFitResult, CartesianVector &splitPosition) const
+{
+    if (STATUS_CODE_SUCCESS != m_vertexStatusCode)
+        return m_vertexStatusCode;
+
+    const Cluster *const pCluster(slidingFitResult.GetCluster());
+    const HitType hitType(LArClusterHelper::GetClusterHitType(pCluster));
 
-    const CartesianVector theVertex2D(LArGeometryHelper::ProjectPosition(this->GetPandora(), pSelectedVertex->GetPosition(), hitType));
+    const CartesianVector theVertex2D(LArGeometryHelper::ProjectPosition(this->GetPandora(), m_pSelectedVertex->GetPosition(), hitType));
 
     const CartesianVector innerVertex2D(slidingFitResult.GetGlobalMinLayerPosition());
     const CartesianVector outerVertex2D(slidingFitResult.GetGlobalMaxLayerPosition());
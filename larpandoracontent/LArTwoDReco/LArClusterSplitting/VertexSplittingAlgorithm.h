@@ -27,11 +27,23 @@ public:
     VertexSplittingAlgorithm();
 
 private:
+    pandora::StatusCode Run();
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
     pandora::StatusCode FindBestSplitPosition(const TwoDSlidingFitResult &slidingFitResult, pandora::CartesianVector &splitPosition) const;
 
-    float m_splitDisplacementSquared;  ///< Maximum displacement squared
-    float m_vertexDisplacementSquared; ///< Maximum displacement squared
+    /**
+     *  @brief  Get the selected event vertex from the current vertex list
+     *
+     *  @param  pSelectedVertex to receive the address of the selected vertex
+     *
+     *  @return success, if the current vertex list holds exactly one three dimensional vertex
+     */
+    pandora::StatusCode GetSelectedVertex(const pandora::Vertex *&pSelectedVertex) const;
+
+    float m_splitDisplacementSquared;         ///< Maximum displacement squared
+    float m_vertexDisplacementSquared;        ///< Maximum displacement squared
+    pandora::StatusCode m_vertexStatusCode;   ///< The outcome of getting the selected vertex for the current run
+    const pandora::Vertex *m_pSelectedVertex; ///< The selected vertex for the current run
 };
 
 } // namespace lar_content
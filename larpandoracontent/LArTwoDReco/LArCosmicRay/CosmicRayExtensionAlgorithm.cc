@@ -10,9 +10,14 @@
 
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 #include "larpandoracontent/LArHelpers/LArPointingClusterHelper.h"
+#include "larpandoracontent/LArHelpers/LArSlidingFitCacheHelper.h"
 
 #include "larpandoracontent/LArTwoDReco/LArCosmicRay/CosmicRayExtensionAlgorithm.h"
 
+#include "larpandoracontent/LArUtility/KDTreeLinkerAlgoT.h"
+
+#include <algorithm>
+
 using namespace pandora;
 
 namespace lar_content
@@ -49,32 +54,85 @@ void CosmicRayExtensionAlgorithm::GetListOfCleanClusters(const ClusterList *cons
 
 void CosmicRayExtensionAlgorithm::FillClusterAssociationMatrix(const ClusterVector &clusterVector, ClusterAssociationMatrix &clusterAssociationMatrix) const
 {
-    // Convert each input cluster into a pointing cluster
+    // Convert each input cluster into a pointing cluster, sharing the cached two dimensional sliding fits
     LArPointingClusterList pointingClusterList;
 
     for (ClusterVector::const_iterator iter = clusterVector.begin(), iterEnd = clusterVector.end(); iter != iterEnd; ++iter)
     {
         try
         {
-            pointingClusterList.push_back(LArPointingCluster(*iter));
+            if (TPC_3D == LArClusterHelper::GetClusterHitType(*iter))
+            {
+                pointingClusterList.push_back(LArPointingCluster(*iter));
+            }
+            else
+            {
+                const TwoDSlidingFitResult &slidingFitResult(
+                    LArSlidingFitCacheHelper::GetSlidingFitResult(this->GetPandora(), *iter, 10, 0.3f));
+                pointingClusterList.push_back(LArPointingCluster(slidingFitResult));
+            }
         }
         catch (StatusCodeException &)
         {
         }
     }
 
+    // Index the pointing cluster vertices, as an association requires the closest pair of vertices to be within the max displacement
+    PointList vertexPointList;
+    PointToIndexMap pointToIndexMap;
+
+    for (unsigned int index = 0; index < pointingClusterList.size(); ++index)
+    {
+        const LArPointingCluster &pointingCluster(pointingClusterList.at(index));
+
+        for (const LArPointingCluster::Vertex *const pVertex : {&pointingCluster.GetInnerVertex(), &pointingCluster.GetOuterVertex()})
+        {
+            vertexPointList.push_back(&pVertex->GetPosition());
+            (void)pointToIndexMap.insert(PointToIndexMap::value_type(&pVertex->GetPosition(), index));
+        }
+    }
+
+    PointKDTree2D kdTree;
+    PointKDNode2DList pointKDNode2DList;
+    const KDTreeBox verticesBoundingRegion2D(fill_and_bound_2d_kd_tree(vertexPointList, pointKDNode2DList));
+    kdTree.build(pointKDNode2DList, verticesBoundingRegion2D);
+
+    // ATTN The search box is padded, so that only pairs of clusters that must fail the proximity requirement are skipped
+    const float searchDistance(m_maxLongitudinalDisplacement + 0.01f);
+
     // Form associations between pairs of pointing clusters
-    for (LArPointingClusterList::const_iterator iterI = pointingClusterList.begin(), iterEndI = pointingClusterList.end(); iterI != iterEndI; ++iterI)
+    for (unsigned int indexI = 0; indexI < pointingClusterList.size(); ++indexI)
     {
-        const LArPointingCluster &clusterI = *iterI;
+        const LArPointingCluster &clusterI(pointingClusterList.at(indexI));
+        std::vector<unsigned int> candidateIndices;
 
-        for (LArPointingClusterList::const_iterator iterJ = iterI, iterEndJ = pointingClusterList.end(); iterJ != iterEndJ; ++iterJ)
+        for (const LArPointingCluster::Vertex *const pVertex : {&clusterI.GetInnerVertex(), &clusterI.GetOuterVertex()})
         {
-            const LArPointingCluster &clusterJ = *iterJ;
+            PointKDNode2DList found;
+            kdTree.search(build_2d_kd_search_region(pVertex->GetPosition(), searchDistance, searchDistance), found);
+
+            for (const PointKDNode2D &node : found)
+            {
+                const unsigned int indexJ(pointToIndexMap.at(node.data));
+
+                if (indexJ > indexI)
+                    candidateIndices.push_back(indexJ);
+            }
+        }
+
+        std::sort(candidateIndices.begin(), candidateIndices.end());
+        candidateIndices.erase(std::unique(candidateIndices.begin(), candidateIndices.end()), candidateIndices.end());
+
+        for (const unsigned int indexJ : candidateIndices)
+        {
+            const LArPointingCluster &clusterJ(pointingClusterList.at(indexJ));
 
             if (clusterI.GetCluster() == clusterJ.GetCluster())
                 continue;
 
+            if (this->IsCachedPair(clusterI.GetCluster(), clusterJ.GetCluster()))
+                continue;
+
             this->FillClusterAssociationMatrix(clusterI, clusterJ, clusterAssociationMatrix);
         }
     }
@@ -348,18 +406,17 @@ float CosmicRayExtensionAlgorithm::CalculateRms(const Cluster *const pCluster, c
     float totalChi2(0.f);
     float totalHits(0.f);
 
-    CaloHitList caloHitList;
-    pCluster->GetOrderedCaloHitList().FillCaloHitList(caloHitList);
-
-    for (CaloHitList::const_iterator iter = caloHitList.begin(), iterEnd = caloHitList.end(); iter != iterEnd; ++iter)
+    // ATTN Hits are visited in place, in ordered calo hit list order, rather than copied into a list first
+    for (const OrderedCaloHitList::value_type &layerEntry : pCluster->GetOrderedCaloHitList())
     {
-        const CaloHit *const pCaloHit = *iter;
-
-        const CartesianVector hitPosition(pCaloHit->GetPositionVector());
-        const CartesianVector predictedPosition(position + direction * direction.GetDotProduct(hitPosition - position));
+        for (const CaloHit *const pCaloHit : *layerEntry.second)
+        {
+            const CartesianVector hitPosition(pCaloHit->GetPositionVector());
+            const CartesianVector predictedPosition(position + direction * direction.GetDotProduct(hitPosition - position));
 
-        totalChi2 += (predictedPosition - hitPosition).GetMagnitudeSquared();
-        totalHits += 1.f;
+            totalChi2 += (predictedPosition - hitPosition).GetMagnitudeSquared();
+            totalHits += 1.f;
+        }
     }
 
     if (totalHits > 0.f)
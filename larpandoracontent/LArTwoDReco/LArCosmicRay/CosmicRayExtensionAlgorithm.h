@@ -14,9 +14,20 @@
 
 #include "larpandoracontent/LArTwoDReco/LArClusterAssociation/ClusterExtensionAlgorithm.h"
 
+#include <list>
+#include <unordered_map>
+#include <vector>
+
 namespace lar_content
 {
 
+template <typename, unsigned int>
+class KDTreeLinkerAlgo;
+template <typename, unsigned int>
+class KDTreeNodeInfoT;
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 /**
  *  @brief  CosmicRayExtensionAlgorithm class
  */
@@ -29,6 +40,12 @@ public:
     CosmicRayExtensionAlgorithm();
 
 private:
+    typedef KDTreeLinkerAlgo<const pandora::CartesianVector *, 2> PointKDTree2D;
+    typedef KDTreeNodeInfoT<const pandora::CartesianVector *, 2> PointKDNode2D;
+    typedef std::vector<PointKDNode2D> PointKDNode2DList;
+    typedef std::list<const pandora::CartesianVector *> PointList;
+    typedef std::unordered_map<const pandora::CartesianVector *, unsigned int> PointToIndexMap;
+
     void GetListOfCleanClusters(const pandora::ClusterList *const pClusterList, pandora::ClusterVector &clusterVector) const;
     void FillClusterAssociationMatrix(const pandora::ClusterVector &clusterVector, ClusterAssociationMatrix &clusterAssociationMatrix) const;
     void FillClusterMergeMap(const ClusterAssociationMatrix &clusterAssociationMatrix, ClusterMergeMap &clusterMergeMap) const;
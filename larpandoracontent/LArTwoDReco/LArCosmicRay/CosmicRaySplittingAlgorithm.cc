@@ -13,6 +13,11 @@
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
 #include "larpandoracontent/LArHelpers/LArPointingClusterHelper.h"
+#include "larpandoracontent/LArHelpers/LArSlidingFitCacheHelper.h"
+
+#include "larpandoracontent/LArUtility/KDTreeLinkerAlgoT.h"
+
+#include <algorithm>
 
 using namespace pandora;
 
@@ -46,6 +51,35 @@ StatusCode CosmicRaySplittingAlgorithm::Run()
     TwoDSlidingFitResultMap slidingFitResultMap;
     this->BuildSlidingFitResultMap(clusterVector, slidingFitResultMap);
 
+    // Index the sliding fit end positions, to which the vertex of any replacement cluster must be close
+    CartesianPointVector endPositions;
+    endPositions.reserve(2 * clusterVector.size());
+    PointList endPointList;
+    PointToIndexMap pointToIndexMap;
+
+    for (unsigned int iCluster = 0; iCluster < clusterVector.size(); ++iCluster)
+    {
+        TwoDSlidingFitResultMap::const_iterator fitIter = slidingFitResultMap.find(clusterVector.at(iCluster));
+
+        if (slidingFitResultMap.end() == fitIter)
+            continue;
+
+        const TwoDSlidingFitResult &slidingFitResult(fitIter->second);
+
+        for (unsigned int iFwd = 0; iFwd < 2; ++iFwd)
+        {
+            endPositions.push_back(
+                (0 == iFwd) ? slidingFitResult.GetGlobalMinLayerPosition() : slidingFitResult.GetGlobalMaxLayerPosition());
+            endPointList.push_back(&endPositions.back());
+            (void)pointToIndexMap.insert(PointToIndexMap::value_type(&endPositions.back(), iCluster));
+        }
+    }
+
+    PointKDTree2D kdTree;
+    PointKDNode2DList pointKDNode2DList;
+    const KDTreeBox endPointsBoundingRegion2D(fill_and_bound_2d_kd_tree(endPointList, pointKDNode2DList));
+    kdTree.build(pointKDNode2DList, endPointsBoundingRegion2D);
+
     // Loop over clusters, identify and perform splits
     ClusterSet splitClusters;
 
@@ -76,12 +110,17 @@ StatusCode CosmicRaySplittingAlgorithm::Run()
         float bestLengthSquared1(m_maxLongitudinalDisplacementSquared);
         float bestLengthSquared2(m_maxLongitudinalDisplacementSquared);
 
-        for (ClusterVector::const_iterator rIter = clusterVector.begin(), rIterEnd = clusterVector.end(); rIter != rIterEnd; ++rIter)
+        std::vector<unsigned int> candidateIndices;
+        this->GetReplacementCandidates(splitPosition, kdTree, pointToIndexMap, candidateIndices);
+
+        for (const unsigned int candidateIndex : candidateIndices)
         {
-            if (splitClusters.count(*rIter) > 0)
+            const Cluster *const pCandidateCluster(clusterVector.at(candidateIndex));
+
+            if (splitClusters.count(pCandidateCluster) > 0)
                 continue;
 
-            TwoDSlidingFitResultMap::const_iterator rFitIter = slidingFitResultMap.find(*rIter);
+            TwoDSlidingFitResultMap::const_iterator rFitIter = slidingFitResultMap.find(pCandidateCluster);
 
             if (slidingFitResultMap.end() == rFitIter)
                 continue;
@@ -188,7 +227,8 @@ void CosmicRaySplittingAlgorithm::BuildSlidingFitResultMap(const ClusterVector &
         {
             try
             {
-                const TwoDSlidingFitResult slidingFitResult(*iter, m_halfWindowLayers, slidingFitPitch);
+                const TwoDSlidingFitResult &slidingFitResult(
+                    LArSlidingFitCacheHelper::GetSlidingFitResult(this->GetPandora(), *iter, m_halfWindowLayers, slidingFitPitch));
 
                 if (!slidingFitResultMap.insert(TwoDSlidingFitResultMap::value_type(*iter, slidingFitResult)).second)
                     throw StatusCodeException(STATUS_CODE_FAILURE);
@@ -204,6 +244,25 @@ void CosmicRaySplittingAlgorithm::BuildSlidingFitResultMap(const ClusterVector &
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void CosmicRaySplittingAlgorithm::GetReplacementCandidates(const CartesianVector &splitPosition, PointKDTree2D &kdTree,
+    const PointToIndexMap &pointToIndexMap, std::vector<unsigned int> &candidateIndices) const
+{
+    // ATTN A replacement is only accepted if its vertex lies within the max longitudinal displacement of the split position
+    const float searchDistance(m_maxLongitudinalDisplacement + 0.01f);
+    const KDTreeBox searchRegion(build_2d_kd_search_region(splitPosition, searchDistance, searchDistance));
+
+    PointKDNode2DList found;
+    kdTree.search(searchRegion, found);
+
+    for (const PointKDNode2D &node : found)
+        candidateIndices.push_back(pointToIndexMap.at(node.data));
+
+    std::sort(candidateIndices.begin(), candidateIndices.end());
+    candidateIndices.erase(std::unique(candidateIndices.begin(), candidateIndices.end()), candidateIndices.end());
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode CosmicRaySplittingAlgorithm::FindBestSplitPosition(const TwoDSlidingFitResult &branchSlidingFitResult,
     CartesianVector &splitPosition, CartesianVector &splitDirection1, CartesianVector &splitDirection2) const
 {
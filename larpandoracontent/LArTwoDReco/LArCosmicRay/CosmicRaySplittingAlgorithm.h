@@ -12,9 +12,20 @@
 
 #include "larpandoracontent/LArObjects/LArTwoDSlidingFitResult.h"
 
+#include <list>
+#include <unordered_map>
+#include <vector>
+
 namespace lar_content
 {
 
+template <typename, unsigned int>
+class KDTreeLinkerAlgo;
+template <typename, unsigned int>
+class KDTreeNodeInfoT;
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 /**
  *  @brief  CosmicRaySplittingAlgorithm class
  */
@@ -27,6 +38,12 @@ public:
     CosmicRaySplittingAlgorithm();
 
 private:
+    typedef KDTreeLinkerAlgo<const pandora::CartesianVector *, 2> PointKDTree2D;
+    typedef KDTreeNodeInfoT<const pandora::CartesianVector *, 2> PointKDNode2D;
+    typedef std::vector<PointKDNode2D> PointKDNode2DList;
+    typedef std::list<const pandora::CartesianVector *> PointList;
+    typedef std::unordered_map<const pandora::CartesianVector *, unsigned int> PointToIndexMap;
+
     pandora::StatusCode Run();
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
@@ -46,6 +63,17 @@ private:
      */
     void BuildSlidingFitResultMap(const pandora::ClusterVector &clusterVector, TwoDSlidingFitResultMap &slidingFitResultMap) const;
 
+    /**
+     *  @brief  Get the candidate replacement clusters for a split position, those with a sliding fit end position near the split position
+     *
+     *  @param  splitPosition the split position
+     *  @param  kdTree the kd tree of sliding fit end positions
+     *  @param  pointToIndexMap the map from sliding fit end position to cluster vector index
+     *  @param  candidateIndices to receive the cluster vector indices of the candidate replacement clusters, in increasing order
+     */
+    void GetReplacementCandidates(const pandora::CartesianVector &splitPosition, PointKDTree2D &kdTree,
+        const PointToIndexMap &pointToIndexMap, std::vector<unsigned int> &candidateIndices) const;
+
     /**
      *  @brief  Find the position of greatest scatter along a sliding linear fit
      *
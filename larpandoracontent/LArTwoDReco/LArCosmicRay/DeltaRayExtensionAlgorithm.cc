@@ -55,6 +55,9 @@ void DeltaRayExtensionAlgorithm::FillClusterAssociationMatrix(const ClusterVecto
             if (pParentCluster == pDaughterCluster)
                 continue;
 
+            if (this->IsCachedPair(pParentCluster, pDaughterCluster))
+                continue;
+
             this->FillClusterAssociationMatrix(pParentCluster, pDaughterCluster, innerCoordinateMap, outerCoordinateMap, clusterAssociationMatrix);
         }
     }
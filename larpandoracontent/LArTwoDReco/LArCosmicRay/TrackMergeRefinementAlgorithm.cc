@@ -33,6 +33,8 @@ TrackMergeRefinementAlgorithm::TrackMergeRefinementAlgorithm() :
 
 StatusCode TrackMergeRefinementAlgorithm::Run()
 {
+    const LArClusterHelper::GeometryCacheScope geometryCacheScope;
+
     const ClusterList *pClusterList(nullptr);
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::GetCurrentList(*this, pClusterList));
 
@@ -12,6 +12,7 @@
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
 #include "larpandoracontent/LArHelpers/LArHitWidthHelper.h"
+#include "larpandoracontent/LArHelpers/LArSlidingFitCacheHelper.h"
 
 using namespace pandora;
 
@@ -49,8 +50,10 @@ void TrackRefinementBaseAlgorithm::InitialiseContainers(const ClusterList *pClus
 
         try
         {
-            const TwoDSlidingFitResult microSlidingFitResult(pCluster, m_microSlidingFitWindow, slidingFitPitch);
-            const TwoDSlidingFitResult macroSlidingFitResult(pCluster, m_macroSlidingFitWindow, slidingFitPitch);
+            const TwoDSlidingFitResult &microSlidingFitResult(
+                LArSlidingFitCacheHelper::GetSlidingFitResult(this->GetPandora(), pCluster, m_microSlidingFitWindow, slidingFitPitch));
+            const TwoDSlidingFitResult &macroSlidingFitResult(
+                LArSlidingFitCacheHelper::GetSlidingFitResult(this->GetPandora(), pCluster, m_macroSlidingFitWindow, slidingFitPitch));
 
             slidingFitResultMapPair.first->insert(TwoDSlidingFitResultMap::value_type(pCluster, microSlidingFitResult));
             slidingFitResultMapPair.second->insert(TwoDSlidingFitResultMap::value_type(pCluster, macroSlidingFitResult));
@@ -142,11 +145,26 @@ void TrackRefinementBaseAlgorithm::GetHitsInBoundingBox(const CartesianVector &f
         if (std::find(unavailableProtectedClusters.begin(), unavailableProtectedClusters.end(), pCluster) != unavailableProtectedClusters.end())
             continue;
 
+        // ATTN Hit width mode shifts hit positions in x only, so clusters may always be rejected on their z extent
+        CartesianVector minimumCoordinate(0.f, 0.f, 0.f), maximumCoordinate(0.f, 0.f, 0.f);
+        LArClusterHelper::GetClusterBoundingBox(pCluster, minimumCoordinate, maximumCoordinate);
+
+        if ((maximumCoordinate.GetZ() < minZ) || (minimumCoordinate.GetZ() > maxZ))
+            continue;
+
+        if (!m_hitWidthMode && ((maximumCoordinate.GetX() < minX) || (minimumCoordinate.GetX() > maxX)))
+            continue;
+
         const OrderedCaloHitList &orderedCaloHitList(pCluster->GetOrderedCaloHitList());
         for (const OrderedCaloHitList::value_type &mapEntry : orderedCaloHitList)
         {
             for (const CaloHit *const pCaloHit : *mapEntry.second)
             {
+                const float hitZ(pCaloHit->GetPositionVector().GetZ());
+
+                if ((hitZ < minZ) || (hitZ > maxZ))
+                    continue;
+
                 CartesianVector hitPosition(m_hitWidthMode ? LArHitWidthHelper::GetClosestPointToLine2D(firstCorner, connectingLineDirection, pCaloHit)
                                                            : pCaloHit->GetPositionVector());
 
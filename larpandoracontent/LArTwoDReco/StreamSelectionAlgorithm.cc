@@ -49,7 +49,7 @@ StatusCode StreamSelectionAlgorithm::Run()
         originalClusterListName = m_inputListName;
     }
 
-    for (std::string listName : m_listNames)
+    for (const std::string &listName : m_listNames)
         m_clusterListMap[listName] = ClusterList();
 
     for (const Cluster *pCluster : *pClusterList)
@@ -61,7 +61,7 @@ StatusCode StreamSelectionAlgorithm::Run()
 
     // ATTN - We're ok with saving empty lists here and allowing future algorithms to simply do nothing if there are no clusters
     // Moves the subset of clusters in the cluster list from the old list to the new list
-    for (std::string listName : m_listNames)
+    for (const std::string &listName : m_listNames)
         PandoraContentApi::SaveList<ClusterList>(*this, originalClusterListName, listName, m_clusterListMap.at(listName));
 
     return STATUS_CODE_SUCCESS;
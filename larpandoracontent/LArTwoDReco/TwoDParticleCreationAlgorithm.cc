@@ -27,31 +27,16 @@ StatusCode TwoDParticleCreationAlgorithm::Run()
     std::string pfoListName;
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::CreateTemporaryListAndSetCurrent(*this, pPfoList, pfoListName));
 
-    if (!m_inputClusterListNameU.empty())
+    for (const std::string &clusterListName : {m_inputClusterListNameU, m_inputClusterListNameV, m_inputClusterListNameW})
     {
-        const ClusterList *pClusterListU = nullptr;
-        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::GetList(*this, m_inputClusterListNameU, pClusterListU));
-
-        if (pClusterListU)
-            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->CreatePFOs(pClusterListU));
-    }
-
-    if (!m_inputClusterListNameV.empty())
-    {
-        const ClusterList *pClusterListV = nullptr;
-        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::GetList(*this, m_inputClusterListNameV, pClusterListV));
-
-        if (pClusterListV)
-            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->CreatePFOs(pClusterListV));
-    }
+        if (clusterListName.empty())
+            continue;
 
-    if (!m_inputClusterListNameW.empty())
-    {
-        const ClusterList *pClusterListW = nullptr;
-        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::GetList(*this, m_inputClusterListNameW, pClusterListW));
+        const ClusterList *pClusterList = nullptr;
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::GetList(*this, clusterListName, pClusterList));
 
-        if (pClusterListW)
-            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->CreatePFOs(pClusterListW));
+        if (pClusterList)
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->CreatePFOs(pClusterList));
     }
 
     if (!pPfoList->empty())
@@ -67,6 +52,8 @@ StatusCode TwoDParticleCreationAlgorithm::Run()
 
 StatusCode TwoDParticleCreationAlgorithm::CreatePFOs(const ClusterList *const pClusterList) const
 {
+    const ParticleIdPlugin *const pParticleId(PandoraContentApi::GetPlugins(*this)->GetParticleId());
+
     for (ClusterList::const_iterator iter = pClusterList->begin(), iterEnd = pClusterList->end(); iter != iterEnd; ++iter)
     {
         const Cluster *const pCluster = *iter;
@@ -80,22 +67,22 @@ StatusCode TwoDParticleCreationAlgorithm::CreatePFOs(const ClusterList *const pC
         if (clusterEnergy < m_minClusterEnergy)
             continue;
 
-        PandoraContentApi::ParticleFlowObject::Parameters pfoParameters;
-
-        // TODO Finalize particle id here
-        const ParticleType particleType(PandoraContentApi::GetPlugins(*this)->GetParticleId()->IsMuon(pCluster) ? MU_MINUS : PHOTON);
-
+        // ATTN Check the cached fit before the particle id, so that the particle id plugin only sees clusters that will form pfos
         const ClusterFitResult &fitToAllHitsResult(pCluster->GetFitToAllHitsResult());
 
         if (!fitToAllHitsResult.IsFitSuccessful())
             continue;
 
+        // TODO Finalize particle id here
+        const ParticleType particleType(pParticleId->IsMuon(pCluster) ? MU_MINUS : PHOTON);
+
         // TODO Check remaining parameters
+        PandoraContentApi::ParticleFlowObject::Parameters pfoParameters;
         pfoParameters.m_particleId = particleType;
         pfoParameters.m_charge = 0;
         pfoParameters.m_mass = 0.;
         pfoParameters.m_energy = clusterEnergy;
-        pfoParameters.m_momentum = CartesianVector(fitToAllHitsResult.GetDirection() * clusterEnergy);
+        pfoParameters.m_momentum = fitToAllHitsResult.GetDirection() * clusterEnergy;
         pfoParameters.m_clusterList.push_back(pCluster);
 
         const ParticleFlowObject *pPfo(NULL);
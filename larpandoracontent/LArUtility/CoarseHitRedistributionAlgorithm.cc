@@ -0,0 +1,88 @@
+/**
+ *  @file   larpandoracontent/LArUtility/CoarseHitRedistributionAlgorithm.cc
+ *
+ *  @brief  Implementation of the coarse hit redistribution algorithm class.
+ *
+ *  $Log: $
+ */
+
+#include "Pandora/AlgorithmHeaders.h"
+
+#include "larpandoracontent/LArUtility/CoarseHitRedistributionAlgorithm.h"
+#include "larpandoracontent/LArUtility/HitCoarseningAlgorithm.h"
+
+using namespace pandora;
+
+namespace lar_content
+{
+
+StatusCode CoarseHitRedistributionAlgorithm::Run()
+{
+    for (const std::string &clusterListName : m_clusterListNames)
+    {
+        const ClusterList *pClusterList(nullptr);
+        PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_INITIALIZED, !=,
+            PandoraContentApi::GetList(*this, clusterListName, pClusterList));
+
+        if (!pClusterList || pClusterList->empty())
+            continue;
+
+        unsigned int nSuperHits(0);
+
+        for (const Cluster *const pCluster : *pClusterList)
+            this->RedistributeHits(pCluster, nSuperHits);
+
+        if (PandoraContentApi::GetSettings(*this)->ShouldDisplayAlgorithmInfo())
+        {
+            std::cout << "CoarseHitRedistributionAlgorithm: " << clusterListName << " " << nSuperHits << " super hits replaced"
+                      << std::endl;
+        }
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void CoarseHitRedistributionAlgorithm::RedistributeHits(const Cluster *const pCluster, unsigned int &nSuperHits) const
+{
+    CaloHitList clusterHits, isolatedHits;
+    pCluster->GetOrderedCaloHitList().FillCaloHitList(clusterHits);
+    isolatedHits = pCluster->GetIsolatedCaloHitList();
+
+    // ATTN Add the constituents before removing each super hit, as the last hit in a cluster cannot be removed
+    for (const CaloHit *const pSuperHit : clusterHits)
+    {
+        CaloHitList constituentHits;
+
+        if (!HitCoarseningAlgorithm::GetConstituentHits(this->GetPandora(), pSuperHit, constituentHits))
+            continue;
+
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::AddToCluster(*this, pCluster, &constituentHits));
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::RemoveFromCluster(*this, pCluster, pSuperHit));
+        ++nSuperHits;
+    }
+
+    for (const CaloHit *const pSuperHit : isolatedHits)
+    {
+        CaloHitList constituentHits;
+
+        if (!HitCoarseningAlgorithm::GetConstituentHits(this->GetPandora(), pSuperHit, constituentHits))
+            continue;
+
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::AddIsolatedToCluster(*this, pCluster, &constituentHits));
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::RemoveIsolatedFromCluster(*this, pCluster, pSuperHit));
+        ++nSuperHits;
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode CoarseHitRedistributionAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
+{
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadVectorOfValues(xmlHandle, "ClusterListNames", m_clusterListNames));
+
+    return STATUS_CODE_SUCCESS;
+}
+
+} // namespace lar_content
@@ -0,0 +1,38 @@
+/**
+ *  @file   larpandoracontent/LArUtility/CoarseHitRedistributionAlgorithm.h
+ *
+ *  @brief  Header file for the coarse hit redistribution algorithm class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_COARSE_HIT_REDISTRIBUTION_ALGORITHM_H
+#define LAR_COARSE_HIT_REDISTRIBUTION_ALGORITHM_H 1
+
+#include "Pandora/Algorithm.h"
+
+namespace lar_content
+{
+
+/**
+ *  @brief  CoarseHitRedistributionAlgorithm class, replacing the super hits in 2D clusters by their constituent hits
+ */
+class CoarseHitRedistributionAlgorithm : public pandora::Algorithm
+{
+private:
+    pandora::StatusCode Run();
+    pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
+
+    /**
+     *  @brief  Replace the super hits in a cluster by their constituent hits
+     *
+     *  @param  pCluster the address of the cluster
+     *  @param  nSuperHits to receive the number of super hits replaced
+     */
+    void RedistributeHits(const pandora::Cluster *const pCluster, unsigned int &nSuperHits) const;
+
+    pandora::StringVector m_clusterListNames; ///< The names of the 2D cluster lists in which to replace super hits
+};
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_COARSE_HIT_REDISTRIBUTION_ALGORITHM_H
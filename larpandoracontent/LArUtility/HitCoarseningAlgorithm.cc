@@ -0,0 +1,290 @@
+/**
+ *  @file   larpandoracontent/LArUtility/HitCoarseningAlgorithm.cc
+ *
+ *  @brief  Implementation of the hit coarsening algorithm class.
+ *
+ *  $Log: $
+ */
+
+#include "Pandora/AlgorithmHeaders.h"
+
+#include "larpandoracontent/LArUtility/HitCoarseningAlgorithm.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+using namespace pandora;
+
+namespace lar_content
+{
+
+HitCoarseningAlgorithm::PandoraToSuperHitMap HitCoarseningAlgorithm::m_pandoraToSuperHitMap;
+std::mutex HitCoarseningAlgorithm::m_superHitMapMutex;
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+HitCoarseningAlgorithm::HitCoarseningAlgorithm() : m_cellSizeX(0.5f), m_cellSizeZ(0.5f), m_minHitsPerSuperHit(3)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool HitCoarseningAlgorithm::GetConstituentHits(const Pandora &pandora, const CaloHit *const pSuperHit, CaloHitList &constituentHits)
+{
+    std::lock_guard<std::mutex> lock(m_superHitMapMutex);
+    const PandoraToSuperHitMap::const_iterator pandoraIter(m_pandoraToSuperHitMap.find(&pandora));
+
+    if (m_pandoraToSuperHitMap.end() == pandoraIter)
+        return false;
+
+    const SuperHitToConstituentsMap::const_iterator hitIter(pandoraIter->second.find(pSuperHit));
+
+    if (pandoraIter->second.end() == hitIter)
+        return false;
+
+    constituentHits.insert(constituentHits.end(), hitIter->second.begin(), hitIter->second.end());
+    return true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode HitCoarseningAlgorithm::Reset()
+{
+    std::lock_guard<std::mutex> lock(m_superHitMapMutex);
+    m_pandoraToSuperHitMap.erase(&this->GetPandora());
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode HitCoarseningAlgorithm::Run()
+{
+    SuperHitToConstituentsMap superHitToConstituentsMap;
+
+    for (unsigned int iList = 0; iList < m_inputCaloHitListNames.size(); ++iList)
+    {
+        const std::string &inputListName(m_inputCaloHitListNames.at(iList));
+        const std::string &outputListName(m_outputCaloHitListNames.at(iList));
+
+        const CaloHitList *pInputList(nullptr);
+        PANDORA_RETURN_RESULT_IF_AND_IF(
+            STATUS_CODE_SUCCESS, STATUS_CODE_NOT_INITIALIZED, !=, PandoraContentApi::GetList(*this, inputListName, pInputList));
+
+        if (!pInputList || pInputList->empty())
+            continue;
+
+        CaloHitList outputList;
+        unsigned int nConstituentHits(0);
+        this->CoarsenHits(*pInputList, outputList, superHitToConstituentsMap, nConstituentHits);
+
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::SaveList(*this, outputList, outputListName));
+
+        if (PandoraContentApi::GetSettings(*this)->ShouldDisplayAlgorithmInfo())
+        {
+            std::cout << "HitCoarseningAlgorithm: " << inputListName << " " << pInputList->size() << " hits, " << outputListName << " "
+                      << outputList.size() << " hits, " << nConstituentHits << " hits merged into super hits" << std::endl;
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_superHitMapMutex);
+        SuperHitToConstituentsMap &eventSuperHitMap(m_pandoraToSuperHitMap[&this->GetPandora()]);
+        eventSuperHitMap.insert(superHitToConstituentsMap.begin(), superHitToConstituentsMap.end());
+    }
+
+    if (!m_currentCaloHitListReplacement.empty())
+    {
+        if (STATUS_CODE_SUCCESS != PandoraContentApi::ReplaceCurrentList<CaloHit>(*this, m_currentCaloHitListReplacement))
+        {
+            std::cout << "HitCoarseningAlgorithm: Could not replace current calo hit list with list named: "
+                      << m_currentCaloHitListReplacement << std::endl;
+            return STATUS_CODE_NOT_FOUND;
+        }
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void HitCoarseningAlgorithm::CoarsenHits(const CaloHitList &inputList, CaloHitList &outputList,
+    SuperHitToConstituentsMap &superHitToConstituentsMap, unsigned int &nConstituentHits) const
+{
+    // ATTN Only 2D lar calo hits are coarsened, as super hits must carry the lar tpc volume details of their constituents. Hits are only
+    // merged within a single view and lar tpc volume.
+    auto getCellKey = [this](const CaloHit *const pCaloHit) {
+        const LArCaloHit *const pLArCaloHit(dynamic_cast<const LArCaloHit *>(pCaloHit));
+
+        if (!pLArCaloHit)
+            throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+        const CartesianVector &position(pCaloHit->GetPositionVector());
+        return CellKey(pCaloHit->GetHitType(), pLArCaloHit->GetLArTPCVolumeId(), pLArCaloHit->GetDaughterVolumeId(),
+            static_cast<int>(std::floor(position.GetX() / m_cellSizeX)), static_cast<int>(std::floor(position.GetZ() / m_cellSizeZ)));
+    };
+
+    auto isCoarsenable = [](const CaloHit *const pCaloHit) {
+        const HitType hitType(pCaloHit->GetHitType());
+        const bool isTwoD((TPC_VIEW_U == hitType) || (TPC_VIEW_V == hitType) || (TPC_VIEW_W == hitType));
+        return (isTwoD && dynamic_cast<const LArCaloHit *>(pCaloHit));
+    };
+
+    CellToHitsMap cellToHitsMap;
+
+    for (const CaloHit *const pCaloHit : inputList)
+    {
+        if (isCoarsenable(pCaloHit))
+            cellToHitsMap[getCellKey(pCaloHit)].push_back(pCaloHit);
+    }
+
+    // Retain the input order, placing each super hit at the position of its first constituent
+    std::map<CellKey, const CaloHit *> cellToSuperHitMap;
+
+    for (const CaloHit *const pCaloHit : inputList)
+    {
+        if (!isCoarsenable(pCaloHit))
+        {
+            outputList.push_back(pCaloHit);
+            continue;
+        }
+
+        const CellKey cellKey(getCellKey(pCaloHit));
+        const CaloHitVector &cellHits(cellToHitsMap.at(cellKey));
+
+        if (cellHits.size() < m_minHitsPerSuperHit)
+        {
+            outputList.push_back(pCaloHit);
+            continue;
+        }
+
+        if (cellToSuperHitMap.count(cellKey))
+            continue;
+
+        const CaloHit *pSuperHit(nullptr);
+        this->CreateSuperHit(cellHits, pSuperHit);
+
+        cellToSuperHitMap[cellKey] = pSuperHit;
+        superHitToConstituentsMap[pSuperHit] = CaloHitList(cellHits.begin(), cellHits.end());
+        outputList.push_back(pSuperHit);
+        nConstituentHits += cellHits.size();
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void HitCoarseningAlgorithm::CreateSuperHit(const CaloHitVector &constituentHits, const CaloHit *&pSuperHit) const
+{
+    const CaloHit *pDominantHit(nullptr);
+    float inputEnergy(0.f), mipEquivalentEnergy(0.f), electromagneticEnergy(0.f), hadronicEnergy(0.f);
+    float minX(std::numeric_limits<float>::max()), maxX(-std::numeric_limits<float>::max());
+    CartesianVector weightedPosition(0.f, 0.f, 0.f), meanPosition(0.f, 0.f, 0.f);
+
+    for (const CaloHit *const pCaloHit : constituentHits)
+    {
+        if (!pDominantHit || (pCaloHit->GetInputEnergy() > pDominantHit->GetInputEnergy()))
+            pDominantHit = pCaloHit;
+
+        const CartesianVector &position(pCaloHit->GetPositionVector());
+        weightedPosition += position * pCaloHit->GetInputEnergy();
+        meanPosition += position;
+        minX = std::min(minX, position.GetX());
+        maxX = std::max(maxX, position.GetX());
+
+        inputEnergy += pCaloHit->GetInputEnergy();
+        mipEquivalentEnergy += pCaloHit->GetMipEquivalentEnergy();
+        electromagneticEnergy += pCaloHit->GetElectromagneticEnergy();
+        hadronicEnergy += pCaloHit->GetHadronicEnergy();
+    }
+
+    const LArCaloHit *const pDominantLArCaloHit(dynamic_cast<const LArCaloHit *>(pDominantHit));
+
+    if (!pDominantLArCaloHit)
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+    // ATTN The super hit has no parent address of its own, its constituents being recovered via GetConstituentHits. Its width in x
+    // covers the extent of all constituents.
+    LArCaloHitParameters parameters;
+    pDominantLArCaloHit->FillParameters(parameters);
+    parameters.m_pParentAddress = nullptr;
+    parameters.m_positionVector = (inputEnergy > std::numeric_limits<float>::epsilon())
+        ? weightedPosition * (1.f / inputEnergy)
+        : meanPosition * (1.f / static_cast<float>(constituentHits.size()));
+    parameters.m_cellSize1 = pDominantHit->GetCellSize1() + (maxX - minX);
+    parameters.m_inputEnergy = inputEnergy;
+    parameters.m_mipEquivalentEnergy = mipEquivalentEnergy;
+    parameters.m_electromagneticEnergy = electromagneticEnergy;
+    parameters.m_hadronicEnergy = hadronicEnergy;
+
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::CaloHit::Create(*this, parameters, pSuperHit, m_larCaloHitFactory));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode HitCoarseningAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
+{
+    PANDORA_RETURN_RESULT_IF(
+        STATUS_CODE_SUCCESS, !=, XmlHelper::ReadVectorOfValues(xmlHandle, "InputCaloHitListNames", m_inputCaloHitListNames));
+    PANDORA_RETURN_RESULT_IF(
+        STATUS_CODE_SUCCESS, !=, XmlHelper::ReadVectorOfValues(xmlHandle, "OutputCaloHitListNames", m_outputCaloHitListNames));
+
+    if (m_inputCaloHitListNames.size() != m_outputCaloHitListNames.size())
+    {
+        std::cout << "HitCoarseningAlgorithm::ReadSettings - Mismatch between input and output calo hit list names" << std::endl;
+        return STATUS_CODE_INVALID_PARAMETER;
+    }
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
+        XmlHelper::ReadValue(xmlHandle, "CurrentCaloHitListReplacement", m_currentCaloHitListReplacement));
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "CellSizeX", m_cellSizeX));
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "CellSizeZ", m_cellSizeZ));
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "MinHitsPerSuperHit", m_minHitsPerSuperHit));
+
+    if ((m_cellSizeX < std::numeric_limits<float>::epsilon()) || (m_cellSizeZ < std::numeric_limits<float>::epsilon()) ||
+        (m_minHitsPerSuperHit < 2))
+    {
+        std::cout << "HitCoarseningAlgorithm::ReadSettings - Cell sizes must be positive and super hits need at least two constituents"
+                  << std::endl;
+        return STATUS_CODE_INVALID_PARAMETER;
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+HitCoarseningAlgorithm::CellKey::CellKey(
+    const HitType hitType, const unsigned int larTPCVolumeId, const unsigned int daughterVolumeId, const int xIndex, const int zIndex) :
+    m_hitType(hitType),
+    m_larTPCVolumeId(larTPCVolumeId),
+    m_daughterVolumeId(daughterVolumeId),
+    m_xIndex(xIndex),
+    m_zIndex(zIndex)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool HitCoarseningAlgorithm::CellKey::operator<(const CellKey &rhs) const
+{
+    if (m_hitType != rhs.m_hitType)
+        return (m_hitType < rhs.m_hitType);
+
+    if (m_larTPCVolumeId != rhs.m_larTPCVolumeId)
+        return (m_larTPCVolumeId < rhs.m_larTPCVolumeId);
+
+    if (m_daughterVolumeId != rhs.m_daughterVolumeId)
+        return (m_daughterVolumeId < rhs.m_daughterVolumeId);
+
+    if (m_zIndex != rhs.m_zIndex)
+        return (m_zIndex < rhs.m_zIndex);
+
+    return (m_xIndex < rhs.m_xIndex);
+}
+
+} // namespace lar_content
@@ -0,0 +1,123 @@
+/**
+ *  @file   larpandoracontent/LArUtility/HitCoarseningAlgorithm.h
+ *
+ *  @brief  Header file for the hit coarsening algorithm class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_HIT_COARSENING_ALGORITHM_H
+#define LAR_HIT_COARSENING_ALGORITHM_H 1
+
+#include "Pandora/Algorithm.h"
+
+#include "larpandoracontent/LArObjects/LArCaloHit.h"
+
+#include <map>
+#include <mutex>
+#include <unordered_map>
+
+namespace lar_content
+{
+
+/**
+ *  @brief  HitCoarseningAlgorithm class, replacing the 2D hits in dense regions of each input list by charge-weighted super hits, which
+ *          record their constituent hits so that these may later be restored by the CoarseHitRedistributionAlgorithm
+ */
+class HitCoarseningAlgorithm : public pandora::Algorithm
+{
+public:
+    /**
+     *  @brief  Default constructor
+     */
+    HitCoarseningAlgorithm();
+
+    /**
+     *  @brief  Get the constituent hits of a super hit created, in the current event, by any hit coarsening algorithm instance
+     *
+     *  @param  pandora the pandora instance
+     *  @param  pSuperHit the address of the candidate super hit
+     *  @param  constituentHits to receive the constituent hits
+     *
+     *  @return whether the hit is a super hit
+     */
+    static bool GetConstituentHits(
+        const pandora::Pandora &pandora, const pandora::CaloHit *const pSuperHit, pandora::CaloHitList &constituentHits);
+
+private:
+    /**
+     *  @brief  CellKey class, identifying a cell in the drift (x) and wire (z) coordinates within a single view and lar tpc volume
+     */
+    class CellKey
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  hitType the hit type
+         *  @param  larTPCVolumeId the lar tpc volume id
+         *  @param  daughterVolumeId the daughter volume id
+         *  @param  xIndex the cell index in x
+         *  @param  zIndex the cell index in z
+         */
+        CellKey(const pandora::HitType hitType, const unsigned int larTPCVolumeId, const unsigned int daughterVolumeId, const int xIndex,
+            const int zIndex);
+
+        /**
+         *  @brief  Whether this cell key precedes another, ordering by hit type, volume ids, z and then by x
+         *
+         *  @param  rhs the other cell key
+         *
+         *  @return boolean
+         */
+        bool operator<(const CellKey &rhs) const;
+
+        pandora::HitType m_hitType;      ///< The hit type
+        unsigned int m_larTPCVolumeId;   ///< The lar tpc volume id
+        unsigned int m_daughterVolumeId; ///< The daughter volume id
+        int m_xIndex;                    ///< The cell index in x
+        int m_zIndex;                    ///< The cell index in z
+    };
+
+    typedef std::map<CellKey, pandora::CaloHitVector> CellToHitsMap;
+    typedef std::unordered_map<const pandora::CaloHit *, pandora::CaloHitList> SuperHitToConstituentsMap;
+    typedef std::unordered_map<const pandora::Pandora *, SuperHitToConstituentsMap> PandoraToSuperHitMap;
+
+    pandora::StatusCode Reset();
+    pandora::StatusCode Run();
+    pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
+
+    /**
+     *  @brief  Coarsen the hits in an input list, creating super hits for the dense cells and retaining the hits in sparse cells
+     *
+     *  @param  inputList the input calo hit list
+     *  @param  outputList to receive the super hits and the retained hits
+     *  @param  superHitToConstituentsMap to receive the constituent hits of each new super hit
+     *  @param  nConstituentHits to receive the number of input hits replaced by super hits
+     */
+    void CoarsenHits(const pandora::CaloHitList &inputList, pandora::CaloHitList &outputList,
+        SuperHitToConstituentsMap &superHitToConstituentsMap, unsigned int &nConstituentHits) const;
+
+    /**
+     *  @brief  Create a super hit from the hits in a dense cell, at their charge-weighted position and carrying their summed energies.
+     *          Other properties follow those of the constituent with the largest input energy, but the super hit has no parent address.
+     *
+     *  @param  constituentHits the hits in the cell
+     *  @param  pSuperHit to receive the address of the new super hit
+     */
+    void CreateSuperHit(const pandora::CaloHitVector &constituentHits, const pandora::CaloHit *&pSuperHit) const;
+
+    static PandoraToSuperHitMap m_pandoraToSuperHitMap; ///< The constituent hits of the super hits, for each pandora instance
+    static std::mutex m_superHitMapMutex;               ///< The mutex protecting the constituent hits of the super hits
+
+    pandora::StringVector m_inputCaloHitListNames;  ///< The input calo hit list names
+    pandora::StringVector m_outputCaloHitListNames; ///< The output calo hit list names, one per input list
+    std::string m_currentCaloHitListReplacement;    ///< The name of the calo hit list to replace the current list (optional)
+    float m_cellSizeX;                              ///< The cell size in the drift coordinate, trading accuracy for speed
+    float m_cellSizeZ;                              ///< The cell size in the wire coordinate, trading accuracy for speed
+    unsigned int m_minHitsPerSuperHit;              ///< The minimum number of hits in a cell for these to be merged into a super hit
+    LArCaloHitFactory m_larCaloHitFactory;          ///< Factory for creating LArCaloHits, when the constituents are LArCaloHits
+};
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_HIT_COARSENING_ALGORITHM_H
@@ -0,0 +1,316 @@
+/**
+ *  @file   larpandoracontent/LArUtility/KDTreeDynamicAlgoT.h
+ *
+ *  @brief  Header file for the dynamic kd tree algo template class
+ *
+ *  $Log: $
+ */
+#ifndef LAR_KD_TREE_DYNAMIC_ALGO_TEMPLATED_H
+#define LAR_KD_TREE_DYNAMIC_ALGO_TEMPLATED_H
+
+#include "Pandora/StatusCodes.h"
+
+#include "KDTreeLinkerAlgoT.h"
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
+namespace lar_content
+{
+
+/**
+ *  @brief  Class that extends the KDTree partition of space to support point insertion and removal. Removed points are marked as dead
+ *          rather than removed from the tree, and are revived in place if inserted again. New points are held in a buffer that is
+ *          searched linearly. The tree is rebuilt from the live points before a query once the number of dead and buffered points
+ *          exceeds a fraction of the number of points in the tree. Points are identified by their data, which must be unique.
+ */
+template <typename DATA, unsigned DIM = 2>
+class KDTreeDynamicAlgo
+{
+public:
+    /**
+     *  @brief  Constructor
+     *
+     *  @param  rebuildFraction the fraction of the number of points in the tree that the number of dead and buffered points may reach
+     *          before the tree is rebuilt
+     */
+    KDTreeDynamicAlgo(const float rebuildFraction = 0.25f);
+
+    /**
+     *  @brief  Build the KD tree from the "eltList", replacing any existing tree and buffered points
+     *
+     *  @param  eltList the list of points, which is not modified
+     */
+    void build(const std::vector<KDTreeNodeInfoT<DATA, DIM>> &eltList);
+
+    /**
+     *  @brief  Insert a point
+     *
+     *  @param  point the point
+     *
+     *  @return whether the point was inserted, false if a live point with the same data is already present
+     */
+    bool insert(const KDTreeNodeInfoT<DATA, DIM> &point);
+
+    /**
+     *  @brief  Remove the point with given data
+     *
+     *  @param  data the data
+     *
+     *  @return whether the point was removed, false if no live point with the same data is present
+     */
+    bool remove(const DATA &data);
+
+    /**
+     *  @brief  Search for all live points that would be contained in the given searchbox
+     *          The found points are appended to resRecHitList, points in the tree preceding buffered points in order of insertion
+     *
+     *  @param  searchBox
+     *  @param  resRecHitList
+     */
+    void search(const KDTreeBoxT<DIM> &searchBox, std::vector<KDTreeNodeInfoT<DATA, DIM>> &resRecHitList);
+
+    /**
+     *  @brief  Whether there are no live points
+     *
+     *  @return boolean
+     */
+    bool empty() const;
+
+    /**
+     *  @brief  Return the number of live points
+     *
+     *  @return the number of live points
+     */
+    unsigned int size() const;
+
+    /**
+     *  @brief  Clear all allocated structures
+     */
+    void clear();
+
+private:
+    typedef std::vector<KDTreeNodeInfoT<DATA, DIM>> NodeInfoList;
+    typedef std::unordered_map<DATA, unsigned int> DataToIndexMap;
+
+    /**
+     *  @brief  Rebuild the tree from the live points, if the number of dead and buffered points requires it
+     */
+    void rebalance();
+
+    /**
+     *  @brief  Rebuild the tree from the live points, those in the tree preceding buffered points in order of insertion
+     */
+    void rebuild();
+
+    float rebuildFraction_;            ///< The fraction of the number of points in the tree that dead and buffered points may reach
+    KDTreeLinkerAlgo<DATA, DIM> tree_; ///< The kd tree
+    NodeInfoList treeNodeInfos_;       ///< The points in the kd tree, in build order
+    std::vector<bool> isLive_;         ///< Whether each point in the kd tree is live, by build order
+    DataToIndexMap treeIndexMap_;      ///< The map from data to build order for the points in the kd tree
+    unsigned int nDead_;               ///< The number of dead points in the kd tree
+    NodeInfoList buffer_;              ///< The buffered points, in order of insertion
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline KDTreeDynamicAlgo<DATA, DIM>::KDTreeDynamicAlgo(const float rebuildFraction) :
+    rebuildFraction_(rebuildFraction),
+    nDead_(0)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline void KDTreeDynamicAlgo<DATA, DIM>::build(const std::vector<KDTreeNodeInfoT<DATA, DIM>> &eltList)
+{
+    this->clear();
+    treeNodeInfos_ = eltList;
+    isLive_.assign(treeNodeInfos_.size(), true);
+
+    for (unsigned int index = 0; index < treeNodeInfos_.size(); ++index)
+    {
+        if (!treeIndexMap_.emplace(treeNodeInfos_[index].data, index).second)
+            throw pandora::StatusCodeException(pandora::STATUS_CODE_INVALID_PARAMETER);
+    }
+
+    if (treeNodeInfos_.empty())
+        return;
+
+    std::array<float, DIM> dimMin, dimMax;
+    dimMin.fill(std::numeric_limits<float>::max());
+    dimMax.fill(-std::numeric_limits<float>::max());
+
+    for (const KDTreeNodeInfoT<DATA, DIM> &nodeInfo : treeNodeInfos_)
+    {
+        for (unsigned int i = 0; i < DIM; ++i)
+        {
+            dimMin[i] = std::min(dimMin[i], nodeInfo.dims[i]);
+            dimMax[i] = std::max(dimMax[i], nodeInfo.dims[i]);
+        }
+    }
+
+    KDTreeBoxT<DIM> region;
+    region.dimmin = dimMin;
+    region.dimmax = dimMax;
+
+    // ATTN The kd tree build reorders its input, so build from a copy to keep the build order
+    NodeInfoList eltListCopy(treeNodeInfos_);
+    tree_.build(eltListCopy, region);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline bool KDTreeDynamicAlgo<DATA, DIM>::insert(const KDTreeNodeInfoT<DATA, DIM> &point)
+{
+    for (const KDTreeNodeInfoT<DATA, DIM> &nodeInfo : buffer_)
+    {
+        if (nodeInfo.data == point.data)
+            return false;
+    }
+
+    const typename DataToIndexMap::const_iterator iter(treeIndexMap_.find(point.data));
+
+    // ATTN A dead point is only revived in place if it has not moved
+    if (treeIndexMap_.end() != iter)
+    {
+        const unsigned int index(iter->second);
+
+        if (isLive_[index])
+            return false;
+
+        if (std::equal(point.dims.begin(), point.dims.end(), treeNodeInfos_[index].dims.begin()))
+        {
+            isLive_[index] = true;
+            --nDead_;
+            return true;
+        }
+    }
+
+    buffer_.push_back(point);
+    return true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline bool KDTreeDynamicAlgo<DATA, DIM>::remove(const DATA &data)
+{
+    const typename DataToIndexMap::const_iterator iter(treeIndexMap_.find(data));
+
+    if ((treeIndexMap_.end() != iter) && isLive_[iter->second])
+    {
+        isLive_[iter->second] = false;
+        ++nDead_;
+        return true;
+    }
+
+    for (typename NodeInfoList::iterator bufferIter = buffer_.begin(); bufferIter != buffer_.end(); ++bufferIter)
+    {
+        if (bufferIter->data == data)
+        {
+            buffer_.erase(bufferIter);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline void KDTreeDynamicAlgo<DATA, DIM>::search(const KDTreeBoxT<DIM> &searchBox, std::vector<KDTreeNodeInfoT<DATA, DIM>> &resRecHitList)
+{
+    this->rebalance();
+
+    if (!treeNodeInfos_.empty())
+    {
+        const typename NodeInfoList::difference_type nPrevious(resRecHitList.size());
+        tree_.search(searchBox, resRecHitList);
+
+        if (nDead_ > 0)
+        {
+            const auto isDead = [this](const KDTreeNodeInfoT<DATA, DIM> &nodeInfo) { return !isLive_[treeIndexMap_.at(nodeInfo.data)]; };
+            resRecHitList.erase(std::remove_if(resRecHitList.begin() + nPrevious, resRecHitList.end(), isDead), resRecHitList.end());
+        }
+    }
+
+    for (const KDTreeNodeInfoT<DATA, DIM> &nodeInfo : buffer_)
+    {
+        bool isInside(true);
+
+        for (unsigned int i = 0; i < DIM; ++i)
+            isInside = isInside && (nodeInfo.dims[i] >= searchBox.dimmin[i]) && (nodeInfo.dims[i] <= searchBox.dimmax[i]);
+
+        if (isInside)
+            resRecHitList.push_back(nodeInfo);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline bool KDTreeDynamicAlgo<DATA, DIM>::empty() const
+{
+    return (0 == this->size());
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline unsigned int KDTreeDynamicAlgo<DATA, DIM>::size() const
+{
+    return (treeNodeInfos_.size() - nDead_ + buffer_.size());
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline void KDTreeDynamicAlgo<DATA, DIM>::clear()
+{
+    tree_.clear();
+    treeNodeInfos_.clear();
+    isLive_.clear();
+    treeIndexMap_.clear();
+    nDead_ = 0;
+    buffer_.clear();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline void KDTreeDynamicAlgo<DATA, DIM>::rebalance()
+{
+    if (static_cast<float>(nDead_ + buffer_.size()) > rebuildFraction_ * static_cast<float>(treeNodeInfos_.size()))
+        this->rebuild();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline void KDTreeDynamicAlgo<DATA, DIM>::rebuild()
+{
+    NodeInfoList liveNodeInfos;
+    liveNodeInfos.reserve(this->size());
+
+    for (unsigned int index = 0; index < treeNodeInfos_.size(); ++index)
+    {
+        if (isLive_[index])
+            liveNodeInfos.push_back(treeNodeInfos_[index]);
+    }
+
+    liveNodeInfos.insert(liveNodeInfos.end(), buffer_.begin(), buffer_.end());
+    this->build(liveNodeInfos);
+}
+
+} // namespace lar_content
+
+#endif // LAR_KD_TREE_DYNAMIC_ALGO_TEMPLATED_H
@@ -0,0 +1,549 @@
+/**
+ *  @file   larpandoracontent/LArUtility/KDTreeImplicitAlgoT.h
+ *
+ *  @brief  Header file for the implicit layout kd tree algo template class
+ *
+ *  $Log: $
+ */
+#ifndef LAR_KD_TREE_IMPLICIT_ALGO_TEMPLATED_H
+#define LAR_KD_TREE_IMPLICIT_ALGO_TEMPLATED_H
+
+#include "KDTreeLinkerToolsT.h"
+
+#include "larpandoracontent/LArHelpers/LArParallelHelper.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace lar_content
+{
+
+/**
+ *  @brief  Class that implements a KDTree partition of space with an implicit, array-based layout. The tree is balanced, with the
+ *          children of node i at 2i+1 and 2i+2, and each leaf holds a bucket of points that is searched linearly. Point coordinates
+ *          are held per dimension, apart from the point payloads, and each node stores the tight bounding box of its points. Results
+ *          are provided in tree order, which depends only upon the input list.
+ */
+template <typename DATA, unsigned DIM = 2>
+class KDTreeImplicitAlgo
+{
+public:
+    /**
+     *  @brief  Constructor
+     *
+     *  @param  bucketSize the maximum number of points in a leaf bucket
+     */
+    KDTreeImplicitAlgo(const unsigned int bucketSize = 16);
+
+    /**
+     *  @brief  Build the KD tree from the "eltList", replacing any existing tree
+     *
+     *  @param  eltList the list of points, which is not modified
+     *  @param  nThreads the number of threads to use for large inputs (zero to use all available hardware threads)
+     */
+    void build(const std::vector<KDTreeNodeInfoT<DATA, DIM>> &eltList, const unsigned int nThreads = 1);
+
+    /**
+     *  @brief  Search in the KDTree for all points that would be contained in the given searchbox, boundaries included
+     *          The found points are appended to resRecHitList
+     *
+     *  @param  searchBox
+     *  @param  resRecHitList
+     */
+    void search(const KDTreeBoxT<DIM> &searchBox, std::vector<KDTreeNodeInfoT<DATA, DIM>> &resRecHitList) const;
+
+    /**
+     *  @brief  Search in the KDTree for all points within a given euclidean distance of a point
+     *          The found points are appended to resRecHitList
+     *
+     *  @param  point the point
+     *  @param  radius the maximum distance, inclusive
+     *  @param  resRecHitList
+     */
+    void searchRadius(
+        const KDTreeNodeInfoT<DATA, DIM> &point, const float radius, std::vector<KDTreeNodeInfoT<DATA, DIM>> &resRecHitList) const;
+
+    /**
+     *  @brief  findNearestNeighbour, with ties going to the point found first in tree order
+     *
+     *  @param  point
+     *  @param  result
+     *  @param  distance
+     */
+    void findNearestNeighbour(const KDTreeNodeInfoT<DATA, DIM> &point, const KDTreeNodeInfoT<DATA, DIM> *&result, float &distance) const;
+
+    /**
+     *  @brief  Whether the tree is empty
+     *
+     *  @return boolean
+     */
+    bool empty() const;
+
+    /**
+     *  @brief  Return the number of points in the tree
+     *
+     *  @return the number of points in the tree
+     */
+    unsigned int size() const;
+
+    /**
+     *  @brief  Clear all allocated structures
+     */
+    void clear();
+
+private:
+    /**
+     *  @brief  NodeRange class, identifying a node and the range of point positions it covers
+     */
+    class NodeRange
+    {
+    public:
+        unsigned int node;  ///< The node index
+        unsigned int low;   ///< The first point position
+        unsigned int high;  ///< The point position following the last
+        unsigned int depth; ///< The node depth
+    };
+
+    /**
+     *  @brief  Recursive kdtree builder. Is called by build()
+     *
+     *  @param  eltList the list of points
+     *  @param  range the node range
+     *  @param  stopDepth the depth at which to record node ranges rather than building them
+     *  @param  pStoppedRanges to receive the node ranges at the stop depth, if building is to stop there
+     */
+    void recBuild(const std::vector<KDTreeNodeInfoT<DATA, DIM>> &eltList, const NodeRange &range, const unsigned int stopDepth,
+        std::vector<NodeRange> *const pStoppedRanges);
+
+    /**
+     *  @brief  Get the son node ranges of a given node range
+     *
+     *  @param  range the node range
+     *  @param  left to receive the left son node range
+     *  @param  right to receive the right son node range
+     */
+    void getSons(const NodeRange &range, NodeRange &left, NodeRange &right) const;
+
+    /**
+     *  @brief  Recursive kdtree search. Is called by search()
+     *
+     *  @param  range
+     *  @param  searchBox
+     *  @param  resRecHitList
+     */
+    void recSearch(const NodeRange &range, const KDTreeBoxT<DIM> &searchBox, std::vector<KDTreeNodeInfoT<DATA, DIM>> &resRecHitList) const;
+
+    /**
+     *  @brief  Recursive radius search. Is called by searchRadius()
+     *
+     *  @param  range
+     *  @param  point
+     *  @param  radius2 the squared maximum distance
+     *  @param  resRecHitList
+     */
+    void recSearchRadius(const NodeRange &range, const KDTreeNodeInfoT<DATA, DIM> &point, const float radius2,
+        std::vector<KDTreeNodeInfoT<DATA, DIM>> &resRecHitList) const;
+
+    /**
+     *  @brief  Recursive nearest neighbour search. Is called by findNearestNeighbour()
+     *
+     *  @param  range
+     *  @param  point
+     *  @param  bestPosition the position of the best match so far
+     *  @param  bestDist2 the squared distance to the best match so far
+     */
+    void recNearestNeighbour(
+        const NodeRange &range, const KDTreeNodeInfoT<DATA, DIM> &point, unsigned int &bestPosition, float &bestDist2) const;
+
+    /**
+     *  @brief  Squared distance from a point to the point at a given position
+     *
+     *  @param  point
+     *  @param  position
+     *
+     *  @return dist2
+     */
+    float dist2(const KDTreeNodeInfoT<DATA, DIM> &point, const unsigned int position) const;
+
+    /**
+     *  @brief  Squared distance from a point to the nearest position in the bounding box of a node
+     *
+     *  @param  node
+     *  @param  point
+     *
+     *  @return the squared distance, zero if the point lies within the bounding box
+     */
+    float nodeDist2(const unsigned int node, const KDTreeNodeInfoT<DATA, DIM> &point) const;
+
+    unsigned int bucketSize_;                           ///< The maximum number of points in a leaf bucket
+    unsigned int leafDepth_;                            ///< The depth of the leaf nodes
+    std::vector<unsigned int> order_;                   ///< The input list index of the point at each position
+    std::array<std::vector<float>, DIM> coordinates_;   ///< The point coordinates for each dimension, by position
+    std::vector<KDTreeNodeInfoT<DATA, DIM>> nodeInfos_; ///< The point payloads and coordinates, by position
+    std::vector<float> nodeMin_;                        ///< The minimum bounding box coordinates for each node, DIM per node
+    std::vector<float> nodeMax_;                        ///< The maximum bounding box coordinates for each node, DIM per node
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline KDTreeImplicitAlgo<DATA, DIM>::KDTreeImplicitAlgo(const unsigned int bucketSize) :
+    bucketSize_(std::max(1u, bucketSize)),
+    leafDepth_(0)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline void KDTreeImplicitAlgo<DATA, DIM>::build(const std::vector<KDTreeNodeInfoT<DATA, DIM>> &eltList, const unsigned int nThreads)
+{
+    this->clear();
+
+    if (eltList.empty())
+        return;
+
+    const unsigned int nPoints(eltList.size());
+
+    // Halving ranges differ in size by at most one at each depth, so all leaves lie at the same depth
+    while (((nPoints - 1) >> leafDepth_) + 1 > bucketSize_)
+        ++leafDepth_;
+
+    const unsigned int nNodes((2u << leafDepth_) - 1);
+    nodeMin_.resize(nNodes * DIM);
+    nodeMax_.resize(nNodes * DIM);
+    order_.resize(nPoints);
+
+    for (unsigned int index = 0; index < nPoints; ++index)
+        order_[index] = index;
+
+    // Build the top of the tree serially, then share the subtrees between threads
+    const unsigned int nUsedThreads(LArParallelHelper::GetNThreads(nThreads, nPoints / (16 * bucketSize_) + 1));
+    unsigned int parallelDepth(0);
+
+    while ((nUsedThreads > 1) && ((1u << parallelDepth) < 4 * nUsedThreads) && (parallelDepth < leafDepth_))
+        ++parallelDepth;
+
+    const NodeRange root{0, 0, nPoints, 0};
+
+    if (0 == parallelDepth)
+    {
+        this->recBuild(eltList, root, leafDepth_ + 1, nullptr);
+    }
+    else
+    {
+        std::vector<NodeRange> subtreeRanges;
+        this->recBuild(eltList, root, parallelDepth, &subtreeRanges);
+
+        LArParallelHelper::ForEach(subtreeRanges.size(), nUsedThreads,
+            [&](const unsigned int index) { this->recBuild(eltList, subtreeRanges[index], leafDepth_ + 1, nullptr); });
+    }
+
+    nodeInfos_.reserve(nPoints);
+
+    for (unsigned int i = 0; i < DIM; ++i)
+        coordinates_[i].reserve(nPoints);
+
+    for (const unsigned int index : order_)
+    {
+        nodeInfos_.push_back(eltList[index]);
+
+        for (unsigned int i = 0; i < DIM; ++i)
+            coordinates_[i].push_back(eltList[index].dims[i]);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline void KDTreeImplicitAlgo<DATA, DIM>::search(
+    const KDTreeBoxT<DIM> &searchBox, std::vector<KDTreeNodeInfoT<DATA, DIM>> &resRecHitList) const
+{
+    if (!this->empty())
+        this->recSearch(NodeRange{0, 0, this->size(), 0}, searchBox, resRecHitList);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline void KDTreeImplicitAlgo<DATA, DIM>::searchRadius(
+    const KDTreeNodeInfoT<DATA, DIM> &point, const float radius, std::vector<KDTreeNodeInfoT<DATA, DIM>> &resRecHitList) const
+{
+    if (!this->empty() && (radius >= 0.f))
+        this->recSearchRadius(NodeRange{0, 0, this->size(), 0}, point, radius * radius, resRecHitList);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline void KDTreeImplicitAlgo<DATA, DIM>::findNearestNeighbour(
+    const KDTreeNodeInfoT<DATA, DIM> &point, const KDTreeNodeInfoT<DATA, DIM> *&result, float &distance) const
+{
+    result = nullptr;
+    distance = std::numeric_limits<float>::max();
+
+    if (this->empty())
+        return;
+
+    unsigned int bestPosition(0);
+    float bestDist2(std::numeric_limits<float>::max());
+    this->recNearestNeighbour(NodeRange{0, 0, this->size(), 0}, point, bestPosition, bestDist2);
+
+    if (bestDist2 != std::numeric_limits<float>::max())
+    {
+        result = &(nodeInfos_[bestPosition]);
+        distance = std::sqrt(bestDist2);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline bool KDTreeImplicitAlgo<DATA, DIM>::empty() const
+{
+    return order_.empty();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline unsigned int KDTreeImplicitAlgo<DATA, DIM>::size() const
+{
+    return order_.size();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline void KDTreeImplicitAlgo<DATA, DIM>::clear()
+{
+    leafDepth_ = 0;
+    order_.clear();
+    nodeInfos_.clear();
+    nodeMin_.clear();
+    nodeMax_.clear();
+
+    for (unsigned int i = 0; i < DIM; ++i)
+        coordinates_[i].clear();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline void KDTreeImplicitAlgo<DATA, DIM>::recBuild(const std::vector<KDTreeNodeInfoT<DATA, DIM>> &eltList, const NodeRange &range,
+    const unsigned int stopDepth, std::vector<NodeRange> *const pStoppedRanges)
+{
+    if (range.depth >= stopDepth)
+    {
+        if (pStoppedRanges)
+            pStoppedRanges->push_back(range);
+
+        return;
+    }
+
+    // Tight bounding box of the points in the range
+    float *const pMin(&nodeMin_[range.node * DIM]);
+    float *const pMax(&nodeMax_[range.node * DIM]);
+
+    for (unsigned int i = 0; i < DIM; ++i)
+    {
+        pMin[i] = std::numeric_limits<float>::max();
+        pMax[i] = -std::numeric_limits<float>::max();
+    }
+
+    for (unsigned int position = range.low; position < range.high; ++position)
+    {
+        for (unsigned int i = 0; i < DIM; ++i)
+        {
+            const float value(eltList[order_[position]].dims[i]);
+            pMin[i] = std::min(pMin[i], value);
+            pMax[i] = std::max(pMax[i], value);
+        }
+    }
+
+    if (range.depth == leafDepth_)
+        return;
+
+    // Split at the middle position along the dimension of greatest extent, ordering equal coordinates by input index
+    unsigned int splitDim(0);
+
+    for (unsigned int i = 1; i < DIM; ++i)
+    {
+        if ((pMax[i] - pMin[i]) > (pMax[splitDim] - pMin[splitDim]))
+            splitDim = i;
+    }
+
+    NodeRange left, right;
+    this->getSons(range, left, right);
+
+    std::nth_element(order_.begin() + range.low, order_.begin() + left.high, order_.begin() + range.high,
+        [&eltList, splitDim](const unsigned int lhs, const unsigned int rhs) {
+            const float lhsValue(eltList[lhs].dims[splitDim]), rhsValue(eltList[rhs].dims[splitDim]);
+            return ((lhsValue < rhsValue) || ((lhsValue == rhsValue) && (lhs < rhs)));
+        });
+
+    this->recBuild(eltList, left, stopDepth, pStoppedRanges);
+    this->recBuild(eltList, right, stopDepth, pStoppedRanges);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline void KDTreeImplicitAlgo<DATA, DIM>::getSons(const NodeRange &range, NodeRange &left, NodeRange &right) const
+{
+    const unsigned int middle(range.low + (range.high - range.low) / 2);
+    left = NodeRange{2 * range.node + 1, range.low, middle, range.depth + 1};
+    right = NodeRange{2 * range.node + 2, middle, range.high, range.depth + 1};
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline void KDTreeImplicitAlgo<DATA, DIM>::recSearch(
+    const NodeRange &range, const KDTreeBoxT<DIM> &searchBox, std::vector<KDTreeNodeInfoT<DATA, DIM>> &resRecHitList) const
+{
+    const float *const pMin(&nodeMin_[range.node * DIM]);
+    const float *const pMax(&nodeMax_[range.node * DIM]);
+    bool isFullyContained(true);
+
+    for (unsigned int i = 0; i < DIM; ++i)
+    {
+        if ((pMax[i] < searchBox.dimmin[i]) || (pMin[i] > searchBox.dimmax[i]))
+            return;
+
+        isFullyContained = isFullyContained && (pMin[i] >= searchBox.dimmin[i]) && (pMax[i] <= searchBox.dimmax[i]);
+    }
+
+    if (isFullyContained)
+    {
+        resRecHitList.insert(resRecHitList.end(), nodeInfos_.begin() + range.low, nodeInfos_.begin() + range.high);
+    }
+    else if (range.depth == leafDepth_)
+    {
+        for (unsigned int position = range.low; position < range.high; ++position)
+        {
+            bool isInside(true);
+
+            for (unsigned int i = 0; i < DIM; ++i)
+            {
+                const float value(coordinates_[i][position]);
+                isInside = isInside && (value >= searchBox.dimmin[i]) && (value <= searchBox.dimmax[i]);
+            }
+
+            if (isInside)
+                resRecHitList.push_back(nodeInfos_[position]);
+        }
+    }
+    else
+    {
+        NodeRange left, right;
+        this->getSons(range, left, right);
+        this->recSearch(left, searchBox, resRecHitList);
+        this->recSearch(right, searchBox, resRecHitList);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline void KDTreeImplicitAlgo<DATA, DIM>::recSearchRadius(const NodeRange &range, const KDTreeNodeInfoT<DATA, DIM> &point,
+    const float radius2, std::vector<KDTreeNodeInfoT<DATA, DIM>> &resRecHitList) const
+{
+    if (this->nodeDist2(range.node, point) > radius2)
+        return;
+
+    if (range.depth == leafDepth_)
+    {
+        for (unsigned int position = range.low; position < range.high; ++position)
+        {
+            if (this->dist2(point, position) <= radius2)
+                resRecHitList.push_back(nodeInfos_[position]);
+        }
+    }
+    else
+    {
+        NodeRange left, right;
+        this->getSons(range, left, right);
+        this->recSearchRadius(left, point, radius2, resRecHitList);
+        this->recSearchRadius(right, point, radius2, resRecHitList);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline void KDTreeImplicitAlgo<DATA, DIM>::recNearestNeighbour(
+    const NodeRange &range, const KDTreeNodeInfoT<DATA, DIM> &point, unsigned int &bestPosition, float &bestDist2) const
+{
+    if (range.depth == leafDepth_)
+    {
+        for (unsigned int position = range.low; position < range.high; ++position)
+        {
+            const float distance2(this->dist2(point, position));
+
+            if (distance2 < bestDist2)
+            {
+                bestDist2 = distance2;
+                bestPosition = position;
+            }
+        }
+
+        return;
+    }
+
+    // Visit the nearer son first, but keep tree order between sons at equal distance so that ties are resolved consistently
+    NodeRange left, right;
+    this->getSons(range, left, right);
+
+    const float leftDist2(this->nodeDist2(left.node, point)), rightDist2(this->nodeDist2(right.node, point));
+    const bool leftFirst(leftDist2 <= rightDist2);
+
+    if ((leftFirst ? leftDist2 : rightDist2) < bestDist2)
+        this->recNearestNeighbour(leftFirst ? left : right, point, bestPosition, bestDist2);
+
+    if ((leftFirst ? rightDist2 : leftDist2) < bestDist2)
+        this->recNearestNeighbour(leftFirst ? right : left, point, bestPosition, bestDist2);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline float KDTreeImplicitAlgo<DATA, DIM>::dist2(const KDTreeNodeInfoT<DATA, DIM> &point, const unsigned int position) const
+{
+    double d = 0.;
+
+    for (unsigned int i = 0; i < DIM; ++i)
+    {
+        const double diff = point.dims[i] - coordinates_[i][position];
+        d += diff * diff;
+    }
+
+    return (float)d;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline float KDTreeImplicitAlgo<DATA, DIM>::nodeDist2(const unsigned int node, const KDTreeNodeInfoT<DATA, DIM> &point) const
+{
+    const float *const pMin(&nodeMin_[node * DIM]);
+    const float *const pMax(&nodeMax_[node * DIM]);
+    double d = 0.;
+
+    for (unsigned int i = 0; i < DIM; ++i)
+    {
+        const double below = static_cast<double>(pMin[i]) - point.dims[i], above = static_cast<double>(point.dims[i]) - pMax[i];
+        const double nearest = std::max(0., std::max(below, above));
+        d += nearest * nearest;
+    }
+
+    return (float)d;
+}
+
+} // namespace lar_content
+
+#endif // LAR_KD_TREE_IMPLICIT_ALGO_TEMPLATED_H
@@ -10,6 +10,12 @@
 
 #include "KDTreeLinkerToolsT.h"
 
+#include "larpandoracontent/LArHelpers/LArMemoryAccountingHelper.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
 #include <vector>
 
 namespace lar_content
@@ -22,6 +28,9 @@ template <typename DATA, unsigned DIM = 2>
 class KDTreeLinkerAlgo
 {
 public:
+    typedef std::pair<float, const KDTreeNodeInfoT<DATA, DIM> *> DistanceNodePair;
+    typedef std::vector<DistanceNodePair> DistanceNodeVector;
+
     /**
      *  @brief  Default constructor
      */
@@ -58,6 +67,27 @@ public:
      */
     void findNearestNeighbour(const KDTreeNodeInfoT<DATA, DIM> &point, const KDTreeNodeInfoT<DATA, DIM> *&result, float &distance);
 
+    /**
+     *  @brief  Search in the KDTree for all points within a given euclidean distance of a point, pruning by the true distance to each
+     *          region rather than by a bounding box. The found points are appended to resRecHitList, in the order that search() would
+     *          provide them, so a caller may clear and reuse the same list for many queries.
+     *
+     *  @param  point the point
+     *  @param  radius the maximum distance, inclusive
+     *  @param  resRecHitList to receive the found points
+     */
+    void searchRadius(const KDTreeNodeInfoT<DATA, DIM> &point, const float radius, std::vector<KDTreeNodeInfoT<DATA, DIM>> &resRecHitList);
+
+    /**
+     *  @brief  Find the k points closest to a given point. The results buffer is cleared and then filled with (distance, point) pairs in
+     *          order of increasing distance, with ties in tree order, so a caller may reuse the same buffer for many queries.
+     *
+     *  @param  point the point
+     *  @param  k the maximum number of points to find
+     *  @param  results to receive the distances to and addresses of the closest points
+     */
+    void findKNearest(const KDTreeNodeInfoT<DATA, DIM> &point, const unsigned int k, DistanceNodeVector &results);
+
     /**
      *  @brief  Whether the tree is empty
      *
@@ -109,8 +139,10 @@ private:
      *
      *  @param  current
      *  @param  trackBox
+     *  @param  recHits to receive the found points
      */
-    void recSearch(const KDTreeNodeT<DATA, DIM> *current, const KDTreeBoxT<DIM> &trackBox);
+    void recSearch(
+        const KDTreeNodeT<DATA, DIM> *current, const KDTreeBoxT<DIM> &trackBox, std::vector<KDTreeNodeInfoT<DATA, DIM>> &recHits) const;
 
     /**
      *  @brief  Recursive nearest neighbour search. Is called by findNearestNeighbour()
@@ -124,12 +156,35 @@ private:
     void recNearestNeighbour(unsigned depth, const KDTreeNodeT<DATA, DIM> *current, const KDTreeNodeInfoT<DATA, DIM> &point,
         const KDTreeNodeT<DATA, DIM> *&best_match, float &best_dist);
 
+    /**
+     *  @brief  Recursive radius search. Is called by searchRadius()
+     *
+     *  @param  current
+     *  @param  point
+     *  @param  radius2 the squared maximum distance
+     *  @param  recHits to receive the found points
+     */
+    void recSearchRadius(const KDTreeNodeT<DATA, DIM> *current, const KDTreeNodeInfoT<DATA, DIM> &point, const float radius2,
+        std::vector<KDTreeNodeInfoT<DATA, DIM>> &recHits) const;
+
+    /**
+     *  @brief  Recursive k nearest neighbour search. Is called by findKNearest()
+     *
+     *  @param  current
+     *  @param  point
+     *  @param  k
+     *  @param  results the heap of the closest points found so far, holding squared distances
+     */
+    void recKNearest(const KDTreeNodeT<DATA, DIM> *current, const KDTreeNodeInfoT<DATA, DIM> &point, const unsigned int k,
+        DistanceNodeVector &results) const;
+
     /**
      *  @brief  Add all elements of an subtree to the closest elements. Used during the recSearch().
      *
      *  @param  current
+     *  @param  recHits to receive the found points
      */
-    void addSubtree(const KDTreeNodeT<DATA, DIM> *current);
+    void addSubtree(const KDTreeNodeT<DATA, DIM> *current, std::vector<KDTreeNodeInfoT<DATA, DIM>> &recHits) const;
 
     /**
      *  @brief  dist2
@@ -141,6 +196,16 @@ private:
      */
     float dist2(const KDTreeNodeInfoT<DATA, DIM> &a, const KDTreeNodeInfoT<DATA, DIM> &b) const;
 
+    /**
+     *  @brief  Squared distance from a point to the nearest and farthest positions in a region
+     *
+     *  @param  region
+     *  @param  point
+     *  @param  minDist2 to receive the squared distance to the nearest position in the region
+     *  @param  maxDist2 to receive the squared distance to the farthest position in the region
+     */
+    void regionDist2(const KDTreeBoxT<DIM> &region, const KDTreeNodeInfoT<DATA, DIM> &point, float &minDist2, float &maxDist2) const;
+
     /**
      *  @brief  Frees the KDTree.
      */
@@ -151,8 +216,8 @@ private:
     int nodePoolSize_;                 ///< The node pool size
     int nodePoolPos_;                  ///< The node pool position
 
-    std::vector<KDTreeNodeInfoT<DATA, DIM>> *closestNeighbour; ///< The closest neighbour
-    std::vector<KDTreeNodeInfoT<DATA, DIM>> *initialEltList;   ///< The initial element list
+    std::vector<KDTreeNodeInfoT<DATA, DIM>> *initialEltList; ///< The initial element list
+    LArMemoryAccountingHelper::MemoryRecord memoryRecord_;   ///< The memory accounting record for the node pool
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -164,8 +229,8 @@ inline KDTreeLinkerAlgo<DATA, DIM>::KDTreeLinkerAlgo() :
     nodePool_(nullptr),
     nodePoolSize_(-1),
     nodePoolPos_(-1),
-    closestNeighbour(nullptr),
-    initialEltList(nullptr)
+    initialEltList(nullptr),
+    memoryRecord_(LArMemoryAccountingHelper::KD_TREE_MEMORY)
 {
 }
 
@@ -189,6 +254,7 @@ inline void KDTreeLinkerAlgo<DATA, DIM>::build(std::vector<KDTreeNodeInfoT<DATA,
 
         nodePoolSize_ = mysize * 2 - 1;
         nodePool_ = new KDTreeNodeT<DATA, DIM>[nodePoolSize_];
+        memoryRecord_.Allocate(nodePoolSize_ * sizeof(KDTreeNodeT<DATA, DIM>));
 
         // Here we build the KDTree
         root_ = this->recBuild(0, mysize, 0, region);
@@ -248,18 +314,16 @@ inline int KDTreeLinkerAlgo<DATA, DIM>::medianSearch(int low, int high, int tree
 template <typename DATA, unsigned DIM>
 inline void KDTreeLinkerAlgo<DATA, DIM>::search(const KDTreeBoxT<DIM> &trackBox, std::vector<KDTreeNodeInfoT<DATA, DIM>> &recHits)
 {
+    // ATTN Found points are passed down the recursion, rather than held by the tree, so concurrent searches of one tree are safe
     if (root_)
-    {
-        closestNeighbour = &recHits;
-        this->recSearch(root_, trackBox);
-        closestNeighbour = nullptr;
-    }
+        this->recSearch(root_, trackBox, recHits);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 template <typename DATA, unsigned DIM>
-inline void KDTreeLinkerAlgo<DATA, DIM>::recSearch(const KDTreeNodeT<DATA, DIM> *current, const KDTreeBoxT<DIM> &trackBox)
+inline void KDTreeLinkerAlgo<DATA, DIM>::recSearch(
+    const KDTreeNodeT<DATA, DIM> *current, const KDTreeBoxT<DIM> &trackBox, std::vector<KDTreeNodeInfoT<DATA, DIM>> &recHits) const
 {
     // By construction, current can't be null
     //assert(current != 0);
@@ -279,7 +343,7 @@ inline void KDTreeLinkerAlgo<DATA, DIM>::recSearch(const KDTreeNodeT<DATA, DIM>
         }
 
         if (isInside)
-            closestNeighbour->push_back(current->info);
+            recHits.push_back(current->info);
     }
     else
     {
@@ -298,11 +362,11 @@ inline void KDTreeLinkerAlgo<DATA, DIM>::recSearch(const KDTreeNodeT<DATA, DIM>
 
         if (isFullyContained)
         {
-            this->addSubtree(current->left);
+            this->addSubtree(current->left, recHits);
         }
         else if (hasIntersection)
         {
-            this->recSearch(current->left, trackBox);
+            this->recSearch(current->left, trackBox, recHits);
         }
 
         //if region( v->right ) is fully contained in the rectangle
@@ -319,11 +383,11 @@ inline void KDTreeLinkerAlgo<DATA, DIM>::recSearch(const KDTreeNodeT<DATA, DIM>
 
         if (isFullyContained)
         {
-            this->addSubtree(current->right);
+            this->addSubtree(current->right, recHits);
         }
         else if (hasIntersection)
         {
-            this->recSearch(current->right, trackBox);
+            this->recSearch(current->right, trackBox, recHits);
         }
     }
 }
@@ -418,7 +482,113 @@ inline void KDTreeLinkerAlgo<DATA, DIM>::recNearestNeighbour(unsigned int depth,
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 template <typename DATA, unsigned DIM>
-inline void KDTreeLinkerAlgo<DATA, DIM>::addSubtree(const KDTreeNodeT<DATA, DIM> *current)
+inline void KDTreeLinkerAlgo<DATA, DIM>::searchRadius(
+    const KDTreeNodeInfoT<DATA, DIM> &point, const float radius, std::vector<KDTreeNodeInfoT<DATA, DIM>> &recHits)
+{
+    if (root_ && (radius >= 0.f))
+        this->recSearchRadius(root_, point, radius * radius, recHits);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline void KDTreeLinkerAlgo<DATA, DIM>::recSearchRadius(const KDTreeNodeT<DATA, DIM> *current, const KDTreeNodeInfoT<DATA, DIM> &point,
+    const float radius2, std::vector<KDTreeNodeInfoT<DATA, DIM>> &recHits) const
+{
+    if ((current->left == nullptr) && (current->right == nullptr))
+    {
+        // Leaf case
+        if (this->dist2(point, current->info) <= radius2)
+            recHits.push_back(current->info);
+    }
+    else
+    {
+        // Node case, visiting the sons in the order used by recSearch()
+        for (const KDTreeNodeT<DATA, DIM> *const son : {current->left, current->right})
+        {
+            float minDist2(0.f), maxDist2(0.f);
+            this->regionDist2(son->region, point, minDist2, maxDist2);
+
+            if (maxDist2 <= radius2)
+            {
+                this->addSubtree(son, recHits);
+            }
+            else if (minDist2 <= radius2)
+            {
+                this->recSearchRadius(son, point, radius2, recHits);
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline void KDTreeLinkerAlgo<DATA, DIM>::findKNearest(
+    const KDTreeNodeInfoT<DATA, DIM> &point, const unsigned int k, DistanceNodeVector &results)
+{
+    results.clear();
+
+    if (!root_ || (0 == k))
+        return;
+
+    this->recKNearest(root_, point, k, results);
+
+    // ATTN Leaves are distinct nodes in the pool, so their addresses order ties consistently with the tree layout
+    std::sort(results.begin(), results.end());
+
+    for (DistanceNodePair &result : results)
+        result.first = std::sqrt(result.first);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline void KDTreeLinkerAlgo<DATA, DIM>::recKNearest(
+    const KDTreeNodeT<DATA, DIM> *current, const KDTreeNodeInfoT<DATA, DIM> &point, const unsigned int k, DistanceNodeVector &results) const
+{
+    if ((current->left == nullptr) && (current->right == nullptr))
+    {
+        // Leaf case, with results held as a max heap on squared distance
+        const DistanceNodePair candidate(this->dist2(point, current->info), &(current->info));
+
+        if (results.size() < k)
+        {
+            results.push_back(candidate);
+            std::push_heap(results.begin(), results.end());
+        }
+        else if (candidate < results.front())
+        {
+            std::pop_heap(results.begin(), results.end());
+            results.back() = candidate;
+            std::push_heap(results.begin(), results.end());
+        }
+    }
+    else
+    {
+        // Node case, visiting the nearer son first so that the farther son can more often be pruned
+        float leftMinDist2(0.f), rightMinDist2(0.f), maxDist2(0.f);
+        this->regionDist2(current->left->region, point, leftMinDist2, maxDist2);
+        this->regionDist2(current->right->region, point, rightMinDist2, maxDist2);
+
+        const bool leftFirst(leftMinDist2 <= rightMinDist2);
+        const KDTreeNodeT<DATA, DIM> *const nearSon(leftFirst ? current->left : current->right);
+        const KDTreeNodeT<DATA, DIM> *const farSon(leftFirst ? current->right : current->left);
+        const float nearMinDist2(leftFirst ? leftMinDist2 : rightMinDist2), farMinDist2(leftFirst ? rightMinDist2 : leftMinDist2);
+
+        if ((results.size() < k) || (nearMinDist2 <= results.front().first))
+            this->recKNearest(nearSon, point, k, results);
+
+        if ((results.size() < k) || (farMinDist2 <= results.front().first))
+            this->recKNearest(farSon, point, k, results);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline void KDTreeLinkerAlgo<DATA, DIM>::addSubtree(
+    const KDTreeNodeT<DATA, DIM> *current, std::vector<KDTreeNodeInfoT<DATA, DIM>> &recHits) const
 {
     // By construction, current can't be null
     //assert(current != 0);
@@ -426,13 +596,13 @@ inline void KDTreeLinkerAlgo<DATA, DIM>::addSubtree(const KDTreeNodeT<DATA, DIM>
     if ((current->left == nullptr) && (current->right == nullptr))
     {
         // Leaf case
-        closestNeighbour->push_back(current->info);
+        recHits.push_back(current->info);
     }
     else
     {
         // Node case
-        this->addSubtree(current->left);
-        this->addSubtree(current->right);
+        this->addSubtree(current->left, recHits);
+        this->addSubtree(current->right, recHits);
     }
 }
 
@@ -454,10 +624,33 @@ inline float KDTreeLinkerAlgo<DATA, DIM>::dist2(const KDTreeNodeInfoT<DATA, DIM>
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+template <typename DATA, unsigned DIM>
+inline void KDTreeLinkerAlgo<DATA, DIM>::regionDist2(
+    const KDTreeBoxT<DIM> &region, const KDTreeNodeInfoT<DATA, DIM> &point, float &minDist2, float &maxDist2) const
+{
+    double dMin = 0., dMax = 0.;
+
+    for (unsigned i = 0; i < DIM; ++i)
+    {
+        const double belowMin = static_cast<double>(region.dimmin[i]) - point.dims[i];
+        const double aboveMax = static_cast<double>(point.dims[i]) - region.dimmax[i];
+        const double nearest = std::max(0., std::max(belowMin, aboveMax));
+        const double farthest = std::max(std::fabs(belowMin), std::fabs(aboveMax));
+        dMin += nearest * nearest;
+        dMax += farthest * farthest;
+    }
+
+    minDist2 = (float)dMin;
+    maxDist2 = (float)dMax;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template <typename DATA, unsigned DIM>
 inline void KDTreeLinkerAlgo<DATA, DIM>::clearTree()
 {
     delete[] nodePool_;
+    memoryRecord_.Clear();
     nodePool_ = nullptr;
     root_ = nullptr;
     nodePoolSize_ = -1;
@@ -10,6 +10,9 @@
 
 #include "larpandoracontent/LArUtility/ListPruningAlgorithm.h"
 
+#include <algorithm>
+#include <type_traits>
+
 using namespace pandora;
 
 namespace lar_content
@@ -24,87 +27,71 @@ ListPruningAlgorithm::ListPruningAlgorithm() : m_warnIfObjectsUnavailable(true)
 StatusCode ListPruningAlgorithm::Run()
 {
     for (const std::string &listName : m_pfoListNames)
-    {
-        try
-        {
-            const PfoList *pPfoList(nullptr);
-            const StatusCode statusCode(PandoraContentApi::GetList(*this, listName, pPfoList));
+        this->PruneList<ParticleFlowObject>(listName, "pfo", "Pfo");
 
-            if (STATUS_CODE_SUCCESS != statusCode)
-                throw StatusCodeException(statusCode);
+    for (const std::string &listName : m_clusterListNames)
+        this->PruneList<Cluster>(listName, "cluster", "Cluster");
 
-            const PfoList pfoList(*pPfoList);
+    for (const std::string &listName : m_vertexListNames)
+        this->PruneList<Vertex>(listName, "vertex", "Vertex");
 
-            for (const ParticleFlowObject *const pPfo : pfoList)
-            {
-                if (STATUS_CODE_SUCCESS != PandoraContentApi::Delete(*this, pPfo, listName))
-                    std::cout << "ListPruningAlgorithm: Could not delete Pfo." << std::endl;
-            }
-        }
-        catch (StatusCodeException &)
-        {
-            if (PandoraContentApi::GetSettings(*this)->ShouldDisplayAlgorithmInfo())
-                std::cout << "ListPruningAlgorithm: pfo list " << listName << " unavailable." << std::endl;
-        }
-    }
+    return STATUS_CODE_SUCCESS;
+}
 
-    for (const std::string &listName : m_clusterListNames)
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+void ListPruningAlgorithm::PruneList(const std::string &listName, const std::string &listType, const std::string &objectType) const
+{
+    const MANAGED_CONTAINER<const T *> *pList(nullptr);
+
+    if ((STATUS_CODE_SUCCESS != PandoraContentApi::GetList(*this, listName, pList)) || !pList)
     {
-        try
-        {
-            const ClusterList *pClusterList(nullptr);
-            const StatusCode statusCode(PandoraContentApi::GetList(*this, listName, pClusterList));
+        if (PandoraContentApi::GetSettings(*this)->ShouldDisplayAlgorithmInfo())
+            std::cout << "ListPruningAlgorithm: " << listType << " list " << listName << " unavailable." << std::endl;
 
-            if (STATUS_CODE_SUCCESS != statusCode)
-                throw StatusCodeException(statusCode);
+        return;
+    }
 
-            const ClusterList clusterList(*pClusterList);
+    // ATTN Pfos carry no availability flag. Unavailable clusters and vertices are only skipped if no warning is requested for them.
+    constexpr bool hasAvailability(!std::is_same<T, ParticleFlowObject>::value);
+    const bool shouldWarn(!hasAvailability || m_warnIfObjectsUnavailable);
 
-            for (const Cluster *const pCluster : clusterList)
-            {
-                if (!m_warnIfObjectsUnavailable && !pCluster->IsAvailable())
-                    continue;
+    MANAGED_CONTAINER<const T *> deletionList;
 
-                if (STATUS_CODE_SUCCESS != PandoraContentApi::Delete(*this, pCluster, listName) && m_warnIfObjectsUnavailable)
-                    std::cout << "ListPruningAlgorithm: Could not delete Cluster." << std::endl;
-            }
-        }
-        catch (StatusCodeException &)
+    for (const T *const pT : *pList)
+    {
+        if constexpr (hasAvailability)
         {
-            if (PandoraContentApi::GetSettings(*this)->ShouldDisplayAlgorithmInfo())
-                std::cout << "ListPruningAlgorithm: cluster list " << listName << " unavailable." << std::endl;
+            if (!m_warnIfObjectsUnavailable && !pT->IsAvailable())
+                continue;
         }
+
+        deletionList.push_back(pT);
     }
 
-    for (const std::string &listName : m_vertexListNames)
-    {
-        try
-        {
-            const VertexList *pVertexList(nullptr);
-            const StatusCode statusCode(PandoraContentApi::GetList(*this, listName, pVertexList));
+    if (deletionList.empty())
+        return;
 
-            if (STATUS_CODE_SUCCESS != statusCode)
-                throw StatusCodeException(statusCode);
+    // Delete all objects in a single call, only falling back to deleting (and reporting) the remaining objects one by one on failure
+    if (STATUS_CODE_SUCCESS == PandoraContentApi::Delete(*this, &deletionList, listName))
+        return;
 
-            const VertexList vertexList(*pVertexList);
+    const MANAGED_CONTAINER<const T *> *pRemainingList(nullptr);
 
-            for (const Vertex *const pVertex : vertexList)
-            {
-                if (!m_warnIfObjectsUnavailable && !pVertex->IsAvailable())
-                    continue;
+    if ((STATUS_CODE_SUCCESS != PandoraContentApi::GetList(*this, listName, pRemainingList)) || !pRemainingList)
+        return;
 
-                if (STATUS_CODE_SUCCESS != PandoraContentApi::Delete(*this, pVertex, listName) && m_warnIfObjectsUnavailable)
-                    std::cout << "ListPruningAlgorithm: Could not delete Vertex." << std::endl;
-            }
-        }
-        catch (StatusCodeException &)
-        {
-            if (PandoraContentApi::GetSettings(*this)->ShouldDisplayAlgorithmInfo())
-                std::cout << "ListPruningAlgorithm: vertex list " << listName << " unavailable." << std::endl;
-        }
-    }
+    const MANAGED_CONTAINER<const T *> remainingList(*pRemainingList);
 
-    return STATUS_CODE_SUCCESS;
+    for (const T *const pT : deletionList)
+    {
+        if (remainingList.end() == std::find(remainingList.begin(), remainingList.end(), pT))
+            continue;
+
+        if ((STATUS_CODE_SUCCESS != PandoraContentApi::Delete(*this, pT, listName)) && shouldWarn)
+            std::cout << "ListPruningAlgorithm: Could not delete " << objectType << "." << std::endl;
+    }
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
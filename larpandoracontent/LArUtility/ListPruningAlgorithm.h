@@ -28,6 +28,16 @@ private:
     pandora::StatusCode Run();
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
+    /**
+     *  @brief  Delete the objects in a named list, in a single operation where possible
+     *
+     *  @param  listName the name of the list
+     *  @param  listType the description of the list type, for printouts
+     *  @param  objectType the description of the object type, for printouts
+     */
+    template <typename T>
+    void PruneList(const std::string &listName, const std::string &listType, const std::string &objectType) const;
+
     pandora::StringVector m_pfoListNames;     ///< The pfo list names
     pandora::StringVector m_clusterListNames; ///< The cluster list names
     pandora::StringVector m_vertexListNames;  ///< The vertex list names
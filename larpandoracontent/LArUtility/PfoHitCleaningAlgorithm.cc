@@ -17,6 +17,12 @@ using namespace pandora;
 namespace lar_content
 {
 
+PfoHitCleaningAlgorithm::PfoHitCleaningAlgorithm() : m_batchClusterDeletion(false)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode PfoHitCleaningAlgorithm::Run()
 {
     for (unsigned int i = 0; i < m_pfoListNames.size(); ++i)
@@ -27,19 +33,25 @@ StatusCode PfoHitCleaningAlgorithm::Run()
         const PfoList *pList(nullptr);
         PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_INITIALIZED, !=, PandoraContentApi::GetList(*this, pfoListName, pList));
 
-        if (pList && !pList->empty())
+        if (!pList || pList->empty())
+            continue;
+
+        if (m_batchClusterDeletion)
         {
-            for (const ParticleFlowObject *pPfo : *pList)
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->CleanPfosBatched(*pList, clusterListName));
+            continue;
+        }
+
+        for (const ParticleFlowObject *pPfo : *pList)
+        {
+            ClusterList clustersToRemove;
+            LArPfoHelper::GetClusters(pPfo, TPC_3D, clustersToRemove);
+
+            for (const Cluster *pCluster : clustersToRemove)
             {
-                ClusterList clustersToRemove;
-                LArPfoHelper::GetClusters(pPfo, TPC_3D, clustersToRemove);
-
-                for (const Cluster *pCluster : clustersToRemove)
-                {
-                    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::RemoveFromPfo(*this, pPfo, pCluster));
-                    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
-                        PandoraContentApi::Delete<Cluster>(*this, pCluster, clusterListName));
-                }
+                PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::RemoveFromPfo(*this, pPfo, pCluster));
+                PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
+                    PandoraContentApi::Delete<Cluster>(*this, pCluster, clusterListName));
             }
         }
     }
@@ -49,12 +61,50 @@ StatusCode PfoHitCleaningAlgorithm::Run()
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode PfoHitCleaningAlgorithm::CleanPfosBatched(const PfoList &pfoList, const std::string &clusterListName) const
+{
+    const ClusterList *pClusterList(nullptr);
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_INITIALIZED, !=, PandoraContentApi::GetList(*this, clusterListName, pClusterList));
+
+    ClusterSet namedListClusters;
+
+    if (pClusterList)
+        namedListClusters.insert(pClusterList->begin(), pClusterList->end());
+
+    // ATTN Clusters absent from the named list are detached but not deleted, matching the tolerated not found case of the default mode
+    ClusterList clustersToDelete;
+
+    for (const ParticleFlowObject *pPfo : pfoList)
+    {
+        ClusterList clustersToRemove;
+        LArPfoHelper::GetClusters(pPfo, TPC_3D, clustersToRemove);
+
+        for (const Cluster *pCluster : clustersToRemove)
+        {
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::RemoveFromPfo(*this, pPfo, pCluster));
+
+            if (namedListClusters.erase(pCluster))
+                clustersToDelete.push_back(pCluster);
+        }
+    }
+
+    if (!clustersToDelete.empty())
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::Delete(*this, &clustersToDelete, clusterListName));
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode PfoHitCleaningAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
 {
     PANDORA_RETURN_RESULT_IF_AND_IF(
         STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadVectorOfValues(xmlHandle, "PfoListNames", m_pfoListNames));
     PANDORA_RETURN_RESULT_IF_AND_IF(
         STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadVectorOfValues(xmlHandle, "ClusterListNames", m_clusterListNames));
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "BatchClusterDeletion", m_batchClusterDeletion));
 
     if (m_pfoListNames.size() != m_clusterListNames.size())
     {
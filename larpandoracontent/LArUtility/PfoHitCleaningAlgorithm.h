@@ -18,12 +18,29 @@ namespace lar_content
  */
 class PfoHitCleaningAlgorithm : public pandora::Algorithm
 {
+public:
+    /**
+     *  @brief  Default constructor
+     */
+    PfoHitCleaningAlgorithm();
+
 private:
     pandora::StatusCode Run();
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
+    /**
+     *  @brief  Remove the 3D clusters from a list of pfos, collecting those in the named cluster list and deleting them in one operation
+     *
+     *  @param  pfoList the list of pfos
+     *  @param  clusterListName the name of the list holding the 3D clusters
+     *
+     *  @return status code
+     */
+    pandora::StatusCode CleanPfosBatched(const pandora::PfoList &pfoList, const std::string &clusterListName) const;
+
     pandora::StringVector m_pfoListNames;     ///< The list of pfo list names
     pandora::StringVector m_clusterListNames; ///< The list of cluster list names
+    bool m_batchClusterDeletion;              ///< Whether to delete the removed clusters for each pfo list in a single operation
 };
 
 } // namespace lar_content
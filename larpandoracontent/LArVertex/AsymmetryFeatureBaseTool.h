@@ -29,30 +29,35 @@ public:
      *
      *  @param  pAlgorithm address of the calling algorithm
      *  @param  pVertex address of the vertex
+     *  @param  vertexFeatureContext the geometry shared by the feature tools for this vertex
      *  @param  slidingFitDataListMap map of the sliding fit data lists
      *  @param  showerClusterListMap map of the shower cluster lists
      *
      *  @return the asymmetry feature
      */
     void Run(LArMvaHelper::MvaFeatureVector &featureVector, const VertexSelectionBaseAlgorithm *const pAlgorithm,
-        const pandora::Vertex *const pVertex, const VertexSelectionBaseAlgorithm::SlidingFitDataListMap &slidingFitDataListMap,
+        const pandora::Vertex *const pVertex, const VertexSelectionBaseAlgorithm::VertexFeatureContext &vertexFeatureContext,
+        const VertexSelectionBaseAlgorithm::SlidingFitDataListMap &slidingFitDataListMap,
         const VertexSelectionBaseAlgorithm::ClusterListMap &, const VertexSelectionBaseAlgorithm::KDTreeMap &,
         const VertexSelectionBaseAlgorithm::ShowerClusterListMap &showerClusterListMap, const float, float &);
 
 protected:
+    typedef std::vector<const pandora::CaloHitVector *> CaloHitVectorList; ///< The sorted calo hits of the asymmetry clusters
+
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
     /**
      *  @brief  Get the asymmetry feature for a given view
      *
-     *  @param  vertexPosition2D the vertex position projected into this view
+     *  @param  vertexFeatureContext the geometry shared by the feature tools for this vertex
+     *  @param  hitType the view
      *  @param  slidingFitDataList the list of sliding fit data objects for this view
      *  @param  showerClusterList the list of shower cluster objects for this view
      *
      *  @return the asymmetry feature
      */
-    virtual float GetAsymmetryForView(const pandora::CartesianVector &vertexPosition2D,
-        const VertexSelectionBaseAlgorithm::SlidingFitDataList &slidingFitDataList,
+    virtual float GetAsymmetryForView(const VertexSelectionBaseAlgorithm::VertexFeatureContext &vertexFeatureContext,
+        const pandora::HitType hitType, const VertexSelectionBaseAlgorithm::SlidingFitDataList &slidingFitDataList,
         const VertexSelectionBaseAlgorithm::ShowerClusterList &showerClusterList) const = 0;
 
     /**
@@ -70,13 +75,13 @@ protected:
      *
      *  @param  useEnergyMetrics whether to use energy-based metrics instead of hit-counting-based metrics
      *  @param  vertexPosition2D the vertex position in this view
-     *  @param  asymmetryCluster the vector of cluster objects to be used in the asymmetry calculation
+     *  @param  asymmetryCaloHits the position-sorted calo hits of each cluster to be used in the asymmetry calculation
      *  @param  localWeightedDirectionSum the local event axis
      *
      *  @return the asymmetry feature
      */
     virtual float CalculateAsymmetry(const bool useEnergyMetrics, const pandora::CartesianVector &vertexPosition2D,
-        const pandora::ClusterVector &asymmetryClusters, const pandora::CartesianVector &localWeightedDirectionSum) const;
+        const CaloHitVectorList &asymmetryCaloHits, const pandora::CartesianVector &localWeightedDirectionSum) const;
 
     float m_maxAsymmetryDistance; ///< The max distance between cluster (any hit) and vertex to calculate asymmetry score
 };
@@ -10,9 +10,11 @@
 
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
+#include "larpandoracontent/LArHelpers/LArSlidingFitCacheHelper.h"
 
 #include "larpandoracontent/LArVertex/CandidateVertexCreationAlgorithm.h"
 
+#include <cmath>
 #include <utility>
 
 using namespace pandora;
@@ -37,7 +39,8 @@ CandidateVertexCreationAlgorithm::CandidateVertexCreationAlgorithm() :
     m_minNearbyCrossingDistanceSquared(0.5f * 0.5f),
     m_reducedCandidates(false),
     m_selectionCutFactorMax(2.f),
-    m_nClustersPassingMaxCutsPar(26.f)
+    m_nClustersPassingMaxCutsPar(26.f),
+    m_candidateMergeDistance(0.f)
 {
 }
 
@@ -225,13 +228,7 @@ void CandidateVertexCreationAlgorithm::CreateEndpointVertex(
     if (chiSquared > m_chiSquaredCut)
         return;
 
-    PandoraContentApi::Vertex::Parameters parameters;
-    parameters.m_position = position3D;
-    parameters.m_vertexLabel = VERTEX_INTERACTION;
-    parameters.m_vertexType = VERTEX_3D;
-
-    const Vertex *pVertex(NULL);
-    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::Vertex::Create(*this, parameters, pVertex));
+    (void)this->CreateCandidateVertex(position3D);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -255,20 +252,38 @@ void CandidateVertexCreationAlgorithm::CreateCrossingCandidates(
 void CandidateVertexCreationAlgorithm::FindCrossingPoints(const ClusterVector &clusterVector, CartesianPointVector &crossingPoints) const
 {
     ClusterToSpacepointsMap clusterToSpacepointsMap;
+    ClusterToBoundingBoxMap clusterToBoundingBoxMap;
 
     for (const Cluster *const pCluster : clusterVector)
     {
         ClusterToSpacepointsMap::iterator mapIter(clusterToSpacepointsMap.emplace(pCluster, CartesianPointVector()).first);
         this->GetSpacepoints(pCluster, mapIter->second);
+
+        BoundingBox boundingBox(CartesianVector(0.f, 0.f, 0.f), CartesianVector(0.f, 0.f, 0.f));
+        this->GetSpacepointBoundingBox(mapIter->second, boundingBox.first, boundingBox.second);
+        (void)clusterToBoundingBoxMap.emplace(pCluster, boundingBox);
     }
 
     for (const Cluster *const pCluster1 : clusterVector)
     {
+        const CartesianVector &minimum1(clusterToBoundingBoxMap.at(pCluster1).first);
+        const CartesianVector &maximum1(clusterToBoundingBoxMap.at(pCluster1).second);
+
         for (const Cluster *const pCluster2 : clusterVector)
         {
             if (pCluster1 == pCluster2)
                 continue;
 
+            // ATTN No pair of space points can be closer than the separation of the bounding boxes, which is accumulated in the same order
+            const CartesianVector &minimum2(clusterToBoundingBoxMap.at(pCluster2).first);
+            const CartesianVector &maximum2(clusterToBoundingBoxMap.at(pCluster2).second);
+            const float dx(std::max(0.f, std::max(minimum2.GetX() - maximum1.GetX(), minimum1.GetX() - maximum2.GetX())));
+            const float dy(std::max(0.f, std::max(minimum2.GetY() - maximum1.GetY(), minimum1.GetY() - maximum2.GetY())));
+            const float dz(std::max(0.f, std::max(minimum2.GetZ() - maximum1.GetZ(), minimum1.GetZ() - maximum2.GetZ())));
+
+            if ((dx * dx + dy * dy + dz * dz) >= m_maxCrossingSeparationSquared)
+                continue;
+
             this->FindCrossingPoints(clusterToSpacepointsMap.at(pCluster1), clusterToSpacepointsMap.at(pCluster2), crossingPoints);
         }
     }
@@ -369,16 +384,84 @@ void CandidateVertexCreationAlgorithm::CreateCrossingVertices(const CartesianPoi
             if (chiSquared > m_chiSquaredCut)
                 continue;
 
-            PandoraContentApi::Vertex::Parameters parameters;
-            parameters.m_position = position3D;
-            parameters.m_vertexLabel = VERTEX_INTERACTION;
-            parameters.m_vertexType = VERTEX_3D;
+            if (this->CreateCandidateVertex(position3D))
+                ++nCrossingCandidates;
+        }
+    }
+}
 
-            const Vertex *pVertex(NULL);
-            PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::Vertex::Create(*this, parameters, pVertex));
-            ++nCrossingCandidates;
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool CandidateVertexCreationAlgorithm::CreateCandidateVertex(const CartesianVector &position3D) const
+{
+    if (m_candidateMergeDistance > std::numeric_limits<float>::epsilon())
+    {
+        const float mergeDistanceSquared(m_candidateMergeDistance * m_candidateMergeDistance);
+        const std::tuple<int, int, int> cell(this->GetCandidateCell(position3D));
+
+        for (int ix = std::get<0>(cell) - 1; ix <= std::get<0>(cell) + 1; ++ix)
+        {
+            for (int iy = std::get<1>(cell) - 1; iy <= std::get<1>(cell) + 1; ++iy)
+            {
+                for (int iz = std::get<2>(cell) - 1; iz <= std::get<2>(cell) + 1; ++iz)
+                {
+                    CellToPositionsMap::const_iterator iter(m_candidatePositionMap.find(std::make_tuple(ix, iy, iz)));
+
+                    if (m_candidatePositionMap.end() == iter)
+                        continue;
+
+                    for (const CartesianVector &existingPosition : iter->second)
+                    {
+                        if ((existingPosition - position3D).GetMagnitudeSquared() < mergeDistanceSquared)
+                            return false;
+                    }
+                }
+            }
         }
+
+        m_candidatePositionMap[cell].push_back(position3D);
+    }
+
+    PandoraContentApi::Vertex::Parameters parameters;
+    parameters.m_position = position3D;
+    parameters.m_vertexLabel = VERTEX_INTERACTION;
+    parameters.m_vertexType = VERTEX_3D;
+
+    const Vertex *pVertex(NULL);
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::Vertex::Create(*this, parameters, pVertex));
+
+    return true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+std::tuple<int, int, int> CandidateVertexCreationAlgorithm::GetCandidateCell(const CartesianVector &position3D) const
+{
+    return std::make_tuple(static_cast<int>(std::floor(position3D.GetX() / m_candidateMergeDistance)),
+        static_cast<int>(std::floor(position3D.GetY() / m_candidateMergeDistance)),
+        static_cast<int>(std::floor(position3D.GetZ() / m_candidateMergeDistance)));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void CandidateVertexCreationAlgorithm::GetSpacepointBoundingBox(
+    const CartesianPointVector &spacepoints, CartesianVector &minimumCoordinate, CartesianVector &maximumCoordinate) const
+{
+    float minX(std::numeric_limits<float>::max()), minY(std::numeric_limits<float>::max()), minZ(std::numeric_limits<float>::max());
+    float maxX(-std::numeric_limits<float>::max()), maxY(-std::numeric_limits<float>::max()), maxZ(-std::numeric_limits<float>::max());
+
+    for (const CartesianVector &spacepoint : spacepoints)
+    {
+        minX = std::min(minX, spacepoint.GetX());
+        minY = std::min(minY, spacepoint.GetY());
+        minZ = std::min(minZ, spacepoint.GetZ());
+        maxX = std::max(maxX, spacepoint.GetX());
+        maxY = std::max(maxY, spacepoint.GetY());
+        maxZ = std::max(maxZ, spacepoint.GetZ());
     }
+
+    minimumCoordinate.SetValues(minX, minY, minZ);
+    maximumCoordinate.SetValues(maxX, maxY, maxZ);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -414,7 +497,8 @@ void CandidateVertexCreationAlgorithm::AddInputVertices() const
 void CandidateVertexCreationAlgorithm::AddToSlidingFitCache(const Cluster *const pCluster)
 {
     const float slidingFitPitch(LArGeometryHelper::GetWireZPitch(this->GetPandora()));
-    const TwoDSlidingFitResult slidingFitResult(pCluster, m_slidingFitWindow, slidingFitPitch);
+    const TwoDSlidingFitResult &slidingFitResult(
+        LArSlidingFitCacheHelper::GetSlidingFitResult(this->GetPandora(), pCluster, m_slidingFitWindow, slidingFitPitch));
 
     if (!m_slidingFitResultMap.insert(TwoDSlidingFitResultMap::value_type(pCluster, slidingFitResult)).second)
         throw StatusCodeException(STATUS_CODE_FAILURE);
@@ -437,6 +521,7 @@ const TwoDSlidingFitResult &CandidateVertexCreationAlgorithm::GetCachedSlidingFi
 void CandidateVertexCreationAlgorithm::TidyUp()
 {
     m_slidingFitResultMap.clear();
+    m_candidatePositionMap.clear();
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -505,6 +590,9 @@ StatusCode CandidateVertexCreationAlgorithm::ReadSettings(const TiXmlHandle xmlH
         XmlHelper::ReadValue(xmlHandle, "MinNearbyCrossingDistance", minNearbyCrossingDistance));
     m_minNearbyCrossingDistanceSquared = minNearbyCrossingDistance * minNearbyCrossingDistance;
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
+        XmlHelper::ReadValue(xmlHandle, "CandidateMergeDistance", m_candidateMergeDistance));
+
     return STATUS_CODE_SUCCESS;
 }
 
@@ -12,7 +12,10 @@
 
 #include "Pandora/Algorithm.h"
 
+#include <map>
+#include <tuple>
 #include <unordered_map>
+#include <utility>
 
 namespace lar_content
 {
@@ -105,6 +108,35 @@ private:
     void CreateCrossingVertices(const pandora::CartesianPointVector &crossingPoints1, const pandora::CartesianPointVector &crossingPoints2,
         const pandora::HitType hitType1, const pandora::HitType hitType2, unsigned int &nCrossingCandidates) const;
 
+    /**
+     *  @brief  Create a candidate vertex at a 3D position, unless candidate merging is enabled and an existing candidate created by this
+     *          algorithm lies within the merge distance
+     *
+     *  @param  position3D the 3D position
+     *
+     *  @return whether a candidate vertex was created
+     */
+    bool CreateCandidateVertex(const pandora::CartesianVector &position3D) const;
+
+    /**
+     *  @brief  Get the cell of the candidate position map containing a 3D position, with a cell size equal to the merge distance
+     *
+     *  @param  position3D the 3D position
+     *
+     *  @return the cell
+     */
+    std::tuple<int, int, int> GetCandidateCell(const pandora::CartesianVector &position3D) const;
+
+    /**
+     *  @brief  Get the bounding box of a set of space points
+     *
+     *  @param  spacepoints the space points
+     *  @param  minimumCoordinate to receive the minimum coordinates of the space points
+     *  @param  maximumCoordinate to receive the maximum coordinates of the space points
+     */
+    void GetSpacepointBoundingBox(const pandora::CartesianPointVector &spacepoints, pandora::CartesianVector &minimumCoordinate,
+        pandora::CartesianVector &maximumCoordinate) const;
+
     /**
      *  @brief  Add candidate vertices from any input vertices
      */
@@ -132,6 +164,9 @@ private:
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
     typedef std::unordered_map<const pandora::Cluster *, pandora::CartesianPointVector> ClusterToSpacepointsMap;
+    typedef std::pair<pandora::CartesianVector, pandora::CartesianVector> BoundingBox;
+    typedef std::unordered_map<const pandora::Cluster *, BoundingBox> ClusterToBoundingBoxMap;
+    typedef std::map<std::tuple<int, int, int>, pandora::CartesianPointVector> CellToPositionsMap;
 
     pandora::StringVector m_inputClusterListNames; ///< The list of cluster list names
     std::string m_inputVertexListName;             ///< The list name for existing candidate vertices
@@ -159,6 +194,9 @@ private:
     bool m_reducedCandidates;           ///< Whether to reduce the number of candidates
     float m_selectionCutFactorMax;      ///< Maximum factor to multiply the base cluster selection cuts
     float m_nClustersPassingMaxCutsPar; ///< Parameter for number of clusters passing the max base cluster selection cuts
+
+    float m_candidateMergeDistance;                    ///< The distance within which new candidates merge into existing ones, if positive
+    mutable CellToPositionsMap m_candidatePositionMap; ///< The positions of the candidates created, binned in cells of the merge distance
 };
 
 } // namespace lar_content
@@ -23,7 +23,7 @@ EnergyDepositionAsymmetryFeatureTool::EnergyDepositionAsymmetryFeatureTool() : G
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 float EnergyDepositionAsymmetryFeatureTool::CalculateAsymmetry(const bool useEnergyMetrics, const CartesianVector &vertexPosition2D,
-    const ClusterVector &clusterVector, const CartesianVector &localWeightedDirectionSum) const
+    const CaloHitVectorList &asymmetryCaloHits, const CartesianVector &localWeightedDirectionSum) const
 {
     // Project every hit onto local event axis direction and record side of the projected vtx position on which it falls
     float beforeVtxEnergy(0.f), afterVtxEnergy(0.f);
@@ -38,15 +38,9 @@ float EnergyDepositionAsymmetryFeatureTool::CalculateAsymmetry(const bool useEne
     float minAfterProjectedPos(std::numeric_limits<float>::max());
     float maxAfterProjectedPos(-std::numeric_limits<float>::max());
 
-    for (const Cluster *const pCluster : clusterVector)
+    for (const CaloHitVector *const pCaloHitVector : asymmetryCaloHits)
     {
-        CaloHitList caloHitList;
-        pCluster->GetOrderedCaloHitList().FillCaloHitList(caloHitList);
-
-        CaloHitVector caloHitVector(caloHitList.begin(), caloHitList.end());
-        std::sort(caloHitVector.begin(), caloHitVector.end(), LArClusterHelper::SortHitsByPosition);
-
-        for (const CaloHit *const pCaloHit : caloHitVector)
+        for (const CaloHit *const pCaloHit : *pCaloHitVector)
         {
             if (pCaloHit->GetPositionVector().GetDotProduct(localWeightedDirection) < evtProjectedVtxPos)
             {
@@ -32,13 +32,13 @@ private:
      *
      *  @param  useEnergyMetrics whether to use energy-based metrics instead of hit-counting-based metrics
      *  @param  vertexPosition2D the vertex position in this view
-     *  @param  slidingFitDataList the list of sliding fit data objects
+     *  @param  asymmetryCaloHits the position-sorted calo hits of each cluster to be used in the asymmetry calculation
      *  @param  localWeightedDirectionSum the local event axis
      *
      *  @return the energy deposition asymmetry feature
      */
     float CalculateAsymmetry(const bool useEnergyMetrics, const pandora::CartesianVector &vertexPosition2D,
-        const pandora::ClusterVector &clusterVector, const pandora::CartesianVector &localWeightedDirectionSum) const override;
+        const CaloHitVectorList &asymmetryCaloHits, const pandora::CartesianVector &localWeightedDirectionSum) const override;
 };
 
 } // namespace lar_content
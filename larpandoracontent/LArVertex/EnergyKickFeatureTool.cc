@@ -24,8 +24,9 @@ EnergyKickFeatureTool::EnergyKickFeatureTool() : m_rOffset(10.f), m_xOffset(0.06
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void EnergyKickFeatureTool::Run(LArMvaHelper::MvaFeatureVector &featureVector, const VertexSelectionBaseAlgorithm *const pAlgorithm,
-    const Vertex *const pVertex, const VertexSelectionBaseAlgorithm::SlidingFitDataListMap &slidingFitDataListMap,
-    const VertexSelectionBaseAlgorithm::ClusterListMap &, const VertexSelectionBaseAlgorithm::KDTreeMap &,
+    const Vertex *const, const VertexSelectionBaseAlgorithm::VertexFeatureContext &vertexFeatureContext,
+    const VertexSelectionBaseAlgorithm::SlidingFitDataListMap &slidingFitDataListMap, const VertexSelectionBaseAlgorithm::ClusterListMap &,
+    const VertexSelectionBaseAlgorithm::KDTreeMap &,
     const VertexSelectionBaseAlgorithm::ShowerClusterListMap &, const float, float &)
 {
     if (PandoraContentApi::GetSettings(*pAlgorithm)->ShouldDisplayAlgorithmInfo())
@@ -33,14 +34,9 @@ void EnergyKickFeatureTool::Run(LArMvaHelper::MvaFeatureVector &featureVector, c
 
     float energyKick(0.f);
 
-    energyKick += this->GetEnergyKickForView(
-        LArGeometryHelper::ProjectPosition(this->GetPandora(), pVertex->GetPosition(), TPC_VIEW_U), slidingFitDataListMap.at(TPC_VIEW_U));
-
-    energyKick += this->GetEnergyKickForView(
-        LArGeometryHelper::ProjectPosition(this->GetPandora(), pVertex->GetPosition(), TPC_VIEW_V), slidingFitDataListMap.at(TPC_VIEW_V));
-
-    energyKick += this->GetEnergyKickForView(
-        LArGeometryHelper::ProjectPosition(this->GetPandora(), pVertex->GetPosition(), TPC_VIEW_W), slidingFitDataListMap.at(TPC_VIEW_W));
+    energyKick += this->GetEnergyKickForView(vertexFeatureContext.GetVertexPosition2D(TPC_VIEW_U), slidingFitDataListMap.at(TPC_VIEW_U));
+    energyKick += this->GetEnergyKickForView(vertexFeatureContext.GetVertexPosition2D(TPC_VIEW_V), slidingFitDataListMap.at(TPC_VIEW_V));
+    energyKick += this->GetEnergyKickForView(vertexFeatureContext.GetVertexPosition2D(TPC_VIEW_W), slidingFitDataListMap.at(TPC_VIEW_W));
 
     featureVector.push_back(energyKick);
 }
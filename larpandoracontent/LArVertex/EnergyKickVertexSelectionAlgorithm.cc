@@ -8,6 +8,7 @@
 #include "Pandora/AlgorithmHeaders.h"
 
 #include "larpandoracontent/LArHelpers/LArMvaHelper.h"
+#include "larpandoracontent/LArHelpers/LArParallelHelper.h"
 
 #include "larpandoracontent/LArVertex/EnergyKickFeatureTool.h"
 #include "larpandoracontent/LArVertex/LocalAsymmetryFeatureTool.h"
@@ -44,26 +45,38 @@ void EnergyKickVertexSelectionAlgorithm::GetVertexScoreList(const VertexVector &
     const SlidingFitDataListMap slidingFitDataListMap{
         {TPC_VIEW_U, slidingFitDataListU}, {TPC_VIEW_V, slidingFitDataListV}, {TPC_VIEW_W, slidingFitDataListW}};
 
-    float bestFastScore(0.f); // not actually used - artefact of toolizing RPhi score and still using performance trick
-    for (const Vertex *const pVertex : vertexVector)
-    {
+    // ATTN The energy kick and asymmetry tools ignore the best fast score, so each vertex can be scored independently and in parallel
+    FloatVector vertexScores;
+
+    auto scoreFunction = [&](const unsigned int index) {
+        const Vertex *const pVertex(vertexVector.at(index));
+        float bestFastScore(0.f); // not actually used - artefact of toolizing RPhi score and still using performance trick
+
         const float beamDeweightingScore(this->IsBeamModeOn() ? this->GetBeamDeweightingScore(beamConstants, pVertex) : 0.f);
+        const VertexFeatureContext vertexFeatureContext(this->GetPandora(), pVertex, slidingFitDataListMap);
 
         const float energyKick(LArMvaHelper::CalculateFeaturesOfType<EnergyKickFeatureTool>(m_featureToolVector, this, pVertex,
-            slidingFitDataListMap, ClusterListMap(), KDTreeMap(), ShowerClusterListMap(), beamDeweightingScore, bestFastScore)
+            vertexFeatureContext, slidingFitDataListMap, ClusterListMap(), KDTreeMap(), ShowerClusterListMap(), beamDeweightingScore,
+            bestFastScore)
                                    .at(0)
                                    .Get());
 
         const float energyAsymmetry(LArMvaHelper::CalculateFeaturesOfType<LocalAsymmetryFeatureTool>(m_featureToolVector, this, pVertex,
-            slidingFitDataListMap, ClusterListMap(), KDTreeMap(), ShowerClusterListMap(), beamDeweightingScore, bestFastScore)
+            vertexFeatureContext, slidingFitDataListMap, ClusterListMap(), KDTreeMap(), ShowerClusterListMap(), beamDeweightingScore,
+            bestFastScore)
                                         .at(0)
                                         .Get());
 
         const float energyKickScore(-energyKick / m_epsilon);
         const float energyAsymmetryScore(energyAsymmetry / m_asymmetryConstant);
 
-        vertexScoreList.push_back(VertexScore(pVertex, beamDeweightingScore + energyKickScore + energyAsymmetryScore));
-    }
+        return beamDeweightingScore + energyKickScore + energyAsymmetryScore;
+    };
+
+    LArParallelHelper::Transform(vertexVector.size(), this->GetNScoringThreads(), scoreFunction, vertexScores);
+
+    for (unsigned int index = 0; index < vertexVector.size(); ++index)
+        vertexScoreList.push_back(VertexScore(vertexVector.at(index), vertexScores.at(index)));
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
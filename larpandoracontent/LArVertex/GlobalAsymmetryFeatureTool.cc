@@ -22,18 +22,22 @@ GlobalAsymmetryFeatureTool::GlobalAsymmetryFeatureTool() : AsymmetryFeatureBaseT
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-float GlobalAsymmetryFeatureTool::GetAsymmetryForView(const CartesianVector &vertexPosition2D,
-    const VertexSelectionBaseAlgorithm::SlidingFitDataList &slidingFitDataList, const VertexSelectionBaseAlgorithm::ShowerClusterList &) const
+float GlobalAsymmetryFeatureTool::GetAsymmetryForView(const VertexSelectionBaseAlgorithm::VertexFeatureContext &vertexFeatureContext,
+    const HitType hitType, const VertexSelectionBaseAlgorithm::SlidingFitDataList &slidingFitDataList,
+    const VertexSelectionBaseAlgorithm::ShowerClusterList &) const
 {
+    const CartesianVector &vertexPosition2D(vertexFeatureContext.GetVertexPosition2D(hitType));
+
     bool useEnergy(true);
     CartesianVector energyWeightedDirectionSum(0.f, 0.f, 0.f), hitWeightedDirectionSum(0.f, 0.f, 0.f);
-    ClusterVector asymmetryClusters;
+    CaloHitVectorList asymmetryCaloHits;
 
-    for (const VertexSelectionBaseAlgorithm::SlidingFitData &slidingFitData : slidingFitDataList)
+    for (unsigned int index = 0; index < slidingFitDataList.size(); ++index)
     {
+        const VertexSelectionBaseAlgorithm::SlidingFitData &slidingFitData(slidingFitDataList.at(index));
         const Cluster *const pCluster(slidingFitData.GetCluster());
 
-        asymmetryClusters.push_back(pCluster);
+        asymmetryCaloHits.push_back(&slidingFitData.GetSortedCaloHits());
 
         if (pCluster->GetElectromagneticEnergy() < std::numeric_limits<float>::epsilon())
             useEnergy = false;
@@ -44,7 +48,9 @@ float GlobalAsymmetryFeatureTool::GetAsymmetryForView(const CartesianVector &ver
         const bool minLayerClosest(vertexToMinLayer.GetMagnitudeSquared() < vertexToMaxLayer.GetMagnitudeSquared());
         const CartesianVector &clusterDirection((minLayerClosest) ? slidingFitData.GetMinLayerDirection() : slidingFitData.GetMaxLayerDirection());
 
-        if ((LArClusterHelper::GetClosestDistance(vertexPosition2D, pCluster) < m_maxAsymmetryDistance))
+        // ATTN The precomputed bounding box distance is a lower bound on the closest distance, so avoids most of the hit loops
+        if ((slidingFitData.GetBoundingBoxDistance(vertexPosition2D) < m_maxAsymmetryDistance + 0.01f) &&
+            (vertexFeatureContext.GetClosestDistance(hitType, index) < m_maxAsymmetryDistance))
         {
             this->IncrementAsymmetryParameters(pCluster->GetElectromagneticEnergy(), clusterDirection, energyWeightedDirectionSum);
             this->IncrementAsymmetryParameters(static_cast<float>(pCluster->GetNCaloHits()), clusterDirection, hitWeightedDirectionSum);
@@ -56,7 +62,7 @@ float GlobalAsymmetryFeatureTool::GetAsymmetryForView(const CartesianVector &ver
     if (localWeightedDirectionSum.GetMagnitudeSquared() < std::numeric_limits<float>::epsilon())
         return 0.f;
 
-    return this->CalculateAsymmetry(useEnergy, vertexPosition2D, asymmetryClusters, localWeightedDirectionSum);
+    return this->CalculateAsymmetry(useEnergy, vertexPosition2D, asymmetryCaloHits, localWeightedDirectionSum);
 }
 
 StatusCode GlobalAsymmetryFeatureTool::ReadSettings(const TiXmlHandle xmlHandle)
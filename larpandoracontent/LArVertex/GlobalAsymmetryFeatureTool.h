@@ -31,12 +31,14 @@ private:
     /**
      *  @brief  Get the global asymmetry feature for a given view
      *
-     *  @param  vertexPosition2D the vertex position projected into this view
+     *  @param  vertexFeatureContext the geometry shared by the feature tools for this vertex
+     *  @param  hitType the view
      *  @param  slidingFitDataList the list of sliding fit data objects for this view
      *
      *  @return the global asymmetry feature
      */
-    float GetAsymmetryForView(const pandora::CartesianVector &vertexPosition2D, const VertexSelectionBaseAlgorithm::SlidingFitDataList &slidingFitDataList,
+    float GetAsymmetryForView(const VertexSelectionBaseAlgorithm::VertexFeatureContext &vertexFeatureContext,
+        const pandora::HitType hitType, const VertexSelectionBaseAlgorithm::SlidingFitDataList &slidingFitDataList,
         const VertexSelectionBaseAlgorithm::ShowerClusterList &) const override;
 };
 
@@ -28,14 +28,17 @@ void HitAngleVertexSelectionAlgorithm::GetVertexScoreList(const VertexVector &ve
     HitKDTree2D &kdTreeU, HitKDTree2D &kdTreeV, HitKDTree2D &kdTreeW, VertexScoreList &vertexScoreList) const
 {
     const KDTreeMap kdTreeMap{{TPC_VIEW_U, kdTreeU}, {TPC_VIEW_V, kdTreeV}, {TPC_VIEW_W, kdTreeW}};
+    const SlidingFitDataListMap slidingFitDataListMap;
 
     float bestFastScore(0.f);
     for (const Vertex *const pVertex : vertexVector)
     {
         const float beamDeweightingScore(this->IsBeamModeOn() ? std::exp(this->GetBeamDeweightingScore(beamConstants, pVertex)) : 1.f);
+        const VertexFeatureContext vertexFeatureContext(this->GetPandora(), pVertex, slidingFitDataListMap);
 
         const float rPhiScore(LArMvaHelper::CalculateFeaturesOfType<RPhiFeatureTool>(m_featureToolVector, this, pVertex,
-            SlidingFitDataListMap(), ClusterListMap(), kdTreeMap, ShowerClusterListMap(), beamDeweightingScore, bestFastScore)
+            vertexFeatureContext, slidingFitDataListMap, ClusterListMap(), kdTreeMap, ShowerClusterListMap(), beamDeweightingScore,
+            bestFastScore)
                                   .at(0)
                                   .Get());
 
@@ -26,15 +26,19 @@ LocalAsymmetryFeatureTool::LocalAsymmetryFeatureTool() :
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-float LocalAsymmetryFeatureTool::GetAsymmetryForView(const CartesianVector &vertexPosition2D,
-    const VertexSelectionBaseAlgorithm::SlidingFitDataList &slidingFitDataList, const VertexSelectionBaseAlgorithm::ShowerClusterList &) const
+float LocalAsymmetryFeatureTool::GetAsymmetryForView(const VertexSelectionBaseAlgorithm::VertexFeatureContext &vertexFeatureContext,
+    const HitType hitType, const VertexSelectionBaseAlgorithm::SlidingFitDataList &slidingFitDataList,
+    const VertexSelectionBaseAlgorithm::ShowerClusterList &) const
 {
+    const CartesianVector &vertexPosition2D(vertexFeatureContext.GetVertexPosition2D(hitType));
+
     bool useEnergy(true), useAsymmetry(true);
     CartesianVector energyWeightedDirectionSum(0.f, 0.f, 0.f), hitWeightedDirectionSum(0.f, 0.f, 0.f);
-    ClusterVector asymmetryClusters;
+    CaloHitVectorList asymmetryCaloHits;
 
-    for (const VertexSelectionBaseAlgorithm::SlidingFitData &slidingFitData : slidingFitDataList)
+    for (unsigned int index = 0; index < slidingFitDataList.size(); ++index)
     {
+        const VertexSelectionBaseAlgorithm::SlidingFitData &slidingFitData(slidingFitDataList.at(index));
         const Cluster *const pCluster(slidingFitData.GetCluster());
 
         if (pCluster->GetElectromagneticEnergy() < std::numeric_limits<float>::epsilon())
@@ -46,7 +50,9 @@ float LocalAsymmetryFeatureTool::GetAsymmetryForView(const CartesianVector &vert
         const bool minLayerClosest(vertexToMinLayer.GetMagnitudeSquared() < vertexToMaxLayer.GetMagnitudeSquared());
         const CartesianVector &clusterDirection((minLayerClosest) ? slidingFitData.GetMinLayerDirection() : slidingFitData.GetMaxLayerDirection());
 
-        if (useAsymmetry && (LArClusterHelper::GetClosestDistance(vertexPosition2D, pCluster) < m_maxAsymmetryDistance))
+        // ATTN The precomputed bounding box distance is a lower bound on the closest distance, so avoids most of the hit loops
+        if (useAsymmetry && (slidingFitData.GetBoundingBoxDistance(vertexPosition2D) < m_maxAsymmetryDistance + 0.01f) &&
+            (vertexFeatureContext.GetClosestDistance(hitType, index) < m_maxAsymmetryDistance))
         {
             useAsymmetry &= this->CheckAngle(energyWeightedDirectionSum, clusterDirection);
             this->IncrementAsymmetryParameters(pCluster->GetElectromagneticEnergy(), clusterDirection, energyWeightedDirectionSum);
@@ -54,7 +60,7 @@ float LocalAsymmetryFeatureTool::GetAsymmetryForView(const CartesianVector &vert
             useAsymmetry &= this->CheckAngle(hitWeightedDirectionSum, clusterDirection);
             this->IncrementAsymmetryParameters(static_cast<float>(pCluster->GetNCaloHits()), clusterDirection, hitWeightedDirectionSum);
 
-            asymmetryClusters.push_back(pCluster);
+            asymmetryCaloHits.push_back(&slidingFitData.GetSortedCaloHits());
         }
 
         if (!useAsymmetry)
@@ -66,11 +72,11 @@ float LocalAsymmetryFeatureTool::GetAsymmetryForView(const CartesianVector &vert
         (!useEnergy && hitWeightedDirectionSum == CartesianVector(0.f, 0.f, 0.f)))
         return 1.f;
 
-    if (asymmetryClusters.empty() || (asymmetryClusters.size() > m_maxAsymmetryNClusters))
+    if (asymmetryCaloHits.empty() || (asymmetryCaloHits.size() > m_maxAsymmetryNClusters))
         return 1.f;
 
     const CartesianVector &localWeightedDirectionSum(useEnergy ? energyWeightedDirectionSum : hitWeightedDirectionSum);
-    return this->CalculateAsymmetry(useEnergy, vertexPosition2D, asymmetryClusters, localWeightedDirectionSum);
+    return this->CalculateAsymmetry(useEnergy, vertexPosition2D, asymmetryCaloHits, localWeightedDirectionSum);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
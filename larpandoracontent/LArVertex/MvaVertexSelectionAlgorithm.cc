@@ -14,6 +14,7 @@
 #include "larpandoracontent/LArHelpers/LArInteractionTypeHelper.h"
 #include "larpandoracontent/LArHelpers/LArMCParticleHelper.h"
 #include "larpandoracontent/LArHelpers/LArMvaHelper.h"
+#include "larpandoracontent/LArHelpers/LArParallelHelper.h"
 
 #include "larpandoracontent/LArVertex/EnergyKickFeatureTool.h"
 #include "larpandoracontent/LArVertex/GlobalAsymmetryFeatureTool.h"
@@ -25,6 +26,8 @@
 
 #include "larpandoracontent/LArUtility/KDTreeLinkerAlgoT.h"
 
+#include <algorithm>
+#include <iterator>
 #include <random>
 
 using namespace pandora;
@@ -35,7 +38,8 @@ namespace lar_content
 template <typename T>
 MvaVertexSelectionAlgorithm<T>::MvaVertexSelectionAlgorithm() :
     TrainedVertexSelectionAlgorithm(),
-    m_filePathEnvironmentVariable("FW_SEARCH_PATH")
+    m_filePathEnvironmentVariable("FW_SEARCH_PATH"),
+    m_comparisonBatchSize(1)
 {
 }
 
@@ -74,12 +78,17 @@ void MvaVertexSelectionAlgorithm<T>::GetVertexScoreList(const VertexVector &vert
     LArMvaHelper::MvaFeatureVector eventFeatureList;
     this->AddEventFeaturesToVector(eventFeatureInfo, eventFeatureList);
 
+    // ATTN The features of each vertex only read the shared fits and kd trees, so can be calculated in parallel, then added in vertex order
+    std::vector<VertexFeatureInfoMap> vertexFeatureInfoMaps(vertexVector.size());
+
+    LArParallelHelper::ForEach(vertexVector.size(), this->GetNScoringThreads(), [&](const unsigned int index) {
+        this->PopulateVertexFeatureInfoMap(beamConstants, clusterListMap, slidingFitDataListMap, showerClusterListMap, kdTreeMap,
+            vertexVector.at(index), vertexFeatureInfoMaps.at(index));
+    });
+
     VertexFeatureInfoMap vertexFeatureInfoMap;
-    for (const Vertex *const pVertex : vertexVector)
-    {
-        this->PopulateVertexFeatureInfoMap(
-            beamConstants, clusterListMap, slidingFitDataListMap, showerClusterListMap, kdTreeMap, pVertex, vertexFeatureInfoMap);
-    }
+    for (const VertexFeatureInfoMap &thisVertexFeatureInfoMap : vertexFeatureInfoMaps)
+        vertexFeatureInfoMap.insert(thisVertexFeatureInfoMap.begin(), thisVertexFeatureInfoMap.end());
 
     // Use a simple score to get the list of vertices representing good regions.
     VertexScoreList initialScoreList;
@@ -94,6 +103,15 @@ void MvaVertexSelectionAlgorithm<T>::GetVertexScoreList(const VertexVector &vert
 
     if ((!m_trainingSetMode || m_allowClassifyDuringTraining) && !bestRegionVertices.empty())
     {
+        if (m_stagedFeatureEvaluation)
+        {
+            LArParallelHelper::ForEach(bestRegionVertices.size(), this->GetNScoringThreads(), [&](const unsigned int index) {
+                const Vertex *const pVertex(bestRegionVertices.at(index));
+                this->PopulateDeferredVertexFeatures(
+                    clusterListMap, slidingFitDataListMap, showerClusterListMap, kdTreeMap, pVertex, vertexFeatureInfoMap.at(pVertex));
+            });
+        }
+
         // Use mva to choose the region.
         const Vertex *const pBestRegionVertex(
             this->CompareVertices(bestRegionVertices, vertexFeatureInfoMap, eventFeatureList, kdTreeMap, m_mvaRegion, m_useRPhiFeatureForRegion));
@@ -111,6 +129,22 @@ void MvaVertexSelectionAlgorithm<T>::GetVertexScoreList(const VertexVector &vert
 
         this->CalculateRPhiScores(regionalVertices, vertexFeatureInfoMap, kdTreeMap);
 
+        if (m_stagedFeatureEvaluation)
+        {
+            VertexVector deferredVertices;
+            for (const Vertex *const pVertex : regionalVertices)
+            {
+                if (bestRegionVertices.end() == std::find(bestRegionVertices.begin(), bestRegionVertices.end(), pVertex))
+                    deferredVertices.push_back(pVertex);
+            }
+
+            LArParallelHelper::ForEach(deferredVertices.size(), this->GetNScoringThreads(), [&](const unsigned int index) {
+                const Vertex *const pVertex(deferredVertices.at(index));
+                this->PopulateDeferredVertexFeatures(
+                    clusterListMap, slidingFitDataListMap, showerClusterListMap, kdTreeMap, pVertex, vertexFeatureInfoMap.at(pVertex));
+            });
+        }
+
         if (!regionalVertices.empty())
         {
             // Use mva to choose the vertex and then fine-tune using the RPhi score.
@@ -133,35 +167,63 @@ const pandora::Vertex *MvaVertexSelectionAlgorithm<T>::CompareVertices(const Ver
     VertexFeatureInfo chosenVertexFeatureInfo(vertexFeatureInfoMap.at(pBestVertex));
     this->AddVertexFeaturesToVector(chosenVertexFeatureInfo, chosenFeatureList, useRPhi);
 
-    for (const Vertex *const pVertex : vertexVector)
-    {
-        if (pVertex == pBestVertex)
-            continue;
+    // ATTN Comparisons against the current best vertex are scored a block at a time. The block is cut short at the first vertex that
+    // is preferred, as that vertex becomes the best vertex for all remaining comparisons, so the sequential choice is preserved.
+    VertexVector::const_iterator iter(vertexVector.begin());
 
-        LArMvaHelper::MvaFeatureVector featureList;
-        VertexFeatureInfo vertexFeatureInfo(vertexFeatureInfoMap.at(pVertex));
-        this->AddVertexFeaturesToVector(vertexFeatureInfo, featureList, useRPhi);
+    while (vertexVector.end() != iter)
+    {
+        VertexVector blockVertices;
+        std::vector<VertexVector::const_iterator> blockIterators;
+        LArMvaHelper::MvaFeatureMatrix blockFeatureLists, featureMatrix;
 
-        if (!m_legacyVariables)
+        for (; (vertexVector.end() != iter) && (blockVertices.size() < m_comparisonBatchSize); ++iter)
         {
-            LArMvaHelper::MvaFeatureVector sharedFeatureList;
-            float separation(0.f), axisHits(0.f);
-            this->GetSharedFeatures(pVertex, pBestVertex, kdTreeMap, separation, axisHits);
-            VertexSharedFeatureInfo sharedFeatureInfo(separation, axisHits);
-            this->AddSharedFeaturesToVector(sharedFeatureInfo, sharedFeatureList);
+            const Vertex *const pVertex(*iter);
+
+            if (pVertex == pBestVertex)
+                continue;
 
-            if (LArMvaHelper::Classify(t, LArMvaHelper::ConcatenateFeatureLists(eventFeatureList, featureList, chosenFeatureList, sharedFeatureList)))
+            LArMvaHelper::MvaFeatureVector featureList;
+            VertexFeatureInfo vertexFeatureInfo(vertexFeatureInfoMap.at(pVertex));
+            this->AddVertexFeaturesToVector(vertexFeatureInfo, featureList, useRPhi);
+
+            if (!m_legacyVariables)
+            {
+                LArMvaHelper::MvaFeatureVector sharedFeatureList;
+                float separation(0.f), axisHits(0.f);
+                this->GetSharedFeatures(pVertex, pBestVertex, kdTreeMap, separation, axisHits);
+                VertexSharedFeatureInfo sharedFeatureInfo(separation, axisHits);
+                this->AddSharedFeaturesToVector(sharedFeatureInfo, sharedFeatureList);
+
+                featureMatrix.push_back(
+                    LArMvaHelper::ConcatenateFeatureLists(eventFeatureList, featureList, chosenFeatureList, sharedFeatureList));
+            }
+            else
             {
-                pBestVertex = pVertex;
-                chosenFeatureList = featureList;
+                featureMatrix.push_back(LArMvaHelper::ConcatenateFeatureLists(eventFeatureList, featureList, chosenFeatureList));
             }
+
+            blockVertices.push_back(pVertex);
+            blockIterators.push_back(iter);
+            blockFeatureLists.push_back(featureList);
         }
-        else
+
+        if (featureMatrix.empty())
+            continue;
+
+        // ATTN Classification of a single example is equivalent to a positive classification score
+        LArMvaHelper::DoubleVector scores;
+        LArMvaHelper::CalculateClassificationScores(t, featureMatrix, scores);
+
+        for (unsigned int index = 0; index < scores.size(); ++index)
         {
-            if (LArMvaHelper::Classify(t, LArMvaHelper::ConcatenateFeatureLists(eventFeatureList, featureList, chosenFeatureList)))
+            if (scores.at(index) > 0.)
             {
-                pBestVertex = pVertex;
-                chosenFeatureList = featureList;
+                pBestVertex = blockVertices.at(index);
+                chosenFeatureList = blockFeatureLists.at(index);
+                iter = std::next(blockIterators.at(index));
+                break;
             }
         }
     }
@@ -183,6 +245,15 @@ StatusCode MvaVertexSelectionAlgorithm<T>::ReadSettings(const TiXmlHandle xmlHan
 
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "VertexMvaName", m_vertexMvaName));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "ComparisonBatchSize", m_comparisonBatchSize));
+
+    if (0 == m_comparisonBatchSize)
+    {
+        std::cout << "MvaVertexSelectionAlgorithm: ComparisonBatchSize must be greater than zero" << std::endl;
+        return STATUS_CODE_INVALID_PARAMETER;
+    }
+
     // ATTN : Need access to base class member variables at this point, so call read settings prior to end of this function
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, TrainedVertexSelectionAlgorithm::ReadSettings(xmlHandle));
 
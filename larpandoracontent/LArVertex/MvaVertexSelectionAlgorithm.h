@@ -80,6 +80,7 @@ private:
     std::string m_vertexMvaName;               ///< The name of the vertex mva to find
     T m_mvaRegion;                             ///< The region mva
     T m_mvaVertex;                             ///< The vertex mva
+    unsigned int m_comparisonBatchSize;        ///< The maximum number of vertex comparisons to score in a single mva call
 };
 
 typedef MvaVertexSelectionAlgorithm<AdaBoostDecisionTree> BdtVertexSelectionAlgorithm;
@@ -36,9 +36,10 @@ RPhiFeatureTool::RPhiFeatureTool() :
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void RPhiFeatureTool::Run(LArMvaHelper::MvaFeatureVector &featureVector, const VertexSelectionBaseAlgorithm *const pAlgorithm,
-    const Vertex *const pVertex, const VertexSelectionBaseAlgorithm::SlidingFitDataListMap &,
-    const VertexSelectionBaseAlgorithm::ClusterListMap &, const VertexSelectionBaseAlgorithm::KDTreeMap &kdTreeMap,
-    const VertexSelectionBaseAlgorithm::ShowerClusterListMap &, const float beamDeweightingScore, float &bestFastScore)
+    const Vertex *const, const VertexSelectionBaseAlgorithm::VertexFeatureContext &vertexFeatureContext,
+    const VertexSelectionBaseAlgorithm::SlidingFitDataListMap &, const VertexSelectionBaseAlgorithm::ClusterListMap &,
+    const VertexSelectionBaseAlgorithm::KDTreeMap &kdTreeMap, const VertexSelectionBaseAlgorithm::ShowerClusterListMap &,
+    const float beamDeweightingScore, float &bestFastScore)
 {
     if (PandoraContentApi::GetSettings(*pAlgorithm)->ShouldDisplayAlgorithmInfo())
         std::cout << "----> Running Algorithm Tool: " << this->GetInstanceName() << ", " << this->GetType() << std::endl;
@@ -47,9 +48,9 @@ void RPhiFeatureTool::Run(LArMvaHelper::MvaFeatureVector &featureVector, const V
     KernelEstimate kernelEstimateV(m_kernelEstimateSigma);
     KernelEstimate kernelEstimateW(m_kernelEstimateSigma);
 
-    this->FillKernelEstimate(pVertex, TPC_VIEW_U, kdTreeMap.at(TPC_VIEW_U), kernelEstimateU);
-    this->FillKernelEstimate(pVertex, TPC_VIEW_V, kdTreeMap.at(TPC_VIEW_V), kernelEstimateV);
-    this->FillKernelEstimate(pVertex, TPC_VIEW_W, kdTreeMap.at(TPC_VIEW_W), kernelEstimateW);
+    this->FillKernelEstimate(vertexFeatureContext.GetVertexPosition2D(TPC_VIEW_U), kdTreeMap.at(TPC_VIEW_U), kernelEstimateU);
+    this->FillKernelEstimate(vertexFeatureContext.GetVertexPosition2D(TPC_VIEW_V), kdTreeMap.at(TPC_VIEW_V), kernelEstimateV);
+    this->FillKernelEstimate(vertexFeatureContext.GetVertexPosition2D(TPC_VIEW_W), kdTreeMap.at(TPC_VIEW_W), kernelEstimateW);
 
     const float expBeamDeweightingScore = std::exp(beamDeweightingScore);
 
@@ -132,12 +133,22 @@ float RPhiFeatureTool::GetMidwayScore(const KernelEstimate &kernelEstimateU, con
 
     float figureOfMerit(0.f);
 
+    // ATTN Empty bins add nothing to the figure of merit, so skip sampling the kernel estimates there (most bins for a busy slice)
     for (int xBin = 0; xBin < histogramU.GetNBinsX(); ++xBin)
     {
         const float binCenter(histogramU.GetXLow() + (static_cast<float>(xBin) + 0.5f) * histogramU.GetXBinWidth());
-        figureOfMerit += histogramU.GetBinContent(xBin) * kernelEstimateU.Sample(binCenter);
-        figureOfMerit += histogramV.GetBinContent(xBin) * kernelEstimateV.Sample(binCenter);
-        figureOfMerit += histogramW.GetBinContent(xBin) * kernelEstimateW.Sample(binCenter);
+        const float binContentU(histogramU.GetBinContent(xBin));
+        const float binContentV(histogramV.GetBinContent(xBin));
+        const float binContentW(histogramW.GetBinContent(xBin));
+
+        if (binContentU != 0.f)
+            figureOfMerit += binContentU * kernelEstimateU.Sample(binCenter);
+
+        if (binContentV != 0.f)
+            figureOfMerit += binContentV * kernelEstimateV.Sample(binCenter);
+
+        if (binContentW != 0.f)
+            figureOfMerit += binContentW * kernelEstimateW.Sample(binCenter);
     }
 
     return figureOfMerit;
@@ -163,10 +174,9 @@ float RPhiFeatureTool::GetFullScore(const KernelEstimate &kernelEstimateU, const
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void RPhiFeatureTool::FillKernelEstimate(const Vertex *const pVertex, const HitType hitType,
-    VertexSelectionBaseAlgorithm::HitKDTree2D &kdTree, KernelEstimate &kernelEstimate) const
+void RPhiFeatureTool::FillKernelEstimate(
+    const CartesianVector &vertexPosition2D, VertexSelectionBaseAlgorithm::HitKDTree2D &kdTree, KernelEstimate &kernelEstimate) const
 {
-    const CartesianVector vertexPosition2D(LArGeometryHelper::ProjectPosition(this->GetPandora(), pVertex->GetPosition(), hitType));
     KDTreeBox searchRegionHits = build_2d_kd_search_region(vertexPosition2D, m_maxHitVertexDisplacement1D, m_maxHitVertexDisplacement1D);
 
     VertexSelectionBaseAlgorithm::HitKDNode2DList found;
@@ -219,12 +229,11 @@ float RPhiFeatureTool::KernelEstimate::Sample(const float x) const
     ContributionList::const_iterator upperIter(contributionList.upper_bound(x + 3.f * m_sigma));
 
     float sample(0.f);
-    const float gaussConstant(1.f / std::sqrt(2.f * M_PI * m_sigma * m_sigma));
 
     for (ContributionList::const_iterator iter = lowerIter; iter != upperIter; ++iter)
     {
         const float deltaSigma((x - iter->first) / m_sigma);
-        const float gaussian(gaussConstant * std::exp(-0.5f * deltaSigma * deltaSigma));
+        const float gaussian(m_gaussConstant * std::exp(-0.5f * deltaSigma * deltaSigma));
         sample += iter->second * gaussian;
     }
 
@@ -31,6 +31,7 @@ public:
      *
      *  @param  pAlgorithm address of the calling algorithm
      *  @param  pVertex address of the vertex
+     *  @param  vertexFeatureContext the geometry shared by the feature tools for this vertex
      *  @param  kdTreeMap map of the hit kd trees
      *  @param  beamDeweightingScore the beam deweighting score for this vertex
      *  @param  bestFastScore the best fast score
@@ -38,9 +39,10 @@ public:
      *  @return the r/phi feature
      */
     void Run(LArMvaHelper::MvaFeatureVector &featureVector, const VertexSelectionBaseAlgorithm *const pAlgorithm,
-        const pandora::Vertex *const pVertex, const VertexSelectionBaseAlgorithm::SlidingFitDataListMap &,
-        const VertexSelectionBaseAlgorithm::ClusterListMap &, const VertexSelectionBaseAlgorithm::KDTreeMap &kdTreeMap,
-        const VertexSelectionBaseAlgorithm::ShowerClusterListMap &, const float beamDeweightingScore, float &bestFastScore);
+        const pandora::Vertex *const pVertex, const VertexSelectionBaseAlgorithm::VertexFeatureContext &vertexFeatureContext,
+        const VertexSelectionBaseAlgorithm::SlidingFitDataListMap &, const VertexSelectionBaseAlgorithm::ClusterListMap &,
+        const VertexSelectionBaseAlgorithm::KDTreeMap &kdTreeMap, const VertexSelectionBaseAlgorithm::ShowerClusterListMap &,
+        const float beamDeweightingScore, float &bestFastScore);
 
 private:
     /**
@@ -92,6 +94,7 @@ private:
     private:
         ContributionList m_contributionList; ///< The contribution list
         const float m_sigma;                 ///< The assigned width
+        const float m_gaussConstant;         ///< The gaussian normalisation for the assigned width
     };
 
     //--------------------------------------------------------------------------------------------------------------------------------------
@@ -134,13 +137,12 @@ private:
     /**
      *  @brief  Use hits in clusters (in the provided kd tree) to fill a provided kernel estimate with hit-vertex relationship information
      *
-     *  @param  pVertex the address of the vertex
-     *  @param  hitType the relevant hit type
+     *  @param  vertexPosition2D the vertex position projected into the relevant view
      *  @param  kdTree the relevant kd tree
      *  @param  kernelEstimate to receive the populated kernel estimate
      */
-    void FillKernelEstimate(const pandora::Vertex *const pVertex, const pandora::HitType hitType,
-        VertexSelectionBaseAlgorithm::HitKDTree2D &kdTree, KernelEstimate &kernelEstimate) const;
+    void FillKernelEstimate(const pandora::CartesianVector &vertexPosition2D, VertexSelectionBaseAlgorithm::HitKDTree2D &kdTree,
+        KernelEstimate &kernelEstimate) const;
 
     /**
      *  @brief  Whether to accept a candidate vertex, based on its spatial position in relation to other selected candidates
@@ -180,7 +182,9 @@ private:
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-inline RPhiFeatureTool::KernelEstimate::KernelEstimate(const float sigma) : m_sigma(sigma)
+inline RPhiFeatureTool::KernelEstimate::KernelEstimate(const float sigma) :
+    m_sigma(sigma),
+    m_gaussConstant(1.f / std::sqrt(2.f * M_PI * sigma * sigma))
 {
     if (m_sigma < std::numeric_limits<float>::epsilon())
         throw pandora::StatusCodeException(pandora::STATUS_CODE_INVALID_PARAMETER);
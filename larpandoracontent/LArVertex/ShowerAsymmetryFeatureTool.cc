@@ -22,9 +22,11 @@ ShowerAsymmetryFeatureTool::ShowerAsymmetryFeatureTool() : AsymmetryFeatureBaseT
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-float ShowerAsymmetryFeatureTool::GetAsymmetryForView(const CartesianVector &vertexPosition2D,
-    const VertexSelectionBaseAlgorithm::SlidingFitDataList &, const VertexSelectionBaseAlgorithm::ShowerClusterList &showerClusterList) const
+float ShowerAsymmetryFeatureTool::GetAsymmetryForView(const VertexSelectionBaseAlgorithm::VertexFeatureContext &vertexFeatureContext,
+    const HitType hitType, const VertexSelectionBaseAlgorithm::SlidingFitDataList &,
+    const VertexSelectionBaseAlgorithm::ShowerClusterList &showerClusterList) const
 {
+    const CartesianVector &vertexPosition2D(vertexFeatureContext.GetVertexPosition2D(hitType));
     float showerAsymmetry(1.f);
 
     for (const VertexSelectionBaseAlgorithm::ShowerCluster &showerCluster : showerClusterList)
@@ -40,10 +42,11 @@ float ShowerAsymmetryFeatureTool::GetAsymmetryForView(const CartesianVector &ver
             if (STATUS_CODE_SUCCESS != showerFit.GetGlobalFitDirection(rL, showerDirection))
                 continue;
 
-            ClusterVector asymmetryClusters;
-            std::copy(showerCluster.GetClusters().begin(), showerCluster.GetClusters().end(), std::back_inserter(asymmetryClusters));
+            CaloHitVectorList asymmetryCaloHits;
+            for (const CaloHitVector &caloHitVector : showerCluster.GetSortedCaloHits())
+                asymmetryCaloHits.push_back(&caloHitVector);
 
-            showerAsymmetry = this->CalculateAsymmetry(true, vertexPosition2D, asymmetryClusters, showerDirection);
+            showerAsymmetry = this->CalculateAsymmetry(true, vertexPosition2D, asymmetryCaloHits, showerDirection);
 
             break;
         }
@@ -32,12 +32,14 @@ private:
     /**
      *  @brief  Get the shower asymmetry feature for a given view
      *
-     *  @param  vertexPosition2D the projected vertex position
+     *  @param  vertexFeatureContext the geometry shared by the feature tools for this vertex
+     *  @param  hitType the view
      *  @param  showerClusterList the list of shower clusters in this view
      *
      *  @return the shower asymmetry feature
      */
-    float GetAsymmetryForView(const pandora::CartesianVector &vertexPosition2D, const VertexSelectionBaseAlgorithm::SlidingFitDataList &,
+    float GetAsymmetryForView(const VertexSelectionBaseAlgorithm::VertexFeatureContext &vertexFeatureContext,
+        const pandora::HitType hitType, const VertexSelectionBaseAlgorithm::SlidingFitDataList &,
         const VertexSelectionBaseAlgorithm::ShowerClusterList &showerClusterList) const override;
 
     /**
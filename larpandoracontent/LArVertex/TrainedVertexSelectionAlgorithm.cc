@@ -56,12 +56,21 @@ TrainedVertexSelectionAlgorithm::TrainedVertexSelectionAlgorithm() :
     m_dropFailedRPhiFastScoreCandidates(true),
     m_testBeamMode(false),
     m_legacyEventShapes(true),
-    m_legacyVariables(true)
+    m_legacyVariables(true),
+    m_stagedFeatureEvaluation(false)
 {
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+TrainedVertexSelectionAlgorithm::~TrainedVertexSelectionAlgorithm()
+{
+    if (m_trainingSetMode && (STATUS_CODE_SUCCESS != LArMvaHelper::FlushTrainingExamples()))
+        std::cout << "TrainedVertexSelectionAlgorithm: Unable to flush training examples" << std::endl;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void TrainedVertexSelectionAlgorithm::CalculateShowerClusterList(const ClusterList &inputClusterList, ShowerClusterList &showerClusterList) const
 {
     ClusterEndPointsMap clusterEndPointsMap;
@@ -437,48 +446,65 @@ void TrainedVertexSelectionAlgorithm::PopulateVertexFeatureInfoMap(const BeamCon
         tempBeamDeweight = this->GetBeamDeweightingScore(beamConstants, pVertex);
 
     const double beamDeweighting(tempBeamDeweight);
+    const VertexFeatureContext vertexFeatureContext(this->GetPandora(), pVertex, slidingFitDataListMap);
 
     const double energyKick(LArMvaHelper::CalculateFeaturesOfType<EnergyKickFeatureTool>(m_featureToolVector, this, pVertex,
-        slidingFitDataListMap, clusterListMap, kdTreeMap, showerClusterListMap, beamDeweighting, bestFastScore)
+        vertexFeatureContext, slidingFitDataListMap, clusterListMap, kdTreeMap, showerClusterListMap, beamDeweighting, bestFastScore)
                                 .at(0)
                                 .Get());
 
     const double localAsymmetry(LArMvaHelper::CalculateFeaturesOfType<LocalAsymmetryFeatureTool>(m_featureToolVector, this, pVertex,
-        slidingFitDataListMap, clusterListMap, kdTreeMap, showerClusterListMap, beamDeweighting, bestFastScore)
+        vertexFeatureContext, slidingFitDataListMap, clusterListMap, kdTreeMap, showerClusterListMap, beamDeweighting, bestFastScore)
                                     .at(0)
                                     .Get());
 
     const double globalAsymmetry(LArMvaHelper::CalculateFeaturesOfType<GlobalAsymmetryFeatureTool>(m_featureToolVector, this, pVertex,
-        slidingFitDataListMap, clusterListMap, kdTreeMap, showerClusterListMap, beamDeweighting, bestFastScore)
+        vertexFeatureContext, slidingFitDataListMap, clusterListMap, kdTreeMap, showerClusterListMap, beamDeweighting, bestFastScore)
                                      .at(0)
                                      .Get());
 
     const double showerAsymmetry(LArMvaHelper::CalculateFeaturesOfType<ShowerAsymmetryFeatureTool>(m_featureToolVector, this, pVertex,
-        slidingFitDataListMap, clusterListMap, kdTreeMap, showerClusterListMap, beamDeweighting, bestFastScore)
+        vertexFeatureContext, slidingFitDataListMap, clusterListMap, kdTreeMap, showerClusterListMap, beamDeweighting, bestFastScore)
                                      .at(0)
                                      .Get());
 
     //const double rPhiFeature(LArMvaHelper::CalculateFeaturesOfType<RPhiFeatureTool>(m_featureToolVector, this, pVertex,
     //    slidingFitDataListMap, clusterListMap, kdTreeMap, showerClusterListMap, beamDeweighting, bestFastScore).at(0).Get());
 
-    double dEdxAsymmetry(0.f), vertexEnergy(0.f);
+    VertexFeatureInfo vertexFeatureInfo(beamDeweighting, 0.f, energyKick, localAsymmetry, globalAsymmetry, showerAsymmetry, 0.f, 0.f);
 
-    if (!m_legacyVariables)
-    {
-        dEdxAsymmetry = LArMvaHelper::CalculateFeaturesOfType<EnergyDepositionAsymmetryFeatureTool>(m_featureToolVector, this, pVertex,
-            slidingFitDataListMap, clusterListMap, kdTreeMap, showerClusterListMap, beamDeweighting, bestFastScore)
-                            .at(0)
-                            .Get();
+    // ATTN - In staged mode the features not needed by the initial region score are only added for vertices surviving the region choice
+    if (!m_stagedFeatureEvaluation)
+        this->PopulateDeferredVertexFeatures(
+            clusterListMap, slidingFitDataListMap, showerClusterListMap, kdTreeMap, pVertex, vertexFeatureInfo);
 
-        vertexEnergy = this->GetVertexEnergy(pVertex, kdTreeMap);
-    }
-
-    VertexFeatureInfo vertexFeatureInfo(beamDeweighting, 0.f, energyKick, localAsymmetry, globalAsymmetry, showerAsymmetry, dEdxAsymmetry, vertexEnergy);
     vertexFeatureInfoMap.emplace(pVertex, vertexFeatureInfo);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void TrainedVertexSelectionAlgorithm::PopulateDeferredVertexFeatures(const ClusterListMap &clusterListMap,
+    const SlidingFitDataListMap &slidingFitDataListMap, const ShowerClusterListMap &showerClusterListMap, const KDTreeMap &kdTreeMap,
+    const Vertex *const pVertex, VertexFeatureInfo &vertexFeatureInfo) const
+{
+    if (m_legacyVariables)
+        return;
+
+    float bestFastScore(-std::numeric_limits<float>::max()); // not actually used, as in PopulateVertexFeatureInfoMap
+
+    const VertexFeatureContext vertexFeatureContext(this->GetPandora(), pVertex, slidingFitDataListMap);
+
+    vertexFeatureInfo.m_dEdxAsymmetry = static_cast<float>(LArMvaHelper::CalculateFeaturesOfType<EnergyDepositionAsymmetryFeatureTool>(
+        m_featureToolVector, this, pVertex, vertexFeatureContext, slidingFitDataListMap, clusterListMap, kdTreeMap, showerClusterListMap,
+        vertexFeatureInfo.m_beamDeweighting, bestFastScore)
+                                                               .at(0)
+                                                               .Get());
+
+    vertexFeatureInfo.m_vertexEnergy = static_cast<float>(this->GetVertexEnergy(pVertex, kdTreeMap));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void TrainedVertexSelectionAlgorithm::PopulateInitialScoreList(
     VertexFeatureInfoMap &vertexFeatureInfoMap, const Vertex *const pVertex, VertexScoreList &initialScoreList) const
 {
@@ -572,12 +598,15 @@ void TrainedVertexSelectionAlgorithm::CalculateRPhiScores(
     VertexVector &vertexVector, VertexFeatureInfoMap &vertexFeatureInfoMap, const KDTreeMap &kdTreeMap) const
 {
     float bestFastScore(-std::numeric_limits<float>::max());
+    const SlidingFitDataListMap slidingFitDataListMap;
 
     for (auto iter = vertexVector.begin(); iter != vertexVector.end(); /* no increment */)
     {
+        const VertexFeatureContext vertexFeatureContext(this->GetPandora(), *iter, slidingFitDataListMap);
         VertexFeatureInfo &vertexFeatureInfo = vertexFeatureInfoMap.at(*iter);
         vertexFeatureInfo.m_rPhiFeature = static_cast<float>(LArMvaHelper::CalculateFeaturesOfType<RPhiFeatureTool>(m_featureToolVector, this,
-            *iter, SlidingFitDataListMap(), ClusterListMap(), kdTreeMap, ShowerClusterListMap(), vertexFeatureInfo.m_beamDeweighting, bestFastScore)
+            *iter, vertexFeatureContext, slidingFitDataListMap, ClusterListMap(), kdTreeMap, ShowerClusterListMap(),
+            vertexFeatureInfo.m_beamDeweighting, bestFastScore)
                                                                  .at(0)
                                                                  .Get());
 
@@ -952,10 +981,20 @@ StatusCode TrainedVertexSelectionAlgorithm::ReadSettings(const TiXmlHandle xmlHa
 
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "LegacyVariables", m_legacyVariables));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
+        XmlHelper::ReadValue(xmlHandle, "StagedFeatureEvaluation", m_stagedFeatureEvaluation));
+
     if (m_trainingSetMode && m_legacyEventShapes)
         std::cout << "TrainedVertexSelectionAlgorithm: WARNING -- Producing training sample using incorrect legacy event shapes, consider turning LegacyEventShapes off"
                   << std::endl;
 
+    if (m_trainingSetMode && m_stagedFeatureEvaluation)
+    {
+        std::cout << "TrainedVertexSelectionAlgorithm: WARNING -- Training requires the full feature set, ignoring StagedFeatureEvaluation"
+                  << std::endl;
+        m_stagedFeatureEvaluation = false;
+    }
+
     return VertexSelectionBaseAlgorithm::ReadSettings(xmlHandle);
 }
 
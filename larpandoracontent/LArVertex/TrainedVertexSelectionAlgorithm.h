@@ -127,6 +127,11 @@ public:
      */
     TrainedVertexSelectionAlgorithm();
 
+    /**
+     *  @brief  Destructor, flushing any buffered training examples
+     */
+    ~TrainedVertexSelectionAlgorithm();
+
 protected:
     typedef std::pair<pandora::CartesianVector, pandora::CartesianVector> ClusterEndPoints;
     typedef std::map<const pandora::Cluster *const, ClusterEndPoints> ClusterEndPointsMap;
@@ -309,6 +314,20 @@ protected:
         const SlidingFitDataListMap &slidingFitDataListMap, const ShowerClusterListMap &showerClusterListMap, const KDTreeMap &kdTreeMap,
         const pandora::Vertex *const pVertex, VertexFeatureInfoMap &vertexFeatureInfoMap) const;
 
+    /**
+     *  @brief  Add the features not used by the initial region score (dE/dx asymmetry, vertex energy) to the feature info of a given vertex
+     *
+     *  @param  clusterListMap the cluster list map
+     *  @param  slidingFitDataListMap the sliding fit data list map
+     *  @param  showerClusterListMap the shower cluster list map
+     *  @param  kdTreeMap the kd tree map
+     *  @param  pVertex the vertex
+     *  @param  vertexFeatureInfo the vertex feature info to update
+     */
+    void PopulateDeferredVertexFeatures(const ClusterListMap &clusterListMap, const SlidingFitDataListMap &slidingFitDataListMap,
+        const ShowerClusterListMap &showerClusterListMap, const KDTreeMap &kdTreeMap, const pandora::Vertex *const pVertex,
+        VertexFeatureInfo &vertexFeatureInfo) const;
+
     /**
      *  @brief  Populate the initial vertex score list for a given vertex
      *
@@ -480,6 +499,7 @@ protected:
     bool m_testBeamMode;                      ///< Test beam mode
     bool m_legacyEventShapes;                 ///< Whether to use the old event shapes calculation
     bool m_legacyVariables;                   ///< Whether to only use the old variables
+    bool m_stagedFeatureEvaluation;           ///< Whether to defer features unused by the initial score to the chosen region
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
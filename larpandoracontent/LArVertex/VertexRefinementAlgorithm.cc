@@ -33,6 +33,9 @@ VertexRefinementAlgorithm::VertexRefinementAlgorithm() :
 
 StatusCode VertexRefinementAlgorithm::Run()
 {
+    // ATTN The cluster bounding boxes used to pre-check each vertex refinement are only cached within a geometry cache scope
+    const LArClusterHelper::GeometryCacheScope geometryCacheScope;
+
     const VertexList *pInputVertexList(nullptr);
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::GetCurrentList(*this, pInputVertexList));
 
@@ -96,16 +99,19 @@ void VertexRefinementAlgorithm::GetClusterLists(
 void VertexRefinementAlgorithm::RefineVertices(const VertexList *const pVertexList, const ClusterList &clusterListU,
     const ClusterList &clusterListV, const ClusterList &clusterListW) const
 {
+    // ATTN The cluster directions do not depend on the vertex, so are shared by all the vertices refined in this event
+    ClusterToDirectionMap clusterDirectionMapU, clusterDirectionMapV, clusterDirectionMapW;
+
     for (const Vertex *const pVertex : *pVertexList)
     {
         const CartesianVector originalPosition(pVertex->GetPosition());
 
-        const CartesianVector vtxU(
-            this->RefineVertexTwoD(clusterListU, LArGeometryHelper::ProjectPosition(this->GetPandora(), originalPosition, TPC_VIEW_U)));
-        const CartesianVector vtxV(
-            this->RefineVertexTwoD(clusterListV, LArGeometryHelper::ProjectPosition(this->GetPandora(), originalPosition, TPC_VIEW_V)));
-        const CartesianVector vtxW(
-            this->RefineVertexTwoD(clusterListW, LArGeometryHelper::ProjectPosition(this->GetPandora(), originalPosition, TPC_VIEW_W)));
+        const CartesianVector vtxU(this->RefineVertexTwoD(
+            clusterListU, LArGeometryHelper::ProjectPosition(this->GetPandora(), originalPosition, TPC_VIEW_U), clusterDirectionMapU));
+        const CartesianVector vtxV(this->RefineVertexTwoD(
+            clusterListV, LArGeometryHelper::ProjectPosition(this->GetPandora(), originalPosition, TPC_VIEW_V), clusterDirectionMapV));
+        const CartesianVector vtxW(this->RefineVertexTwoD(
+            clusterListW, LArGeometryHelper::ProjectPosition(this->GetPandora(), originalPosition, TPC_VIEW_W), clusterDirectionMapW));
 
         CartesianVector vtxUV(0.f, 0.f, 0.f), vtxUW(0.f, 0.f, 0.f), vtxVW(0.f, 0.f, 0.f), vtx3D(0.f, 0.f, 0.f), position3D(0.f, 0.f, 0.f);
         float chi2UV(0.f), chi2UW(0.f), chi2VW(0.f), chi23D(0.f), chi2(0.f);
@@ -154,30 +160,29 @@ void VertexRefinementAlgorithm::RefineVertices(const VertexList *const pVertexLi
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-CartesianVector VertexRefinementAlgorithm::RefineVertexTwoD(const ClusterList &clusterList, const CartesianVector &originalVtxPos) const
+CartesianVector VertexRefinementAlgorithm::RefineVertexTwoD(
+    const ClusterList &clusterList, const CartesianVector &originalVtxPos, ClusterToDirectionMap &clusterDirectionMap) const
 {
     CartesianPointVector intercepts, directions;
     FloatVector weights;
 
     for (const Cluster *const pCluster : clusterList)
     {
-        if (LArClusterHelper::GetClosestDistance(originalVtxPos, pCluster) > 10)
+        if (pCluster->GetNCaloHits() < m_minimumHitsCut)
             continue;
 
-        if (pCluster->GetNCaloHits() < m_minimumHitsCut)
+        // ATTN The bounding box distance is a lower bound on the closest distance, so spares the hit loop for most distant clusters
+        if (LArClusterHelper::GetBoundingBoxDistance(originalVtxPos, pCluster) > 10.f + 0.01f)
             continue;
 
-        CartesianVector centroid(0.f, 0.f, 0.f);
-        LArPcaHelper::EigenValues eigenValues(0.f, 0.f, 0.f);
-        LArPcaHelper::EigenVectors eigenVectors;
-        CartesianPointVector pointVector;
+        if (LArClusterHelper::GetClosestDistance(originalVtxPos, pCluster) > 10)
+            continue;
 
-        LArClusterHelper::GetCoordinateVector(pCluster, pointVector);
-        LArPcaHelper::RunPca(pointVector, centroid, eigenValues, eigenVectors);
+        const CartesianVector closestPosition(LArClusterHelper::GetClosestPosition(originalVtxPos, pCluster));
 
-        intercepts.push_back(LArClusterHelper::GetClosestPosition(originalVtxPos, pCluster));
-        directions.push_back(eigenVectors.at(0).GetUnitVector());
-        weights.push_back(1.f / ((LArClusterHelper::GetClosestPosition(originalVtxPos, pCluster) - originalVtxPos).GetMagnitudeSquared() + 1));
+        intercepts.push_back(closestPosition);
+        directions.push_back(this->GetClusterDirection(pCluster, clusterDirectionMap));
+        weights.push_back(1.f / ((closestPosition - originalVtxPos).GetMagnitudeSquared() + 1));
     }
 
     CartesianVector newVtxPos(originalVtxPos);
@@ -192,6 +197,27 @@ CartesianVector VertexRefinementAlgorithm::RefineVertexTwoD(const ClusterList &c
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+const CartesianVector &VertexRefinementAlgorithm::GetClusterDirection(
+    const Cluster *const pCluster, ClusterToDirectionMap &clusterDirectionMap) const
+{
+    ClusterToDirectionMap::const_iterator iter(clusterDirectionMap.find(pCluster));
+
+    if (clusterDirectionMap.end() != iter)
+        return iter->second;
+
+    CartesianVector centroid(0.f, 0.f, 0.f);
+    LArPcaHelper::EigenValues eigenValues(0.f, 0.f, 0.f);
+    LArPcaHelper::EigenVectors eigenVectors;
+    CartesianPointVector pointVector;
+
+    LArClusterHelper::GetCoordinateVector(pCluster, pointVector);
+    LArPcaHelper::RunPca(pointVector, centroid, eigenValues, eigenVectors);
+
+    return clusterDirectionMap.emplace(pCluster, eigenVectors.at(0).GetUnitVector()).first->second;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void VertexRefinementAlgorithm::GetBestFitPoint(const CartesianPointVector &intercepts, const CartesianPointVector &directions,
     const FloatVector &weights, CartesianVector &bestFitPoint) const
 {
@@ -215,13 +241,15 @@ void VertexRefinementAlgorithm::GetBestFitPoint(const CartesianPointVector &inte
         G(3 * i + 2, i + 3) = -directions[i].GetZ();
     }
 
-    if ((G.transpose() * G).determinant() < std::numeric_limits<float>::epsilon())
+    const Eigen::MatrixXd GTG(G.transpose() * G);
+
+    if (GTG.determinant() < std::numeric_limits<float>::epsilon())
     {
         bestFitPoint = CartesianVector(std::numeric_limits<float>::max(), std::numeric_limits<float>::max(), std::numeric_limits<float>::max());
         return;
     }
 
-    Eigen::VectorXd m = (G.transpose() * G).inverse() * G.transpose() * d;
+    Eigen::VectorXd m = GTG.inverse() * G.transpose() * d;
 
     bestFitPoint = CartesianVector(m[0], m[1], m[2]);
 }
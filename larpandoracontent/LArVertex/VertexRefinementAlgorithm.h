@@ -10,6 +10,8 @@
 
 #include "Pandora/Algorithm.h"
 
+#include <unordered_map>
+
 namespace lar_content
 {
 
@@ -25,6 +27,8 @@ public:
     VertexRefinementAlgorithm();
 
 private:
+    typedef std::unordered_map<const pandora::Cluster *, pandora::CartesianVector> ClusterToDirectionMap;
+
     pandora::StatusCode Run();
 
     /**
@@ -54,10 +58,23 @@ private:
      *
      *  @param  clusterList the list of two dimensional clusters
      *  @param  originalVtxPos the original vertex position projected into two dimensions
+     *  @param  clusterDirectionMap the cache of the principal axis directions of the clusters in this view
      *
      *  @return the new refined position
      */
-    pandora::CartesianVector RefineVertexTwoD(const pandora::ClusterList &clusterList, const pandora::CartesianVector &originalVtxPos) const;
+    pandora::CartesianVector RefineVertexTwoD(const pandora::ClusterList &clusterList, const pandora::CartesianVector &originalVtxPos,
+        ClusterToDirectionMap &clusterDirectionMap) const;
+
+    /**
+     *  @brief  Get the principal axis direction of a cluster, calculating and caching it on first use
+     *
+     *  @param  pCluster address of the cluster
+     *  @param  clusterDirectionMap the cache of the principal axis directions
+     *
+     *  @return the principal axis direction
+     */
+    const pandora::CartesianVector &GetClusterDirection(
+        const pandora::Cluster *const pCluster, ClusterToDirectionMap &clusterDirectionMap) const;
 
     /**
      *  @brief  Calculate the best fit point of a set of lines using a matrix equation
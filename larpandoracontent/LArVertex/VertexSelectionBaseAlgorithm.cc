@@ -9,6 +9,8 @@
 
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
+#include "larpandoracontent/LArHelpers/LArSlidingFitCacheHelper.h"
+#include "larpandoracontent/LArHelpers/LArSpatialIndexHelper.h"
 
 #include "larpandoracontent/LArUtility/KDTreeLinkerAlgoT.h"
 
@@ -23,6 +25,7 @@ VertexSelectionBaseAlgorithm::VertexSelectionBaseAlgorithm() :
     m_replaceCurrentVertexList(true),
     m_beamMode(true),
     m_nDecayLengthsInZSpan(2.f),
+    m_minBeamDeweightingScore(-std::numeric_limits<float>::max()),
     m_selectSingleVertex(true),
     m_maxTopScoreSelections(3),
     m_maxOnHitDisplacement(1.f),
@@ -31,7 +34,8 @@ VertexSelectionBaseAlgorithm::VertexSelectionBaseAlgorithm() :
     m_useDetectorGaps(true),
     m_gapTolerance(0.f),
     m_isEmptyViewAcceptable(true),
-    m_minVertexAcceptableViews(3)
+    m_minVertexAcceptableViews(3),
+    m_nScoringThreads(1)
 {
 }
 
@@ -133,7 +137,8 @@ void VertexSelectionBaseAlgorithm::CalculateClusterSlidingFits(const ClusterList
         // Make sure the window size is such that there are not more layers than hits (following TwoDSlidingLinearFit calculation).
         const unsigned int newSlidingFitWindow(
             std::min(static_cast<int>(pCluster->GetNCaloHits()), static_cast<int>(slidingFitPitch * slidingFitWindow)));
-        slidingFitDataList.emplace_back(pCluster, newSlidingFitWindow, slidingFitPitch);
+        slidingFitDataList.emplace_back(
+            pCluster, LArSlidingFitCacheHelper::GetSlidingFitResult(this->GetPandora(), pCluster, newSlidingFitWindow, slidingFitPitch));
     }
 }
 
@@ -152,8 +157,12 @@ StatusCode VertexSelectionBaseAlgorithm::Run()
         return STATUS_CODE_SUCCESS;
     }
 
-    HitKDTree2D kdTreeU, kdTreeV, kdTreeW;
-    this->InitializeKDTrees(kdTreeU, kdTreeV, kdTreeW);
+    // Views without a configured calo hit list are represented by empty kd trees
+    HitKDTree2D emptyKDTreeU, emptyKDTreeV, emptyKDTreeW;
+    HitKDTree2D *pKDTreeU(&emptyKDTreeU), *pKDTreeV(&emptyKDTreeV), *pKDTreeW(&emptyKDTreeW);
+    this->InitializeKDTrees(pKDTreeU, pKDTreeV, pKDTreeW);
+
+    HitKDTree2D &kdTreeU(*pKDTreeU), &kdTreeV(*pKDTreeV), &kdTreeW(*pKDTreeW);
 
     VertexVector filteredVertices;
     this->FilterVertexList(pInputVertexList, kdTreeU, kdTreeV, kdTreeW, filteredVertices);
@@ -164,6 +173,19 @@ StatusCode VertexSelectionBaseAlgorithm::Run()
     BeamConstants beamConstants;
     this->GetBeamConstants(filteredVertices, beamConstants);
 
+    // ATTN Beam constants are taken from the full filtered list, so the deweighting of the surviving candidates is unchanged by this cut
+    if (m_beamMode && (m_minBeamDeweightingScore > -std::numeric_limits<float>::max()))
+    {
+        filteredVertices.erase(std::remove_if(filteredVertices.begin(), filteredVertices.end(),
+                                   [&](const Vertex *const pVertex) {
+                                       return (this->GetBeamDeweightingScore(beamConstants, pVertex) < m_minBeamDeweightingScore);
+                                   }),
+            filteredVertices.end());
+
+        if (filteredVertices.empty())
+            return STATUS_CODE_SUCCESS;
+    }
+
     VertexScoreList vertexScoreList;
     this->GetVertexScoreList(filteredVertices, beamConstants, kdTreeU, kdTreeV, kdTreeW, vertexScoreList);
 
@@ -183,7 +205,7 @@ StatusCode VertexSelectionBaseAlgorithm::Run()
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void VertexSelectionBaseAlgorithm::InitializeKDTrees(HitKDTree2D &kdTreeU, HitKDTree2D &kdTreeV, HitKDTree2D &kdTreeW) const
+void VertexSelectionBaseAlgorithm::InitializeKDTrees(HitKDTree2D *&pKDTreeU, HitKDTree2D *&pKDTreeV, HitKDTree2D *&pKDTreeW) const
 {
     for (const std::string &caloHitListName : m_inputCaloHitListNames)
     {
@@ -204,14 +226,12 @@ void VertexSelectionBaseAlgorithm::InitializeKDTrees(HitKDTree2D &kdTreeU, HitKD
         if ((TPC_VIEW_U != hitType) && (TPC_VIEW_V != hitType) && (TPC_VIEW_W != hitType))
             throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
 
-        HitKDTree2D &kdTree((TPC_VIEW_U == hitType) ? kdTreeU : (TPC_VIEW_V == hitType) ? kdTreeV : kdTreeW);
+        HitKDTree2D *&pKDTree((TPC_VIEW_U == hitType) ? pKDTreeU : (TPC_VIEW_V == hitType) ? pKDTreeV : pKDTreeW);
 
-        if (!kdTree.empty())
+        if (!pKDTree->empty())
             throw StatusCodeException(STATUS_CODE_FAILURE);
 
-        HitKDNode2DList hitKDNode2DList;
-        KDTreeBox hitsBoundingRegion2D(fill_and_bound_2d_kd_tree(*pCaloHitList, hitKDNode2DList));
-        kdTree.build(hitKDNode2DList, hitsBoundingRegion2D);
+        pKDTree = &LArSpatialIndexHelper::GetHitKDTree2D(*this, caloHitListName, hitType);
     }
 }
 
@@ -346,18 +366,22 @@ bool VertexSelectionBaseAlgorithm::SortByVertexZPosition(const pandora::Vertex *
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-VertexSelectionBaseAlgorithm::SlidingFitData::SlidingFitData(const pandora::Cluster *const pCluster, const int slidingFitWindow, const float slidingFitPitch) :
-    m_minLayerDirection(0.f, 0.f, 0.f),
-    m_maxLayerDirection(0.f, 0.f, 0.f),
-    m_minLayerPosition(0.f, 0.f, 0.f),
-    m_maxLayerPosition(0.f, 0.f, 0.f),
-    m_pCluster(pCluster)
+VertexSelectionBaseAlgorithm::SlidingFitData::SlidingFitData(
+    const pandora::Cluster *const pCluster, const TwoDSlidingFitResult &slidingFitResult) :
+    m_minLayerDirection(slidingFitResult.GetGlobalMinLayerDirection()),
+    m_maxLayerDirection(slidingFitResult.GetGlobalMaxLayerDirection()),
+    m_minLayerPosition(slidingFitResult.GetGlobalMinLayerPosition()),
+    m_maxLayerPosition(slidingFitResult.GetGlobalMaxLayerPosition()),
+    m_pCluster(pCluster),
+    m_minimumCoordinate(0.f, 0.f, 0.f),
+    m_maximumCoordinate(0.f, 0.f, 0.f)
 {
-    const TwoDSlidingFitResult slidingFitResult(pCluster, slidingFitWindow, slidingFitPitch);
-    m_minLayerDirection = slidingFitResult.GetGlobalMinLayerDirection();
-    m_maxLayerDirection = slidingFitResult.GetGlobalMaxLayerDirection();
-    m_minLayerPosition = slidingFitResult.GetGlobalMinLayerPosition();
-    m_maxLayerPosition = slidingFitResult.GetGlobalMaxLayerPosition();
+    // ATTN Sorted and bounded once per event, rather than for each vertex candidate by the asymmetry feature tools
+    CaloHitList caloHitList;
+    pCluster->GetOrderedCaloHitList().FillCaloHitList(caloHitList);
+    m_sortedCaloHits.assign(caloHitList.begin(), caloHitList.end());
+    std::sort(m_sortedCaloHits.begin(), m_sortedCaloHits.end(), LArClusterHelper::SortHitsByPosition);
+    LArClusterHelper::GetClusterBoundingBox(pCluster, m_minimumCoordinate, m_maximumCoordinate);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -367,6 +391,15 @@ VertexSelectionBaseAlgorithm::ShowerCluster::ShowerCluster(const pandora::Cluste
     m_coordinateVector(this->GetClusterListCoordinateVector(clusterList)),
     m_twoDSlidingFitResult(&m_coordinateVector, slidingFitWindow, slidingFitPitch)
 {
+    for (const Cluster *const pCluster : m_clusterList)
+    {
+        CaloHitList caloHitList;
+        pCluster->GetOrderedCaloHitList().FillCaloHitList(caloHitList);
+
+        CaloHitVector caloHitVector(caloHitList.begin(), caloHitList.end());
+        std::sort(caloHitVector.begin(), caloHitVector.end(), LArClusterHelper::SortHitsByPosition);
+        m_sortedCaloHits.push_back(std::move(caloHitVector));
+    }
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -387,6 +420,34 @@ pandora::CartesianPointVector VertexSelectionBaseAlgorithm::ShowerCluster::GetCl
     return coordinateVector;
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+VertexSelectionBaseAlgorithm::VertexFeatureContext::VertexFeatureContext(
+    const Pandora &pandora, const Vertex *const pVertex, const SlidingFitDataListMap &slidingFitDataListMap) :
+    m_slidingFitDataListMap(slidingFitDataListMap)
+{
+    for (const HitType hitType : {TPC_VIEW_U, TPC_VIEW_V, TPC_VIEW_W})
+        m_vertexPositionMap.emplace(hitType, LArGeometryHelper::ProjectPosition(pandora, pVertex->GetPosition(), hitType));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+float VertexSelectionBaseAlgorithm::VertexFeatureContext::GetClosestDistance(const HitType hitType, const unsigned int index) const
+{
+    const SlidingFitDataList &slidingFitDataList(m_slidingFitDataListMap.at(hitType));
+    FloatVector &closestDistances(m_closestDistanceMap[hitType]);
+
+    if (closestDistances.empty())
+        closestDistances.resize(slidingFitDataList.size(), -1.f);
+
+    float &closestDistance(closestDistances.at(index));
+
+    if (closestDistance < 0.f)
+        closestDistance = LArClusterHelper::GetClosestDistance(m_vertexPositionMap.at(hitType), slidingFitDataList.at(index).GetCluster());
+
+    return closestDistance;
+}
+
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -404,6 +465,9 @@ StatusCode VertexSelectionBaseAlgorithm::ReadSettings(const TiXmlHandle xmlHandl
     PANDORA_RETURN_RESULT_IF_AND_IF(
         STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "NDecayLengthsInZSpan", m_nDecayLengthsInZSpan));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
+        XmlHelper::ReadValue(xmlHandle, "MinBeamDeweightingScore", m_minBeamDeweightingScore));
+
     PANDORA_RETURN_RESULT_IF_AND_IF(
         STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "SelectSingleVertex", m_selectSingleVertex));
 
@@ -429,6 +493,9 @@ StatusCode VertexSelectionBaseAlgorithm::ReadSettings(const TiXmlHandle xmlHandl
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
         XmlHelper::ReadValue(xmlHandle, "MinVertexAcceptableViews", m_minVertexAcceptableViews));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "NScoringThreads", m_nScoringThreads));
+
     return STATUS_CODE_SUCCESS;
 }
 
@@ -124,10 +124,9 @@ public:
          *  @brief  Constructor
          *
          *  @param  pCluster pointer to the cluster
-         *  @param  slidingFitWindow the sliding fit window
-         *  @param  slidingFitPitch the sliding fit pitch
+         *  @param  slidingFitResult the sliding fit result for the cluster
          */
-        SlidingFitData(const pandora::Cluster *const pCluster, const int slidingFitWindow, const float slidingFitPitch);
+        SlidingFitData(const pandora::Cluster *const pCluster, const TwoDSlidingFitResult &slidingFitResult);
 
         /**
          *  @brief  Get the min layer direction
@@ -164,12 +163,31 @@ public:
          */
         const pandora::Cluster *GetCluster() const;
 
+        /**
+         *  @brief  Get the calo hits of the corresponding cluster, sorted by position
+         *
+         *  @return the sorted calo hit vector
+         */
+        const pandora::CaloHitVector &GetSortedCaloHits() const;
+
+        /**
+         *  @brief  Get the distance between a position and the bounding box of the corresponding cluster
+         *
+         *  @param  position the position
+         *
+         *  @return the bounding box distance, a lower bound on the distance to the closest hit
+         */
+        float GetBoundingBoxDistance(const pandora::CartesianVector &position) const;
+
     private:
         pandora::CartesianVector m_minLayerDirection; ///< The direction of the fit at the min layer
         pandora::CartesianVector m_maxLayerDirection; ///< The direction of the fit at the min layer
         pandora::CartesianVector m_minLayerPosition;  ///< The position of the fit at the max layer
         pandora::CartesianVector m_maxLayerPosition;  ///< The position of the fit at the max layer
         const pandora::Cluster *m_pCluster;           ///< Pointer to the corresponding cluster
+        pandora::CaloHitVector m_sortedCaloHits;      ///< The calo hits of the corresponding cluster, sorted by position
+        pandora::CartesianVector m_minimumCoordinate; ///< The minimum coordinates of the bounding box of the corresponding cluster
+        pandora::CartesianVector m_maximumCoordinate; ///< The maximum coordinates of the bounding box of the corresponding cluster
     };
 
     typedef std::vector<SlidingFitData> SlidingFitDataList;
@@ -203,6 +221,13 @@ public:
          */
         const TwoDSlidingFitResult &GetFit() const;
 
+        /**
+         *  @brief  Get the calo hits of each cluster, sorted by position, in cluster list order
+         *
+         *  @return the sorted calo hit vectors
+         */
+        const std::vector<pandora::CaloHitVector> &GetSortedCaloHits() const;
+
         /**
          *  @brief  Get the coordinate vector for a cluster list
          *
@@ -213,9 +238,10 @@ public:
         pandora::CartesianPointVector GetClusterListCoordinateVector(const pandora::ClusterList &clusterList) const;
 
     private:
-        pandora::ClusterList m_clusterList;               ///< The list of clusters
-        pandora::CartesianPointVector m_coordinateVector; ///< The coordinate vector
-        TwoDSlidingFitResult m_twoDSlidingFitResult;      ///< The fit to the hits of the cluster list
+        pandora::ClusterList m_clusterList;                   ///< The list of clusters
+        pandora::CartesianPointVector m_coordinateVector;     ///< The coordinate vector
+        TwoDSlidingFitResult m_twoDSlidingFitResult;          ///< The fit to the hits of the cluster list
+        std::vector<pandora::CaloHitVector> m_sortedCaloHits; ///< The calo hits of each cluster, sorted by position
     };
 
     typedef std::vector<ShowerCluster> ShowerClusterList;
@@ -229,8 +255,52 @@ public:
     typedef std::map<pandora::HitType, const ShowerClusterList> ShowerClusterListMap; ///< Map of shower cluster lists for passing to tools
     typedef std::map<pandora::HitType, const std::reference_wrapper<HitKDTree2D>> KDTreeMap; ///< Map array of hit kd trees for passing to tools
 
-    typedef MvaFeatureTool<const VertexSelectionBaseAlgorithm *const, const pandora::Vertex *const, const SlidingFitDataListMap &,
-        const ClusterListMap &, const KDTreeMap &, const ShowerClusterListMap &, const float, float &>
+    /**
+     *  @brief Vertex feature context class, holding the vertex geometry shared by all feature tools run for a vertex
+     */
+    class VertexFeatureContext
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  pandora the associated pandora instance
+         *  @param  pVertex address of the vertex
+         *  @param  slidingFitDataListMap the sliding fit data list map
+         */
+        VertexFeatureContext(
+            const pandora::Pandora &pandora, const pandora::Vertex *const pVertex, const SlidingFitDataListMap &slidingFitDataListMap);
+
+        /**
+         *  @brief  Get the vertex position projected into a given view
+         *
+         *  @param  hitType the view
+         *
+         *  @return the projected vertex position
+         */
+        const pandora::CartesianVector &GetVertexPosition2D(const pandora::HitType hitType) const;
+
+        /**
+         *  @brief  Get the closest distance between the projected vertex and a sliding fit cluster, calculated on first use
+         *
+         *  @param  hitType the view
+         *  @param  index the index of the sliding fit data object in the sliding fit data list for this view
+         *
+         *  @return the closest distance
+         */
+        float GetClosestDistance(const pandora::HitType hitType, const unsigned int index) const;
+
+    private:
+        typedef std::map<pandora::HitType, pandora::CartesianVector> HitTypeToPositionMap;
+        typedef std::map<pandora::HitType, pandora::FloatVector> HitTypeToFloatVectorMap;
+
+        HitTypeToPositionMap m_vertexPositionMap;             ///< The vertex position projected into each view
+        const SlidingFitDataListMap &m_slidingFitDataListMap; ///< The sliding fit data list map
+        mutable HitTypeToFloatVectorMap m_closestDistanceMap; ///< The closest distances to the sliding fit clusters, negative until known
+    };
+
+    typedef MvaFeatureTool<const VertexSelectionBaseAlgorithm *const, const pandora::Vertex *const, const VertexFeatureContext &,
+        const SlidingFitDataListMap &, const ClusterListMap &, const KDTreeMap &, const ShowerClusterListMap &, const float, float &>
         VertexFeatureTool; ///< The base type for the vertex feature tools
 
 protected:
@@ -306,6 +376,13 @@ protected:
      */
     bool IsBeamModeOn() const;
 
+    /**
+     *  @brief  Get the number of threads with which to score vertex candidates, for algorithms whose per-vertex scores are independent
+     *
+     *  @return the number of threads (zero to use all available hardware threads)
+     */
+    unsigned int GetNScoringThreads() const;
+
     /**
      *  @brief  Calculate the energy of a vertex candidate by summing values from all three planes
      *
@@ -333,13 +410,14 @@ private:
     pandora::StatusCode Run();
 
     /**
-     *  @brief  Initialize kd trees with details of hits in algorithm-configured cluster lists
+     *  @brief  Initialize kd trees with details of hits in algorithm-configured calo hit lists, using the kd trees shared between
+     *          algorithms within the event. Views without a configured calo hit list retain the kd trees initially provided
      *
-     *  @param  kdTreeU the kd tree for u hits
-     *  @param  kdTreeV the kd tree for v hits
-     *  @param  kdTreeW the kd tree for w hits
+     *  @param  pKDTreeU to receive the address of the kd tree for u hits
+     *  @param  pKDTreeV to receive the address of the kd tree for v hits
+     *  @param  pKDTreeW to receive the address of the kd tree for w hits
      */
-    void InitializeKDTrees(HitKDTree2D &kdTreeU, HitKDTree2D &kdTreeV, HitKDTree2D &kdTreeW) const;
+    void InitializeKDTrees(HitKDTree2D *&pKDTreeU, HitKDTree2D *&pKDTreeV, HitKDTree2D *&pKDTreeW) const;
 
     /**
      *  @brief  Whether the vertex lies on a hit in the specified view
@@ -396,8 +474,9 @@ private:
 
     bool m_replaceCurrentVertexList; ///< Whether to replace the current vertex list with the output list
 
-    bool m_beamMode;              ///< Whether to run in beam mode, assuming neutrinos travel in positive z-direction
-    float m_nDecayLengthsInZSpan; ///< The number of score decay lengths to use over the course of the vertex z-span
+    bool m_beamMode;                 ///< Whether to run in beam mode, assuming neutrinos travel in positive z-direction
+    float m_nDecayLengthsInZSpan;    ///< The number of score decay lengths to use over the course of the vertex z-span
+    float m_minBeamDeweightingScore; ///< In beam mode, the beam deweighting score below which candidates are discarded before scoring
 
     bool m_selectSingleVertex;            ///< Whether to make a final decision and select just one vertex candidate
     unsigned int m_maxTopScoreSelections; ///< Max number of top-scoring vertex candidate to select for output
@@ -412,6 +491,8 @@ private:
 
     bool m_isEmptyViewAcceptable; ///< Whether views entirely empty of hits are classed as 'acceptable' for candidate filtration
     unsigned int m_minVertexAcceptableViews; ///< The minimum number of views in which a candidate must sit on/near a hit or in a gap (or view can be empty)
+
+    unsigned int m_nScoringThreads; ///< The number of threads with which to score vertex candidates, zero to use all hardware threads
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -429,6 +510,13 @@ inline bool VertexSelectionBaseAlgorithm::IsBeamModeOn() const
     return m_beamMode;
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline unsigned int VertexSelectionBaseAlgorithm::GetNScoringThreads() const
+{
+    return m_nScoringThreads;
+}
+
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -519,6 +607,32 @@ inline const pandora::Cluster *VertexSelectionBaseAlgorithm::SlidingFitData::Get
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+inline const pandora::CaloHitVector &VertexSelectionBaseAlgorithm::SlidingFitData::GetSortedCaloHits() const
+{
+    return m_sortedCaloHits;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline float VertexSelectionBaseAlgorithm::SlidingFitData::GetBoundingBoxDistance(const pandora::CartesianVector &position) const
+{
+    const float dx(std::max(0.f, std::max(m_minimumCoordinate.GetX() - position.GetX(), position.GetX() - m_maximumCoordinate.GetX())));
+    const float dy(std::max(0.f, std::max(m_minimumCoordinate.GetY() - position.GetY(), position.GetY() - m_maximumCoordinate.GetY())));
+    const float dz(std::max(0.f, std::max(m_minimumCoordinate.GetZ() - position.GetZ(), position.GetZ() - m_maximumCoordinate.GetZ())));
+
+    return std::sqrt(dx * dx + dy * dy + dz * dz);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const pandora::CartesianVector &VertexSelectionBaseAlgorithm::VertexFeatureContext::GetVertexPosition2D(
+    const pandora::HitType hitType) const
+{
+    return m_vertexPositionMap.at(hitType);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 inline const pandora::ClusterList &VertexSelectionBaseAlgorithm::ShowerCluster::GetClusters() const
 {
     return m_clusterList;
@@ -531,6 +645,13 @@ inline const TwoDSlidingFitResult &VertexSelectionBaseAlgorithm::ShowerCluster::
     return m_twoDSlidingFitResult;
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const std::vector<pandora::CaloHitVector> &VertexSelectionBaseAlgorithm::ShowerCluster::GetSortedCaloHits() const
+{
+    return m_sortedCaloHits;
+}
+
 } // namespace lar_content
 
 #endif // #ifndef LAR_VERTEX_SELECTION_BASE_ALGORITHM_H
@@ -13,11 +13,41 @@ namespace lar_dl_content
 
 using namespace pandora;
 
-StatusCode LArDLHelper::LoadModel(const std::string &filename, LArDLHelper::TorchModel &model)
+std::mutex LArDLHelper::m_modelRegistryMutex;
+LArDLHelper::ModelRegistry LArDLHelper::m_modelRegistry;
+bool LArDLHelper::m_areThreadSettingsApplied(false);
+std::pair<unsigned int, unsigned int> LArDLHelper::m_threadSettings(0, 0);
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode LArDLHelper::LoadModel(
+    const std::string &filename, LArDLHelper::TorchModel &model, const std::string &device, const Precision precision)
 {
+    if ((QUANTISED_INT8 == precision) && ("cpu" != device))
+    {
+        std::cout << "LArDLHelper::LoadModel - quantised int8 inference is only supported on the cpu" << std::endl;
+        return STATUS_CODE_INVALID_PARAMETER;
+    }
+
+    const std::lock_guard<std::mutex> lock(m_modelRegistryMutex);
+    const ModelRegistry::key_type key(filename, device, precision);
+    ModelRegistry::const_iterator iter(m_modelRegistry.find(key));
+
+    if (m_modelRegistry.end() != iter)
+    {
+        // ATTN Copying a module shares, rather than duplicates, the underlying parameters
+        model = iter->second;
+        return STATUS_CODE_SUCCESS;
+    }
+
     try
     {
-        model = torch::jit::load(filename);
+        model = torch::jit::load(filename, torch::Device(device));
+
+        // ATTN A quantised model is used as exported, its float layers and the inputs remaining in float32
+        if ((FLOAT16 == precision) || (BFLOAT16 == precision))
+            model.to(LArDLHelper::GetInputType(precision));
+
         std::cout << "Loaded the TorchScript model \'" << filename << "\'" << std::endl;
     }
     catch (const std::exception &e)
@@ -26,11 +56,65 @@ StatusCode LArDLHelper::LoadModel(const std::string &filename, LArDLHelper::Torc
         return STATUS_CODE_FAILURE;
     }
 
+    m_modelRegistry.insert(ModelRegistry::value_type(key, model));
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode LArDLHelper::GetPrecision(const std::string &name, Precision &precision)
+{
+    if ("fp32" == name)
+        precision = FLOAT32;
+    else if ("fp16" == name)
+        precision = FLOAT16;
+    else if ("bf16" == name)
+        precision = BFLOAT16;
+    else if ("int8" == name)
+        precision = QUANTISED_INT8;
+    else
+    {
+        std::cout << "LArDLHelper::GetPrecision - unrecognised precision \'" << name << "\'" << std::endl;
+        return STATUS_CODE_INVALID_PARAMETER;
+    }
+
     return STATUS_CODE_SUCCESS;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void LArDLHelper::ApplyThreadSettings(const unsigned int nIntraOpThreads, const unsigned int nInterOpThreads)
+{
+    const std::lock_guard<std::mutex> lock(m_modelRegistryMutex);
+
+    if (m_areThreadSettingsApplied)
+    {
+        if (m_threadSettings != std::make_pair(nIntraOpThreads, nInterOpThreads))
+            std::cout << "LArDLHelper::ApplyThreadSettings - torch thread settings already applied, ignoring new settings" << std::endl;
+
+        return;
+    }
+
+    try
+    {
+        if (nIntraOpThreads > 0)
+            at::set_num_threads(nIntraOpThreads);
+
+        if (nInterOpThreads > 0)
+            at::set_num_interop_threads(nInterOpThreads);
+    }
+    catch (const std::exception &e)
+    {
+        std::cout << "LArDLHelper::ApplyThreadSettings - unable to apply torch thread settings:\n" << e.what() << std::endl;
+    }
+
+    m_areThreadSettingsApplied = true;
+    m_threadSettings = std::make_pair(nIntraOpThreads, nInterOpThreads);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void LArDLHelper::InitialiseInput(const at::IntArrayRef dimensions, TorchInput &tensor)
 {
     tensor = torch::zeros(dimensions);
@@ -43,4 +127,144 @@ void LArDLHelper::Forward(TorchModel &model, const TorchInputVector &input, Torc
     output = model.forward(input).toTensor();
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArDLHelper::Forward(
+    TorchModel &model, const TorchInputVector &input, TorchOutput &output, const std::string &device, const Precision precision)
+{
+    const torch::Dtype inputType(LArDLHelper::GetInputType(precision));
+
+    if ((torch::kFloat32 == inputType) && ("cpu" == device))
+    {
+        LArDLHelper::Forward(model, input, output);
+        return;
+    }
+
+    const torch::Device torchDevice(device);
+    TorchInputVector deviceInput;
+
+    for (const torch::jit::IValue &value : input)
+        deviceInput.push_back(value.isTensor() ? torch::jit::IValue(value.toTensor().to(torchDevice, inputType)) : value);
+
+    output = model.forward(deviceInput).toTensor().to(torch::kCPU, torch::kFloat32);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+torch::Dtype LArDLHelper::GetInputType(const Precision precision)
+{
+    switch (precision)
+    {
+        case FLOAT16:
+            return torch::kFloat16;
+        case BFLOAT16:
+            return torch::kBFloat16;
+        default:
+            return torch::kFloat32;
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArDLHelper::InferenceBatch::InferenceBatch(const unsigned int maxBatchSize) :
+    m_maxBatchSize(maxBatchSize),
+    m_device("cpu"),
+    m_precision(FLOAT32)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArDLHelper::InferenceBatch::SetMaxBatchSize(const unsigned int maxBatchSize)
+{
+    m_maxBatchSize = maxBatchSize;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArDLHelper::InferenceBatch::SetInferenceOptions(const std::string &device, const Precision precision)
+{
+    m_device = device;
+    m_precision = precision;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+unsigned int LArDLHelper::InferenceBatch::AddInput(const TorchInput &input)
+{
+    if ((input.dim() < 1) || (1 != input.size(0)) || (!m_inputs.empty() && !input.sizes().equals(m_inputs.front().sizes())))
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+    m_inputs.push_back(input);
+    return (m_inputs.size() - 1);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArDLHelper::InferenceBatch::Run(TorchModel &model)
+{
+    m_outputs.clear();
+
+    const unsigned int nInputs(m_inputs.size());
+    const unsigned int maxBatchSize(((m_maxBatchSize > 0) && (m_maxBatchSize < nInputs)) ? m_maxBatchSize : nInputs);
+
+    for (unsigned int firstInput = 0; firstInput < nInputs; firstInput += maxBatchSize)
+    {
+        const unsigned int nBatchInputs(std::min(maxBatchSize, nInputs - firstInput));
+        TorchInputVector batchInputs;
+
+        if (1 == nBatchInputs)
+        {
+            batchInputs.push_back(m_inputs.at(firstInput));
+        }
+        else
+        {
+            // ATTN Only reallocate the batch input tensor if the input shape has changed or more capacity is required
+            std::vector<int64_t> batchSizes(m_inputs.front().sizes().vec());
+            const bool isSameShape(m_batchInput.defined() && (m_batchInput.dim() == static_cast<int64_t>(batchSizes.size())) &&
+                m_batchInput.sizes().slice(1).equals(m_inputs.front().sizes().slice(1)));
+
+            if (!isSameShape || (m_batchInput.size(0) < nBatchInputs))
+            {
+                batchSizes.at(0) = maxBatchSize;
+                m_batchInput = torch::empty(batchSizes, m_inputs.front().options());
+            }
+
+            for (unsigned int iInput = 0; iInput < nBatchInputs; ++iInput)
+                m_batchInput.narrow(0, iInput, 1).copy_(m_inputs.at(firstInput + iInput));
+
+            batchInputs.push_back(m_batchInput.narrow(0, 0, nBatchInputs));
+        }
+
+        TorchOutput batchOutput;
+        LArDLHelper::Forward(model, batchInputs, batchOutput, m_device, m_precision);
+
+        for (unsigned int iInput = 0; iInput < nBatchInputs; ++iInput)
+            m_outputs.push_back((1 == nBatchInputs) ? batchOutput : batchOutput.narrow(0, iInput, 1));
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const LArDLHelper::TorchOutput &LArDLHelper::InferenceBatch::GetOutput(const unsigned int index) const
+{
+    return m_outputs.at(index);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+unsigned int LArDLHelper::InferenceBatch::GetNInputs() const
+{
+    return m_inputs.size();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArDLHelper::InferenceBatch::Clear()
+{
+    m_inputs.clear();
+    m_outputs.clear();
+}
+
 } // namespace lar_dl_content
@@ -13,6 +13,12 @@
 
 #include "Pandora/StatusCodes.h"
 
+#include <map>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <utility>
+
 namespace lar_dl_content
 {
 
@@ -28,14 +34,129 @@ public:
     typedef at::Tensor TorchOutput;
 
     /**
-     *  @brief  Loads a deep learning model
+     *  @brief  Precision enum, the numerical precision with which a model is run
+     */
+    enum Precision
+    {
+        FLOAT32,
+        FLOAT16,
+        BFLOAT16,
+        QUANTISED_INT8
+    };
+
+    /**
+     *  @brief  InferenceBatch class, collecting network inputs of a common shape from several requesters (views, tiles or slices) and
+     *          running them through a model in batches of a configurable size. The batch input tensor is retained between uses, so an
+     *          instance held by an algorithm avoids reallocating it for every event.
+     */
+    class InferenceBatch
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  maxBatchSize the maximum number of inputs per forward pass, zero to run all inputs in a single pass
+         */
+        InferenceBatch(const unsigned int maxBatchSize = 1);
+
+        /**
+         *  @brief  Set the maximum number of inputs per forward pass
+         *
+         *  @param  maxBatchSize the maximum number of inputs per forward pass, zero to run all inputs in a single pass
+         */
+        void SetMaxBatchSize(const unsigned int maxBatchSize);
+
+        /**
+         *  @brief  Set the device and precision with which inputs are run, which must match those with which the model was loaded
+         *
+         *  @param  device the device on which the model was loaded
+         *  @param  precision the precision with which the model was loaded
+         */
+        void SetInferenceOptions(const std::string &device, const Precision precision);
+
+        /**
+         *  @brief  Add an input to the batch
+         *
+         *  @param  input the input, with a leading batch dimension of size one
+         *
+         *  @return the index of the input, used to retrieve the corresponding output
+         */
+        unsigned int AddInput(const TorchInput &input);
+
+        /**
+         *  @brief  Run all inputs added since the batch was last cleared through a model
+         *
+         *  @param  model the model to run
+         */
+        void Run(TorchModel &model);
+
+        /**
+         *  @brief  Get the output corresponding to an input
+         *
+         *  @param  index the index of the input
+         *
+         *  @return the output, with a leading batch dimension of size one
+         */
+        const TorchOutput &GetOutput(const unsigned int index) const;
+
+        /**
+         *  @brief  Get the number of inputs added since the batch was last cleared
+         *
+         *  @return the number of inputs
+         */
+        unsigned int GetNInputs() const;
+
+        /**
+         *  @brief  Remove all inputs and outputs, retaining the batch input tensor for reuse
+         */
+        void Clear();
+
+    private:
+        typedef std::vector<TorchInput> TorchInputList;
+        typedef std::vector<TorchOutput> TorchOutputList;
+
+        unsigned int m_maxBatchSize; ///< The maximum number of inputs per forward pass, zero for no limit
+        std::string m_device;        ///< The device on which the model runs
+        Precision m_precision;       ///< The precision with which the model runs
+        TorchInputList m_inputs;     ///< The inputs added since the batch was last cleared
+        TorchOutputList m_outputs;   ///< The outputs from the last run, in input order
+        TorchInput m_batchInput;     ///< The batch input tensor, retained between runs
+    };
+
+    /**
+     *  @brief  Loads a deep learning model. Models are held in a process-wide registry, keyed by file name, device and precision, so each
+     *          model is deserialised only once and then shared, read-only, by every algorithm instance requesting it
      *
-     *  @param  filename the filename of the model to load
+     *  @param  filename the filename of the model to load, typically as resolved by LArFileHelper::FindFileInPath
      *  @param  model the TorchModel in which to store the loaded model
+     *  @param  device the device on which to load the model
+     *  @param  precision the precision to which to convert the model parameters. For QUANTISED_INT8, the file must hold a model that was
+     *          dynamically quantised before export, as quantisation of TorchScript modules is not available from C++
      *
-     *  @return STATUS_CODE_SUCCESS upon successful loading of the model. STATUS_CODE_FAILURE otherwise.
+     *  @return STATUS_CODE_SUCCESS upon successful loading of the model, STATUS_CODE_INVALID_PARAMETER if QUANTISED_INT8 is requested on a
+     *          device other than the cpu. STATUS_CODE_FAILURE otherwise.
      */
-    static pandora::StatusCode LoadModel(const std::string &filename, TorchModel &model);
+    static pandora::StatusCode LoadModel(
+        const std::string &filename, TorchModel &model, const std::string &device = "cpu", const Precision precision = FLOAT32);
+
+    /**
+     *  @brief  Get the precision corresponding to a configuration string
+     *
+     *  @param  name the configuration string, one of "fp32", "fp16", "bf16" or "int8"
+     *  @param  precision to receive the precision
+     *
+     *  @return STATUS_CODE_SUCCESS if the string is recognised, STATUS_CODE_INVALID_PARAMETER otherwise
+     */
+    static pandora::StatusCode GetPrecision(const std::string &name, Precision &precision);
+
+    /**
+     *  @brief  Apply the process-wide torch thread settings. Only the first request takes effect, as torch only allows the inter-op
+     *          thread pool to be sized once; later requests for different settings are reported and ignored
+     *
+     *  @param  nIntraOpThreads the number of intra-op threads, zero to keep the torch default
+     *  @param  nInterOpThreads the number of inter-op threads, zero to keep the torch default
+     */
+    static void ApplyThreadSettings(const unsigned int nIntraOpThreads, const unsigned int nInterOpThreads);
 
     /**
      *  @brief  Create a torch input tensor
@@ -53,6 +174,36 @@ public:
      *  @param  output the tensor to store the output in
      */
     static void Forward(TorchModel &model, const TorchInputVector &input, TorchOutput &output);
+
+    /**
+     *  @brief  Run a deep learning model loaded with a given device and precision. Float32 inputs are cast to the device and precision of
+     *          the model, and the output is returned as a float32 tensor on the cpu, so callers are unchanged whatever the precision
+     *
+     *  @param  model the model to run
+     *  @param  input the input to run over
+     *  @param  output the tensor to store the output in
+     *  @param  device the device on which the model was loaded
+     *  @param  precision the precision with which the model was loaded
+     */
+    static void Forward(
+        TorchModel &model, const TorchInputVector &input, TorchOutput &output, const std::string &device, const Precision precision);
+
+private:
+    typedef std::map<std::tuple<std::string, std::string, Precision>, TorchModel> ModelRegistry;
+
+    /**
+     *  @brief  Get the tensor type with which a model of a given precision is run
+     *
+     *  @param  precision the precision
+     *
+     *  @return the tensor type of the model inputs
+     */
+    static torch::Dtype GetInputType(const Precision precision);
+
+    static std::mutex m_modelRegistryMutex;                        ///< The mutex protecting the model registry and thread settings
+    static ModelRegistry m_modelRegistry;                          ///< The loaded models, indexed by file name, device and precision
+    static bool m_areThreadSettingsApplied;                        ///< Whether the process-wide thread settings have been applied
+    static std::pair<unsigned int, unsigned int> m_threadSettings; ///< The applied numbers of intra-op and inter-op threads
 };
 
 } // namespace lar_dl_content
@@ -21,7 +21,12 @@ using namespace lar_content;
 namespace lar_dl_content
 {
 
-DlHitValidationAlgorithm::DlHitValidationAlgorithm() : m_confusionU(), m_confusionV(), m_confusionW()
+DlHitValidationAlgorithm::DlHitValidationAlgorithm() :
+    m_treeName("confusion_tree"),
+    m_fileName("confusion.root"),
+    m_confusionU(),
+    m_confusionV(),
+    m_confusionW()
 {
 }
 
@@ -29,26 +34,26 @@ DlHitValidationAlgorithm::DlHitValidationAlgorithm() : m_confusionU(), m_confusi
 
 DlHitValidationAlgorithm::~DlHitValidationAlgorithm()
 {
-    PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), "confusion_tree", "u_true_shower", m_confusionU[0][0]));
-    PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), "confusion_tree", "u_false_shower", m_confusionU[1][0]));
-    PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), "confusion_tree", "u_false_track", m_confusionU[0][1]));
-    PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), "confusion_tree", "u_true_track", m_confusionU[1][1]));
-    PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), "confusion_tree", "v_true_shower", m_confusionV[0][0]));
-    PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), "confusion_tree", "v_false_shower", m_confusionV[1][0]));
-    PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), "confusion_tree", "v_false_track", m_confusionV[0][1]));
-    PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), "confusion_tree", "v_true_track", m_confusionV[1][1]));
-    PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), "confusion_tree", "w_true_shower", m_confusionW[0][0]));
-    PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), "confusion_tree", "w_false_shower", m_confusionW[1][0]));
-    PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), "confusion_tree", "w_false_track", m_confusionW[0][1]));
-    PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), "confusion_tree", "w_true_track", m_confusionW[1][1]));
-    PANDORA_MONITORING_API(FillTree(this->GetPandora(), "confusion_tree"));
+    PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName, "u_true_shower", m_confusionU[0][0]));
+    PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName, "u_false_shower", m_confusionU[1][0]));
+    PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName, "u_false_track", m_confusionU[0][1]));
+    PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName, "u_true_track", m_confusionU[1][1]));
+    PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName, "v_true_shower", m_confusionV[0][0]));
+    PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName, "v_false_shower", m_confusionV[1][0]));
+    PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName, "v_false_track", m_confusionV[0][1]));
+    PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName, "v_true_track", m_confusionV[1][1]));
+    PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName, "w_true_shower", m_confusionW[0][0]));
+    PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName, "w_false_shower", m_confusionW[1][0]));
+    PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName, "w_false_track", m_confusionW[0][1]));
+    PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName, "w_true_track", m_confusionW[1][1]));
+    PANDORA_MONITORING_API(FillTree(this->GetPandora(), m_treeName));
     try
     {
-        PANDORA_MONITORING_API(SaveTree(this->GetPandora(), "confusion_tree", "confusion.root", "UPDATE"));
+        PANDORA_MONITORING_API(SaveTree(this->GetPandora(), m_treeName, m_fileName, "UPDATE"));
     }
     catch (const StatusCodeException &)
     {
-        std::cout << "DlHitValidationAlgorithm: Unable to write confusion_tree to file" << std::endl;
+        std::cout << "DlHitValidationAlgorithm: Unable to write " << m_treeName << " to file" << std::endl;
     }
 }
 
@@ -113,6 +118,12 @@ StatusCode DlHitValidationAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
     PANDORA_RETURN_RESULT_IF_AND_IF(
         STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadVectorOfValues(xmlHandle, "CaloHitListNames", m_caloHitListNames));
 
+    // ATTN Distinct tree names allow the confusion matrices of reduced precision inference to be compared with those of the fp32 path
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "TreeName", m_treeName));
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "FileName", m_fileName));
+
     return STATUS_CODE_SUCCESS;
 }
 
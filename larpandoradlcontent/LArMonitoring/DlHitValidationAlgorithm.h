@@ -31,6 +31,8 @@ private:
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
     pandora::StringVector m_caloHitListNames; ///< Name of input calo hit list
+    std::string m_treeName;                   ///< The name of the confusion matrix tree
+    std::string m_fileName;                   ///< The name of the output file for the confusion matrix tree
     int m_confusionU[2][2];                   ///< Confusion matrix for the U view
     int m_confusionV[2][2];                   ///< Confusion matrix for the V view
     int m_confusionW[2][2];                   ///< Confusion matrix for the W view
@@ -42,6 +42,16 @@ protected:
     bool IsClearTrack(const pandora::Cluster *const pCluster) const;
 
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
+
+private:
+    /**
+     *  @brief  Add the track likelihoods of the hits in a cluster to a running sum, visiting the hits in place rather than copying them
+     *
+     *  @param  pCluster address of the relevant cluster
+     *  @param  likelihoodSum the running sum of the track likelihoods
+     *  @param  nLikelihoods the running number of hits contributing to the sum
+     */
+    void AddTrackLikelihoods(const pandora::Cluster *const pCluster, float &likelihoodSum, unsigned long &nLikelihoods) const;
 };
 
 } // namespace lar_dl_content
@@ -22,6 +22,8 @@
 #include "larpandoracontent/LArObjects/LArCaloHit.h"
 
 #include <chrono>
+#include <future>
+#include <unordered_map>
 
 using namespace pandora;
 using namespace lar_content;
@@ -29,13 +31,24 @@ using namespace lar_content;
 namespace lar_dl_content
 {
 
+std::mutex DlHitTrackShowerIdAlgorithm::m_asyncInferenceMutex;
+DlHitTrackShowerIdAlgorithm::AsyncInferenceMap DlHitTrackShowerIdAlgorithm::m_asyncInferenceMap;
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 DlHitTrackShowerIdAlgorithm::DlHitTrackShowerIdAlgorithm() :
+    m_device("cpu"),
+    m_precision(LArDLHelper::FLOAT32),
     m_imageHeight(256),
     m_imageWidth(256),
     m_tileSize(128.f),
+    m_maxTilesPerBatch(1),
     m_visualize(false),
     m_useTrainingMode(false),
-    m_trainingOutputFile("")
+    m_trainingOutputFile(""),
+    m_writeBinaryTrainingExamples(false),
+    m_asyncMode(SYNCHRONOUS),
+    m_asyncRequestName("DlHitTrackShowerId")
 {
 }
 
@@ -51,6 +64,10 @@ StatusCode DlHitTrackShowerIdAlgorithm::Run()
 {
     if (m_useTrainingMode)
         return this->Train();
+    else if (SUBMIT == m_asyncMode)
+        return this->SubmitInference();
+    else if (COLLECT == m_asyncMode)
+        return this->CollectInference();
     else
         return this->Infer();
 }
@@ -60,6 +77,13 @@ StatusCode DlHitTrackShowerIdAlgorithm::Run()
 StatusCode DlHitTrackShowerIdAlgorithm::Train()
 {
     const int SHOWER{1}, TRACK{2};
+    const std::string extension(m_writeBinaryTrainingExamples ? ".bin" : ".csv");
+    const MvaTrainingExampleWriter::Format format(
+        m_writeBinaryTrainingExamples ? MvaTrainingExampleWriter::BINARY : MvaTrainingExampleWriter::TEXT);
+
+    // ATTN Neutron ancestry depends only on the mc particle, so is shared by every hit of a particle and across views
+    std::unordered_map<const MCParticle *, bool> neutronDescendentMap;
+
     for (const std::string listName : m_caloHitListNames)
     {
         const CaloHitList *pCaloHitList(nullptr);
@@ -75,11 +99,11 @@ StatusCode DlHitTrackShowerIdAlgorithm::Train()
         std::string trainingOutputFileName(m_trainingOutputFile);
 
         if (view == TPC_VIEW_U)
-            trainingOutputFileName += "_CaloHitListU.csv";
+            trainingOutputFileName += "_CaloHitListU" + extension;
         else if (view == TPC_VIEW_V)
-            trainingOutputFileName += "_CaloHitListV.csv";
+            trainingOutputFileName += "_CaloHitListV" + extension;
         else if (view == TPC_VIEW_W)
-            trainingOutputFileName += "_CaloHitListW.csv";
+            trainingOutputFileName += "_CaloHitListW" + extension;
 
         LArMCParticleHelper::PrimaryParameters parameters;
         // Only care about reconstructability with respect to the current view, so skip good view check
@@ -91,6 +115,10 @@ StatusCode DlHitTrackShowerIdAlgorithm::Train()
             pMCParticleList, pCaloHitList, parameters, LArMCParticleHelper::IsBeamNeutrinoFinalState, targetMCParticleToHitsMap);
 
         LArMvaHelper::MvaFeatureVector featureVector;
+        featureVector.reserve(1 + 4 * pCaloHitList->size());
+        // Reserve the first entry for the number of hits, set once the hits have been counted
+        featureVector.emplace_back(0.);
+
         for (const CaloHit *pCaloHit : *pCaloHitList)
         {
             int tag{TRACK};
@@ -102,7 +130,10 @@ StatusCode DlHitTrackShowerIdAlgorithm::Train()
                 // Throw away non-reconstructable hits
                 if (targetMCParticleToHitsMap.find(pMCParticle) == targetMCParticleToHitsMap.end())
                     continue;
-                if (LArMCParticleHelper::IsDescendentOf(pMCParticle, 2112))
+                auto iter(neutronDescendentMap.find(pMCParticle));
+                if (neutronDescendentMap.end() == iter)
+                    iter = neutronDescendentMap.emplace(pMCParticle, LArMCParticleHelper::IsDescendentOf(pMCParticle, 2112)).first;
+                if (iter->second)
                     continue;
                 inputEnergy = pCaloHit->GetInputEnergy();
                 if (inputEnergy < 0.f)
@@ -124,11 +155,10 @@ StatusCode DlHitTrackShowerIdAlgorithm::Train()
             featureVector.push_back(static_cast<double>(tag));
             featureVector.push_back(static_cast<double>(inputEnergy));
         }
-        // Add number of hits to end of vector than rotate (more efficient than direct insert at front)
-        featureVector.push_back(static_cast<double>(featureVector.size() / 4));
-        std::rotate(featureVector.rbegin(), featureVector.rbegin() + 1, featureVector.rend());
+        featureVector.front() = static_cast<double>((featureVector.size() - 1) / 4);
 
-        PANDORA_RETURN_RESULT_IF(pandora::STATUS_CODE_SUCCESS, !=, LArMvaHelper::ProduceTrainingExample(trainingOutputFileName, true, featureVector));
+        PANDORA_RETURN_RESULT_IF(
+            pandora::STATUS_CODE_SUCCESS, !=, LArMvaHelper::ProduceTrainingExample(trainingOutputFileName, format, true, featureVector));
     }
 
     return STATUS_CODE_SUCCESS;
@@ -138,8 +168,6 @@ StatusCode DlHitTrackShowerIdAlgorithm::Train()
 
 StatusCode DlHitTrackShowerIdAlgorithm::Infer()
 {
-    const float eps{1.1920929e-7}; // Python float epsilon, used in image padding
-
     if (m_visualize)
     {
         PANDORA_MONITORING_API(SetEveDisplayParameters(this->GetPandora(), true, DETECTOR_VIEW_XZ, -1.f, 1.f, 1.f));
@@ -147,159 +175,88 @@ StatusCode DlHitTrackShowerIdAlgorithm::Infer()
 
     for (const std::string listName : m_caloHitListNames)
     {
-        const CaloHitList *pCaloHitList(nullptr);
-        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::GetList(*this, listName, pCaloHitList));
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->PrepareViewInference(listName, m_viewInference));
 
-        const HitType view{pCaloHitList->front()->GetHitType()};
+        // Run the tile images through the trained model, in batches
+        m_viewInference.m_inferenceBatch.Run(this->GetModel(m_viewInference.m_view));
+        this->ApplyViewInference(m_viewInference);
+        m_viewInference.m_inferenceBatch.Clear();
+    }
 
-        if (!(view == TPC_VIEW_U || view == TPC_VIEW_V || view == TPC_VIEW_W))
-            return STATUS_CODE_NOT_ALLOWED;
+    if (m_visualize)
+    {
+        PANDORA_MONITORING_API(ViewEvent(this->GetPandora()));
+    }
 
-        LArDLHelper::TorchModel &model{view == TPC_VIEW_U ? m_modelU : (view == TPC_VIEW_V ? m_modelV : m_modelW)};
-
-        // Get bounds of hit region
-        float xMin{};
-        float xMax{};
-        float zMin{};
-        float zMax{};
-        this->GetHitRegion(*pCaloHitList, xMin, xMax, zMin, zMax);
-        const float xRange = (xMax + eps) - (xMin - eps);
-        int nTilesX = static_cast<int>(std::ceil(xRange / m_tileSize));
-
-        PixelToTileMap sparseMap;
-        this->GetSparseTileMap(*pCaloHitList, xMin, zMin, nTilesX, sparseMap);
-        const int nTiles = sparseMap.size();
-
-        CaloHitList trackHits, showerHits, otherHits;
-        // Process tile
-        // ATTN: Be sure to reset all values to zero after each tile has been processed
-        float **weights = new float *[m_imageHeight];
-        for (int r = 0; r < m_imageHeight; ++r)
-            weights[r] = new float[m_imageWidth]();
-        for (int i = 0; i < nTiles; ++i)
-        {
-            for (const CaloHit *pCaloHit : *pCaloHitList)
-            {
-                const float x(pCaloHit->GetPositionVector().GetX());
-                const float z(pCaloHit->GetPositionVector().GetZ());
-                // Determine which tile the hit will be assigned to
-                const int tileX = static_cast<int>(std::floor((x - xMin) / m_tileSize));
-                const int tileZ = static_cast<int>(std::floor((z - zMin) / m_tileSize));
-                const int tile = sparseMap.at(tileZ * nTilesX + tileX);
-                if (tile == i)
-                {
-                    // Determine hit position within the tile
-                    const float localX = std::fmod(x - xMin, m_tileSize);
-                    const float localZ = std::fmod(z - zMin, m_tileSize);
-                    // Determine hit pixel within the tile
-                    const int pixelX = static_cast<int>(std::floor(localX * m_imageWidth / m_tileSize));
-                    const int pixelZ = (m_imageHeight - 1) - static_cast<int>(std::floor(localZ * m_imageHeight / m_tileSize));
-                    weights[pixelZ][pixelX] += pCaloHit->GetInputEnergy();
-                }
-            }
+    return STATUS_CODE_SUCCESS;
+}
 
-            // Find min and max charge to allow normalisation
-            float chargeMin{std::numeric_limits<float>::max()}, chargeMax{-std::numeric_limits<float>::max()};
-            for (int r = 0; r < m_imageHeight; ++r)
-            {
-                for (int c = 0; c < m_imageWidth; ++c)
-                {
-                    if (weights[r][c] > chargeMax)
-                        chargeMax = weights[r][c];
-                    if (weights[r][c] < chargeMin)
-                        chargeMin = weights[r][c];
-                }
-            }
-            float chargeRange{chargeMax - chargeMin};
-            if (chargeRange <= 0.f)
-                chargeRange = 1.f;
-
-            // Populate accessor based on normalised weights
-            CaloHitToPixelMap caloHitToPixelMap;
-            LArDLHelper::TorchInput input;
-            LArDLHelper::InitialiseInput({1, 1, m_imageHeight, m_imageWidth}, input);
-            auto accessor = input.accessor<float, 4>();
-            for (const CaloHit *pCaloHit : *pCaloHitList)
-            {
-                const float x(pCaloHit->GetPositionVector().GetX());
-                const float z(pCaloHit->GetPositionVector().GetZ());
-                // Determine which tile the hit will be assigned to
-                const int tileX = static_cast<int>(std::floor((x - xMin) / m_tileSize));
-                const int tileZ = static_cast<int>(std::floor((z - zMin) / m_tileSize));
-                const int tile = sparseMap.at(tileZ * nTilesX + tileX);
-                if (tile == i)
-                {
-                    // Determine hit position within the tile
-                    const float localX = std::fmod(x - xMin, m_tileSize);
-                    const float localZ = std::fmod(z - zMin, m_tileSize);
-                    // Determine hit pixel within the tile
-                    const int pixelX = static_cast<int>(std::floor(localX * m_imageWidth / m_tileSize));
-                    const int pixelZ = (m_imageHeight - 1) - static_cast<int>(std::floor(localZ * m_imageHeight / m_tileSize));
-                    accessor[0][0][pixelZ][pixelX] = (weights[pixelZ][pixelX] - chargeMin) / chargeRange;
-                    caloHitToPixelMap.insert(std::make_pair(pCaloHit, std::make_tuple(tileZ, tileX, pixelZ, pixelX)));
-                }
-            }
-            // Reset weights
-            for (int r = 0; r < this->m_imageHeight; ++r)
-                for (int c = 0; c < this->m_imageWidth; ++c)
-                    weights[r][c] = 0.f;
-
-            // Run the input through the trained model and get the output accessor
-            LArDLHelper::TorchInputVector inputs;
-            inputs.push_back(input);
-            LArDLHelper::TorchOutput output;
-            LArDLHelper::Forward(model, inputs, output);
-            auto outputAccessor = output.accessor<float, 4>();
-
-            for (const CaloHit *pCaloHit : *pCaloHitList)
-            {
-                auto found{caloHitToPixelMap.find(pCaloHit)};
-                if (found == caloHitToPixelMap.end())
-                    continue;
-                auto pixelMap = found->second;
-                const int tileZ(std::get<0>(pixelMap));
-                const int tileX(std::get<1>(pixelMap));
-                const int tile = sparseMap.at(tileZ * nTilesX + tileX);
-                if (tile == i)
-                { // Make sure we're looking at a hit in the correct tile
-                    const int pixelZ(std::get<2>(pixelMap));
-                    const int pixelX(std::get<3>(pixelMap));
-
-                    // Apply softmax to loss to get actual probability
-                    float probShower = exp(outputAccessor[0][1][pixelZ][pixelX]);
-                    float probTrack = exp(outputAccessor[0][2][pixelZ][pixelX]);
-                    float probNull = exp(outputAccessor[0][0][pixelZ][pixelX]);
-                    if (probShower > probTrack && probShower > probNull)
-                        showerHits.push_back(pCaloHit);
-                    else if (probTrack > probShower && probTrack > probNull)
-                        trackHits.push_back(pCaloHit);
-                    else
-                        otherHits.push_back(pCaloHit);
-                    float recipSum = 1.f / (probShower + probTrack);
-                    // Adjust probabilities to ignore null hits and update LArCaloHit
-                    probShower *= recipSum;
-                    probTrack *= recipSum;
-                    LArCaloHit *pLArCaloHit{const_cast<LArCaloHit *>(dynamic_cast<const LArCaloHit *>(pCaloHit))};
-                    pLArCaloHit->SetShowerProbability(probShower);
-                    pLArCaloHit->SetTrackProbability(probTrack);
-                }
-            }
-        }
-        for (int r = 0; r < this->m_imageHeight; ++r)
-            delete[] weights[r];
-        delete[] weights;
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode DlHitTrackShowerIdAlgorithm::SubmitInference()
+{
+    std::shared_ptr<AsyncInference> pAsyncInference(std::make_shared<AsyncInference>());
+    pAsyncInference->m_viewInferences.resize(m_caloHitListNames.size());
 
-        if (m_visualize)
+    for (unsigned int i = 0; i < m_caloHitListNames.size(); ++i)
+    {
+        PANDORA_RETURN_RESULT_IF(
+            STATUS_CODE_SUCCESS, !=, this->PrepareViewInference(m_caloHitListNames.at(i), pAsyncInference->m_viewInferences.at(i)));
+    }
+
+    // ATTN The worker thread only runs the models, all access to pandora lists and hits remaining on the calling thread. The raw pointer
+    // avoids a reference cycle and stays valid, as destroying the request first waits for the worker to finish
+    AsyncInference *const pRawAsyncInference(pAsyncInference.get());
+    pAsyncInference->m_future = std::async(std::launch::async, [this, pRawAsyncInference]() {
+        for (ViewInference &viewInference : pRawAsyncInference->m_viewInferences)
+            viewInference.m_inferenceBatch.Run(this->GetModel(viewInference.m_view));
+    });
+
+    // ATTN Any uncollected request from a previous event is released after the mutex, as its destruction waits for its worker
+    const std::lock_guard<std::mutex> lock(m_asyncInferenceMutex);
+    pAsyncInference.swap(m_asyncInferenceMap[AsyncInferenceMap::key_type(&this->GetPandora(), m_asyncRequestName)]);
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode DlHitTrackShowerIdAlgorithm::CollectInference()
+{
+    std::shared_ptr<AsyncInference> pAsyncInference;
+
+    {
+        const std::lock_guard<std::mutex> lock(m_asyncInferenceMutex);
+        AsyncInferenceMap::iterator iter(m_asyncInferenceMap.find(AsyncInferenceMap::key_type(&this->GetPandora(), m_asyncRequestName)));
+
+        if (m_asyncInferenceMap.end() == iter)
         {
-            const std::string trackListName("TrackHits_" + listName);
-            const std::string showerListName("ShowerHits_" + listName);
-            const std::string otherListName("OtherHits_" + listName);
-            PANDORA_MONITORING_API(VisualizeCaloHits(this->GetPandora(), &trackHits, trackListName, BLUE));
-            PANDORA_MONITORING_API(VisualizeCaloHits(this->GetPandora(), &showerHits, showerListName, RED));
-            PANDORA_MONITORING_API(VisualizeCaloHits(this->GetPandora(), &otherHits, otherListName, BLACK));
+            std::cout << "DlHitTrackShowerIdAlgorithm: no inference submitted for request " << m_asyncRequestName << std::endl;
+            return STATUS_CODE_NOT_INITIALIZED;
         }
+
+        pAsyncInference = iter->second;
+        m_asyncInferenceMap.erase(iter);
+    }
+
+    try
+    {
+        pAsyncInference->m_future.get();
+    }
+    catch (const std::exception &e)
+    {
+        std::cout << "DlHitTrackShowerIdAlgorithm: inference failed for request " << m_asyncRequestName << ":\n" << e.what() << std::endl;
+        return STATUS_CODE_FAILURE;
     }
 
+    if (m_visualize)
+    {
+        PANDORA_MONITORING_API(SetEveDisplayParameters(this->GetPandora(), true, DETECTOR_VIEW_XZ, -1.f, 1.f, 1.f));
+    }
+
+    for (const ViewInference &viewInference : pAsyncInference->m_viewInferences)
+        this->ApplyViewInference(viewInference);
+
     if (m_visualize)
     {
         PANDORA_MONITORING_API(ViewEvent(this->GetPandora()));
@@ -310,7 +267,140 @@ StatusCode DlHitTrackShowerIdAlgorithm::Infer()
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void DlHitTrackShowerIdAlgorithm::GetHitRegion(const CaloHitList &caloHitList, float &xMin, float &xMax, float &zMin, float &zMax)
+StatusCode DlHitTrackShowerIdAlgorithm::PrepareViewInference(const std::string &listName, ViewInference &viewInference) const
+{
+    const float eps{1.1920929e-7}; // Python float epsilon, used in image padding
+
+    const CaloHitList *pCaloHitList(nullptr);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::GetList(*this, listName, pCaloHitList));
+
+    const HitType view{pCaloHitList->front()->GetHitType()};
+
+    if (!(view == TPC_VIEW_U || view == TPC_VIEW_V || view == TPC_VIEW_W))
+        return STATUS_CODE_NOT_ALLOWED;
+
+    viewInference.m_listName = listName;
+    viewInference.m_view = view;
+
+    // Get bounds of hit region
+    float xMin{};
+    float xMax{};
+    float zMin{};
+    float zMax{};
+    this->GetHitRegion(*pCaloHitList, xMin, xMax, zMin, zMax);
+    const float xRange = (xMax + eps) - (xMin - eps);
+    int nTilesX = static_cast<int>(std::ceil(xRange / m_tileSize));
+
+    PixelToTileMap sparseMap;
+    this->GetSparseTileMap(*pCaloHitList, xMin, zMin, nTilesX, sparseMap);
+    const int nTiles = sparseMap.size();
+
+    TileToHitPixelsVector &tileToHitPixels(viewInference.m_tileToHitPixels);
+    tileToHitPixels.clear();
+    this->GetTileHitPixels(*pCaloHitList, xMin, zMin, nTilesX, sparseMap, tileToHitPixels);
+
+    LArDLHelper::InferenceBatch &inferenceBatch(viewInference.m_inferenceBatch);
+    inferenceBatch.SetMaxBatchSize(static_cast<unsigned int>(m_maxTilesPerBatch));
+    inferenceBatch.SetInferenceOptions(m_device, m_precision);
+    inferenceBatch.Clear();
+
+    std::vector<float> weights(m_imageHeight * m_imageWidth, 0.f);
+
+    for (int i = 0; i < nTiles; ++i)
+    {
+        const HitPixelVector &hitPixels(tileToHitPixels.at(i));
+
+        // ATTN: Be sure to reset all values to zero before each tile is processed
+        std::fill(weights.begin(), weights.end(), 0.f);
+        for (const HitPixel &hitPixel : hitPixels)
+            weights[hitPixel.m_pixelZ * m_imageWidth + hitPixel.m_pixelX] += hitPixel.m_pCaloHit->GetInputEnergy();
+
+        // Find min and max charge to allow normalisation
+        float chargeMin{std::numeric_limits<float>::max()}, chargeMax{-std::numeric_limits<float>::max()};
+        for (const float weight : weights)
+        {
+            if (weight > chargeMax)
+                chargeMax = weight;
+            if (weight < chargeMin)
+                chargeMin = weight;
+        }
+        float chargeRange{chargeMax - chargeMin};
+        if (chargeRange <= 0.f)
+            chargeRange = 1.f;
+
+        // Populate accessor based on normalised weights
+        LArDLHelper::TorchInput input;
+        LArDLHelper::InitialiseInput({1, 1, m_imageHeight, m_imageWidth}, input);
+        auto accessor = input.accessor<float, 4>();
+        for (const HitPixel &hitPixel : hitPixels)
+        {
+            const float weight{weights[hitPixel.m_pixelZ * m_imageWidth + hitPixel.m_pixelX]};
+            accessor[0][0][hitPixel.m_pixelZ][hitPixel.m_pixelX] = (weight - chargeMin) / chargeRange;
+        }
+        inferenceBatch.AddInput(input);
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void DlHitTrackShowerIdAlgorithm::ApplyViewInference(const ViewInference &viewInference) const
+{
+    CaloHitList trackHits, showerHits, otherHits;
+    const int nTiles = viewInference.m_tileToHitPixels.size();
+
+    for (int i = 0; i < nTiles; ++i)
+    {
+        auto outputAccessor = viewInference.m_inferenceBatch.GetOutput(i).accessor<float, 4>();
+
+        for (const HitPixel &hitPixel : viewInference.m_tileToHitPixels.at(i))
+        {
+            const CaloHit *const pCaloHit{hitPixel.m_pCaloHit};
+            const int pixelZ{hitPixel.m_pixelZ};
+            const int pixelX{hitPixel.m_pixelX};
+
+            // Apply softmax to loss to get actual probability
+            float probShower = exp(outputAccessor[0][1][pixelZ][pixelX]);
+            float probTrack = exp(outputAccessor[0][2][pixelZ][pixelX]);
+            float probNull = exp(outputAccessor[0][0][pixelZ][pixelX]);
+            if (probShower > probTrack && probShower > probNull)
+                showerHits.push_back(pCaloHit);
+            else if (probTrack > probShower && probTrack > probNull)
+                trackHits.push_back(pCaloHit);
+            else
+                otherHits.push_back(pCaloHit);
+            float recipSum = 1.f / (probShower + probTrack);
+            // Adjust probabilities to ignore null hits and update LArCaloHit
+            probShower *= recipSum;
+            probTrack *= recipSum;
+            LArCaloHit *pLArCaloHit{const_cast<LArCaloHit *>(dynamic_cast<const LArCaloHit *>(pCaloHit))};
+            pLArCaloHit->SetShowerProbability(probShower);
+            pLArCaloHit->SetTrackProbability(probTrack);
+        }
+    }
+
+    if (m_visualize)
+    {
+        const std::string trackListName("TrackHits_" + viewInference.m_listName);
+        const std::string showerListName("ShowerHits_" + viewInference.m_listName);
+        const std::string otherListName("OtherHits_" + viewInference.m_listName);
+        PANDORA_MONITORING_API(VisualizeCaloHits(this->GetPandora(), &trackHits, trackListName, BLUE));
+        PANDORA_MONITORING_API(VisualizeCaloHits(this->GetPandora(), &showerHits, showerListName, RED));
+        PANDORA_MONITORING_API(VisualizeCaloHits(this->GetPandora(), &otherHits, otherListName, BLACK));
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArDLHelper::TorchModel &DlHitTrackShowerIdAlgorithm::GetModel(const HitType view)
+{
+    return (view == TPC_VIEW_U ? m_modelU : (view == TPC_VIEW_V ? m_modelV : m_modelW));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void DlHitTrackShowerIdAlgorithm::GetHitRegion(const CaloHitList &caloHitList, float &xMin, float &xMax, float &zMin, float &zMax) const
 {
     xMin = std::numeric_limits<float>::max();
     xMax = -std::numeric_limits<float>::max();
@@ -334,7 +424,7 @@ void DlHitTrackShowerIdAlgorithm::GetHitRegion(const CaloHitList &caloHitList, f
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void DlHitTrackShowerIdAlgorithm::GetSparseTileMap(
-    const CaloHitList &caloHitList, const float xMin, const float zMin, const int nTilesX, PixelToTileMap &sparseMap)
+    const CaloHitList &caloHitList, const float xMin, const float zMin, const int nTilesX, PixelToTileMap &sparseMap) const
 {
     // Identify the tiles that actually contain hits
     std::map<int, bool> tilePopulationMap;
@@ -362,23 +452,73 @@ void DlHitTrackShowerIdAlgorithm::GetSparseTileMap(
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void DlHitTrackShowerIdAlgorithm::GetTileHitPixels(const CaloHitList &caloHitList, const float xMin, const float zMin, const int nTilesX,
+    const PixelToTileMap &sparseMap, TileToHitPixelsVector &tileToHitPixels) const
+{
+    tileToHitPixels.assign(sparseMap.size(), HitPixelVector());
+
+    for (const CaloHit *pCaloHit : caloHitList)
+    {
+        const float x(pCaloHit->GetPositionVector().GetX());
+        const float z(pCaloHit->GetPositionVector().GetZ());
+        // Determine which tile the hit will be assigned to
+        const int tileX = static_cast<int>(std::floor((x - xMin) / m_tileSize));
+        const int tileZ = static_cast<int>(std::floor((z - zMin) / m_tileSize));
+        const int tile = sparseMap.at(tileZ * nTilesX + tileX);
+        // Determine hit position within the tile
+        const float localX = std::fmod(x - xMin, m_tileSize);
+        const float localZ = std::fmod(z - zMin, m_tileSize);
+        // Determine hit pixel within the tile
+        const int pixelX = static_cast<int>(std::floor(localX * m_imageWidth / m_tileSize));
+        const int pixelZ = (m_imageHeight - 1) - static_cast<int>(std::floor(localZ * m_imageHeight / m_tileSize));
+        tileToHitPixels.at(tile).push_back({pCaloHit, pixelZ, pixelX});
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode DlHitTrackShowerIdAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
 {
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "UseTrainingMode", m_useTrainingMode));
 
+    std::string asyncMode;
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "AsyncMode", asyncMode));
+    if (asyncMode.empty())
+        m_asyncMode = SYNCHRONOUS;
+    else if ("Submit" == asyncMode)
+        m_asyncMode = SUBMIT;
+    else if ("Collect" == asyncMode)
+        m_asyncMode = COLLECT;
+    else
+    {
+        std::cout << "Error: Unrecognised asynchronous inference mode " << asyncMode << std::endl;
+        return STATUS_CODE_INVALID_PARAMETER;
+    }
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "AsyncRequestName", m_asyncRequestName));
+
     if (m_useTrainingMode)
     {
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "TrainingOutputFileName", m_trainingOutputFile));
+        PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
+            XmlHelper::ReadValue(xmlHandle, "WriteBinaryTrainingExamples", m_writeBinaryTrainingExamples));
     }
-    else
+    else if (COLLECT != m_asyncMode)
     {
+        std::string precisionName{"fp32"};
+        PANDORA_RETURN_RESULT_IF_AND_IF(
+            STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "Device", m_device));
+        PANDORA_RETURN_RESULT_IF_AND_IF(
+            STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "Precision", precisionName));
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, LArDLHelper::GetPrecision(precisionName, m_precision));
         bool modelLoaded{false};
         PANDORA_RETURN_RESULT_IF_AND_IF(
             STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "ModelFileNameU", m_modelFileNameU));
         if (!m_modelFileNameU.empty())
         {
             m_modelFileNameU = LArFileHelper::FindFileInPath(m_modelFileNameU, "FW_SEARCH_PATH");
-            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, LArDLHelper::LoadModel(m_modelFileNameU, m_modelU));
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, LArDLHelper::LoadModel(m_modelFileNameU, m_modelU, m_device, m_precision));
             modelLoaded = true;
         }
         PANDORA_RETURN_RESULT_IF_AND_IF(
@@ -386,7 +526,7 @@ StatusCode DlHitTrackShowerIdAlgorithm::ReadSettings(const TiXmlHandle xmlHandle
         if (!m_modelFileNameV.empty())
         {
             m_modelFileNameV = LArFileHelper::FindFileInPath(m_modelFileNameV, "FW_SEARCH_PATH");
-            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, LArDLHelper::LoadModel(m_modelFileNameV, m_modelV));
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, LArDLHelper::LoadModel(m_modelFileNameV, m_modelV, m_device, m_precision));
             modelLoaded = true;
         }
         PANDORA_RETURN_RESULT_IF_AND_IF(
@@ -394,7 +534,7 @@ StatusCode DlHitTrackShowerIdAlgorithm::ReadSettings(const TiXmlHandle xmlHandle
         if (!m_modelFileNameW.empty())
         {
             m_modelFileNameW = LArFileHelper::FindFileInPath(m_modelFileNameW, "FW_SEARCH_PATH");
-            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, LArDLHelper::LoadModel(m_modelFileNameW, m_modelW));
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, LArDLHelper::LoadModel(m_modelFileNameW, m_modelW, m_device, m_precision));
             modelLoaded = true;
         }
         if (!modelLoaded)
@@ -402,6 +542,13 @@ StatusCode DlHitTrackShowerIdAlgorithm::ReadSettings(const TiXmlHandle xmlHandle
             std::cout << "Error: Inference requested, but no model files were successfully loaded" << std::endl;
             return STATUS_CODE_INVALID_PARAMETER;
         }
+        unsigned int nIntraOpThreads{0}, nInterOpThreads{0};
+        PANDORA_RETURN_RESULT_IF_AND_IF(
+            STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "NIntraOpThreads", nIntraOpThreads));
+        PANDORA_RETURN_RESULT_IF_AND_IF(
+            STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "NInterOpThreads", nInterOpThreads));
+        if (nIntraOpThreads > 0 || nInterOpThreads > 0)
+            LArDLHelper::ApplyThreadSettings(nIntraOpThreads, nInterOpThreads);
     }
 
     PANDORA_RETURN_RESULT_IF_AND_IF(
@@ -409,11 +556,18 @@ StatusCode DlHitTrackShowerIdAlgorithm::ReadSettings(const TiXmlHandle xmlHandle
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "ImageHeight", m_imageHeight));
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "ImageWidth", m_imageWidth));
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "TileSize", m_tileSize));
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "MaxTilesPerBatch", m_maxTilesPerBatch));
     if (m_imageHeight <= 0.f || m_imageWidth <= 0.f || m_tileSize <= 0.f)
     {
         std::cout << "Error: Invalid image size specification" << std::endl;
         return STATUS_CODE_INVALID_PARAMETER;
     }
+    if (m_maxTilesPerBatch < 0)
+    {
+        std::cout << "Error: Invalid maximum number of tiles per batch" << std::endl;
+        return STATUS_CODE_INVALID_PARAMETER;
+    }
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "Visualize", m_visualize));
 
     return STATUS_CODE_SUCCESS;
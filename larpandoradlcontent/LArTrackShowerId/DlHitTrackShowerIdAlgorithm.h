@@ -12,6 +12,11 @@
 
 #include "larpandoradlcontent/LArHelpers/LArDLHelper.h"
 
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+
 namespace lar_dl_content
 {
 
@@ -29,8 +34,56 @@ public:
     virtual ~DlHitTrackShowerIdAlgorithm();
 
 private:
-    typedef std::map<const pandora::CaloHit *, std::tuple<int, int, int, int>> CaloHitToPixelMap;
+    /**
+     *  @brief  HitPixel class, locating a calo hit within the image of its tile
+     */
+    class HitPixel
+    {
+    public:
+        const pandora::CaloHit *m_pCaloHit; ///< The address of the calo hit
+        int m_pixelZ;                       ///< The pixel row within the tile image
+        int m_pixelX;                       ///< The pixel column within the tile image
+    };
+
     typedef std::map<int, int> PixelToTileMap;
+    typedef std::vector<HitPixel> HitPixelVector;
+    typedef std::vector<HitPixelVector> TileToHitPixelsVector;
+
+    /**
+     *  @brief  ViewInference class, holding the tile images of a calo hit list and, once run, the corresponding network outputs
+     */
+    class ViewInference
+    {
+    public:
+        std::string m_listName;                       ///< The name of the calo hit list
+        pandora::HitType m_view;                      ///< The view of the calo hit list
+        TileToHitPixelsVector m_tileToHitPixels;      ///< The hit pixels for each tile
+        LArDLHelper::InferenceBatch m_inferenceBatch; ///< The batch of tile images for network inference
+    };
+
+    typedef std::vector<ViewInference> ViewInferenceVector;
+
+    /**
+     *  @brief  AsyncInference class, an inference request submitted by one algorithm instance and collected by another
+     */
+    class AsyncInference
+    {
+    public:
+        ViewInferenceVector m_viewInferences; ///< The view inferences, populated before the request is submitted
+        std::future<void> m_future;           ///< The future for the worker running the models, declared last so it is joined first
+    };
+
+    typedef std::map<std::pair<const pandora::Pandora *, std::string>, std::shared_ptr<AsyncInference>> AsyncInferenceMap;
+
+    /**
+     *  @brief  AsyncMode enum, whether inference runs in place or is submitted and collected by separate algorithm instances
+     */
+    enum AsyncMode
+    {
+        SYNCHRONOUS,
+        SUBMIT,
+        COLLECT
+    };
 
     pandora::StatusCode Run();
 
@@ -43,8 +96,43 @@ private:
      *  @brief  Run network inference
      */
     pandora::StatusCode Infer();
+
+    /**
+     *  @brief  Build the tile images for all calo hit lists and start running them through the models on a worker thread, so that
+     *          independent algorithms can proceed while the network runs
+     */
+    pandora::StatusCode SubmitInference();
+
+    /**
+     *  @brief  Wait for the inference request submitted earlier in the event and apply its network outputs to the hits
+     */
+    pandora::StatusCode CollectInference();
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
+    /**
+     *  @brief  Build the tile images for a calo hit list and add them to a view inference batch
+     *
+     *  @param  listName The name of the calo hit list
+     *  @param  viewInference The view inference to populate
+     */
+    pandora::StatusCode PrepareViewInference(const std::string &listName, ViewInference &viewInference) const;
+
+    /**
+     *  @brief  Set the track and shower probabilities of the hits in a view from the network outputs
+     *
+     *  @param  viewInference The view inference, which must have been run
+     */
+    void ApplyViewInference(const ViewInference &viewInference) const;
+
+    /**
+     *  @brief  Get the model for a view
+     *
+     *  @param  view The view
+     *
+     *  @return The model
+     */
+    LArDLHelper::TorchModel &GetModel(const pandora::HitType view);
+
     /**
      *  @brief  Identify the XZ range containing the hits for an event
      *
@@ -54,7 +142,7 @@ private:
      *  @param  zMin The output minimum z-coordinate
      *  @param  zMax The output maximum z-coordinate
      */
-    void GetHitRegion(const pandora::CaloHitList &caloHitList, float &xMin, float &xMax, float &zMin, float &zMax);
+    void GetHitRegion(const pandora::CaloHitList &caloHitList, float &xMin, float &xMax, float &zMin, float &zMax) const;
 
     /**
      *  @brief  Populate a map between pixels and tiles
@@ -65,21 +153,45 @@ private:
      *  @param  nTilesX The number of tiles in the x direction
      *  @param  sparseMap The output map between pixels and tiles
      */
-    void GetSparseTileMap(const pandora::CaloHitList &caloHitList, const float xMin, const float zMin, const int nTilesX, PixelToTileMap &sparseMap);
-
-    pandora::StringVector m_caloHitListNames; ///< Name of input calo hit list
-    std::string m_modelFileNameU;             ///< Model file name for U view
-    std::string m_modelFileNameV;             ///< Model file name for V view
-    std::string m_modelFileNameW;             ///< Model file name for W view
-    LArDLHelper::TorchModel m_modelU;         ///< Model for the U view
-    LArDLHelper::TorchModel m_modelV;         ///< Model for the V view
-    LArDLHelper::TorchModel m_modelW;         ///< Model for the W view
-    int m_imageHeight;                        ///< Height of images in pixels
-    int m_imageWidth;                         ///< Width of images in pixels
-    float m_tileSize;                         ///< Size of tile in cm
-    bool m_visualize;                         ///< Whether to visualize the track shower ID scores
-    bool m_useTrainingMode;                   ///< Training mode
-    std::string m_trainingOutputFile;         ///< Output file name for training examples
+    void GetSparseTileMap(
+        const pandora::CaloHitList &caloHitList, const float xMin, const float zMin, const int nTilesX, PixelToTileMap &sparseMap) const;
+
+    /**
+     *  @brief  Assign each hit to its tile and to its pixel within the tile image, in a single pass over the hits
+     *
+     *  @param  caloHitList The list of CaloHits to assign
+     *  @param  xMin The minimum x-coordinate
+     *  @param  zMin The minimum z-coordinate
+     *  @param  nTilesX The number of tiles in the x direction
+     *  @param  sparseMap The map between pixels and tiles
+     *  @param  tileToHitPixels The output hit pixels for each tile, in the order of the input hits
+     */
+    void GetTileHitPixels(const pandora::CaloHitList &caloHitList, const float xMin, const float zMin, const int nTilesX,
+        const PixelToTileMap &sparseMap, TileToHitPixelsVector &tileToHitPixels) const;
+
+    pandora::StringVector m_caloHitListNames;     ///< Name of input calo hit list
+    std::string m_modelFileNameU;                 ///< Model file name for U view
+    std::string m_modelFileNameV;                 ///< Model file name for V view
+    std::string m_modelFileNameW;                 ///< Model file name for W view
+    LArDLHelper::TorchModel m_modelU;             ///< Model for the U view
+    LArDLHelper::TorchModel m_modelV;             ///< Model for the V view
+    LArDLHelper::TorchModel m_modelW;             ///< Model for the W view
+    std::string m_device;                         ///< The device on which the models run
+    LArDLHelper::Precision m_precision;           ///< The precision with which the models run
+    ViewInference m_viewInference;                ///< The view inference for synchronous running, retained between events
+    int m_imageHeight;                            ///< Height of images in pixels
+    int m_imageWidth;                             ///< Width of images in pixels
+    float m_tileSize;                             ///< Size of tile in cm
+    int m_maxTilesPerBatch;                       ///< Maximum number of tiles per network forward pass, zero for all tiles of a view
+    bool m_visualize;                             ///< Whether to visualize the track shower ID scores
+    bool m_useTrainingMode;                       ///< Training mode
+    std::string m_trainingOutputFile;             ///< Output file name for training examples
+    bool m_writeBinaryTrainingExamples;           ///< Whether to write training examples in binary rather than text format
+    AsyncMode m_asyncMode;                        ///< Whether inference runs in place, is submitted or is collected
+    std::string m_asyncRequestName;               ///< The name pairing the submitting and collecting algorithm instances
+
+    static std::mutex m_asyncInferenceMutex;      ///< The mutex protecting the map of pending inference requests
+    static AsyncInferenceMap m_asyncInferenceMap; ///< The pending inference requests, indexed by pandora instance and request name
 };
 
 } // namespace lar_dl_content
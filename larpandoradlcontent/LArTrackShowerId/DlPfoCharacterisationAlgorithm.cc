@@ -13,8 +13,6 @@
 
 #include "larpandoradlcontent/LArTrackShowerId/DlPfoCharacterisationAlgorithm.h"
 
-#include <numeric>
-
 using namespace pandora;
 using namespace lar_content;
 
@@ -29,27 +27,15 @@ DlPfoCharacterisationAlgorithm::DlPfoCharacterisationAlgorithm()
 
 bool DlPfoCharacterisationAlgorithm::IsClearTrack(const Cluster *const pCluster) const
 {
-    const OrderedCaloHitList &orderedCaloHitList{pCluster->GetOrderedCaloHitList()};
-    CaloHitList caloHits;
-    orderedCaloHitList.FillCaloHitList(caloHits);
-    const CaloHitList &isolatedHits{pCluster->GetIsolatedCaloHitList()};
-    caloHits.insert(caloHits.end(), isolatedHits.begin(), isolatedHits.end());
-    FloatVector trackLikelihoods;
+    float likelihoodSum{0.f};
+    unsigned long nLikelihoods{0};
     try
     {
-        for (const CaloHit *pCaloHit : caloHits)
-        {
-            const LArCaloHit *pLArCaloHit{dynamic_cast<const LArCaloHit *>(pCaloHit)};
-            const float pTrack{pLArCaloHit->GetTrackProbability()};
-            const float pShower{pLArCaloHit->GetShowerProbability()};
-            if ((pTrack + pShower) > std::numeric_limits<float>::epsilon())
-                trackLikelihoods.emplace_back(pTrack / (pTrack + pShower));
-        }
+        this->AddTrackLikelihoods(pCluster, likelihoodSum, nLikelihoods);
 
-        const unsigned long N{trackLikelihoods.size()};
-        if (N > 0)
+        if (nLikelihoods > 0)
         {
-            float mean{std::accumulate(std::begin(trackLikelihoods), std::end(trackLikelihoods), 0.f) / N};
+            const float mean{likelihoodSum / nLikelihoods};
             if (mean >= 0.5f)
                 return true;
             else
@@ -69,34 +55,23 @@ bool DlPfoCharacterisationAlgorithm::IsClearTrack(const pandora::ParticleFlowObj
 {
     ClusterList allClusters;
     LArPfoHelper::GetTwoDClusterList(pPfo, allClusters);
-    FloatVector trackLikelihoods;
+    float likelihoodSum{0.f};
+    unsigned long nLikelihoods{0};
     for (const Cluster *pCluster : allClusters)
     {
-        const OrderedCaloHitList &orderedCaloHitList{pCluster->GetOrderedCaloHitList()};
-        CaloHitList caloHits;
-        orderedCaloHitList.FillCaloHitList(caloHits);
-        const CaloHitList &isolatedHits{pCluster->GetIsolatedCaloHitList()};
-        caloHits.insert(caloHits.end(), isolatedHits.begin(), isolatedHits.end());
+        // ATTN As before, a hit without probabilities ends its cluster's contribution, keeping the likelihoods added up to that hit
         try
         {
-            for (const CaloHit *pCaloHit : caloHits)
-            {
-                const LArCaloHit *pLArCaloHit{dynamic_cast<const LArCaloHit *>(pCaloHit)};
-                const float pTrack{pLArCaloHit->GetTrackProbability()};
-                const float pShower{pLArCaloHit->GetShowerProbability()};
-                if ((pTrack + pShower) > std::numeric_limits<float>::epsilon())
-                    trackLikelihoods.emplace_back(pTrack / (pTrack + pShower));
-            }
+            this->AddTrackLikelihoods(pCluster, likelihoodSum, nLikelihoods);
         }
         catch (const StatusCodeException &)
         {
         }
     }
 
-    const unsigned long N{trackLikelihoods.size()};
-    if (N > 0)
+    if (nLikelihoods > 0)
     {
-        float mean{std::accumulate(std::begin(trackLikelihoods), std::end(trackLikelihoods), 0.f) / N};
+        const float mean{likelihoodSum / nLikelihoods};
         if (mean >= 0.5f)
             return true;
         else
@@ -108,6 +83,33 @@ bool DlPfoCharacterisationAlgorithm::IsClearTrack(const pandora::ParticleFlowObj
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void DlPfoCharacterisationAlgorithm::AddTrackLikelihoods(
+    const Cluster *const pCluster, float &likelihoodSum, unsigned long &nLikelihoods) const
+{
+    // ATTN Hits are visited in the order FillCaloHitList would produce, followed by the isolated hits, so the float sum is unchanged
+    const auto addTrackLikelihood = [&likelihoodSum, &nLikelihoods](const CaloHit *const pCaloHit) {
+        const LArCaloHit *pLArCaloHit{dynamic_cast<const LArCaloHit *>(pCaloHit)};
+        const float pTrack{pLArCaloHit->GetTrackProbability()};
+        const float pShower{pLArCaloHit->GetShowerProbability()};
+        if ((pTrack + pShower) > std::numeric_limits<float>::epsilon())
+        {
+            likelihoodSum += pTrack / (pTrack + pShower);
+            ++nLikelihoods;
+        }
+    };
+
+    for (const OrderedCaloHitList::value_type &layerEntry : pCluster->GetOrderedCaloHitList())
+    {
+        for (const CaloHit *const pCaloHit : *layerEntry.second)
+            addTrackLikelihood(pCaloHit);
+    }
+
+    for (const CaloHit *const pCaloHit : pCluster->GetIsolatedCaloHitList())
+        addTrackLikelihood(pCaloHit);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode DlPfoCharacterisationAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
 {
     return PfoCharacterisationBaseAlgorithm::ReadSettings(xmlHandle);
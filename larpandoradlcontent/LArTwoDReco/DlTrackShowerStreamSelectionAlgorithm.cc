@@ -15,7 +15,7 @@
 
 #include "larpandoracontent/LArObjects/LArCaloHit.h"
 
-#include <numeric>
+#include <limits>
 
 using namespace pandora;
 using namespace lar_content;
@@ -25,27 +25,36 @@ namespace lar_dl_content
 
 StatusCode DlTrackShowerStreamSelectionAlgorithm::AllocateToStreams(const Cluster *const pCluster)
 {
-    const OrderedCaloHitList &orderedCaloHitList{pCluster->GetOrderedCaloHitList()};
-    CaloHitList caloHits;
-    orderedCaloHitList.FillCaloHitList(caloHits);
-    const CaloHitList &isolatedHits{pCluster->GetIsolatedCaloHitList()};
-    caloHits.insert(caloHits.end(), isolatedHits.begin(), isolatedHits.end());
-    FloatVector trackLikelihoods;
+    // ATTN Hits are visited in the order of the ordered calo hit list followed by the isolated hits, and the likelihoods summed in that
+    // order, so the mean matches that accumulated over a copied list of hits
+    float trackLikelihoodSum{0.f};
+    unsigned long nLikelihoods{0};
+
+    const auto addTrackLikelihood = [&trackLikelihoodSum, &nLikelihoods](const CaloHit *const pCaloHit) {
+        const LArCaloHit *pLArCaloHit{dynamic_cast<const LArCaloHit *>(pCaloHit)};
+        const float pTrack{pLArCaloHit->GetTrackProbability()};
+        const float pShower{pLArCaloHit->GetShowerProbability()};
+        if ((pTrack + pShower) > std::numeric_limits<float>::epsilon())
+        {
+            trackLikelihoodSum += pTrack / (pTrack + pShower);
+            ++nLikelihoods;
+        }
+    };
+
     try
     {
-        for (const CaloHit *pCaloHit : caloHits)
+        for (const OrderedCaloHitList::value_type &layerEntry : pCluster->GetOrderedCaloHitList())
         {
-            const LArCaloHit *pLArCaloHit{dynamic_cast<const LArCaloHit *>(pCaloHit)};
-            const float pTrack{pLArCaloHit->GetTrackProbability()};
-            const float pShower{pLArCaloHit->GetShowerProbability()};
-            if ((pTrack + pShower) > std::numeric_limits<float>::epsilon())
-                trackLikelihoods.emplace_back(pTrack / (pTrack + pShower));
+            for (const CaloHit *const pCaloHit : *layerEntry.second)
+                addTrackLikelihood(pCaloHit);
         }
 
-        const unsigned long N{trackLikelihoods.size()};
-        if (N > 0)
+        for (const CaloHit *const pCaloHit : pCluster->GetIsolatedCaloHitList())
+            addTrackLikelihood(pCaloHit);
+
+        if (nLikelihoods > 0)
         {
-            float mean{std::accumulate(std::begin(trackLikelihoods), std::end(trackLikelihoods), 0.f) / N};
+            const float mean{trackLikelihoodSum / nLikelihoods};
             if (mean >= 0.5f)
                 m_clusterListMap.at(m_trackListName).emplace_back(pCluster);
             else
@@ -28,12 +28,16 @@ namespace lar_dl_content
 DlVertexingAlgorithm::DlVertexingAlgorithm() :
     m_trainingMode{false},
     m_trainingOutputFile{""},
+    m_writeBinaryTrainingExamples{false},
     m_event{-1},
     m_pass{1},
     m_nClasses{0},
     m_height{256},
     m_width{256},
+    m_inputHeight{256},
+    m_inputWidth{256},
     m_driftStep{0.5f},
+    m_useRoi{false},
     m_visualise{false},
     m_writeTree{false},
     m_rng(static_cast<std::mt19937::result_type>(std::chrono::high_resolution_clock::now().time_since_epoch().count()))
@@ -111,7 +115,7 @@ StatusCode DlVertexingAlgorithm::PrepareTrainingSample()
         if (vertices.empty())
             continue;
         const CartesianVector &vertex{vertices.front()};
-        const std::string trainingFilename{m_trainingOutputFile + "_" + listname + ".csv"};
+        const std::string trainingFilename{m_trainingOutputFile + "_" + listname + (m_writeBinaryTrainingExamples ? ".bin" : ".csv")};
         const unsigned long nVertices{1};
         unsigned long nHits{0};
         const unsigned int nuance{LArMCParticleHelper::GetNuanceCode(hierarchy.front())};
@@ -135,6 +139,7 @@ StatusCode DlVertexingAlgorithm::PrepareTrainingSample()
             continue;
 
         LArMvaHelper::MvaFeatureVector featureVector;
+        featureVector.reserve(9 + 3 * pCaloHitList->size());
         featureVector.emplace_back(static_cast<double>(nuance));
         featureVector.emplace_back(static_cast<double>(nVertices));
         featureVector.emplace_back(xVtx);
@@ -144,6 +149,8 @@ StatusCode DlVertexingAlgorithm::PrepareTrainingSample()
         featureVector.emplace_back(xMax);
         featureVector.emplace_back(zMin);
         featureVector.emplace_back(zMax);
+        // ATTN Placeholder for the number of hits, set once the hits have been counted, avoiding a mid-vector insert
+        featureVector.emplace_back(0.);
 
         for (const CaloHit *pCaloHit : *pCaloHitList)
         {
@@ -156,10 +163,14 @@ StatusCode DlVertexingAlgorithm::PrepareTrainingSample()
             featureVector.emplace_back(static_cast<double>(adc));
             ++nHits;
         }
-        featureVector.insert(featureVector.begin() + 8, static_cast<double>(nHits));
+        featureVector[8] = static_cast<double>(nHits);
         // Only write out the feature vector if there were enough hits in the region of interest
         if (nHits > 10)
-            LArMvaHelper::ProduceTrainingExample(trainingFilename, true, featureVector);
+        {
+            const MvaTrainingExampleWriter::Format format(
+                m_writeBinaryTrainingExamples ? MvaTrainingExampleWriter::BINARY : MvaTrainingExampleWriter::TEXT);
+            LArMvaHelper::ProduceTrainingExample(trainingFilename, format, true, featureVector);
+        }
     }
 
     return STATUS_CODE_SUCCESS;
@@ -188,7 +199,9 @@ StatusCode DlVertexingAlgorithm::Infer()
         driftMax = std::max(viewDriftMax, driftMax);
     }
 
-    CartesianPointVector vertexCandidatesU, vertexCandidatesV, vertexCandidatesW;
+    std::vector<HitType> views;
+    std::vector<PixelVector> pixelVectors;
+    std::vector<LArDLHelper::TorchInput> networkInputs;
     for (const std::string listName : m_caloHitListNames)
     {
         const CaloHitList *pCaloHitList{nullptr};
@@ -202,45 +215,64 @@ StatusCode DlVertexingAlgorithm::Infer()
         LArDLHelper::TorchInput input;
         PixelVector pixelVector;
         this->MakeNetworkInputFromHits(*pCaloHitList, view, driftMin, driftMax, wireMin[view], wireMax[view], input, pixelVector);
+        views.emplace_back(view);
+        pixelVectors.emplace_back(pixelVector);
+        networkInputs.emplace_back(input);
+    }
 
-        // Run the input through the trained model
-        LArDLHelper::TorchInputVector inputs;
-        inputs.push_back(input);
-        LArDLHelper::TorchOutput output;
-        if (isU)
-            LArDLHelper::Forward(m_modelU, inputs, output);
-        else if (isV)
-            LArDLHelper::Forward(m_modelV, inputs, output);
-        else
-            LArDLHelper::Forward(m_modelW, inputs, output);
-
-        int colOffset{0}, rowOffset{0}, canvasWidth{m_width}, canvasHeight{m_height};
-        this->GetCanvasParameters(output, pixelVector, colOffset, rowOffset, canvasWidth, canvasHeight);
-
-        float **canvas{new float *[canvasHeight]};
-        for (int row = 0; row < canvasHeight; ++row)
-            canvas[row] = new float[canvasWidth]{};
-
-        // we want the maximum value in the num_classes dimension (1) for every pixel
-        auto classes{torch::argmax(output, 1)};
-        // the argmax result is a 1 x height x width tensor where each element is a class id
-        auto classesAccessor{classes.accessor<long, 3>()};
-        const double scaleFactor{std::sqrt(m_height * m_height + m_width * m_width)};
-        std::map<int, bool> haveSeenMap;
-        for (const auto [row, col] : pixelVector)
+    // Run the inputs through the trained models, batching together the views that share a model file
+    std::vector<LArDLHelper::TorchOutput> networkOutputs(views.size());
+    std::vector<bool> isProcessed(views.size(), false);
+    for (size_t i = 0; i < views.size(); ++i)
+    {
+        if (isProcessed[i])
+            continue;
+
+        const std::string &modelFileName{this->GetModelFileName(views[i])};
+        std::vector<size_t> batchIndices;
+        m_inferenceBatch.Clear();
+        for (size_t j = i; j < views.size(); ++j)
+        {
+            if (isProcessed[j] || (this->GetModelFileName(views[j]) != modelFileName))
+                continue;
+            m_inferenceBatch.AddInput(networkInputs[j]);
+            batchIndices.emplace_back(j);
+            isProcessed[j] = true;
+        }
+        m_inferenceBatch.Run(this->GetModel(views[i]));
+        for (size_t b = 0; b < batchIndices.size(); ++b)
+            networkOutputs[batchIndices[b]] = m_inferenceBatch.GetOutput(b);
+        m_inferenceBatch.Clear();
+    }
+
+    CartesianPointVector vertexCandidatesU, vertexCandidatesV, vertexCandidatesW;
+    for (size_t i = 0; i < views.size(); ++i)
+    {
+        const HitType view{views[i]};
+        const bool isU{view == TPC_VIEW_U}, isV{view == TPC_VIEW_V}, isW{view == TPC_VIEW_W};
+        const PixelVector &pixelVector{pixelVectors[i]};
+        const LArDLHelper::TorchOutput &output{networkOutputs[i]};
+
+        // we want the maximum value in the num_classes dimension (1), but only for the pixels populated by hits
+        IntVector pixelClasses;
+        this->GetPixelClasses(output, pixelVector, pixelClasses);
+
+        int colOffset{0}, rowOffset{0}, canvasWidth{m_inputWidth}, canvasHeight{m_inputHeight};
+        this->GetCanvasParameters(pixelClasses, pixelVector, colOffset, rowOffset, canvasWidth, canvasHeight);
+
+        // ATTN The canvas buffer is retained between views and events, so needs to be reset before use
+        m_canvas.assign(canvasHeight * canvasWidth, 0.f);
+        for (size_t p = 0; p < pixelVector.size(); ++p)
         {
-            const auto cls{classesAccessor[0][row][col]};
+            const auto [row, col] = pixelVector[p];
+            const int cls{pixelClasses[p]};
             if (cls > 0 && cls < m_nClasses)
-            {
-                const int inner{static_cast<int>(std::round(std::ceil(scaleFactor * m_thresholds[cls - 1])))};
-                const int outer{static_cast<int>(std::round(std::ceil(scaleFactor * m_thresholds[cls])))};
-                this->DrawRing(canvas, row + rowOffset, col + colOffset, inner, outer, 1.f / (outer * outer - inner * inner));
-            }
+                this->DrawRing(m_canvas.data(), canvasWidth, row + rowOffset, col + colOffset, m_rings[cls]);
         }
 
         CartesianPointVector positionVector;
-        this->MakeWirePlaneCoordinatesFromCanvas(
-            canvas, canvasWidth, canvasHeight, colOffset, rowOffset, view, driftMin, driftMax, wireMin[view], wireMax[view], positionVector);
+        this->MakeWirePlaneCoordinatesFromCanvas(m_canvas.data(), canvasWidth, canvasHeight, colOffset, rowOffset, view, driftMin, driftMax,
+            wireMin[view], wireMax[view], positionVector);
         if (isU)
             vertexCandidatesU.emplace_back(positionVector.front());
         else if (isV)
@@ -282,10 +314,6 @@ StatusCode DlVertexingAlgorithm::Infer()
             }
             PANDORA_MONITORING_API(ViewEvent(this->GetPandora()));
         }
-
-        for (int row = 0; row < canvasHeight; ++row)
-            delete[] canvas[row];
-        delete[] canvas;
     }
 
     int nEmptyLists{0};
@@ -350,6 +378,20 @@ StatusCode DlVertexingAlgorithm::Infer()
 
 //-----------------------------------------------------------------------------------------------------------------------------------------
 
+LArDLHelper::TorchModel &DlVertexingAlgorithm::GetModel(const HitType view)
+{
+    return (view == TPC_VIEW_U ? m_modelU : (view == TPC_VIEW_V ? m_modelV : m_modelW));
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------------------
+
+const std::string &DlVertexingAlgorithm::GetModelFileName(const HitType view) const
+{
+    return (view == TPC_VIEW_U ? m_modelFileNameU : (view == TPC_VIEW_V ? m_modelFileNameV : m_modelFileNameW));
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode DlVertexingAlgorithm::MakeNetworkInputFromHits(const CaloHitList &caloHits, const HitType view, const float xMin,
     const float xMax, const float zMin, const float zMax, LArDLHelper::TorchInput &networkInput, PixelVector &pixelVector) const
 {
@@ -359,19 +401,21 @@ StatusCode DlVertexingAlgorithm::MakeNetworkInputFromHits(const CaloHitList &cal
     const float driftStep{0.5f};
 
     // Determine the bin edges
-    std::vector<double> xBinEdges(m_width + 1);
-    std::vector<double> zBinEdges(m_height + 1);
+    std::vector<double> xBinEdges(m_inputWidth + 1);
+    std::vector<double> zBinEdges(m_inputHeight + 1);
     xBinEdges[0] = xMin - 0.5f * driftStep;
-    const double dx = ((xMax + 0.5f * driftStep) - xBinEdges[0]) / m_width;
-    for (int i = 1; i < m_width + 1; ++i)
+    const double dx = ((xMax + 0.5f * driftStep) - xBinEdges[0]) / m_inputWidth;
+    for (int i = 1; i < m_inputWidth + 1; ++i)
         xBinEdges[i] = xBinEdges[i - 1] + dx;
     zBinEdges[0] = zMin - 0.5f * pitch;
-    const double dz = ((zMax + 0.5f * pitch) - zBinEdges[0]) / m_height;
-    for (int i = 1; i < m_height + 1; ++i)
+    const double dz = ((zMax + 0.5f * pitch) - zBinEdges[0]) / m_inputHeight;
+    for (int i = 1; i < m_inputHeight + 1; ++i)
         zBinEdges[i] = zBinEdges[i - 1] + dz;
 
-    LArDLHelper::InitialiseInput({1, 1, m_height, m_width}, networkInput);
+    LArDLHelper::InitialiseInput({1, 1, m_inputHeight, m_inputWidth}, networkInput);
     auto accessor = networkInput.accessor<float, 4>();
+    PixelVector hitPixels;
+    hitPixels.reserve(caloHits.size());
 
     for (const CaloHit *pCaloHit : caloHits)
     {
@@ -386,15 +430,17 @@ StatusCode DlVertexingAlgorithm::MakeNetworkInputFromHits(const CaloHitList &cal
         const int pixelX{static_cast<int>(std::floor((x - xBinEdges[0]) / dx))};
         const int pixelZ{static_cast<int>(std::floor((z - zBinEdges[0]) / dz))};
         accessor[0][0][pixelZ][pixelX] += adc;
+        hitPixels.emplace_back(std::make_pair(pixelZ, pixelX));
     }
-    for (int row = 0; row < m_height; ++row)
+
+    // Only the pixels touched by hits can be populated, so visit those in row-major order rather than scanning the whole image
+    std::sort(hitPixels.begin(), hitPixels.end());
+    hitPixels.erase(std::unique(hitPixels.begin(), hitPixels.end()), hitPixels.end());
+    for (const auto [row, col] : hitPixels)
     {
-        for (int col = 0; col < m_width; ++col)
-        {
-            const float value{accessor[0][0][row][col]};
-            if (value > 0)
-                pixelVector.emplace_back(std::make_pair(row, col));
-        }
+        const float value{accessor[0][0][row][col]};
+        if (value > 0)
+            pixelVector.emplace_back(std::make_pair(row, col));
     }
 
     return STATUS_CODE_SUCCESS;
@@ -402,28 +448,31 @@ StatusCode DlVertexingAlgorithm::MakeNetworkInputFromHits(const CaloHitList &cal
 
 //-----------------------------------------------------------------------------------------------------------------------------------------
 
-StatusCode DlVertexingAlgorithm::MakeWirePlaneCoordinatesFromCanvas(float **canvas, const int canvasWidth, const int canvasHeight,
-    const int columnOffset, const int rowOffset, const HitType view, const float xMin, const float xMax, const float zMin, const float zMax,
-    CartesianPointVector &positionVector) const
+StatusCode DlVertexingAlgorithm::MakeWirePlaneCoordinatesFromCanvas(const float *const canvas, const int canvasWidth,
+    const int canvasHeight, const int columnOffset, const int rowOffset, const HitType view, const float xMin, const float xMax,
+    const float zMin, const float zMax, CartesianPointVector &positionVector) const
 {
     // ATTN If wire w pitches vary between TPCs, exception will be raised in initialisation of lar pseudolayer plugin
     const LArTPC *const pTPC(this->GetPandora().GetGeometry()->GetLArTPCMap().begin()->second);
     const float pitch(view == TPC_VIEW_U ? pTPC->GetWirePitchU() : view == TPC_VIEW_V ? pTPC->GetWirePitchV() : pTPC->GetWirePitchW());
     const float driftStep{0.5f};
 
-    const double dx = ((xMax + 0.5f * driftStep) - (xMin - 0.5f * driftStep)) / m_width;
-    const double dz = ((zMax + 0.5f * pitch) - (zMin - 0.5f * pitch)) / m_height;
+    const double dx = ((xMax + 0.5f * driftStep) - (xMin - 0.5f * driftStep)) / m_inputWidth;
+    const double dz = ((zMax + 0.5f * pitch) - (zMin - 0.5f * pitch)) / m_inputHeight;
 
     float best{-1.f};
     int rowBest{0}, colBest{0};
     for (int row = 0; row < canvasHeight; ++row)
         for (int col = 0; col < canvasWidth; ++col)
-            if (canvas[row][col] > 0 && canvas[row][col] > best)
+        {
+            const float value{canvas[row * canvasWidth + col]};
+            if (value > 0 && value > best)
             {
-                best = canvas[row][col];
+                best = value;
                 rowBest = row;
                 colBest = col;
             }
+        }
 
     const float x{static_cast<float>((colBest - columnOffset) * dx + xMin)};
     const float z{static_cast<float>((rowBest - rowOffset) * dz + zMin)};
@@ -436,19 +485,43 @@ StatusCode DlVertexingAlgorithm::MakeWirePlaneCoordinatesFromCanvas(float **canv
 
 //-----------------------------------------------------------------------------------------------------------------------------------------
 
-void DlVertexingAlgorithm::GetCanvasParameters(const LArDLHelper::TorchOutput &networkOutput, const PixelVector &pixelVector,
-    int &colOffset, int &rowOffset, int &width, int &height) const
+void DlVertexingAlgorithm::GetPixelClasses(
+    const LArDLHelper::TorchOutput &networkOutput, const PixelVector &pixelVector, IntVector &pixelClasses) const
 {
-    const double scaleFactor{std::sqrt(m_height * m_height + m_width * m_width)};
     // output is a 1 x num_classes x height x width tensor
-    // we want the maximum value in the num_classes dimension (1) for every pixel
-    auto classes{torch::argmax(networkOutput, 1)};
-    // the argmax result is a 1 x height x width tensor where each element is a class id
-    auto classesAccessor{classes.accessor<long, 3>()};
-    int colOffsetMin{0}, colOffsetMax{0}, rowOffsetMin{0}, rowOffsetMax{0};
+    auto outputAccessor{networkOutput.accessor<float, 4>()};
+    const int nOutputClasses{static_cast<int>(networkOutput.size(1))};
+    pixelClasses.reserve(pixelVector.size());
     for (const auto [row, col] : pixelVector)
     {
-        const auto cls{classesAccessor[0][row][col]};
+        // ATTN Match torch::argmax, which returns the first maximal value and treats nan as maximal
+        int bestClass{0};
+        float bestValue{outputAccessor[0][0][row][col]};
+        for (int cls = 1; cls < nOutputClasses; ++cls)
+        {
+            const float value{outputAccessor[0][cls][row][col]};
+            if (!std::isnan(bestValue) && (std::isnan(value) || value > bestValue))
+            {
+                bestClass = cls;
+                bestValue = value;
+            }
+        }
+        pixelClasses.emplace_back(bestClass);
+    }
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------------------
+
+void DlVertexingAlgorithm::GetCanvasParameters(
+    const IntVector &pixelClasses, const PixelVector &pixelVector, int &colOffset, int &rowOffset, int &width, int &height) const
+{
+    // ATTN Distance thresholds are relative to the image size used in training, including when the input is a region of interest
+    const double scaleFactor{std::sqrt(m_height * m_height + m_width * m_width)};
+    int colOffsetMin{0}, colOffsetMax{0}, rowOffsetMin{0}, rowOffsetMax{0};
+    for (size_t p = 0; p < pixelVector.size(); ++p)
+    {
+        const auto [row, col] = pixelVector[p];
+        const int cls{pixelClasses[p]};
         const double threshold{m_thresholds[cls]};
         if (threshold > 0. && threshold < 1.)
         {
@@ -465,13 +538,13 @@ void DlVertexingAlgorithm::GetCanvasParameters(const LArDLHelper::TorchOutput &n
     }
     colOffset = colOffsetMin < 0 ? -colOffsetMin : 0;
     rowOffset = rowOffsetMin < 0 ? -rowOffsetMin : 0;
-    width = std::max(colOffsetMax + colOffset + 1, m_width);
-    height = std::max(rowOffsetMax + rowOffset + 1, m_height);
+    width = std::max(colOffsetMax + colOffset + 1, m_inputWidth);
+    height = std::max(rowOffsetMax + rowOffset + 1, m_inputHeight);
 }
 
 //-----------------------------------------------------------------------------------------------------------------------------------------
 
-void DlVertexingAlgorithm::DrawRing(float **canvas, const int row, const int col, const int inner, const int outer, const float weight) const
+void DlVertexingAlgorithm::GetRingOffsets(const int inner, const int outer, PixelVector &offsets) const
 {
     // Set the starting position for each circle bounding the ring
     int c1{inner}, r1{0}, c2{outer}, r2{0};
@@ -490,26 +563,26 @@ void DlVertexingAlgorithm::DrawRing(float **canvas, const int row, const int col
         // Fill the pixels from inner to outer in the current row and their mirror pixels in the other octants
         for (int c = cp1; c <= cp2; ++c)
         {
-            canvas[row + rp2][col + c] += weight;
+            offsets.emplace_back(std::make_pair(rp2, c));
             if (rp2 != c)
-                canvas[row + c][col + rp2] += weight;
+                offsets.emplace_back(std::make_pair(c, rp2));
             if (rp2 != 0 && cp2 != 0)
             {
-                canvas[row - rp2][col - c] += weight;
+                offsets.emplace_back(std::make_pair(-rp2, -c));
                 if (rp2 != c)
-                    canvas[row - c][col - rp2] += weight;
+                    offsets.emplace_back(std::make_pair(-c, -rp2));
             }
             if (rp2 != 0)
             {
-                canvas[row - rp2][col + c] += weight;
+                offsets.emplace_back(std::make_pair(-rp2, c));
                 if (rp2 != c)
-                    canvas[row + c][col - rp2] += weight;
+                    offsets.emplace_back(std::make_pair(c, -rp2));
             }
             if (cp2 != 0)
             {
-                canvas[row + rp2][col - c] += weight;
+                offsets.emplace_back(std::make_pair(rp2, -c));
                 if (rp2 != c)
-                    canvas[row - c][col + rp2] += weight;
+                    offsets.emplace_back(std::make_pair(-c, rp2));
             }
         }
         // Only update the inner location while it remains in the octant (outer ring also remains in the octant of course, but the logic of
@@ -523,6 +596,31 @@ void DlVertexingAlgorithm::DrawRing(float **canvas, const int row, const int col
 
 //-----------------------------------------------------------------------------------------------------------------------------------------
 
+void DlVertexingAlgorithm::DrawRing(float *const canvas, const int canvasWidth, const int row, const int col, const Ring &ring) const
+{
+    for (const auto [rowOffset, colOffset] : ring.m_offsets)
+        canvas[(row + rowOffset) * canvasWidth + col + colOffset] += ring.m_weight;
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------------------
+
+void DlVertexingAlgorithm::MakeRings()
+{
+    m_rings.clear();
+    m_rings.resize(std::max(m_nClasses, 0));
+    const double scaleFactor{std::sqrt(m_height * m_height + m_width * m_width)};
+    for (int cls = 1; cls < m_nClasses; ++cls)
+    {
+        const int inner{static_cast<int>(std::round(std::ceil(scaleFactor * m_thresholds[cls - 1])))};
+        const int outer{static_cast<int>(std::round(std::ceil(scaleFactor * m_thresholds[cls])))};
+        Ring &ring{m_rings[cls]};
+        ring.m_weight = 1.f / (outer * outer - inner * inner);
+        this->GetRingOffsets(inner, outer, ring.m_offsets);
+    }
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------------------
+
 void DlVertexingAlgorithm::Update(const int radius2, int &col, int &row) const
 {
     // Bresenham midpoint circle algorithm to determine if we should update the column position
@@ -560,19 +658,30 @@ StatusCode DlVertexingAlgorithm::GetMCToHitsMap(LArMCParticleHelper::MCContribut
 
 StatusCode DlVertexingAlgorithm::CompleteMCHierarchy(const LArMCParticleHelper::MCContributionMap &mcToHitsMap, MCParticleList &mcHierarchy) const
 {
-    try
+    // ATTN Equivalent to appending each particle and its unlisted ancestors, but testing membership with a set rather than a list search
+    MCParticleSet hierarchySet;
+
+    for (const auto [mc, hits] : mcToHitsMap)
     {
-        for (const auto [mc, hits] : mcToHitsMap)
+        (void)hits;
+        mcHierarchy.push_back(mc);
+        hierarchySet.insert(mc);
+
+        const MCParticle *pMCParticle(mc);
+
+        while (!pMCParticle->GetParentList().empty())
         {
-            (void)hits;
-            mcHierarchy.push_back(mc);
-            LArMCParticleHelper::GetAllAncestorMCParticles(mc, mcHierarchy);
+            if (pMCParticle->GetParentList().size() != 1)
+                return STATUS_CODE_INVALID_PARAMETER;
+
+            pMCParticle = pMCParticle->GetParentList().front();
+
+            if (!hierarchySet.insert(pMCParticle).second)
+                break;
+
+            mcHierarchy.push_back(pMCParticle);
         }
     }
-    catch (const StatusCodeException &e)
-    {
-        return e.GetStatusCode();
-    }
 
     // Move the neutrino to the front of the list
     auto pivot =
@@ -673,10 +782,10 @@ void DlVertexingAlgorithm::GetHitRegion(const CaloHitList &caloHitList, float &x
             throw StatusCodeException(STATUS_CODE_NOT_FOUND);
         const float zAsymmetry{nHitsUpstream / static_cast<float>(nHitsViewTotal)};
 
-        const float xSpan{m_driftStep * (m_width - 1)};
+        const float xSpan{m_driftStep * (m_inputWidth - 1)};
         xMin = xVtx - xAsymmetry * xSpan;
-        xMax = xMin + (m_driftStep * (m_width - 1));
-        const float zSpan{pitch * (m_height - 1)};
+        xMax = xMin + (m_driftStep * (m_inputWidth - 1));
+        const float zSpan{pitch * (m_inputHeight - 1)};
         zMin = zVtx - zAsymmetry * zSpan;
         zMax = zMin + zSpan;
     }
@@ -685,14 +794,14 @@ void DlVertexingAlgorithm::GetHitRegion(const CaloHitList &caloHitList, float &x
     // ATTN: Rescaling is to a size 1 pixel smaller than the intended image to ensure all hits fit within an imaged binned
     // to be one pixel wider than this
     const float xRange{xMax - xMin}, zRange{zMax - zMin};
-    const float minXSpan{m_driftStep * (m_width - 1)};
+    const float minXSpan{m_driftStep * (m_inputWidth - 1)};
     if (xRange < minXSpan)
     {
         const float padding{0.5f * (minXSpan - xRange)};
         xMin -= padding;
         xMax += padding;
     }
-    const float minZSpan{pitch * (m_height - 1)};
+    const float minZSpan{pitch * (m_inputHeight - 1)};
     if (zRange < minZSpan)
     {
         const float padding{0.5f * (minZSpan - zRange)};
@@ -845,27 +954,65 @@ StatusCode DlVertexingAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "ImageWidth", m_width));
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadVectorOfValues(xmlHandle, "DistanceThresholds", m_thresholds));
     m_nClasses = m_thresholds.size() - 1;
+    this->MakeRings();
+    m_inputHeight = m_height;
+    m_inputWidth = m_width;
     if (m_pass > 1)
     {
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "InputVertexListName", m_inputVertexListName));
+        PANDORA_RETURN_RESULT_IF_AND_IF(
+            STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "UseRoi", m_useRoi));
+        if (m_useRoi)
+        {
+            PANDORA_RETURN_RESULT_IF_AND_IF(
+                STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "RoiHeight", m_inputHeight));
+            PANDORA_RETURN_RESULT_IF_AND_IF(
+                STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "RoiWidth", m_inputWidth));
+            PANDORA_RETURN_RESULT_IF_AND_IF(
+                STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "RoiDriftStep", m_driftStep));
+            if (m_inputHeight <= 0 || m_inputWidth <= 0 || m_driftStep <= 0.f)
+            {
+                std::cout << "DlVertexingAlgorithm: Invalid region of interest specification" << std::endl;
+                return STATUS_CODE_INVALID_PARAMETER;
+            }
+        }
     }
 
     if (m_trainingMode)
     {
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "TrainingOutputFileName", m_trainingOutputFile));
+        PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
+            XmlHelper::ReadValue(xmlHandle, "WriteBinaryTrainingExamples", m_writeBinaryTrainingExamples));
     }
     else
     {
-        std::string modelName;
-        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "ModelFileNameU", modelName));
-        modelName = LArFileHelper::FindFileInPath(modelName, "FW_SEARCH_PATH");
-        LArDLHelper::LoadModel(modelName, m_modelU);
-        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "ModelFileNameV", modelName));
-        modelName = LArFileHelper::FindFileInPath(modelName, "FW_SEARCH_PATH");
-        LArDLHelper::LoadModel(modelName, m_modelV);
-        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "ModelFileNameW", modelName));
-        modelName = LArFileHelper::FindFileInPath(modelName, "FW_SEARCH_PATH");
-        LArDLHelper::LoadModel(modelName, m_modelW);
+        std::string device{"cpu"}, precisionName{"fp32"};
+        PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "Device", device));
+        PANDORA_RETURN_RESULT_IF_AND_IF(
+            STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "Precision", precisionName));
+        LArDLHelper::Precision precision{LArDLHelper::FLOAT32};
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, LArDLHelper::GetPrecision(precisionName, precision));
+        m_inferenceBatch.SetInferenceOptions(device, precision);
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "ModelFileNameU", m_modelFileNameU));
+        m_modelFileNameU = LArFileHelper::FindFileInPath(m_modelFileNameU, "FW_SEARCH_PATH");
+        LArDLHelper::LoadModel(m_modelFileNameU, m_modelU, device, precision);
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "ModelFileNameV", m_modelFileNameV));
+        m_modelFileNameV = LArFileHelper::FindFileInPath(m_modelFileNameV, "FW_SEARCH_PATH");
+        LArDLHelper::LoadModel(m_modelFileNameV, m_modelV, device, precision);
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "ModelFileNameW", m_modelFileNameW));
+        m_modelFileNameW = LArFileHelper::FindFileInPath(m_modelFileNameW, "FW_SEARCH_PATH");
+        LArDLHelper::LoadModel(m_modelFileNameW, m_modelW, device, precision);
+        unsigned int maxBatchSize{1};
+        PANDORA_RETURN_RESULT_IF_AND_IF(
+            STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "MaxBatchSize", maxBatchSize));
+        m_inferenceBatch.SetMaxBatchSize(maxBatchSize);
+        unsigned int nIntraOpThreads{0}, nInterOpThreads{0};
+        PANDORA_RETURN_RESULT_IF_AND_IF(
+            STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "NIntraOpThreads", nIntraOpThreads));
+        PANDORA_RETURN_RESULT_IF_AND_IF(
+            STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "NInterOpThreads", nInterOpThreads));
+        if (nIntraOpThreads > 0 || nInterOpThreads > 0)
+            LArDLHelper::ApplyThreadSettings(nIntraOpThreads, nInterOpThreads);
         PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "WriteTree", m_writeTree));
         if (m_writeTree)
         {
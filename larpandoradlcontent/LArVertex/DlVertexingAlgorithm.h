@@ -58,11 +58,41 @@ private:
     typedef std::pair<int, int> Pixel; // A Pixel is a row, column pair
     typedef std::vector<Pixel> PixelVector;
 
+    /**
+     *  @brief  Ring class, holding the precomputed pixel offsets and weight of the ring drawn for a distance class
+     */
+    class Ring
+    {
+    public:
+        float m_weight;        ///< The weight added to each pixel of the ring
+        PixelVector m_offsets; ///< The row, column offsets of the ring pixels from the ring centre, in drawing order
+    };
+
+    typedef std::vector<Ring> RingVector;
+
     pandora::StatusCode Run();
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
     pandora::StatusCode PrepareTrainingSample();
     pandora::StatusCode Infer();
 
+    /**
+     *  @brief  Get the model for a wire plane view
+     *
+     *  @param  view The wire plane view
+     *
+     *  @return The model
+     */
+    LArDLHelper::TorchModel &GetModel(const pandora::HitType view);
+
+    /**
+     *  @brief  Get the model file name for a wire plane view
+     *
+     *  @param  view The wire plane view
+     *
+     *  @return The model file name
+     */
+    const std::string &GetModelFileName(const pandora::HitType view) const;
+
     /*
      *  @brief  Create input for the network from a calo hit list
      *
@@ -83,7 +113,7 @@ private:
     /*
      *  @brief  Create a list of wire plane-space coordinates from a canvas
      *
-     *  @param  canvas The input canvas
+     *  @param  canvas The input canvas, stored in row-major order
      *  @param  canvasWidth The width of the canvas
      *  @param  canvasHeight The height of the canvas
      *  @param  columnOffset The column offset used when populating the canvas
@@ -96,31 +126,42 @@ private:
      *
      *  @return The StatusCode resulting from the function
      **/
-    pandora::StatusCode MakeWirePlaneCoordinatesFromCanvas(float **canvas, const int canvasWidth, const int canvasHeight,
+    pandora::StatusCode MakeWirePlaneCoordinatesFromCanvas(const float *const canvas, const int canvasWidth, const int canvasHeight,
         const int columnOffset, const int rowOffset, const pandora::HitType view, const float xMin, const float xMax, const float zMin,
         const float zMax, pandora::CartesianPointVector &positionVector) const;
 
+    /**
+     *  @brief  Determine the most likely distance class for each populated pixel, evaluating the argmax of the network output over the
+     *          class dimension for the populated pixels only
+     *
+     *  @param  networkOutput The TorchOutput object populated by the network inference step
+     *  @param  pixelVector The vector of populated pixels
+     *  @param  pixelClasses The output distance class for each populated pixel
+     */
+    void GetPixelClasses(
+        const LArDLHelper::TorchOutput &networkOutput, const PixelVector &pixelVector, pandora::IntVector &pixelClasses) const;
+
     /**
      *  @brief  Determines the parameters of the canvas for extracting the vertex location.
      *          The network predicts the distance that each pixel associated with a hit is located from the vertex, but says nothing about
      *          the direction. As a result, the ring describing the potential vertices associated with that hit can extend beyond the
      *          original canvas size. This function returns the size of the required canvas and the offset for the bottom left corner.
      *
-     *  @param  networkOutput The TorchOutput object populated by the network inference step
+     *  @param  pixelClasses The distance class for each populated pixel
      *  @param  pixelVector The vector of populated pixels
      *  @param  columnOffset The output column offset for the canvas
      *  @param  rowOffset The output row offset for the canvas
      *  @param  width The output width for the canvas
      *  @param  height The output height for the canvas
      */
-    void GetCanvasParameters(const LArDLHelper::TorchOutput &networkOutput, const PixelVector &pixelVector, int &columnOffset,
-        int &rowOffset, int &width, int &height) const;
+    void GetCanvasParameters(const pandora::IntVector &pixelClasses, const PixelVector &pixelVector, int &columnOffset, int &rowOffset,
+        int &width, int &height) const;
 
     /**
-     *  @brief  Add a filled ring to the specified canvas.
+     *  @brief  Determine the pixel offsets of a filled ring from its centre.
      *          The ring has an inner radius based on the minimum predicted distance to the vertex and an outer radius based on the maximum
      *          predicted distance to the vertex. The centre of the ring is the location of the hit used to predict the distance to the
-     *          vertex. Each pixel to be filled is augmented by the specified weight. In this way, once all hits have been considered, a
+     *          vertex. Each pixel to be filled is augmented by the ring weight. In this way, once all hits have been considered, a
      *          consensus view emerges of the likely vertex location based on the overlap of various rings centred at different locations.
      *
      *          The underlying implementation is a variant of the Bresenham midpoint circle algorithm and therefore only computes pixel
@@ -128,15 +169,27 @@ private:
      *          points using integer arithmetic, guaranteeing each pixel of the ring is filled once and only once, and then mirrored to the
      *          remaining seven octants.
      *
-     *  @param  networkOutput The TorchOutput object populated by the network inference step
-     *  @param  pixelVector The vector of populated pixels
-     *  @param  thresholds The fractional distance thresholds representing the classes predicted by the network
-     *  @param  columnOffset The output column offset for the canvas
-     *  @param  rowOffset The output row offset for the canvas
-     *  @param  width The output width for the canvas
-     *  @param  height The output height for the canvas
+     *  @param  inner The inner radius of the ring
+     *  @param  outer The outer radius of the ring
+     *  @param  offsets The output row, column offsets of the ring pixels, in drawing order
+     */
+    void GetRingOffsets(const int inner, const int outer, PixelVector &offsets) const;
+
+    /**
+     *  @brief  Add a precomputed filled ring to the specified canvas
+     *
+     *  @param  canvas The canvas, stored in row-major order
+     *  @param  canvasWidth The width of the canvas
+     *  @param  row The row of the ring centre
+     *  @param  col The column of the ring centre
+     *  @param  ring The ring
+     */
+    void DrawRing(float *const canvas, const int canvasWidth, const int row, const int col, const Ring &ring) const;
+
+    /**
+     *  @brief  Precompute the ring drawn for each distance class, given the image size and distance class thresholds
      */
-    void DrawRing(float **canvas, const int row, const int col, const int inner, const int outer, const float weight) const;
+    void MakeRings();
 
     /**
      *  @brief  Update the coordinates along the loci of a circle.
@@ -214,26 +267,36 @@ private:
     void PopulateRootTree(const std::vector<VertexTuple> &vertexTuples, const pandora::CartesianPointVector &vertexCandidatesU,
         const pandora::CartesianPointVector &vertexCandidatesV, const pandora::CartesianPointVector &vertexCandidatesW) const;
 
-    bool m_trainingMode;                      ///< Training mode
-    std::string m_trainingOutputFile;         ///< Output file name for training examples
-    std::string m_inputVertexListName;        ///< Input vertex list name if 2nd pass
-    std::string m_outputVertexListName;       ///< Output vertex list name
-    pandora::StringVector m_caloHitListNames; ///< Names of input calo hit lists
-    LArDLHelper::TorchModel m_modelU;         ///< The model for the U view
-    LArDLHelper::TorchModel m_modelV;         ///< The model for the V view
-    LArDLHelper::TorchModel m_modelW;         ///< The model for the W view
-    int m_event;                              ///< The current event number
-    int m_pass;                               ///< The pass of the train/infer step
-    int m_nClasses;                           ///< The number of distance classes
-    int m_height;                             ///< The height of the images
-    int m_width;                              ///< The width of the images
-    float m_driftStep;                        ///< The size of a pixel in the drift direction in cm (most relevant in pass 2)
-    bool m_visualise;                         ///< Whether or not to visualise the candidate vertices
-    bool m_writeTree;                         ///< Whether or not to write validation details to a ROOT tree
-    std::string m_rootTreeName;               ///< The ROOT tree name
-    std::string m_rootFileName;               ///< The ROOT file name
-    std::mt19937 m_rng;                       ///< The random number generator
-    std::vector<double> m_thresholds;         ///< Distance class thresholds
+    bool m_trainingMode;                          ///< Training mode
+    std::string m_trainingOutputFile;             ///< Output file name for training examples
+    bool m_writeBinaryTrainingExamples;           ///< Whether to write training examples in binary rather than text format
+    std::string m_inputVertexListName;            ///< Input vertex list name if 2nd pass
+    std::string m_outputVertexListName;           ///< Output vertex list name
+    pandora::StringVector m_caloHitListNames;     ///< Names of input calo hit lists
+    LArDLHelper::TorchModel m_modelU;             ///< The model for the U view
+    LArDLHelper::TorchModel m_modelV;             ///< The model for the V view
+    LArDLHelper::TorchModel m_modelW;             ///< The model for the W view
+    std::string m_modelFileNameU;                 ///< The model file name for the U view
+    std::string m_modelFileNameV;                 ///< The model file name for the V view
+    std::string m_modelFileNameW;                 ///< The model file name for the W view
+    LArDLHelper::InferenceBatch m_inferenceBatch; ///< The batch of network inputs, shared by views with the same model file
+    int m_event;                                  ///< The current event number
+    int m_pass;                                   ///< The pass of the train/infer step
+    int m_nClasses;                               ///< The number of distance classes
+    int m_height;                                 ///< The height of the images
+    int m_width;                                  ///< The width of the images
+    int m_inputHeight;                            ///< The height of the network input, the region of interest height in ROI mode
+    int m_inputWidth;                             ///< The width of the network input, the region of interest width in ROI mode
+    float m_driftStep;                            ///< The size of a pixel in the drift direction in cm (most relevant in pass 2)
+    bool m_useRoi;                                ///< Whether to restrict pass 2 to a configurable window around the input vertex
+    bool m_visualise;                             ///< Whether or not to visualise the candidate vertices
+    bool m_writeTree;                             ///< Whether or not to write validation details to a ROOT tree
+    std::string m_rootTreeName;                   ///< The ROOT tree name
+    std::string m_rootFileName;                   ///< The ROOT file name
+    std::mt19937 m_rng;                           ///< The random number generator
+    std::vector<double> m_thresholds;             ///< Distance class thresholds
+    RingVector m_rings;                           ///< The precomputed ring for each distance class
+    std::vector<float> m_canvas;                  ///< The contiguous canvas buffer, retained between views and events
 };
 
 } // namespace lar_dl_content